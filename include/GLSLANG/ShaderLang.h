@@ -48,7 +48,7 @@ typedef unsigned int GLenum;
 
 // Version number for shader translation API.
 // It is incremented every time the API changes.
-#define ANGLE_SH_VERSION 132
+#define ANGLE_SH_VERSION 136
 
 typedef enum {
   SH_GLES2_SPEC = 0x8B40,
@@ -172,6 +172,11 @@ typedef enum {
   // It is intended as a workaround for drivers that do not handle
   // struct scopes correctly, including all Mac drivers and Linux AMD.
   SH_REGENERATE_STRUCT_NAMES = 0x80000,
+
+  // This flag computes a static estimate of the cost of running the shader
+  // from the validated intermediate tree.
+  // Can be queried by calling ShGetShaderCostEstimate().
+  SH_ESTIMATE_SHADER_COST = 0x100000,
 } ShCompileOptions;
 
 // Defines alternate strategies for implementing array index clamping.
@@ -244,6 +249,11 @@ typedef struct
     // Set a 64 bit hash function to enable user-defined name hashing.
     // Default is NULL.
     ShHashFunction64 HashFunction;
+    // The maximum number of hashed names the compiler keeps across compiles.
+    // The least recently used names are evicted after each compile that
+    // leaves more than this many. 0 disables it.
+    // Default is 16384.
+    int MaxNameHashingCacheSize;
 
     // Selects a strategy to use when implementing array index clamping.
     // Default is SH_CLAMP_WITH_CLAMP_INTRINSIC.
@@ -254,6 +264,17 @@ typedef struct
 
     // The maximum depth a call stack can be.
     int MaxCallStackDepth;
+
+    // Preprocessor limits. Shaders exceeding one of them fail to compile
+    // without being preprocessed any further.
+    // The maximum total length of the shader strings, in bytes.
+    int MaxShaderSourceSize;
+    // The maximum number of tokens on a single source line.
+    int MaxTokensPerLine;
+    // The maximum number of tokens produced by expanding macros.
+    int MaxMacroExpandedTokens;
+    // The maximum depth of nested macro expansions.
+    int MaxMacroNestingDepth;
 } ShBuiltInResources;
 
 //
@@ -329,6 +350,57 @@ COMPILER_EXPORT bool ShCompile(
     size_t numStrings,
     int compileOptions);
 
+typedef struct
+{
+    std::string name;
+    std::string behavior;
+} ShExtensionDirective;
+
+typedef struct
+{
+    std::string name;
+    std::string value;
+    // True for "#pragma STDGL name(value)".
+    bool stdgl;
+} ShPragmaDirective;
+
+typedef struct
+{
+    // The preprocessed tokens separated by single spaces, with one line per
+    // source line that produced tokens. Comments and directives are removed.
+    std::string text;
+    // The #version of the shader, 100 if there is none.
+    int version;
+    // #extension and #pragma directives in source order.
+    std::vector<ShExtensionDirective> extensions;
+    std::vector<ShPragmaDirective> pragmas;
+    // Names of the macros expanded or tested with defined, #ifdef or #ifndef,
+    // sorted. Includes predefined macros.
+    std::vector<std::string> referencedMacros;
+    // 64-bit FNV-1a hash of the token stream and the directives above.
+    // It does not depend on whitespace, comments or line breaks, and is the
+    // same on every platform.
+    unsigned long long fingerprint;
+} ShPreprocessorOutput;
+
+//
+// Runs only the preprocessor on the given shader source, using the
+// predefined macros and limits of the compiler. The shader is not parsed.
+// If the function succeeds, the return value is true, else false. Errors
+// can be queried by calling ShGetInfoLog().
+// Parameters:
+// handle: Specifies the handle of compiler to be used.
+// shaderStrings: Specifies an array of pointers to null-terminated strings
+//                containing the shader source code.
+// numStrings: Specifies the number of elements in shaderStrings array.
+// output: Receives the preprocessed shader.
+//
+COMPILER_EXPORT bool ShPreprocess(
+    const ShHandle handle,
+    const char * const shaderStrings[],
+    size_t numStrings,
+    ShPreprocessorOutput *output);
+
 // Return the version of the shader language.
 COMPILER_EXPORT int ShGetShaderVersion(const ShHandle handle);
 
@@ -354,6 +426,27 @@ COMPILER_EXPORT const std::string &ShGetObjectCode(const ShHandle handle);
 COMPILER_EXPORT const std::map<std::string, std::string> *ShGetNameHashingMap(
     const ShHandle handle);
 
+// Copies the (original_name, hash) pairs the compiler has cached across
+// compiles into |snapshot|. Restoring the snapshot, possibly in another
+// compiler, saves rehashing the names when compiling shaders that share
+// them.
+// Parameters:
+// handle: Specifies the compiler
+// snapshot: Receives the cached names
+COMPILER_EXPORT void ShGetNameHashingCache(
+    const ShHandle handle,
+    std::map<std::string, std::string> *snapshot);
+
+// Replaces the compiler's name hashing cache with |snapshot|, which must
+// have been taken with the same HashFunction. Names beyond
+// MaxNameHashingCacheSize are dropped.
+// Parameters:
+// handle: Specifies the compiler
+// snapshot: Cached names returned by ShGetNameHashingCache
+COMPILER_EXPORT void ShSetNameHashingCache(
+    const ShHandle handle,
+    const std::map<std::string, std::string> &snapshot);
+
 // Shader variable inspection.
 // Returns a pointer to a list of variables of the designated type.
 // (See ShaderVars.h for type definitions, included above)
@@ -372,6 +465,55 @@ typedef struct
     int size;
 } ShVariableInfo;
 
+// Static cost estimate of a shader, or of a single function in it.
+// Operations are counted once regardless of vector width. Calls to
+// user-defined functions count the full cost of the callee at each call site.
+typedef struct
+{
+    // Arithmetic, logic and built-in math operations.
+    unsigned int aluOps;
+    // Texture lookups.
+    unsigned int textureFetches;
+    // Texture lookups whose coordinates (or bias) depend on the result of
+    // another lookup. Only tracked within main().
+    unsigned int dependentTextureFetches;
+    // If statements and ternary operators.
+    unsigned int branches;
+    // Loops, and the subset of them whose trip count could not be
+    // determined statically.
+    unsigned int loops;
+    unsigned int unboundedLoops;
+    // Local variables declared.
+    unsigned int temporaries;
+    // Unpacked vec4 varying registers read or written.
+    unsigned int interpolators;
+    // ALU operations plus texture lookups, each multiplied by the trip
+    // count of the loops enclosing it. Unbounded loops count as one trip.
+    // Saturates at the largest unsigned long long instead of wrapping.
+    unsigned long long weightedInstructions;
+} ShShaderCost;
+
+typedef struct
+{
+    // Mangled function name, e.g. "main(" or "shade(vf3;".
+    std::string name;
+    ShShaderCost cost;
+} ShFunctionCost;
+
+typedef struct
+{
+    // Cost of main(), including global initializers.
+    ShShaderCost total;
+    // Cost of every function defined in the shader, in definition order.
+    std::vector<ShFunctionCost> functions;
+} ShShaderCostEstimate;
+
+// Returns the cost estimate computed by the last compile, or NULL if
+// SH_ESTIMATE_SHADER_COST was not set or the compile failed.
+// Parameters:
+// handle: Specifies the compiler
+COMPILER_EXPORT const ShShaderCostEstimate *ShGetShaderCostEstimate(const ShHandle handle);
+
 // Returns true if the passed in variables pack in maxVectors following
 // the packing rules from the GLSL 1.017 spec, Appendix A, section 7.
 // Returns false otherwise. Also look at the SH_ENFORCE_PACKING_RESTRICTIONS
@@ -28,7 +28,8 @@ static void usage();
 static sh::GLenum FindShaderType(const char* fileName);
 static bool CompileFile(char* fileName, ShHandle compiler, int compileOptions);
 static void LogMsg(const char* msg, const char* name, const int num, const char* logName);
-static void PrintActiveVariables(ShHandle compiler, ShShaderInfo varType);
+static void PrintActiveVariables(ShHandle compiler, int num);
+static void PrintShaderCost(ShHandle compiler);
 
 // If NUM_SOURCE_STRINGS is set to a value > 1, the input file data is
 // broken into that many chunks.
@@ -65,8 +66,6 @@ int main(int argc, char* argv[])
     int numCompiles = 0;
     ShHandle vertexCompiler = 0;
     ShHandle fragmentCompiler = 0;
-    char* buffer = 0;
-    size_t bufferLen = 0;
     ShShaderSpec spec = SH_GLES2_SPEC;
     ShShaderOutput output = SH_ESSL_OUTPUT;
 
@@ -87,6 +86,7 @@ int main(int argc, char* argv[])
             case 'e': compileOptions |= SH_EMULATE_BUILT_IN_FUNCTIONS; break;
             case 'd': compileOptions |= SH_DEPENDENCY_GRAPH; break;
             case 't': compileOptions |= SH_TIMING_RESTRICTIONS; break;
+            case 'c': compileOptions |= SH_ESTIMATE_SHADER_COST; break;
             case 's':
                 if (argv[0][2] == '=') {
                     switch (argv[0][3]) {
@@ -156,31 +156,23 @@ int main(int argc, char* argv[])
               bool compiled = CompileFile(argv[0], compiler, compileOptions);
 
               LogMsg("BEGIN", "COMPILER", numCompiles, "INFO LOG");
-              ShGetInfo(compiler, SH_INFO_LOG_LENGTH, &bufferLen);
-              buffer = (char*) realloc(buffer, bufferLen * sizeof(char));
-              ShGetInfoLog(compiler, buffer);
-              puts(buffer);
+              puts(ShGetInfoLog(compiler).c_str());
               LogMsg("END", "COMPILER", numCompiles, "INFO LOG");
               printf("\n\n");
 
               if (compiled && (compileOptions & SH_OBJECT_CODE)) {
                   LogMsg("BEGIN", "COMPILER", numCompiles, "OBJ CODE");
-                  ShGetInfo(compiler, SH_OBJECT_CODE_LENGTH, &bufferLen);
-                  buffer = (char*) realloc(buffer, bufferLen * sizeof(char));
-                  ShGetObjectCode(compiler, buffer);
-                  puts(buffer);
+                  puts(ShGetObjectCode(compiler).c_str());
                   LogMsg("END", "COMPILER", numCompiles, "OBJ CODE");
                   printf("\n\n");
               }
               if (compiled && (compileOptions & SH_VARIABLES)) {
-                  LogMsg("BEGIN", "COMPILER", numCompiles, "ACTIVE ATTRIBS");
-                  PrintActiveVariables(compiler, SH_ACTIVE_ATTRIBUTES);
-                  LogMsg("END", "COMPILER", numCompiles, "ACTIVE ATTRIBS");
-                  printf("\n\n");
-
-                  LogMsg("BEGIN", "COMPILER", numCompiles, "ACTIVE UNIFORMS");
-                  PrintActiveVariables(compiler, SH_ACTIVE_UNIFORMS);
-                  LogMsg("END", "COMPILER", numCompiles, "ACTIVE UNIFORMS");
+                  PrintActiveVariables(compiler, numCompiles);
+              }
+              if (compiled && (compileOptions & SH_ESTIMATE_SHADER_COST)) {
+                  LogMsg("BEGIN", "COMPILER", numCompiles, "COST ESTIMATE");
+                  PrintShaderCost(compiler);
+                  LogMsg("END", "COMPILER", numCompiles, "COST ESTIMATE");
                   printf("\n\n");
               }
               if (!compiled)
@@ -201,8 +193,6 @@ int main(int argc, char* argv[])
         ShDestruct(vertexCompiler);
     if (fragmentCompiler)
         ShDestruct(fragmentCompiler);
-    if (buffer)
-        free(buffer);
     ShFinalize();
 
     return failCode;
@@ -213,7 +203,7 @@ int main(int argc, char* argv[])
 //
 void usage()
 {
-    printf("Usage: translate [-i -m -o -u -l -e -b=e -b=g -b=h -x=i -x=d] file1 file2 ...\n"
+    printf("Usage: translate [-i -m -o -u -l -e -c -b=e -b=g -b=h -x=i -x=d] file1 file2 ...\n"
         "Where: filename : filename ending in .frag or .vert\n"
         "       -i       : print intermediate tree\n"
         "       -m       : map long variable names\n"
@@ -223,6 +213,7 @@ void usage()
         "       -e       : emulate certain built-in functions (workaround for driver bugs)\n"
         "       -t       : enforce experimental timing restrictions\n"
         "       -d       : print dependency graph used to enforce timing restrictions\n"
+        "       -c       : print static shader cost estimate\n"
         "       -s=e     : use GLES2 spec (this is by default)\n"
         "       -s=w     : use WebGL spec\n"
         "       -s=c     : use CSS Shaders spec\n"
@@ -281,72 +272,83 @@ void LogMsg(const char* msg, const char* name, const int num, const char* logNam
     printf("#### %s %s %d %s ####\n", msg, name, num, logName);
 }
 
-void PrintActiveVariables(ShHandle compiler, ShShaderInfo varType)
+static const char* GetTypeName(sh::GLenum type)
 {
-    size_t nameSize = 0;
-    switch (varType) {
-        case SH_ACTIVE_ATTRIBUTES:
-            ShGetInfo(compiler, SH_ACTIVE_ATTRIBUTE_MAX_LENGTH, &nameSize);
-            break;
-        case SH_ACTIVE_UNIFORMS:
-            ShGetInfo(compiler, SH_ACTIVE_UNIFORM_MAX_LENGTH, &nameSize);
-            break;
-        default: assert(0);
+    switch (type) {
+        case GL_FLOAT: return "GL_FLOAT";
+        case GL_FLOAT_VEC2: return "GL_FLOAT_VEC2";
+        case GL_FLOAT_VEC3: return "GL_FLOAT_VEC3";
+        case GL_FLOAT_VEC4: return "GL_FLOAT_VEC4";
+        case GL_INT: return "GL_INT";
+        case GL_INT_VEC2: return "GL_INT_VEC2";
+        case GL_INT_VEC3: return "GL_INT_VEC3";
+        case GL_INT_VEC4: return "GL_INT_VEC4";
+        case GL_UNSIGNED_INT: return "GL_UNSIGNED_INT";
+        case GL_UNSIGNED_INT_VEC2: return "GL_UNSIGNED_INT_VEC2";
+        case GL_UNSIGNED_INT_VEC3: return "GL_UNSIGNED_INT_VEC3";
+        case GL_UNSIGNED_INT_VEC4: return "GL_UNSIGNED_INT_VEC4";
+        case GL_BOOL: return "GL_BOOL";
+        case GL_BOOL_VEC2: return "GL_BOOL_VEC2";
+        case GL_BOOL_VEC3: return "GL_BOOL_VEC3";
+        case GL_BOOL_VEC4: return "GL_BOOL_VEC4";
+        case GL_FLOAT_MAT2: return "GL_FLOAT_MAT2";
+        case GL_FLOAT_MAT3: return "GL_FLOAT_MAT3";
+        case GL_FLOAT_MAT4: return "GL_FLOAT_MAT4";
+        case GL_FLOAT_MAT2x3: return "GL_FLOAT_MAT2x3";
+        case GL_FLOAT_MAT3x2: return "GL_FLOAT_MAT3x2";
+        case GL_FLOAT_MAT4x2: return "GL_FLOAT_MAT4x2";
+        case GL_FLOAT_MAT2x4: return "GL_FLOAT_MAT2x4";
+        case GL_FLOAT_MAT3x4: return "GL_FLOAT_MAT3x4";
+        case GL_FLOAT_MAT4x3: return "GL_FLOAT_MAT4x3";
+        case GL_SAMPLER_2D: return "GL_SAMPLER_2D";
+        case GL_SAMPLER_CUBE: return "GL_SAMPLER_CUBE";
+        case GL_SAMPLER_EXTERNAL_OES: return "GL_SAMPLER_EXTERNAL_OES";
+        default: assert(0); return "";
     }
-    if (nameSize <= 1) return;
-    char* name = new char[nameSize];
-
-    size_t activeVars = 0;
-    int size = 0;
-    sh::GLenum type = GL_NONE;
-    ShPrecisionType precision = SH_PRECISION_UNDEFINED;
-    int staticUse = 0;
-    const char* typeName = NULL;
-    ShGetInfo(compiler, varType, &activeVars);
-    for (size_t i = 0; i < activeVars; ++i) {
-        switch (varType) {
-            case SH_ACTIVE_ATTRIBUTES:
-                ShGetVariableInfo(compiler, SH_ACTIVE_ATTRIBUTES, static_cast<int>(i), NULL, &size, &type, &precision, &staticUse, name, NULL);
-                break;
-            case SH_ACTIVE_UNIFORMS:
-                ShGetVariableInfo(compiler, SH_ACTIVE_UNIFORMS, static_cast<int>(i), NULL, &size, &type, &precision, &staticUse, name, NULL);
-                break;
-            default: assert(0);
-        }
-        switch (type) {
-            case GL_FLOAT: typeName = "GL_FLOAT"; break;
-            case GL_FLOAT_VEC2: typeName = "GL_FLOAT_VEC2"; break;
-            case GL_FLOAT_VEC3: typeName = "GL_FLOAT_VEC3"; break;
-            case GL_FLOAT_VEC4: typeName = "GL_FLOAT_VEC4"; break;
-            case GL_INT: typeName = "GL_INT"; break;
-            case GL_INT_VEC2: typeName = "GL_INT_VEC2"; break;
-            case GL_INT_VEC3: typeName = "GL_INT_VEC3"; break;
-            case GL_INT_VEC4: typeName = "GL_INT_VEC4"; break;
-            case GL_UNSIGNED_INT: typeName = "GL_UNSIGNED_INT"; break;
-            case GL_UNSIGNED_INT_VEC2: typeName = "GL_UNSIGNED_INT_VEC2"; break;
-            case GL_UNSIGNED_INT_VEC3: typeName = "GL_UNSIGNED_INT_VEC3"; break;
-            case GL_UNSIGNED_INT_VEC4: typeName = "GL_UNSIGNED_INT_VEC4"; break;
-            case GL_BOOL: typeName = "GL_BOOL"; break;
-            case GL_BOOL_VEC2: typeName = "GL_BOOL_VEC2"; break;
-            case GL_BOOL_VEC3: typeName = "GL_BOOL_VEC3"; break;
-            case GL_BOOL_VEC4: typeName = "GL_BOOL_VEC4"; break;
-            case GL_FLOAT_MAT2: typeName = "GL_FLOAT_MAT2"; break;
-            case GL_FLOAT_MAT3: typeName = "GL_FLOAT_MAT3"; break;
-            case GL_FLOAT_MAT4: typeName = "GL_FLOAT_MAT4"; break;
-            case GL_FLOAT_MAT2x3: typeName = "GL_FLOAT_MAT2x3"; break;
-            case GL_FLOAT_MAT3x2: typeName = "GL_FLOAT_MAT3x2"; break;
-            case GL_FLOAT_MAT4x2: typeName = "GL_FLOAT_MAT4x2"; break;
-            case GL_FLOAT_MAT2x4: typeName = "GL_FLOAT_MAT2x4"; break;
-            case GL_FLOAT_MAT3x4: typeName = "GL_FLOAT_MAT3x4"; break;
-            case GL_FLOAT_MAT4x3: typeName = "GL_FLOAT_MAT4x3"; break;
-            case GL_SAMPLER_2D: typeName = "GL_SAMPLER_2D"; break;
-            case GL_SAMPLER_CUBE: typeName = "GL_SAMPLER_CUBE"; break;
-            case GL_SAMPLER_EXTERNAL_OES: typeName = "GL_SAMPLER_EXTERNAL_OES"; break;
-            default: assert(0);
-        }
-        printf("%lu: name:%s type:%s size:%d\n", i, name, typeName, size);
+}
+
+template <typename VarT>
+static void PrintVariables(const std::vector<VarT>* variables)
+{
+    if (!variables) return;
+    for (size_t i = 0; i < variables->size(); ++i) {
+        const VarT& var = (*variables)[i];
+        printf("%lu: name:%s type:%s size:%u\n", static_cast<unsigned long>(i),
+               var.name.c_str(), GetTypeName(var.type), var.elementCount());
+    }
+}
+
+void PrintActiveVariables(ShHandle compiler, int num)
+{
+    LogMsg("BEGIN", "COMPILER", num, "ACTIVE ATTRIBS");
+    PrintVariables(ShGetAttributes(compiler));
+    LogMsg("END", "COMPILER", num, "ACTIVE ATTRIBS");
+    printf("\n\n");
+
+    LogMsg("BEGIN", "COMPILER", num, "ACTIVE UNIFORMS");
+    PrintVariables(ShGetUniforms(compiler));
+    LogMsg("END", "COMPILER", num, "ACTIVE UNIFORMS");
+    printf("\n\n");
+}
+
+static void PrintCost(const char* name, const ShShaderCost& cost)
+{
+    printf("%s: alu:%u tex:%u dependent_tex:%u branches:%u loops:%u unbounded_loops:%u"
+           " temporaries:%u interpolators:%u weighted:%llu\n",
+           name, cost.aluOps, cost.textureFetches, cost.dependentTextureFetches,
+           cost.branches, cost.loops, cost.unboundedLoops, cost.temporaries,
+           cost.interpolators, cost.weightedInstructions);
+}
+
+void PrintShaderCost(ShHandle compiler)
+{
+    const ShShaderCostEstimate* estimate = ShGetShaderCostEstimate(compiler);
+    if (!estimate) return;
+
+    PrintCost("total", estimate->total);
+    for (size_t i = 0; i < estimate->functions.size(); ++i) {
+        PrintCost(estimate->functions[i].name.c_str(), estimate->functions[i].cost);
     }
-    delete [] name;
 }
 
 static bool ReadShaderSource(const char* fileName, ShaderSource& source) {
@@ -7,7 +7,7 @@
 // NativeWindow.h: Defines NativeWindow, a class for managing and
 // performing operations on an EGLNativeWindowType.
 // It is used for HWND (Desktop Windows) and IInspectable objects
-//(Windows Store Applications).
+//(Windows Store Applications). Other platforms have no window surfaces yet.
 
 #ifndef COMMON_NATIVEWINDOW_H_
 #define COMMON_NATIVEWINDOW_H_
@@ -37,7 +37,7 @@ class InspectableNativeWindow;
 using namespace Microsoft::WRL;
 using namespace Microsoft::WRL::Wrappers;
 
-#else
+#elif defined(ANGLE_PLATFORM_WINDOWS)
 typedef IDXGISwapChain DXGISwapChain;
 typedef IDXGIFactory DXGIFactory;
 #endif
@@ -53,9 +53,11 @@ class NativeWindow
     bool getClientRect(LPRECT rect);
     bool isIconic();
 
+#if defined(ANGLE_PLATFORM_WINDOWS)
     HRESULT createSwapChain(ID3D11Device* device, DXGIFactory* factory,
                             DXGI_FORMAT format, UINT width, UINT height,
                             DXGISwapChain** swapChain);
+#endif
 
     inline EGLNativeWindowType getNativeWindow() const { return mWindow; }
 
@@ -0,0 +1,99 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// cpufeatures.cpp: Detection of the instruction set extensions of the CPU.
+
+#include "common/cpufeatures.h"
+
+#include <string.h>
+
+#if defined(ANGLE_CPU_X86)
+#   if defined(_MSC_VER)
+#       include <intrin.h>
+#   else
+#       include <cpuid.h>
+#   endif
+#endif
+
+namespace gl
+{
+
+namespace
+{
+
+#if defined(ANGLE_CPU_X86)
+
+void QueryCPUID(unsigned int leaf, unsigned int subleaf, unsigned int info[4])
+{
+#if defined(_MSC_VER)
+    __cpuidex(reinterpret_cast<int*>(info), leaf, subleaf);
+#else
+    __cpuid_count(leaf, subleaf, info[0], info[1], info[2], info[3]);
+#endif
+}
+
+// Returns the low half of XCR0, the register state the OS saves on context
+// switches.
+unsigned int QueryEnabledRegisterState()
+{
+#if defined(_MSC_VER)
+    return static_cast<unsigned int>(_xgetbv(0));
+#else
+    unsigned int eax, edx;
+    __asm__ ("xgetbv" : "=a" (eax), "=d" (edx) : "c" (0));
+    return eax;
+#endif
+}
+
+#endif
+
+CPUFeatures DetectCPUFeatures()
+{
+    CPUFeatures features;
+    memset(&features, 0, sizeof(features));
+
+#if defined(ANGLE_CPU_X86)
+    unsigned int info[4];
+    QueryCPUID(0, 0, info);
+    const unsigned int maxLeaf = info[0];
+    if (maxLeaf < 1)
+    {
+        return features;
+    }
+
+    QueryCPUID(1, 0, info);
+    features.sse2 = (info[3] >> 26) & 1;
+    features.ssse3 = (info[2] >> 9) & 1;
+    features.sse41 = (info[2] >> 19) & 1;
+
+    const bool osxsave = (info[2] >> 27) & 1;
+    const bool avx = (info[2] >> 28) & 1;
+
+    // The OS must save both the XMM and the YMM registers.
+    const bool ymmEnabled = osxsave && (QueryEnabledRegisterState() & 0x6) == 0x6;
+
+    // F16C instructions are VEX encoded, like AVX.
+    features.f16c = avx && ymmEnabled && ((info[2] >> 29) & 1);
+
+    if (maxLeaf >= 7 && avx && ymmEnabled)
+    {
+        QueryCPUID(7, 0, info);
+        features.avx2 = (info[1] >> 5) & 1;
+    }
+#endif
+
+    return features;
+}
+
+}
+
+const CPUFeatures &GetCPUFeatures()
+{
+    static const CPUFeatures features = DetectCPUFeatures();
+    return features;
+}
+
+}
@@ -0,0 +1,35 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// cpufeatures.h: Detection of the instruction set extensions of the CPU.
+
+#ifndef COMMON_CPUFEATURES_H_
+#define COMMON_CPUFEATURES_H_
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#   define ANGLE_CPU_X86 1
+#endif
+
+namespace gl
+{
+
+struct CPUFeatures
+{
+    bool sse2;
+    bool ssse3;
+    bool sse41;
+    // Only reported when the OS also saves the YMM registers.
+    bool avx2;
+    bool f16c;
+};
+
+// Queries cpuid the first time it is called. Everything is false on
+// non-x86 CPUs.
+const CPUFeatures &GetCPUFeatures();
+
+}
+
+#endif // COMMON_CPUFEATURES_H_
@@ -0,0 +1,202 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// float16.cpp: Conversion of arrays between 32-bit and 16-bit floats.
+
+#include "common/float16.h"
+#include "common/cpufeatures.h"
+
+#include <string.h>
+
+#if defined(ANGLE_CPU_X86)
+#   include <immintrin.h>
+#endif
+
+#if defined(__GNUC__)
+#   define ANGLE_TARGET_F16C __attribute__((target("avx,f16c")))
+#else
+#   define ANGLE_TARGET_F16C
+#endif
+
+namespace gl
+{
+
+namespace
+{
+
+inline uint32_t FloatBits(float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+inline float BitsFloat(uint32_t bits)
+{
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// Branches only on the rare infinities, NaNs and denormals so that compilers
+// can vectorize the loops below.
+inline uint16_t Float32ToFloat16(float value)
+{
+    const uint32_t float32Infinity = 0x7F800000;
+    // The smallest float that doesn't fit a half float, 65520.0f
+    const uint32_t float16Overflow = 0x477FF000;
+    // The smallest float that is a normal half float, 2^-14
+    const uint32_t float16MinNormal = 0x38800000;
+
+    uint32_t bits = FloatBits(value);
+    uint32_t sign = (bits >> 16) & 0x8000;
+    uint32_t abs = bits & 0x7FFFFFFF;
+
+    uint32_t result;
+    if (abs >= float16Overflow)
+    {
+        // Infinity, or a quiet NaN that keeps the high bits of the payload
+        result = (abs > float32Infinity) ? (0x7E00 | ((abs >> 13) & 0x3FF)) : 0x7C00;
+    }
+    else if (abs < float16MinNormal)
+    {
+        // Adding 0.5 lines the half float denormal up with the low mantissa
+        // bits, and the FPU does the rounding.
+        const uint32_t half = 0x3F000000;
+        result = FloatBits(BitsFloat(abs) + BitsFloat(half)) - half;
+    }
+    else
+    {
+        // Rebias the exponent and round the 13 dropped bits to nearest even
+        uint32_t odd = (abs >> 13) & 1;
+        result = (abs - ((127 - 15) << 23) + 0xFFF + odd) >> 13;
+    }
+
+    return static_cast<uint16_t>(sign | result);
+}
+
+inline float Float16ToFloat32(uint16_t value)
+{
+    const uint32_t exponentMask = 0x7C00 << 13;
+
+    uint32_t sign = static_cast<uint32_t>(value & 0x8000) << 16;
+    uint32_t bits = static_cast<uint32_t>(value & 0x7FFF) << 13;
+    uint32_t exponent = bits & exponentMask;
+
+    bits += (127 - 15) << 23;
+    if (exponent == exponentMask)
+    {
+        // Infinity or NaN; NaNs are quieted
+        bits += (128 - 16) << 23;
+        if (bits & 0x007FFFFF)
+        {
+            bits |= 0x00400000;
+        }
+    }
+    else if (exponent == 0)
+    {
+        // Zero or denormal: renormalize with a float subtraction
+        const uint32_t float16MinNormal = 113 << 23;
+        bits = FloatBits(BitsFloat(bits + (1 << 23)) - BitsFloat(float16MinNormal));
+    }
+
+    return BitsFloat(sign | bits);
+}
+
+typedef void (*ConvertFloat32ToFloat16Function)(const float *, uint16_t *, size_t);
+typedef void (*ConvertFloat16ToFloat32Function)(const uint16_t *, float *, size_t);
+
+ConvertFloat32ToFloat16Function SelectConvertFloat32ToFloat16()
+{
+    return GetCPUFeatures().f16c ? ConvertFloat32ToFloat16F16C : ConvertFloat32ToFloat16Portable;
+}
+
+ConvertFloat16ToFloat32Function SelectConvertFloat16ToFloat32()
+{
+    return GetCPUFeatures().f16c ? ConvertFloat16ToFloat32F16C : ConvertFloat16ToFloat32Portable;
+}
+
+}
+
+void ConvertFloat32ToFloat16(const float *source, uint16_t *dest, size_t count)
+{
+    static const ConvertFloat32ToFloat16Function convert = SelectConvertFloat32ToFloat16();
+    convert(source, dest, count);
+}
+
+void ConvertFloat16ToFloat32(const uint16_t *source, float *dest, size_t count)
+{
+    static const ConvertFloat16ToFloat32Function convert = SelectConvertFloat16ToFloat32();
+    convert(source, dest, count);
+}
+
+void ConvertFloat32ToFloat16Portable(const float *source, uint16_t *dest, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        dest[i] = Float32ToFloat16(source[i]);
+    }
+}
+
+void ConvertFloat16ToFloat32Portable(const uint16_t *source, float *dest, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        dest[i] = Float16ToFloat32(source[i]);
+    }
+}
+
+#if defined(ANGLE_CPU_X86)
+
+ANGLE_TARGET_F16C void ConvertFloat32ToFloat16F16C(const float *source, uint16_t *dest, size_t count)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i halfs = _mm256_cvtps_ph(_mm256_loadu_ps(&source[i]), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&dest[i]), halfs);
+    }
+    if (i + 4 <= count)
+    {
+        __m128i halfs = _mm_cvtps_ph(_mm_loadu_ps(&source[i]), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(&dest[i]), halfs);
+        i += 4;
+    }
+    ConvertFloat32ToFloat16Portable(&source[i], &dest[i], count - i);
+}
+
+ANGLE_TARGET_F16C void ConvertFloat16ToFloat32F16C(const uint16_t *source, float *dest, size_t count)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i halfs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&source[i]));
+        _mm256_storeu_ps(&dest[i], _mm256_cvtph_ps(halfs));
+    }
+    if (i + 4 <= count)
+    {
+        __m128i halfs = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&source[i]));
+        _mm_storeu_ps(&dest[i], _mm_cvtph_ps(halfs));
+        i += 4;
+    }
+    ConvertFloat16ToFloat32Portable(&source[i], &dest[i], count - i);
+}
+
+#else
+
+void ConvertFloat32ToFloat16F16C(const float *source, uint16_t *dest, size_t count)
+{
+    ConvertFloat32ToFloat16Portable(source, dest, count);
+}
+
+void ConvertFloat16ToFloat32F16C(const uint16_t *source, float *dest, size_t count)
+{
+    ConvertFloat16ToFloat32Portable(source, dest, count);
+}
+
+#endif
+
+}
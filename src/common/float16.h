@@ -0,0 +1,36 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// float16.h: Conversion of arrays between 32-bit and 16-bit floats.
+
+#ifndef COMMON_FLOAT16_H_
+#define COMMON_FLOAT16_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace gl
+{
+
+// Convert |count| values with IEEE round-to-nearest-even. Values too large
+// for a half float become infinity, and NaNs stay NaNs, quieted. Both
+// directions use the F16C instructions when the CPU has them and give the
+// same bits either way.
+void ConvertFloat32ToFloat16(const float *source, uint16_t *dest, size_t count);
+void ConvertFloat16ToFloat32(const uint16_t *source, float *dest, size_t count);
+
+// The version for CPUs without F16C.
+void ConvertFloat32ToFloat16Portable(const float *source, uint16_t *dest, size_t count);
+void ConvertFloat16ToFloat32Portable(const uint16_t *source, float *dest, size_t count);
+
+// The F16C version. Only call when GetCPUFeatures().f16c is set; on other
+// architectures these are the portable version.
+void ConvertFloat32ToFloat16F16C(const float *source, uint16_t *dest, size_t count);
+void ConvertFloat16ToFloat32F16C(const uint16_t *source, float *dest, size_t count);
+
+}
+
+#endif // COMMON_FLOAT16_H_
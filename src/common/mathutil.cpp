@@ -42,14 +42,21 @@ unsigned int convertRGBFloatsTo999E5(float red, float green, float blue)
     const float blue_c = std::max<float>(0, std::min(g_sharedexp_max, blue));
 
     const float max_c = std::max<float>(std::max<float>(red_c, green_c), blue_c);
-    const float exp_p = std::max<float>(-g_sharedexp_bias - 1, floor(log(max_c))) + 1 + g_sharedexp_bias;
-    const int max_s = floor((max_c / (pow(2.0f, exp_p - g_sharedexp_bias - g_sharedexp_mantissabits))) + 0.5f);
-    const int exp_s = (max_s < pow(2.0f, g_sharedexp_mantissabits)) ? exp_p : exp_p + 1;
+
+    // max(-B - 1, floor(log2(max_c))) + 1 + B, from the exponent bits of max_c
+    const int maxExponent = bitCast<unsigned int>(max_c) >> 23;
+    const int exp_p = std::max(maxExponent, 127 - g_sharedexp_bias - 1) - (127 - g_sharedexp_bias - 1);
+
+    // Dividing by 2^(exp - B - N) is the same as multiplying by its exact inverse
+    const float scale_p = bitCast<float>(static_cast<unsigned int>(127 + g_sharedexp_bias + g_sharedexp_mantissabits - exp_p) << 23);
+    const unsigned int max_s = static_cast<unsigned int>(max_c * scale_p + 0.5f);
+    const int exp_s = (max_s < (1u << g_sharedexp_mantissabits)) ? exp_p : exp_p + 1;
+    const float scale_s = bitCast<float>(static_cast<unsigned int>(127 + g_sharedexp_bias + g_sharedexp_mantissabits - exp_s) << 23);
 
     RGB9E5Data output;
-    output.R = floor((red_c / (pow(2.0f, exp_s - g_sharedexp_bias - g_sharedexp_mantissabits))) + 0.5f);
-    output.G = floor((green_c / (pow(2.0f, exp_s - g_sharedexp_bias - g_sharedexp_mantissabits))) + 0.5f);
-    output.B = floor((blue_c / (pow(2.0f, exp_s - g_sharedexp_bias - g_sharedexp_mantissabits))) + 0.5f);
+    output.R = static_cast<unsigned int>(red_c * scale_s + 0.5f);
+    output.G = static_cast<unsigned int>(green_c * scale_s + 0.5f);
+    output.B = static_cast<unsigned int>(blue_c * scale_s + 0.5f);
     output.E = exp_s;
 
     return *reinterpret_cast<unsigned int*>(&output);
@@ -59,9 +66,12 @@ void convert999E5toRGBFloats(unsigned int input, float *red, float *green, float
 {
     const RGB9E5Data *inputData = reinterpret_cast<const RGB9E5Data*>(&input);
 
-    *red = inputData->R * pow(2.0f, (int)inputData->E - g_sharedexp_bias - g_sharedexp_mantissabits);
-    *green = inputData->G * pow(2.0f, (int)inputData->E - g_sharedexp_bias - g_sharedexp_mantissabits);
-    *blue = inputData->B * pow(2.0f, (int)inputData->E - g_sharedexp_bias - g_sharedexp_mantissabits);
+    // 2^(E - B - N), exact for every exponent
+    const float scale = bitCast<float>((inputData->E + 127 - g_sharedexp_bias - g_sharedexp_mantissabits) << 23);
+
+    *red = inputData->R * scale;
+    *green = inputData->G * scale;
+    *blue = inputData->B * scale;
 }
 
 }
@@ -9,6 +9,7 @@
 #ifndef LIBGLESV2_MATHUTIL_H_
 #define LIBGLESV2_MATHUTIL_H_
 
+#include "common/cpufeatures.h"
 #include "common/debug.h"
 #include "common/platform.h"
 
@@ -109,32 +110,7 @@ inline unsigned int unorm(float x)
 
 inline bool supportsSSE2()
 {
-#if ANGLE_PLATFORM_WINDOWS && !defined(_M_ARM)
-    static bool checked = false;
-    static bool supports = false;
-
-    if (checked)
-    {
-        return supports;
-    }
-
-    int info[4];
-    __cpuid(info, 0);
-
-    if (info[0] >= 1)
-    {
-        __cpuid(info, 1);
-
-        supports = (info[3] >> 26) & 1;
-    }
-
-    checked = true;
-
-    return supports;
-#else
-    UNIMPLEMENTED();
-    return false;
-#endif
+    return GetCPUFeatures().sse2;
 }
 
 template <typename destType, typename sourceType>
@@ -240,7 +216,7 @@ inline unsigned short float32ToFloat11(float fp32)
             // The number is too small to be represented as a normalized float11
             // Convert it to a denormalized value.
             const unsigned int shift = (float32ExponentBias - float11ExponentBias) - (float32Val >> float32ExponentFirstBit);
-            float32Val = ((1 << float32ExponentFirstBit) | (float32Val & float32MantissaMask)) >> shift;
+            float32Val = (shift < 32) ? ((1 << float32ExponentFirstBit) | (float32Val & float32MantissaMask)) >> shift : 0;
         }
         else
         {
@@ -309,7 +285,7 @@ inline unsigned short float32ToFloat10(float fp32)
             // The number is too small to be represented as a normalized float11
             // Convert it to a denormalized value.
             const unsigned int shift = (float32ExponentBias - float10ExponentBias) - (float32Val >> float32ExponentFirstBit);
-            float32Val = ((1 << float32ExponentFirstBit) | (float32Val & float32MantissaMask)) >> shift;
+            float32Val = (shift < 32) ? ((1 << float32ExponentFirstBit) | (float32Val & float32MantissaMask)) >> shift : 0;
         }
         else
         {
@@ -421,6 +397,12 @@ inline float normalizedToFloat(T input)
 template <typename T>
 inline T floatToNormalized(float input)
 {
+    // The maximum of a 32 bit type rounds up to a float out of its range, so
+    // those are scaled as doubles.
+    if (sizeof(T) >= sizeof(float))
+    {
+        return static_cast<T>(std::numeric_limits<T>::max() * static_cast<double>(input) + 0.5);
+    }
     return std::numeric_limits<T>::max() * input + 0.5f;
 }
 
@@ -0,0 +1,574 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// packedfloat.cpp: Conversion of arrays between RGB 32-bit floats and the
+// packed RGB9E5 and R11G11B10F formats.
+
+#include "common/packedfloat.h"
+#include "common/cpufeatures.h"
+#include "common/mathutil.h"
+
+#if defined(ANGLE_CPU_X86)
+#   include <immintrin.h>
+#endif
+
+#if defined(__GNUC__)
+#   define ANGLE_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#   define ANGLE_TARGET_AVX2
+#endif
+
+namespace gl
+{
+
+namespace
+{
+
+typedef void (*ConvertFloat32ToPackedFunction)(const float *, uint32_t *, size_t);
+typedef void (*ConvertPackedToFloat32Function)(const uint32_t *, float *, size_t);
+
+ConvertFloat32ToPackedFunction SelectConvertFloat32ToRGB9E5()
+{
+    const CPUFeatures &features = GetCPUFeatures();
+    return features.avx2 ? ConvertFloat32ToRGB9E5AVX2 :
+           features.sse2 ? ConvertFloat32ToRGB9E5SSE2 : ConvertFloat32ToRGB9E5Portable;
+}
+
+ConvertPackedToFloat32Function SelectConvertRGB9E5ToFloat32()
+{
+    const CPUFeatures &features = GetCPUFeatures();
+    return features.avx2 ? ConvertRGB9E5ToFloat32AVX2 :
+           features.sse2 ? ConvertRGB9E5ToFloat32SSE2 : ConvertRGB9E5ToFloat32Portable;
+}
+
+ConvertFloat32ToPackedFunction SelectConvertFloat32ToR11G11B10F()
+{
+    const CPUFeatures &features = GetCPUFeatures();
+    return features.avx2 ? ConvertFloat32ToR11G11B10FAVX2 :
+           features.sse2 ? ConvertFloat32ToR11G11B10FSSE2 : ConvertFloat32ToR11G11B10FPortable;
+}
+
+ConvertPackedToFloat32Function SelectConvertR11G11B10FToFloat32()
+{
+    const CPUFeatures &features = GetCPUFeatures();
+    return features.avx2 ? ConvertR11G11B10FToFloat32AVX2 :
+           features.sse2 ? ConvertR11G11B10FToFloat32SSE2 : ConvertR11G11B10FToFloat32Portable;
+}
+
+}
+
+void ConvertFloat32ToRGB9E5(const float *source, uint32_t *dest, size_t count)
+{
+    static const ConvertFloat32ToPackedFunction convert = SelectConvertFloat32ToRGB9E5();
+    convert(source, dest, count);
+}
+
+void ConvertRGB9E5ToFloat32(const uint32_t *source, float *dest, size_t count)
+{
+    static const ConvertPackedToFloat32Function convert = SelectConvertRGB9E5ToFloat32();
+    convert(source, dest, count);
+}
+
+void ConvertFloat32ToR11G11B10F(const float *source, uint32_t *dest, size_t count)
+{
+    static const ConvertFloat32ToPackedFunction convert = SelectConvertFloat32ToR11G11B10F();
+    convert(source, dest, count);
+}
+
+void ConvertR11G11B10FToFloat32(const uint32_t *source, float *dest, size_t count)
+{
+    static const ConvertPackedToFloat32Function convert = SelectConvertR11G11B10FToFloat32();
+    convert(source, dest, count);
+}
+
+void ConvertFloat32ToRGB9E5Portable(const float *source, uint32_t *dest, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        dest[i] = convertRGBFloatsTo999E5(source[i * 3 + 0], source[i * 3 + 1], source[i * 3 + 2]);
+    }
+}
+
+void ConvertRGB9E5ToFloat32Portable(const uint32_t *source, float *dest, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        convert999E5toRGBFloats(source[i], &dest[i * 3 + 0], &dest[i * 3 + 1], &dest[i * 3 + 2]);
+    }
+}
+
+void ConvertFloat32ToR11G11B10FPortable(const float *source, uint32_t *dest, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        dest[i] = (float32ToFloat11(source[i * 3 + 0]) <<  0) |
+                  (float32ToFloat11(source[i * 3 + 1]) << 11) |
+                  (float32ToFloat10(source[i * 3 + 2]) << 22);
+    }
+}
+
+void ConvertR11G11B10FToFloat32Portable(const uint32_t *source, float *dest, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        dest[i * 3 + 0] = float11ToFloat32(static_cast<unsigned short>((source[i] >>  0) & 0x7FF));
+        dest[i * 3 + 1] = float11ToFloat32(static_cast<unsigned short>((source[i] >> 11) & 0x7FF));
+        dest[i * 3 + 2] = float10ToFloat32(static_cast<unsigned short>((source[i] >> 22) & 0x3FF));
+    }
+}
+
+#if defined(ANGLE_CPU_X86)
+
+namespace
+{
+
+// The largest value RGB9E5 can store, (511 / 512) * 2^16
+const float RGB9E5Max = 65408.0f;
+
+// Exponents of floats below 2^-16 are raised to this, the float exponent of
+// the smallest shared exponent minus one.
+const int RGB9E5MinExponent = 127 - 15 - 1;
+
+// The float exponent that makes 2^(E - B - N), (127 - 15 - 9)
+const int RGB9E5ScaleBias = 103;
+
+// Floats below 2^-14 are denormals in both small formats. Scaling them by
+// 2^37 lines their bits up with the rebiased normals.
+const float SmallFloatDenormalScale = 137438953472.0f;
+
+inline __m128 Select(__m128i mask, __m128 ifTrue, __m128 ifFalse)
+{
+    __m128 floatMask = _mm_castsi128_ps(mask);
+    return _mm_or_ps(_mm_and_ps(floatMask, ifTrue), _mm_andnot_ps(floatMask, ifFalse));
+}
+
+inline __m128i Select(__m128i mask, __m128i ifTrue, __m128i ifFalse)
+{
+    return _mm_or_si128(_mm_and_si128(mask, ifTrue), _mm_andnot_si128(mask, ifFalse));
+}
+
+// Splits 4 RGB pixels into a register per channel.
+inline void LoadRGB(const float *source, __m128 *red, __m128 *green, __m128 *blue)
+{
+    __m128 a = _mm_loadu_ps(source + 0);
+    __m128 b = _mm_loadu_ps(source + 4);
+    __m128 c = _mm_loadu_ps(source + 8);
+
+    *red = _mm_shuffle_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 3, 0)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 1, 0));
+    *green = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+    *blue = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+// The reverse of LoadRGB.
+inline void StoreRGB(float *dest, __m128 red, __m128 green, __m128 blue)
+{
+    __m128 a = _mm_shuffle_ps(_mm_shuffle_ps(red, green, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(blue, red, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+    __m128 b = _mm_shuffle_ps(_mm_shuffle_ps(green, blue, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(red, green, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+    __m128 c = _mm_shuffle_ps(_mm_shuffle_ps(blue, red, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(green, blue, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+
+    _mm_storeu_ps(dest + 0, a);
+    _mm_storeu_ps(dest + 4, b);
+    _mm_storeu_ps(dest + 8, c);
+}
+
+// Same as gl::convertRGBFloatsTo999E5 for each lane.
+inline __m128i FloatsToRGB9E5(__m128 red, __m128 green, __m128 blue)
+{
+    // min and max return their second operand for NaNs, so NaNs clamp to the
+    // maximum like they do in the scalar version.
+    const __m128 max = _mm_set1_ps(RGB9E5Max);
+    const __m128 zero = _mm_setzero_ps();
+    red = _mm_max_ps(_mm_min_ps(red, max), zero);
+    green = _mm_max_ps(_mm_min_ps(green, max), zero);
+    blue = _mm_max_ps(_mm_min_ps(blue, max), zero);
+
+    // The channels are positive, so the exponents compare as integers
+    __m128i maxExponent = _mm_srli_epi32(_mm_castps_si128(_mm_max_ps(_mm_max_ps(red, green), blue)), 23);
+    __m128i minExponent = _mm_set1_epi32(RGB9E5MinExponent);
+    __m128i exponent = _mm_sub_epi32(Select(_mm_cmpgt_epi32(maxExponent, minExponent), maxExponent, minExponent), minExponent);
+
+    // Bump the exponent when the largest channel rounds up to 512
+    __m128 half = _mm_set1_ps(0.5f);
+    __m128i scaleBias = _mm_set1_epi32(127 + 15 + 9);
+    __m128 scale = _mm_castsi128_ps(_mm_slli_epi32(_mm_sub_epi32(scaleBias, exponent), 23));
+    __m128i maxScaled = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_max_ps(_mm_max_ps(red, green), blue), scale), half));
+    exponent = _mm_sub_epi32(exponent, _mm_cmpgt_epi32(maxScaled, _mm_set1_epi32(511)));
+    scale = _mm_castsi128_ps(_mm_slli_epi32(_mm_sub_epi32(scaleBias, exponent), 23));
+
+    __m128i r = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(red, scale), half));
+    __m128i g = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(green, scale), half));
+    __m128i b = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(blue, scale), half));
+    return _mm_or_si128(_mm_or_si128(r, _mm_slli_epi32(g, 9)), _mm_or_si128(_mm_slli_epi32(b, 18), _mm_slli_epi32(exponent, 27)));
+}
+
+// Same as gl::convert999E5toRGBFloats for each lane.
+inline void RGB9E5ToFloats(__m128i packed, __m128 *red, __m128 *green, __m128 *blue)
+{
+    const __m128i mask = _mm_set1_epi32(0x1FF);
+    __m128 scale = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_srli_epi32(packed, 27), _mm_set1_epi32(RGB9E5ScaleBias)), 23));
+    *red = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(packed, mask)), scale);
+    *green = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(packed, 9), mask)), scale);
+    *blue = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(packed, 18), mask)), scale);
+}
+
+// Same as gl::float32ToFloat11 when |mantissaBits| is 6, or gl::float32ToFloat10
+// when it is 5.
+template <int mantissaBits>
+inline __m128i FloatToSmallFloat(__m128 value)
+{
+    const int droppedBits = 23 - mantissaBits;
+    const int exponentMask = 0x1F << mantissaBits;
+    const int mantissaMask = (1 << mantissaBits) - 1;
+
+    __m128i bits = _mm_castps_si128(value);
+    __m128i sign = _mm_srai_epi32(bits, 31);
+    __m128i abs = _mm_and_si128(bits, _mm_set1_epi32(0x7FFFFFFF));
+
+    // Rebias normals and shift denormals into place, then round the dropped
+    // bits to nearest even
+    __m128i isDenormal = _mm_cmplt_epi32(abs, _mm_set1_epi32(0x38800000));
+    __m128i denormal = _mm_cvttps_epi32(_mm_mul_ps(_mm_castsi128_ps(abs), _mm_set1_ps(SmallFloatDenormalScale)));
+    __m128i rounded = Select(isDenormal, denormal, _mm_add_epi32(abs, _mm_set1_epi32(static_cast<int>(0xC8000000))));
+    __m128i odd = _mm_and_si128(_mm_srli_epi32(rounded, droppedBits), _mm_set1_epi32(1));
+    rounded = _mm_add_epi32(rounded, _mm_add_epi32(_mm_set1_epi32((1 << (droppedBits - 1)) - 1), odd));
+    rounded = _mm_and_si128(_mm_srli_epi32(rounded, droppedBits), _mm_set1_epi32(exponentMask | mantissaMask));
+
+    // Values past the largest float clamp to it, and infinity stays infinity
+    const int largestFloat = (0x8E << 23) | (mantissaMask << droppedBits);
+    __m128i isOverflow = _mm_cmpgt_epi32(abs, _mm_set1_epi32(largestFloat));
+    __m128i isInfinity = _mm_cmpeq_epi32(abs, _mm_set1_epi32(0x7F800000));
+    __m128i result = Select(isOverflow, _mm_set1_epi32(exponentMask - 1), rounded);
+    result = Select(isInfinity, _mm_set1_epi32(exponentMask), result);
+
+    // Negative numbers clamp to zero, but NaNs of either sign fold their
+    // mantissa down
+    result = _mm_andnot_si128(sign, result);
+    __m128i isNaN = _mm_cmpgt_epi32(abs, _mm_set1_epi32(0x7F800000));
+    __m128i nanMantissa;
+    if (mantissaBits == 6)
+    {
+        nanMantissa = _mm_or_si128(_mm_or_si128(_mm_srli_epi32(abs, 17), _mm_srli_epi32(abs, 11)), _mm_or_si128(_mm_srli_epi32(abs, 6), abs));
+    }
+    else
+    {
+        nanMantissa = _mm_or_si128(_mm_or_si128(_mm_srli_epi32(abs, 18), _mm_srli_epi32(abs, 13)), _mm_or_si128(_mm_srli_epi32(abs, 3), abs));
+    }
+    __m128i nan = _mm_or_si128(_mm_and_si128(nanMantissa, _mm_set1_epi32(mantissaMask)), _mm_set1_epi32(exponentMask));
+    return Select(isNaN, nan, result);
+}
+
+// Same as gl::float11ToFloat32 when |mantissaBits| is 6, or gl::float10ToFloat32
+// when it is 5.
+template <int mantissaBits>
+inline __m128 SmallFloatToFloat(__m128i value)
+{
+    __m128i exponent = _mm_and_si128(_mm_srli_epi32(value, mantissaBits), _mm_set1_epi32(0x1F));
+    __m128i mantissa = _mm_and_si128(value, _mm_set1_epi32((1 << mantissaBits) - 1));
+
+    __m128i normal = _mm_or_si128(_mm_slli_epi32(_mm_add_epi32(exponent, _mm_set1_epi32(112)), 23), _mm_slli_epi32(mantissa, 23 - mantissaBits));
+    // The scalar versions put the NaN mantissa of both formats at bit 17
+    __m128i special = _mm_or_si128(_mm_set1_epi32(0x7F800000), _mm_slli_epi32(mantissa, 17));
+    // Zero and denormals are the mantissa times 2^(-14 - mantissaBits)
+    __m128 denormal = _mm_mul_ps(_mm_cvtepi32_ps(mantissa), _mm_castsi128_ps(_mm_set1_epi32((127 - 14 - mantissaBits) << 23)));
+
+    __m128i bits = Select(_mm_cmpeq_epi32(exponent, _mm_set1_epi32(0x1F)), special, normal);
+    return Select(_mm_cmpeq_epi32(exponent, _mm_setzero_si128()), denormal, _mm_castsi128_ps(bits));
+}
+
+inline __m128i FloatsToR11G11B10F(__m128 red, __m128 green, __m128 blue)
+{
+    return _mm_or_si128(_mm_or_si128(FloatToSmallFloat<6>(red), _mm_slli_epi32(FloatToSmallFloat<6>(green), 11)),
+                        _mm_slli_epi32(FloatToSmallFloat<5>(blue), 22));
+}
+
+inline void R11G11B10FToFloats(__m128i packed, __m128 *red, __m128 *green, __m128 *blue)
+{
+    *red = SmallFloatToFloat<6>(packed);
+    *green = SmallFloatToFloat<6>(_mm_srli_epi32(packed, 11));
+    *blue = SmallFloatToFloat<5>(_mm_srli_epi32(packed, 22));
+}
+
+}
+
+void ConvertFloat32ToRGB9E5SSE2(const float *source, uint32_t *dest, size_t count)
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 red, green, blue;
+        LoadRGB(&source[i * 3], &red, &green, &blue);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&dest[i]), FloatsToRGB9E5(red, green, blue));
+    }
+    ConvertFloat32ToRGB9E5Portable(&source[i * 3], &dest[i], count - i);
+}
+
+void ConvertRGB9E5ToFloat32SSE2(const uint32_t *source, float *dest, size_t count)
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 red, green, blue;
+        RGB9E5ToFloats(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&source[i])), &red, &green, &blue);
+        StoreRGB(&dest[i * 3], red, green, blue);
+    }
+    ConvertRGB9E5ToFloat32Portable(&source[i], &dest[i * 3], count - i);
+}
+
+void ConvertFloat32ToR11G11B10FSSE2(const float *source, uint32_t *dest, size_t count)
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 red, green, blue;
+        LoadRGB(&source[i * 3], &red, &green, &blue);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&dest[i]), FloatsToR11G11B10F(red, green, blue));
+    }
+    ConvertFloat32ToR11G11B10FPortable(&source[i * 3], &dest[i], count - i);
+}
+
+void ConvertR11G11B10FToFloat32SSE2(const uint32_t *source, float *dest, size_t count)
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 red, green, blue;
+        R11G11B10FToFloats(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&source[i])), &red, &green, &blue);
+        StoreRGB(&dest[i * 3], red, green, blue);
+    }
+    ConvertR11G11B10FToFloat32Portable(&source[i], &dest[i * 3], count - i);
+}
+
+namespace
+{
+
+inline ANGLE_TARGET_AVX2 __m256 LoadHalves(const float *low, const float *high)
+{
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(low)), _mm_loadu_ps(high), 1);
+}
+
+// Splits 8 RGB pixels into a register per channel, with the same shuffles as
+// LoadRGB in each 128-bit half.
+inline ANGLE_TARGET_AVX2 void LoadRGB(const float *source, __m256 *red, __m256 *green, __m256 *blue)
+{
+    __m256 a = LoadHalves(source + 0, source + 12);
+    __m256 b = LoadHalves(source + 4, source + 16);
+    __m256 c = LoadHalves(source + 8, source + 20);
+
+    *red = _mm256_shuffle_ps(_mm256_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 3, 0)), _mm256_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 1, 0));
+    *green = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm256_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+    *blue = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm256_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+// The reverse of LoadRGB.
+inline ANGLE_TARGET_AVX2 void StoreRGB(float *dest, __m256 red, __m256 green, __m256 blue)
+{
+    __m256 a = _mm256_shuffle_ps(_mm256_shuffle_ps(red, green, _MM_SHUFFLE(0, 0, 0, 0)), _mm256_shuffle_ps(blue, red, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 b = _mm256_shuffle_ps(_mm256_shuffle_ps(green, blue, _MM_SHUFFLE(1, 1, 1, 1)), _mm256_shuffle_ps(red, green, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 c = _mm256_shuffle_ps(_mm256_shuffle_ps(blue, red, _MM_SHUFFLE(3, 3, 2, 2)), _mm256_shuffle_ps(green, blue, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+
+    _mm_storeu_ps(dest + 0, _mm256_castps256_ps128(a));
+    _mm_storeu_ps(dest + 4, _mm256_castps256_ps128(b));
+    _mm_storeu_ps(dest + 8, _mm256_castps256_ps128(c));
+    _mm_storeu_ps(dest + 12, _mm256_extractf128_ps(a, 1));
+    _mm_storeu_ps(dest + 16, _mm256_extractf128_ps(b, 1));
+    _mm_storeu_ps(dest + 20, _mm256_extractf128_ps(c, 1));
+}
+
+inline ANGLE_TARGET_AVX2 __m256i FloatsToRGB9E5(__m256 red, __m256 green, __m256 blue)
+{
+    const __m256 max = _mm256_set1_ps(RGB9E5Max);
+    const __m256 zero = _mm256_setzero_ps();
+    red = _mm256_max_ps(_mm256_min_ps(red, max), zero);
+    green = _mm256_max_ps(_mm256_min_ps(green, max), zero);
+    blue = _mm256_max_ps(_mm256_min_ps(blue, max), zero);
+
+    __m256 maxChannel = _mm256_max_ps(_mm256_max_ps(red, green), blue);
+    __m256i minExponent = _mm256_set1_epi32(RGB9E5MinExponent);
+    __m256i exponent = _mm256_sub_epi32(_mm256_max_epi32(_mm256_srli_epi32(_mm256_castps_si256(maxChannel), 23), minExponent), minExponent);
+
+    __m256 half = _mm256_set1_ps(0.5f);
+    __m256i scaleBias = _mm256_set1_epi32(127 + 15 + 9);
+    __m256 scale = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_sub_epi32(scaleBias, exponent), 23));
+    __m256i maxScaled = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(maxChannel, scale), half));
+    exponent = _mm256_sub_epi32(exponent, _mm256_cmpgt_epi32(maxScaled, _mm256_set1_epi32(511)));
+    scale = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_sub_epi32(scaleBias, exponent), 23));
+
+    __m256i r = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(red, scale), half));
+    __m256i g = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(green, scale), half));
+    __m256i b = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(blue, scale), half));
+    return _mm256_or_si256(_mm256_or_si256(r, _mm256_slli_epi32(g, 9)), _mm256_or_si256(_mm256_slli_epi32(b, 18), _mm256_slli_epi32(exponent, 27)));
+}
+
+inline ANGLE_TARGET_AVX2 void RGB9E5ToFloats(__m256i packed, __m256 *red, __m256 *green, __m256 *blue)
+{
+    const __m256i mask = _mm256_set1_epi32(0x1FF);
+    __m256 scale = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(_mm256_srli_epi32(packed, 27), _mm256_set1_epi32(RGB9E5ScaleBias)), 23));
+    *red = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_and_si256(packed, mask)), scale);
+    *green = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(packed, 9), mask)), scale);
+    *blue = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(packed, 18), mask)), scale);
+}
+
+template <int mantissaBits>
+inline ANGLE_TARGET_AVX2 __m256i FloatToSmallFloat(__m256 value)
+{
+    const int droppedBits = 23 - mantissaBits;
+    const int exponentMask = 0x1F << mantissaBits;
+    const int mantissaMask = (1 << mantissaBits) - 1;
+
+    __m256i bits = _mm256_castps_si256(value);
+    __m256i sign = _mm256_srai_epi32(bits, 31);
+    __m256i abs = _mm256_and_si256(bits, _mm256_set1_epi32(0x7FFFFFFF));
+
+    __m256i isDenormal = _mm256_cmpgt_epi32(_mm256_set1_epi32(0x38800000), abs);
+    __m256i denormal = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_castsi256_ps(abs), _mm256_set1_ps(SmallFloatDenormalScale)));
+    __m256i rounded = _mm256_blendv_epi8(_mm256_add_epi32(abs, _mm256_set1_epi32(static_cast<int>(0xC8000000))), denormal, isDenormal);
+    __m256i odd = _mm256_and_si256(_mm256_srli_epi32(rounded, droppedBits), _mm256_set1_epi32(1));
+    rounded = _mm256_add_epi32(rounded, _mm256_add_epi32(_mm256_set1_epi32((1 << (droppedBits - 1)) - 1), odd));
+    rounded = _mm256_and_si256(_mm256_srli_epi32(rounded, droppedBits), _mm256_set1_epi32(exponentMask | mantissaMask));
+
+    const int largestFloat = (0x8E << 23) | (mantissaMask << droppedBits);
+    __m256i isOverflow = _mm256_cmpgt_epi32(abs, _mm256_set1_epi32(largestFloat));
+    __m256i isInfinity = _mm256_cmpeq_epi32(abs, _mm256_set1_epi32(0x7F800000));
+    __m256i result = _mm256_blendv_epi8(rounded, _mm256_set1_epi32(exponentMask - 1), isOverflow);
+    result = _mm256_blendv_epi8(result, _mm256_set1_epi32(exponentMask), isInfinity);
+
+    result = _mm256_andnot_si256(sign, result);
+    __m256i isNaN = _mm256_cmpgt_epi32(abs, _mm256_set1_epi32(0x7F800000));
+    __m256i nanMantissa;
+    if (mantissaBits == 6)
+    {
+        nanMantissa = _mm256_or_si256(_mm256_or_si256(_mm256_srli_epi32(abs, 17), _mm256_srli_epi32(abs, 11)), _mm256_or_si256(_mm256_srli_epi32(abs, 6), abs));
+    }
+    else
+    {
+        nanMantissa = _mm256_or_si256(_mm256_or_si256(_mm256_srli_epi32(abs, 18), _mm256_srli_epi32(abs, 13)), _mm256_or_si256(_mm256_srli_epi32(abs, 3), abs));
+    }
+    __m256i nan = _mm256_or_si256(_mm256_and_si256(nanMantissa, _mm256_set1_epi32(mantissaMask)), _mm256_set1_epi32(exponentMask));
+    return _mm256_blendv_epi8(result, nan, isNaN);
+}
+
+template <int mantissaBits>
+inline ANGLE_TARGET_AVX2 __m256 SmallFloatToFloat(__m256i value)
+{
+    __m256i exponent = _mm256_and_si256(_mm256_srli_epi32(value, mantissaBits), _mm256_set1_epi32(0x1F));
+    __m256i mantissa = _mm256_and_si256(value, _mm256_set1_epi32((1 << mantissaBits) - 1));
+
+    __m256i normal = _mm256_or_si256(_mm256_slli_epi32(_mm256_add_epi32(exponent, _mm256_set1_epi32(112)), 23), _mm256_slli_epi32(mantissa, 23 - mantissaBits));
+    __m256i special = _mm256_or_si256(_mm256_set1_epi32(0x7F800000), _mm256_slli_epi32(mantissa, 17));
+    __m256 denormal = _mm256_mul_ps(_mm256_cvtepi32_ps(mantissa), _mm256_castsi256_ps(_mm256_set1_epi32((127 - 14 - mantissaBits) << 23)));
+
+    __m256i bits = _mm256_blendv_epi8(normal, special, _mm256_cmpeq_epi32(exponent, _mm256_set1_epi32(0x1F)));
+    return _mm256_blendv_ps(_mm256_castsi256_ps(bits), denormal, _mm256_castsi256_ps(_mm256_cmpeq_epi32(exponent, _mm256_setzero_si256())));
+}
+
+inline ANGLE_TARGET_AVX2 __m256i FloatsToR11G11B10F(__m256 red, __m256 green, __m256 blue)
+{
+    return _mm256_or_si256(_mm256_or_si256(FloatToSmallFloat<6>(red), _mm256_slli_epi32(FloatToSmallFloat<6>(green), 11)),
+                           _mm256_slli_epi32(FloatToSmallFloat<5>(blue), 22));
+}
+
+inline ANGLE_TARGET_AVX2 void R11G11B10FToFloats(__m256i packed, __m256 *red, __m256 *green, __m256 *blue)
+{
+    *red = SmallFloatToFloat<6>(packed);
+    *green = SmallFloatToFloat<6>(_mm256_srli_epi32(packed, 11));
+    *blue = SmallFloatToFloat<5>(_mm256_srli_epi32(packed, 22));
+}
+
+}
+
+ANGLE_TARGET_AVX2 void ConvertFloat32ToRGB9E5AVX2(const float *source, uint32_t *dest, size_t count)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 red, green, blue;
+        LoadRGB(&source[i * 3], &red, &green, &blue);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&dest[i]), FloatsToRGB9E5(red, green, blue));
+    }
+    ConvertFloat32ToRGB9E5SSE2(&source[i * 3], &dest[i], count - i);
+}
+
+ANGLE_TARGET_AVX2 void ConvertRGB9E5ToFloat32AVX2(const uint32_t *source, float *dest, size_t count)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 red, green, blue;
+        RGB9E5ToFloats(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&source[i])), &red, &green, &blue);
+        StoreRGB(&dest[i * 3], red, green, blue);
+    }
+    ConvertRGB9E5ToFloat32SSE2(&source[i], &dest[i * 3], count - i);
+}
+
+ANGLE_TARGET_AVX2 void ConvertFloat32ToR11G11B10FAVX2(const float *source, uint32_t *dest, size_t count)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 red, green, blue;
+        LoadRGB(&source[i * 3], &red, &green, &blue);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&dest[i]), FloatsToR11G11B10F(red, green, blue));
+    }
+    ConvertFloat32ToR11G11B10FSSE2(&source[i * 3], &dest[i], count - i);
+}
+
+ANGLE_TARGET_AVX2 void ConvertR11G11B10FToFloat32AVX2(const uint32_t *source, float *dest, size_t count)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 red, green, blue;
+        R11G11B10FToFloats(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&source[i])), &red, &green, &blue);
+        StoreRGB(&dest[i * 3], red, green, blue);
+    }
+    ConvertR11G11B10FToFloat32SSE2(&source[i], &dest[i * 3], count - i);
+}
+
+#else
+
+void ConvertFloat32ToRGB9E5SSE2(const float *source, uint32_t *dest, size_t count)
+{
+    ConvertFloat32ToRGB9E5Portable(source, dest, count);
+}
+
+void ConvertRGB9E5ToFloat32SSE2(const uint32_t *source, float *dest, size_t count)
+{
+    ConvertRGB9E5ToFloat32Portable(source, dest, count);
+}
+
+void ConvertFloat32ToR11G11B10FSSE2(const float *source, uint32_t *dest, size_t count)
+{
+    ConvertFloat32ToR11G11B10FPortable(source, dest, count);
+}
+
+void ConvertR11G11B10FToFloat32SSE2(const uint32_t *source, float *dest, size_t count)
+{
+    ConvertR11G11B10FToFloat32Portable(source, dest, count);
+}
+
+void ConvertFloat32ToRGB9E5AVX2(const float *source, uint32_t *dest, size_t count)
+{
+    ConvertFloat32ToRGB9E5Portable(source, dest, count);
+}
+
+void ConvertRGB9E5ToFloat32AVX2(const uint32_t *source, float *dest, size_t count)
+{
+    ConvertRGB9E5ToFloat32Portable(source, dest, count);
+}
+
+void ConvertFloat32ToR11G11B10FAVX2(const float *source, uint32_t *dest, size_t count)
+{
+    ConvertFloat32ToR11G11B10FPortable(source, dest, count);
+}
+
+void ConvertR11G11B10FToFloat32AVX2(const uint32_t *source, float *dest, size_t count)
+{
+    ConvertR11G11B10FToFloat32Portable(source, dest, count);
+}
+
+#endif
+
+}
@@ -0,0 +1,50 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// packedfloat.h: Conversion of arrays between RGB 32-bit floats and the packed
+// RGB9E5 and R11G11B10F formats.
+
+#ifndef COMMON_PACKEDFLOAT_H_
+#define COMMON_PACKEDFLOAT_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace gl
+{
+
+// Convert |count| pixels of three floats each. The results are the same bits
+// as gl::convertRGBFloatsTo999E5, gl::convert999E5toRGBFloats,
+// gl::float32ToFloat11/10 and gl::float11/10ToFloat32 give for each pixel. The
+// SSE2 or AVX2 versions are used when the CPU has them.
+void ConvertFloat32ToRGB9E5(const float *source, uint32_t *dest, size_t count);
+void ConvertRGB9E5ToFloat32(const uint32_t *source, float *dest, size_t count);
+void ConvertFloat32ToR11G11B10F(const float *source, uint32_t *dest, size_t count);
+void ConvertR11G11B10FToFloat32(const uint32_t *source, float *dest, size_t count);
+
+// The versions that call the scalar functions for each pixel.
+void ConvertFloat32ToRGB9E5Portable(const float *source, uint32_t *dest, size_t count);
+void ConvertRGB9E5ToFloat32Portable(const uint32_t *source, float *dest, size_t count);
+void ConvertFloat32ToR11G11B10FPortable(const float *source, uint32_t *dest, size_t count);
+void ConvertR11G11B10FToFloat32Portable(const uint32_t *source, float *dest, size_t count);
+
+// 4 pixels at a time. Only call when GetCPUFeatures().sse2 is set; on other
+// architectures these are the portable version.
+void ConvertFloat32ToRGB9E5SSE2(const float *source, uint32_t *dest, size_t count);
+void ConvertRGB9E5ToFloat32SSE2(const uint32_t *source, float *dest, size_t count);
+void ConvertFloat32ToR11G11B10FSSE2(const float *source, uint32_t *dest, size_t count);
+void ConvertR11G11B10FToFloat32SSE2(const uint32_t *source, float *dest, size_t count);
+
+// 8 pixels at a time. Only call when GetCPUFeatures().avx2 is set; on other
+// architectures these are the portable version.
+void ConvertFloat32ToRGB9E5AVX2(const float *source, uint32_t *dest, size_t count);
+void ConvertRGB9E5ToFloat32AVX2(const uint32_t *source, float *dest, size_t count);
+void ConvertFloat32ToR11G11B10FAVX2(const float *source, uint32_t *dest, size_t count);
+void ConvertR11G11B10FToFloat32AVX2(const uint32_t *source, float *dest, size_t count);
+
+}
+
+#endif // COMMON_PACKEDFLOAT_H_
@@ -74,6 +74,35 @@
 
 #   undef near
 #   undef far
+#else
+// The renderer and EGL interfaces shared with the null back-end still use a few
+// Win32 types. Only those are declared here, with their Win32 layouts.
+#   include <stdint.h>
+
+typedef void *HANDLE;
+typedef uint32_t DWORD;
+
+typedef struct
+{
+    uint32_t Data1;
+    uint16_t Data2;
+    uint16_t Data3;
+    uint8_t Data4[8];
+} GUID;
+
+typedef struct
+{
+    uint32_t LowPart;
+    int32_t HighPart;
+} LUID;
+
+typedef struct
+{
+    int32_t left;
+    int32_t top;
+    int32_t right;
+    int32_t bottom;
+} RECT, *LPRECT;
 #endif
 
 #endif // COMMON_PLATFORM_H_
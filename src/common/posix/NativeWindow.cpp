@@ -0,0 +1,40 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// NativeWindow.cpp: Handler for native window types on platforms without
+// window system integration. No native window is valid, so only pbuffer
+// surfaces can be created.
+
+#include "common/NativeWindow.h"
+#include "common/debug.h"
+
+namespace rx
+{
+bool IsValidEGLNativeWindowType(EGLNativeWindowType window)
+{
+    return false;
+}
+
+NativeWindow::NativeWindow(EGLNativeWindowType window) : mWindow(window)
+{
+}
+
+bool NativeWindow::initialize()
+{
+    return false;
+}
+
+bool NativeWindow::getClientRect(LPRECT rect)
+{
+    UNREACHABLE();
+    return false;
+}
+
+bool NativeWindow::isIconic()
+{
+    return false;
+}
+}
@@ -0,0 +1,62 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// simddispatch.cpp: Runtime selection between the versions of a kernel
+// written for different SIMD instruction sets.
+
+#include "common/simddispatch.h"
+
+namespace gl
+{
+
+namespace
+{
+
+SIMDLevel DetectSIMDLevel()
+{
+    const CPUFeatures &features = GetCPUFeatures();
+
+    if (features.avx2 && features.sse41 && features.ssse3 && features.sse2)
+    {
+        return SIMD_AVX2;
+    }
+    else if (features.sse41 && features.ssse3 && features.sse2)
+    {
+        return SIMD_SSE41;
+    }
+    else if (features.ssse3 && features.sse2)
+    {
+        return SIMD_SSSE3;
+    }
+    else if (features.sse2)
+    {
+        return SIMD_SSE2;
+    }
+    return SIMD_SCALAR;
+}
+
+}
+
+const char *GetSIMDLevelName(SIMDLevel level)
+{
+    switch (level)
+    {
+      case SIMD_SCALAR: return "Scalar";
+      case SIMD_SSE2:   return "SSE2";
+      case SIMD_SSSE3:  return "SSSE3";
+      case SIMD_SSE41:  return "SSE41";
+      case SIMD_AVX2:   return "AVX2";
+      default: UNREACHABLE(); return "";
+    }
+}
+
+SIMDLevel GetSIMDLevel()
+{
+    static const SIMDLevel level = DetectSIMDLevel();
+    return level;
+}
+
+}
@@ -0,0 +1,125 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// simddispatch.h: Runtime selection between the versions of a kernel written
+// for different SIMD instruction sets.
+
+#ifndef COMMON_SIMDDISPATCH_H_
+#define COMMON_SIMDDISPATCH_H_
+
+#include "common/cpufeatures.h"
+#include "common/debug.h"
+
+#include <stddef.h>
+
+// GCC and Clang only allow the intrinsics of the instruction sets enabled for
+// the function that uses them.
+#if defined(__GNUC__)
+#   define ANGLE_TARGET_SSE2 __attribute__((target("sse2")))
+#   define ANGLE_TARGET_SSSE3 __attribute__((target("ssse3")))
+#   define ANGLE_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#   define ANGLE_TARGET_SSE2
+#   define ANGLE_TARGET_SSSE3
+#   define ANGLE_TARGET_AVX2
+#endif
+
+namespace gl
+{
+
+// Ordered: each level implies the ones below it.
+enum SIMDLevel
+{
+    SIMD_SCALAR,
+    SIMD_SSE2,
+    SIMD_SSSE3,
+    SIMD_SSE41,
+    SIMD_AVX2,
+
+    SIMD_LEVEL_COUNT
+};
+
+const char *GetSIMDLevelName(SIMDLevel level);
+
+// The highest level the CPU and the OS support.
+SIMDLevel GetSIMDLevel();
+
+namespace priv
+{
+
+template <typename Version>
+inline bool HasSIMDVersion(const Version &)
+{
+    return true;
+}
+
+template <typename Function>
+inline bool HasSIMDVersion(Function *function)
+{
+    return function != NULL;
+}
+
+}
+
+// A family of kernels is described by a function returning, for each level,
+// the table of the versions written for exactly that level, indexed by
+// kernel, or NULL if the level has none. A table of function pointers may
+// also hold NULL for the kernels it leaves out. The scalar table has every
+// kernel.
+
+// Returns the version of |kernel| written for exactly |level|, or NULL if
+// there is none.
+template <typename Version>
+const Version *GetSIMDVersion(const Version *(*getTable)(SIMDLevel), size_t kernel, SIMDLevel level)
+{
+    const Version *table = getTable(level);
+    return (table && priv::HasSIMDVersion(table[kernel])) ? &table[kernel] : NULL;
+}
+
+// Returns the best version of |kernel| that needs at most |maxLevel|.
+template <typename Version>
+const Version &ResolveSIMDVersion(const Version *(*getTable)(SIMDLevel), size_t kernel, SIMDLevel maxLevel)
+{
+    for (int level = maxLevel; level > SIMD_SCALAR; level--)
+    {
+        const Version *version = GetSIMDVersion(getTable, kernel, static_cast<SIMDLevel>(level));
+        if (version)
+        {
+            return *version;
+        }
+    }
+
+    const Version *scalarVersion = GetSIMDVersion(getTable, kernel, SIMD_SCALAR);
+    ASSERT(scalarVersion);
+    return *scalarVersion;
+}
+
+// The best version of every kernel of a family for the level of this CPU.
+template <typename Version, size_t KernelCount>
+class BestSIMDVersions
+{
+  public:
+    explicit BestSIMDVersions(const Version *(*getTable)(SIMDLevel))
+    {
+        for (size_t kernel = 0; kernel < KernelCount; kernel++)
+        {
+            mVersions[kernel] = ResolveSIMDVersion(getTable, kernel, GetSIMDLevel());
+        }
+    }
+
+    const Version &operator[](size_t kernel) const
+    {
+        ASSERT(kernel < KernelCount);
+        return mVersions[kernel];
+    }
+
+  private:
+    Version mVersions[KernelCount];
+};
+
+}
+
+#endif // COMMON_SIMDDISPATCH_H_
@@ -12,6 +12,10 @@
 
 #include <set>
 
+#if defined(ANGLE_PLATFORM_POSIX)
+#   include <unistd.h>
+#endif
+
 #if defined(ANGLE_ENABLE_WINDOWS_STORE)
 #  include <wrl.h>
 #  include <wrl/wrappers/corewrappers.h>
@@ -510,8 +514,10 @@ void PlatformSleep(unsigned long dwMilliseconds)
 
     // Emulate sleep by waiting with timeout on an event that is never signalled.
     WaitForSingleObjectEx(sleepEvent, dwMilliseconds, false);
-#else
+#elif defined(ANGLE_PLATFORM_WINDOWS)
     Sleep(dwMilliseconds);
+#else
+    usleep(dwMilliseconds * 1000);
 #endif
 }
 
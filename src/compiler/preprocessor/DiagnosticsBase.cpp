@@ -109,6 +109,14 @@ std::string Diagnostics::message(ID id)
         return "invalid file number";
       case PP_INVALID_LINE_DIRECTIVE:
         return "invalid line directive";
+      case PP_SOURCE_TOO_LONG:
+        return "shader source too long";
+      case PP_LINE_TOO_LONG:
+        return "too many tokens on line";
+      case PP_MACRO_EXPANSION_TOO_LARGE:
+        return "macro expansion too large";
+      case PP_MACRO_NESTING_TOO_DEEP:
+        return "macro expansion nested too deeply";
       // Errors end.
       // Warnings begin.
       case PP_EOF_IN_DIRECTIVE:
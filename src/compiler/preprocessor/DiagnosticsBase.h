@@ -61,6 +61,10 @@ class Diagnostics
         PP_INVALID_LINE_NUMBER,
         PP_INVALID_FILE_NUMBER,
         PP_INVALID_LINE_DIRECTIVE,
+        PP_SOURCE_TOO_LONG,
+        PP_LINE_TOO_LONG,
+        PP_MACRO_EXPANSION_TOO_LARGE,
+        PP_MACRO_NESTING_TOO_DEEP,
         PP_ERROR_END,
 
         PP_WARNING_BEGIN,
@@ -145,10 +145,12 @@ class DefinedParser : public Lexer
   public:
     DefinedParser(Lexer *lexer,
                   const MacroSet *macroSet,
-                  Diagnostics *diagnostics)
+                  Diagnostics *diagnostics,
+                  MacroReferences *macroReferences)
         : mLexer(lexer),
           mMacroSet(macroSet),
-          mDiagnostics(diagnostics)
+          mDiagnostics(diagnostics),
+          mMacroReferences(macroReferences)
     {
     }
 
@@ -178,6 +180,7 @@ class DefinedParser : public Lexer
             skipUntilEOD(mLexer, token);
             return;
         }
+        mMacroReferences->add(token->text);
         MacroSet::const_iterator iter = mMacroSet->find(token->text);
         std::string expression = iter != mMacroSet->end() ? "1" : "0";
 
@@ -203,17 +206,22 @@ class DefinedParser : public Lexer
     Lexer *mLexer;
     const MacroSet *mMacroSet;
     Diagnostics *mDiagnostics;
+    MacroReferences *mMacroReferences;
 };
 
 DirectiveParser::DirectiveParser(Tokenizer *tokenizer,
                                  MacroSet *macroSet,
                                  Diagnostics *diagnostics,
-                                 DirectiveHandler *directiveHandler)
+                                 DirectiveHandler *directiveHandler,
+                                 MacroExpansionBudget *expansionBudget,
+                                 MacroReferences *macroReferences)
     : mPastFirstStatement(false),
       mTokenizer(tokenizer),
       mMacroSet(macroSet),
       mDiagnostics(diagnostics),
-      mDirectiveHandler(directiveHandler)
+      mDirectiveHandler(directiveHandler),
+      mExpansionBudget(expansionBudget),
+      mMacroReferences(macroReferences)
 {
 }
 
@@ -231,7 +239,7 @@ void DirectiveParser::lex(Token *token)
 
         if (token->type == Token::LAST)
         {
-            if (!mConditionalStack.empty())
+            if (!mConditionalStack.empty() && !limitExceeded())
             {
                 const ConditionalBlock &block = mConditionalStack.back();
                 mDiagnostics->report(Diagnostics::PP_CONDITIONAL_UNTERMINATED,
@@ -318,6 +326,14 @@ void DirectiveParser::parseDirective(Token *token)
         break;
     }
 
+    if (limitExceeded())
+    {
+        // Preprocessing stops here. The rest of the shader is not parsed.
+        token->reset();
+        token->type = Token::LAST;
+        return;
+    }
+
     skipUntilEOD(mTokenizer, token);
     if (token->type == Token::LAST)
     {
@@ -795,7 +811,8 @@ void DirectiveParser::parseLine(Token *token)
     int line = 0, file = 0;
     int state = LINE_NUMBER;
 
-    MacroExpander macroExpander(mTokenizer, mMacroSet, mDiagnostics);
+    MacroExpander macroExpander(mTokenizer, mMacroSet, mDiagnostics,
+                                mExpansionBudget, mMacroReferences);
     macroExpander.lex(token);
     while ((token->type != '\n') && (token->type != Token::LAST))
     {
@@ -855,6 +872,11 @@ void DirectiveParser::parseLine(Token *token)
     }
 }
 
+bool DirectiveParser::limitExceeded() const
+{
+    return mExpansionBudget->exhausted || mTokenizer->limitExceeded();
+}
+
 bool DirectiveParser::skipping() const
 {
     if (mConditionalStack.empty())
@@ -910,8 +932,9 @@ int DirectiveParser::parseExpressionIf(Token *token)
     assert((getDirective(token) == DIRECTIVE_IF) ||
            (getDirective(token) == DIRECTIVE_ELIF));
 
-    DefinedParser definedParser(mTokenizer, mMacroSet, mDiagnostics);
-    MacroExpander macroExpander(&definedParser, mMacroSet, mDiagnostics);
+    DefinedParser definedParser(mTokenizer, mMacroSet, mDiagnostics, mMacroReferences);
+    MacroExpander macroExpander(&definedParser, mMacroSet, mDiagnostics,
+                                mExpansionBudget, mMacroReferences);
     ExpressionParser expressionParser(&macroExpander, mDiagnostics);
 
     int expression = 0;
@@ -943,6 +966,7 @@ int DirectiveParser::parseExpressionIfdef(Token *token)
         return 0;
     }
 
+    mMacroReferences->add(token->text);
     MacroSet::const_iterator iter = mMacroSet->find(token->text);
     int expression = iter != mMacroSet->end() ? 1 : 0;
 
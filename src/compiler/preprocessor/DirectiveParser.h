@@ -18,6 +18,7 @@ namespace pp
 class Diagnostics;
 class DirectiveHandler;
 class Tokenizer;
+struct MacroExpansionBudget;
 
 class DirectiveParser : public Lexer
 {
@@ -25,7 +26,9 @@ class DirectiveParser : public Lexer
     DirectiveParser(Tokenizer *tokenizer,
                     MacroSet *macroSet,
                     Diagnostics *diagnostics,
-                    DirectiveHandler *directiveHandler);
+                    DirectiveHandler *directiveHandler,
+                    MacroExpansionBudget *expansionBudget,
+                    MacroReferences *macroReferences);
 
     virtual void lex(Token *token);
 
@@ -47,6 +50,7 @@ class DirectiveParser : public Lexer
     void parseVersion(Token *token);
     void parseLine(Token *token);
 
+    bool limitExceeded() const;
     bool skipping() const;
     void parseConditionalIf(Token *token);
     int parseExpressionIf(Token *token);
@@ -75,6 +79,8 @@ class DirectiveParser : public Lexer
     MacroSet *mMacroSet;
     Diagnostics *mDiagnostics;
     DirectiveHandler *mDirectiveHandler;
+    MacroExpansionBudget *mExpansionBudget;
+    MacroReferences *mMacroReferences;
 };
 
 }  // namespace pp
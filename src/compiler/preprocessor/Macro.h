@@ -8,6 +8,7 @@
 #define COMPILER_PREPROCESSOR_MACRO_H_
 
 #include <map>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -45,5 +46,23 @@ struct Macro
 
 typedef std::map<std::string, Macro> MacroSet;
 
+// Records the names of the macros that were expanded or tested with
+// defined, #ifdef or #ifndef. Recording is off by default.
+struct MacroReferences
+{
+    MacroReferences()
+        : enabled(false)
+    {
+    }
+    void add(const std::string &name)
+    {
+        if (enabled)
+            names.insert(name);
+    }
+
+    bool enabled;
+    std::set<std::string> names;
+};
+
 }  // namespace pp
 #endif  // COMPILER_PREPROCESSOR_MACRO_H_
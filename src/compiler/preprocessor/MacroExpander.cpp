@@ -48,15 +48,22 @@ class TokenLexer : public Lexer
 
 MacroExpander::MacroExpander(Lexer *lexer,
                              MacroSet *macroSet,
-                             Diagnostics *diagnostics)
+                             Diagnostics *diagnostics,
+                             MacroExpansionBudget *budget,
+                             MacroReferences *references)
     : mLexer(lexer),
       mMacroSet(macroSet),
-      mDiagnostics(diagnostics)
+      mDiagnostics(diagnostics),
+      mBudget(budget),
+      mReferences(references)
 {
 }
 
 MacroExpander::~MacroExpander()
 {
+    assert(mBudget->depth >= mContextStack.size());
+    mBudget->depth -= mContextStack.size();
+
     for (std::size_t i = 0; i < mContextStack.size(); ++i)
     {
         delete mContextStack[i];
@@ -67,6 +74,15 @@ void MacroExpander::lex(Token *token)
 {
     while (true)
     {
+        if (mBudget->exhausted)
+        {
+            // Stop at the first exceeded limit instead of spending more time
+            // on the rest of the shader.
+            token->reset();
+            token->type = Token::LAST;
+            break;
+        }
+
         getToken(token);
 
         if (token->type != Token::IDENTIFIER)
@@ -93,6 +109,7 @@ void MacroExpander::lex(Token *token)
             break;
         }
 
+        mReferences->add(macro.name);
         pushMacro(macro, *token);
     }
 }
@@ -155,9 +172,23 @@ bool MacroExpander::pushMacro(const Macro &macro, const Token &identifier)
     assert(identifier.type == Token::IDENTIFIER);
     assert(identifier.text == macro.name);
 
+    if (mBudget->depth >= mBudget->maxDepth)
+    {
+        mDiagnostics->report(Diagnostics::PP_MACRO_NESTING_TOO_DEEP,
+                             identifier.location, identifier.text);
+        mBudget->exhausted = true;
+        return false;
+    }
+
+    // The expansion is in progress while its arguments are expanded.
+    ++mBudget->depth;
     std::vector<Token> replacements;
-    if (!expandMacro(macro, identifier, &replacements))
+    if (!expandMacro(macro, identifier, &replacements) ||
+        !consumeBudget(identifier, replacements.size()))
+    {
+        --mBudget->depth;
         return false;
+    }
 
     // Macro is disabled for expansion until it is popped off the stack.
     macro.disabled = true;
@@ -175,6 +206,7 @@ void MacroExpander::popMacro()
 
     MacroContext *context = mContextStack.back();
     mContextStack.pop_back();
+    --mBudget->depth;
 
     assert(context->empty());
     assert(context->macro->disabled);
@@ -294,6 +326,16 @@ bool MacroExpander::collectMacroArgs(const Macro &macro,
         }
     }
 
+    // The arguments of nested invocations are collected again at every
+    // level, so they count against the budget as well.
+    std::size_t argTokens = 0;
+    for (std::size_t i = 0; i < args->size(); ++i)
+    {
+        argTokens += args->at(i).size();
+    }
+    if (!consumeBudget(identifier, argTokens))
+        return false;
+
     const Macro::Parameters &params = macro.parameters;
     // If there is only one empty argument, it is equivalent to no argument.
     if (params.empty() && (args->size() == 1) && args->front().empty())
@@ -317,7 +359,7 @@ bool MacroExpander::collectMacroArgs(const Macro &macro,
     {
         MacroArg &arg = args->at(i);
         TokenLexer lexer(&arg);
-        MacroExpander expander(&lexer, mMacroSet, mDiagnostics);
+        MacroExpander expander(&lexer, mMacroSet, mDiagnostics, mBudget, mReferences);
 
         arg.clear();
         expander.lex(&token);
@@ -326,6 +368,8 @@ bool MacroExpander::collectMacroArgs(const Macro &macro,
             arg.push_back(token);
             expander.lex(&token);
         }
+        if (mBudget->exhausted)
+            return false;
     }
     return true;
 }
@@ -334,7 +378,10 @@ void MacroExpander::replaceMacroParams(const Macro &macro,
                                        const std::vector<MacroArg> &args,
                                        std::vector<Token> *replacements)
 {
-    for (std::size_t i = 0; i < macro.replacements.size(); ++i)
+    // Stop early if the replacement list is going to exceed the budget.
+    // A single expansion can repeat a large argument many times.
+    std::size_t maxSize = mBudget->maxTokens - std::min(mBudget->tokens, mBudget->maxTokens);
+    for (std::size_t i = 0; i < macro.replacements.size() && replacements->size() <= maxSize; ++i)
     {
         const Token &repl = macro.replacements[i];
         if (repl.type != Token::IDENTIFIER)
@@ -368,5 +415,18 @@ void MacroExpander::replaceMacroParams(const Macro &macro,
     }
 }
 
+bool MacroExpander::consumeBudget(const Token &identifier, std::size_t tokens)
+{
+    mBudget->tokens += tokens;
+    if (mBudget->tokens > mBudget->maxTokens)
+    {
+        mDiagnostics->report(Diagnostics::PP_MACRO_EXPANSION_TOO_LARGE,
+                             identifier.location, identifier.text);
+        mBudget->exhausted = true;
+        return false;
+    }
+    return true;
+}
+
 }  // namespace pp
 
@@ -20,10 +20,39 @@ namespace pp
 
 class Diagnostics;
 
+// Limits the work spent expanding macros so that shaders with nested
+// function-like macros cannot expand exponentially. A single budget is shared
+// by all the expanders created while preprocessing a shader. Once it is
+// exhausted the expanders stop producing tokens.
+struct MacroExpansionBudget
+{
+    MacroExpansionBudget()
+        : maxTokens(1 << 20),
+          maxDepth(256),
+          tokens(0),
+          depth(0),
+          exhausted(false)
+    {
+    }
+
+    // Maximum number of tokens produced by macro replacement.
+    std::size_t maxTokens;
+    // Maximum number of macro expansions in progress at the same time.
+    std::size_t maxDepth;
+
+    std::size_t tokens;
+    std::size_t depth;
+    bool exhausted;
+};
+
 class MacroExpander : public Lexer
 {
   public:
-    MacroExpander(Lexer *lexer, MacroSet *macroSet, Diagnostics *diagnostics);
+    MacroExpander(Lexer *lexer,
+                  MacroSet *macroSet,
+                  Diagnostics *diagnostics,
+                  MacroExpansionBudget *budget,
+                  MacroReferences *references);
     virtual ~MacroExpander();
 
     virtual void lex(Token *token);
@@ -49,6 +78,7 @@ class MacroExpander : public Lexer
     void replaceMacroParams(const Macro &macro,
                             const std::vector<MacroArg> &args,
                             std::vector<Token> *replacements);
+    bool consumeBudget(const Token &identifier, std::size_t tokens);
 
     struct MacroContext
     {
@@ -79,6 +109,8 @@ class MacroExpander : public Lexer
     Lexer *mLexer;
     MacroSet *mMacroSet;
     Diagnostics *mDiagnostics;
+    MacroExpansionBudget *mBudget;
+    MacroReferences *mReferences;
 
     std::auto_ptr<Token> mReserveToken;
     std::vector<MacroContext *> mContextStack;
@@ -23,6 +23,8 @@ struct PreprocessorImpl
 {
     Diagnostics *diagnostics;
     MacroSet macroSet;
+    MacroExpansionBudget expansionBudget;
+    MacroReferences macroReferences;
     Tokenizer tokenizer;
     DirectiveParser directiveParser;
     MacroExpander macroExpander;
@@ -31,8 +33,9 @@ struct PreprocessorImpl
                      DirectiveHandler *directiveHandler)
         : diagnostics(diag),
           tokenizer(diag),
-          directiveParser(&tokenizer, &macroSet, diag, directiveHandler),
-          macroExpander(&directiveParser, &macroSet, diag)
+          directiveParser(&tokenizer, &macroSet, diag, directiveHandler,
+                          &expansionBudget, &macroReferences),
+          macroExpander(&directiveParser, &macroSet, diag, &expansionBudget, &macroReferences)
     {
     }
 };
@@ -115,4 +118,34 @@ void Preprocessor::setMaxTokenSize(size_t maxTokenSize)
     mImpl->tokenizer.setMaxTokenSize(maxTokenSize);
 }
 
+void Preprocessor::setMaxSourceSize(size_t maxSourceSize)
+{
+    mImpl->tokenizer.setMaxSourceSize(maxSourceSize);
+}
+
+void Preprocessor::setMaxTokensPerLine(size_t maxTokensPerLine)
+{
+    mImpl->tokenizer.setMaxTokensPerLine(maxTokensPerLine);
+}
+
+void Preprocessor::setMaxMacroExpandedTokens(size_t maxExpandedTokens)
+{
+    mImpl->expansionBudget.maxTokens = maxExpandedTokens;
+}
+
+void Preprocessor::setMaxMacroNestingDepth(size_t maxNestingDepth)
+{
+    mImpl->expansionBudget.maxDepth = maxNestingDepth;
+}
+
+void Preprocessor::setRecordMacroReferences(bool record)
+{
+    mImpl->macroReferences.enabled = record;
+}
+
+const std::set<std::string> &Preprocessor::referencedMacros() const
+{
+    return mImpl->macroReferences.names;
+}
+
 }  // namespace pp
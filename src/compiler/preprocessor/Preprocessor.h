@@ -8,6 +8,8 @@
 #define COMPILER_PREPROCESSOR_PREPROCESSOR_H_
 
 #include <stddef.h>
+#include <set>
+#include <string>
 
 #include "pp_utils.h"
 
@@ -43,6 +45,22 @@ class Preprocessor
     // Set maximum preprocessor token size
     void setMaxTokenSize(size_t maxTokenSize);
 
+    // Limits on the work done for a single shader. Exceeding one of them
+    // reports an error and ends preprocessing.
+    // Set maximum total length of the source strings. Must be set before init.
+    void setMaxSourceSize(size_t maxSourceSize);
+    // Set maximum number of tokens on a single source line.
+    void setMaxTokensPerLine(size_t maxTokensPerLine);
+    // Set maximum number of tokens produced by macro expansion.
+    void setMaxMacroExpandedTokens(size_t maxExpandedTokens);
+    // Set maximum depth of nested macro expansions.
+    void setMaxMacroNestingDepth(size_t maxNestingDepth);
+
+    // Record the names of the macros expanded or tested with defined, #ifdef
+    // or #ifndef. Predefined macros are included.
+    void setRecordMacroReferences(bool record);
+    const std::set<std::string> &referencedMacros() const;
+
   private:
     PP_DISALLOW_COPY_AND_ASSIGN(Preprocessor);
 
@@ -2318,7 +2318,11 @@ namespace pp {
 
 Tokenizer::Tokenizer(Diagnostics *diagnostics)
     : mHandle(0),
-      mMaxTokenSize(256)
+      mMaxTokenSize(256),
+      mMaxSourceSize(1 << 24),
+      mMaxTokensPerLine(1 << 18),
+      mLineTokenCount(0),
+      mLimitExceeded(false)
 {
     mContext.diagnostics = diagnostics;
 }
@@ -2334,6 +2338,19 @@ bool Tokenizer::init(size_t count, const char * const string[], const int length
         return false;
 
     mContext.input = Input(count, string, length);
+
+    size_t sourceSize = 0;
+    for (size_t i = 0; i < mContext.input.count(); ++i)
+        sourceSize += mContext.input.length(i);
+    if (sourceSize > mMaxSourceSize)
+    {
+        mContext.diagnostics->report(Diagnostics::PP_SOURCE_TOO_LONG,
+                                     SourceLocation(), "");
+        return false;
+    }
+
+    mLineTokenCount = 0;
+    mLimitExceeded = false;
     return initScanner();
 }
 
@@ -2354,8 +2371,25 @@ void Tokenizer::setMaxTokenSize(size_t maxTokenSize)
     mMaxTokenSize = maxTokenSize;
 }
 
+void Tokenizer::setMaxSourceSize(size_t maxSourceSize)
+{
+    mMaxSourceSize = maxSourceSize;
+}
+
+void Tokenizer::setMaxTokensPerLine(size_t maxTokensPerLine)
+{
+    mMaxTokensPerLine = maxTokensPerLine;
+}
+
 void Tokenizer::lex(Token *token)
 {
+    if (mLimitExceeded)
+    {
+        token->reset();
+        token->type = Token::LAST;
+        return;
+    }
+
     token->type = pplex(&token->text,&token->location,mHandle);
     if (token->text.size() > mMaxTokenSize)
     {
@@ -2371,6 +2405,19 @@ void Tokenizer::lex(Token *token)
 
     token->setHasLeadingSpace(mContext.leadingSpace);
     mContext.leadingSpace = false;
+
+    if (token->type == '\n')
+    {
+        mLineTokenCount = 0;
+    }
+    else if ((token->type != Token::LAST) && (++mLineTokenCount > mMaxTokensPerLine))
+    {
+        mContext.diagnostics->report(Diagnostics::PP_LINE_TOO_LONG,
+                                     token->location, token->text);
+        mLimitExceeded = true;
+        token->reset();
+        token->type = Token::LAST;
+    }
 }
 
 bool Tokenizer::initScanner()
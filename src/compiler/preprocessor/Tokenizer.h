@@ -41,6 +41,9 @@ class Tokenizer : public Lexer
     void setFileNumber(int file);
     void setLineNumber(int line);
     void setMaxTokenSize(size_t maxTokenSize);
+    void setMaxSourceSize(size_t maxSourceSize);
+    void setMaxTokensPerLine(size_t maxTokensPerLine);
+    bool limitExceeded() const { return mLimitExceeded; }
 
     virtual void lex(Token *token);
 
@@ -52,6 +55,10 @@ class Tokenizer : public Lexer
     void *mHandle;  // Scanner handle.
     Context mContext;  // Scanner extra.
     size_t mMaxTokenSize; // Maximum token size
+    size_t mMaxSourceSize; // Maximum total length of the input strings
+    size_t mMaxTokensPerLine; // Maximum number of tokens on a line
+    size_t mLineTokenCount; // Number of tokens lexed on the current line
+    bool mLimitExceeded; // Stop lexing once a limit is exceeded
 };
 
 }  // namespace pp
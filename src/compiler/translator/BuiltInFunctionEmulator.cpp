@@ -10,189 +10,6 @@
 
 namespace {
 
-// we use macros here instead of function definitions to work around more GLSL
-// compiler bugs, in particular on NVIDIA hardware on Mac OSX. Macros are
-// problematic because if the argument has side-effects they will be repeatedly
-// evaluated. This is unlikely to show up in real shaders, but is something to
-// consider.
-const char* kFunctionEmulationVertexSource[] = {
-    "#error no emulation for cos(float)",
-    "#error no emulation for cos(vec2)",
-    "#error no emulation for cos(vec3)",
-    "#error no emulation for cos(vec4)",
-
-    "#define webgl_distance_emu(x, y) ((x) >= (y) ? (x) - (y) : (y) - (x))",
-    "#error no emulation for distance(vec2, vec2)",
-    "#error no emulation for distance(vec3, vec3)",
-    "#error no emulation for distance(vec4, vec4)",
-
-    "#define webgl_dot_emu(x, y) ((x) * (y))",
-    "#error no emulation for dot(vec2, vec2)",
-    "#error no emulation for dot(vec3, vec3)",
-    "#error no emulation for dot(vec4, vec4)",
-
-    "#define webgl_length_emu(x) ((x) >= 0.0 ? (x) : -(x))",
-    "#error no emulation for length(vec2)",
-    "#error no emulation for length(vec3)",
-    "#error no emulation for length(vec4)",
-
-    "#define webgl_normalize_emu(x) ((x) == 0.0 ? 0.0 : ((x) > 0.0 ? 1.0 : -1.0))",
-    "#error no emulation for normalize(vec2)",
-    "#error no emulation for normalize(vec3)",
-    "#error no emulation for normalize(vec4)",
-
-    "#define webgl_reflect_emu(I, N) ((I) - 2.0 * (N) * (I) * (N))",
-    "#error no emulation for reflect(vec2, vec2)",
-    "#error no emulation for reflect(vec3, vec3)",
-    "#error no emulation for reflect(vec4, vec4)"
-};
-
-const char* kFunctionEmulationFragmentSource[] = {
-    "webgl_emu_precision float webgl_cos_emu(webgl_emu_precision float a) { return cos(a); }",
-    "webgl_emu_precision vec2 webgl_cos_emu(webgl_emu_precision vec2 a) { return cos(a); }",
-    "webgl_emu_precision vec3 webgl_cos_emu(webgl_emu_precision vec3 a) { return cos(a); }",
-    "webgl_emu_precision vec4 webgl_cos_emu(webgl_emu_precision vec4 a) { return cos(a); }",
-
-    "#define webgl_distance_emu(x, y) ((x) >= (y) ? (x) - (y) : (y) - (x))",
-    "#error no emulation for distance(vec2, vec2)",
-    "#error no emulation for distance(vec3, vec3)",
-    "#error no emulation for distance(vec4, vec4)",
-
-    "#define webgl_dot_emu(x, y) ((x) * (y))",
-    "#error no emulation for dot(vec2, vec2)",
-    "#error no emulation for dot(vec3, vec3)",
-    "#error no emulation for dot(vec4, vec4)",
-
-    "#define webgl_length_emu(x) ((x) >= 0.0 ? (x) : -(x))",
-    "#error no emulation for length(vec2)",
-    "#error no emulation for length(vec3)",
-    "#error no emulation for length(vec4)",
-
-    "#define webgl_normalize_emu(x) ((x) == 0.0 ? 0.0 : ((x) > 0.0 ? 1.0 : -1.0))",
-    "#error no emulation for normalize(vec2)",
-    "#error no emulation for normalize(vec3)",
-    "#error no emulation for normalize(vec4)",
-
-    "#define webgl_reflect_emu(I, N) ((I) - 2.0 * (N) * (I) * (N))",
-    "#error no emulation for reflect(vec2, vec2)",
-    "#error no emulation for reflect(vec3, vec3)",
-    "#error no emulation for reflect(vec4, vec4)"
-};
-
-const bool kFunctionEmulationVertexMask[] = {
-#if defined(__APPLE__)
-    // Work around ATI driver bugs in Mac.
-    false, // TFunctionCos1
-    false, // TFunctionCos2
-    false, // TFunctionCos3
-    false, // TFunctionCos4
-    true,  // TFunctionDistance1_1
-    false, // TFunctionDistance2_2
-    false, // TFunctionDistance3_3
-    false, // TFunctionDistance4_4
-    true,  // TFunctionDot1_1
-    false, // TFunctionDot2_2
-    false, // TFunctionDot3_3
-    false, // TFunctionDot4_4
-    true,  // TFunctionLength1
-    false, // TFunctionLength2
-    false, // TFunctionLength3
-    false, // TFunctionLength4
-    true,  // TFunctionNormalize1
-    false, // TFunctionNormalize2
-    false, // TFunctionNormalize3
-    false, // TFunctionNormalize4
-    true,  // TFunctionReflect1_1
-    false, // TFunctionReflect2_2
-    false, // TFunctionReflect3_3
-    false, // TFunctionReflect4_4
-#else
-    // Work around D3D driver bug in Win.
-    false, // TFunctionCos1
-    false, // TFunctionCos2
-    false, // TFunctionCos3
-    false, // TFunctionCos4
-    false, // TFunctionDistance1_1
-    false, // TFunctionDistance2_2
-    false, // TFunctionDistance3_3
-    false, // TFunctionDistance4_4
-    false, // TFunctionDot1_1
-    false, // TFunctionDot2_2
-    false, // TFunctionDot3_3
-    false, // TFunctionDot4_4
-    false, // TFunctionLength1
-    false, // TFunctionLength2
-    false, // TFunctionLength3
-    false, // TFunctionLength4
-    false, // TFunctionNormalize1
-    false, // TFunctionNormalize2
-    false, // TFunctionNormalize3
-    false, // TFunctionNormalize4
-    false, // TFunctionReflect1_1
-    false, // TFunctionReflect2_2
-    false, // TFunctionReflect3_3
-    false, // TFunctionReflect4_4
-#endif
-    false  // TFunctionUnknown
-};
-
-const bool kFunctionEmulationFragmentMask[] = {
-#if defined(__APPLE__)
-    // Work around ATI driver bugs in Mac.
-    true,  // TFunctionCos1
-    true,  // TFunctionCos2
-    true,  // TFunctionCos3
-    true,  // TFunctionCos4
-    true,  // TFunctionDistance1_1
-    false, // TFunctionDistance2_2
-    false, // TFunctionDistance3_3
-    false, // TFunctionDistance4_4
-    true,  // TFunctionDot1_1
-    false, // TFunctionDot2_2
-    false, // TFunctionDot3_3
-    false, // TFunctionDot4_4
-    true,  // TFunctionLength1
-    false, // TFunctionLength2
-    false, // TFunctionLength3
-    false, // TFunctionLength4
-    true,  // TFunctionNormalize1
-    false, // TFunctionNormalize2
-    false, // TFunctionNormalize3
-    false, // TFunctionNormalize4
-    true,  // TFunctionReflect1_1
-    false, // TFunctionReflect2_2
-    false, // TFunctionReflect3_3
-    false, // TFunctionReflect4_4
-#else
-    // Work around D3D driver bug in Win.
-    false, // TFunctionCos1
-    false, // TFunctionCos2
-    false, // TFunctionCos3
-    false, // TFunctionCos4
-    false, // TFunctionDistance1_1
-    false, // TFunctionDistance2_2
-    false, // TFunctionDistance3_3
-    false, // TFunctionDistance4_4
-    false, // TFunctionDot1_1
-    false, // TFunctionDot2_2
-    false, // TFunctionDot3_3
-    false, // TFunctionDot4_4
-    false, // TFunctionLength1
-    false, // TFunctionLength2
-    false, // TFunctionLength3
-    false, // TFunctionLength4
-    false, // TFunctionNormalize1
-    false, // TFunctionNormalize2
-    false, // TFunctionNormalize3
-    false, // TFunctionNormalize4
-    false, // TFunctionReflect1_1
-    false, // TFunctionReflect2_2
-    false, // TFunctionReflect3_3
-    false, // TFunctionReflect4_4
-#endif
-    false  // TFunctionUnknown
-};
-
 class BuiltInFunctionEmulationMarker : public TIntermTraverser {
 public:
     BuiltInFunctionEmulationMarker(BuiltInFunctionEmulator& emulator)
@@ -214,45 +31,11 @@ public:
     virtual bool visitAggregate(Visit visit, TIntermAggregate* node)
     {
         if (visit == PreVisit) {
-            // Here we handle all the built-in functions instead of the ones we
-            // currently identified as problematic.
-            switch (node->getOp()) {
-                case EOpLessThan:
-                case EOpGreaterThan:
-                case EOpLessThanEqual:
-                case EOpGreaterThanEqual:
-                case EOpVectorEqual:
-                case EOpVectorNotEqual:
-                case EOpMod:
-                case EOpPow:
-                case EOpAtan:
-                case EOpMin:
-                case EOpMax:
-                case EOpClamp:
-                case EOpMix:
-                case EOpStep:
-                case EOpSmoothStep:
-                case EOpDistance:
-                case EOpDot:
-                case EOpCross:
-                case EOpFaceForward:
-                case EOpReflect:
-                case EOpRefract:
-                case EOpMul:
-                    break;
-                default:
-                    return true;
-            };
-            const TIntermSequence& sequence = *(node->getSequence());
-            // Right now we only handle built-in functions with two parameters.
-            if (sequence.size() != 2)
-                return true;
-            TIntermTyped* param1 = sequence[0]->getAsTyped();
-            TIntermTyped* param2 = sequence[1]->getAsTyped();
-            if (!param1 || !param2)
+            // User-defined functions and constructors are never emulated.
+            if (node->getOp() == EOpFunctionCall || node->isConstructor())
                 return true;
             bool needToEmulate = mEmulator.SetFunctionCalled(
-                node->getOp(), param1->getType(), param2->getType());
+                node->getOp(), *node->getSequence());
             if (needToEmulate)
                 node->setUseEmulatedFunction();
         }
@@ -265,47 +48,97 @@ private:
 
 }  // anonymous namepsace
 
-BuiltInFunctionEmulator::BuiltInFunctionEmulator(sh::GLenum shaderType)
+bool BuiltInFunctionEmulator::FunctionId::operator<(const FunctionId& other) const
 {
-    if (shaderType == GL_FRAGMENT_SHADER) {
-        mFunctionMask = kFunctionEmulationFragmentMask;
-        mFunctionSource = kFunctionEmulationFragmentSource;
-    } else {
-        mFunctionMask = kFunctionEmulationVertexMask;
-        mFunctionSource = kFunctionEmulationVertexSource;
-    }
+    if (op != other.op)
+        return op < other.op;
+    return parameters < other.parameters;
+}
+
+BuiltInFunctionEmulator::BuiltInFunctionEmulator()
+{
+}
+
+void BuiltInFunctionEmulator::addEmulatedFunction(
+    TOperator op, const TType& param, const char* emulatedFunctionDefinition)
+{
+    std::string parameters;
+    AppendMangledName(param, &parameters);
+    addEmulatedFunction(FunctionId(op, parameters), emulatedFunctionDefinition);
+}
+
+void BuiltInFunctionEmulator::addEmulatedFunction(
+    TOperator op, const TType& param1, const TType& param2,
+    const char* emulatedFunctionDefinition)
+{
+    std::string parameters;
+    AppendMangledName(param1, &parameters);
+    AppendMangledName(param2, &parameters);
+    addEmulatedFunction(FunctionId(op, parameters), emulatedFunctionDefinition);
+}
+
+void BuiltInFunctionEmulator::addEmulatedFunction(
+    TOperator op, const TType& param1, const TType& param2, const TType& param3,
+    const char* emulatedFunctionDefinition)
+{
+    std::string parameters;
+    AppendMangledName(param1, &parameters);
+    AppendMangledName(param2, &parameters);
+    AppendMangledName(param3, &parameters);
+    addEmulatedFunction(FunctionId(op, parameters), emulatedFunctionDefinition);
+}
+
+void BuiltInFunctionEmulator::addEmulatedFunction(
+    const FunctionId& function, const char* emulatedFunctionDefinition)
+{
+    // Entries are only registered between compiles, when nothing is called.
+    ASSERT(mCalledFunctions.empty());
+    mEmulatedFunctions[function].definition = emulatedFunctionDefinition;
+    mEmulatedOps.insert(function.op);
 }
 
 bool BuiltInFunctionEmulator::SetFunctionCalled(
     TOperator op, const TType& param)
 {
-    TBuiltInFunction function = IdentifyFunction(op, param);
-    return SetFunctionCalled(function);
+    if (mEmulatedOps.count(op) == 0)
+        return false;
+    std::string parameters;
+    AppendMangledName(param, &parameters);
+    return SetFunctionCalled(FunctionId(op, parameters));
 }
 
 bool BuiltInFunctionEmulator::SetFunctionCalled(
-    TOperator op, const TType& param1, const TType& param2)
+    TOperator op, const TIntermSequence& arguments)
 {
-    TBuiltInFunction function = IdentifyFunction(op, param1, param2);
-    return SetFunctionCalled(function);
+    if (mEmulatedOps.count(op) == 0)
+        return false;
+    std::string parameters;
+    for (size_t i = 0; i < arguments.size(); ++i) {
+        TIntermTyped* argument = arguments[i]->getAsTyped();
+        if (!argument)
+            return false;
+        AppendMangledName(argument->getType(), &parameters);
+    }
+    return SetFunctionCalled(FunctionId(op, parameters));
 }
 
-bool BuiltInFunctionEmulator::SetFunctionCalled(
-    BuiltInFunctionEmulator::TBuiltInFunction function) {
-    if (function == TFunctionUnknown || mFunctionMask[function] == false)
+bool BuiltInFunctionEmulator::SetFunctionCalled(const FunctionId& function)
+{
+    EmulatedFunctionMap::iterator iter = mEmulatedFunctions.find(function);
+    if (iter == mEmulatedFunctions.end())
         return false;
-    for (size_t i = 0; i < mFunctions.size(); ++i) {
-        if (mFunctions[i] == function)
-            return true;
+    EmulatedFunction& emulated = iter->second;
+    if (!emulated.called) {
+        emulated.called = true;
+        mCalledFunctions.push_back(&emulated);
     }
-    mFunctions.push_back(function);
     return true;
 }
 
 void BuiltInFunctionEmulator::OutputEmulatedFunctionDefinition(
     TInfoSinkBase& out, bool withPrecision) const
 {
-    if (mFunctions.size() == 0)
+    if (mCalledFunctions.size() == 0)
         return;
     out << "// BEGIN: Generated code for built-in function emulation\n\n";
     if (withPrecision) {
@@ -317,83 +150,29 @@ void BuiltInFunctionEmulator::OutputEmulatedFunctionDefinition(
     } else {
         out << "#define webgl_emu_precision\n\n";
     }
-    for (size_t i = 0; i < mFunctions.size(); ++i) {
-        out << mFunctionSource[mFunctions[i]] << "\n\n";
+    for (size_t i = 0; i < mCalledFunctions.size(); ++i) {
+        out << mCalledFunctions[i]->definition << "\n\n";
     }
     out << "// END: Generated code for built-in function emulation\n\n";
 }
 
-BuiltInFunctionEmulator::TBuiltInFunction
-BuiltInFunctionEmulator::IdentifyFunction(
-    TOperator op, const TType& param)
-{
-    if (param.getNominalSize() > 4 || param.getSecondarySize() > 4)
-        return TFunctionUnknown;
-    unsigned int function = TFunctionUnknown;
-    switch (op) {
-        case EOpCos:
-            function = TFunctionCos1;
-            break;
-        case EOpLength:
-            function = TFunctionLength1;
-            break;
-        case EOpNormalize:
-            function = TFunctionNormalize1;
-            break;
-        default:
-            break;
-    }
-    if (function == TFunctionUnknown)
-        return TFunctionUnknown;
-    if (param.isVector())
-        function += param.getNominalSize() - 1;
-    return static_cast<TBuiltInFunction>(function);
-}
-
-BuiltInFunctionEmulator::TBuiltInFunction
-BuiltInFunctionEmulator::IdentifyFunction(
-    TOperator op, const TType& param1, const TType& param2)
-{
-    // Right now for all the emulated functions with two parameters, the two
-    // parameters have the same type.
-    if (param1.getNominalSize()     != param2.getNominalSize()   ||
-        param1.getSecondarySize()   != param2.getSecondarySize() ||
-        param1.getNominalSize() > 4 || param1.getSecondarySize() > 4)
-        return TFunctionUnknown;
-
-    unsigned int function = TFunctionUnknown;
-    switch (op) {
-        case EOpDistance:
-            function = TFunctionDistance1_1;
-            break;
-        case EOpDot:
-            function = TFunctionDot1_1;
-            break;
-        case EOpReflect:
-            function = TFunctionReflect1_1;
-            break;
-        default:
-            break;
-    }
-    if (function == TFunctionUnknown)
-        return TFunctionUnknown;
-    if (param1.isVector())
-        function += param1.getNominalSize() - 1;
-    return static_cast<TBuiltInFunction>(function);
-}
-
 void BuiltInFunctionEmulator::MarkBuiltInFunctionsForEmulation(
     TIntermNode* root)
 {
     ASSERT(root);
 
+    if (mEmulatedFunctions.empty())
+        return;
+
     BuiltInFunctionEmulationMarker marker(*this);
     root->traverse(&marker);
 }
 
 void BuiltInFunctionEmulator::Cleanup()
 {
-    mFunctions.clear();
+    for (size_t i = 0; i < mCalledFunctions.size(); ++i)
+        mCalledFunctions[i]->called = false;
+    mCalledFunctions.clear();
 }
 
 //static
@@ -404,3 +183,11 @@ TString BuiltInFunctionEmulator::GetEmulatedFunctionName(
     return "webgl_" + name.substr(0, name.length() - 1) + "_emu(";
 }
 
+//static
+void BuiltInFunctionEmulator::AppendMangledName(
+    const TType& type, std::string* name)
+{
+    // getMangledName() caches the name in the type.
+    TType copy(type);
+    *name += copy.getMangledName().c_str();
+}
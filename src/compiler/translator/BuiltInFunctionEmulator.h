@@ -7,30 +7,50 @@
 #ifndef COMPILIER_BUILT_IN_FUNCTION_EMULATOR_H_
 #define COMPILIER_BUILT_IN_FUNCTION_EMULATOR_H_
 
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
 #include "compiler/translator/InfoSink.h"
 #include "compiler/translator/IntermNode.h"
 
 //
 // This class decides which built-in functions need to be replaced with the
 // emulated ones.
+// Backends register an emulation per overload of a built-in, and only the
+// overloads a shader actually calls are written out.
 // It's only a workaround for OpenGL driver bugs, and isn't needed in general.
 //
 class BuiltInFunctionEmulator {
 public:
-    BuiltInFunctionEmulator(sh::GLenum shaderType);
+    BuiltInFunctionEmulator();
+
+    // Registers the emulation of built-in |op| called with the given
+    // parameter types. Precision is not part of the key, so one definition
+    // covers all precision variants: "webgl_emu_precision" in the
+    // definition expands to the highest available precision, or to nothing
+    // where precision qualifiers are not allowed.
+    // |emulatedFunctionDefinition| must outlive the emulator.
+    void addEmulatedFunction(TOperator op, const TType& param,
+                             const char* emulatedFunctionDefinition);
+    void addEmulatedFunction(TOperator op, const TType& param1, const TType& param2,
+                             const char* emulatedFunctionDefinition);
+    void addEmulatedFunction(TOperator op, const TType& param1, const TType& param2,
+                             const TType& param3, const char* emulatedFunctionDefinition);
+
     // Records that a function is called by the shader and might needs to be
-    // emulated.  If the function's group is not in mFunctionGroupFilter, this
-    // becomes an no-op.
+    // emulated. If no emulation is registered for it, this becomes a no-op.
     // Returns true if the function call needs to be replaced with an emulated
     // one.
     bool SetFunctionCalled(TOperator op, const TType& param);
-    bool SetFunctionCalled(
-        TOperator op, const TType& param1, const TType& param2);
+    bool SetFunctionCalled(TOperator op, const TIntermSequence& arguments);
 
     // Output function emulation definition.  This should be before any other
     // shader source.
     void OutputEmulatedFunctionDefinition(TInfoSinkBase& out, bool withPrecision) const;
 
+    // Does nothing if no emulation is registered.
     void MarkBuiltInFunctionsForEmulation(TIntermNode* root);
 
     void Cleanup();
@@ -39,53 +59,36 @@ public:
     static TString GetEmulatedFunctionName(const TString& name);
 
 private:
-    //
-    // Built-in functions.
-    //
-    enum TBuiltInFunction {
-        TFunctionCos1 = 0,  // float cos(float);
-        TFunctionCos2,  // vec2 cos(vec2);
-        TFunctionCos3,  // vec3 cos(vec3);
-        TFunctionCos4,  // vec4 cos(vec4);
-
-        TFunctionDistance1_1,  // float distance(float, float);
-        TFunctionDistance2_2,  // vec2 distance(vec2, vec2);
-        TFunctionDistance3_3,  // vec3 distance(vec3, vec3);
-        TFunctionDistance4_4,  // vec4 distance(vec4, vec4);
-
-        TFunctionDot1_1,  // float dot(float, float);
-        TFunctionDot2_2,  // vec2 dot(vec2, vec2);
-        TFunctionDot3_3,  // vec3 dot(vec3, vec3);
-        TFunctionDot4_4,  // vec4 dot(vec4, vec4);
-
-        TFunctionLength1,  // float length(float);
-        TFunctionLength2,  // float length(vec2);
-        TFunctionLength3,  // float length(vec3);
-        TFunctionLength4,  // float length(vec4);
-
-        TFunctionNormalize1,  // float normalize(float);
-        TFunctionNormalize2,  // vec2 normalize(vec2);
-        TFunctionNormalize3,  // vec3 normalize(vec3);
-        TFunctionNormalize4,  // vec4 normalize(vec4);
-
-        TFunctionReflect1_1,  // float reflect(float, float);
-        TFunctionReflect2_2,  // vec2 reflect(vec2, vec2);
-        TFunctionReflect3_3,  // vec3 reflect(vec3, vec3);
-        TFunctionReflect4_4,  // vec4 reflect(vec4, vec4);
-
-        TFunctionUnknown
+    // A built-in overload: the operator and the mangled names of its
+    // parameters, e.g. EOpDot and "f1;f1;".
+    struct FunctionId {
+        FunctionId(TOperator op, const std::string& parameters)
+            : op(op), parameters(parameters) {}
+        bool operator<(const FunctionId& other) const;
+
+        TOperator op;
+        std::string parameters;
     };
 
-    TBuiltInFunction IdentifyFunction(TOperator op, const TType& param);
-    TBuiltInFunction IdentifyFunction(
-        TOperator op, const TType& param1, const TType& param2);
+    struct EmulatedFunction {
+        EmulatedFunction() : definition(NULL), called(false) {}
+
+        const char* definition;
+        bool called;
+    };
 
-    bool SetFunctionCalled(TBuiltInFunction function);
+    typedef std::map<FunctionId, EmulatedFunction> EmulatedFunctionMap;
 
-    std::vector<TBuiltInFunction> mFunctions;
+    static void AppendMangledName(const TType& type, std::string* name);
+    void addEmulatedFunction(const FunctionId& function, const char* emulatedFunctionDefinition);
+    bool SetFunctionCalled(const FunctionId& function);
 
-    const bool* mFunctionMask;  // a boolean flag for each function.
-    const char** mFunctionSource;
+    EmulatedFunctionMap mEmulatedFunctions;
+    // Operators with at least one emulated overload, to skip building the
+    // key of calls that can't match.
+    std::set<TOperator> mEmulatedOps;
+    // Called functions, in the order of their first call.
+    std::vector<EmulatedFunction*> mCalledFunctions;
 };
 
 #endif  // COMPILIER_BUILT_IN_FUNCTION_EMULATOR_H_
@@ -0,0 +1,21 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#ifndef COMPILIER_BUILT_IN_FUNCTION_EMULATOR_GLSL_H_
+#define COMPILIER_BUILT_IN_FUNCTION_EMULATOR_GLSL_H_
+
+#include "GLSLANG/ShaderLang.h"
+
+class BuiltInFunctionEmulator;
+
+//
+// Registers the emulations that work around GLSL driver bugs with built-in
+// functions, as seen with ATI drivers on Mac.
+//
+void InitBuiltInFunctionEmulatorForGLSLWorkarounds(BuiltInFunctionEmulator* emu,
+                                                   sh::GLenum shaderType);
+
+#endif  // COMPILIER_BUILT_IN_FUNCTION_EMULATOR_GLSL_H_
@@ -4,9 +4,13 @@
 // found in the LICENSE file.
 //
 
+#include "compiler/preprocessor/Token.h"
 #include "compiler/translator/BuiltInFunctionEmulator.h"
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/DetectCallDepth.h"
+#include "compiler/translator/Diagnostics.h"
+#include "compiler/translator/DirectiveHandler.h"
+#include "compiler/translator/EstimateShaderCost.h"
 #include "compiler/translator/ForLoopUnroll.h"
 #include "compiler/translator/Initialize.h"
 #include "compiler/translator/InitializeParseContext.h"
@@ -86,6 +90,64 @@ class TScopedSymbolTableLevel
     TSymbolTable* mTable;
 };
 
+// Validates directives like the compiler does and records them.
+class TRecordingDirectiveHandler : public TDirectiveHandler
+{
+  public:
+    TRecordingDirectiveHandler(TExtensionBehavior& extBehavior,
+                               TDiagnostics& diagnostics,
+                               int& shaderVersion,
+                               ShPreprocessorOutput* output)
+        : TDirectiveHandler(extBehavior, diagnostics, shaderVersion),
+          mOutput(output)
+    {
+    }
+
+    virtual void handlePragma(const pp::SourceLocation& loc,
+                              const std::string& name,
+                              const std::string& value,
+                              bool stdgl)
+    {
+        TDirectiveHandler::handlePragma(loc, name, value, stdgl);
+
+        ShPragmaDirective pragma;
+        pragma.name = name;
+        pragma.value = value;
+        pragma.stdgl = stdgl;
+        mOutput->pragmas.push_back(pragma);
+    }
+
+    virtual void handleExtension(const pp::SourceLocation& loc,
+                                 const std::string& name,
+                                 const std::string& behavior)
+    {
+        TDirectiveHandler::handleExtension(loc, name, behavior);
+
+        ShExtensionDirective extension;
+        extension.name = name;
+        extension.behavior = behavior;
+        mOutput->extensions.push_back(extension);
+    }
+
+  private:
+    ShPreprocessorOutput* mOutput;
+};
+
+// 64-bit FNV-1a. Each string is hashed with its terminating null so that
+// token boundaries are part of the fingerprint.
+const unsigned long long kFingerprintOffsetBasis = 14695981039346656037ULL;
+const unsigned long long kFingerprintPrime = 1099511628211ULL;
+
+unsigned long long HashString(unsigned long long hash, const std::string& str)
+{
+    for (size_t i = 0; i <= str.size(); ++i)
+    {
+        hash ^= static_cast<unsigned char>(str.c_str()[i]);
+        hash *= kFingerprintPrime;
+    }
+    return hash;
+}
+
 int MapSpecToShaderVersion(ShShaderSpec spec)
 {
     switch (spec)
@@ -126,7 +188,7 @@ TCompiler::TCompiler(sh::GLenum type, ShShaderSpec spec, ShShaderOutput output)
       maxCallStackDepth(0),
       fragmentPrecisionHigh(false),
       clampingStrategy(SH_CLAMP_WITH_CLAMP_INTRINSIC),
-      builtInFunctionEmulator(type)
+      hasCostEstimate(false)
 {
 }
 
@@ -151,10 +213,14 @@ bool TCompiler::Init(const ShBuiltInResources& resources)
     InitExtensionBehavior(resources, extensionBehavior);
     fragmentPrecisionHigh = resources.FragmentPrecisionHigh == 1;
 
+    initBuiltInFunctionEmulator(&builtInFunctionEmulator);
+
     arrayBoundsClamper.SetClampingStrategy(resources.ArrayIndexClampingStrategy);
     clampingStrategy = resources.ArrayIndexClampingStrategy;
 
-    hashFunction = resources.HashFunction;
+    nameHashingCache.setHashFunction(resources.HashFunction);
+    nameHashingCache.setMaxSize(resources.MaxNameHashingCacheSize > 0 ?
+                                resources.MaxNameHashingCacheSize : 0);
 
     return true;
 }
@@ -187,6 +253,7 @@ bool TCompiler::compile(const char* const shaderStrings[],
                                shaderType, shaderSpec, compileOptions, true,
                                sourcePath, infoSink);
     parseContext.fragmentPrecisionHigh = fragmentPrecisionHigh;
+    setPreprocessorLimits(&parseContext.preprocessor);
     SetGlobalParseContext(&parseContext);
 
     // We preserve symbols at the built-in level from compile-to-compile.
@@ -254,6 +321,11 @@ bool TCompiler::compile(const char* const shaderStrings[],
             }
         }
 
+        // The cost estimate relies on validateLimitations for loop trip counts,
+        // and needs to see the tree before it is rewritten.
+        if (success && (compileOptions & SH_ESTIMATE_SHADER_COST))
+            estimateShaderCost(root, (compileOptions & SH_VALIDATE_LOOP_INDEXING) != 0);
+
         // Built-in function emulation needs to happen after validateLimitations pass.
         if (success && (compileOptions & SH_EMULATE_BUILT_IN_FUNCTIONS))
             builtInFunctionEmulator.MarkBuiltInFunctionsForEmulation(root);
@@ -312,9 +384,83 @@ bool TCompiler::compile(const char* const shaderStrings[],
     // Cleanup memory.
     intermediate.remove(parseContext.treeRoot);
     SetGlobalParseContext(NULL);
+    nameHashingCache.trim();
     return success;
 }
 
+bool TCompiler::preprocess(const char* const shaderStrings[],
+                           size_t numStrings,
+                           ShPreprocessorOutput* output)
+{
+    infoSink.info.erase();
+
+    output->text.clear();
+    output->version = 100;
+    output->extensions.clear();
+    output->pragmas.clear();
+    output->referencedMacros.clear();
+    output->fingerprint = kFingerprintOffsetBasis;
+
+    // #extension directives must not change the behavior seen by the
+    // next compile.
+    TExtensionBehavior extBehavior(extensionBehavior);
+    TDiagnostics diagnostics(infoSink);
+    TRecordingDirectiveHandler directiveHandler(extBehavior, diagnostics,
+                                                output->version, output);
+    pp::Preprocessor preprocessor(&diagnostics, &directiveHandler);
+    setPreprocessorLimits(&preprocessor);
+    preprocessor.setRecordMacroReferences(true);
+
+    if (!preprocessor.init(numStrings, shaderStrings, NULL))
+        return false;
+
+    // Same predefined macros as glslang_scan().
+    for (TExtensionBehavior::const_iterator iter = extensionBehavior.begin();
+         iter != extensionBehavior.end(); ++iter)
+    {
+        preprocessor.predefineMacro(iter->first.c_str(), 1);
+    }
+    if (fragmentPrecisionHigh)
+        preprocessor.predefineMacro("GL_FRAGMENT_PRECISION_HIGH", 1);
+    preprocessor.setMaxTokenSize(GetGlobalMaxTokenSize(shaderSpec));
+
+    unsigned long long fingerprint = kFingerprintOffsetBasis;
+    pp::SourceLocation lastLocation;
+    pp::Token token;
+    for (preprocessor.lex(&token); token.type != pp::Token::LAST; preprocessor.lex(&token))
+    {
+        if (!output->text.empty())
+            output->text += (token.location != lastLocation) ? '\n' : ' ';
+        output->text += token.text;
+        lastLocation = token.location;
+
+        fingerprint = HashString(fingerprint, token.text);
+    }
+
+    // Directives are consumed by the preprocessor but change the meaning of
+    // the shader, so they are part of the fingerprint too.
+    std::ostringstream version;
+    version << output->version;
+    fingerprint = HashString(fingerprint, version.str());
+    for (size_t i = 0; i < output->extensions.size(); ++i)
+    {
+        fingerprint = HashString(fingerprint, output->extensions[i].name);
+        fingerprint = HashString(fingerprint, output->extensions[i].behavior);
+    }
+    for (size_t i = 0; i < output->pragmas.size(); ++i)
+    {
+        fingerprint = HashString(fingerprint, output->pragmas[i].stdgl ? "STDGL" : "");
+        fingerprint = HashString(fingerprint, output->pragmas[i].name);
+        fingerprint = HashString(fingerprint, output->pragmas[i].value);
+    }
+    output->fingerprint = fingerprint;
+
+    const std::set<std::string>& macros = preprocessor.referencedMacros();
+    output->referencedMacros.assign(macros.begin(), macros.end());
+
+    return diagnostics.numErrors() == 0;
+}
+
 bool TCompiler::InitBuiltInSymbolTable(const ShBuiltInResources &resources)
 {
     compileResources = resources;
@@ -394,11 +540,23 @@ void TCompiler::setResourceString()
               << ":MaxFragmentInputVectors:" << compileResources.MaxFragmentInputVectors
               << ":MinProgramTexelOffset:" << compileResources.MinProgramTexelOffset
               << ":MaxProgramTexelOffset:" << compileResources.MaxProgramTexelOffset
-              << ":NV_draw_buffers:" << compileResources.NV_draw_buffers;
+              << ":NV_draw_buffers:" << compileResources.NV_draw_buffers
+              << ":MaxShaderSourceSize:" << compileResources.MaxShaderSourceSize
+              << ":MaxTokensPerLine:" << compileResources.MaxTokensPerLine
+              << ":MaxMacroExpandedTokens:" << compileResources.MaxMacroExpandedTokens
+              << ":MaxMacroNestingDepth:" << compileResources.MaxMacroNestingDepth;
 
     builtInResourcesString = strstream.str();
 }
 
+void TCompiler::setPreprocessorLimits(pp::Preprocessor* preprocessor) const
+{
+    preprocessor->setMaxSourceSize(compileResources.MaxShaderSourceSize);
+    preprocessor->setMaxTokensPerLine(compileResources.MaxTokensPerLine);
+    preprocessor->setMaxMacroExpandedTokens(compileResources.MaxMacroExpandedTokens);
+    preprocessor->setMaxMacroNestingDepth(compileResources.MaxMacroNestingDepth);
+}
+
 void TCompiler::clearResults()
 {
     arrayBoundsClamper.Cleanup();
@@ -415,6 +573,9 @@ void TCompiler::clearResults()
 
     builtInFunctionEmulator.Cleanup();
 
+    hasCostEstimate = false;
+    costEstimate.functions.clear();
+
     nameMap.clear();
 }
 
@@ -519,6 +680,13 @@ bool TCompiler::limitExpressionComplexity(TIntermNode* root)
     return true;
 }
 
+void TCompiler::estimateShaderCost(TIntermNode* root, bool loopsAreValidated)
+{
+    EstimateShaderCost estimator(loopsAreValidated);
+    estimator.estimate(root, &costEstimate);
+    hasCostEstimate = true;
+}
+
 bool TCompiler::enforceFragmentShaderTimingRestrictions(const TDependencyGraph& graph)
 {
     RestrictFragmentShaderTiming restrictor(infoSink.info);
@@ -540,7 +708,7 @@ void TCompiler::collectVariables(TIntermNode* root)
                                  &uniforms,
                                  &varyings,
                                  &interfaceBlocks,
-                                 hashFunction,
+                                 &nameHashingCache,
                                  symbolTable);
     root->traverse(&collect);
 
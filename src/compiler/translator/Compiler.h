@@ -25,6 +25,10 @@
 
 class TCompiler;
 class TDependencyGraph;
+namespace pp
+{
+class Preprocessor;
+}
 class TranslatorHLSL;
 
 //
@@ -64,6 +68,11 @@ class TCompiler : public TShHandleBase
     bool compile(const char* const shaderStrings[],
                  size_t numStrings,
                  int compileOptions);
+    // Runs only the preprocessor. Does not touch the results of the last
+    // compilation except for the info log.
+    bool preprocess(const char* const shaderStrings[],
+                    size_t numStrings,
+                    ShPreprocessorOutput* output);
 
     // Get results of the last compilation.
     int getShaderVersion() const { return shaderVersion; }
@@ -74,8 +83,12 @@ class TCompiler : public TShHandleBase
     const std::vector<sh::Uniform> &getUniforms() const { return uniforms; }
     const std::vector<sh::Varying> &getVaryings() const { return varyings; }
     const std::vector<sh::InterfaceBlock> &getInterfaceBlocks() const { return interfaceBlocks; }
+    const ShShaderCostEstimate *getShaderCostEstimate() const
+    {
+        return hasCostEstimate ? &costEstimate : NULL;
+    }
 
-    ShHashFunction64 getHashFunction() const { return hashFunction; }
+    NameHashingCache& getNameHashingCache() { return nameHashingCache; }
     NameMap& getNameMap() { return nameMap; }
     TSymbolTable& getSymbolTable() { return symbolTable; }
     ShShaderSpec getShaderSpec() const { return shaderSpec; }
@@ -93,6 +106,8 @@ class TCompiler : public TShHandleBase
     void setResourceString();
     // Clears the results from the previous compilation.
     void clearResults();
+    // Apply the limits from the built-in resources to the preprocessor.
+    void setPreprocessorLimits(pp::Preprocessor* preprocessor) const;
     // Return true if function recursion is detected or call depth exceeded.
     bool detectCallDepth(TIntermNode* root, TInfoSink& infoSink, bool limitCallStackDepth);
     // Returns true if a program has no conflicting or missing fragment outputs
@@ -106,6 +121,8 @@ class TCompiler : public TShHandleBase
     void collectVariables(TIntermNode* root);
     // Translate to object code.
     virtual void translate(TIntermNode* root) = 0;
+    // Register the built-in function emulations the output needs.
+    virtual void initBuiltInFunctionEmulator(BuiltInFunctionEmulator* emu) {}
     // Returns true if, after applying the packing rules in the GLSL 1.017 spec
     // Appendix A, section 7, the shader does not use too many uniforms.
     bool enforcePackingRestrictions();
@@ -128,6 +145,8 @@ class TCompiler : public TShHandleBase
     bool enforceFragmentShaderTimingRestrictions(const TDependencyGraph& graph);
     // Return true if the maximum expression complexity is below the limit.
     bool limitExpressionComplexity(TIntermNode* root);
+    // Compute a static estimate of the cost of running the shader.
+    void estimateShaderCost(TIntermNode* root, bool loopsAreValidated);
     // Get built-in extensions with default behavior.
     const TExtensionBehavior& getExtensionBehavior() const;
     const TPragma& getPragma() const { return mPragma; }
@@ -171,8 +190,11 @@ class TCompiler : public TShHandleBase
     int shaderVersion;
     TInfoSink infoSink;  // Output sink.
 
+    bool hasCostEstimate;
+    ShShaderCostEstimate costEstimate;
+
     // name hashing.
-    ShHashFunction64 hashFunction;
+    NameHashingCache nameHashingCache;
     NameMap nameMap;
 
     TPragma mPragma;
@@ -0,0 +1,366 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "compiler/translator/EstimateShaderCost.h"
+
+#include "compiler/translator/LoopInfo.h"
+#include "compiler/translator/depgraph/DependencyGraph.h"
+#include "compiler/translator/util.h"
+
+#include <limits>
+#include <string.h>
+
+namespace
+{
+
+// Loops running longer than this are reported as unbounded.
+const unsigned int kMaxLoopTripCount = 1 << 20;
+
+// Weights saturate instead of wrapping around, so that the shaders with the
+// deepest loops still have the largest weights.
+const unsigned long long kMaxWeight = std::numeric_limits<unsigned long long>::max();
+
+unsigned long long SaturatingAdd(unsigned long long a, unsigned long long b)
+{
+    return (a > kMaxWeight - b) ? kMaxWeight : a + b;
+}
+
+unsigned long long SaturatingMultiply(unsigned long long a, unsigned long long b)
+{
+    return (b != 0 && a > kMaxWeight / b) ? kMaxWeight : a * b;
+}
+
+void ClearCost(ShShaderCost *cost)
+{
+    memset(cost, 0, sizeof(*cost));
+}
+
+// Adds the cost of a callee invoked |count| times from call sites whose loop
+// weights sum up to |weight|.
+void AddCalleeCost(ShShaderCost *cost, const ShShaderCost &callee,
+                   unsigned int count, unsigned long long weight)
+{
+    cost->aluOps += callee.aluOps * count;
+    cost->textureFetches += callee.textureFetches * count;
+    cost->dependentTextureFetches += callee.dependentTextureFetches * count;
+    cost->branches += callee.branches * count;
+    cost->loops += callee.loops * count;
+    cost->unboundedLoops += callee.unboundedLoops * count;
+    // Locals of a callee are live for one call at a time.
+    cost->temporaries += callee.temporaries;
+    cost->weightedInstructions = SaturatingAdd(cost->weightedInstructions,
+                                               SaturatingMultiply(callee.weightedInstructions, weight));
+}
+
+unsigned int CountVaryingRegisters(const std::map<int, unsigned int> &varyings)
+{
+    unsigned int registers = 0;
+    for (std::map<int, unsigned int>::const_iterator iter = varyings.begin();
+         iter != varyings.end(); ++iter)
+    {
+        registers += iter->second;
+    }
+    return registers;
+}
+
+bool IsTextureFetch(TIntermAggregate *node)
+{
+    if (node->getOp() != EOpFunctionCall || node->isUserDefined())
+        return false;
+
+    TIntermSequence *arguments = node->getSequence();
+    if (arguments->empty())
+        return false;
+
+    TIntermTyped *sampler = (*arguments)[0]->getAsTyped();
+    if (!sampler || !IsSampler(sampler->getBasicType()))
+        return false;
+
+    // textureSize() only queries the sampler, it does not fetch.
+    return node->getName().compare(0, 11, "textureSize") != 0;
+}
+
+// Starting from the samplers, walks the dependency graph and records every
+// call that has an argument other than the sampler itself depending on the
+// result of a texture lookup.
+class DependentFetchFinder : public TDependencyGraphTraverser
+{
+  public:
+    DependentFetchFinder(std::set<const TIntermAggregate *> *dependentCalls)
+        : mDependentCalls(dependentCalls) {}
+
+    void find(const TDependencyGraph &graph)
+    {
+        for (TGraphSymbolVector::const_iterator iter = graph.beginSamplerSymbols();
+             iter != graph.endSamplerSymbols();
+             ++iter)
+        {
+            clearVisited();
+            (*iter)->traverse(this);
+        }
+    }
+
+    virtual void visitArgument(TGraphArgument *argument)
+    {
+        if (argument->getArgumentNumber() > 0)
+            mDependentCalls->insert(argument->getIntermFunctionCall());
+    }
+
+  private:
+    std::set<const TIntermAggregate *> *mDependentCalls;
+};
+
+}  // namespace anonymous
+
+EstimateShaderCost::FunctionCost::FunctionCost()
+    : inclusiveDone(false)
+{
+    ClearCost(&self);
+    ClearCost(&inclusive);
+}
+
+EstimateShaderCost::EstimateShaderCost(bool loopsAreValidated)
+    : TIntermTraverser(true, false, true),
+      mLoopsAreValidated(loopsAreValidated),
+      mCurrentFunction(&mGlobal),
+      mLoopWeight(1)
+{
+}
+
+void EstimateShaderCost::estimate(TIntermNode *root, ShShaderCostEstimate *estimateOut)
+{
+    {
+        TDependencyGraph graph(root);
+        DependentFetchFinder finder(&mDependentFetches);
+        finder.find(graph);
+    }
+
+    root->traverse(this);
+
+    estimateOut->functions.clear();
+    for (size_t ii = 0; ii < mFunctionOrder.size(); ++ii)
+    {
+        ShFunctionCost function;
+        function.name = mFunctionOrder[ii];
+        function.cost = computeInclusiveCost(mFunctionOrder[ii])->inclusive;
+        estimateOut->functions.push_back(function);
+    }
+
+    ShShaderCost &total = estimateOut->total;
+    total = mGlobal.self;
+    std::map<int, unsigned int> varyings = mGlobal.varyings;
+
+    FunctionCost *main = computeInclusiveCost("main(");
+    if (main)
+    {
+        AddCalleeCost(&total, main->inclusive, 1, 1);
+        varyings.insert(main->inclusiveVaryings.begin(), main->inclusiveVaryings.end());
+    }
+    total.interpolators = CountVaryingRegisters(varyings);
+}
+
+void EstimateShaderCost::visitSymbol(TIntermSymbol *node)
+{
+    if (mCurrentFunction == &mGlobal || !sh::IsVarying(node->getQualifier()))
+        return;
+
+    const TType &type = node->getType();
+    unsigned int registers = type.isMatrix() ? type.getCols() : 1;
+    if (type.isArray())
+        registers *= type.getArraySize();
+    mCurrentFunction->varyings[node->getId()] = registers;
+}
+
+bool EstimateShaderCost::visitBinary(Visit visit, TIntermBinary *node)
+{
+    if (visit != PreVisit)
+        return true;
+
+    switch (node->getOp())
+    {
+      case EOpAssign:
+      case EOpInitialize:
+      case EOpComma:
+      case EOpIndexDirect:
+      case EOpIndexDirectStruct:
+      case EOpIndexDirectInterfaceBlock:
+      case EOpVectorSwizzle:
+        // Moves and constant addressing are free.
+        break;
+      default:
+        addOp();
+        break;
+    }
+    return true;
+}
+
+bool EstimateShaderCost::visitUnary(Visit visit, TIntermUnary *node)
+{
+    if (visit == PreVisit)
+        addOp();
+    return true;
+}
+
+bool EstimateShaderCost::visitSelection(Visit visit, TIntermSelection *node)
+{
+    if (visit == PreVisit)
+        ++mCurrentFunction->self.branches;
+    return true;
+}
+
+bool EstimateShaderCost::visitAggregate(Visit visit, TIntermAggregate *node)
+{
+    switch (node->getOp())
+    {
+      case EOpFunction:
+        if (visit == PreVisit)
+        {
+            std::string name = node->getName().c_str();
+            if (mFunctions.find(name) == mFunctions.end())
+                mFunctionOrder.push_back(name);
+            mCurrentFunction = &mFunctions[name];
+        }
+        else if (visit == PostVisit)
+        {
+            mCurrentFunction = &mGlobal;
+        }
+        return true;
+
+      case EOpParameters:
+      case EOpPrototype:
+        return false;
+
+      case EOpSequence:
+      case EOpInvariantDeclaration:
+      case EOpNull:
+        return true;
+
+      case EOpDeclaration:
+        if (visit == PreVisit && mCurrentFunction != &mGlobal)
+            mCurrentFunction->self.temporaries += static_cast<unsigned int>(node->getSequence()->size());
+        return true;
+
+      case EOpFunctionCall:
+        if (visit != PreVisit)
+            return true;
+
+        if (node->isUserDefined())
+        {
+            CallSites &callSites = mCurrentFunction->callees[node->getName().c_str()];
+            ++callSites.count;
+            callSites.weight = SaturatingAdd(callSites.weight, mLoopWeight);
+        }
+        else if (IsTextureFetch(node))
+        {
+            ShShaderCost &cost = mCurrentFunction->self;
+            ++cost.textureFetches;
+            if (mDependentFetches.count(node) > 0)
+                ++cost.dependentTextureFetches;
+            cost.weightedInstructions = SaturatingAdd(cost.weightedInstructions, mLoopWeight);
+        }
+        else
+        {
+            addOp();
+        }
+        return true;
+
+      default:
+        if (visit == PreVisit && !node->isConstructor())
+            addOp();
+        return true;
+    }
+}
+
+bool EstimateShaderCost::visitLoop(Visit visit, TIntermLoop *node)
+{
+    if (visit != PreVisit)
+        return true;
+
+    ShShaderCost &cost = mCurrentFunction->self;
+    ++cost.loops;
+
+    unsigned long long tripCount = 1;
+    if (!computeTripCount(node, &tripCount))
+    {
+        ++cost.unboundedLoops;
+        tripCount = 1;
+    }
+
+    if (node->getInit())
+        node->getInit()->traverse(this);
+
+    unsigned long long outerWeight = mLoopWeight;
+    mLoopWeight = SaturatingMultiply(mLoopWeight, tripCount);
+    if (node->getCondition())
+        node->getCondition()->traverse(this);
+    if (node->getBody())
+        node->getBody()->traverse(this);
+    if (node->getExpression())
+        node->getExpression()->traverse(this);
+    mLoopWeight = outerWeight;
+
+    return false;
+}
+
+void EstimateShaderCost::addOp()
+{
+    ShShaderCost &cost = mCurrentFunction->self;
+    ++cost.aluOps;
+    cost.weightedInstructions = SaturatingAdd(cost.weightedInstructions, mLoopWeight);
+}
+
+bool EstimateShaderCost::computeTripCount(TIntermLoop *node, unsigned long long *tripCountOut) const
+{
+    if (!mLoopsAreValidated || node->getType() != ELoopFor)
+        return false;
+
+    TLoopInfo info(node);
+    if (info.index.getType() != EbtInt)
+        return false;
+
+    unsigned long long tripCount = 0;
+    while (info.index.satisfiesLoopCondition())
+    {
+        if (++tripCount > kMaxLoopTripCount)
+            return false;
+        info.index.step();
+    }
+
+    *tripCountOut = tripCount;
+    return true;
+}
+
+EstimateShaderCost::FunctionCost *EstimateShaderCost::computeInclusiveCost(const std::string &name)
+{
+    std::map<std::string, FunctionCost>::iterator iter = mFunctions.find(name);
+    if (iter == mFunctions.end())
+        return NULL;
+
+    FunctionCost &function = iter->second;
+    if (function.inclusiveDone)
+        return &function;
+
+    // Recursion has been rejected before the estimate is computed.
+    function.inclusiveDone = true;
+    function.inclusive = function.self;
+    function.inclusiveVaryings = function.varyings;
+
+    for (std::map<std::string, CallSites>::const_iterator calleeIter = function.callees.begin();
+         calleeIter != function.callees.end(); ++calleeIter)
+    {
+        const FunctionCost *callee = computeInclusiveCost(calleeIter->first);
+        if (!callee)
+            continue;
+
+        const CallSites &callSites = calleeIter->second;
+        AddCalleeCost(&function.inclusive, callee->inclusive, callSites.count, callSites.weight);
+        function.inclusiveVaryings.insert(callee->inclusiveVaryings.begin(),
+                                          callee->inclusiveVaryings.end());
+    }
+    function.inclusive.interpolators = CountVaryingRegisters(function.inclusiveVaryings);
+
+    return &function;
+}
@@ -0,0 +1,81 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#ifndef COMPILER_TRANSLATOR_ESTIMATE_SHADER_COST_H_
+#define COMPILER_TRANSLATOR_ESTIMATE_SHADER_COST_H_
+
+#include "compiler/translator/IntermNode.h"
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+// Traverses a validated intermediate tree and computes a static estimate of
+// the cost of running the shader, per function and for the whole shader.
+class EstimateShaderCost : public TIntermTraverser
+{
+  public:
+    // If loopsAreValidated is true, every for-loop has the form required by
+    // GLSL ES 1.00 Appendix A and its trip count is taken from TLoopInfo.
+    // Otherwise loops are treated as unbounded.
+    EstimateShaderCost(bool loopsAreValidated);
+
+    void estimate(TIntermNode *root, ShShaderCostEstimate *estimateOut);
+
+  protected:
+    virtual void visitSymbol(TIntermSymbol *);
+    virtual bool visitBinary(Visit, TIntermBinary *);
+    virtual bool visitUnary(Visit, TIntermUnary *);
+    virtual bool visitSelection(Visit, TIntermSelection *);
+    virtual bool visitAggregate(Visit, TIntermAggregate *);
+    virtual bool visitLoop(Visit, TIntermLoop *);
+
+  private:
+    struct CallSites
+    {
+        CallSites() : count(0), weight(0) {}
+
+        unsigned int count;
+        // Sum of the loop weights of all the call sites.
+        unsigned long long weight;
+    };
+
+    struct FunctionCost
+    {
+        FunctionCost();
+
+        // Cost of the function body alone, not counting callees.
+        ShShaderCost self;
+        // Varying symbol id -> number of registers.
+        std::map<int, unsigned int> varyings;
+        // Mangled callee name -> call sites.
+        std::map<std::string, CallSites> callees;
+
+        bool inclusiveDone;
+        ShShaderCost inclusive;
+        std::map<int, unsigned int> inclusiveVaryings;
+    };
+
+    void addOp();
+    bool computeTripCount(TIntermLoop *node, unsigned long long *tripCountOut) const;
+    FunctionCost *computeInclusiveCost(const std::string &name);
+
+    bool mLoopsAreValidated;
+
+    std::map<std::string, FunctionCost> mFunctions;
+    std::vector<std::string> mFunctionOrder;
+    FunctionCost mGlobal;
+    FunctionCost *mCurrentFunction;
+
+    // Product of the trip counts of the loops enclosing the current node.
+    unsigned long long mLoopWeight;
+
+    // Calls that have a non-sampler argument depending on a texture lookup.
+    std::set<const TIntermAggregate *> mDependentFetches;
+};
+
+#endif  // COMPILER_TRANSLATOR_ESTIMATE_SHADER_COST_H_
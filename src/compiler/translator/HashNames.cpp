@@ -0,0 +1,107 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "compiler/translator/HashNames.h"
+
+#include <algorithm>
+#include <string.h>
+
+NameHashingCache::NameHashingCache()
+    : mHashFunction(NULL),
+      mMaxSize(0)
+{
+}
+
+void NameHashingCache::setHashFunction(ShHashFunction64 hashFunction)
+{
+    if (hashFunction != mHashFunction)
+        clear();
+    mHashFunction = hashFunction;
+}
+
+void NameHashingCache::setMaxSize(size_t maxSize)
+{
+    mMaxSize = maxSize;
+    trim();
+}
+
+const NameHashingCache::Name *NameHashingCache::intern(const TString &name)
+{
+    ASSERT(enabled() && !name.empty());
+
+    NameIndex::iterator iter = mIndex.find(NameKey(name.c_str(), name.length()));
+    if (iter != mIndex.end())
+    {
+        mNames.splice(mNames.begin(), mNames, iter->second);
+        return &*iter->second;
+    }
+
+    mNames.push_front(Name());
+    Name &interned = mNames.front();
+    interned.name.assign(name.c_str(), name.length());
+    interned.hashedName = TIntermTraverser::hash(name, mHashFunction).c_str();
+    mIndex.insert(std::make_pair(NameKey(interned.name.c_str(), interned.name.length()),
+                                 mNames.begin()));
+    return &interned;
+}
+
+const TPersistString &NameHashingCache::hash(const TString &name)
+{
+    if (!enabled() || name.empty())
+    {
+        mUnhashedName.assign(name.c_str(), name.length());
+        return mUnhashedName;
+    }
+    return intern(name)->hashedName;
+}
+
+void NameHashingCache::trim()
+{
+    while (mNames.size() > mMaxSize)
+    {
+        const Name &oldest = mNames.back();
+        mIndex.erase(NameKey(oldest.name.c_str(), oldest.name.length()));
+        mNames.pop_back();
+    }
+}
+
+void NameHashingCache::snapshot(NameMap *snapshotOut) const
+{
+    snapshotOut->clear();
+    for (NameList::const_iterator iter = mNames.begin(); iter != mNames.end(); ++iter)
+    {
+        (*snapshotOut)[iter->name] = iter->hashedName;
+    }
+}
+
+void NameHashingCache::restore(const NameMap &snapshot)
+{
+    clear();
+
+    NameMap::const_iterator iter = snapshot.begin();
+    for (size_t ii = 0; ii < mMaxSize && iter != snapshot.end(); ++ii, ++iter)
+    {
+        Name restored;
+        restored.name = iter->first;
+        restored.hashedName = iter->second;
+        mNames.push_back(restored);
+        const Name &interned = mNames.back();
+        mIndex.insert(std::make_pair(NameKey(interned.name.c_str(), interned.name.length()),
+                                     --mNames.end()));
+    }
+}
+
+void NameHashingCache::clear()
+{
+    mIndex.clear();
+    mNames.clear();
+}
+
+bool NameHashingCache::NameKey::operator<(const NameKey &other) const
+{
+    int result = memcmp(data, other.data, std::min(length, other.length));
+    return result < 0 || (result == 0 && length < other.length);
+}
@@ -7,6 +7,7 @@
 #ifndef COMPILER_HASH_NAMES_H_
 #define COMPILER_HASH_NAMES_H_
 
+#include <list>
 #include <map>
 
 #include "compiler/translator/IntermNode.h"
@@ -15,4 +16,80 @@
 
 typedef std::map<TPersistString, TPersistString> NameMap;
 
+//
+// Caches the hashed names of user-defined identifiers across compiles.
+// Hashing is deterministic, so a cached name stays valid for as long as
+// the hash function does not change.
+//
+// Names are interned: each distinct identifier is stored once, in a node
+// whose address does not change, so callers can tell names apart by
+// identity instead of comparing strings. To bound its growth, the least
+// recently used names beyond the maximum size are evicted by trim(),
+// which the compiler calls once each compile is done. Interned names are
+// never evicted in between, so they stay valid for the rest of a compile.
+//
+class NameHashingCache
+{
+  public:
+    struct Name
+    {
+        TPersistString name;
+        TPersistString hashedName;
+    };
+
+    NameHashingCache();
+
+    // Changing the hash function empties the cache.
+    void setHashFunction(ShHashFunction64 hashFunction);
+    // A maximum size of 0 disables caching across compiles.
+    void setMaxSize(size_t maxSize);
+
+    // Returns true if names are hashed at all.
+    bool enabled() const { return mHashFunction != NULL; }
+
+    // Returns the interned entry for |name|, hashing it on first use.
+    // Must only be called with a non-empty name while enabled().
+    const Name *intern(const TString &name);
+
+    // Returns the hashed name of |name|, or |name| itself if no hash
+    // function is set. The returned reference is valid until the next
+    // call to trim() or to a non-const method.
+    const TPersistString &hash(const TString &name);
+
+    // Evicts the least recently used names until at most the maximum
+    // size are left.
+    void trim();
+
+    void snapshot(NameMap *snapshotOut) const;
+    // The snapshot must have been taken with the same hash function.
+    void restore(const NameMap &snapshot);
+
+    size_t size() const { return mNames.size(); }
+
+  private:
+    // Refers to the name of an interned entry, or to a name being looked
+    // up, without copying it.
+    struct NameKey
+    {
+        NameKey(const char *dataIn, size_t lengthIn) : data(dataIn), length(lengthIn) {}
+        bool operator<(const NameKey &other) const;
+
+        const char *data;
+        size_t length;
+    };
+
+    // Most recently used first.
+    typedef std::list<Name> NameList;
+    typedef std::map<NameKey, NameList::iterator> NameIndex;
+
+    void clear();
+
+    ShHashFunction64 mHashFunction;
+    size_t mMaxSize;
+    NameList mNames;
+    NameIndex mIndex;
+    // Holds the last returned name when it is not hashed.
+    TPersistString mUnhashedName;
+};
+
 #endif  // COMPILER_HASH_NAMES_H_
@@ -14,7 +14,7 @@ class TOutputESSL : public TOutputGLSLBase
 public:
     TOutputESSL(TInfoSinkBase& objSink,
                 ShArrayIndexClampingStrategy clampingStrategy,
-                ShHashFunction64 hashFunction,
+                NameHashingCache &nameHashingCache,
                 NameMap& nameMap,
                 TSymbolTable& symbolTable,
                 int shaderVersion);
@@ -8,11 +8,11 @@
 
 TOutputGLSL::TOutputGLSL(TInfoSinkBase& objSink,
                          ShArrayIndexClampingStrategy clampingStrategy,
-                         ShHashFunction64 hashFunction,
+                         NameHashingCache &nameHashingCache,
                          NameMap& nameMap,
                          TSymbolTable& symbolTable,
                          int shaderVersion)
-    : TOutputGLSLBase(objSink, clampingStrategy, hashFunction, nameMap, symbolTable, shaderVersion)
+    : TOutputGLSLBase(objSink, clampingStrategy, nameHashingCache, nameMap, symbolTable, shaderVersion)
 {
 }
 
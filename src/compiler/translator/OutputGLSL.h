@@ -14,7 +14,7 @@ class TOutputGLSL : public TOutputGLSLBase
 public:
     TOutputGLSL(TInfoSinkBase& objSink,
                 ShArrayIndexClampingStrategy clampingStrategy,
-                ShHashFunction64 hashFunction,
+                NameHashingCache &nameHashingCache,
                 NameMap& nameMap,
                 TSymbolTable& symbolTable,
                 int shaderVersion);
@@ -42,7 +42,7 @@ bool isSingleStatement(TIntermNode *node)
 
 TOutputGLSLBase::TOutputGLSLBase(TInfoSinkBase &objSink,
                                  ShArrayIndexClampingStrategy clampingStrategy,
-                                 ShHashFunction64 hashFunction,
+                                 NameHashingCache &nameHashingCache,
                                  NameMap &nameMap,
                                  TSymbolTable &symbolTable,
                                  int shaderVersion)
@@ -50,7 +50,7 @@ TOutputGLSLBase::TOutputGLSLBase(TInfoSinkBase &objSink,
       mObjSink(objSink),
       mDeclaringVariables(false),
       mClampingStrategy(clampingStrategy),
-      mHashFunction(hashFunction),
+      mNameHashingCache(nameHashingCache),
       mNameMap(nameMap),
       mSymbolTable(symbolTable),
       mShaderVersion(shaderVersion)
@@ -962,14 +962,12 @@ TString TOutputGLSLBase::getTypeName(const TType &type)
 
 TString TOutputGLSLBase::hashName(const TString &name)
 {
-    if (mHashFunction == NULL || name.empty())
+    if (!mNameHashingCache.enabled() || name.empty())
         return name;
-    NameMap::const_iterator it = mNameMap.find(name.c_str());
-    if (it != mNameMap.end())
-        return it->second.c_str();
-    TString hashedName = TIntermTraverser::hash(name, mHashFunction);
-    mNameMap[name.c_str()] = hashedName.c_str();
-    return hashedName;
+    const NameHashingCache::Name *interned = mNameHashingCache.intern(name);
+    if (mMappedNames.insert(interned).second)
+        mNameMap[interned->name] = interned->hashedName;
+    return interned->hashedName.c_str();
 }
 
 TString TOutputGLSLBase::hashVariableName(const TString &name)
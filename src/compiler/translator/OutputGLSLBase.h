@@ -9,6 +9,7 @@
 
 #include <set>
 
+#include "compiler/translator/HashNames.h"
 #include "compiler/translator/IntermNode.h"
 #include "compiler/translator/LoopInfo.h"
 #include "compiler/translator/ParseContext.h"
@@ -18,7 +19,7 @@ class TOutputGLSLBase : public TIntermTraverser
   public:
     TOutputGLSLBase(TInfoSinkBase &objSink,
                     ShArrayIndexClampingStrategy clampingStrategy,
-                    ShHashFunction64 hashFunction,
+                    NameHashingCache &nameHashingCache,
                     NameMap &nameMap,
                     TSymbolTable& symbolTable,
                     int shaderVersion);
@@ -71,7 +72,9 @@ class TOutputGLSLBase : public TIntermTraverser
     ShArrayIndexClampingStrategy mClampingStrategy;
 
     // name hashing.
-    ShHashFunction64 mHashFunction;
+    NameHashingCache &mNameHashingCache;
+    // The interned names already added to the name map.
+    std::set<const NameHashingCache::Name *> mMappedNames;
 
     NameMap &mNameMap;
 
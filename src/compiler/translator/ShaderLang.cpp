@@ -167,11 +167,17 @@ void ShInitBuiltInResources(ShBuiltInResources* resources)
 
     // Disable name hashing by default.
     resources->HashFunction = NULL;
+    resources->MaxNameHashingCacheSize = 16384;
 
     resources->ArrayIndexClampingStrategy = SH_CLAMP_WITH_CLAMP_INTRINSIC;
 
     resources->MaxExpressionComplexity = 256;
     resources->MaxCallStackDepth = 256;
+
+    resources->MaxShaderSourceSize = 1 << 24;
+    resources->MaxTokensPerLine = 1 << 18;
+    resources->MaxMacroExpandedTokens = 1 << 20;
+    resources->MaxMacroNestingDepth = 256;
 }
 
 //
@@ -232,6 +238,18 @@ bool ShCompile(
     return compiler->compile(shaderStrings, numStrings, compileOptions);
 }
 
+bool ShPreprocess(
+    const ShHandle handle,
+    const char *const shaderStrings[],
+    size_t numStrings,
+    ShPreprocessorOutput *output)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    ASSERT(compiler);
+
+    return compiler->preprocess(shaderStrings, numStrings, output);
+}
+
 int ShGetShaderVersion(const ShHandle handle)
 {
     TCompiler* compiler = GetCompilerFromHandle(handle);
@@ -278,6 +296,22 @@ const std::map<std::string, std::string> *ShGetNameHashingMap(
     return &(compiler->getNameMap());
 }
 
+void ShGetNameHashingCache(const ShHandle handle,
+                           std::map<std::string, std::string> *snapshot)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    ASSERT(compiler);
+    compiler->getNameHashingCache().snapshot(snapshot);
+}
+
+void ShSetNameHashingCache(const ShHandle handle,
+                           const std::map<std::string, std::string> &snapshot)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    ASSERT(compiler);
+    compiler->getNameHashingCache().restore(snapshot);
+}
+
 const std::vector<sh::Uniform> *ShGetUniforms(const ShHandle handle)
 {
     return GetShaderVariables<sh::Uniform>(handle, SHADERVAR_UNIFORM);
@@ -303,6 +337,14 @@ const std::vector<sh::InterfaceBlock> *ShGetInterfaceBlocks(const ShHandle handl
     return GetShaderVariables<sh::InterfaceBlock>(handle, SHADERVAR_INTERFACEBLOCK);
 }
 
+const ShShaderCostEstimate *ShGetShaderCostEstimate(const ShHandle handle)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    if (!compiler)
+        return NULL;
+    return compiler->getShaderCostEstimate();
+}
+
 bool ShCheckVariablesWithinPackingLimits(
     int maxVectors, ShVariableInfo *varInfoArray, size_t varInfoArraySize)
 {
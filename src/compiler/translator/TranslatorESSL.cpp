@@ -6,6 +6,7 @@
 
 #include "compiler/translator/TranslatorESSL.h"
 
+#include "compiler/translator/BuiltInFunctionEmulatorGLSL.h"
 #include "compiler/translator/OutputESSL.h"
 #include "angle_gl.h"
 
@@ -13,6 +14,13 @@ TranslatorESSL::TranslatorESSL(sh::GLenum type, ShShaderSpec spec)
     : TCompiler(type, spec, SH_ESSL_OUTPUT) {
 }
 
+void TranslatorESSL::initBuiltInFunctionEmulator(BuiltInFunctionEmulator* emu) {
+#if defined(__APPLE__)
+    // Work around ATI driver bugs in Mac.
+    InitBuiltInFunctionEmulatorForGLSLWorkarounds(emu, getShaderType());
+#endif
+}
+
 void TranslatorESSL::translate(TIntermNode* root) {
     TInfoSinkBase& sink = getInfoSink().obj;
 
@@ -29,7 +37,7 @@ void TranslatorESSL::translate(TIntermNode* root) {
     getArrayBoundsClamper().OutputClampingFunctionDefinition(sink);
 
     // Write translated shader.
-    TOutputESSL outputESSL(sink, getArrayIndexClampingStrategy(), getHashFunction(), getNameMap(), getSymbolTable(), getShaderVersion());
+    TOutputESSL outputESSL(sink, getArrayIndexClampingStrategy(), getNameHashingCache(), getNameMap(), getSymbolTable(), getShaderVersion());
     root->traverse(&outputESSL);
 }
 
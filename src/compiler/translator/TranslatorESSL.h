@@ -15,6 +15,7 @@ public:
 
 protected:
     virtual void translate(TIntermNode* root);
+    virtual void initBuiltInFunctionEmulator(BuiltInFunctionEmulator* emu);
 
 private:
     void writeExtensionBehavior();
@@ -6,6 +6,7 @@
 
 #include "compiler/translator/TranslatorGLSL.h"
 
+#include "compiler/translator/BuiltInFunctionEmulatorGLSL.h"
 #include "compiler/translator/OutputGLSL.h"
 #include "compiler/translator/VersionGLSL.h"
 
@@ -13,6 +14,14 @@ TranslatorGLSL::TranslatorGLSL(sh::GLenum type, ShShaderSpec spec)
     : TCompiler(type, spec, SH_GLSL_OUTPUT) {
 }
 
+void TranslatorGLSL::initBuiltInFunctionEmulator(BuiltInFunctionEmulator *emu)
+{
+#if defined(__APPLE__)
+    // Work around ATI driver bugs in Mac.
+    InitBuiltInFunctionEmulatorForGLSLWorkarounds(emu, getShaderType());
+#endif
+}
+
 void TranslatorGLSL::translate(TIntermNode* root) {
     TInfoSinkBase& sink = getInfoSink().obj;
 
@@ -32,7 +41,7 @@ void TranslatorGLSL::translate(TIntermNode* root) {
     getArrayBoundsClamper().OutputClampingFunctionDefinition(sink);
 
     // Write translated shader.
-    TOutputGLSL outputGLSL(sink, getArrayIndexClampingStrategy(), getHashFunction(), getNameMap(), getSymbolTable(), getShaderVersion());
+    TOutputGLSL outputGLSL(sink, getArrayIndexClampingStrategy(), getNameHashingCache(), getNameMap(), getSymbolTable(), getShaderVersion());
     root->traverse(&outputGLSL);
 }
 
@@ -16,6 +16,7 @@ class TranslatorGLSL : public TCompiler
 
   protected:
     virtual void translate(TIntermNode *root);
+    virtual void initBuiltInFunctionEmulator(BuiltInFunctionEmulator *emu);
 
   private:
     void writeVersion(TIntermNode *root);
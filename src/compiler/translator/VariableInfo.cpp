@@ -132,7 +132,7 @@ CollectVariables::CollectVariables(std::vector<sh::Attribute> *attribs,
                                    std::vector<sh::Uniform> *uniforms,
                                    std::vector<sh::Varying> *varyings,
                                    std::vector<sh::InterfaceBlock> *interfaceBlocks,
-                                   ShHashFunction64 hashFunction,
+                                   NameHashingCache *nameHashingCache,
                                    const TSymbolTable &symbolTable)
     : mAttribs(attribs),
       mOutputVariables(outputVariables),
@@ -144,7 +144,7 @@ CollectVariables::CollectVariables(std::vector<sh::Attribute> *attribs,
       mFragCoordAdded(false),
       mPositionAdded(false),
       mPointSizeAdded(false),
-      mHashFunction(hashFunction),
+      mNameHashingCache(nameHashingCache),
       mSymbolTable(symbolTable)
 {
 }
@@ -294,10 +294,10 @@ void CollectVariables::visitSymbol(TIntermSymbol *symbol)
 class NameHashingTraverser : public GetVariableTraverser
 {
   public:
-    NameHashingTraverser(ShHashFunction64 hashFunction,
+    NameHashingTraverser(NameHashingCache *nameHashingCache,
                          const TSymbolTable &symbolTable)
         : GetVariableTraverser(symbolTable),
-          mHashFunction(hashFunction)
+          mNameHashingCache(nameHashingCache)
     {}
 
   private:
@@ -306,10 +306,10 @@ class NameHashingTraverser : public GetVariableTraverser
     virtual void visitVariable(ShaderVariable *variable)
     {
         TString stringName = TString(variable->name.c_str());
-        variable->mappedName = TIntermTraverser::hash(stringName, mHashFunction).c_str();
+        variable->mappedName = mNameHashingCache->hash(stringName);
     }
 
-    ShHashFunction64 mHashFunction;
+    NameHashingCache *mNameHashingCache;
 };
 
 // Attributes, which cannot have struct fields, are a special case
@@ -327,7 +327,7 @@ void CollectVariables::visitVariable(const TIntermSymbol *variable,
     attribute.precision = GLVariablePrecision(type);
     attribute.name = variable->getSymbol().c_str();
     attribute.arraySize = static_cast<unsigned int>(type.getArraySize());
-    attribute.mappedName = TIntermTraverser::hash(variable->getSymbol(), mHashFunction).c_str();
+    attribute.mappedName = mNameHashingCache->hash(variable->getSymbol());
     attribute.location = variable->getType().getLayoutQualifier().location;
 
     infoList->push_back(attribute);
@@ -342,7 +342,7 @@ void CollectVariables::visitVariable(const TIntermSymbol *variable,
     ASSERT(blockType);
 
     interfaceBlock.name = blockType->name().c_str();
-    interfaceBlock.mappedName = TIntermTraverser::hash(variable->getSymbol(), mHashFunction).c_str();
+    interfaceBlock.mappedName = mNameHashingCache->hash(variable->getSymbol());
     interfaceBlock.instanceName = (blockType->hasInstanceName() ? blockType->instanceName().c_str() : "");
     interfaceBlock.arraySize = variable->getArraySize();
     interfaceBlock.isRowMajorLayout = (blockType->matrixPacking() == EmpRowMajor);
@@ -370,7 +370,7 @@ template <typename VarT>
 void CollectVariables::visitVariable(const TIntermSymbol *variable,
                                      std::vector<VarT> *infoList) const
 {
-    NameHashingTraverser traverser(mHashFunction, mSymbolTable);
+    NameHashingTraverser traverser(mNameHashingCache, mSymbolTable);
     traverser.traverse(variable->getType(), variable->getSymbol(), infoList);
 }
 
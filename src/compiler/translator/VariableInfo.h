@@ -9,6 +9,7 @@
 
 #include <GLSLANG/ShaderLang.h>
 
+#include "compiler/translator/HashNames.h"
 #include "compiler/translator/IntermNode.h"
 
 class TSymbolTable;
@@ -25,7 +26,7 @@ class CollectVariables : public TIntermTraverser
                      std::vector<Uniform> *uniforms,
                      std::vector<Varying> *varyings,
                      std::vector<InterfaceBlock> *interfaceBlocks,
-                     ShHashFunction64 hashFunction,
+                     NameHashingCache *nameHashingCache,
                      const TSymbolTable &symbolTable);
 
     virtual void visitSymbol(TIntermSymbol *symbol);
@@ -54,7 +55,7 @@ class CollectVariables : public TIntermTraverser
     bool mPositionAdded;
     bool mPointSizeAdded;
 
-    ShHashFunction64 mHashFunction;
+    NameHashingCache *mNameHashingCache;
 
     const TSymbolTable &mSymbolTable;
 };
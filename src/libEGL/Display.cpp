@@ -450,7 +450,7 @@ Error Display::createOffscreenSurface(EGLConfig config, HANDLE shareHandle, cons
 }
 
 Error Display::createContext(EGLConfig configHandle, EGLint clientVersion, const gl::Context *shareContext, bool notifyResets,
-                             bool robustAccess, EGLContext *outContext)
+                             bool robustAccess, bool noError, EGLContext *outContext)
 {
     if (!mRenderer)
     {
@@ -471,7 +471,7 @@ Error Display::createContext(EGLConfig configHandle, EGLint clientVersion, const
         return Error(EGL_BAD_CONFIG);
     }
 
-    gl::Context *context = glCreateContext(clientVersion, shareContext, mRenderer, notifyResets, robustAccess);
+    gl::Context *context = glCreateContext(clientVersion, shareContext, mRenderer, notifyResets, robustAccess, noError);
     mContextSet.insert(context);
 
     *outContext = context;
@@ -593,6 +593,11 @@ std::string Display::generateClientExtensionString()
         extensions.push_back("ANGLE_platform_angle_opengl");
     }
 
+    if (supportsPlatformNull())
+    {
+        extensions.push_back("ANGLE_platform_angle_null");
+    }
+
     std::ostringstream stream;
     std::copy(extensions.begin(), extensions.end(), std::ostream_iterator<std::string>(stream, " "));
     return stream.str();
@@ -625,6 +630,8 @@ void Display::initDisplayExtensionString()
     extensions.push_back("EGL_KHR_create_context");
 #endif
 
+    extensions.push_back("EGL_KHR_create_context_no_error");
+
     std::ostringstream stream;
     std::copy(extensions.begin(), extensions.end(), std::ostream_iterator<std::string>(stream, " "));
     mDisplayExtensionString = stream.str();
@@ -657,6 +664,15 @@ bool Display::supportsPlatformOpenGL()
     return false;
 }
 
+bool Display::supportsPlatformNull()
+{
+#if defined(ANGLE_ENABLE_NULL)
+    return true;
+#else
+    return false;
+#endif
+}
+
 void Display::initVendorString()
 {
     mVendorString = "Google Inc.";
@@ -666,7 +682,7 @@ void Display::initVendorString()
     if (mRenderer && mRenderer->getLUID(&adapterLuid))
     {
         char adapterLuidString[64];
-        sprintf_s(adapterLuidString, sizeof(adapterLuidString), " (adapter LUID: %08x%08x)", adapterLuid.HighPart, adapterLuid.LowPart);
+        snprintf(adapterLuidString, sizeof(adapterLuidString), " (adapter LUID: %08x%08x)", adapterLuid.HighPart, adapterLuid.LowPart);
 
         mVendorString += adapterLuidString;
     }
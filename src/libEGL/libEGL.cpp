@@ -88,7 +88,7 @@ bool validateSurface(egl::Display *display, egl::Surface *surface)
 
 extern "C"
 {
-EGLint __stdcall eglGetError(void)
+EGLint EGLAPIENTRY eglGetError(void)
 {
     EVENT("()");
 
@@ -97,14 +97,14 @@ EGLint __stdcall eglGetError(void)
     return error;
 }
 
-EGLDisplay __stdcall eglGetDisplay(EGLNativeDisplayType display_id)
+EGLDisplay EGLAPIENTRY eglGetDisplay(EGLNativeDisplayType display_id)
 {
     EVENT("(EGLNativeDisplayType display_id = 0x%0.8p)", display_id);
 
     return egl::Display::getDisplay(display_id, egl::AttributeMap());
 }
 
-EGLDisplay __stdcall eglGetPlatformDisplayEXT(EGLenum platform, void *native_display, const EGLint *attrib_list)
+EGLDisplay EGLAPIENTRY eglGetPlatformDisplayEXT(EGLenum platform, void *native_display, const EGLint *attrib_list)
 {
     EVENT("(EGLenum platform = %d, void* native_display = 0x%0.8p, const EGLint* attrib_list = 0x%0.8p)",
           platform, native_display, attrib_list);
@@ -121,7 +121,7 @@ EGLDisplay __stdcall eglGetPlatformDisplayEXT(EGLenum platform, void *native_dis
 
     EGLNativeDisplayType displayId = static_cast<EGLNativeDisplayType>(native_display);
 
-#if !defined(ANGLE_ENABLE_WINDOWS_STORE)
+#if defined(ANGLE_PLATFORM_WINDOWS) && !defined(ANGLE_ENABLE_WINDOWS_STORE)
     // Validate the display device context
     if ((displayId != EGL_D3D11_ONLY_DISPLAY_ANGLE) && WindowFromDC(displayId) == NULL)
     {
@@ -170,6 +170,14 @@ EGLDisplay __stdcall eglGetPlatformDisplayEXT(EGLenum platform, void *native_dis
                     }
                     break;
 
+                  case EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE:
+                    if (!egl::Display::supportsPlatformNull())
+                    {
+                        recordError(egl::Error(EGL_SUCCESS));
+                        return EGL_NO_DISPLAY;
+                    }
+                    break;
+
                   default:
                     recordError(egl::Error(EGL_SUCCESS));
                     return EGL_NO_DISPLAY;
@@ -192,7 +200,8 @@ EGLDisplay __stdcall eglGetPlatformDisplayEXT(EGLenum platform, void *native_dis
                 break;
 
               case EGL_PLATFORM_ANGLE_USE_WARP_ANGLE:
-                if (!egl::Display::supportsPlatformD3D())
+                // Explicitly not using WARP is fine without D3D
+                if (curAttrib[1] == EGL_TRUE && !egl::Display::supportsPlatformD3D())
                 {
                     recordError(egl::Error(EGL_SUCCESS));
                     return EGL_NO_DISPLAY;
@@ -255,7 +264,7 @@ EGLDisplay __stdcall eglGetPlatformDisplayEXT(EGLenum platform, void *native_dis
     return egl::Display::getDisplay(displayId, egl::AttributeMap(attrib_list));
 }
 
-EGLBoolean __stdcall eglInitialize(EGLDisplay dpy, EGLint *major, EGLint *minor)
+EGLBoolean EGLAPIENTRY eglInitialize(EGLDisplay dpy, EGLint *major, EGLint *minor)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLint *major = 0x%0.8p, EGLint *minor = 0x%0.8p)",
           dpy, major, minor);
@@ -282,7 +291,7 @@ EGLBoolean __stdcall eglInitialize(EGLDisplay dpy, EGLint *major, EGLint *minor)
     return EGL_TRUE;
 }
 
-EGLBoolean __stdcall eglTerminate(EGLDisplay dpy)
+EGLBoolean EGLAPIENTRY eglTerminate(EGLDisplay dpy)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p)", dpy);
 
@@ -300,7 +309,7 @@ EGLBoolean __stdcall eglTerminate(EGLDisplay dpy)
     return EGL_TRUE;
 }
 
-const char *__stdcall eglQueryString(EGLDisplay dpy, EGLint name)
+const char *EGLAPIENTRY eglQueryString(EGLDisplay dpy, EGLint name)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLint name = %d)", dpy, name);
 
@@ -334,7 +343,7 @@ const char *__stdcall eglQueryString(EGLDisplay dpy, EGLint name)
     return result;
 }
 
-EGLBoolean __stdcall eglGetConfigs(EGLDisplay dpy, EGLConfig *configs, EGLint config_size, EGLint *num_config)
+EGLBoolean EGLAPIENTRY eglGetConfigs(EGLDisplay dpy, EGLConfig *configs, EGLint config_size, EGLint *num_config)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLConfig *configs = 0x%0.8p, "
           "EGLint config_size = %d, EGLint *num_config = 0x%0.8p)",
@@ -365,7 +374,7 @@ EGLBoolean __stdcall eglGetConfigs(EGLDisplay dpy, EGLConfig *configs, EGLint co
     return EGL_TRUE;
 }
 
-EGLBoolean __stdcall eglChooseConfig(EGLDisplay dpy, const EGLint *attrib_list, EGLConfig *configs, EGLint config_size, EGLint *num_config)
+EGLBoolean EGLAPIENTRY eglChooseConfig(EGLDisplay dpy, const EGLint *attrib_list, EGLConfig *configs, EGLint config_size, EGLint *num_config)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, const EGLint *attrib_list = 0x%0.8p, "
           "EGLConfig *configs = 0x%0.8p, EGLint config_size = %d, EGLint *num_config = 0x%0.8p)",
@@ -397,7 +406,7 @@ EGLBoolean __stdcall eglChooseConfig(EGLDisplay dpy, const EGLint *attrib_list,
     return EGL_TRUE;
 }
 
-EGLBoolean __stdcall eglGetConfigAttrib(EGLDisplay dpy, EGLConfig config, EGLint attribute, EGLint *value)
+EGLBoolean EGLAPIENTRY eglGetConfigAttrib(EGLDisplay dpy, EGLConfig config, EGLint attribute, EGLint *value)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLConfig config = 0x%0.8p, EGLint attribute = %d, EGLint *value = 0x%0.8p)",
           dpy, config, attribute, value);
@@ -419,7 +428,7 @@ EGLBoolean __stdcall eglGetConfigAttrib(EGLDisplay dpy, EGLConfig config, EGLint
     return EGL_TRUE;
 }
 
-EGLSurface __stdcall eglCreateWindowSurface(EGLDisplay dpy, EGLConfig config, EGLNativeWindowType win, const EGLint *attrib_list)
+EGLSurface EGLAPIENTRY eglCreateWindowSurface(EGLDisplay dpy, EGLConfig config, EGLNativeWindowType win, const EGLint *attrib_list)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLConfig config = 0x%0.8p, EGLNativeWindowType win = 0x%0.8p, "
           "const EGLint *attrib_list = 0x%0.8p)", dpy, config, win, attrib_list);
@@ -448,7 +457,7 @@ EGLSurface __stdcall eglCreateWindowSurface(EGLDisplay dpy, EGLConfig config, EG
     return surface;
 }
 
-EGLSurface __stdcall eglCreatePbufferSurface(EGLDisplay dpy, EGLConfig config, const EGLint *attrib_list)
+EGLSurface EGLAPIENTRY eglCreatePbufferSurface(EGLDisplay dpy, EGLConfig config, const EGLint *attrib_list)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLConfig config = 0x%0.8p, const EGLint *attrib_list = 0x%0.8p)",
           dpy, config, attrib_list);
@@ -471,7 +480,7 @@ EGLSurface __stdcall eglCreatePbufferSurface(EGLDisplay dpy, EGLConfig config, c
     return surface;
 }
 
-EGLSurface __stdcall eglCreatePixmapSurface(EGLDisplay dpy, EGLConfig config, EGLNativePixmapType pixmap, const EGLint *attrib_list)
+EGLSurface EGLAPIENTRY eglCreatePixmapSurface(EGLDisplay dpy, EGLConfig config, EGLNativePixmapType pixmap, const EGLint *attrib_list)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLConfig config = 0x%0.8p, EGLNativePixmapType pixmap = 0x%0.8p, "
           "const EGLint *attrib_list = 0x%0.8p)", dpy, config, pixmap, attrib_list);
@@ -489,7 +498,7 @@ EGLSurface __stdcall eglCreatePixmapSurface(EGLDisplay dpy, EGLConfig config, EG
     return EGL_NO_SURFACE;
 }
 
-EGLBoolean __stdcall eglDestroySurface(EGLDisplay dpy, EGLSurface surface)
+EGLBoolean EGLAPIENTRY eglDestroySurface(EGLDisplay dpy, EGLSurface surface)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p)", dpy, surface);
 
@@ -513,7 +522,7 @@ EGLBoolean __stdcall eglDestroySurface(EGLDisplay dpy, EGLSurface surface)
     return EGL_TRUE;
 }
 
-EGLBoolean __stdcall eglQuerySurface(EGLDisplay dpy, EGLSurface surface, EGLint attribute, EGLint *value)
+EGLBoolean EGLAPIENTRY eglQuerySurface(EGLDisplay dpy, EGLSurface surface, EGLint attribute, EGLint *value)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p, EGLint attribute = %d, EGLint *value = 0x%0.8p)",
           dpy, surface, attribute, value);
@@ -597,7 +606,7 @@ EGLBoolean __stdcall eglQuerySurface(EGLDisplay dpy, EGLSurface surface, EGLint
     return EGL_TRUE;
 }
 
-EGLBoolean __stdcall eglQuerySurfacePointerANGLE(EGLDisplay dpy, EGLSurface surface, EGLint attribute, void **value)
+EGLBoolean EGLAPIENTRY eglQuerySurfacePointerANGLE(EGLDisplay dpy, EGLSurface surface, EGLint attribute, void **value)
 {
     TRACE("(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p, EGLint attribute = %d, void **value = 0x%0.8p)",
           dpy, surface, attribute, value);
@@ -633,7 +642,7 @@ EGLBoolean __stdcall eglQuerySurfacePointerANGLE(EGLDisplay dpy, EGLSurface surf
     return EGL_TRUE;
 }
 
-EGLBoolean __stdcall eglBindAPI(EGLenum api)
+EGLBoolean EGLAPIENTRY eglBindAPI(EGLenum api)
 {
     EVENT("(EGLenum api = 0x%X)", api);
 
@@ -656,7 +665,7 @@ EGLBoolean __stdcall eglBindAPI(EGLenum api)
     return EGL_TRUE;
 }
 
-EGLenum __stdcall eglQueryAPI(void)
+EGLenum EGLAPIENTRY eglQueryAPI(void)
 {
     EVENT("()");
 
@@ -666,7 +675,7 @@ EGLenum __stdcall eglQueryAPI(void)
     return API;
 }
 
-EGLBoolean __stdcall eglWaitClient(void)
+EGLBoolean EGLAPIENTRY eglWaitClient(void)
 {
     EVENT("()");
 
@@ -676,7 +685,7 @@ EGLBoolean __stdcall eglWaitClient(void)
     return 0;
 }
 
-EGLBoolean __stdcall eglReleaseThread(void)
+EGLBoolean EGLAPIENTRY eglReleaseThread(void)
 {
     EVENT("()");
 
@@ -686,7 +695,7 @@ EGLBoolean __stdcall eglReleaseThread(void)
     return EGL_TRUE;
 }
 
-EGLSurface __stdcall eglCreatePbufferFromClientBuffer(EGLDisplay dpy, EGLenum buftype, EGLClientBuffer buffer, EGLConfig config, const EGLint *attrib_list)
+EGLSurface EGLAPIENTRY eglCreatePbufferFromClientBuffer(EGLDisplay dpy, EGLenum buftype, EGLClientBuffer buffer, EGLConfig config, const EGLint *attrib_list)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLenum buftype = 0x%X, EGLClientBuffer buffer = 0x%0.8p, "
           "EGLConfig config = 0x%0.8p, const EGLint *attrib_list = 0x%0.8p)",
@@ -716,7 +725,7 @@ EGLSurface __stdcall eglCreatePbufferFromClientBuffer(EGLDisplay dpy, EGLenum bu
     return surface;
 }
 
-EGLBoolean __stdcall eglSurfaceAttrib(EGLDisplay dpy, EGLSurface surface, EGLint attribute, EGLint value)
+EGLBoolean EGLAPIENTRY eglSurfaceAttrib(EGLDisplay dpy, EGLSurface surface, EGLint attribute, EGLint value)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p, EGLint attribute = %d, EGLint value = %d)",
           dpy, surface, attribute, value);
@@ -735,7 +744,7 @@ EGLBoolean __stdcall eglSurfaceAttrib(EGLDisplay dpy, EGLSurface surface, EGLint
     return EGL_TRUE;
 }
 
-EGLBoolean __stdcall eglBindTexImage(EGLDisplay dpy, EGLSurface surface, EGLint buffer)
+EGLBoolean EGLAPIENTRY eglBindTexImage(EGLDisplay dpy, EGLSurface surface, EGLint buffer)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p, EGLint buffer = %d)", dpy, surface, buffer);
 
@@ -781,7 +790,7 @@ EGLBoolean __stdcall eglBindTexImage(EGLDisplay dpy, EGLSurface surface, EGLint
     return EGL_TRUE;
 }
 
-EGLBoolean __stdcall eglReleaseTexImage(EGLDisplay dpy, EGLSurface surface, EGLint buffer)
+EGLBoolean EGLAPIENTRY eglReleaseTexImage(EGLDisplay dpy, EGLSurface surface, EGLint buffer)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p, EGLint buffer = %d)", dpy, surface, buffer);
 
@@ -822,7 +831,7 @@ EGLBoolean __stdcall eglReleaseTexImage(EGLDisplay dpy, EGLSurface surface, EGLi
     return EGL_TRUE;
 }
 
-EGLBoolean __stdcall eglSwapInterval(EGLDisplay dpy, EGLint interval)
+EGLBoolean EGLAPIENTRY eglSwapInterval(EGLDisplay dpy, EGLint interval)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLint interval = %d)", dpy, interval);
 
@@ -847,7 +856,7 @@ EGLBoolean __stdcall eglSwapInterval(EGLDisplay dpy, EGLint interval)
     return EGL_TRUE;
 }
 
-EGLContext __stdcall eglCreateContext(EGLDisplay dpy, EGLConfig config, EGLContext share_context, const EGLint *attrib_list)
+EGLContext EGLAPIENTRY eglCreateContext(EGLDisplay dpy, EGLConfig config, EGLContext share_context, const EGLint *attrib_list)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLConfig config = 0x%0.8p, EGLContext share_context = 0x%0.8p, "
           "const EGLint *attrib_list = 0x%0.8p)", dpy, config, share_context, attrib_list);
@@ -856,6 +865,7 @@ EGLContext __stdcall eglCreateContext(EGLDisplay dpy, EGLConfig config, EGLConte
     EGLint client_version = 1;
     bool reset_notification = false;
     bool robust_access = false;
+    bool no_error = false;
 
     if (attrib_list)
     {
@@ -890,6 +900,17 @@ EGLContext __stdcall eglCreateContext(EGLDisplay dpy, EGLConfig config, EGLConte
                     return EGL_NO_CONTEXT;
                 }
                 break;
+              case EGL_CONTEXT_OPENGL_NO_ERROR_KHR:
+                if (attribute[1] == EGL_TRUE)
+                {
+                    no_error = true;
+                }
+                else if (attribute[1] != EGL_FALSE)
+                {
+                    recordError(egl::Error(EGL_BAD_ATTRIBUTE));
+                    return EGL_NO_CONTEXT;
+                }
+                break;
               default:
                 recordError(egl::Error(EGL_BAD_ATTRIBUTE));
                 return EGL_NO_CONTEXT;
@@ -903,6 +924,14 @@ EGLContext __stdcall eglCreateContext(EGLDisplay dpy, EGLConfig config, EGLConte
         return EGL_NO_CONTEXT;
     }
 
+    // [EGL_KHR_create_context_no_error] A context without errors can not also promise
+    // robust access or notify of resets, which rely on errors being generated.
+    if (no_error && (robust_access || reset_notification))
+    {
+        recordError(egl::Error(EGL_BAD_MATCH));
+        return EGL_NO_CONTEXT;
+    }
+
     egl::Display *display = static_cast<egl::Display*>(dpy);
 
     if (share_context)
@@ -921,6 +950,12 @@ EGLContext __stdcall eglCreateContext(EGLDisplay dpy, EGLConfig config, EGLConte
             return EGL_NO_CONTEXT;
         }
 
+        if (sharedGLContext->skipValidation() != no_error)
+        {
+            recordError(egl::Error(EGL_BAD_MATCH));
+            return EGL_NO_CONTEXT;
+        }
+
         // Can not share contexts between displays
         if (sharedGLContext->getRenderer() != display->getRenderer())
         {
@@ -936,7 +971,7 @@ EGLContext __stdcall eglCreateContext(EGLDisplay dpy, EGLConfig config, EGLConte
 
     EGLContext context = EGL_NO_CONTEXT;
     egl::Error error =  display->createContext(config, client_version, static_cast<gl::Context*>(share_context),
-                                               reset_notification, robust_access, &context);
+                                               reset_notification, robust_access, no_error, &context);
     if (error.isError())
     {
         recordError(error);
@@ -946,7 +981,7 @@ EGLContext __stdcall eglCreateContext(EGLDisplay dpy, EGLConfig config, EGLConte
     return context;
 }
 
-EGLBoolean __stdcall eglDestroyContext(EGLDisplay dpy, EGLContext ctx)
+EGLBoolean EGLAPIENTRY eglDestroyContext(EGLDisplay dpy, EGLContext ctx)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLContext ctx = 0x%0.8p)", dpy, ctx);
 
@@ -970,7 +1005,7 @@ EGLBoolean __stdcall eglDestroyContext(EGLDisplay dpy, EGLContext ctx)
     return EGL_TRUE;
 }
 
-EGLBoolean __stdcall eglMakeCurrent(EGLDisplay dpy, EGLSurface draw, EGLSurface read, EGLContext ctx)
+EGLBoolean EGLAPIENTRY eglMakeCurrent(EGLDisplay dpy, EGLSurface draw, EGLSurface read, EGLContext ctx)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSurface draw = 0x%0.8p, EGLSurface read = 0x%0.8p, EGLContext ctx = 0x%0.8p)",
           dpy, draw, read, ctx);
@@ -1027,7 +1062,7 @@ EGLBoolean __stdcall eglMakeCurrent(EGLDisplay dpy, EGLSurface draw, EGLSurface
     return EGL_TRUE;
 }
 
-EGLContext __stdcall eglGetCurrentContext(void)
+EGLContext EGLAPIENTRY eglGetCurrentContext(void)
 {
     EVENT("()");
 
@@ -1037,7 +1072,7 @@ EGLContext __stdcall eglGetCurrentContext(void)
     return context;
 }
 
-EGLSurface __stdcall eglGetCurrentSurface(EGLint readdraw)
+EGLSurface EGLAPIENTRY eglGetCurrentSurface(EGLint readdraw)
 {
     EVENT("(EGLint readdraw = %d)", readdraw);
 
@@ -1058,7 +1093,7 @@ EGLSurface __stdcall eglGetCurrentSurface(EGLint readdraw)
     }
 }
 
-EGLDisplay __stdcall eglGetCurrentDisplay(void)
+EGLDisplay EGLAPIENTRY eglGetCurrentDisplay(void)
 {
     EVENT("()");
 
@@ -1068,7 +1103,7 @@ EGLDisplay __stdcall eglGetCurrentDisplay(void)
     return dpy;
 }
 
-EGLBoolean __stdcall eglQueryContext(EGLDisplay dpy, EGLContext ctx, EGLint attribute, EGLint *value)
+EGLBoolean EGLAPIENTRY eglQueryContext(EGLDisplay dpy, EGLContext ctx, EGLint attribute, EGLint *value)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLContext ctx = 0x%0.8p, EGLint attribute = %d, EGLint *value = 0x%0.8p)",
           dpy, ctx, attribute, value);
@@ -1087,7 +1122,7 @@ EGLBoolean __stdcall eglQueryContext(EGLDisplay dpy, EGLContext ctx, EGLint attr
     return 0;
 }
 
-EGLBoolean __stdcall eglWaitGL(void)
+EGLBoolean EGLAPIENTRY eglWaitGL(void)
 {
     EVENT("()");
 
@@ -1097,7 +1132,7 @@ EGLBoolean __stdcall eglWaitGL(void)
     return 0;
 }
 
-EGLBoolean __stdcall eglWaitNative(EGLint engine)
+EGLBoolean EGLAPIENTRY eglWaitNative(EGLint engine)
 {
     EVENT("(EGLint engine = %d)", engine);
 
@@ -1107,7 +1142,7 @@ EGLBoolean __stdcall eglWaitNative(EGLint engine)
     return 0;
 }
 
-EGLBoolean __stdcall eglSwapBuffers(EGLDisplay dpy, EGLSurface surface)
+EGLBoolean EGLAPIENTRY eglSwapBuffers(EGLDisplay dpy, EGLSurface surface)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p)", dpy, surface);
 
@@ -1142,7 +1177,7 @@ EGLBoolean __stdcall eglSwapBuffers(EGLDisplay dpy, EGLSurface surface)
     return EGL_TRUE;
 }
 
-EGLBoolean __stdcall eglCopyBuffers(EGLDisplay dpy, EGLSurface surface, EGLNativePixmapType target)
+EGLBoolean EGLAPIENTRY eglCopyBuffers(EGLDisplay dpy, EGLSurface surface, EGLNativePixmapType target)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p, EGLNativePixmapType target = 0x%0.8p)", dpy, surface, target);
 
@@ -1166,7 +1201,7 @@ EGLBoolean __stdcall eglCopyBuffers(EGLDisplay dpy, EGLSurface surface, EGLNativ
     return 0;
 }
 
-EGLBoolean __stdcall eglPostSubBufferNV(EGLDisplay dpy, EGLSurface surface, EGLint x, EGLint y, EGLint width, EGLint height)
+EGLBoolean EGLAPIENTRY eglPostSubBufferNV(EGLDisplay dpy, EGLSurface surface, EGLint x, EGLint y, EGLint width, EGLint height)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p, EGLint x = %d, EGLint y = %d, EGLint width = %d, EGLint height = %d)", dpy, surface, x, y, width, height);
 
@@ -1207,7 +1242,7 @@ EGLBoolean __stdcall eglPostSubBufferNV(EGLDisplay dpy, EGLSurface surface, EGLi
     return EGL_TRUE;
 }
 
-__eglMustCastToProperFunctionPointerType __stdcall eglGetProcAddress(const char *procname)
+__eglMustCastToProperFunctionPointerType EGLAPIENTRY eglGetProcAddress(const char *procname)
 {
     EVENT("(const char *procname = \"%s\")", procname);
 
@@ -11,15 +11,15 @@
 #include "common/debug.h"
 #include "common/tls.h"
 
-static TLSIndex currentTLS = TLS_OUT_OF_INDEXES;
+static TLSIndex currentTLS = TLS_INVALID_INDEX;
 
 namespace egl
 {
 
 Current *AllocateCurrent()
 {
-    ASSERT(currentTLS != TLS_OUT_OF_INDEXES);
-    if (currentTLS == TLS_OUT_OF_INDEXES)
+    ASSERT(currentTLS != TLS_INVALID_INDEX);
+    if (currentTLS == TLS_INVALID_INDEX)
     {
         return NULL;
     }
@@ -49,6 +49,7 @@ void DeallocateCurrent()
 
 }
 
+#ifdef ANGLE_PLATFORM_WINDOWS
 extern "C" BOOL WINAPI DllMain(HINSTANCE instance, DWORD reason, LPVOID reserved)
 {
     switch (reason)
@@ -71,7 +72,7 @@ extern "C" BOOL WINAPI DllMain(HINSTANCE instance, DWORD reason, LPVOID reserved
 #endif
 
             currentTLS = CreateTLSIndex();
-            if (currentTLS == TLS_OUT_OF_INDEXES)
+            if (currentTLS == TLS_INVALID_INDEX)
             {
                 return FALSE;
             }
@@ -107,6 +108,23 @@ extern "C" BOOL WINAPI DllMain(HINSTANCE instance, DWORD reason, LPVOID reserved
 
     return TRUE;
 }
+#elif defined(ANGLE_PLATFORM_POSIX)
+// Without DllMain, the index is created when the library is loaded and the thread data
+// is allocated lazily by GetCurrentData.
+__attribute__((constructor)) static void InitializeLibrary()
+{
+    currentTLS = CreateTLSIndex();
+}
+
+__attribute__((destructor)) static void UninitializeLibrary()
+{
+    if (currentTLS != TLS_INVALID_INDEX)
+    {
+        egl::DeallocateCurrent();
+        DestroyTLSIndex(currentTLS);
+    }
+}
+#endif
 
 namespace egl
 {
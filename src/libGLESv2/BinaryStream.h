@@ -20,6 +20,31 @@
 namespace gl
 {
 
+// Characters inside the buffer of the stream they were read from, without a copy. Only valid
+// as long as that buffer is.
+struct BinaryStringView
+{
+    BinaryStringView()
+        : data(NULL),
+          length(0)
+    {
+    }
+
+    BinaryStringView(const char *data, size_t length)
+        : data(data),
+          length(length)
+    {
+    }
+
+    std::string str() const
+    {
+        return std::string(data, length);
+    }
+
+    const char *data;
+    size_t length;
+};
+
 class BinaryInputStream
 {
   public:
@@ -80,7 +105,7 @@ class BinaryInputStream
             return;
         }
 
-        if (mOffset + length > mLength)
+        if (length > mLength - mOffset)
         {
             mError = true;
             return;
@@ -90,9 +115,66 @@ class BinaryInputStream
         mOffset += length;
     }
 
+    void readStringView(BinaryStringView *v)
+    {
+        size_t length;
+        readInt(&length);
+
+        readCharacters(length, v);
+    }
+
+    // Points |v| at the next |length| characters, which were written without a length
+    void readCharacters(size_t length, BinaryStringView *v)
+    {
+        if (mError || length > mLength - mOffset)
+        {
+            mError = true;
+            return;
+        }
+
+        *v = BinaryStringView(reinterpret_cast<const char *>(mData) + mOffset, length);
+        mOffset += length;
+    }
+
+    // Reads |count| plain structs written by BinaryOutputStream::writeArray, with a single
+    // bounds check for all of them
+    template <typename T>
+    void readArray(T *values, size_t count)
+    {
+        META_ASSERT(std::is_pod<T>::value);
+
+        if (count > (mLength - mOffset) / sizeof(T))
+        {
+            mError = true;
+            return;
+        }
+
+        memcpy(values, mData + mOffset, count * sizeof(T));
+        mOffset += count * sizeof(T);
+    }
+
+    template <typename T>
+    void readArray(std::vector<T> *values)
+    {
+        size_t count;
+        readInt(&count);
+
+        if (mError || count > (mLength - mOffset) / sizeof(T))
+        {
+            mError = true;
+            return;
+        }
+
+        values->resize(count);
+        if (count > 0)
+        {
+            readArray(&(*values)[0], count);
+        }
+    }
+
     void skip(size_t length)
     {
-        if (mOffset + length > mLength)
+        if (length > mLength - mOffset)
         {
             mError = true;
             return;
@@ -101,6 +183,12 @@ class BinaryInputStream
         mOffset += length;
     }
 
+    // Skips the padding BinaryOutputStream::align wrote
+    void align(size_t alignment)
+    {
+        skip(rx::roundUp(mOffset, alignment) - mOffset);
+    }
+
     size_t offset() const
     {
         return mOffset;
@@ -133,14 +221,13 @@ class BinaryInputStream
     {
         META_ASSERT(std::is_fundamental<T>::value);
 
-        size_t length = num * sizeof(T);
-
-        if (mOffset + length > mLength)
+        if (num > (mLength - mOffset) / sizeof(T))
         {
             mError = true;
             return;
         }
 
+        size_t length = num * sizeof(T);
         memcpy(v, mData + mOffset, length);
         mOffset += length;
     }
@@ -180,6 +267,37 @@ class BinaryOutputStream
         write(bytes, count);
     }
 
+    // Writes characters without their length, for readers that know it from elsewhere
+    void writeCharacters(const std::string &v)
+    {
+        write(v.c_str(), v.length());
+    }
+
+    // Copies plain structs as they are in memory, so they can only be read by the same build
+    template <typename T>
+    void writeArray(const T *values, size_t count)
+    {
+        META_ASSERT(std::is_pod<T>::value);
+        const char *asBytes = reinterpret_cast<const char*>(values);
+        mData.insert(mData.end(), asBytes, asBytes + count * sizeof(T));
+    }
+
+    template <typename T>
+    void writeArray(const std::vector<T> &values)
+    {
+        writeInt(values.size());
+        if (!values.empty())
+        {
+            writeArray(&values[0], values.size());
+        }
+    }
+
+    // Pads with zeros up to a multiple of |alignment|
+    void align(size_t alignment)
+    {
+        mData.resize(rx::roundUp(mData.size(), alignment), 0);
+    }
+
     size_t length() const
     {
         return mData.size();
@@ -203,6 +321,184 @@ class BinaryOutputStream
     }
 
 };
+
+// A binary made of sections, found through a table at its start:
+//   magic, layout version, section count
+//   id, offset and length of each section
+//   the sections, each starting on a multiple of BinarySectionAlignment
+// The layout version belongs to the writer and changes whenever what it puts in a section does.
+const uint32_t BinarySectionMagic = 0x42474E41;   // "ANGB"
+const size_t BinarySectionAlignment = 16;
+
+class BinarySectionWriter
+{
+  public:
+    explicit BinarySectionWriter(uint32_t layoutVersion)
+        : mLayoutVersion(layoutVersion)
+    {
+    }
+
+    ~BinarySectionWriter()
+    {
+        for (size_t i = 0; i < mSections.size(); i++)
+        {
+            SafeDelete(mSections[i].stream);
+        }
+    }
+
+    // The returned stream belongs to the writer. Sections are written in the order they are added.
+    BinaryOutputStream *addSection(uint32_t id)
+    {
+        Section section = { id, new BinaryOutputStream() };
+        mSections.push_back(section);
+        return section.stream;
+    }
+
+    // Section offsets are from the start of |stream|, which has to be empty
+    void write(BinaryOutputStream *stream) const
+    {
+        ASSERT(stream->length() == 0);
+
+        std::vector<uint32_t> table;
+        table.push_back(BinarySectionMagic);
+        table.push_back(mLayoutVersion);
+        table.push_back(static_cast<uint32_t>(mSections.size()));
+
+        size_t offset = sizeof(uint32_t) * (table.size() + 3 * mSections.size());
+        for (size_t i = 0; i < mSections.size(); i++)
+        {
+            offset = rx::roundUp(offset, BinarySectionAlignment);
+            table.push_back(mSections[i].id);
+            table.push_back(static_cast<uint32_t>(offset));
+            table.push_back(static_cast<uint32_t>(mSections[i].stream->length()));
+            offset += mSections[i].stream->length();
+        }
+
+        stream->writeArray(&table[0], table.size());
+
+        for (size_t i = 0; i < mSections.size(); i++)
+        {
+            stream->align(BinarySectionAlignment);
+            stream->writeBytes(static_cast<const unsigned char*>(mSections[i].stream->data()), mSections[i].stream->length());
+        }
+    }
+
+  private:
+    DISALLOW_COPY_AND_ASSIGN(BinarySectionWriter);
+
+    struct Section
+    {
+        uint32_t id;
+        BinaryOutputStream *stream;
+    };
+
+    const uint32_t mLayoutVersion;
+    std::vector<Section> mSections;
+};
+
+// Checks every entry of the section table against the length of the binary when it is created,
+// so the sections can be read with streams that only check bounds within themselves. The sections
+// point into |data|, which has to outlive the reader and whatever is read from it.
+class BinarySectionReader
+{
+  public:
+    BinarySectionReader(const void *data, size_t length)
+        : mValid(false),
+          mLayoutVersion(0),
+          mData(static_cast<const uint8_t*>(data))
+    {
+        if (!IsSectioned(data, length))
+        {
+            return;
+        }
+
+        BinaryInputStream stream(data, length);
+        uint32_t header[3];
+        stream.readArray(header, 3);
+
+        uint32_t sectionCount = header[2];
+        if (sectionCount > (length - stream.offset()) / (3 * sizeof(uint32_t)))
+        {
+            return;
+        }
+
+        mSections.resize(sectionCount);
+        if (sectionCount > 0)
+        {
+            stream.readArray(&mSections[0], sectionCount);
+        }
+
+        for (size_t i = 0; i < mSections.size(); i++)
+        {
+            const Section &section = mSections[i];
+            if (section.offset % BinarySectionAlignment != 0 || section.offset < stream.offset() ||
+                section.offset > length || section.length > length - section.offset)
+            {
+                mSections.clear();
+                return;
+            }
+        }
+
+        mLayoutVersion = header[1];
+        mValid = true;
+    }
+
+    // Whether the data starts like a sectioned binary, to tell it from other layouts
+    static bool IsSectioned(const void *data, size_t length)
+    {
+        uint32_t magic = 0;
+        if (length < sizeof(uint32_t) * 3)
+        {
+            return false;
+        }
+
+        memcpy(&magic, data, sizeof(uint32_t));
+        return (magic == BinarySectionMagic);
+    }
+
+    // False when the data is not a sectioned binary, or its table points outside of it
+    bool valid() const
+    {
+        return mValid;
+    }
+
+    uint32_t layoutVersion() const
+    {
+        return mLayoutVersion;
+    }
+
+    // Returns false when there is no section |id|
+    bool getSection(uint32_t id, const uint8_t **dataOut, size_t *lengthOut) const
+    {
+        for (size_t i = 0; i < mSections.size(); i++)
+        {
+            if (mSections[i].id == id)
+            {
+                *dataOut = mData + mSections[i].offset;
+                *lengthOut = mSections[i].length;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+  private:
+    DISALLOW_COPY_AND_ASSIGN(BinarySectionReader);
+
+    struct Section
+    {
+        uint32_t id;
+        uint32_t offset;
+        uint32_t length;
+    };
+
+    bool mValid;
+    uint32_t mLayoutVersion;
+    std::vector<Section> mSections;
+    const uint8_t *mData;
+};
+
 }
 
 #endif  // LIBGLESV2_BINARYSTREAM_H_
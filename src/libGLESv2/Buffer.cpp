@@ -15,6 +15,8 @@
 namespace gl
 {
 
+unsigned int Buffer::mCurrentSizeSerial = 1;
+
 Buffer::Buffer(rx::BufferImpl *impl, GLuint id)
     : RefCountObject(id),
       mBuffer(impl),
@@ -41,6 +43,11 @@ Error Buffer::bufferData(const void *data, GLsizeiptr size, GLenum usage)
         return error;
     }
 
+    if (size != mSize)
+    {
+        mCurrentSizeSerial++;
+    }
+
     mIndexRangeCache.clear();
     mUsage = usage;
     mSize = size;
@@ -54,6 +54,10 @@ class Buffer : public RefCountObject
     rx::IndexRangeCache *getIndexRangeCache() { return &mIndexRangeCache; }
     const rx::IndexRangeCache *getIndexRangeCache() const { return &mIndexRangeCache; }
 
+    // Changes whenever any buffer is resized, so that results derived from buffer sizes
+    // can be kept until one of them may be out of date.
+    static unsigned int getCurrentSizeSerial() { return mCurrentSizeSerial; }
+
   private:
     DISALLOW_COPY_AND_ASSIGN(Buffer);
 
@@ -68,6 +72,8 @@ class Buffer : public RefCountObject
     GLint64 mMapLength;
 
     rx::IndexRangeCache mIndexRangeCache;
+
+    static unsigned int mCurrentSizeSerial;
 };
 
 }
@@ -36,7 +36,10 @@ enum
     IMPLEMENTATION_MAX_3D_TEXTURE_SIZE = 2048,
     IMPLEMENTATION_MAX_2D_ARRAY_TEXTURE_LAYERS = 2048,
 
-    IMPLEMENTATION_MAX_TEXTURE_LEVELS = 15   // 1+log2 of MAX_TEXTURE_SIZE
+    IMPLEMENTATION_MAX_TEXTURE_LEVELS = 15,   // 1+log2 of MAX_TEXTURE_SIZE
+
+    // Bytes of linked program binaries each context keeps in memory
+    IMPLEMENTATION_PROGRAM_CACHE_SIZE = 8 * 1024 * 1024
 };
 
 }
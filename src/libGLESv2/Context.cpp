@@ -20,6 +20,7 @@
 #include "libGLESv2/Renderbuffer.h"
 #include "libGLESv2/Program.h"
 #include "libGLESv2/ProgramBinary.h"
+#include "libGLESv2/ProgramCache.h"
 #include "libGLESv2/Query.h"
 #include "libGLESv2/Texture.h"
 #include "libGLESv2/ResourceManager.h"
@@ -38,7 +39,8 @@
 namespace gl
 {
 
-Context::Context(int clientVersion, const gl::Context *shareContext, rx::Renderer *renderer, bool notifyResets, bool robustAccess)
+Context::Context(int clientVersion, const gl::Context *shareContext, rx::Renderer *renderer, bool notifyResets, bool robustAccess,
+                 bool noError)
     : mRenderer(renderer)
 {
     ASSERT(robustAccess == false);   // Unimplemented
@@ -60,6 +62,8 @@ Context::Context(int clientVersion, const gl::Context *shareContext, rx::Rendere
         mResourceManager = new ResourceManager(mRenderer);
     }
 
+    mProgramCache = new ProgramCache(new MemoryProgramCacheStore(IMPLEMENTATION_PROGRAM_CACHE_SIZE));
+
     // [OpenGL ES 2.0.24] section 3.7 page 83:
     // In the initial state, TEXTURE_2D and TEXTURE_CUBE_MAP have twodimensional
     // and cube map texture state vectors respectively associated with them.
@@ -119,6 +123,20 @@ Context::Context(int clientVersion, const gl::Context *shareContext, rx::Rendere
     mResetStatus = GL_NO_ERROR;
     mResetStrategy = (notifyResets ? GL_LOSE_CONTEXT_ON_RESET_EXT : GL_NO_RESET_NOTIFICATION_EXT);
     mRobustAccess = robustAccess;
+    mSkipValidation = noError;
+
+    mAppliedStateSerial = mRenderer->getAppliedStateSerial();
+    mAppliedTextureChangeSerial = Texture::getCurrentChangeSerial();
+    mAppliedTextures.resize(mCaps.maxCombinedTextureImageUnits);
+    mSwizzledFramebufferSerialCount = 0;
+    mAppliedSamplerMappingSerial = 0;
+    mAppliedDrawMode = GL_TRIANGLES;
+    mAppliedIgnoreViewport = false;
+    mAppliedSamples = -1;
+
+    mValidatedSamplersProgramSerial = 0;
+    mValidatedSamplerMappingSerial = 0;
+    mValidatedSamplersResult = false;
 }
 
 Context::~Context()
@@ -174,6 +192,8 @@ Context::~Context()
     mZeroTextures.clear();
 
     mResourceManager->release();
+
+    SafeDelete(mProgramCache);
 }
 
 void Context::makeCurrent(egl::Surface *surface)
@@ -200,6 +220,9 @@ void Context::makeCurrent(egl::Surface *surface)
 
     // Store the current client version in the renderer
     mRenderer->setCurrentClientVersion(mClientVersion);
+
+    // The renderer may have been applying the state of another context since this one was current
+    mState.setDirtyBits(State::DIRTY_BIT_ALL);
 }
 
 // NOTE: this function should not assume that this context is current!
@@ -255,7 +278,7 @@ GLuint Context::createVertexArray()
     // we create it immediately. The resulting behaviour is transparent to the application,
     // since it's not currently possible to access the state until the object is bound.
     VertexArray *vertexArray = new VertexArray(mRenderer->createVertexArray(), handle, MAX_VERTEX_ATTRIBS);
-    mVertexArrayMap[handle] = vertexArray;
+    mVertexArrayMap.assign(handle, vertexArray);
     return handle;
 }
 
@@ -269,7 +292,7 @@ GLuint Context::createTransformFeedback()
     GLuint handle = mTransformFeedbackAllocator.allocate();
     TransformFeedback *transformFeedback = new TransformFeedback(mRenderer->createTransformFeedback(), handle);
     transformFeedback->addRef();
-    mTransformFeedbackMap[handle] = transformFeedback;
+    mTransformFeedbackMap.assign(handle, transformFeedback);
     return handle;
 }
 
@@ -278,7 +301,7 @@ GLuint Context::createFramebuffer()
 {
     GLuint handle = mFramebufferHandleAllocator.allocate();
 
-    mFramebufferMap[handle] = NULL;
+    mFramebufferMap.assign(handle, NULL);
 
     return handle;
 }
@@ -287,7 +310,7 @@ GLuint Context::createFenceNV()
 {
     GLuint handle = mFenceNVHandleAllocator.allocate();
 
-    mFenceNVMap[handle] = new FenceNV(mRenderer->createFenceNV());
+    mFenceNVMap.assign(handle, new FenceNV(mRenderer->createFenceNV()));
 
     return handle;
 }
@@ -297,7 +320,7 @@ GLuint Context::createQuery()
 {
     GLuint handle = mQueryHandleAllocator.allocate();
 
-    mQueryMap[handle] = NULL;
+    mQueryMap.assign(handle, NULL);
 
     return handle;
 }
@@ -353,15 +376,14 @@ void Context::deleteFenceSync(GLsync fenceSync)
 
 void Context::deleteVertexArray(GLuint vertexArray)
 {
-    auto vertexArrayObject = mVertexArrayMap.find(vertexArray);
-
-    if (vertexArrayObject != mVertexArrayMap.end())
+    if (mVertexArrayMap.contains(vertexArray))
     {
         detachVertexArray(vertexArray);
 
-        mVertexArrayHandleAllocator.release(vertexArrayObject->first);
-        delete vertexArrayObject->second;
-        mVertexArrayMap.erase(vertexArrayObject);
+        VertexArray *vertexArrayObject = NULL;
+        mVertexArrayMap.erase(vertexArray, &vertexArrayObject);
+        mVertexArrayHandleAllocator.release(vertexArray);
+        delete vertexArrayObject;
     }
 }
 
@@ -377,53 +399,51 @@ void Context::deleteSampler(GLuint sampler)
 
 void Context::deleteTransformFeedback(GLuint transformFeedback)
 {
-    TransformFeedbackMap::const_iterator iter = mTransformFeedbackMap.find(transformFeedback);
-    if (iter != mTransformFeedbackMap.end())
+    if (mTransformFeedbackMap.contains(transformFeedback))
     {
         detachTransformFeedback(transformFeedback);
+
+        TransformFeedback *transformFeedbackObject = NULL;
+        mTransformFeedbackMap.erase(transformFeedback, &transformFeedbackObject);
         mTransformFeedbackAllocator.release(transformFeedback);
-        iter->second->release();
-        mTransformFeedbackMap.erase(iter);
+        transformFeedbackObject->release();
     }
 }
 
 void Context::deleteFramebuffer(GLuint framebuffer)
 {
-    FramebufferMap::iterator framebufferObject = mFramebufferMap.find(framebuffer);
-
-    if (framebufferObject != mFramebufferMap.end())
+    if (mFramebufferMap.contains(framebuffer))
     {
         detachFramebuffer(framebuffer);
 
-        mFramebufferHandleAllocator.release(framebufferObject->first);
-        delete framebufferObject->second;
-        mFramebufferMap.erase(framebufferObject);
+        Framebuffer *framebufferObject = NULL;
+        mFramebufferMap.erase(framebuffer, &framebufferObject);
+        mFramebufferHandleAllocator.release(framebuffer);
+        delete framebufferObject;
     }
 }
 
 void Context::deleteFenceNV(GLuint fence)
 {
-    FenceNVMap::iterator fenceObject = mFenceNVMap.find(fence);
+    FenceNV *fenceObject = NULL;
 
-    if (fenceObject != mFenceNVMap.end())
+    if (mFenceNVMap.erase(fence, &fenceObject))
     {
-        mFenceNVHandleAllocator.release(fenceObject->first);
-        delete fenceObject->second;
-        mFenceNVMap.erase(fenceObject);
+        mFenceNVHandleAllocator.release(fence);
+        delete fenceObject;
     }
 }
 
 void Context::deleteQuery(GLuint query)
 {
-    QueryMap::iterator queryObject = mQueryMap.find(query);
-    if (queryObject != mQueryMap.end())
+    Query *queryObject = NULL;
+    if (mQueryMap.erase(query, &queryObject))
     {
-        mQueryHandleAllocator.release(queryObject->first);
-        if (queryObject->second)
+        mQueryHandleAllocator.release(query);
+        if (queryObject)
         {
-            queryObject->second->release();
+            queryObject->release();
         }
-        mQueryMap.erase(queryObject);
     }
 }
 
@@ -459,16 +479,7 @@ FenceSync *Context::getFenceSync(GLsync handle) const
 
 VertexArray *Context::getVertexArray(GLuint handle) const
 {
-    auto vertexArray = mVertexArrayMap.find(handle);
-
-    if (vertexArray == mVertexArrayMap.end())
-    {
-        return NULL;
-    }
-    else
-    {
-        return vertexArray->second;
-    }
+    return mVertexArrayMap.query(handle);
 }
 
 Sampler *Context::getSampler(GLuint handle) const
@@ -484,8 +495,7 @@ TransformFeedback *Context::getTransformFeedback(GLuint handle) const
     }
     else
     {
-        TransformFeedbackMap::const_iterator iter = mTransformFeedbackMap.find(handle);
-        return (iter != mTransformFeedbackMap.end()) ? iter->second : NULL;
+        return mTransformFeedbackMap.query(handle);
     }
 }
 
@@ -519,7 +529,7 @@ void Context::bindReadFramebuffer(GLuint framebuffer)
 {
     if (!getFramebuffer(framebuffer))
     {
-        mFramebufferMap[framebuffer] = new Framebuffer(mRenderer, framebuffer);
+        mFramebufferMap.assign(framebuffer, new Framebuffer(mRenderer, framebuffer));
     }
 
     mState.setReadFramebufferBinding(getFramebuffer(framebuffer));
@@ -529,7 +539,7 @@ void Context::bindDrawFramebuffer(GLuint framebuffer)
 {
     if (!getFramebuffer(framebuffer))
     {
-        mFramebufferMap[framebuffer] = new Framebuffer(mRenderer, framebuffer);
+        mFramebufferMap.assign(framebuffer, new Framebuffer(mRenderer, framebuffer));
     }
 
     mState.setDrawFramebufferBinding(getFramebuffer(framebuffer));
@@ -547,7 +557,7 @@ void Context::bindVertexArray(GLuint vertexArray)
     if (!getVertexArray(vertexArray))
     {
         VertexArray *vertexArrayObject = new VertexArray(mRenderer->createVertexArray(), vertexArray, MAX_VERTEX_ATTRIBS);
-        mVertexArrayMap[vertexArray] = vertexArrayObject;
+        mVertexArrayMap.assign(vertexArray, vertexArrayObject);
     }
 
     mState.setVertexArrayBinding(getVertexArray(vertexArray));
@@ -637,7 +647,7 @@ Error Context::linkProgram(GLuint program)
 {
     Program *programObject = mResourceManager->getProgram(program);
 
-    Error error = programObject->link(getCaps());
+    Error error = programObject->link(getCaps(), mProgramCache);
     if (error.isError())
     {
         return error;
@@ -653,6 +663,12 @@ Error Context::linkProgram(GLuint program)
     return Error(GL_NO_ERROR);
 }
 
+void Context::setProgramCacheStore(ProgramCacheStore *store)
+{
+    SafeDelete(mProgramCache);
+    mProgramCache = new ProgramCache(store);
+}
+
 Error Context::setProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLint length)
 {
     Program *programObject = mResourceManager->getProgram(program);
@@ -724,8 +740,8 @@ void Context::setFramebufferZero(Framebuffer *buffer)
 		mState.setReadFramebufferBinding(buffer);
 	}
 
-    delete mFramebufferMap[0];
-    mFramebufferMap[0] = buffer;
+    delete mFramebufferMap.query(0);
+    mFramebufferMap.assign(0, buffer);
 }
 
 void Context::setRenderbufferStorage(GLsizei width, GLsizei height, GLenum internalformat, GLsizei samples)
@@ -757,49 +773,26 @@ void Context::setRenderbufferStorage(GLsizei width, GLsizei height, GLenum inter
 
 Framebuffer *Context::getFramebuffer(unsigned int handle) const
 {
-    FramebufferMap::const_iterator framebuffer = mFramebufferMap.find(handle);
-
-    if (framebuffer == mFramebufferMap.end())
-    {
-        return NULL;
-    }
-    else
-    {
-        return framebuffer->second;
-    }
+    return mFramebufferMap.query(handle);
 }
 
 FenceNV *Context::getFenceNV(unsigned int handle)
 {
-    FenceNVMap::iterator fence = mFenceNVMap.find(handle);
-
-    if (fence == mFenceNVMap.end())
-    {
-        return NULL;
-    }
-    else
-    {
-        return fence->second;
-    }
+    return mFenceNVMap.query(handle);
 }
 
 Query *Context::getQuery(unsigned int handle, bool create, GLenum type)
 {
-    QueryMap::iterator query = mQueryMap.find(handle);
+    Query *query = mQueryMap.query(handle);
 
-    if (query == mQueryMap.end())
+    if (!query && create && mQueryMap.contains(handle))
     {
-        return NULL;
-    }
-    else
-    {
-        if (!query->second && create)
-        {
-            query->second = new Query(mRenderer->createQuery(type), handle);
-            query->second->addRef();
-        }
-        return query->second;
+        query = new Query(mRenderer->createQuery(type), handle);
+        query->addRef();
+        mQueryMap.assign(handle, query);
     }
+
+    return query;
 }
 
 Texture *Context::getTargetTexture(GLenum target) const
@@ -1313,6 +1306,45 @@ bool Context::getIndexedQueryParameterInfo(GLenum target, GLenum *type, unsigned
     return false;
 }
 
+// Folds the changes made outside of State into its dirty bits
+void Context::syncDirtyBits()
+{
+    // The renderer forgets what it applied when it draws on its own for blits and clears, and
+    // forces state to be set again when the render targets change
+    unsigned int appliedStateSerial = mRenderer->getAppliedStateSerial();
+    if (appliedStateSerial != mAppliedStateSerial)
+    {
+        mState.setDirtyBits(State::DIRTY_BIT_ALL);
+        mAppliedStateSerial = appliedStateSerial;
+    }
+
+    // Texture objects are changed directly, and may be bound to any unit. Only the units whose
+    // applied texture has changed since are set again.
+    unsigned int textureChangeSerial = Texture::getCurrentChangeSerial();
+    if (textureChangeSerial != mAppliedTextureChangeSerial)
+    {
+        for (unsigned int textureUnit = 0; textureUnit < mAppliedTextures.size(); textureUnit++)
+        {
+            const AppliedTexture &appliedTexture = mAppliedTextures[textureUnit];
+            if (appliedTexture.type != GL_NONE &&
+                getSamplerTexture(textureUnit, appliedTexture.type)->getChangeSerial() != appliedTexture.changeSerial)
+            {
+                mState.setTextureUnitDirty(textureUnit);
+            }
+        }
+
+        mAppliedTextureChangeSerial = textureChangeSerial;
+    }
+
+    // Sampler uniforms remap the samplers of the program to other units
+    const ProgramBinary *programBinary = mState.getCurrentProgramBinary();
+    if (programBinary && programBinary->getSamplerMappingSerial() != mAppliedSamplerMappingSerial)
+    {
+        mState.setDirtyBits(State::DIRTY_BIT_PROGRAM_BINDING);
+        mAppliedSamplerMappingSerial = programBinary->getSamplerMappingSerial();
+    }
+}
+
 // Applies the render target surface, depth stencil surface, viewport rectangle and
 // scissor rectangle to the renderer
 Error Context::applyRenderTarget(GLenum drawMode, bool ignoreViewport)
@@ -1320,18 +1352,49 @@ Error Context::applyRenderTarget(GLenum drawMode, bool ignoreViewport)
     Framebuffer *framebufferObject = mState.getDrawFramebuffer();
     ASSERT(framebufferObject && framebufferObject->completeness() == GL_FRAMEBUFFER_COMPLETE);
 
+    // The attachments of the framebuffer can change without it being rebound, so the render
+    // targets are always applied and the renderer reports when they changed
     gl::Error error = mRenderer->applyRenderTarget(framebufferObject);
     if (error.isError())
     {
         return error;
     }
 
-    float nearZ, farZ;
-    mState.getDepthRange(&nearZ, &farZ);
-    mRenderer->setViewport(mState.getViewport(), nearZ, farZ, drawMode, mState.getRasterizerState().frontFace,
-                           ignoreViewport);
+    syncDirtyBits();
 
-    mRenderer->setScissorRectangle(mState.getScissor(), mState.isScissorTestEnabled());
+    if (mState.getDirtyBits() & State::DIRTY_BIT_DRAW_FRAMEBUFFER_BINDING)
+    {
+        // The sample count, draw buffers and feedback loops with bound textures all come from the framebuffer
+        mState.setDirtyBits(State::DIRTY_BIT_RASTERIZER_STATE | State::DIRTY_BIT_BLEND_STATE | State::DIRTY_BIT_TEXTURE_BINDINGS);
+        mState.clearDirtyBits(State::DIRTY_BIT_DRAW_FRAMEBUFFER_BINDING);
+    }
+
+    if (drawMode != mAppliedDrawMode || ignoreViewport != mAppliedIgnoreViewport)
+    {
+        mState.setDirtyBits(State::DIRTY_BIT_VIEWPORT);
+        if ((drawMode == GL_POINTS) != (mAppliedDrawMode == GL_POINTS))
+        {
+            mState.setDirtyBits(State::DIRTY_BIT_RASTERIZER_STATE);
+        }
+
+        mAppliedDrawMode = drawMode;
+        mAppliedIgnoreViewport = ignoreViewport;
+    }
+
+    if (mState.getDirtyBits() & State::DIRTY_BIT_VIEWPORT)
+    {
+        float nearZ, farZ;
+        mState.getDepthRange(&nearZ, &farZ);
+        mRenderer->setViewport(mState.getViewport(), nearZ, farZ, drawMode, mState.getRasterizerState().frontFace,
+                               ignoreViewport);
+        mState.clearDirtyBits(State::DIRTY_BIT_VIEWPORT);
+    }
+
+    if (mState.getDirtyBits() & State::DIRTY_BIT_SCISSOR)
+    {
+        mRenderer->setScissorRectangle(mState.getScissor(), mState.isScissorTestEnabled());
+        mState.clearDirtyBits(State::DIRTY_BIT_SCISSOR);
+    }
 
     return gl::Error(GL_NO_ERROR);
 }
@@ -1339,20 +1402,64 @@ Error Context::applyRenderTarget(GLenum drawMode, bool ignoreViewport)
 // Applies the fixed-function state (culling, depth test, alpha blending, stenciling, etc) to the Direct3D 9 device
 Error Context::applyState(GLenum drawMode)
 {
+    // Setting the scissor rectangle can force the rasterizer state to be set again
+    syncDirtyBits();
+
     Framebuffer *framebufferObject = mState.getDrawFramebuffer();
     int samples = framebufferObject->getSamples();
+    if (samples != mAppliedSamples)
+    {
+        // Renderbuffers can be reallocated with another sample count while they stay attached
+        mState.setDirtyBits(State::DIRTY_BIT_RASTERIZER_STATE | State::DIRTY_BIT_BLEND_STATE);
+        mAppliedSamples = samples;
+    }
 
-    RasterizerState rasterizer = mState.getRasterizerState();
-    rasterizer.pointDrawMode = (drawMode == GL_POINTS);
-    rasterizer.multiSample = (samples != 0);
-    rasterizer.reverseCullMode = mRenderer->isCurrentlyRenderingToBackBuffer();
+    unsigned int dirtyBits = mState.getDirtyBits();
 
-    Error error = mRenderer->setRasterizerState(rasterizer);
-    if (error.isError())
+    if (dirtyBits & State::DIRTY_BIT_RASTERIZER_STATE)
     {
-        return error;
+        RasterizerState rasterizer = mState.getRasterizerState();
+        rasterizer.pointDrawMode = (drawMode == GL_POINTS);
+        rasterizer.multiSample = (samples != 0);
+        rasterizer.reverseCullMode = mRenderer->isCurrentlyRenderingToBackBuffer();
+
+        Error error = mRenderer->setRasterizerState(rasterizer);
+        if (error.isError())
+        {
+            return error;
+        }
+
+        mState.clearDirtyBits(State::DIRTY_BIT_RASTERIZER_STATE);
     }
 
+    if (dirtyBits & State::DIRTY_BIT_BLEND_STATE)
+    {
+        Error error = applyBlendState(framebufferObject, samples);
+        if (error.isError())
+        {
+            return error;
+        }
+
+        mState.clearDirtyBits(State::DIRTY_BIT_BLEND_STATE);
+    }
+
+    if (dirtyBits & State::DIRTY_BIT_DEPTH_STENCIL_STATE)
+    {
+        Error error = mRenderer->setDepthStencilState(mState.getDepthStencilState(), mState.getStencilRef(), mState.getStencilBackRef(),
+                                                      mState.getRasterizerState().frontFace == GL_CCW);
+        if (error.isError())
+        {
+            return error;
+        }
+
+        mState.clearDirtyBits(State::DIRTY_BIT_DEPTH_STENCIL_STATE);
+    }
+
+    return Error(GL_NO_ERROR);
+}
+
+Error Context::applyBlendState(Framebuffer *framebufferObject, int samples)
+{
     unsigned int mask = 0;
     if (mState.isSampleCoverageEnabled())
     {
@@ -1384,20 +1491,8 @@ Error Context::applyState(GLenum drawMode)
     {
         mask = 0xFFFFFFFF;
     }
-    error = mRenderer->setBlendState(framebufferObject, mState.getBlendState(), mState.getBlendColor(), mask);
-    if (error.isError())
-    {
-        return error;
-    }
 
-    error = mRenderer->setDepthStencilState(mState.getDepthStencilState(), mState.getStencilRef(), mState.getStencilBackRef(),
-                                            rasterizer.frontFace == GL_CCW);
-    if (error.isError())
-    {
-        return error;
-    }
-
-    return Error(GL_NO_ERROR);
+    return mRenderer->setBlendState(framebufferObject, mState.getBlendState(), mState.getBlendColor(), mask);
 }
 
 // Applies the shaders and shader constants to the Direct3D 9 device
@@ -1417,7 +1512,7 @@ Error Context::applyShaders(ProgramBinary *programBinary, bool transformFeedback
     return programBinary->applyUniforms();
 }
 
-Error Context::generateSwizzles(ProgramBinary *programBinary, SamplerType type)
+Error Context::generateSwizzles(ProgramBinary *programBinary, SamplerType type, bool dirtyUnitsOnly)
 {
     size_t samplerRange = programBinary->getUsedSamplerRange(type);
 
@@ -1425,7 +1520,7 @@ Error Context::generateSwizzles(ProgramBinary *programBinary, SamplerType type)
     {
         GLenum textureType = programBinary->getSamplerTextureType(type, i);
         GLint textureUnit = programBinary->getSamplerMapping(type, i, getCaps());
-        if (textureUnit != -1)
+        if (textureUnit != -1 && (!dirtyUnitsOnly || mState.isTextureUnitDirty(textureUnit)))
         {
             Texture* texture = getSamplerTexture(textureUnit, textureType);
             if (texture->getSamplerState().swizzleRequired())
@@ -1444,13 +1539,36 @@ Error Context::generateSwizzles(ProgramBinary *programBinary, SamplerType type)
 
 Error Context::generateSwizzles(ProgramBinary *programBinary)
 {
-    Error error = generateSwizzles(programBinary, SAMPLER_VERTEX);
+    syncDirtyBits();
+
+    // Drawing invalidates the swizzles of the textures rendered to, and this runs before the
+    // render targets are applied. Once a texture leaves the draw framebuffer, because it was
+    // rebound or its attachments changed, any unit may sample it and need a new swizzle.
+    FramebufferTextureSerialArray framebufferSerials;
+    size_t framebufferSerialCount = getBoundFramebufferTextureSerials(&framebufferSerials);
+    bool framebufferTexturesChanged = framebufferSerialCount != mSwizzledFramebufferSerialCount ||
+                                      !std::equal(framebufferSerials.begin(), framebufferSerials.begin() + framebufferSerialCount,
+                                                  mSwizzledFramebufferSerials.begin());
+    if (framebufferTexturesChanged)
+    {
+        mSwizzledFramebufferSerials = framebufferSerials;
+        mSwizzledFramebufferSerialCount = framebufferSerialCount;
+    }
+
+    unsigned int dirtyBits = mState.getDirtyBits();
+    if (!framebufferTexturesChanged && (dirtyBits & (State::DIRTY_BIT_PROGRAM_BINDING | State::DIRTY_BIT_TEXTURE_BINDINGS)) == 0)
+    {
+        return Error(GL_NO_ERROR);
+    }
+
+    bool dirtyUnitsOnly = !framebufferTexturesChanged && (dirtyBits & State::DIRTY_BIT_PROGRAM_BINDING) == 0;
+    Error error = generateSwizzles(programBinary, SAMPLER_VERTEX, dirtyUnitsOnly);
     if (error.isError())
     {
         return error;
     }
 
-    error = generateSwizzles(programBinary, SAMPLER_PIXEL);
+    error = generateSwizzles(programBinary, SAMPLER_PIXEL, dirtyUnitsOnly);
     if (error.isError())
     {
         return error;
@@ -1462,14 +1580,22 @@ Error Context::generateSwizzles(ProgramBinary *programBinary)
 // For each Direct3D sampler of either the pixel or vertex stage,
 // looks up the corresponding OpenGL texture image unit and texture type,
 // and sets the texture and its addressing/filtering state (or NULL when inactive).
+// When only some units changed since the program's samplers were last set, the
+// samplers mapped to the other units are left as they are.
 Error Context::applyTextures(ProgramBinary *programBinary, SamplerType shaderType,
-                             const FramebufferTextureSerialArray &framebufferSerials, size_t framebufferSerialCount)
+                             const FramebufferTextureSerialArray &framebufferSerials, size_t framebufferSerialCount,
+                             bool dirtyUnitsOnly)
 {
     size_t samplerRange = programBinary->getUsedSamplerRange(shaderType);
     for (size_t samplerIndex = 0; samplerIndex < samplerRange; samplerIndex++)
     {
         GLenum textureType = programBinary->getSamplerTextureType(shaderType, samplerIndex);
         GLint textureUnit = programBinary->getSamplerMapping(shaderType, samplerIndex, getCaps());
+        if (dirtyUnitsOnly && (textureUnit == -1 || !mState.isTextureUnitDirty(textureUnit)))
+        {
+            continue;
+        }
+
         if (textureUnit != -1)
         {
             Texture *texture = getSamplerTexture(textureUnit, textureType);
@@ -1507,6 +1633,9 @@ Error Context::applyTextures(ProgramBinary *programBinary, SamplerType shaderTyp
                     return error;
                 }
             }
+
+            mAppliedTextures[textureUnit].type = textureType;
+            mAppliedTextures[textureUnit].changeSerial = texture->getChangeSerial();
         }
         else
         {
@@ -1519,6 +1648,11 @@ Error Context::applyTextures(ProgramBinary *programBinary, SamplerType shaderTyp
         }
     }
 
+    if (dirtyUnitsOnly)
+    {
+        return Error(GL_NO_ERROR);
+    }
+
     // Set all the remaining textures to NULL
     size_t samplerCount = (shaderType == SAMPLER_PIXEL) ? mCaps.maxTextureImageUnits
                                                         : mCaps.maxVertexTextureImageUnits;
@@ -1536,21 +1670,34 @@ Error Context::applyTextures(ProgramBinary *programBinary, SamplerType shaderTyp
 
 Error Context::applyTextures(ProgramBinary *programBinary)
 {
+    syncDirtyBits();
+
+    unsigned int dirtyBits = mState.getDirtyBits();
+    if ((dirtyBits & (State::DIRTY_BIT_PROGRAM_BINDING | State::DIRTY_BIT_TEXTURE_BINDINGS)) == 0)
+    {
+        return Error(GL_NO_ERROR);
+    }
+
+    // A new program or sampler mapping can use any unit, and leaves other samplers to clear
+    bool dirtyUnitsOnly = (dirtyBits & State::DIRTY_BIT_PROGRAM_BINDING) == 0;
+
     FramebufferTextureSerialArray framebufferSerials;
     size_t framebufferSerialCount = getBoundFramebufferTextureSerials(&framebufferSerials);
 
-    Error error = applyTextures(programBinary, SAMPLER_VERTEX, framebufferSerials, framebufferSerialCount);
+    Error error = applyTextures(programBinary, SAMPLER_VERTEX, framebufferSerials, framebufferSerialCount, dirtyUnitsOnly);
     if (error.isError())
     {
         return error;
     }
 
-    error = applyTextures(programBinary, SAMPLER_PIXEL, framebufferSerials, framebufferSerialCount);
+    error = applyTextures(programBinary, SAMPLER_PIXEL, framebufferSerials, framebufferSerialCount, dirtyUnitsOnly);
     if (error.isError())
     {
         return error;
     }
 
+    mState.clearDirtyBits(State::DIRTY_BIT_PROGRAM_BINDING | State::DIRTY_BIT_TEXTURE_BINDINGS);
+
     return Error(GL_NO_ERROR);
 }
 
@@ -1918,6 +2065,25 @@ Error Context::sync(bool block)
     return mRenderer->sync(block);
 }
 
+bool Context::validateCurrentProgramSamplers()
+{
+    ProgramBinary *programBinary = mState.getCurrentProgramBinary();
+    ASSERT(programBinary);
+
+    // Which units the samplers refer to is all that decides whether they are valid
+    programBinary->updateSamplerMapping();
+
+    if (programBinary->getSerial() != mValidatedSamplersProgramSerial ||
+        programBinary->getSamplerMappingSerial() != mValidatedSamplerMappingSerial)
+    {
+        mValidatedSamplersResult = programBinary->validateSamplers(NULL, mCaps);
+        mValidatedSamplersProgramSerial = programBinary->getSerial();
+        mValidatedSamplerMappingSerial = programBinary->getSamplerMappingSerial();
+    }
+
+    return mValidatedSamplersResult;
+}
+
 void Context::recordError(const Error &error)
 {
     if (error.isError())
@@ -2199,6 +2365,8 @@ void Context::samplerParameteri(GLuint sampler, GLenum pname, GLint param)
       case GL_TEXTURE_COMPARE_FUNC:  samplerObject->setComparisonFunc(static_cast<GLenum>(param));  break;
       default:                       UNREACHABLE(); break;
     }
+
+    mState.notifySamplerChanged(sampler);
 }
 
 void Context::samplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
@@ -2221,6 +2389,8 @@ void Context::samplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
       case GL_TEXTURE_COMPARE_FUNC:  samplerObject->setComparisonFunc(uiround<GLenum>(param));  break;
       default:                       UNREACHABLE(); break;
     }
+
+    mState.notifySamplerChanged(sampler);
 }
 
 GLint Context::getSamplerParameteri(GLuint sampler, GLenum pname)
@@ -2439,9 +2609,9 @@ void Context::initCaps(GLuint clientVersion)
 
 extern "C"
 {
-gl::Context *glCreateContext(int clientVersion, const gl::Context *shareContext, rx::Renderer *renderer, bool notifyResets, bool robustAccess)
+gl::Context *glCreateContext(int clientVersion, const gl::Context *shareContext, rx::Renderer *renderer, bool notifyResets, bool robustAccess, bool noError)
 {
-    return new gl::Context(clientVersion, shareContext, renderer, notifyResets, robustAccess);
+    return new gl::Context(clientVersion, shareContext, renderer, notifyResets, robustAccess, noError);
 }
 
 void glDestroyContext(gl::Context *context)
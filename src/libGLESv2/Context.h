@@ -15,6 +15,7 @@
 #include "libGLESv2/Caps.h"
 #include "libGLESv2/Error.h"
 #include "libGLESv2/HandleAllocator.h"
+#include "libGLESv2/ResourceMap.h"
 #include "libGLESv2/angletypes.h"
 #include "libGLESv2/Constants.h"
 #include "libGLESv2/VertexAttribute.h"
@@ -25,7 +26,6 @@
 #include <string>
 #include <set>
 #include <map>
-#include <unordered_map>
 #include <array>
 
 namespace rx
@@ -43,6 +43,8 @@ namespace gl
 class Shader;
 class Program;
 class ProgramBinary;
+class ProgramCache;
+class ProgramCacheStore;
 class Texture;
 class Texture2D;
 class TextureCubeMap;
@@ -68,7 +70,8 @@ class TransformFeedback;
 class Context
 {
   public:
-    Context(int clientVersion, const gl::Context *shareContext, rx::Renderer *renderer, bool notifyResets, bool robustAccess);
+    Context(int clientVersion, const gl::Context *shareContext, rx::Renderer *renderer, bool notifyResets, bool robustAccess,
+            bool noError);
 
     virtual ~Context();
 
@@ -132,6 +135,9 @@ class Context
     void useProgram(GLuint program);
     Error linkProgram(GLuint program);
     Error setProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLint length);
+    // Replaces where the binaries of linked programs are kept, in memory by default. Takes
+    // ownership of |store|.
+    void setProgramCacheStore(ProgramCacheStore *store);
     void bindTransformFeedback(GLuint transformFeedback);
 
     Error beginQuery(GLenum target, GLuint query);
@@ -195,6 +201,10 @@ class Context
                        const rx::RangeUI &indexRange);
     Error sync(bool block);   // flush/finish
 
+    // Draw validation reuses the result of the last check until the current program or
+    // its sampler uniforms change.
+    bool validateCurrentProgramSamplers();
+
     void recordError(const Error &error);
 
     GLenum getError();
@@ -203,6 +213,10 @@ class Context
 
     virtual int getClientVersion() const;
 
+    // Contexts created with EGL_CONTEXT_OPENGL_NO_ERROR_KHR leave out the validation of the
+    // entry points, keeping only the checks that stop them from touching memory they don't own
+    bool skipValidation() const { return mSkipValidation; }
+
     const Caps &getCaps() const;
     const TextureCapsMap &getTextureCaps() const;
     const Extensions &getExtensions() const;
@@ -231,12 +245,21 @@ class Context
     // TODO: std::array may become unavailable using older versions of GCC
     typedef std::array<unsigned int, IMPLEMENTATION_MAX_FRAMEBUFFER_ATTACHMENTS> FramebufferTextureSerialArray;
 
+    // The texture applied to a unit, and its change serial at the time
+    struct AppliedTexture
+    {
+        GLenum type;
+        unsigned int changeSerial;
+    };
+
     Error applyRenderTarget(GLenum drawMode, bool ignoreViewport);
     Error applyState(GLenum drawMode);
+    Error applyBlendState(Framebuffer *framebufferObject, int samples);
     Error applyShaders(ProgramBinary *programBinary, bool transformFeedbackActive);
     Error applyTextures(ProgramBinary *programBinary, SamplerType shaderType, const FramebufferTextureSerialArray &framebufferSerials,
-                        size_t framebufferSerialCount);
+                        size_t framebufferSerialCount, bool dirtyUnitsOnly);
     Error applyTextures(ProgramBinary *programBinary);
+    void syncDirtyBits();
     Error applyUniformBuffers();
     bool applyTransformFeedbackBuffers();
     void markTransformFeedbackUsage();
@@ -249,7 +272,7 @@ class Context
     void detachTransformFeedback(GLuint transformFeedback);
     void detachSampler(GLuint sampler);
 
-    Error generateSwizzles(ProgramBinary *programBinary, SamplerType type);
+    Error generateSwizzles(ProgramBinary *programBinary, SamplerType type, bool dirtyUnitsOnly);
     Error generateSwizzles(ProgramBinary *programBinary);
 
     Texture *getIncompleteTexture(GLenum type);
@@ -277,24 +300,24 @@ class Context
     TextureMap mZeroTextures;
     TextureMap mIncompleteTextures;
 
-    typedef std::unordered_map<GLuint, Framebuffer*> FramebufferMap;
+    typedef ResourceMap<Framebuffer> FramebufferMap;
     FramebufferMap mFramebufferMap;
     HandleAllocator mFramebufferHandleAllocator;
 
-    typedef std::unordered_map<GLuint, FenceNV*> FenceNVMap;
+    typedef ResourceMap<FenceNV> FenceNVMap;
     FenceNVMap mFenceNVMap;
     HandleAllocator mFenceNVHandleAllocator;
 
-    typedef std::unordered_map<GLuint, Query*> QueryMap;
+    typedef ResourceMap<Query> QueryMap;
     QueryMap mQueryMap;
     HandleAllocator mQueryHandleAllocator;
 
-    typedef std::unordered_map<GLuint, VertexArray*> VertexArrayMap;
+    typedef ResourceMap<VertexArray> VertexArrayMap;
     VertexArrayMap mVertexArrayMap;
     HandleAllocator mVertexArrayHandleAllocator;
 
     BindingPointer<TransformFeedback> mTransformFeedbackZero;
-    typedef std::unordered_map<GLuint, TransformFeedback*> TransformFeedbackMap;
+    typedef ResourceMap<TransformFeedback> TransformFeedbackMap;
     TransformFeedbackMap mTransformFeedbackMap;
     HandleAllocator mTransformFeedbackAllocator;
 
@@ -312,8 +335,26 @@ class Context
     GLenum mResetStatus;
     GLenum mResetStrategy;
     bool mRobustAccess;
+    bool mSkipValidation;
+
+    // What the applied state was derived from, besides the dirty bits of mState
+    unsigned int mAppliedStateSerial;
+    unsigned int mAppliedTextureChangeSerial;
+    std::vector<AppliedTexture> mAppliedTextures;
+    FramebufferTextureSerialArray mSwizzledFramebufferSerials;
+    size_t mSwizzledFramebufferSerialCount;
+    unsigned int mAppliedSamplerMappingSerial;
+    GLenum mAppliedDrawMode;
+    bool mAppliedIgnoreViewport;
+    int mAppliedSamples;
+
+    // What the last sampler validation was derived from
+    unsigned int mValidatedSamplersProgramSerial;
+    unsigned int mValidatedSamplerMappingSerial;
+    bool mValidatedSamplersResult;
 
     ResourceManager *mResourceManager;
+    ProgramCache *mProgramCache;
 };
 }
 
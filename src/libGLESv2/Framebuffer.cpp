@@ -75,7 +75,11 @@ Framebuffer::Framebuffer(rx::Renderer *renderer, GLuint id)
       mId(id),
       mReadBufferState(GL_COLOR_ATTACHMENT0_EXT),
       mDepthbuffer(NULL),
-      mStencilbuffer(NULL)
+      mStencilbuffer(NULL),
+      mCompletenessDirty(true),
+      mCompleteness(GL_NONE),
+      mCompletenessTextureSerial(0),
+      mCompletenessRenderbufferSerial(0)
 {
     for (unsigned int colorAttachment = 0; colorAttachment < IMPLEMENTATION_MAX_DRAW_BUFFERS; colorAttachment++)
     {
@@ -178,6 +182,8 @@ FramebufferAttachment *Framebuffer::createAttachment(GLenum binding, GLenum type
 void Framebuffer::setColorbuffer(unsigned int colorAttachment, GLenum type, GLuint colorbuffer, GLint level, GLint layer)
 {
     ASSERT(colorAttachment < IMPLEMENTATION_MAX_DRAW_BUFFERS);
+    mCompletenessDirty = true;
+
     SafeDelete(mColorbuffers[colorAttachment]);
     GLenum binding = colorAttachment + GL_COLOR_ATTACHMENT0;
     mColorbuffers[colorAttachment] = createAttachment(binding, type, colorbuffer, level, layer);
@@ -185,18 +191,24 @@ void Framebuffer::setColorbuffer(unsigned int colorAttachment, GLenum type, GLui
 
 void Framebuffer::setDepthbuffer(GLenum type, GLuint depthbuffer, GLint level, GLint layer)
 {
+    mCompletenessDirty = true;
+
     SafeDelete(mDepthbuffer);
     mDepthbuffer = createAttachment(GL_DEPTH_ATTACHMENT, type, depthbuffer, level, layer);
 }
 
 void Framebuffer::setStencilbuffer(GLenum type, GLuint stencilbuffer, GLint level, GLint layer)
 {
+    mCompletenessDirty = true;
+
     SafeDelete(mStencilbuffer);
     mStencilbuffer = createAttachment(GL_STENCIL_ATTACHMENT, type, stencilbuffer, level, layer);
 }
 
 void Framebuffer::setDepthStencilBuffer(GLenum type, GLuint depthStencilBuffer, GLint level, GLint layer)
 {
+    mCompletenessDirty = true;
+
     FramebufferAttachment *attachment = createAttachment(GL_DEPTH_STENCIL_ATTACHMENT, type, depthStencilBuffer, level, layer);
 
     SafeDelete(mDepthbuffer);
@@ -215,6 +227,8 @@ void Framebuffer::setDepthStencilBuffer(GLenum type, GLuint depthStencilBuffer,
 
 void Framebuffer::detachTexture(GLuint textureId)
 {
+    mCompletenessDirty = true;
+
     for (unsigned int colorAttachment = 0; colorAttachment < IMPLEMENTATION_MAX_DRAW_BUFFERS; colorAttachment++)
     {
         FramebufferAttachment *attachment = mColorbuffers[colorAttachment];
@@ -238,6 +252,8 @@ void Framebuffer::detachTexture(GLuint textureId)
 
 void Framebuffer::detachRenderbuffer(GLuint renderbufferId)
 {
+    mCompletenessDirty = true;
+
     for (unsigned int colorAttachment = 0; colorAttachment < IMPLEMENTATION_MAX_DRAW_BUFFERS; colorAttachment++)
     {
         FramebufferAttachment *attachment = mColorbuffers[colorAttachment];
@@ -387,6 +403,24 @@ bool Framebuffer::usingExtendedDrawBuffers() const
 }
 
 GLenum Framebuffer::completeness() const
+{
+    unsigned int textureSerial = Texture::getCurrentChangeSerial();
+    unsigned int renderbufferSerial = RenderbufferStorage::getCurrentSerial();
+
+    if (mCompletenessDirty ||
+        textureSerial != mCompletenessTextureSerial ||
+        renderbufferSerial != mCompletenessRenderbufferSerial)
+    {
+        mCompleteness = checkCompleteness();
+        mCompletenessDirty = false;
+        mCompletenessTextureSerial = textureSerial;
+        mCompletenessRenderbufferSerial = renderbufferSerial;
+    }
+
+    return mCompleteness;
+}
+
+GLenum Framebuffer::checkCompleteness() const
 {
     int width = 0;
     int height = 0;
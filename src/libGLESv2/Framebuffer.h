@@ -71,6 +71,8 @@ class Framebuffer
     int getSamples() const;
     bool usingExtendedDrawBuffers() const;
 
+    // Reuses the last result until the attachments change or any texture or renderbuffer
+    // is redefined, since attached images can change without the framebuffer knowing.
     virtual GLenum completeness() const;
     bool hasValidDepthStencil() const;
 
@@ -98,6 +100,12 @@ class Framebuffer
     DISALLOW_COPY_AND_ASSIGN(Framebuffer);
 
     FramebufferAttachment *createAttachment(GLenum binding, GLenum type, GLuint handle, GLint level, GLint layer) const;
+    GLenum checkCompleteness() const;
+
+    mutable bool mCompletenessDirty;
+    mutable GLenum mCompleteness;
+    mutable unsigned int mCompletenessTextureSerial;
+    mutable unsigned int mCompletenessRenderbufferSerial;
 };
 
 class DefaultFramebuffer : public Framebuffer
@@ -0,0 +1,117 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// NameTable.cpp: Implements the gl::NameTable class.
+
+#include "libGLESv2/NameTable.h"
+
+#include "common/debug.h"
+
+#include <algorithm>
+#include <string.h>
+
+namespace gl
+{
+
+NameTable::NameTable()
+{
+}
+
+size_t NameTable::Hash(const char *name, size_t *lengthOut)
+{
+    // FNV-1a
+    size_t hash = 2166136261u;
+    const char *character = name;
+    for (; *character != '\0'; character++)
+    {
+        hash = (hash ^ static_cast<unsigned char>(*character)) * 16777619u;
+    }
+
+    *lengthOut = character - name;
+    return hash;
+}
+
+size_t NameTable::findBucket(const char *name, size_t length, size_t hash) const
+{
+    ASSERT(!mBuckets.empty());
+
+    size_t mask = mBuckets.size() - 1;
+    for (size_t bucket = hash & mask; ; bucket = (bucket + 1) & mask)
+    {
+        GLuint entryIndex = mBuckets[bucket];
+        if (entryIndex == 0)
+        {
+            return bucket;
+        }
+
+        const Entry &entry = mEntries[entryIndex - 1];
+        if (entry.hash == hash && entry.name.length() == length && memcmp(entry.name.c_str(), name, length) == 0)
+        {
+            return bucket;
+        }
+    }
+}
+
+void NameTable::rehash(size_t bucketCount)
+{
+    mBuckets.assign(bucketCount, 0);
+
+    size_t mask = bucketCount - 1;
+    for (size_t entryIndex = 0; entryIndex < mEntries.size(); entryIndex++)
+    {
+        size_t bucket = mEntries[entryIndex].hash & mask;
+        while (mBuckets[bucket] != 0)
+        {
+            bucket = (bucket + 1) & mask;
+        }
+        mBuckets[bucket] = static_cast<GLuint>(entryIndex + 1);
+    }
+}
+
+void NameTable::insert(const std::string &name, GLuint value)
+{
+    // Keep the buckets at most half full, so probes stay short
+    if ((mEntries.size() + 1) * 2 > mBuckets.size())
+    {
+        rehash(std::max<size_t>(16, mBuckets.size() * 2));
+    }
+
+    size_t length = 0;
+    size_t hash = Hash(name.c_str(), &length);
+    size_t bucket = findBucket(name.c_str(), length, hash);
+    if (mBuckets[bucket] != 0)
+    {
+        return;
+    }
+
+    Entry entry;
+    entry.name = name;
+    entry.hash = hash;
+    entry.value = value;
+    mEntries.push_back(entry);
+    mBuckets[bucket] = static_cast<GLuint>(mEntries.size());
+}
+
+GLuint NameTable::find(const char *name) const
+{
+    if (mEntries.empty())
+    {
+        return GL_INVALID_INDEX;
+    }
+
+    size_t length = 0;
+    size_t hash = Hash(name, &length);
+    GLuint entryIndex = mBuckets[findBucket(name, length, hash)];
+    return (entryIndex != 0) ? mEntries[entryIndex - 1].value : GL_INVALID_INDEX;
+}
+
+void NameTable::clear()
+{
+    mEntries.clear();
+    mBuckets.clear();
+}
+
+}
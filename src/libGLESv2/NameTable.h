@@ -0,0 +1,61 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// NameTable.h: Defines the gl::NameTable class, which maps the names of program
+// variables to their locations or indices.
+
+#ifndef LIBGLESV2_NAMETABLE_H_
+#define LIBGLESV2_NAMETABLE_H_
+
+#include "common/angleutils.h"
+
+#include "angle_gl.h"
+
+#include <string>
+#include <vector>
+
+namespace gl
+{
+
+// Built once when a program is linked or loaded. Lookups take the name the application
+// passed in as it is, so a query hashes it once and copies nothing.
+class NameTable
+{
+  public:
+    NameTable();
+
+    // Adds |name| unless it is already in the table, so the first value given for a name is kept
+    void insert(const std::string &name, GLuint value);
+
+    // Returns GL_INVALID_INDEX for names that are not in the table
+    GLuint find(const char *name) const;
+
+    void clear();
+    size_t size() const { return mEntries.size(); }
+
+  private:
+    struct Entry
+    {
+        std::string name;
+        size_t hash;
+        GLuint value;
+    };
+
+    static size_t Hash(const char *name, size_t *lengthOut);
+
+    // Returns the bucket holding |name|, or the empty bucket where it would go
+    size_t findBucket(const char *name, size_t length, size_t hash) const;
+    void rehash(size_t bucketCount);
+
+    std::vector<Entry> mEntries;
+
+    // Open addressing over mEntries: each bucket holds an entry index plus one, or zero when empty
+    std::vector<GLuint> mBuckets;
+};
+
+}
+
+#endif   // LIBGLESV2_NAMETABLE_H_
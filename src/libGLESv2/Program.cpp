@@ -9,7 +9,10 @@
 
 #include "libGLESv2/Program.h"
 #include "libGLESv2/ProgramBinary.h"
+#include "libGLESv2/ProgramCache.h"
+#include "libGLESv2/BinaryStream.h"
 #include "libGLESv2/ResourceManager.h"
+#include "libGLESv2/renderer/ProgramImpl.h"
 #include "libGLESv2/renderer/Renderer.h"
 
 namespace gl
@@ -244,13 +247,32 @@ void Program::bindAttributeLocation(GLuint index, const char *name)
 // Links the HLSL code of the vertex and pixel shader by matching up their varyings,
 // compiling them into binaries, determining the attribute mappings, and collecting
 // a list of uniforms
-Error Program::link(const Caps &caps)
+Error Program::link(const Caps &caps, ProgramCache *programCache)
 {
     unlink(false);
 
     mInfoLog.reset();
     resetUniformBlockBindings();
 
+    BinaryOutputStream linkInputs;
+    bool cacheable = (programCache != NULL) && writeLinkInputs(&linkInputs);
+
+    std::vector<uint8_t> cachedBinary;
+    if (cacheable && programCache->getProgram(linkInputs, &cachedBinary))
+    {
+        mProgramBinary.set(new ProgramBinary(mRenderer->createProgram()));
+        LinkResult result = mProgramBinary->load(mInfoLog, mProgramBinary->getImplementation()->getBinaryFormat(),
+                                                 &cachedBinary[0], static_cast<GLsizei>(cachedBinary.size()));
+        if (!result.error.isError() && result.linkSuccess)
+        {
+            mLinked = true;
+            return Error(GL_NO_ERROR);
+        }
+
+        // The entry came from another build or could not be loaded, link the shaders instead
+        mInfoLog.reset();
+    }
+
     mProgramBinary.set(new ProgramBinary(mRenderer->createProgram()));
     LinkResult result = mProgramBinary->link(mInfoLog, mAttributeBindings, mFragmentShader, mVertexShader,
                                              mTransformFeedbackVaryings, mTransformFeedbackBufferMode, caps);
@@ -260,9 +282,59 @@ Error Program::link(const Caps &caps)
     }
 
     mLinked = result.linkSuccess;
+
+    if (cacheable && mLinked)
+    {
+        BinaryOutputStream binary;
+        if (!mProgramBinary->save(&binary).isError())
+        {
+            programCache->putProgram(linkInputs, binary);
+        }
+    }
+
     return gl::Error(GL_NO_ERROR);
 }
 
+static void WriteShaderSources(BinaryOutputStream *stream, const Shader *shader)
+{
+    std::vector<char> source(shader->getSourceLength() + 1);
+    shader->getSource(static_cast<GLsizei>(source.size()), NULL, &source[0]);
+    stream->writeString(&source[0]);
+
+    std::vector<char> translatedSource(shader->getTranslatedSourceLength() + 1);
+    shader->getTranslatedSource(static_cast<GLsizei>(translatedSource.size()), NULL, &translatedSource[0]);
+    stream->writeString(&translatedSource[0]);
+}
+
+// Writes everything the result of a link depends on. Returns false when the shaders are not
+// ready to link, so there is nothing worth caching.
+bool Program::writeLinkInputs(BinaryOutputStream *stream) const
+{
+    if (!mVertexShader || !mVertexShader->isCompiled() || !mFragmentShader || !mFragmentShader->isCompiled())
+    {
+        return false;
+    }
+
+    // The caps and the compiled code both depend on the device
+    stream->writeString(mRenderer->getRendererDescription());
+    GUID adapterIdentifier = mRenderer->getAdapterIdentifier();
+    stream->writeBytes(reinterpret_cast<const unsigned char*>(&adapterIdentifier), sizeof(GUID));
+
+    WriteShaderSources(stream, mVertexShader);
+    WriteShaderSources(stream, mFragmentShader);
+
+    mAttributeBindings.writeBindings(stream);
+
+    stream->writeInt(mTransformFeedbackVaryings.size());
+    for (size_t i = 0; i < mTransformFeedbackVaryings.size(); i++)
+    {
+        stream->writeString(mTransformFeedbackVaryings[i]);
+    }
+    stream->writeInt(mTransformFeedbackBufferMode);
+
+    return true;
+}
+
 int AttributeBindings::getAttributeBinding(const std::string &name) const
 {
     for (int location = 0; location < MAX_VERTEX_ATTRIBS; location++)
@@ -276,6 +348,18 @@ int AttributeBindings::getAttributeBinding(const std::string &name) const
     return -1;
 }
 
+void AttributeBindings::writeBindings(BinaryOutputStream *stream) const
+{
+    for (int location = 0; location < MAX_VERTEX_ATTRIBS; location++)
+    {
+        stream->writeInt(mAttributeBinding[location].size());
+        for (std::set<std::string>::const_iterator name = mAttributeBinding[location].begin(); name != mAttributeBinding[location].end(); name++)
+        {
+            stream->writeString(*name);
+        }
+    }
+}
+
 // Returns the program object to an unlinked state, before re-linking, or at destruction
 void Program::unlink(bool destroy)
 {
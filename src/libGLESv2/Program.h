@@ -31,6 +31,8 @@ namespace gl
 struct Caps;
 class ResourceManager;
 class Shader;
+class BinaryOutputStream;
+class ProgramCache;
 
 extern const char * const g_fakepath;
 
@@ -43,6 +45,8 @@ class AttributeBindings
     void bindAttributeLocation(GLuint index, const char *name);
     int getAttributeBinding(const std::string &name) const;
 
+    void writeBindings(BinaryOutputStream *stream) const;
+
   private:
     std::set<std::string> mAttributeBinding[MAX_VERTEX_ATTRIBS];
 };
@@ -77,7 +81,9 @@ class Program
 
     void bindAttributeLocation(GLuint index, const char *name);
 
-    Error link(const Caps &caps);
+    // Loads the binary of an earlier link from the same inputs out of |programCache| when it
+    // has one, and adds the binary otherwise. |programCache| may be NULL.
+    Error link(const Caps &caps, ProgramCache *programCache);
     bool isLinked();
     Error setProgramBinary(GLenum binaryFormat, const void *binary, GLsizei length);
     ProgramBinary *getProgramBinary() const;
@@ -122,6 +128,7 @@ class Program
 
     void unlink(bool destroy = false);
     void resetUniformBlockBindings();
+    bool writeLinkInputs(BinaryOutputStream *stream) const;
 
     Shader *mFragmentShader;
     Shader *mVertexShader;
@@ -35,20 +35,39 @@ namespace gl
 namespace
 {
 
-unsigned int ParseAndStripArrayIndex(std::string* name)
+// Sections of the binaries ProgramBinary::save writes. ProgramBinaryLayoutVersion has to change
+// whenever what goes in one of them does.
+enum ProgramBinarySection
 {
-    unsigned int subscript = GL_INVALID_INDEX;
+    PROGRAM_BINARY_SECTION_VERSION = 1,
+    PROGRAM_BINARY_SECTION_ATTRIBUTES = 2,
+    PROGRAM_BINARY_SECTION_STRINGS = 3,
+    PROGRAM_BINARY_SECTION_IMPLEMENTATION = 4
+};
+
+const uint32_t ProgramBinaryLayoutVersion = 1;
+
+// The names are ranges of the strings section
+struct AttributeRecord
+{
+    GLenum linkedType;
+    uint32_t linkedNameOffset;
+    uint32_t linkedNameLength;
+    GLenum shaderType;
+    uint32_t shaderNameOffset;
+    uint32_t shaderNameLength;
+    int semanticIndex;
+};
 
-    // Strip any trailing array operator and retrieve the subscript
-    size_t open = name->find_last_of('[');
-    size_t close = name->find_last_of(']');
-    if (open != std::string::npos && close == name->length() - 1)
+bool ReadStringRange(const BinaryStringView &strings, uint32_t offset, uint32_t length, std::string *stringOut)
+{
+    if (offset > strings.length || length > strings.length - offset)
     {
-        subscript = atoi(name->substr(open + 1).c_str());
-        name->erase(open);
+        return false;
     }
 
-    return subscript;
+    stringOut->assign(strings.data + offset, length);
+    return true;
 }
 
 }
@@ -108,18 +127,8 @@ unsigned int ProgramBinary::issueSerial()
 
 GLuint ProgramBinary::getAttributeLocation(const char *name)
 {
-    if (name)
-    {
-        for (int index = 0; index < MAX_VERTEX_ATTRIBS; index++)
-        {
-            if (mLinkedAttribute[index].name == std::string(name))
-            {
-                return index;
-            }
-        }
-    }
-
-    return -1;
+    // GL_INVALID_INDEX is -1 as a GLint
+    return name ? mAttributeLocations.find(name) : -1;
 }
 
 int ProgramBinary::getSemanticIndex(int attributeIndex)
@@ -150,17 +159,17 @@ GLenum ProgramBinary::getSamplerTextureType(SamplerType type, unsigned int sampl
     return mProgram->getSamplerTextureType(type, samplerIndex);
 }
 
-GLint ProgramBinary::getUniformLocation(std::string name)
+GLint ProgramBinary::getUniformLocation(const char *name)
 {
     return mProgram->getUniformLocation(name);
 }
 
-GLuint ProgramBinary::getUniformIndex(std::string name)
+GLuint ProgramBinary::getUniformIndex(const char *name)
 {
     return mProgram->getUniformIndex(name);
 }
 
-GLuint ProgramBinary::getUniformBlockIndex(std::string name)
+GLuint ProgramBinary::getUniformBlockIndex(const char *name)
 {
     return mProgram->getUniformBlockIndex(name);
 }
@@ -172,21 +181,8 @@ UniformBlock *ProgramBinary::getUniformBlockByIndex(GLuint blockIndex)
 
 GLint ProgramBinary::getFragDataLocation(const char *name) const
 {
-    std::string baseName(name);
-    unsigned int arrayIndex;
-    arrayIndex = ParseAndStripArrayIndex(&baseName);
-
-    for (auto locationIt = mOutputVariables.begin(); locationIt != mOutputVariables.end(); locationIt++)
-    {
-        const VariableLocation &outputVariable = locationIt->second;
-
-        if (outputVariable.name == baseName && (arrayIndex == GL_INVALID_INDEX || arrayIndex == outputVariable.element))
-        {
-            return static_cast<GLint>(locationIt->first);
-        }
-    }
-
-    return -1;
+    GLuint location = mFragDataLocations.find(name);
+    return (location != GL_INVALID_INDEX) ? static_cast<GLint>(location) : -1;
 }
 
 size_t ProgramBinary::getTransformFeedbackVaryingCount() const
@@ -305,6 +301,11 @@ void ProgramBinary::updateSamplerMapping()
     return mProgram->updateSamplerMapping();
 }
 
+unsigned int ProgramBinary::getSamplerMappingSerial() const
+{
+    return mProgram->getSamplerMappingSerial();
+}
+
 // Applies all the uniforms set for this program object to the renderer
 Error ProgramBinary::applyUniforms()
 {
@@ -363,64 +364,149 @@ bool ProgramBinary::linkVaryings(InfoLog &infoLog, Shader *fragmentShader, Shade
 
 LinkResult ProgramBinary::load(InfoLog &infoLog, GLenum binaryFormat, const void *binary, GLsizei length)
 {
-#if ANGLE_PROGRAM_BINARY_LOAD == ANGLE_ENABLED
+#if ANGLE_PROGRAM_BINARY_LOAD != ANGLE_ENABLED
     return LinkResult(false, Error(GL_NO_ERROR));
 #else
     ASSERT(binaryFormat == mProgram->getBinaryFormat());
 
     reset();
 
+    if (BinarySectionReader::IsSectioned(binary, length))
+    {
+        return loadSections(infoLog, binary, length);
+    }
+
+    // Binaries from before the sectioned layout
     BinaryInputStream stream(binary, length);
 
-    GLenum format = stream.readInt<GLenum>();
+    if (!readVersion(infoLog, &stream))
+    {
+        return LinkResult(false, Error(GL_NO_ERROR));
+    }
+
+    for (int i = 0; i < MAX_VERTEX_ATTRIBS; ++i)
+    {
+        stream.readInt(&mLinkedAttribute[i].type);
+        stream.readString(&mLinkedAttribute[i].name);
+        stream.readInt(&mProgram->getShaderAttributes()[i].type);
+        stream.readString(&mProgram->getShaderAttributes()[i].name);
+        stream.readInt(&mSemanticIndex[i]);
+    }
+
+    return loadImplementation(infoLog, &stream);
+#endif // #if ANGLE_PROGRAM_BINARY_LOAD != ANGLE_ENABLED
+}
+
+LinkResult ProgramBinary::loadSections(InfoLog &infoLog, const void *binary, GLsizei length)
+{
+    BinarySectionReader reader(binary, length);
+
+    const uint8_t *versionData = NULL;
+    const uint8_t *attributeData = NULL;
+    const uint8_t *stringData = NULL;
+    const uint8_t *implementationData = NULL;
+    size_t versionLength = 0;
+    size_t attributeLength = 0;
+    size_t stringLength = 0;
+    size_t implementationLength = 0;
+
+    if (!reader.valid() || reader.layoutVersion() != ProgramBinaryLayoutVersion ||
+        !reader.getSection(PROGRAM_BINARY_SECTION_VERSION, &versionData, &versionLength) ||
+        !reader.getSection(PROGRAM_BINARY_SECTION_ATTRIBUTES, &attributeData, &attributeLength) ||
+        !reader.getSection(PROGRAM_BINARY_SECTION_STRINGS, &stringData, &stringLength) ||
+        !reader.getSection(PROGRAM_BINARY_SECTION_IMPLEMENTATION, &implementationData, &implementationLength))
+    {
+        infoLog.append("Invalid program binary.");
+        return LinkResult(false, Error(GL_NO_ERROR));
+    }
+
+    BinaryInputStream versionStream(versionData, versionLength);
+    if (!readVersion(infoLog, &versionStream))
+    {
+        return LinkResult(false, Error(GL_NO_ERROR));
+    }
+
+    // A record for every attribute slot, so its length is known up front
+    AttributeRecord attributes[MAX_VERTEX_ATTRIBS];
+    if (attributeLength != sizeof(attributes))
+    {
+        infoLog.append("Invalid program binary.");
+        return LinkResult(false, Error(GL_NO_ERROR));
+    }
+
+    BinaryInputStream attributeStream(attributeData, attributeLength);
+    attributeStream.readArray(attributes, MAX_VERTEX_ATTRIBS);
+
+    const BinaryStringView strings(reinterpret_cast<const char*>(stringData), stringLength);
+    for (int i = 0; i < MAX_VERTEX_ATTRIBS; ++i)
+    {
+        const AttributeRecord &attribute = attributes[i];
+        sh::Attribute &shaderAttribute = mProgram->getShaderAttributes()[i];
+
+        mLinkedAttribute[i].type = attribute.linkedType;
+        shaderAttribute.type = attribute.shaderType;
+        mSemanticIndex[i] = attribute.semanticIndex;
+
+        if (!ReadStringRange(strings, attribute.linkedNameOffset, attribute.linkedNameLength, &mLinkedAttribute[i].name) ||
+            !ReadStringRange(strings, attribute.shaderNameOffset, attribute.shaderNameLength, &shaderAttribute.name))
+        {
+            infoLog.append("Invalid program binary.");
+            return LinkResult(false, Error(GL_NO_ERROR));
+        }
+    }
+
+    BinaryInputStream implementationStream(implementationData, implementationLength);
+    return loadImplementation(infoLog, &implementationStream);
+}
+
+bool ProgramBinary::readVersion(InfoLog &infoLog, BinaryInputStream *stream)
+{
+    GLenum format = stream->readInt<GLenum>();
     if (format != mProgram->getBinaryFormat())
     {
         infoLog.append("Invalid program binary format.");
-        return LinkResult(false, Error(GL_NO_ERROR));
+        return false;
     }
 
-    int majorVersion = stream.readInt<int>();
-    int minorVersion = stream.readInt<int>();
+    int majorVersion = stream->readInt<int>();
+    int minorVersion = stream->readInt<int>();
     if (majorVersion != ANGLE_MAJOR_VERSION || minorVersion != ANGLE_MINOR_VERSION)
     {
         infoLog.append("Invalid program binary version.");
-        return LinkResult(false, Error(GL_NO_ERROR));
+        return false;
     }
 
     unsigned char commitString[ANGLE_COMMIT_HASH_SIZE];
-    stream.readBytes(commitString, ANGLE_COMMIT_HASH_SIZE);
+    stream->readBytes(commitString, ANGLE_COMMIT_HASH_SIZE);
     if (memcmp(commitString, ANGLE_COMMIT_HASH, sizeof(unsigned char) * ANGLE_COMMIT_HASH_SIZE) != 0)
     {
         infoLog.append("Invalid program binary version.");
-        return LinkResult(false, Error(GL_NO_ERROR));
+        return false;
     }
 
-    int compileFlags = stream.readInt<int>();
+    int compileFlags = stream->readInt<int>();
     if (compileFlags != ANGLE_COMPILE_OPTIMIZATION_LEVEL)
     {
         infoLog.append("Mismatched compilation flags.");
-        return LinkResult(false, Error(GL_NO_ERROR));
+        return false;
     }
 
-    for (int i = 0; i < MAX_VERTEX_ATTRIBS; ++i)
-    {
-        stream.readInt(&mLinkedAttribute[i].type);
-        stream.readString(&mLinkedAttribute[i].name);
-        stream.readInt(&mProgram->getShaderAttributes()[i].type);
-        stream.readString(&mProgram->getShaderAttributes()[i].name);
-        stream.readInt(&mSemanticIndex[i]);
-    }
+    return true;
+}
 
+LinkResult ProgramBinary::loadImplementation(InfoLog &infoLog, BinaryInputStream *stream)
+{
     initAttributesByLayout();
 
-    LinkResult result = mProgram->load(infoLog, &stream);
+    LinkResult result = mProgram->load(infoLog, stream);
     if (result.error.isError() || !result.linkSuccess)
     {
         return result;
     }
 
+    indexNames();
+
     return LinkResult(true, Error(GL_NO_ERROR));
-#endif // #if ANGLE_PROGRAM_BINARY_LOAD == ANGLE_ENABLED
 }
 
 Error ProgramBinary::save(GLenum *binaryFormat, void *binary, GLsizei bufSize, GLsizei *length)
@@ -431,24 +517,12 @@ Error ProgramBinary::save(GLenum *binaryFormat, void *binary, GLsizei bufSize, G
     }
 
     BinaryOutputStream stream;
-
-    stream.writeInt(mProgram->getBinaryFormat());
-    stream.writeInt(ANGLE_MAJOR_VERSION);
-    stream.writeInt(ANGLE_MINOR_VERSION);
-    stream.writeBytes(reinterpret_cast<const unsigned char*>(ANGLE_COMMIT_HASH), ANGLE_COMMIT_HASH_SIZE);
-    stream.writeInt(ANGLE_COMPILE_OPTIMIZATION_LEVEL);
-
-    for (unsigned int i = 0; i < MAX_VERTEX_ATTRIBS; ++i)
+    Error error = save(&stream);
+    if (error.isError())
     {
-        stream.writeInt(mLinkedAttribute[i].type);
-        stream.writeString(mLinkedAttribute[i].name);
-        stream.writeInt(mProgram->getShaderAttributes()[i].type);
-        stream.writeString(mProgram->getShaderAttributes()[i].name);
-        stream.writeInt(mSemanticIndex[i]);
+        return error;
     }
 
-    mProgram->save(&stream);
-
     GLsizei streamLength = stream.length();
     const void *streamData = stream.data();
 
@@ -483,6 +557,50 @@ Error ProgramBinary::save(GLenum *binaryFormat, void *binary, GLsizei bufSize, G
     return Error(GL_NO_ERROR);
 }
 
+Error ProgramBinary::save(BinaryOutputStream *stream)
+{
+    BinarySectionWriter writer(ProgramBinaryLayoutVersion);
+
+    BinaryOutputStream *version = writer.addSection(PROGRAM_BINARY_SECTION_VERSION);
+    version->writeInt(mProgram->getBinaryFormat());
+    version->writeInt(ANGLE_MAJOR_VERSION);
+    version->writeInt(ANGLE_MINOR_VERSION);
+    version->writeBytes(reinterpret_cast<const unsigned char*>(ANGLE_COMMIT_HASH), ANGLE_COMMIT_HASH_SIZE);
+    version->writeInt(ANGLE_COMPILE_OPTIMIZATION_LEVEL);
+
+    BinaryOutputStream *attributes = writer.addSection(PROGRAM_BINARY_SECTION_ATTRIBUTES);
+    BinaryOutputStream *strings = writer.addSection(PROGRAM_BINARY_SECTION_STRINGS);
+
+    AttributeRecord attributeRecords[MAX_VERTEX_ATTRIBS];
+    for (unsigned int i = 0; i < MAX_VERTEX_ATTRIBS; ++i)
+    {
+        const sh::Attribute &shaderAttribute = mProgram->getShaderAttributes()[i];
+        AttributeRecord &record = attributeRecords[i];
+
+        record.linkedType = mLinkedAttribute[i].type;
+        record.linkedNameOffset = static_cast<uint32_t>(strings->length());
+        record.linkedNameLength = static_cast<uint32_t>(mLinkedAttribute[i].name.length());
+        strings->writeCharacters(mLinkedAttribute[i].name);
+
+        record.shaderType = shaderAttribute.type;
+        record.shaderNameOffset = static_cast<uint32_t>(strings->length());
+        record.shaderNameLength = static_cast<uint32_t>(shaderAttribute.name.length());
+        strings->writeCharacters(shaderAttribute.name);
+
+        record.semanticIndex = mSemanticIndex[i];
+    }
+    attributes->writeArray(attributeRecords, MAX_VERTEX_ATTRIBS);
+
+    Error error = mProgram->save(writer.addSection(PROGRAM_BINARY_SECTION_IMPLEMENTATION));
+    if (error.isError())
+    {
+        return error;
+    }
+
+    writer.write(stream);
+    return Error(GL_NO_ERROR);
+}
+
 GLint ProgramBinary::getLength()
 {
     GLint length;
@@ -552,6 +670,8 @@ LinkResult ProgramBinary::link(InfoLog &infoLog, const AttributeBindings &attrib
         return result;
     }
 
+    indexNames();
+
     return LinkResult(true, Error(GL_NO_ERROR));
 }
 
@@ -1219,9 +1339,40 @@ void ProgramBinary::sortAttributesByLayout(rx::TranslatedAttribute attributes[MA
     }
 }
 
+void ProgramBinary::indexNames()
+{
+    mAttributeLocations.clear();
+    for (int location = 0; location < MAX_VERTEX_ATTRIBS; location++)
+    {
+        const std::string &name = mLinkedAttribute[location].name;
+        if (!name.empty())
+        {
+            mAttributeLocations.insert(name, location);
+        }
+    }
+
+    // Visited by ascending location, so the name of an array alone finds its first element
+    mFragDataLocations.clear();
+    for (auto locationIt = mOutputVariables.begin(); locationIt != mOutputVariables.end(); locationIt++)
+    {
+        const VariableLocation &outputVariable = locationIt->second;
+        GLuint location = static_cast<GLuint>(locationIt->first);
+
+        mFragDataLocations.insert(outputVariable.name, location);
+        if (outputVariable.element != GL_INVALID_INDEX)
+        {
+            mFragDataLocations.insert(outputVariable.name + ArrayString(outputVariable.element), location);
+        }
+    }
+
+    mProgram->indexUniformNames();
+}
+
 void ProgramBinary::reset()
 {
     mOutputVariables.clear();
+    mAttributeLocations.clear();
+    mFragDataLocations.clear();
 
     mProgram->reset();
 
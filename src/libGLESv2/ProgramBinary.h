@@ -16,6 +16,7 @@
 #include "libGLESv2/Uniform.h"
 #include "libGLESv2/Shader.h"
 #include "libGLESv2/Constants.h"
+#include "libGLESv2/NameTable.h"
 #include "libGLESv2/renderer/d3d/VertexDataManager.h"
 #include "libGLESv2/renderer/d3d/DynamicHLSL.h"
 
@@ -50,6 +51,8 @@ namespace gl
 struct Caps;
 class Shader;
 class InfoLog;
+class BinaryInputStream;
+class BinaryOutputStream;
 class AttributeBindings;
 class Buffer;
 class Framebuffer;
@@ -106,15 +109,16 @@ class ProgramBinary : public RefCountObject
 
     GLuint getAttributeLocation(const char *name);
     int getSemanticIndex(int attributeIndex);
+    const int *getSemanticIndexes() const { return mSemanticIndex; }
 
     GLint getSamplerMapping(SamplerType type, unsigned int samplerIndex, const Caps &caps);
     GLenum getSamplerTextureType(SamplerType type, unsigned int samplerIndex);
     GLint getUsedSamplerRange(SamplerType type);
     bool usesPointSize() const;
 
-    GLint getUniformLocation(std::string name);
-    GLuint getUniformIndex(std::string name);
-    GLuint getUniformBlockIndex(std::string name);
+    GLint getUniformLocation(const char *name);
+    GLuint getUniformIndex(const char *name);
+    GLuint getUniformBlockIndex(const char *name);
     void setUniform1fv(GLint location, GLsizei count, const GLfloat *v);
     void setUniform2fv(GLint location, GLsizei count, const GLfloat *v);
     void setUniform3fv(GLint location, GLsizei count, const GLfloat *v);
@@ -146,6 +150,7 @@ class ProgramBinary : public RefCountObject
 
     LinkResult load(InfoLog &infoLog, GLenum binaryFormat, const void *binary, GLsizei length);
     Error save(GLenum *binaryFormat, void *binary, GLsizei bufSize, GLsizei *length);
+    Error save(BinaryOutputStream *stream);
     GLint getLength();
 
     LinkResult link(InfoLog &infoLog, const AttributeBindings &attributeBindings, Shader *fragmentShader, Shader *vertexShader,
@@ -180,6 +185,7 @@ class ProgramBinary : public RefCountObject
     bool validateSamplers(InfoLog *infoLog, const Caps &caps);
     bool isValidated() const;
     void updateSamplerMapping();
+    unsigned int getSamplerMappingSerial() const;
 
     unsigned int getSerial() const;
 
@@ -195,6 +201,13 @@ class ProgramBinary : public RefCountObject
 
     void reset();
 
+    LinkResult loadSections(InfoLog &infoLog, const void *binary, GLsizei length);
+    bool readVersion(InfoLog &infoLog, BinaryInputStream *stream);
+    LinkResult loadImplementation(InfoLog &infoLog, BinaryInputStream *stream);
+
+    // Builds the tables that look up attributes, outputs and uniforms by name, once linking or loading succeeded
+    void indexNames();
+
     bool linkAttributes(InfoLog &infoLog, const AttributeBindings &attributeBindings, const Shader *vertexShader);
     bool linkUniformBlocks(InfoLog &infoLog, const Shader &vertexShader, const Shader &fragmentShader, const Caps &caps);
     bool areMatchingInterfaceBlocks(gl::InfoLog &infoLog, const sh::InterfaceBlock &vertexInterfaceBlock,
@@ -223,6 +236,9 @@ class ProgramBinary : public RefCountObject
 
     std::map<int, VariableLocation> mOutputVariables;
 
+    NameTable mAttributeLocations;
+    NameTable mFragDataLocations;
+
     bool mValidated;
 
     const unsigned int mSerial;
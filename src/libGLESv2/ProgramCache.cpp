@@ -0,0 +1,372 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// ProgramCache.cpp: Implements the gl::ProgramCache class and its stores.
+
+#include "libGLESv2/ProgramCache.h"
+#include "libGLESv2/BinaryStream.h"
+
+#include "common/debug.h"
+
+#include <algorithm>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(ANGLE_PLATFORM_POSIX)
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace gl
+{
+
+MemoryProgramCacheStore::MemoryProgramCacheStore(size_t maxSize)
+    : mSize(0),
+      mMaxSize(maxSize)
+{
+}
+
+bool MemoryProgramCacheStore::get(uint64_t key, std::vector<uint8_t> *dataOut)
+{
+    std::unordered_map<uint64_t, EntryList::iterator>::iterator found = mEntriesByKey.find(key);
+    if (found == mEntriesByKey.end())
+    {
+        return false;
+    }
+
+    mEntries.splice(mEntries.begin(), mEntries, found->second);
+    *dataOut = found->second->data;
+    return true;
+}
+
+void MemoryProgramCacheStore::put(uint64_t key, const uint8_t *data, size_t length)
+{
+    std::unordered_map<uint64_t, EntryList::iterator>::iterator found = mEntriesByKey.find(key);
+    if (found != mEntriesByKey.end())
+    {
+        erase(found->second);
+    }
+
+    if (length > mMaxSize)
+    {
+        return;
+    }
+
+    while (mSize + length > mMaxSize)
+    {
+        erase(--mEntries.end());
+    }
+
+    mEntries.push_front(Entry());
+    mEntries.front().key = key;
+    mEntries.front().data.assign(data, data + length);
+    mEntriesByKey[key] = mEntries.begin();
+    mSize += length;
+}
+
+void MemoryProgramCacheStore::erase(EntryList::iterator entry)
+{
+    mSize -= entry->data.size();
+    mEntriesByKey.erase(entry->key);
+    mEntries.erase(entry);
+}
+
+#if !defined(ANGLE_ENABLE_WINDOWS_STORE)
+
+namespace
+{
+
+const size_t KeyDigits = 16;
+const char FileExtension[] = ".bin";
+
+bool ParseFileName(const char *fileName, uint64_t *keyOut)
+{
+    if (strlen(fileName) != KeyDigits + strlen(FileExtension) || strcmp(fileName + KeyDigits, FileExtension) != 0)
+    {
+        return false;
+    }
+
+    uint64_t key = 0;
+    for (size_t digit = 0; digit < KeyDigits; digit++)
+    {
+        char character = fileName[digit];
+        if (character >= '0' && character <= '9')
+        {
+            key = (key << 4) | static_cast<uint64_t>(character - '0');
+        }
+        else if (character >= 'a' && character <= 'f')
+        {
+            key = (key << 4) | static_cast<uint64_t>(character - 'a' + 10);
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    *keyOut = key;
+    return true;
+}
+
+struct FoundFile
+{
+    uint64_t key;
+    size_t size;
+    uint64_t writeTime;
+
+    bool operator<(const FoundFile &other) const { return writeTime < other.writeTime; }
+};
+
+void FindFiles(const std::string &directory, std::vector<FoundFile> *filesOut)
+{
+#if defined(ANGLE_PLATFORM_WINDOWS)
+    WIN32_FIND_DATAA findData;
+    HANDLE find = FindFirstFileA((directory + "/*" + FileExtension).c_str(), &findData);
+    if (find == INVALID_HANDLE_VALUE)
+    {
+        return;
+    }
+
+    do
+    {
+        FoundFile file;
+        if (ParseFileName(findData.cFileName, &file.key))
+        {
+            file.size = static_cast<size_t>((static_cast<uint64_t>(findData.nFileSizeHigh) << 32) | findData.nFileSizeLow);
+            file.writeTime = (static_cast<uint64_t>(findData.ftLastWriteTime.dwHighDateTime) << 32) | findData.ftLastWriteTime.dwLowDateTime;
+            filesOut->push_back(file);
+        }
+    }
+    while (FindNextFileA(find, &findData));
+
+    FindClose(find);
+#else
+    DIR *dir = opendir(directory.c_str());
+    if (!dir)
+    {
+        return;
+    }
+
+    while (const dirent *entry = readdir(dir))
+    {
+        FoundFile file;
+        struct stat status;
+        if (ParseFileName(entry->d_name, &file.key) && stat((directory + "/" + entry->d_name).c_str(), &status) == 0)
+        {
+            file.size = static_cast<size_t>(status.st_size);
+            file.writeTime = static_cast<uint64_t>(status.st_mtime);
+            filesOut->push_back(file);
+        }
+    }
+
+    closedir(dir);
+#endif
+}
+
+// Replaces |to| if it exists, without a moment where neither file is there
+bool MoveFileOver(const std::string &from, const std::string &to)
+{
+#if defined(ANGLE_PLATFORM_WINDOWS)
+    return (MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING) != FALSE);
+#else
+    return (rename(from.c_str(), to.c_str()) == 0);
+#endif
+}
+
+void RemoveFile(const std::string &path)
+{
+#if defined(ANGLE_PLATFORM_WINDOWS)
+    DeleteFileA(path.c_str());
+#else
+    unlink(path.c_str());
+#endif
+}
+
+unsigned long CurrentProcessId()
+{
+#if defined(ANGLE_PLATFORM_WINDOWS)
+    return GetCurrentProcessId();
+#else
+    return static_cast<unsigned long>(getpid());
+#endif
+}
+
+}
+
+DirectoryProgramCacheStore::DirectoryProgramCacheStore(const std::string &directory, size_t maxSize)
+    : mDirectory(directory),
+      mSize(0),
+      mMaxSize(maxSize)
+{
+    std::vector<FoundFile> files;
+    FindFiles(mDirectory, &files);
+    std::sort(files.begin(), files.end());
+
+    for (size_t fileIndex = 0; fileIndex < files.size(); fileIndex++)
+    {
+        touch(files[fileIndex].key, files[fileIndex].size);
+    }
+    evict();
+}
+
+bool DirectoryProgramCacheStore::get(uint64_t key, std::vector<uint8_t> *dataOut)
+{
+    FILE *file = fopen(getPath(key).c_str(), "rb");
+    if (!file)
+    {
+        // Another process may have evicted it
+        std::unordered_map<uint64_t, FileList::iterator>::iterator found = mFilesByKey.find(key);
+        if (found != mFilesByKey.end())
+        {
+            mSize -= found->second->size;
+            mFiles.erase(found->second);
+            mFilesByKey.erase(found);
+        }
+        return false;
+    }
+
+    bool success = false;
+    if (fseek(file, 0, SEEK_END) == 0)
+    {
+        long length = ftell(file);
+        if (length > 0 && fseek(file, 0, SEEK_SET) == 0)
+        {
+            dataOut->resize(static_cast<size_t>(length));
+            success = (fread(&(*dataOut)[0], 1, dataOut->size(), file) == dataOut->size());
+        }
+    }
+    fclose(file);
+
+    if (!success)
+    {
+        return false;
+    }
+
+    touch(key, dataOut->size());
+    return true;
+}
+
+void DirectoryProgramCacheStore::put(uint64_t key, const uint8_t *data, size_t length)
+{
+    if (length > mMaxSize)
+    {
+        return;
+    }
+
+    std::string path = getPath(key);
+    std::string temporaryPath = path + FormatString(".%lu.tmp", CurrentProcessId());
+
+    FILE *file = fopen(temporaryPath.c_str(), "wb");
+    if (!file)
+    {
+        return;
+    }
+
+    bool written = (fwrite(data, 1, length, file) == length);
+    written = (fclose(file) == 0) && written;
+
+    if (!written || !MoveFileOver(temporaryPath, path))
+    {
+        RemoveFile(temporaryPath);
+        return;
+    }
+
+    touch(key, length);
+    evict();
+}
+
+std::string DirectoryProgramCacheStore::getPath(uint64_t key) const
+{
+    return mDirectory + "/" + FormatString("%08x%08x%s", static_cast<unsigned int>(key >> 32), static_cast<unsigned int>(key), FileExtension);
+}
+
+void DirectoryProgramCacheStore::touch(uint64_t key, size_t size)
+{
+    std::unordered_map<uint64_t, FileList::iterator>::iterator found = mFilesByKey.find(key);
+    if (found != mFilesByKey.end())
+    {
+        mSize -= found->second->size;
+        mFiles.erase(found->second);
+    }
+
+    File file = { key, size };
+    mFiles.push_front(file);
+    mFilesByKey[key] = mFiles.begin();
+    mSize += size;
+}
+
+void DirectoryProgramCacheStore::evict()
+{
+    while (mSize > mMaxSize)
+    {
+        const File &oldest = mFiles.back();
+        RemoveFile(getPath(oldest.key));
+
+        mSize -= oldest.size;
+        mFilesByKey.erase(oldest.key);
+        mFiles.pop_back();
+    }
+}
+
+#endif // !ANGLE_ENABLE_WINDOWS_STORE
+
+ProgramCache::ProgramCache(ProgramCacheStore *store)
+    : mStore(store)
+{
+}
+
+ProgramCache::~ProgramCache()
+{
+    SafeDelete(mStore);
+}
+
+uint64_t ProgramCache::HashLinkInputs(const BinaryOutputStream &linkInputs)
+{
+    // FNV-1a
+    uint64_t hash = 14695981039346656037ull;
+    const uint8_t *bytes = static_cast<const uint8_t*>(linkInputs.data());
+    for (size_t byteIndex = 0; byteIndex < linkInputs.length(); byteIndex++)
+    {
+        hash = (hash ^ bytes[byteIndex]) * 1099511628211ull;
+    }
+
+    return hash;
+}
+
+// An entry is the length of the link inputs, the inputs, then the program binary
+bool ProgramCache::getProgram(const BinaryOutputStream &linkInputs, std::vector<uint8_t> *binaryOut)
+{
+    std::vector<uint8_t> entry;
+    if (!mStore->get(HashLinkInputs(linkInputs), &entry) || entry.empty())
+    {
+        return false;
+    }
+
+    BinaryInputStream stream(&entry[0], entry.size());
+    size_t inputsLength = stream.readInt<size_t>();
+    if (stream.error() || inputsLength != linkInputs.length() || entry.size() - stream.offset() < inputsLength ||
+        memcmp(&entry[stream.offset()], linkInputs.data(), inputsLength) != 0)
+    {
+        return false;
+    }
+
+    stream.skip(inputsLength);
+    binaryOut->assign(entry.begin() + stream.offset(), entry.end());
+    return !binaryOut->empty();
+}
+
+void ProgramCache::putProgram(const BinaryOutputStream &linkInputs, const BinaryOutputStream &binary)
+{
+    BinaryOutputStream entry;
+    entry.writeInt(linkInputs.length());
+    entry.writeBytes(static_cast<const unsigned char*>(linkInputs.data()), linkInputs.length());
+    entry.writeBytes(static_cast<const unsigned char*>(binary.data()), binary.length());
+
+    mStore->put(HashLinkInputs(linkInputs), static_cast<const uint8_t*>(entry.data()), entry.length());
+}
+
+}
@@ -0,0 +1,135 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// ProgramCache.h: Defines the gl::ProgramCache class, which keeps the binaries of linked
+// programs so that linking the same shaders again loads the binary instead, and the stores
+// it can keep them in.
+
+#ifndef LIBGLESV2_PROGRAMCACHE_H_
+#define LIBGLESV2_PROGRAMCACHE_H_
+
+#include "common/angleutils.h"
+#include "common/platform.h"
+
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <stdint.h>
+
+namespace gl
+{
+class BinaryOutputStream;
+
+// Keeps entries by key until it runs out of room. Entries may be dropped at any time, so a
+// miss is never an error.
+class ProgramCacheStore
+{
+  public:
+    virtual ~ProgramCacheStore() { }
+
+    // Returns false when there is no entry for |key|
+    virtual bool get(uint64_t key, std::vector<uint8_t> *dataOut) = 0;
+    virtual void put(uint64_t key, const uint8_t *data, size_t length) = 0;
+};
+
+// Evicts the least recently used entries once their total size passes the limit
+class MemoryProgramCacheStore : public ProgramCacheStore
+{
+  public:
+    explicit MemoryProgramCacheStore(size_t maxSize);
+
+    virtual bool get(uint64_t key, std::vector<uint8_t> *dataOut);
+    virtual void put(uint64_t key, const uint8_t *data, size_t length);
+
+    size_t size() const { return mSize; }
+
+  private:
+    DISALLOW_COPY_AND_ASSIGN(MemoryProgramCacheStore);
+
+    struct Entry
+    {
+        uint64_t key;
+        std::vector<uint8_t> data;
+    };
+
+    typedef std::list<Entry> EntryList;
+
+    void erase(EntryList::iterator entry);
+
+    // Most recently used first
+    EntryList mEntries;
+    std::unordered_map<uint64_t, EntryList::iterator> mEntriesByKey;
+
+    size_t mSize;
+    const size_t mMaxSize;
+};
+
+#if !defined(ANGLE_ENABLE_WINDOWS_STORE)
+// Keeps one file per entry in an existing directory, so that entries outlive the process.
+// A file is written under a temporary name and renamed into place, so other processes using
+// the same directory never read a partial entry. Once the files take more than the limit,
+// the least recently used ones are deleted.
+class DirectoryProgramCacheStore : public ProgramCacheStore
+{
+  public:
+    DirectoryProgramCacheStore(const std::string &directory, size_t maxSize);
+
+    virtual bool get(uint64_t key, std::vector<uint8_t> *dataOut);
+    virtual void put(uint64_t key, const uint8_t *data, size_t length);
+
+    size_t size() const { return mSize; }
+
+  private:
+    DISALLOW_COPY_AND_ASSIGN(DirectoryProgramCacheStore);
+
+    struct File
+    {
+        uint64_t key;
+        size_t size;
+    };
+
+    typedef std::list<File> FileList;
+
+    std::string getPath(uint64_t key) const;
+    void touch(uint64_t key, size_t size);
+    void evict();
+
+    const std::string mDirectory;
+
+    // Most recently used first. The files already in the directory when the store is created
+    // are ordered by the time they were written.
+    FileList mFiles;
+    std::unordered_map<uint64_t, FileList::iterator> mFilesByKey;
+
+    size_t mSize;
+    const size_t mMaxSize;
+};
+#endif // !ANGLE_ENABLE_WINDOWS_STORE
+
+class ProgramCache
+{
+  public:
+    // Takes ownership of |store|
+    explicit ProgramCache(ProgramCacheStore *store);
+    ~ProgramCache();
+
+    // |linkInputs| holds everything the link depends on. The entry of an earlier link is only
+    // returned when its inputs are the same byte for byte, so a hash collision is a miss.
+    bool getProgram(const BinaryOutputStream &linkInputs, std::vector<uint8_t> *binaryOut);
+    void putProgram(const BinaryOutputStream &linkInputs, const BinaryOutputStream &binary);
+
+  private:
+    DISALLOW_COPY_AND_ASSIGN(ProgramCache);
+
+    static uint64_t HashLinkInputs(const BinaryOutputStream &linkInputs);
+
+    ProgramCacheStore *mStore;
+};
+
+}
+
+#endif   // LIBGLESV2_PROGRAMCACHE_H_
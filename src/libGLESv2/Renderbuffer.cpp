@@ -163,6 +163,11 @@ unsigned int RenderbufferStorage::issueSerials(unsigned int count)
     return firstSerial;
 }
 
+unsigned int RenderbufferStorage::getCurrentSerial()
+{
+    return mCurrentSerial;
+}
+
 bool RenderbufferStorage::isTexture() const
 {
     return false;
@@ -85,6 +85,9 @@ class RenderbufferStorage
 
     static unsigned int issueSerials(unsigned int count);
 
+    // Changes whenever a storage is created, which is the only way a renderbuffer is redefined.
+    static unsigned int getCurrentSerial();
+
   protected:
     GLsizei mWidth;
     GLsizei mHeight;
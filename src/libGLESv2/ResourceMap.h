@@ -0,0 +1,263 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// ResourceMap.h: Defines the gl::ResourceMap class template, which maps GL object
+// names to the objects they name.
+
+#ifndef LIBGLESV2_RESOURCEMAP_H_
+#define LIBGLESV2_RESOURCEMAP_H_
+
+#include "common/angleutils.h"
+#include "common/debug.h"
+
+#include "angle_gl.h"
+
+#include <array>
+#include <bitset>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace gl
+{
+
+// The names handed out by HandleAllocator are small and reused, so they index pages
+// of a flat table instead of being hashed. Names an application picks itself, which
+// can be arbitrarily large, go to a hash map. A name can be present with a NULL
+// object, for names that were generated but whose object is created on first bind.
+template <typename ResourceType>
+class ResourceMap
+{
+  private:
+    static const GLuint PageBits = 8;
+    static const GLuint PageSize = 1u << PageBits;
+
+    // Names at or above this are kept in the hash map
+    static const GLuint MaxDenseHandle = 1u << 16;
+
+    struct Page
+    {
+        Page() : count(0) { resources.fill(NULL); }
+
+        std::array<ResourceType*, PageSize> resources;
+        std::bitset<PageSize> present;
+        size_t count;
+    };
+
+    typedef std::unordered_map<GLuint, ResourceType*> SparseMap;
+
+  public:
+    // Visits the names in the table in ascending order, then those in the hash map.
+    // Changing the map invalidates every iterator.
+    class const_iterator
+    {
+      public:
+        const std::pair<GLuint, ResourceType*> &operator*() const { return mValue; }
+        const std::pair<GLuint, ResourceType*> *operator->() const { return &mValue; }
+
+        const_iterator &operator++()
+        {
+            if (mHandle < mMap->denseEnd())
+            {
+                mHandle = mMap->nextDenseHandle(mHandle + 1);
+            }
+            else
+            {
+                ++mSparseIt;
+            }
+            updateValue();
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            const_iterator previous = *this;
+            ++(*this);
+            return previous;
+        }
+
+        bool operator==(const const_iterator &other) const { return mHandle == other.mHandle && mSparseIt == other.mSparseIt; }
+        bool operator!=(const const_iterator &other) const { return !(*this == other); }
+
+      private:
+        friend class ResourceMap;
+
+        const_iterator(const ResourceMap *map, GLuint handle, typename SparseMap::const_iterator sparseIt)
+            : mMap(map), mHandle(handle), mSparseIt(sparseIt)
+        {
+            updateValue();
+        }
+
+        void updateValue()
+        {
+            if (mHandle < mMap->denseEnd())
+            {
+                mValue = std::make_pair(mHandle, mMap->query(mHandle));
+            }
+            else if (mSparseIt != mMap->mSparse.end())
+            {
+                mValue = *mSparseIt;
+            }
+        }
+
+        const ResourceMap *mMap;
+        GLuint mHandle;
+        typename SparseMap::const_iterator mSparseIt;
+        std::pair<GLuint, ResourceType*> mValue;
+    };
+
+    ResourceMap()
+        : mDenseCount(0)
+    {
+    }
+
+    ~ResourceMap()
+    {
+        for (size_t pageIndex = 0; pageIndex < mPages.size(); pageIndex++)
+        {
+            SafeDelete(mPages[pageIndex]);
+        }
+    }
+
+    // Returns NULL both for names that are not present and for names without an object yet
+    ResourceType *query(GLuint handle) const
+    {
+        if (handle < MaxDenseHandle)
+        {
+            GLuint pageIndex = (handle >> PageBits);
+            if (pageIndex < mPages.size() && mPages[pageIndex])
+            {
+                return mPages[pageIndex]->resources[handle & (PageSize - 1)];
+            }
+            return NULL;
+        }
+
+        typename SparseMap::const_iterator sparseIt = mSparse.find(handle);
+        return (sparseIt != mSparse.end()) ? sparseIt->second : NULL;
+    }
+
+    bool contains(GLuint handle) const
+    {
+        if (handle < MaxDenseHandle)
+        {
+            GLuint pageIndex = (handle >> PageBits);
+            return (pageIndex < mPages.size() && mPages[pageIndex] && mPages[pageIndex]->present[handle & (PageSize - 1)]);
+        }
+
+        return (mSparse.find(handle) != mSparse.end());
+    }
+
+    // Adds the name if it is not present, and sets its object
+    void assign(GLuint handle, ResourceType *resource)
+    {
+        if (handle < MaxDenseHandle)
+        {
+            GLuint pageIndex = (handle >> PageBits);
+            if (pageIndex >= mPages.size())
+            {
+                mPages.resize(pageIndex + 1, NULL);
+            }
+
+            Page *page = mPages[pageIndex];
+            if (!page)
+            {
+                page = new Page();
+                mPages[pageIndex] = page;
+            }
+
+            GLuint slot = (handle & (PageSize - 1));
+            if (!page->present[slot])
+            {
+                page->present.set(slot);
+                page->count++;
+                mDenseCount++;
+            }
+            page->resources[slot] = resource;
+        }
+        else
+        {
+            mSparse[handle] = resource;
+        }
+    }
+
+    // Removes the name, returning whether it was present and the object it had
+    bool erase(GLuint handle, ResourceType **resourceOut)
+    {
+        if (handle < MaxDenseHandle)
+        {
+            GLuint pageIndex = (handle >> PageBits);
+            GLuint slot = (handle & (PageSize - 1));
+            if (pageIndex >= mPages.size() || !mPages[pageIndex] || !mPages[pageIndex]->present[slot])
+            {
+                return false;
+            }
+
+            Page *page = mPages[pageIndex];
+            *resourceOut = page->resources[slot];
+            page->resources[slot] = NULL;
+            page->present.reset(slot);
+            page->count--;
+            mDenseCount--;
+            return true;
+        }
+
+        typename SparseMap::iterator sparseIt = mSparse.find(handle);
+        if (sparseIt == mSparse.end())
+        {
+            return false;
+        }
+
+        *resourceOut = sparseIt->second;
+        mSparse.erase(sparseIt);
+        return true;
+    }
+
+    bool empty() const { return (mDenseCount == 0 && mSparse.empty()); }
+    size_t size() const { return mDenseCount + mSparse.size(); }
+
+    const_iterator begin() const { return const_iterator(this, nextDenseHandle(0), mSparse.begin()); }
+    const_iterator end() const { return const_iterator(this, denseEnd(), mSparse.end()); }
+
+  private:
+    DISALLOW_COPY_AND_ASSIGN(ResourceMap);
+
+    GLuint denseEnd() const
+    {
+        return static_cast<GLuint>(mPages.size()) << PageBits;
+    }
+
+    // Returns the first present name at or after |handle| in the table, or denseEnd()
+    GLuint nextDenseHandle(GLuint handle) const
+    {
+        GLuint end = denseEnd();
+        while (handle < end)
+        {
+            const Page *page = mPages[handle >> PageBits];
+            if (!page || page->count == 0)
+            {
+                // Skip to the start of the next page
+                handle = ((handle >> PageBits) + 1) << PageBits;
+                continue;
+            }
+
+            if (page->present[handle & (PageSize - 1)])
+            {
+                return handle;
+            }
+            handle++;
+        }
+
+        return end;
+    }
+
+    std::vector<Page*> mPages;
+    size_t mDenseCount;
+    SparseMap mSparse;
+};
+
+}
+
+#endif   // LIBGLESV2_RESOURCEMAP_H_
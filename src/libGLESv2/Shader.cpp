@@ -18,6 +18,7 @@
 
 #include "GLSLANG/ShaderLang.h"
 
+#include <cstring>
 #include <sstream>
 
 namespace gl
@@ -17,6 +17,8 @@
 #include "libGLESv2/renderer/RenderTarget.h"
 #include "libGLESv2/formatutils.h"
 
+#include <algorithm>
+
 namespace gl
 {
 
@@ -24,6 +26,7 @@ State::State()
 {
     mMaxDrawBuffers = 0;
     mMaxCombinedTextureImageUnits = 0;
+    mDirtyBits = DIRTY_BIT_ALL;
 }
 
 State::~State()
@@ -133,6 +136,7 @@ void State::initialize(const Caps& caps, GLuint clientVersion)
     }
 
     mSamplers.resize(caps.maxCombinedTextureImageUnits);
+    mDirtyTextureUnits.resize(caps.maxCombinedTextureImageUnits);
 
     mActiveQueries[GL_ANY_SAMPLES_PASSED].set(NULL);
     mActiveQueries[GL_ANY_SAMPLES_PASSED_CONSERVATIVE].set(NULL);
@@ -143,6 +147,8 @@ void State::initialize(const Caps& caps, GLuint clientVersion)
 
     mReadFramebuffer = NULL;
     mDrawFramebuffer = NULL;
+
+    setDirtyBits(DIRTY_BIT_ALL);
 }
 
 void State::reset()
@@ -189,6 +195,44 @@ void State::reset()
     mUnpack.pixelBuffer.set(NULL);
 }
 
+unsigned int State::getDirtyBits() const
+{
+    return mDirtyBits;
+}
+
+bool State::isTextureUnitDirty(unsigned int textureUnit) const
+{
+    ASSERT(textureUnit < mDirtyTextureUnits.size());
+    return mDirtyTextureUnits[textureUnit];
+}
+
+void State::setDirtyBits(unsigned int bits)
+{
+    mDirtyBits |= bits;
+
+    if ((bits & DIRTY_BIT_TEXTURE_BINDINGS) != 0)
+    {
+        std::fill(mDirtyTextureUnits.begin(), mDirtyTextureUnits.end(), true);
+    }
+}
+
+void State::clearDirtyBits(unsigned int bits)
+{
+    mDirtyBits &= ~bits;
+
+    if ((bits & DIRTY_BIT_TEXTURE_BINDINGS) != 0)
+    {
+        std::fill(mDirtyTextureUnits.begin(), mDirtyTextureUnits.end(), false);
+    }
+}
+
+void State::setTextureUnitDirty(size_t textureUnit)
+{
+    ASSERT(textureUnit < mDirtyTextureUnits.size());
+    mDirtyTextureUnits[textureUnit] = true;
+    mDirtyBits |= DIRTY_BIT_TEXTURE_BINDINGS;
+}
+
 const RasterizerState &State::getRasterizerState() const
 {
     return mRasterizer;
@@ -284,11 +328,13 @@ void State::setColorMask(bool red, bool green, bool blue, bool alpha)
     mBlend.colorMaskGreen = green;
     mBlend.colorMaskBlue = blue;
     mBlend.colorMaskAlpha = alpha;
+    mDirtyBits |= DIRTY_BIT_BLEND_STATE;
 }
 
 void State::setDepthMask(bool mask)
 {
     mDepthStencil.depthMask = mask;
+    mDirtyBits |= DIRTY_BIT_DEPTH_STENCIL_STATE;
 }
 
 bool State::isRasterizerDiscardEnabled() const
@@ -299,6 +345,7 @@ bool State::isRasterizerDiscardEnabled() const
 void State::setRasterizerDiscard(bool enabled)
 {
     mRasterizer.rasterizerDiscard = enabled;
+    mDirtyBits |= DIRTY_BIT_RASTERIZER_STATE;
 }
 
 bool State::isCullFaceEnabled() const
@@ -309,16 +356,21 @@ bool State::isCullFaceEnabled() const
 void State::setCullFace(bool enabled)
 {
     mRasterizer.cullFace = enabled;
+    mDirtyBits |= DIRTY_BIT_RASTERIZER_STATE;
 }
 
 void State::setCullMode(GLenum mode)
 {
     mRasterizer.cullMode = mode;
+    mDirtyBits |= DIRTY_BIT_RASTERIZER_STATE;
 }
 
 void State::setFrontFace(GLenum front)
 {
     mRasterizer.frontFace = front;
+
+    // The winding also decides the viewport orientation and which stencil face is the front
+    mDirtyBits |= (DIRTY_BIT_RASTERIZER_STATE | DIRTY_BIT_DEPTH_STENCIL_STATE | DIRTY_BIT_VIEWPORT);
 }
 
 bool State::isDepthTestEnabled() const
@@ -329,17 +381,20 @@ bool State::isDepthTestEnabled() const
 void State::setDepthTest(bool enabled)
 {
     mDepthStencil.depthTest = enabled;
+    mDirtyBits |= DIRTY_BIT_DEPTH_STENCIL_STATE;
 }
 
 void State::setDepthFunc(GLenum depthFunc)
 {
      mDepthStencil.depthFunc = depthFunc;
+    mDirtyBits |= DIRTY_BIT_DEPTH_STENCIL_STATE;
 }
 
 void State::setDepthRange(float zNear, float zFar)
 {
     mNearZ = zNear;
     mFarZ = zFar;
+    mDirtyBits |= DIRTY_BIT_VIEWPORT;
 }
 
 void State::getDepthRange(float *zNear, float *zFar) const
@@ -356,6 +411,7 @@ bool State::isBlendEnabled() const
 void State::setBlend(bool enabled)
 {
     mBlend.blend = enabled;
+    mDirtyBits |= DIRTY_BIT_BLEND_STATE;
 }
 
 void State::setBlendFactors(GLenum sourceRGB, GLenum destRGB, GLenum sourceAlpha, GLenum destAlpha)
@@ -364,6 +420,7 @@ void State::setBlendFactors(GLenum sourceRGB, GLenum destRGB, GLenum sourceAlpha
     mBlend.destBlendRGB = destRGB;
     mBlend.sourceBlendAlpha = sourceAlpha;
     mBlend.destBlendAlpha = destAlpha;
+    mDirtyBits |= DIRTY_BIT_BLEND_STATE;
 }
 
 void State::setBlendColor(float red, float green, float blue, float alpha)
@@ -372,12 +429,14 @@ void State::setBlendColor(float red, float green, float blue, float alpha)
     mBlendColor.green = green;
     mBlendColor.blue = blue;
     mBlendColor.alpha = alpha;
+    mDirtyBits |= DIRTY_BIT_BLEND_STATE;
 }
 
 void State::setBlendEquation(GLenum rgbEquation, GLenum alphaEquation)
 {
     mBlend.blendEquationRGB = rgbEquation;
     mBlend.blendEquationAlpha = alphaEquation;
+    mDirtyBits |= DIRTY_BIT_BLEND_STATE;
 }
 
 const ColorF &State::getBlendColor() const
@@ -393,6 +452,7 @@ bool State::isStencilTestEnabled() const
 void State::setStencilTest(bool enabled)
 {
     mDepthStencil.stencilTest = enabled;
+    mDirtyBits |= DIRTY_BIT_DEPTH_STENCIL_STATE;
 }
 
 void State::setStencilParams(GLenum stencilFunc, GLint stencilRef, GLuint stencilMask)
@@ -400,6 +460,7 @@ void State::setStencilParams(GLenum stencilFunc, GLint stencilRef, GLuint stenci
     mDepthStencil.stencilFunc = stencilFunc;
     mStencilRef = (stencilRef > 0) ? stencilRef : 0;
     mDepthStencil.stencilMask = stencilMask;
+    mDirtyBits |= DIRTY_BIT_DEPTH_STENCIL_STATE;
 }
 
 void State::setStencilBackParams(GLenum stencilBackFunc, GLint stencilBackRef, GLuint stencilBackMask)
@@ -407,16 +468,19 @@ void State::setStencilBackParams(GLenum stencilBackFunc, GLint stencilBackRef, G
     mDepthStencil.stencilBackFunc = stencilBackFunc;
     mStencilBackRef = (stencilBackRef > 0) ? stencilBackRef : 0;
     mDepthStencil.stencilBackMask = stencilBackMask;
+    mDirtyBits |= DIRTY_BIT_DEPTH_STENCIL_STATE;
 }
 
 void State::setStencilWritemask(GLuint stencilWritemask)
 {
     mDepthStencil.stencilWritemask = stencilWritemask;
+    mDirtyBits |= DIRTY_BIT_DEPTH_STENCIL_STATE;
 }
 
 void State::setStencilBackWritemask(GLuint stencilBackWritemask)
 {
     mDepthStencil.stencilBackWritemask = stencilBackWritemask;
+    mDirtyBits |= DIRTY_BIT_DEPTH_STENCIL_STATE;
 }
 
 void State::setStencilOperations(GLenum stencilFail, GLenum stencilPassDepthFail, GLenum stencilPassDepthPass)
@@ -424,6 +488,7 @@ void State::setStencilOperations(GLenum stencilFail, GLenum stencilPassDepthFail
     mDepthStencil.stencilFail = stencilFail;
     mDepthStencil.stencilPassDepthFail = stencilPassDepthFail;
     mDepthStencil.stencilPassDepthPass = stencilPassDepthPass;
+    mDirtyBits |= DIRTY_BIT_DEPTH_STENCIL_STATE;
 }
 
 void State::setStencilBackOperations(GLenum stencilBackFail, GLenum stencilBackPassDepthFail, GLenum stencilBackPassDepthPass)
@@ -431,6 +496,7 @@ void State::setStencilBackOperations(GLenum stencilBackFail, GLenum stencilBackP
     mDepthStencil.stencilBackFail = stencilBackFail;
     mDepthStencil.stencilBackPassDepthFail = stencilBackPassDepthFail;
     mDepthStencil.stencilBackPassDepthPass = stencilBackPassDepthPass;
+    mDirtyBits |= DIRTY_BIT_DEPTH_STENCIL_STATE;
 }
 
 GLint State::getStencilRef() const
@@ -451,6 +517,7 @@ bool State::isPolygonOffsetFillEnabled() const
 void State::setPolygonOffsetFill(bool enabled)
 {
      mRasterizer.polygonOffsetFill = enabled;
+    mDirtyBits |= DIRTY_BIT_RASTERIZER_STATE;
 }
 
 void State::setPolygonOffsetParams(GLfloat factor, GLfloat units)
@@ -458,6 +525,7 @@ void State::setPolygonOffsetParams(GLfloat factor, GLfloat units)
     // An application can pass NaN values here, so handle this gracefully
     mRasterizer.polygonOffsetFactor = factor != factor ? 0.0f : factor;
     mRasterizer.polygonOffsetUnits = units != units ? 0.0f : units;
+    mDirtyBits |= DIRTY_BIT_RASTERIZER_STATE;
 }
 
 bool State::isSampleAlphaToCoverageEnabled() const
@@ -468,6 +536,7 @@ bool State::isSampleAlphaToCoverageEnabled() const
 void State::setSampleAlphaToCoverage(bool enabled)
 {
     mBlend.sampleAlphaToCoverage = enabled;
+    mDirtyBits |= DIRTY_BIT_BLEND_STATE;
 }
 
 bool State::isSampleCoverageEnabled() const
@@ -478,12 +547,14 @@ bool State::isSampleCoverageEnabled() const
 void State::setSampleCoverage(bool enabled)
 {
     mSampleCoverage = enabled;
+    mDirtyBits |= DIRTY_BIT_BLEND_STATE;
 }
 
 void State::setSampleCoverageParams(GLclampf value, bool invert)
 {
     mSampleCoverageValue = value;
     mSampleCoverageInvert = invert;
+    mDirtyBits |= DIRTY_BIT_BLEND_STATE;
 }
 
 void State::getSampleCoverageParams(GLclampf *value, bool *invert)
@@ -502,6 +573,9 @@ bool State::isScissorTestEnabled() const
 void State::setScissorTest(bool enabled)
 {
     mScissorTest = enabled;
+
+    // D3D11 enables scissoring in its rasterizer state
+    mDirtyBits |= (DIRTY_BIT_SCISSOR | DIRTY_BIT_RASTERIZER_STATE);
 }
 
 void State::setScissorParams(GLint x, GLint y, GLsizei width, GLsizei height)
@@ -510,6 +584,7 @@ void State::setScissorParams(GLint x, GLint y, GLsizei width, GLsizei height)
     mScissor.y = y;
     mScissor.width = width;
     mScissor.height = height;
+    mDirtyBits |= DIRTY_BIT_SCISSOR;
 }
 
 const Rectangle &State::getScissor() const
@@ -525,6 +600,7 @@ bool State::isDitherEnabled() const
 void State::setDither(bool enabled)
 {
     mBlend.dither = enabled;
+    mDirtyBits |= DIRTY_BIT_BLEND_STATE;
 }
 
 void State::setEnableFeature(GLenum feature, bool enabled)
@@ -589,6 +665,7 @@ void State::setViewportParams(GLint x, GLint y, GLsizei width, GLsizei height)
     mViewport.y = y;
     mViewport.width = width;
     mViewport.height = height;
+    mDirtyBits |= DIRTY_BIT_VIEWPORT;
 }
 
 const Rectangle &State::getViewport() const
@@ -609,6 +686,7 @@ unsigned int State::getActiveSampler() const
 void State::setSamplerTexture(GLenum type, Texture *texture)
 {
     mSamplerTextures[type][mActiveSampler].set(texture);
+    setTextureUnitDirty(mActiveSampler);
 }
 
 Texture *State::getSamplerTexture(unsigned int sampler, GLenum type) const
@@ -648,6 +726,7 @@ void State::detachTexture(GLuint texture)
             if (binding.id() == texture)
             {
                 binding.set(NULL);
+                setTextureUnitDirty(textureIdx);
             }
         }
     }
@@ -671,6 +750,7 @@ void State::detachTexture(GLuint texture)
 void State::setSamplerBinding(GLuint textureUnit, Sampler *sampler)
 {
     mSamplers[textureUnit].set(sampler);
+    setTextureUnitDirty(textureUnit);
 }
 
 GLuint State::getSamplerId(GLuint textureUnit) const
@@ -696,6 +776,19 @@ void State::detachSampler(GLuint sampler)
         if (samplerBinding.id() == sampler)
         {
             samplerBinding.set(NULL);
+            setTextureUnitDirty(textureUnit);
+        }
+    }
+}
+
+void State::notifySamplerChanged(GLuint sampler)
+{
+    // The parameters of a sampler object changed, so every unit it is bound to samples differently
+    for (size_t textureUnit = 0; textureUnit < mSamplers.size(); textureUnit++)
+    {
+        if (mSamplers[textureUnit].id() == sampler)
+        {
+            setTextureUnitDirty(textureUnit);
         }
     }
 }
@@ -754,6 +847,7 @@ void State::setReadFramebufferBinding(Framebuffer *framebuffer)
 void State::setDrawFramebufferBinding(Framebuffer *framebuffer)
 {
     mDrawFramebuffer = framebuffer;
+    mDirtyBits |= DIRTY_BIT_DRAW_FRAMEBUFFER_BINDING;
 }
 
 Framebuffer *State::getTargetFramebuffer(GLenum target) const
@@ -803,6 +897,7 @@ bool State::removeDrawFramebufferBinding(GLuint framebuffer)
     if (mDrawFramebuffer->id() == framebuffer)
     {
         mDrawFramebuffer = NULL;
+        mDirtyBits |= DIRTY_BIT_DRAW_FRAMEBUFFER_BINDING;
         return true;
     }
 
@@ -847,11 +942,13 @@ void State::setCurrentProgram(GLuint programId, Program *newProgram)
         newProgram->addRef();
         mCurrentProgramBinary.set(newProgram->getProgramBinary());
     }
+    mDirtyBits |= DIRTY_BIT_PROGRAM_BINDING;
 }
 
 void State::setCurrentProgramBinary(ProgramBinary *binary)
 {
     mCurrentProgramBinary.set(binary);
+    mDirtyBits |= DIRTY_BIT_PROGRAM_BINDING;
 }
 
 GLuint State::getCurrentProgramId() const
@@ -29,12 +29,36 @@ struct Caps;
 class State
 {
   public:
+    // Groups of state that are applied to the renderer together. Every setter marks the
+    // groups it touches, so that Context only re-applies the groups that changed.
+    enum DirtyBit
+    {
+        DIRTY_BIT_RASTERIZER_STATE          = 0x01,
+        DIRTY_BIT_BLEND_STATE               = 0x02,
+        DIRTY_BIT_DEPTH_STENCIL_STATE       = 0x04,
+        DIRTY_BIT_SCISSOR                   = 0x08,
+        DIRTY_BIT_VIEWPORT                  = 0x10,
+        DIRTY_BIT_DRAW_FRAMEBUFFER_BINDING  = 0x20,
+        DIRTY_BIT_PROGRAM_BINDING           = 0x40,
+        DIRTY_BIT_TEXTURE_BINDINGS          = 0x80,   // Set when any unit is dirty, see isTextureUnitDirty
+
+        DIRTY_BIT_ALL                       = 0xFF
+    };
+
     State();
     ~State();
 
     void initialize(const Caps& caps, GLuint clientVersion);
     void reset();
 
+    // Dirty bit tracking. Setting DIRTY_BIT_TEXTURE_BINDINGS marks every texture unit, and
+    // clearing it clears them all.
+    unsigned int getDirtyBits() const;
+    bool isTextureUnitDirty(unsigned int textureUnit) const;
+    void setDirtyBits(unsigned int bits);
+    void clearDirtyBits(unsigned int bits);
+    void setTextureUnitDirty(size_t textureUnit);
+
     // State chunk getters
     const RasterizerState &getRasterizerState() const;
     const BlendState &getBlendState() const;
@@ -138,6 +162,7 @@ class State
     GLuint getSamplerId(GLuint textureUnit) const;
     Sampler *getSampler(GLuint textureUnit) const;
     void detachSampler(GLuint sampler);
+    void notifySamplerChanged(GLuint sampler);
 
     // Renderbuffer binding manipulation
     void setRenderbufferBinding(Renderbuffer *renderbuffer);
@@ -315,6 +340,9 @@ class State
 
     PixelUnpackState mUnpack;
     PixelPackState mPack;
+
+    unsigned int mDirtyBits;
+    std::vector<bool> mDirtyTextureUnits;
 };
 
 }
@@ -48,6 +48,19 @@ bool IsPointSampled(const gl::SamplerState &samplerState)
 }
 
 unsigned int Texture::mCurrentTextureSerial = 1;
+unsigned int Texture::mCurrentChangeSerial = 1;
+
+Texture::SamplerCompletenessCache::SamplerCompletenessCache()
+    : imageSerial(0),
+      minFilter(GL_NONE),
+      magFilter(GL_NONE),
+      wrapS(GL_NONE),
+      wrapT(GL_NONE),
+      compareMode(GL_NONE),
+      clientVersion(0),
+      samplerComplete(false)
+{
+}
 
 Texture::Texture(rx::TextureImpl *impl, GLuint id, GLenum target)
     : RefCountObject(id),
@@ -55,7 +68,9 @@ Texture::Texture(rx::TextureImpl *impl, GLuint id, GLenum target)
       mTextureSerial(issueTextureSerial()),
       mUsage(GL_NONE),
       mImmutableLevelCount(0),
-      mTarget(target)
+      mTarget(target),
+      mChangeSerial(mCurrentChangeSerial),
+      mImageSerial(mCurrentChangeSerial)
 {
 }
 
@@ -71,6 +86,8 @@ GLenum Texture::getTarget() const
 
 void Texture::setUsage(GLenum usage)
 {
+    issueChangeSerial();
+
     mUsage = usage;
     getImplementation()->setUsage(usage);
 }
@@ -131,14 +148,42 @@ GLenum Texture::getActualFormat(const ImageIndex &index) const
     return image->getActualFormat();
 }
 
+bool Texture::isSamplerComplete(const SamplerState &samplerState, const TextureCapsMap &textureCaps, const Extensions &extensions, int clientVersion) const
+{
+    SamplerCompletenessCache &cache = mCompletenessCache;
+    if (cache.imageSerial != mImageSerial ||
+        cache.minFilter != samplerState.minFilter ||
+        cache.magFilter != samplerState.magFilter ||
+        cache.wrapS != samplerState.wrapS ||
+        cache.wrapT != samplerState.wrapT ||
+        cache.compareMode != samplerState.compareMode ||
+        cache.clientVersion != clientVersion)
+    {
+        cache.imageSerial = mImageSerial;
+        cache.minFilter = samplerState.minFilter;
+        cache.magFilter = samplerState.magFilter;
+        cache.wrapS = samplerState.wrapS;
+        cache.wrapT = samplerState.wrapT;
+        cache.compareMode = samplerState.compareMode;
+        cache.clientVersion = clientVersion;
+        cache.samplerComplete = computeSamplerCompleteness(samplerState, textureCaps, extensions, clientVersion);
+    }
+
+    return cache.samplerComplete;
+}
+
 Error Texture::generateMipmaps()
 {
+    issueImageSerial();
+
     return getImplementation()->generateMipmaps();
 }
 
 Error Texture::copySubImage(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset,
                            GLint x, GLint y, GLsizei width, GLsizei height, Framebuffer *source)
 {
+    issueChangeSerial();
+
     return mTexture->copySubImage(target, level, xoffset, yoffset, zoffset, x, y, width, height, source);
 }
 
@@ -152,6 +197,27 @@ unsigned int Texture::issueTextureSerial()
     return mCurrentTextureSerial++;
 }
 
+unsigned int Texture::getChangeSerial() const
+{
+    return mChangeSerial;
+}
+
+unsigned int Texture::getCurrentChangeSerial()
+{
+    return mCurrentChangeSerial;
+}
+
+void Texture::issueChangeSerial()
+{
+    mChangeSerial = ++mCurrentChangeSerial;
+}
+
+void Texture::issueImageSerial()
+{
+    issueChangeSerial();
+    mImageSerial = mChangeSerial;
+}
+
 bool Texture::isImmutable() const
 {
     return (mImmutableLevelCount > 0);
@@ -221,6 +287,8 @@ GLenum Texture2D::getActualFormat(GLint level) const
 
 Error Texture2D::setImage(GLint level, GLsizei width, GLsizei height, GLenum internalFormat, GLenum format, GLenum type, const PixelUnpackState &unpack, const void *pixels)
 {
+    issueImageSerial();
+
     releaseTexImage();
 
     return mTexture->setImage(GL_TEXTURE_2D, level, width, height, 1, internalFormat, format, type, unpack, pixels);
@@ -228,6 +296,8 @@ Error Texture2D::setImage(GLint level, GLsizei width, GLsizei height, GLenum int
 
 void Texture2D::bindTexImage(egl::Surface *surface)
 {
+    issueImageSerial();
+
     releaseTexImage();
 
     mTexture->bindTexImage(surface);
@@ -240,6 +310,8 @@ void Texture2D::releaseTexImage()
 {
     if (mSurface)
     {
+        issueImageSerial();
+
         mSurface->setBoundTexture(NULL);
         mSurface = NULL;
 
@@ -250,6 +322,8 @@ void Texture2D::releaseTexImage()
 Error Texture2D::setCompressedImage(GLint level, GLenum format, GLsizei width, GLsizei height, GLsizei imageSize,
                                     const PixelUnpackState &unpack, const void *pixels)
 {
+    issueImageSerial();
+
     releaseTexImage();
 
     return mTexture->setCompressedImage(GL_TEXTURE_2D, level, format, width, height, 1, imageSize, unpack, pixels);
@@ -257,18 +331,24 @@ Error Texture2D::setCompressedImage(GLint level, GLenum format, GLsizei width, G
 
 Error Texture2D::subImage(GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const PixelUnpackState &unpack, const void *pixels)
 {
+    issueChangeSerial();
+
     return mTexture->subImage(GL_TEXTURE_2D, level, xoffset, yoffset, 0, width, height, 1, format, type, unpack, pixels);
 }
 
 Error Texture2D::subImageCompressed(GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height,
                                     GLenum format, GLsizei imageSize, const PixelUnpackState &unpack, const void *pixels)
 {
+    issueChangeSerial();
+
     return mTexture->subImageCompressed(GL_TEXTURE_2D, level, xoffset, yoffset, 0, width, height, 1, format, imageSize, unpack, pixels);
 }
 
 Error Texture2D::copyImage(GLint level, GLenum format, GLint x, GLint y, GLsizei width, GLsizei height,
                            Framebuffer *source)
 {
+    issueImageSerial();
+
     releaseTexImage();
 
     return mTexture->copyImage(GL_TEXTURE_2D, level, format, x, y, width, height, source);
@@ -276,6 +356,8 @@ Error Texture2D::copyImage(GLint level, GLenum format, GLint x, GLint y, GLsizei
 
 Error Texture2D::storage(GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
 {
+    issueImageSerial();
+
     Error error = mTexture->storage(GL_TEXTURE_2D, levels, internalformat, width, height, 1);
     if (error.isError())
     {
@@ -288,7 +370,7 @@ Error Texture2D::storage(GLsizei levels, GLenum internalformat, GLsizei width, G
 }
 
 // Tests for 2D texture sampling completeness. [OpenGL ES 2.0.24] section 3.8.2 page 85.
-bool Texture2D::isSamplerComplete(const SamplerState &samplerState, const TextureCapsMap &textureCaps, const Extensions &extensions, int clientVersion) const
+bool Texture2D::computeSamplerCompleteness(const SamplerState &samplerState, const TextureCapsMap &textureCaps, const Extensions &extensions, int clientVersion) const
 {
     GLsizei width = getBaseLevelWidth();
     GLsizei height = getBaseLevelHeight();
@@ -363,6 +445,8 @@ bool Texture2D::isDepth(GLint level) const
 
 Error Texture2D::generateMipmaps()
 {
+    issueImageSerial();
+
     releaseTexImage();
 
     return mTexture->generateMipmaps();
@@ -471,17 +555,23 @@ GLenum TextureCubeMap::getActualFormat(GLenum target, GLint level) const
 
 Error TextureCubeMap::setImage(GLenum target, GLint level, GLsizei width, GLsizei height, GLenum internalFormat, GLenum format, GLenum type, const PixelUnpackState &unpack, const void *pixels)
 {
+    issueImageSerial();
+
     return mTexture->setImage(target, level, width, height, 1, internalFormat, format, type, unpack, pixels);
 }
 
 Error TextureCubeMap::setCompressedImage(GLenum target, GLint level, GLenum format, GLsizei width, GLsizei height,
                                          GLsizei imageSize, const PixelUnpackState &unpack, const void *pixels)
 {
+    issueImageSerial();
+
     return mTexture->setCompressedImage(target, level, format, width, height, 1, imageSize, unpack, pixels);
 }
 
 Error TextureCubeMap::subImage(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const PixelUnpackState &unpack, const void *pixels)
 {
+    issueChangeSerial();
+
     return mTexture->subImage(target, level, xoffset, yoffset, 0, width, height, 1, format, type, unpack, pixels);
 }
 
@@ -489,6 +579,8 @@ Error TextureCubeMap::subImageCompressed(GLenum target, GLint level, GLint xoffs
                                          GLsizei width, GLsizei height, GLenum format,
                                          GLsizei imageSize, const PixelUnpackState &unpack, const void *pixels)
 {
+    issueChangeSerial();
+
     return mTexture->subImageCompressed(target, level, xoffset, yoffset, 0, width, height, 1, format, imageSize, unpack, pixels);
 }
 
@@ -532,11 +624,15 @@ bool TextureCubeMap::isDepth(GLenum target, GLint level) const
 Error TextureCubeMap::copyImage(GLenum target, GLint level, GLenum format, GLint x, GLint y,
                                 GLsizei width, GLsizei height, Framebuffer *source)
 {
+    issueImageSerial();
+
     return mTexture->copyImage(target, level, format, x, y, width, height, source);
 }
 
 Error TextureCubeMap::storage(GLsizei levels, GLenum internalformat, GLsizei size)
 {
+    issueImageSerial();
+
     Error error = mTexture->storage(GL_TEXTURE_CUBE_MAP, levels, internalformat, size, size, 1);
     if (error.isError())
     {
@@ -549,7 +645,7 @@ Error TextureCubeMap::storage(GLsizei levels, GLenum internalformat, GLsizei siz
 }
 
 // Tests for texture sampling completeness
-bool TextureCubeMap::isSamplerComplete(const SamplerState &samplerState, const TextureCapsMap &textureCaps, const Extensions &extensions, int clientVersion) const
+bool TextureCubeMap::computeSamplerCompleteness(const SamplerState &samplerState, const TextureCapsMap &textureCaps, const Extensions &extensions, int clientVersion) const
 {
     int size = getBaseLevelWidth();
 
@@ -723,17 +819,23 @@ bool Texture3D::isDepth(GLint level) const
 
 Error Texture3D::setImage(GLint level, GLsizei width, GLsizei height, GLsizei depth, GLenum internalFormat, GLenum format, GLenum type, const PixelUnpackState &unpack, const void *pixels)
 {
+    issueImageSerial();
+
     return mTexture->setImage(GL_TEXTURE_3D, level, width, height, depth, internalFormat, format, type, unpack, pixels);
 }
 
 Error Texture3D::setCompressedImage(GLint level, GLenum format, GLsizei width, GLsizei height, GLsizei depth,
                                     GLsizei imageSize, const PixelUnpackState &unpack, const void *pixels)
 {
+    issueImageSerial();
+
     return mTexture->setCompressedImage(GL_TEXTURE_3D, level, format, width, height, depth, imageSize, unpack, pixels);
 }
 
 Error Texture3D::subImage(GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const PixelUnpackState &unpack, const void *pixels)
 {
+    issueChangeSerial();
+
     return mTexture->subImage(GL_TEXTURE_3D, level, xoffset, yoffset, zoffset, width, height, depth, format, type, unpack, pixels);
 }
 
@@ -741,11 +843,15 @@ Error Texture3D::subImageCompressed(GLint level, GLint xoffset, GLint yoffset, G
                                     GLsizei width, GLsizei height, GLsizei depth, GLenum format,
                                     GLsizei imageSize, const PixelUnpackState &unpack, const void *pixels)
 {
+    issueChangeSerial();
+
     return mTexture->subImageCompressed(GL_TEXTURE_3D, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, unpack, pixels);
 }
 
 Error Texture3D::storage(GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
 {
+    issueImageSerial();
+
     Error error = mTexture->storage(GL_TEXTURE_3D, levels, internalformat, width, height, depth);
     if (error.isError())
     {
@@ -757,7 +863,7 @@ Error Texture3D::storage(GLsizei levels, GLenum internalformat, GLsizei width, G
     return Error(GL_NO_ERROR);
 }
 
-bool Texture3D::isSamplerComplete(const SamplerState &samplerState, const TextureCapsMap &textureCaps, const Extensions &extensions, int clientVersion) const
+bool Texture3D::computeSamplerCompleteness(const SamplerState &samplerState, const TextureCapsMap &textureCaps, const Extensions &extensions, int clientVersion) const
 {
     GLsizei width = getBaseLevelWidth();
     GLsizei height = getBaseLevelHeight();
@@ -890,17 +996,23 @@ bool Texture2DArray::isDepth(GLint level) const
 
 Error Texture2DArray::setImage(GLint level, GLsizei width, GLsizei height, GLsizei depth, GLenum internalFormat, GLenum format, GLenum type, const PixelUnpackState &unpack, const void *pixels)
 {
+    issueImageSerial();
+
     return mTexture->setImage(GL_TEXTURE_2D_ARRAY, level, width, height, depth, internalFormat, format, type, unpack, pixels);
 }
 
 Error Texture2DArray::setCompressedImage(GLint level, GLenum format, GLsizei width, GLsizei height, GLsizei depth,
                                          GLsizei imageSize, const PixelUnpackState &unpack, const void *pixels)
 {
+    issueImageSerial();
+
     return mTexture->setCompressedImage(GL_TEXTURE_2D_ARRAY, level, format, width, height, depth, imageSize, unpack, pixels);
 }
 
 Error Texture2DArray::subImage(GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const PixelUnpackState &unpack, const void *pixels)
 {
+    issueChangeSerial();
+
     return mTexture->subImage(GL_TEXTURE_2D_ARRAY, level, xoffset, yoffset, zoffset, width, height, depth, format, type, unpack, pixels);
 }
 
@@ -908,11 +1020,15 @@ Error Texture2DArray::subImageCompressed(GLint level, GLint xoffset, GLint yoffs
                                          GLsizei width, GLsizei height, GLsizei depth, GLenum format,
                                          GLsizei imageSize, const PixelUnpackState &unpack, const void *pixels)
 {
+    issueChangeSerial();
+
     return mTexture->subImageCompressed(GL_TEXTURE_2D_ARRAY, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, unpack, pixels);
 }
 
 Error Texture2DArray::storage(GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
 {
+    issueImageSerial();
+
     Error error = mTexture->storage(GL_TEXTURE_2D_ARRAY, levels, internalformat, width, height, depth);
     if (error.isError())
     {
@@ -924,7 +1040,7 @@ Error Texture2DArray::storage(GLsizei levels, GLenum internalformat, GLsizei wid
     return Error(GL_NO_ERROR);
 }
 
-bool Texture2DArray::isSamplerComplete(const SamplerState &samplerState, const TextureCapsMap &textureCaps, const Extensions &extensions, int clientVersion) const
+bool Texture2DArray::computeSamplerCompleteness(const SamplerState &samplerState, const TextureCapsMap &textureCaps, const Extensions &extensions, int clientVersion) const
 {
     GLsizei width = getBaseLevelWidth();
     GLsizei height = getBaseLevelHeight();
@@ -66,7 +66,10 @@ class Texture : public RefCountObject
     GLenum getInternalFormat(const ImageIndex &index) const;
     GLenum getActualFormat(const ImageIndex &index) const;
 
-    virtual bool isSamplerComplete(const SamplerState &samplerState, const TextureCapsMap &textureCaps, const Extensions &extensions, int clientVersion) const = 0;
+    // Completeness is recomputed only when the images or the sampler parameters it depends on
+    // differ from the previous call. The caps and extensions come from the renderer, which every
+    // context sharing this texture has in common.
+    bool isSamplerComplete(const SamplerState &samplerState, const TextureCapsMap &textureCaps, const Extensions &extensions, int clientVersion) const;
 
     virtual Error generateMipmaps();
 
@@ -76,6 +79,13 @@ class Texture : public RefCountObject
     // "id" is not good enough, as Textures can be deleted, then re-allocated with the same id.
     unsigned int getTextureSerial() const;
 
+    // A new change serial is issued whenever the images, storage or parameters of a texture
+    // change, so that state applied from it can tell when it has gone stale. The current
+    // serial is the latest one issued to any texture.
+    unsigned int getChangeSerial() const;
+    static unsigned int getCurrentChangeSerial();
+    void issueChangeSerial();
+
     bool isImmutable() const;
     GLsizei immutableLevelCount();
 
@@ -89,6 +99,12 @@ class Texture : public RefCountObject
     const rx::Image *getBaseLevelImage() const;
     static unsigned int issueTextureSerial();
 
+    virtual bool computeSamplerCompleteness(const SamplerState &samplerState, const TextureCapsMap &textureCaps, const Extensions &extensions, int clientVersion) const = 0;
+
+    // Called by everything that can change the number, size or format of the images, in
+    // place of issueChangeSerial
+    void issueImageSerial();
+
     rx::TextureImpl *mTexture;
 
     SamplerState mSamplerState;
@@ -100,9 +116,31 @@ class Texture : public RefCountObject
 
     const unsigned int mTextureSerial;
     static unsigned int mCurrentTextureSerial;
+    unsigned int mChangeSerial;
+    static unsigned int mCurrentChangeSerial;
 
   private:
     DISALLOW_COPY_AND_ASSIGN(Texture);
+
+    // The sampler parameters completeness depends on, and the result for them
+    struct SamplerCompletenessCache
+    {
+        SamplerCompletenessCache();
+
+        unsigned int imageSerial;
+        GLenum minFilter;
+        GLenum magFilter;
+        GLenum wrapS;
+        GLenum wrapT;
+        GLenum compareMode;
+        int clientVersion;
+
+        bool samplerComplete;
+    };
+
+    // The change serial of the last change to the images of this texture
+    unsigned int mImageSerial;
+    mutable SamplerCompletenessCache mCompletenessCache;
 };
 
 class Texture2D : public Texture
@@ -126,7 +164,6 @@ class Texture2D : public Texture
     Error copyImage(GLint level, GLenum format, GLint x, GLint y, GLsizei width, GLsizei height, Framebuffer *source);
     Error storage(GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height);
 
-    virtual bool isSamplerComplete(const SamplerState &samplerState, const TextureCapsMap &textureCaps, const Extensions &extensions, int clientVersion) const;
     virtual void bindTexImage(egl::Surface *surface);
     virtual void releaseTexImage();
 
@@ -135,6 +172,7 @@ class Texture2D : public Texture
   private:
     DISALLOW_COPY_AND_ASSIGN(Texture2D);
 
+    virtual bool computeSamplerCompleteness(const SamplerState &samplerState, const TextureCapsMap &textureCaps, const Extensions &extensions, int clientVersion) const;
     bool isMipmapComplete() const;
     bool isLevelComplete(int level) const;
 
@@ -162,8 +200,6 @@ class TextureCubeMap : public Texture
     Error copyImage(GLenum target, GLint level, GLenum format, GLint x, GLint y, GLsizei width, GLsizei height, Framebuffer *source);
     Error storage(GLsizei levels, GLenum internalformat, GLsizei size);
 
-    virtual bool isSamplerComplete(const SamplerState &samplerState, const TextureCapsMap &textureCaps, const Extensions &extensions, int clientVersion) const;
-
     bool isCubeComplete() const;
 
     static int targetToLayerIndex(GLenum target);
@@ -172,6 +208,7 @@ class TextureCubeMap : public Texture
   private:
     DISALLOW_COPY_AND_ASSIGN(TextureCubeMap);
 
+    virtual bool computeSamplerCompleteness(const SamplerState &samplerState, const TextureCapsMap &textureCaps, const Extensions &extensions, int clientVersion) const;
     bool isMipmapComplete() const;
     bool isFaceLevelComplete(int faceIndex, int level) const;
 };
@@ -197,11 +234,10 @@ class Texture3D : public Texture
     Error subImageCompressed(GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const PixelUnpackState &unpack, const void *pixels);
     Error storage(GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth);
 
-    virtual bool isSamplerComplete(const SamplerState &samplerState, const TextureCapsMap &textureCaps, const Extensions &extensions, int clientVersion) const;
-
   private:
     DISALLOW_COPY_AND_ASSIGN(Texture3D);
 
+    virtual bool computeSamplerCompleteness(const SamplerState &samplerState, const TextureCapsMap &textureCaps, const Extensions &extensions, int clientVersion) const;
     bool isMipmapComplete() const;
     bool isLevelComplete(int level) const;
 };
@@ -227,11 +263,10 @@ class Texture2DArray : public Texture
     Error subImageCompressed(GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const PixelUnpackState &unpack, const void *pixels);
     Error storage(GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth);
 
-    virtual bool isSamplerComplete(const SamplerState &samplerState, const TextureCapsMap &textureCaps, const Extensions &extensions, int clientVersion) const;
-
   private:
     DISALLOW_COPY_AND_ASSIGN(Texture2DArray);
 
+    virtual bool computeSamplerCompleteness(const SamplerState &samplerState, const TextureCapsMap &textureCaps, const Extensions &extensions, int clientVersion) const;
     bool isMipmapComplete() const;
     bool isLevelComplete(int level) const;
 };
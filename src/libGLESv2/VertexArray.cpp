@@ -10,11 +10,24 @@
 #include "libGLESv2/Buffer.h"
 #include "libGLESv2/renderer/VertexArrayImpl.h"
 
+#include <algorithm>
+#include <limits>
+
 namespace gl
 {
 
+VertexArrayDrawLimits::VertexArrayDrawLimits()
+    : missingData(false),
+      maxVertexCount(std::numeric_limits<GLint64>::max()),
+      maxInstanceCount(std::numeric_limits<GLint64>::max())
+{
+}
+
 VertexArray::VertexArray(rx::VertexArrayImpl *impl, GLuint id, size_t maxAttribs)
     : mId(id),
+      mDrawLimitsDirty(true),
+      mDrawLimitsProgramSerial(0),
+      mDrawLimitsBufferSizeSerial(0),
       mVertexArray(impl),
       mVertexAttributes(maxAttribs)
 {
@@ -44,6 +57,7 @@ void VertexArray::detachBuffer(GLuint bufferName)
         if (mVertexAttributes[attribute].buffer.id() == bufferName)
         {
             mVertexAttributes[attribute].buffer.set(NULL);
+            mDrawLimitsDirty = true;
         }
     }
 
@@ -63,6 +77,7 @@ void VertexArray::setVertexAttribDivisor(GLuint index, GLuint divisor)
 {
     ASSERT(index < getMaxAttribs());
     mVertexAttributes[index].divisor = divisor;
+    mDrawLimitsDirty = true;
     mVertexArray->setAttributeDivisor(index, divisor);
 }
 
@@ -70,6 +85,7 @@ void VertexArray::enableAttribute(unsigned int attributeIndex, bool enabledState
 {
     ASSERT(attributeIndex < getMaxAttribs());
     mVertexAttributes[attributeIndex].enabled = enabledState;
+    mDrawLimitsDirty = true;
     mVertexArray->enableAttribute(attributeIndex, enabledState);
 }
 
@@ -84,6 +100,7 @@ void VertexArray::setAttributeState(unsigned int attributeIndex, gl::Buffer *bou
     mVertexAttributes[attributeIndex].pureInteger = pureInteger;
     mVertexAttributes[attributeIndex].stride = stride;
     mVertexAttributes[attributeIndex].pointer = pointer;
+    mDrawLimitsDirty = true;
     mVertexArray->setAttribute(attributeIndex, mVertexAttributes[attributeIndex]);
 }
 
@@ -93,4 +110,56 @@ void VertexArray::setElementArrayBuffer(Buffer *buffer)
     mVertexArray->setElementArrayBuffer(buffer);
 }
 
-}
\ No newline at end of file
+const VertexArrayDrawLimits &VertexArray::getDrawLimits(unsigned int programSerial, const int *semanticIndexes)
+{
+    if (!mDrawLimitsDirty &&
+        programSerial == mDrawLimitsProgramSerial &&
+        Buffer::getCurrentSizeSerial() == mDrawLimitsBufferSizeSerial)
+    {
+        return mDrawLimits;
+    }
+
+    mDrawLimits = VertexArrayDrawLimits();
+
+    for (size_t attributeIndex = 0; attributeIndex < getMaxAttribs(); attributeIndex++)
+    {
+        const VertexAttribute &attrib = mVertexAttributes[attributeIndex];
+        if (semanticIndexes[attributeIndex] == -1 || !attrib.enabled)
+        {
+            continue;
+        }
+
+        const Buffer *buffer = attrib.buffer.get();
+        if (!buffer)
+        {
+            if (attrib.pointer == NULL)
+            {
+                mDrawLimits.missingData = true;
+            }
+            continue;
+        }
+
+        // [OpenGL ES 3.0.2] section 2.9.4 page 40: drawing |n| vertices reads |n| strides of the buffer
+        GLint64 elementCount = buffer->getSize() / static_cast<GLint64>(ComputeVertexAttributeStride(attrib));
+
+        if (attrib.divisor == 0)
+        {
+            mDrawLimits.maxVertexCount = std::min(mDrawLimits.maxVertexCount, elementCount);
+        }
+        else if (elementCount < std::numeric_limits<GLsizei>::max())
+        {
+            // Instanced attributes read one element for every |divisor| instances, so the
+            // buffer runs out at the first instance count that needs one element more
+            GLint64 maxInstanceCount = (elementCount + 1) * attrib.divisor - 1;
+            mDrawLimits.maxInstanceCount = std::min(mDrawLimits.maxInstanceCount, maxInstanceCount);
+        }
+    }
+
+    mDrawLimitsDirty = false;
+    mDrawLimitsProgramSerial = programSerial;
+    mDrawLimitsBufferSizeSerial = Buffer::getCurrentSizeSerial();
+
+    return mDrawLimits;
+}
+
+}
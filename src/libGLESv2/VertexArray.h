@@ -29,6 +29,19 @@ namespace gl
 {
 class Buffer;
 
+// How far a draw may reach into the buffers of the attributes a program reads. Drawing
+// more vertices or instances than these reads past the end of one of the buffers.
+struct VertexArrayDrawLimits
+{
+    VertexArrayDrawLimits();
+
+    // An enabled attribute has neither a buffer nor a client pointer to read from
+    bool missingData;
+
+    GLint64 maxVertexCount;
+    GLint64 maxInstanceCount;
+};
+
 class VertexArray
 {
   public:
@@ -50,9 +63,18 @@ class VertexArray
     GLuint getElementArrayBufferId() const { return mElementArrayBuffer.id(); }
     size_t getMaxAttribs() const { return mVertexAttributes.size(); }
 
+    // Only recomputed when the attributes, the program or the size of a buffer changed.
+    // An attribute is read by the program when its entry in |semanticIndexes| is not -1.
+    const VertexArrayDrawLimits &getDrawLimits(unsigned int programSerial, const int *semanticIndexes);
+
   private:
     GLuint mId;
 
+    bool mDrawLimitsDirty;
+    unsigned int mDrawLimitsProgramSerial;
+    unsigned int mDrawLimitsBufferSizeSerial;
+    VertexArrayDrawLimits mDrawLimits;
+
     rx::VertexArrayImpl *mVertexArray;
     std::vector<VertexAttribute> mVertexAttributes;
     BindingPointer<Buffer> mElementArrayBuffer;
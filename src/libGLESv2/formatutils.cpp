@@ -17,183 +17,135 @@
 namespace gl
 {
 
+// The tables below are sorted by their keys and hold nothing but constants, so they are
+// ready before any code runs and a lookup is a binary search of a few cache lines.
+// Keep them sorted by the values of the enums, not by their names.
+
 // ES2 requires that format is equal to internal format at all glTex*Image2D entry points and the implementation
-// can decide the true, sized, internal format. The ES2FormatMap determines the internal format for all valid
+// can decide the true, sized, internal format. This table determines the internal format for all valid
 // format and type combinations.
-
-FormatType::FormatType()
-    : internalFormat(GL_NONE),
-      colorWriteFunction(NULL)
-{
-}
-
-typedef std::pair<GLenum, GLenum> FormatTypePair;
-typedef std::pair<FormatTypePair, FormatType> FormatPair;
-typedef std::map<FormatTypePair, FormatType> FormatMap;
-
-// A helper function to insert data into the format map with fewer characters.
-static inline void InsertFormatMapping(FormatMap *map, GLenum format, GLenum type, GLenum internalFormat, ColorWriteFunction writeFunc)
+struct FormatTypeInfoEntry
 {
+    GLenum format;
+    GLenum type;
     FormatType info;
-    info.internalFormat = internalFormat;
-    info.colorWriteFunction = writeFunc;
-    map->insert(FormatPair(FormatTypePair(format, type), info));
-}
-
-FormatMap BuildFormatMap()
-{
-    FormatMap map;
-
-    using namespace rx;
-
-    //                       | Format               | Type                             | Internal format          | Color write function             |
-    InsertFormatMapping(&map, GL_RGBA,               GL_UNSIGNED_BYTE,                  GL_RGBA8,                  WriteColor<R8G8B8A8, GLfloat>     );
-    InsertFormatMapping(&map, GL_RGBA,               GL_BYTE,                           GL_RGBA8_SNORM,            WriteColor<R8G8B8A8S, GLfloat>    );
-    InsertFormatMapping(&map, GL_RGBA,               GL_UNSIGNED_SHORT_4_4_4_4,         GL_RGBA4,                  WriteColor<R4G4B4A4, GLfloat>     );
-    InsertFormatMapping(&map, GL_RGBA,               GL_UNSIGNED_SHORT_5_5_5_1,         GL_RGB5_A1,                WriteColor<R5G5B5A1, GLfloat>     );
-    InsertFormatMapping(&map, GL_RGBA,               GL_UNSIGNED_INT_2_10_10_10_REV,    GL_RGB10_A2,               WriteColor<R10G10B10A2, GLfloat>  );
-    InsertFormatMapping(&map, GL_RGBA,               GL_FLOAT,                          GL_RGBA32F,                WriteColor<R32G32B32A32F, GLfloat>);
-    InsertFormatMapping(&map, GL_RGBA,               GL_HALF_FLOAT,                     GL_RGBA16F,                WriteColor<R16G16B16A16F, GLfloat>);
-    InsertFormatMapping(&map, GL_RGBA,               GL_HALF_FLOAT_OES,                 GL_RGBA16F,                WriteColor<R16G16B16A16F, GLfloat>);
-
-    InsertFormatMapping(&map, GL_RGBA_INTEGER,       GL_UNSIGNED_BYTE,                  GL_RGBA8UI,                WriteColor<R8G8B8A8, GLuint>      );
-    InsertFormatMapping(&map, GL_RGBA_INTEGER,       GL_BYTE,                           GL_RGBA8I,                 WriteColor<R8G8B8A8S, GLint>      );
-    InsertFormatMapping(&map, GL_RGBA_INTEGER,       GL_UNSIGNED_SHORT,                 GL_RGBA16UI,               WriteColor<R16G16B16A16, GLuint>  );
-    InsertFormatMapping(&map, GL_RGBA_INTEGER,       GL_SHORT,                          GL_RGBA16I,                WriteColor<R16G16B16A16S, GLint>  );
-    InsertFormatMapping(&map, GL_RGBA_INTEGER,       GL_UNSIGNED_INT,                   GL_RGBA32UI,               WriteColor<R32G32B32A32, GLuint>  );
-    InsertFormatMapping(&map, GL_RGBA_INTEGER,       GL_INT,                            GL_RGBA32I,                WriteColor<R32G32B32A32S, GLint>  );
-    InsertFormatMapping(&map, GL_RGBA_INTEGER,       GL_UNSIGNED_INT_2_10_10_10_REV,    GL_RGB10_A2UI,             WriteColor<R10G10B10A2, GLuint>   );
-
-    InsertFormatMapping(&map, GL_RGB,                GL_UNSIGNED_BYTE,                  GL_RGB8,                   WriteColor<R8G8B8, GLfloat>       );
-    InsertFormatMapping(&map, GL_RGB,                GL_BYTE,                           GL_RGB8_SNORM,             WriteColor<R8G8B8S, GLfloat>      );
-    InsertFormatMapping(&map, GL_RGB,                GL_UNSIGNED_SHORT_5_6_5,           GL_RGB565,                 WriteColor<R5G6B5, GLfloat>       );
-    InsertFormatMapping(&map, GL_RGB,                GL_UNSIGNED_INT_10F_11F_11F_REV,   GL_R11F_G11F_B10F,         WriteColor<R11G11B10F, GLfloat>   );
-    InsertFormatMapping(&map, GL_RGB,                GL_UNSIGNED_INT_5_9_9_9_REV,       GL_RGB9_E5,                WriteColor<R9G9B9E5, GLfloat>     );
-    InsertFormatMapping(&map, GL_RGB,                GL_FLOAT,                          GL_RGB32F,                 WriteColor<R32G32B32F, GLfloat>   );
-    InsertFormatMapping(&map, GL_RGB,                GL_HALF_FLOAT,                     GL_RGB16F,                 WriteColor<R16G16B16F, GLfloat>   );
-    InsertFormatMapping(&map, GL_RGB,                GL_HALF_FLOAT_OES,                 GL_RGB16F,                 WriteColor<R16G16B16F, GLfloat>   );
-
-    InsertFormatMapping(&map, GL_RGB_INTEGER,        GL_UNSIGNED_BYTE,                  GL_RGB8UI,                 WriteColor<R8G8B8, GLuint>        );
-    InsertFormatMapping(&map, GL_RGB_INTEGER,        GL_BYTE,                           GL_RGB8I,                  WriteColor<R8G8B8S, GLint>        );
-    InsertFormatMapping(&map, GL_RGB_INTEGER,        GL_UNSIGNED_SHORT,                 GL_RGB16UI,                WriteColor<R16G16B16, GLuint>     );
-    InsertFormatMapping(&map, GL_RGB_INTEGER,        GL_SHORT,                          GL_RGB16I,                 WriteColor<R16G16B16S, GLint>     );
-    InsertFormatMapping(&map, GL_RGB_INTEGER,        GL_UNSIGNED_INT,                   GL_RGB32UI,                WriteColor<R32G32B32, GLuint>     );
-    InsertFormatMapping(&map, GL_RGB_INTEGER,        GL_INT,                            GL_RGB32I,                 WriteColor<R32G32B32S, GLint>     );
-
-    InsertFormatMapping(&map, GL_RG,                 GL_UNSIGNED_BYTE,                  GL_RG8,                    WriteColor<R8G8, GLfloat>         );
-    InsertFormatMapping(&map, GL_RG,                 GL_BYTE,                           GL_RG8_SNORM,              WriteColor<R8G8S, GLfloat>        );
-    InsertFormatMapping(&map, GL_RG,                 GL_FLOAT,                          GL_RG32F,                  WriteColor<R32G32F, GLfloat>      );
-    InsertFormatMapping(&map, GL_RG,                 GL_HALF_FLOAT,                     GL_RG16F,                  WriteColor<R16G16F, GLfloat>      );
-    InsertFormatMapping(&map, GL_RG,                 GL_HALF_FLOAT_OES,                 GL_RG16F,                  WriteColor<R16G16F, GLfloat>      );
-
-    InsertFormatMapping(&map, GL_RG_INTEGER,         GL_UNSIGNED_BYTE,                  GL_RG8UI,                  WriteColor<R8G8, GLuint>          );
-    InsertFormatMapping(&map, GL_RG_INTEGER,         GL_BYTE,                           GL_RG8I,                   WriteColor<R8G8S, GLint>          );
-    InsertFormatMapping(&map, GL_RG_INTEGER,         GL_UNSIGNED_SHORT,                 GL_RG16UI,                 WriteColor<R16G16, GLuint>        );
-    InsertFormatMapping(&map, GL_RG_INTEGER,         GL_SHORT,                          GL_RG16I,                  WriteColor<R16G16S, GLint>        );
-    InsertFormatMapping(&map, GL_RG_INTEGER,         GL_UNSIGNED_INT,                   GL_RG32UI,                 WriteColor<R32G32, GLuint>        );
-    InsertFormatMapping(&map, GL_RG_INTEGER,         GL_INT,                            GL_RG32I,                  WriteColor<R32G32S, GLint>        );
-
-    InsertFormatMapping(&map, GL_RED,                GL_UNSIGNED_BYTE,                  GL_R8,                     WriteColor<R8, GLfloat>           );
-    InsertFormatMapping(&map, GL_RED,                GL_BYTE,                           GL_R8_SNORM,               WriteColor<R8S, GLfloat>          );
-    InsertFormatMapping(&map, GL_RED,                GL_FLOAT,                          GL_R32F,                   WriteColor<R32F, GLfloat>         );
-    InsertFormatMapping(&map, GL_RED,                GL_HALF_FLOAT,                     GL_R16F,                   WriteColor<R16F, GLfloat>         );
-    InsertFormatMapping(&map, GL_RED,                GL_HALF_FLOAT_OES,                 GL_R16F,                   WriteColor<R16F, GLfloat>         );
-
-    InsertFormatMapping(&map, GL_RED_INTEGER,        GL_UNSIGNED_BYTE,                  GL_R8UI,                   WriteColor<R8, GLuint>            );
-    InsertFormatMapping(&map, GL_RED_INTEGER,        GL_BYTE,                           GL_R8I,                    WriteColor<R8S, GLint>            );
-    InsertFormatMapping(&map, GL_RED_INTEGER,        GL_UNSIGNED_SHORT,                 GL_R16UI,                  WriteColor<R16, GLuint>           );
-    InsertFormatMapping(&map, GL_RED_INTEGER,        GL_SHORT,                          GL_R16I,                   WriteColor<R16S, GLint>           );
-    InsertFormatMapping(&map, GL_RED_INTEGER,        GL_UNSIGNED_INT,                   GL_R32UI,                  WriteColor<R32, GLuint>           );
-    InsertFormatMapping(&map, GL_RED_INTEGER,        GL_INT,                            GL_R32I,                   WriteColor<R32S, GLint>           );
-
-    InsertFormatMapping(&map, GL_LUMINANCE_ALPHA,    GL_UNSIGNED_BYTE,                  GL_LUMINANCE8_ALPHA8_EXT,  WriteColor<L8A8, GLfloat>         );
-    InsertFormatMapping(&map, GL_LUMINANCE,          GL_UNSIGNED_BYTE,                  GL_LUMINANCE8_EXT,         WriteColor<L8, GLfloat>           );
-    InsertFormatMapping(&map, GL_ALPHA,              GL_UNSIGNED_BYTE,                  GL_ALPHA8_EXT,             WriteColor<A8, GLfloat>           );
-    InsertFormatMapping(&map, GL_LUMINANCE_ALPHA,    GL_FLOAT,                          GL_LUMINANCE_ALPHA32F_EXT, WriteColor<L32A32F, GLfloat>      );
-    InsertFormatMapping(&map, GL_LUMINANCE,          GL_FLOAT,                          GL_LUMINANCE32F_EXT,       WriteColor<L32F, GLfloat>         );
-    InsertFormatMapping(&map, GL_ALPHA,              GL_FLOAT,                          GL_ALPHA32F_EXT,           WriteColor<A32F, GLfloat>         );
-    InsertFormatMapping(&map, GL_LUMINANCE_ALPHA,    GL_HALF_FLOAT,                     GL_LUMINANCE_ALPHA16F_EXT, WriteColor<L16A16F, GLfloat>      );
-    InsertFormatMapping(&map, GL_LUMINANCE_ALPHA,    GL_HALF_FLOAT_OES,                 GL_LUMINANCE_ALPHA16F_EXT, WriteColor<L16A16F, GLfloat>      );
-    InsertFormatMapping(&map, GL_LUMINANCE,          GL_HALF_FLOAT,                     GL_LUMINANCE16F_EXT,       WriteColor<L16F, GLfloat>         );
-    InsertFormatMapping(&map, GL_LUMINANCE,          GL_HALF_FLOAT_OES,                 GL_LUMINANCE16F_EXT,       WriteColor<L16F, GLfloat>         );
-    InsertFormatMapping(&map, GL_ALPHA,              GL_HALF_FLOAT,                     GL_ALPHA16F_EXT,           WriteColor<A16F, GLfloat>         );
-    InsertFormatMapping(&map, GL_ALPHA,              GL_HALF_FLOAT_OES,                 GL_ALPHA16F_EXT,           WriteColor<A16F, GLfloat>         );
-
-    InsertFormatMapping(&map, GL_BGRA_EXT,           GL_UNSIGNED_BYTE,                  GL_BGRA8_EXT,              WriteColor<B8G8R8A8, GLfloat>     );
-    InsertFormatMapping(&map, GL_BGRA_EXT,           GL_UNSIGNED_SHORT_4_4_4_4_REV_EXT, GL_BGRA4_ANGLEX,           WriteColor<B4G4R4A4, GLfloat>     );
-    InsertFormatMapping(&map, GL_BGRA_EXT,           GL_UNSIGNED_SHORT_1_5_5_5_REV_EXT, GL_BGR5_A1_ANGLEX,         WriteColor<B5G5R5A1, GLfloat>     );
-
-    InsertFormatMapping(&map, GL_SRGB_EXT,           GL_UNSIGNED_BYTE,                  GL_SRGB8,                  WriteColor<R8G8B8, GLfloat>       );
-    InsertFormatMapping(&map, GL_SRGB_ALPHA_EXT,     GL_UNSIGNED_BYTE,                  GL_SRGB8_ALPHA8,           WriteColor<R8G8B8A8, GLfloat>     );
-
-    InsertFormatMapping(&map, GL_COMPRESSED_RGB_S3TC_DXT1_EXT,    GL_UNSIGNED_BYTE,     GL_COMPRESSED_RGB_S3TC_DXT1_EXT,    NULL                     );
-    InsertFormatMapping(&map, GL_COMPRESSED_RGBA_S3TC_DXT1_EXT,   GL_UNSIGNED_BYTE,     GL_COMPRESSED_RGBA_S3TC_DXT1_EXT,   NULL                     );
-    InsertFormatMapping(&map, GL_COMPRESSED_RGBA_S3TC_DXT3_ANGLE, GL_UNSIGNED_BYTE,     GL_COMPRESSED_RGBA_S3TC_DXT3_ANGLE, NULL                     );
-    InsertFormatMapping(&map, GL_COMPRESSED_RGBA_S3TC_DXT5_ANGLE, GL_UNSIGNED_BYTE,     GL_COMPRESSED_RGBA_S3TC_DXT5_ANGLE, NULL                     );
-
-    InsertFormatMapping(&map, GL_DEPTH_COMPONENT,    GL_UNSIGNED_SHORT,                 GL_DEPTH_COMPONENT16,      NULL                              );
-    InsertFormatMapping(&map, GL_DEPTH_COMPONENT,    GL_UNSIGNED_INT,                   GL_DEPTH_COMPONENT32_OES,  NULL                              );
-    InsertFormatMapping(&map, GL_DEPTH_COMPONENT,    GL_FLOAT,                          GL_DEPTH_COMPONENT32F,     NULL                              );
-
-    InsertFormatMapping(&map, GL_STENCIL,            GL_UNSIGNED_BYTE,                  GL_STENCIL_INDEX8,         NULL                              );
-
-    InsertFormatMapping(&map, GL_DEPTH_STENCIL,      GL_UNSIGNED_INT_24_8,              GL_DEPTH24_STENCIL8,       NULL                              );
-    InsertFormatMapping(&map, GL_DEPTH_STENCIL,      GL_FLOAT_32_UNSIGNED_INT_24_8_REV, GL_DEPTH32F_STENCIL8,      NULL                              );
-
-    return map;
-}
-
-Type::Type()
-    : bytes(0),
-      specialInterpretation(false)
-{
-}
-
-// Map of sizes of input types
-typedef std::pair<GLenum, Type> TypeInfoPair;
-typedef std::map<GLenum, Type> TypeInfoMap;
-
-static inline void InsertTypeInfo(TypeInfoMap *map, GLenum type, GLuint bytes, bool specialInterpretation)
-{
+};
+
+using namespace rx;
+
+static const FormatTypeInfoEntry FormatTypeInfoTable[] =
+{
+    // Format                           | Type                               | Internal format                   | Color write function
+    { GL_STENCIL,                         GL_UNSIGNED_BYTE,                  { GL_STENCIL_INDEX8,                  NULL } },
+    { GL_DEPTH_COMPONENT,                 GL_UNSIGNED_SHORT,                 { GL_DEPTH_COMPONENT16,               NULL } },
+    { GL_DEPTH_COMPONENT,                 GL_UNSIGNED_INT,                   { GL_DEPTH_COMPONENT32_OES,           NULL } },
+    { GL_DEPTH_COMPONENT,                 GL_FLOAT,                          { GL_DEPTH_COMPONENT32F,              NULL } },
+    { GL_RED,                             GL_BYTE,                           { GL_R8_SNORM,                        WriteColor<R8S, GLfloat> } },
+    { GL_RED,                             GL_UNSIGNED_BYTE,                  { GL_R8,                              WriteColor<R8, GLfloat> } },
+    { GL_RED,                             GL_FLOAT,                          { GL_R32F,                            WriteColor<R32F, GLfloat> } },
+    { GL_RED,                             GL_HALF_FLOAT,                     { GL_R16F,                            WriteColor<R16F, GLfloat> } },
+    { GL_RED,                             GL_HALF_FLOAT_OES,                 { GL_R16F,                            WriteColor<R16F, GLfloat> } },
+    { GL_ALPHA,                           GL_UNSIGNED_BYTE,                  { GL_ALPHA8_EXT,                      WriteColor<A8, GLfloat> } },
+    { GL_ALPHA,                           GL_FLOAT,                          { GL_ALPHA32F_EXT,                    WriteColor<A32F, GLfloat> } },
+    { GL_ALPHA,                           GL_HALF_FLOAT,                     { GL_ALPHA16F_EXT,                    WriteColor<A16F, GLfloat> } },
+    { GL_ALPHA,                           GL_HALF_FLOAT_OES,                 { GL_ALPHA16F_EXT,                    WriteColor<A16F, GLfloat> } },
+    { GL_RGB,                             GL_BYTE,                           { GL_RGB8_SNORM,                      WriteColor<R8G8B8S, GLfloat> } },
+    { GL_RGB,                             GL_UNSIGNED_BYTE,                  { GL_RGB8,                            WriteColor<R8G8B8, GLfloat> } },
+    { GL_RGB,                             GL_FLOAT,                          { GL_RGB32F,                          WriteColor<R32G32B32F, GLfloat> } },
+    { GL_RGB,                             GL_HALF_FLOAT,                     { GL_RGB16F,                          WriteColor<R16G16B16F, GLfloat> } },
+    { GL_RGB,                             GL_UNSIGNED_SHORT_5_6_5,           { GL_RGB565,                          WriteColor<R5G6B5, GLfloat> } },
+    { GL_RGB,                             GL_UNSIGNED_INT_10F_11F_11F_REV,   { GL_R11F_G11F_B10F,                  WriteColor<R11G11B10F, GLfloat> } },
+    { GL_RGB,                             GL_UNSIGNED_INT_5_9_9_9_REV,       { GL_RGB9_E5,                         WriteColor<R9G9B9E5, GLfloat> } },
+    { GL_RGB,                             GL_HALF_FLOAT_OES,                 { GL_RGB16F,                          WriteColor<R16G16B16F, GLfloat> } },
+    { GL_RGBA,                            GL_BYTE,                           { GL_RGBA8_SNORM,                     WriteColor<R8G8B8A8S, GLfloat> } },
+    { GL_RGBA,                            GL_UNSIGNED_BYTE,                  { GL_RGBA8,                           WriteColor<R8G8B8A8, GLfloat> } },
+    { GL_RGBA,                            GL_FLOAT,                          { GL_RGBA32F,                         WriteColor<R32G32B32A32F, GLfloat> } },
+    { GL_RGBA,                            GL_HALF_FLOAT,                     { GL_RGBA16F,                         WriteColor<R16G16B16A16F, GLfloat> } },
+    { GL_RGBA,                            GL_UNSIGNED_SHORT_4_4_4_4,         { GL_RGBA4,                           WriteColor<R4G4B4A4, GLfloat> } },
+    { GL_RGBA,                            GL_UNSIGNED_SHORT_5_5_5_1,         { GL_RGB5_A1,                         WriteColor<R5G5B5A1, GLfloat> } },
+    { GL_RGBA,                            GL_UNSIGNED_INT_2_10_10_10_REV,    { GL_RGB10_A2,                        WriteColor<R10G10B10A2, GLfloat> } },
+    { GL_RGBA,                            GL_HALF_FLOAT_OES,                 { GL_RGBA16F,                         WriteColor<R16G16B16A16F, GLfloat> } },
+    { GL_LUMINANCE,                       GL_UNSIGNED_BYTE,                  { GL_LUMINANCE8_EXT,                  WriteColor<L8, GLfloat> } },
+    { GL_LUMINANCE,                       GL_FLOAT,                          { GL_LUMINANCE32F_EXT,                WriteColor<L32F, GLfloat> } },
+    { GL_LUMINANCE,                       GL_HALF_FLOAT,                     { GL_LUMINANCE16F_EXT,                WriteColor<L16F, GLfloat> } },
+    { GL_LUMINANCE,                       GL_HALF_FLOAT_OES,                 { GL_LUMINANCE16F_EXT,                WriteColor<L16F, GLfloat> } },
+    { GL_LUMINANCE_ALPHA,                 GL_UNSIGNED_BYTE,                  { GL_LUMINANCE8_ALPHA8_EXT,           WriteColor<L8A8, GLfloat> } },
+    { GL_LUMINANCE_ALPHA,                 GL_FLOAT,                          { GL_LUMINANCE_ALPHA32F_EXT,          WriteColor<L32A32F, GLfloat> } },
+    { GL_LUMINANCE_ALPHA,                 GL_HALF_FLOAT,                     { GL_LUMINANCE_ALPHA16F_EXT,          WriteColor<L16A16F, GLfloat> } },
+    { GL_LUMINANCE_ALPHA,                 GL_HALF_FLOAT_OES,                 { GL_LUMINANCE_ALPHA16F_EXT,          WriteColor<L16A16F, GLfloat> } },
+    { GL_BGRA_EXT,                        GL_UNSIGNED_BYTE,                  { GL_BGRA8_EXT,                       WriteColor<B8G8R8A8, GLfloat> } },
+    { GL_BGRA_EXT,                        GL_UNSIGNED_SHORT_4_4_4_4_REV_EXT, { GL_BGRA4_ANGLEX,                    WriteColor<B4G4R4A4, GLfloat> } },
+    { GL_BGRA_EXT,                        GL_UNSIGNED_SHORT_1_5_5_5_REV_EXT, { GL_BGR5_A1_ANGLEX,                  WriteColor<B5G5R5A1, GLfloat> } },
+    { GL_RG,                              GL_BYTE,                           { GL_RG8_SNORM,                       WriteColor<R8G8S, GLfloat> } },
+    { GL_RG,                              GL_UNSIGNED_BYTE,                  { GL_RG8,                             WriteColor<R8G8, GLfloat> } },
+    { GL_RG,                              GL_FLOAT,                          { GL_RG32F,                           WriteColor<R32G32F, GLfloat> } },
+    { GL_RG,                              GL_HALF_FLOAT,                     { GL_RG16F,                           WriteColor<R16G16F, GLfloat> } },
+    { GL_RG,                              GL_HALF_FLOAT_OES,                 { GL_RG16F,                           WriteColor<R16G16F, GLfloat> } },
+    { GL_RG_INTEGER,                      GL_BYTE,                           { GL_RG8I,                            WriteColor<R8G8S, GLint> } },
+    { GL_RG_INTEGER,                      GL_UNSIGNED_BYTE,                  { GL_RG8UI,                           WriteColor<R8G8, GLuint> } },
+    { GL_RG_INTEGER,                      GL_SHORT,                          { GL_RG16I,                           WriteColor<R16G16S, GLint> } },
+    { GL_RG_INTEGER,                      GL_UNSIGNED_SHORT,                 { GL_RG16UI,                          WriteColor<R16G16, GLuint> } },
+    { GL_RG_INTEGER,                      GL_INT,                            { GL_RG32I,                           WriteColor<R32G32S, GLint> } },
+    { GL_RG_INTEGER,                      GL_UNSIGNED_INT,                   { GL_RG32UI,                          WriteColor<R32G32, GLuint> } },
+    { GL_COMPRESSED_RGB_S3TC_DXT1_EXT,    GL_UNSIGNED_BYTE,                  { GL_COMPRESSED_RGB_S3TC_DXT1_EXT,    NULL } },
+    { GL_COMPRESSED_RGBA_S3TC_DXT1_EXT,   GL_UNSIGNED_BYTE,                  { GL_COMPRESSED_RGBA_S3TC_DXT1_EXT,   NULL } },
+    { GL_COMPRESSED_RGBA_S3TC_DXT3_ANGLE, GL_UNSIGNED_BYTE,                  { GL_COMPRESSED_RGBA_S3TC_DXT3_ANGLE, NULL } },
+    { GL_COMPRESSED_RGBA_S3TC_DXT5_ANGLE, GL_UNSIGNED_BYTE,                  { GL_COMPRESSED_RGBA_S3TC_DXT5_ANGLE, NULL } },
+    { GL_DEPTH_STENCIL,                   GL_UNSIGNED_INT_24_8,              { GL_DEPTH24_STENCIL8,                NULL } },
+    { GL_DEPTH_STENCIL,                   GL_FLOAT_32_UNSIGNED_INT_24_8_REV, { GL_DEPTH32F_STENCIL8,               NULL } },
+    { GL_SRGB_EXT,                        GL_UNSIGNED_BYTE,                  { GL_SRGB8,                           WriteColor<R8G8B8, GLfloat> } },
+    { GL_SRGB_ALPHA_EXT,                  GL_UNSIGNED_BYTE,                  { GL_SRGB8_ALPHA8,                    WriteColor<R8G8B8A8, GLfloat> } },
+    { GL_RED_INTEGER,                     GL_BYTE,                           { GL_R8I,                             WriteColor<R8S, GLint> } },
+    { GL_RED_INTEGER,                     GL_UNSIGNED_BYTE,                  { GL_R8UI,                            WriteColor<R8, GLuint> } },
+    { GL_RED_INTEGER,                     GL_SHORT,                          { GL_R16I,                            WriteColor<R16S, GLint> } },
+    { GL_RED_INTEGER,                     GL_UNSIGNED_SHORT,                 { GL_R16UI,                           WriteColor<R16, GLuint> } },
+    { GL_RED_INTEGER,                     GL_INT,                            { GL_R32I,                            WriteColor<R32S, GLint> } },
+    { GL_RED_INTEGER,                     GL_UNSIGNED_INT,                   { GL_R32UI,                           WriteColor<R32, GLuint> } },
+    { GL_RGB_INTEGER,                     GL_BYTE,                           { GL_RGB8I,                           WriteColor<R8G8B8S, GLint> } },
+    { GL_RGB_INTEGER,                     GL_UNSIGNED_BYTE,                  { GL_RGB8UI,                          WriteColor<R8G8B8, GLuint> } },
+    { GL_RGB_INTEGER,                     GL_SHORT,                          { GL_RGB16I,                          WriteColor<R16G16B16S, GLint> } },
+    { GL_RGB_INTEGER,                     GL_UNSIGNED_SHORT,                 { GL_RGB16UI,                         WriteColor<R16G16B16, GLuint> } },
+    { GL_RGB_INTEGER,                     GL_INT,                            { GL_RGB32I,                          WriteColor<R32G32B32S, GLint> } },
+    { GL_RGB_INTEGER,                     GL_UNSIGNED_INT,                   { GL_RGB32UI,                         WriteColor<R32G32B32, GLuint> } },
+    { GL_RGBA_INTEGER,                    GL_BYTE,                           { GL_RGBA8I,                          WriteColor<R8G8B8A8S, GLint> } },
+    { GL_RGBA_INTEGER,                    GL_UNSIGNED_BYTE,                  { GL_RGBA8UI,                         WriteColor<R8G8B8A8, GLuint> } },
+    { GL_RGBA_INTEGER,                    GL_SHORT,                          { GL_RGBA16I,                         WriteColor<R16G16B16A16S, GLint> } },
+    { GL_RGBA_INTEGER,                    GL_UNSIGNED_SHORT,                 { GL_RGBA16UI,                        WriteColor<R16G16B16A16, GLuint> } },
+    { GL_RGBA_INTEGER,                    GL_INT,                            { GL_RGBA32I,                         WriteColor<R32G32B32A32S, GLint> } },
+    { GL_RGBA_INTEGER,                    GL_UNSIGNED_INT,                   { GL_RGBA32UI,                        WriteColor<R32G32B32A32, GLuint> } },
+    { GL_RGBA_INTEGER,                    GL_UNSIGNED_INT_2_10_10_10_REV,    { GL_RGB10_A2UI,                      WriteColor<R10G10B10A2, GLuint> } },
+};
+
+// Sizes of input types
+struct TypeInfoEntry
+{
+    GLenum type;
     Type info;
-    info.bytes = bytes;
-    info.specialInterpretation = specialInterpretation;
-
-    map->insert(std::make_pair(type, info));
-}
-
-bool operator<(const Type& a, const Type& b)
-{
-    return memcmp(&a, &b, sizeof(Type)) < 0;
-}
-
-static TypeInfoMap BuildTypeInfoMap()
-{
-    TypeInfoMap map;
-
-    InsertTypeInfo(&map, GL_UNSIGNED_BYTE,                  1, false);
-    InsertTypeInfo(&map, GL_BYTE,                           1, false);
-    InsertTypeInfo(&map, GL_UNSIGNED_SHORT,                 2, false);
-    InsertTypeInfo(&map, GL_SHORT,                          2, false);
-    InsertTypeInfo(&map, GL_UNSIGNED_INT,                   4, false);
-    InsertTypeInfo(&map, GL_INT,                            4, false);
-    InsertTypeInfo(&map, GL_HALF_FLOAT,                     2, false);
-    InsertTypeInfo(&map, GL_HALF_FLOAT_OES,                 2, false);
-    InsertTypeInfo(&map, GL_FLOAT,                          4, false);
-    InsertTypeInfo(&map, GL_UNSIGNED_SHORT_5_6_5,           2, true );
-    InsertTypeInfo(&map, GL_UNSIGNED_SHORT_4_4_4_4,         2, true );
-    InsertTypeInfo(&map, GL_UNSIGNED_SHORT_5_5_5_1,         2, true );
-    InsertTypeInfo(&map, GL_UNSIGNED_SHORT_4_4_4_4_REV_EXT, 2, true );
-    InsertTypeInfo(&map, GL_UNSIGNED_SHORT_1_5_5_5_REV_EXT, 2, true );
-    InsertTypeInfo(&map, GL_UNSIGNED_INT_2_10_10_10_REV,    4, true );
-    InsertTypeInfo(&map, GL_UNSIGNED_INT_24_8,              4, true );
-    InsertTypeInfo(&map, GL_UNSIGNED_INT_10F_11F_11F_REV,   4, true );
-    InsertTypeInfo(&map, GL_UNSIGNED_INT_5_9_9_9_REV,       4, true );
-    InsertTypeInfo(&map, GL_UNSIGNED_INT_24_8_OES,          4, true );
-    InsertTypeInfo(&map, GL_FLOAT_32_UNSIGNED_INT_24_8_REV, 8, true );
-
-    return map;
-}
+};
+
+static const TypeInfoEntry TypeInfoTable[] =
+{
+    // Type                              | Bytes | Special interpretation
+    { GL_BYTE,                           {     1, false } },
+    { GL_UNSIGNED_BYTE,                  {     1, false } },
+    { GL_SHORT,                          {     2, false } },
+    { GL_UNSIGNED_SHORT,                 {     2, false } },
+    { GL_INT,                            {     4, false } },
+    { GL_UNSIGNED_INT,                   {     4, false } },
+    { GL_FLOAT,                          {     4, false } },
+    { GL_HALF_FLOAT,                     {     2, false } },
+    { GL_UNSIGNED_SHORT_4_4_4_4,         {     2, true } },
+    { GL_UNSIGNED_SHORT_5_5_5_1,         {     2, true } },
+    { GL_UNSIGNED_SHORT_5_6_5,           {     2, true } },
+    { GL_UNSIGNED_SHORT_4_4_4_4_REV_EXT, {     2, true } },
+    { GL_UNSIGNED_SHORT_1_5_5_5_REV_EXT, {     2, true } },
+    { GL_UNSIGNED_INT_2_10_10_10_REV,    {     4, true } },
+    { GL_UNSIGNED_INT_24_8,              {     4, true } },
+    { GL_UNSIGNED_INT_10F_11F_11F_REV,   {     4, true } },
+    { GL_UNSIGNED_INT_5_9_9_9_REV,       {     4, true } },
+    { GL_HALF_FLOAT_OES,                 {     2, false } },
+    { GL_FLOAT_32_UNSIGNED_INT_24_8_REV, {     8, true } },
+};
 
 // Information about internal formats
 static bool AlwaysSupported(GLuint, const Extensions &)
@@ -201,11 +153,6 @@ static bool AlwaysSupported(GLuint, const Extensions &)
     return true;
 }
 
-static bool UnimplementedSupport(GLuint, const Extensions &)
-{
-    return false;
-}
-
 static bool NeverSupported(GLuint, const Extensions &)
 {
     return false;
@@ -254,282 +201,169 @@ static bool RequireExtAndExt(GLuint, const Extensions &extensions)
 {
     return extensions.*bool1 && extensions.*bool2;
 }
+// From ES 3.0.1 spec, tables 3.12 and 3.16, plus the formats of the extensions ANGLE exposes.
+// Unsized formats only have their format and support checks, compressed formats store the size
+// of a block in pixelBytes.
+struct InternalFormatInfoEntry
+{
+    GLenum internalFormat;
+    InternalFormat info;
+};
+
+static const InternalFormatInfoEntry InternalFormatInfoTable[] =
+{
+    // Internal format                              | R | G | B | L | A | S | D | S | Bytes | CC | Compressed | W | H | Format                               | Type                             | Component type        | Encoding | Texture supported                                                             | Renderable                                                                         | Filterable
+    { GL_NONE,                                      {  0,  0,  0,  0,  0, 0,  0, 0,     0,  0, false,      0, 0, GL_NONE,                                      GL_NONE,                           GL_NONE,                GL_NONE,   NeverSupported,                                                                 NeverSupported,                                                                      NeverSupported } },
+    { GL_DEPTH_COMPONENT,                           {  0,  0,  0,  0,  0, 0,  0, 0,     0,  0, false,      0, 0, GL_DEPTH_COMPONENT,                           GL_NONE,                           GL_NONE,                GL_NONE,   RequireES<2>,                                                                   RequireES<2>,                                                                        AlwaysSupported } },
+    { GL_RED,                                       {  0,  0,  0,  0,  0, 0,  0, 0,     0,  0, false,      0, 0, GL_RED,                                       GL_NONE,                           GL_NONE,                GL_NONE,   RequireESOrExt<3, &Extensions::textureRG>,                                      NeverSupported,                                                                      AlwaysSupported } },
+    { GL_ALPHA,                                     {  0,  0,  0,  0,  0, 0,  0, 0,     0,  0, false,      0, 0, GL_ALPHA,                                     GL_NONE,                           GL_NONE,                GL_NONE,   RequireES<2>,                                                                   NeverSupported,                                                                      AlwaysSupported } },
+    { GL_RGB,                                       {  0,  0,  0,  0,  0, 0,  0, 0,     0,  0, false,      0, 0, GL_RGB,                                       GL_NONE,                           GL_NONE,                GL_NONE,   RequireES<2>,                                                                   RequireES<2>,                                                                        AlwaysSupported } },
+    { GL_RGBA,                                      {  0,  0,  0,  0,  0, 0,  0, 0,     0,  0, false,      0, 0, GL_RGBA,                                      GL_NONE,                           GL_NONE,                GL_NONE,   RequireES<2>,                                                                   RequireES<2>,                                                                        AlwaysSupported } },
+    { GL_LUMINANCE,                                 {  0,  0,  0,  0,  0, 0,  0, 0,     0,  0, false,      0, 0, GL_LUMINANCE,                                 GL_NONE,                           GL_NONE,                GL_NONE,   RequireES<2>,                                                                   NeverSupported,                                                                      AlwaysSupported } },
+    { GL_LUMINANCE_ALPHA,                           {  0,  0,  0,  0,  0, 0,  0, 0,     0,  0, false,      0, 0, GL_LUMINANCE_ALPHA,                           GL_NONE,                           GL_NONE,                GL_NONE,   RequireES<2>,                                                                   NeverSupported,                                                                      AlwaysSupported } },
+    { GL_BGRA4_ANGLEX,                              {  4,  4,  4,  0,  4, 0,  0, 0,     2,  4, false,      0, 0, GL_BGRA_EXT,                                  GL_UNSIGNED_SHORT_4_4_4_4_REV_EXT, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureFormatBGRA8888>,                                 RequireExt<&Extensions::textureFormatBGRA8888>,                                      AlwaysSupported } },
+    { GL_BGR5_A1_ANGLEX,                            {  5,  5,  5,  0,  1, 0,  0, 0,     2,  4, false,      0, 0, GL_BGRA_EXT,                                  GL_UNSIGNED_SHORT_1_5_5_5_REV_EXT, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureFormatBGRA8888>,                                 RequireExt<&Extensions::textureFormatBGRA8888>,                                      AlwaysSupported } },
+    { GL_ALPHA8_EXT,                                {  0,  0,  0,  0,  8, 0,  0, 0,     1,  1, false,      0, 0, GL_ALPHA,                                     GL_UNSIGNED_BYTE,                  GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureStorage>,                                        NeverSupported,                                                                      AlwaysSupported } },
+    { GL_LUMINANCE8_EXT,                            {  0,  0,  0,  8,  0, 0,  0, 0,     1,  1, false,      0, 0, GL_LUMINANCE,                                 GL_UNSIGNED_BYTE,                  GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureStorage>,                                        NeverSupported,                                                                      AlwaysSupported } },
+    { GL_LUMINANCE8_ALPHA8_EXT,                     {  0,  0,  0,  8,  8, 0,  0, 0,     2,  2, false,      0, 0, GL_LUMINANCE_ALPHA,                           GL_UNSIGNED_BYTE,                  GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureStorage>,                                        NeverSupported,                                                                      AlwaysSupported } },
+    { GL_RGB8,                                      {  8,  8,  8,  0,  0, 0,  0, 0,     3,  3, false,      0, 0, GL_RGB,                                       GL_UNSIGNED_BYTE,                  GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireESOrExt<3, &Extensions::rgb8rgba8>,                                      RequireESOrExt<3, &Extensions::rgb8rgba8>,                                           AlwaysSupported } },
+    { GL_RGBA4,                                     {  4,  4,  4,  0,  4, 0,  0, 0,     2,  4, false,      0, 0, GL_RGBA,                                      GL_UNSIGNED_SHORT_4_4_4_4,         GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<2>,                                                                   RequireES<2>,                                                                        AlwaysSupported } },
+    { GL_RGB5_A1,                                   {  5,  5,  5,  0,  1, 0,  0, 0,     2,  4, false,      0, 0, GL_RGBA,                                      GL_UNSIGNED_SHORT_5_5_5_1,         GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<2>,                                                                   RequireES<2>,                                                                        AlwaysSupported } },
+    { GL_RGBA8,                                     {  8,  8,  8,  0,  8, 0,  0, 0,     4,  4, false,      0, 0, GL_RGBA,                                      GL_UNSIGNED_BYTE,                  GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireESOrExt<3, &Extensions::rgb8rgba8>,                                      RequireESOrExt<3, &Extensions::rgb8rgba8>,                                           AlwaysSupported } },
+    { GL_RGB10_A2,                                  { 10, 10, 10,  0,  2, 0,  0, 0,     4,  4, false,      0, 0, GL_RGBA,                                      GL_UNSIGNED_INT_2_10_10_10_REV,    GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<3>,                                                                   RequireES<3>,                                                                        AlwaysSupported } },
+    { GL_BGRA_EXT,                                  {  0,  0,  0,  0,  0, 0,  0, 0,     0,  0, false,      0, 0, GL_BGRA_EXT,                                  GL_NONE,                           GL_NONE,                GL_NONE,   RequireExt<&Extensions::textureFormatBGRA8888>,                                 RequireExt<&Extensions::textureFormatBGRA8888>,                                      AlwaysSupported } },
+    { GL_DEPTH_COMPONENT16,                         {  0,  0,  0,  0,  0, 0, 16, 0,     2,  1, false,      0, 0, GL_DEPTH_COMPONENT,                           GL_UNSIGNED_SHORT,                 GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<2>,                                                                   RequireES<2>,                                                                        RequireESOrExt<3, &Extensions::depthTextures> } },
+    { GL_DEPTH_COMPONENT24,                         {  0,  0,  0,  0,  0, 0, 24, 0,     3,  1, false,      0, 0, GL_DEPTH_COMPONENT,                           GL_UNSIGNED_INT,                   GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<3>,                                                                   RequireES<3>,                                                                        RequireESOrExt<3, &Extensions::depthTextures> } },
+    { GL_DEPTH_COMPONENT32_OES,                     {  0,  0,  0,  0,  0, 0, 32, 0,     4,  1, false,      0, 0, GL_DEPTH_COMPONENT,                           GL_UNSIGNED_INT,                   GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::depthTextures>,                                         RequireExt<&Extensions::depthTextures>,                                              AlwaysSupported } },
+    { GL_RG,                                        {  0,  0,  0,  0,  0, 0,  0, 0,     0,  0, false,      0, 0, GL_RG,                                        GL_NONE,                           GL_NONE,                GL_NONE,   RequireESOrExt<3, &Extensions::textureRG>,                                      NeverSupported,                                                                      AlwaysSupported } },
+    { GL_RG_INTEGER,                                {  0,  0,  0,  0,  0, 0,  0, 0,     0,  0, false,      0, 0, GL_RG_INTEGER,                                GL_NONE,                           GL_NONE,                GL_NONE,   RequireES<3>,                                                                   NeverSupported,                                                                      NeverSupported } },
+    { GL_R8,                                        {  8,  0,  0,  0,  0, 0,  0, 0,     1,  1, false,      0, 0, GL_RED,                                       GL_UNSIGNED_BYTE,                  GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireESOrExt<3, &Extensions::textureRG>,                                      RequireESOrExt<3, &Extensions::textureRG>,                                           AlwaysSupported } },
+    { GL_RG8,                                       {  8,  8,  0,  0,  0, 0,  0, 0,     2,  2, false,      0, 0, GL_RG,                                        GL_UNSIGNED_BYTE,                  GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireESOrExt<3, &Extensions::textureRG>,                                      RequireESOrExt<3, &Extensions::textureRG>,                                           AlwaysSupported } },
+    { GL_R16F,                                      { 16,  0,  0,  0,  0, 0,  0, 0,     2,  1, false,      0, 0, GL_RED,                                       GL_HALF_FLOAT,                     GL_FLOAT,               GL_LINEAR, RequireESOrExtAndExt<3, &Extensions::textureHalfFloat, &Extensions::textureRG>, RequireESOrExtAndExt<3, &Extensions::textureHalfFloat, &Extensions::textureRG>,      RequireExt<&Extensions::textureHalfFloatLinear> } },
+    { GL_R32F,                                      { 32,  0,  0,  0,  0, 0,  0, 0,     4,  1, false,      0, 0, GL_RED,                                       GL_FLOAT,                          GL_FLOAT,               GL_LINEAR, RequireESOrExtAndExt<3, &Extensions::textureFloat, &Extensions::textureRG>,     RequireESOrExtAndExt<3, &Extensions::textureFloat, &Extensions::textureRG>,          RequireExt<&Extensions::textureFloatLinear> } },
+    { GL_RG16F,                                     { 16, 16,  0,  0,  0, 0,  0, 0,     4,  2, false,      0, 0, GL_RG,                                        GL_HALF_FLOAT,                     GL_FLOAT,               GL_LINEAR, RequireESOrExtAndExt<3, &Extensions::textureHalfFloat, &Extensions::textureRG>, RequireESOrExtAndExt<3, &Extensions::textureHalfFloat, &Extensions::textureRG>,      RequireExt<&Extensions::textureHalfFloatLinear> } },
+    { GL_RG32F,                                     { 32, 32,  0,  0,  0, 0,  0, 0,     8,  2, false,      0, 0, GL_RG,                                        GL_FLOAT,                          GL_FLOAT,               GL_LINEAR, RequireESOrExtAndExt<3, &Extensions::textureFloat, &Extensions::textureRG>,     RequireESOrExtAndExt<3, &Extensions::textureFloat, &Extensions::textureRG>,          RequireExt<&Extensions::textureFloatLinear> } },
+    { GL_R8I,                                       {  8,  0,  0,  0,  0, 0,  0, 0,     1,  1, false,      0, 0, GL_RED_INTEGER,                               GL_BYTE,                           GL_INT,                 GL_LINEAR, RequireES<3>,                                                                   RequireES<3>,                                                                        NeverSupported } },
+    { GL_R8UI,                                      {  8,  0,  0,  0,  0, 0,  0, 0,     1,  1, false,      0, 0, GL_RED_INTEGER,                               GL_UNSIGNED_BYTE,                  GL_UNSIGNED_INT,        GL_LINEAR, RequireES<3>,                                                                   RequireES<3>,                                                                        NeverSupported } },
+    { GL_R16I,                                      { 16,  0,  0,  0,  0, 0,  0, 0,     2,  1, false,      0, 0, GL_RED_INTEGER,                               GL_SHORT,                          GL_INT,                 GL_LINEAR, RequireES<3>,                                                                   RequireES<3>,                                                                        NeverSupported } },
+    { GL_R16UI,                                     { 16,  0,  0,  0,  0, 0,  0, 0,     2,  1, false,      0, 0, GL_RED_INTEGER,                               GL_UNSIGNED_SHORT,                 GL_UNSIGNED_INT,        GL_LINEAR, RequireES<3>,                                                                   RequireES<3>,                                                                        NeverSupported } },
+    { GL_R32I,                                      { 32,  0,  0,  0,  0, 0,  0, 0,     4,  1, false,      0, 0, GL_RED_INTEGER,                               GL_INT,                            GL_INT,                 GL_LINEAR, RequireES<3>,                                                                   RequireES<3>,                                                                        NeverSupported } },
+    { GL_R32UI,                                     { 32,  0,  0,  0,  0, 0,  0, 0,     4,  1, false,      0, 0, GL_RED_INTEGER,                               GL_UNSIGNED_INT,                   GL_UNSIGNED_INT,        GL_LINEAR, RequireES<3>,                                                                   RequireES<3>,                                                                        NeverSupported } },
+    { GL_RG8I,                                      {  8,  8,  0,  0,  0, 0,  0, 0,     2,  2, false,      0, 0, GL_RG_INTEGER,                                GL_BYTE,                           GL_INT,                 GL_LINEAR, RequireES<3>,                                                                   RequireES<3>,                                                                        NeverSupported } },
+    { GL_RG8UI,                                     {  8,  8,  0,  0,  0, 0,  0, 0,     2,  2, false,      0, 0, GL_RG_INTEGER,                                GL_UNSIGNED_BYTE,                  GL_UNSIGNED_INT,        GL_LINEAR, RequireES<3>,                                                                   RequireES<3>,                                                                        NeverSupported } },
+    { GL_RG16I,                                     { 16, 16,  0,  0,  0, 0,  0, 0,     4,  2, false,      0, 0, GL_RG_INTEGER,                                GL_SHORT,                          GL_INT,                 GL_LINEAR, RequireES<3>,                                                                   RequireES<3>,                                                                        NeverSupported } },
+    { GL_RG16UI,                                    { 16, 16,  0,  0,  0, 0,  0, 0,     4,  2, false,      0, 0, GL_RG_INTEGER,                                GL_UNSIGNED_SHORT,                 GL_UNSIGNED_INT,        GL_LINEAR, RequireES<3>,                                                                   RequireES<3>,                                                                        NeverSupported } },
+    { GL_RG32I,                                     { 32, 32,  0,  0,  0, 0,  0, 0,     8,  2, false,      0, 0, GL_RG_INTEGER,                                GL_INT,                            GL_INT,                 GL_LINEAR, RequireES<3>,                                                                   RequireES<3>,                                                                        NeverSupported } },
+    { GL_RG32UI,                                    { 32, 32,  0,  0,  0, 0,  0, 0,     8,  2, false,      0, 0, GL_RG_INTEGER,                                GL_UNSIGNED_INT,                   GL_UNSIGNED_INT,        GL_LINEAR, RequireES<3>,                                                                   RequireES<3>,                                                                        NeverSupported } },
+    { GL_COMPRESSED_RGB_S3TC_DXT1_EXT,              {  0,  0,  0,  0,  0, 0,  0, 0,     8,  3, true,       4, 4, GL_COMPRESSED_RGB_S3TC_DXT1_EXT,              GL_UNSIGNED_BYTE,                  GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureCompressionDXT1>,                                NeverSupported,                                                                      AlwaysSupported } },
+    { GL_COMPRESSED_RGBA_S3TC_DXT1_EXT,             {  0,  0,  0,  0,  0, 0,  0, 0,     8,  4, true,       4, 4, GL_COMPRESSED_RGBA_S3TC_DXT1_EXT,             GL_UNSIGNED_BYTE,                  GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureCompressionDXT1>,                                NeverSupported,                                                                      AlwaysSupported } },
+    { GL_COMPRESSED_RGBA_S3TC_DXT3_ANGLE,           {  0,  0,  0,  0,  0, 0,  0, 0,    16,  4, true,       4, 4, GL_COMPRESSED_RGBA_S3TC_DXT3_ANGLE,           GL_UNSIGNED_BYTE,                  GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureCompressionDXT5>,                                NeverSupported,                                                                      AlwaysSupported } },
+    { GL_COMPRESSED_RGBA_S3TC_DXT5_ANGLE,           {  0,  0,  0,  0,  0, 0,  0, 0,    16,  4, true,       4, 4, GL_COMPRESSED_RGBA_S3TC_DXT5_ANGLE,           GL_UNSIGNED_BYTE,                  GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureCompressionDXT5>,                                NeverSupported,                                                                      AlwaysSupported } },
+    { GL_DEPTH_STENCIL,                             {  0,  0,  0,  0,  0, 0,  0, 0,     0,  0, false,      0, 0, GL_DEPTH_STENCIL,                             GL_NONE,                           GL_NONE,                GL_NONE,   RequireESOrExt<3, &Extensions::packedDepthStencil>,                             RequireESOrExt<3, &Extensions::packedDepthStencil>,                                  AlwaysSupported } },
+    { GL_RGBA32F,                                   { 32, 32, 32,  0, 32, 0,  0, 0,    16,  4, false,      0, 0, GL_RGBA,                                      GL_FLOAT,                          GL_FLOAT,               GL_LINEAR, RequireESOrExt<3, &Extensions::textureFloat>,                                   RequireESOrExt<3, &Extensions::textureFloat>,                                        RequireExt<&Extensions::textureFloatLinear> } },
+    { GL_RGB32F,                                    { 32, 32, 32,  0,  0, 0,  0, 0,    12,  3, false,      0, 0, GL_RGB,                                       GL_FLOAT,                          GL_FLOAT,               GL_LINEAR, RequireESOrExt<3, &Extensions::textureFloat>,                                   RequireESOrExt<3, &Extensions::textureFloat>,                                        RequireExt<&Extensions::textureFloatLinear> } },
+    { GL_ALPHA32F_EXT,                              {  0,  0,  0,  0, 32, 0,  0, 0,     4,  1, false,      0, 0, GL_ALPHA,                                     GL_FLOAT,                          GL_FLOAT,               GL_LINEAR, RequireExtAndExt<&Extensions::textureStorage, &Extensions::textureFloat>,       NeverSupported,                                                                      AlwaysSupported } },
+    { GL_LUMINANCE32F_EXT,                          {  0,  0,  0, 32,  0, 0,  0, 0,     4,  1, false,      0, 0, GL_LUMINANCE,                                 GL_FLOAT,                          GL_FLOAT,               GL_LINEAR, RequireExtAndExt<&Extensions::textureStorage, &Extensions::textureFloat>,       NeverSupported,                                                                      AlwaysSupported } },
+    { GL_LUMINANCE_ALPHA32F_EXT,                    {  0,  0,  0, 32, 32, 0,  0, 0,     8,  2, false,      0, 0, GL_LUMINANCE_ALPHA,                           GL_FLOAT,                          GL_FLOAT,               GL_LINEAR, RequireExtAndExt<&Extensions::textureStorage, &Extensions::textureFloat>,       NeverSupported,                                                                      AlwaysSupported } },
+    { GL_RGBA16F,                                   { 16, 16, 16,  0, 16, 0,  0, 0,     8,  4, false,      0, 0, GL_RGBA,                                      GL_HALF_FLOAT,                     GL_FLOAT,               GL_LINEAR, RequireESOrExt<3, &Extensions::textureHalfFloat>,                               RequireESOrExt<3, &Extensions::textureHalfFloat>,                                    RequireExt<&Extensions::textureHalfFloatLinear> } },
+    { GL_RGB16F,                                    { 16, 16, 16,  0,  0, 0,  0, 0,     6,  3, false,      0, 0, GL_RGB,                                       GL_HALF_FLOAT,                     GL_FLOAT,               GL_LINEAR, RequireESOrExt<3, &Extensions::textureHalfFloat>,                               RequireESOrExt<3, &Extensions::textureHalfFloat>,                                    RequireExt<&Extensions::textureHalfFloatLinear> } },
+    { GL_ALPHA16F_EXT,                              {  0,  0,  0,  0, 16, 0,  0, 0,     2,  1, false,      0, 0, GL_ALPHA,                                     GL_HALF_FLOAT,                     GL_FLOAT,               GL_LINEAR, RequireExtAndExt<&Extensions::textureStorage, &Extensions::textureHalfFloat>,   NeverSupported,                                                                      AlwaysSupported } },
+    { GL_LUMINANCE16F_EXT,                          {  0,  0,  0, 16,  0, 0,  0, 0,     2,  1, false,      0, 0, GL_LUMINANCE,                                 GL_HALF_FLOAT,                     GL_FLOAT,               GL_LINEAR, RequireExtAndExt<&Extensions::textureStorage, &Extensions::textureHalfFloat>,   NeverSupported,                                                                      AlwaysSupported } },
+    { GL_LUMINANCE_ALPHA16F_EXT,                    {  0,  0,  0, 16, 16, 0,  0, 0,     4,  2, false,      0, 0, GL_LUMINANCE_ALPHA,                           GL_HALF_FLOAT,                     GL_FLOAT,               GL_LINEAR, RequireExtAndExt<&Extensions::textureStorage, &Extensions::textureHalfFloat>,   NeverSupported,                                                                      AlwaysSupported } },
+    { GL_DEPTH24_STENCIL8,                          {  0,  0,  0,  0,  0, 0, 24, 8,     4,  2, false,      0, 0, GL_DEPTH_STENCIL,                             GL_UNSIGNED_INT_24_8,              GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireESOrExt<3, &Extensions::depthTextures>,                                  RequireESOrExtOrExt<3, &Extensions::depthTextures, &Extensions::packedDepthStencil>, AlwaysSupported } },
+    { GL_R11F_G11F_B10F,                            { 11, 11, 10,  0,  0, 0,  0, 0,     4,  3, false,      0, 0, GL_RGB,                                       GL_UNSIGNED_INT_10F_11F_11F_REV,   GL_FLOAT,               GL_LINEAR, RequireES<3>,                                                                   RequireExt<&Extensions::colorBufferFloat>,                                           AlwaysSupported } },
+    { GL_RGB9_E5,                                   {  9,  9,  9,  0,  0, 5,  0, 0,     4,  3, false,      0, 0, GL_RGB,                                       GL_UNSIGNED_INT_5_9_9_9_REV,       GL_FLOAT,               GL_LINEAR, RequireES<3>,                                                                   NeverSupported,                                                                      AlwaysSupported } },
+    { GL_SRGB_EXT,                                  {  0,  0,  0,  0,  0, 0,  0, 0,     0,  0, false,      0, 0, GL_RGB,                                       GL_NONE,                           GL_NONE,                GL_NONE,   RequireESOrExt<3, &Extensions::sRGB>,                                           NeverSupported,                                                                      AlwaysSupported } },
+    { GL_SRGB8,                                     {  8,  8,  8,  0,  0, 0,  0, 0,     3,  3, false,      0, 0, GL_RGB,                                       GL_UNSIGNED_BYTE,                  GL_UNSIGNED_NORMALIZED, GL_SRGB,   RequireESOrExt<3, &Extensions::sRGB>,                                           NeverSupported,                                                                      AlwaysSupported } },
+    { GL_SRGB_ALPHA_EXT,                            {  0,  0,  0,  0,  0, 0,  0, 0,     0,  0, false,      0, 0, GL_RGBA,                                      GL_NONE,                           GL_NONE,                GL_NONE,   RequireESOrExt<3, &Extensions::sRGB>,                                           RequireESOrExt<3, &Extensions::sRGB>,                                                AlwaysSupported } },
+    { GL_SRGB8_ALPHA8,                              {  8,  8,  8,  0,  8, 0,  0, 0,     4,  4, false,      0, 0, GL_RGBA,                                      GL_UNSIGNED_BYTE,                  GL_UNSIGNED_NORMALIZED, GL_SRGB,   RequireESOrExt<3, &Extensions::sRGB>,                                           RequireESOrExt<3, &Extensions::sRGB>,                                                AlwaysSupported } },
+    { GL_DEPTH_COMPONENT32F,                        {  0,  0,  0,  0,  0, 0, 32, 0,     4,  1, false,      0, 0, GL_DEPTH_COMPONENT,                           GL_FLOAT,                          GL_FLOAT,               GL_LINEAR, RequireES<3>,                                                                   RequireES<3>,                                                                        RequireESOrExt<3, &Extensions::depthTextures> } },
+    { GL_DEPTH32F_STENCIL8,                         {  0,  0,  0,  0,  0, 0, 32, 8,     8,  2, false,      0, 0, GL_DEPTH_STENCIL,                             GL_FLOAT_32_UNSIGNED_INT_24_8_REV, GL_FLOAT,               GL_LINEAR, RequireES<3>,                                                                   RequireES<3>,                                                                        AlwaysSupported } },
+    { GL_STENCIL_INDEX8,                            {  0,  0,  0,  0,  0, 0,  0, 8,     1,  1, false,      0, 0, GL_DEPTH_STENCIL,                             GL_UNSIGNED_BYTE,                  GL_UNSIGNED_INT,        GL_LINEAR, RequireES<2>,                                                                   RequireES<2>,                                                                        NeverSupported } },
+    { GL_RGB565,                                    {  5,  6,  5,  0,  0, 0,  0, 0,     2,  3, false,      0, 0, GL_RGB,                                       GL_UNSIGNED_SHORT_5_6_5,           GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<2>,                                                                   RequireES<2>,                                                                        AlwaysSupported } },
+    { GL_RGBA32UI,                                  { 32, 32, 32,  0, 32, 0,  0, 0,    16,  4, false,      0, 0, GL_RGBA_INTEGER,                              GL_UNSIGNED_INT,                   GL_UNSIGNED_INT,        GL_LINEAR, RequireES<3>,                                                                   RequireES<3>,                                                                        NeverSupported } },
+    { GL_RGB32UI,                                   { 32, 32, 32,  0,  0, 0,  0, 0,    12,  3, false,      0, 0, GL_RGB_INTEGER,                               GL_UNSIGNED_INT,                   GL_UNSIGNED_INT,        GL_LINEAR, RequireES<3>,                                                                   NeverSupported,                                                                      NeverSupported } },
+    { GL_RGBA16UI,                                  { 16, 16, 16,  0, 16, 0,  0, 0,     8,  4, false,      0, 0, GL_RGBA_INTEGER,                              GL_UNSIGNED_SHORT,                 GL_UNSIGNED_INT,        GL_LINEAR, RequireES<3>,                                                                   RequireES<3>,                                                                        NeverSupported } },
+    { GL_RGB16UI,                                   { 16, 16, 16,  0,  0, 0,  0, 0,     6,  3, false,      0, 0, GL_RGB_INTEGER,                               GL_UNSIGNED_SHORT,                 GL_UNSIGNED_INT,        GL_LINEAR, RequireES<3>,                                                                   NeverSupported,                                                                      NeverSupported } },
+    { GL_RGBA8UI,                                   {  8,  8,  8,  0,  8, 0,  0, 0,     4,  4, false,      0, 0, GL_RGBA_INTEGER,                              GL_UNSIGNED_BYTE,                  GL_UNSIGNED_INT,        GL_LINEAR, RequireES<3>,                                                                   RequireES<3>,                                                                        NeverSupported } },
+    { GL_RGB8UI,                                    {  8,  8,  8,  0,  0, 0,  0, 0,     3,  3, false,      0, 0, GL_RGB_INTEGER,                               GL_UNSIGNED_BYTE,                  GL_UNSIGNED_INT,        GL_LINEAR, RequireES<3>,                                                                   NeverSupported,                                                                      NeverSupported } },
+    { GL_RGBA32I,                                   { 32, 32, 32,  0, 32, 0,  0, 0,    16,  4, false,      0, 0, GL_RGBA_INTEGER,                              GL_INT,                            GL_INT,                 GL_LINEAR, RequireES<3>,                                                                   RequireES<3>,                                                                        NeverSupported } },
+    { GL_RGB32I,                                    { 32, 32, 32,  0,  0, 0,  0, 0,    12,  3, false,      0, 0, GL_RGB_INTEGER,                               GL_INT,                            GL_INT,                 GL_LINEAR, RequireES<3>,                                                                   NeverSupported,                                                                      NeverSupported } },
+    { GL_RGBA16I,                                   { 16, 16, 16,  0, 16, 0,  0, 0,     8,  4, false,      0, 0, GL_RGBA_INTEGER,                              GL_SHORT,                          GL_INT,                 GL_LINEAR, RequireES<3>,                                                                   RequireES<3>,                                                                        NeverSupported } },
+    { GL_RGB16I,                                    { 16, 16, 16,  0,  0, 0,  0, 0,     6,  3, false,      0, 0, GL_RGB_INTEGER,                               GL_SHORT,                          GL_INT,                 GL_LINEAR, RequireES<3>,                                                                   NeverSupported,                                                                      NeverSupported } },
+    { GL_RGBA8I,                                    {  8,  8,  8,  0,  8, 0,  0, 0,     4,  4, false,      0, 0, GL_RGBA_INTEGER,                              GL_BYTE,                           GL_INT,                 GL_LINEAR, RequireES<3>,                                                                   RequireES<3>,                                                                        NeverSupported } },
+    { GL_RGB8I,                                     {  8,  8,  8,  0,  0, 0,  0, 0,     3,  3, false,      0, 0, GL_RGB_INTEGER,                               GL_BYTE,                           GL_INT,                 GL_LINEAR, RequireES<3>,                                                                   NeverSupported,                                                                      NeverSupported } },
+    { GL_RED_INTEGER,                               {  0,  0,  0,  0,  0, 0,  0, 0,     0,  0, false,      0, 0, GL_RED_INTEGER,                               GL_NONE,                           GL_NONE,                GL_NONE,   RequireES<3>,                                                                   NeverSupported,                                                                      NeverSupported } },
+    { GL_RGB_INTEGER,                               {  0,  0,  0,  0,  0, 0,  0, 0,     0,  0, false,      0, 0, GL_RGB_INTEGER,                               GL_NONE,                           GL_NONE,                GL_NONE,   RequireES<3>,                                                                   NeverSupported,                                                                      NeverSupported } },
+    { GL_RGBA_INTEGER,                              {  0,  0,  0,  0,  0, 0,  0, 0,     0,  0, false,      0, 0, GL_RGBA_INTEGER,                              GL_NONE,                           GL_NONE,                GL_NONE,   RequireES<3>,                                                                   NeverSupported,                                                                      NeverSupported } },
+    { GL_R8_SNORM,                                  {  8,  0,  0,  0,  0, 0,  0, 0,     1,  1, false,      0, 0, GL_RED,                                       GL_BYTE,                           GL_SIGNED_NORMALIZED,   GL_LINEAR, RequireES<3>,                                                                   NeverSupported,                                                                      AlwaysSupported } },
+    { GL_RG8_SNORM,                                 {  8,  8,  0,  0,  0, 0,  0, 0,     2,  2, false,      0, 0, GL_RG,                                        GL_BYTE,                           GL_SIGNED_NORMALIZED,   GL_LINEAR, RequireES<3>,                                                                   NeverSupported,                                                                      AlwaysSupported } },
+    { GL_RGB8_SNORM,                                {  8,  8,  8,  0,  0, 0,  0, 0,     3,  3, false,      0, 0, GL_RGB,                                       GL_BYTE,                           GL_SIGNED_NORMALIZED,   GL_LINEAR, RequireES<3>,                                                                   NeverSupported,                                                                      AlwaysSupported } },
+    { GL_RGBA8_SNORM,                               {  8,  8,  8,  0,  8, 0,  0, 0,     4,  4, false,      0, 0, GL_RGBA,                                      GL_BYTE,                           GL_SIGNED_NORMALIZED,   GL_LINEAR, RequireES<3>,                                                                   NeverSupported,                                                                      AlwaysSupported } },
+    { GL_RGB10_A2UI,                                { 10, 10, 10,  0,  2, 0,  0, 0,     4,  4, false,      0, 0, GL_RGBA_INTEGER,                              GL_UNSIGNED_INT_2_10_10_10_REV,    GL_UNSIGNED_INT,        GL_LINEAR, RequireES<3>,                                                                   NeverSupported,                                                                      NeverSupported } },
+    { GL_COMPRESSED_R11_EAC,                        {  0,  0,  0,  0,  0, 0,  0, 0,     8,  1, true,       4, 4, GL_COMPRESSED_R11_EAC,                        GL_UNSIGNED_BYTE,                  GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<3>,                                                                   NeverSupported,                                                                      AlwaysSupported } },
+    { GL_COMPRESSED_SIGNED_R11_EAC,                 {  0,  0,  0,  0,  0, 0,  0, 0,     8,  1, true,       4, 4, GL_COMPRESSED_SIGNED_R11_EAC,                 GL_UNSIGNED_BYTE,                  GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<3>,                                                                   NeverSupported,                                                                      AlwaysSupported } },
+    { GL_COMPRESSED_RG11_EAC,                       {  0,  0,  0,  0,  0, 0,  0, 0,    16,  2, true,       4, 4, GL_COMPRESSED_RG11_EAC,                       GL_UNSIGNED_BYTE,                  GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<3>,                                                                   NeverSupported,                                                                      AlwaysSupported } },
+    { GL_COMPRESSED_SIGNED_RG11_EAC,                {  0,  0,  0,  0,  0, 0,  0, 0,    16,  2, true,       4, 4, GL_COMPRESSED_SIGNED_RG11_EAC,                GL_UNSIGNED_BYTE,                  GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<3>,                                                                   NeverSupported,                                                                      AlwaysSupported } },
+    { GL_COMPRESSED_RGB8_ETC2,                      {  0,  0,  0,  0,  0, 0,  0, 0,     8,  3, true,       4, 4, GL_COMPRESSED_RGB8_ETC2,                      GL_UNSIGNED_BYTE,                  GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<3>,                                                                   NeverSupported,                                                                      AlwaysSupported } },
+    { GL_COMPRESSED_SRGB8_ETC2,                     {  0,  0,  0,  0,  0, 0,  0, 0,     8,  3, true,       4, 4, GL_COMPRESSED_SRGB8_ETC2,                     GL_UNSIGNED_BYTE,                  GL_UNSIGNED_NORMALIZED, GL_SRGB,   RequireES<3>,                                                                   NeverSupported,                                                                      AlwaysSupported } },
+    { GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2,  {  0,  0,  0,  0,  0, 0,  0, 0,     8,  3, true,       4, 4, GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2,  GL_UNSIGNED_BYTE,                  GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<3>,                                                                   NeverSupported,                                                                      AlwaysSupported } },
+    { GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2, {  0,  0,  0,  0,  0, 0,  0, 0,     8,  3, true,       4, 4, GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2, GL_UNSIGNED_BYTE,                  GL_UNSIGNED_NORMALIZED, GL_SRGB,   RequireES<3>,                                                                   NeverSupported,                                                                      AlwaysSupported } },
+    { GL_COMPRESSED_RGBA8_ETC2_EAC,                 {  0,  0,  0,  0,  0, 0,  0, 0,    16,  4, true,       4, 4, GL_COMPRESSED_RGBA8_ETC2_EAC,                 GL_UNSIGNED_BYTE,                  GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<3>,                                                                   NeverSupported,                                                                      AlwaysSupported } },
+    { GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC,          {  0,  0,  0,  0,  0, 0,  0, 0,    16,  4, true,       4, 4, GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC,          GL_UNSIGNED_BYTE,                  GL_UNSIGNED_NORMALIZED, GL_SRGB,   RequireES<3>,                                                                   NeverSupported,                                                                      AlwaysSupported } },
+    { GL_BGRA8_EXT,                                 {  8,  8,  8,  0,  8, 0,  0, 0,     4,  4, false,      0, 0, GL_BGRA_EXT,                                  GL_UNSIGNED_BYTE,                  GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureFormatBGRA8888>,                                 RequireExt<&Extensions::textureFormatBGRA8888>,                                      AlwaysSupported } },
+};
+
+// Each table is searched by a single integer key
+static inline uint64_t FormatTypeKey(GLenum format, GLenum type)
+{
+    return (static_cast<uint64_t>(format) << 32) | type;
+}
+
+static inline uint64_t EntryKey(const FormatTypeInfoEntry &entry)
+{
+    return FormatTypeKey(entry.format, entry.type);
+}
+
+static inline uint64_t EntryKey(const TypeInfoEntry &entry)
+{
+    return entry.type;
+}
+
+static inline uint64_t EntryKey(const InternalFormatInfoEntry &entry)
+{
+    return entry.internalFormat;
+}
+
+// Returns the entry of |table| with |key|, or NULL. The formats an application passes are close
+// to random from one call to the next, so each step of the binary search picks its half with a
+// conditional move rather than a branch that would mispredict half of the time.
+template <typename EntryType, size_t N>
+static const EntryType *FindEntry(const EntryType (&table)[N], uint64_t key)
+{
+    const EntryType *first = table;
+    size_t count = N;
+    while (count > 1)
+    {
+        size_t half = count / 2;
+        first += (EntryKey(first[half]) < key) ? half : 0;
+        count -= half;
+    }
+    first += (EntryKey(*first) < key) ? 1 : 0;
 
-InternalFormat::InternalFormat()
-    : redBits(0),
-      greenBits(0),
-      blueBits(0),
-      luminanceBits(0),
-      alphaBits(0),
-      sharedBits(0),
-      depthBits(0),
-      stencilBits(0),
-      pixelBytes(0),
-      componentCount(0),
-      compressedBlockWidth(0),
-      compressedBlockHeight(0),
-      format(GL_NONE),
-      type(GL_NONE),
-      componentType(GL_NONE),
-      colorEncoding(GL_NONE),
-      compressed(false),
-      textureSupport(NeverSupported),
-      renderSupport(NeverSupported),
-      filterSupport(NeverSupported)
-{
-}
-
-static InternalFormat UnsizedFormat(GLenum format, InternalFormat::SupportCheckFunction textureSupport,
-                                    InternalFormat::SupportCheckFunction renderSupport,
-                                    InternalFormat::SupportCheckFunction filterSupport)
-{
-    InternalFormat formatInfo;
-    formatInfo.format = format;
-    formatInfo.textureSupport = textureSupport;
-    formatInfo.renderSupport = renderSupport;
-    formatInfo.filterSupport = filterSupport;
-    return formatInfo;
-}
-
-static InternalFormat RGBAFormat(GLuint red, GLuint green, GLuint blue, GLuint alpha, GLuint shared,
-                                 GLenum format, GLenum type, GLenum componentType, bool srgb,
-                                 InternalFormat::SupportCheckFunction textureSupport,
-                                 InternalFormat::SupportCheckFunction renderSupport,
-                                 InternalFormat::SupportCheckFunction filterSupport)
-{
-    InternalFormat formatInfo;
-    formatInfo.redBits = red;
-    formatInfo.greenBits = green;
-    formatInfo.blueBits = blue;
-    formatInfo.alphaBits = alpha;
-    formatInfo.sharedBits = shared;
-    formatInfo.pixelBytes = (red + green + blue + alpha + shared) / 8;
-    formatInfo.componentCount = ((red > 0) ? 1 : 0) + ((green > 0) ? 1 : 0) + ((blue > 0) ? 1 : 0) + ((alpha > 0) ? 1 : 0);
-    formatInfo.format = format;
-    formatInfo.type = type;
-    formatInfo.componentType = componentType;
-    formatInfo.colorEncoding = (srgb ? GL_SRGB : GL_LINEAR);
-    formatInfo.textureSupport = textureSupport;
-    formatInfo.renderSupport = renderSupport;
-    formatInfo.filterSupport = filterSupport;
-    return formatInfo;
-}
-
-static InternalFormat LUMAFormat(GLuint luminance, GLuint alpha, GLenum format, GLenum type, GLenum componentType,
-                                 InternalFormat::SupportCheckFunction textureSupport,
-                                 InternalFormat::SupportCheckFunction renderSupport,
-                                 InternalFormat::SupportCheckFunction filterSupport)
-{
-    InternalFormat formatInfo;
-    formatInfo.luminanceBits = luminance;
-    formatInfo.alphaBits = alpha;
-    formatInfo.pixelBytes = (luminance + alpha) / 8;
-    formatInfo.componentCount = ((luminance > 0) ? 1 : 0) + ((alpha > 0) ? 1 : 0);
-    formatInfo.format = format;
-    formatInfo.type = type;
-    formatInfo.componentType = componentType;
-    formatInfo.colorEncoding = GL_LINEAR;
-    formatInfo.textureSupport = textureSupport;
-    formatInfo.renderSupport = renderSupport;
-    formatInfo.filterSupport = filterSupport;
-    return formatInfo;
-}
-
-static InternalFormat DepthStencilFormat(GLuint depthBits, GLuint stencilBits, GLuint unusedBits, GLenum format,
-                                         GLenum type, GLenum componentType, InternalFormat::SupportCheckFunction textureSupport,
-                                         InternalFormat::SupportCheckFunction renderSupport,
-                                         InternalFormat::SupportCheckFunction filterSupport)
-{
-    InternalFormat formatInfo;
-    formatInfo.depthBits = depthBits;
-    formatInfo.stencilBits = stencilBits;
-    formatInfo.pixelBytes = (depthBits + stencilBits + unusedBits) / 8;
-    formatInfo.componentCount = ((depthBits > 0) ? 1 : 0) + ((stencilBits > 0) ? 1 : 0);
-    formatInfo.format = format;
-    formatInfo.type = type;
-    formatInfo.componentType = componentType;
-    formatInfo.colorEncoding = GL_LINEAR;
-    formatInfo.textureSupport = textureSupport;
-    formatInfo.renderSupport = renderSupport;
-    formatInfo.filterSupport = filterSupport;
-    return formatInfo;
-}
-
-static InternalFormat CompressedFormat(GLuint compressedBlockWidth, GLuint compressedBlockHeight, GLuint compressedBlockSize,
-                                       GLuint componentCount, GLenum format, GLenum type, bool srgb,
-                                       InternalFormat::SupportCheckFunction textureSupport,
-                                       InternalFormat::SupportCheckFunction renderSupport,
-                                       InternalFormat::SupportCheckFunction filterSupport)
-{
-    InternalFormat formatInfo;
-    formatInfo.compressedBlockWidth = compressedBlockWidth;
-    formatInfo.compressedBlockHeight = compressedBlockHeight;
-    formatInfo.pixelBytes = compressedBlockSize / 8;
-    formatInfo.componentCount = componentCount;
-    formatInfo.format = format;
-    formatInfo.type = type;
-    formatInfo.componentType = GL_UNSIGNED_NORMALIZED;
-    formatInfo.colorEncoding = (srgb ? GL_SRGB : GL_LINEAR);
-    formatInfo.compressed = true;
-    formatInfo.textureSupport = textureSupport;
-    formatInfo.renderSupport = renderSupport;
-    formatInfo.filterSupport = filterSupport;
-    return formatInfo;
-}
-
-typedef std::pair<GLenum, InternalFormat> InternalFormatInfoPair;
-typedef std::map<GLenum, InternalFormat> InternalFormatInfoMap;
-
-static InternalFormatInfoMap BuildInternalFormatInfoMap()
-{
-    InternalFormatInfoMap map;
-
-    // From ES 3.0.1 spec, table 3.12
-    map.insert(InternalFormatInfoPair(GL_NONE,              InternalFormat()));
-
-    //                               | Internal format     |          | R | G | B | A |S | Format         | Type                           | Component type        | SRGB | Texture supported                        | Renderable                               | Filterable    |
-    map.insert(InternalFormatInfoPair(GL_R8,                RGBAFormat( 8,  0,  0,  0, 0, GL_RED,          GL_UNSIGNED_BYTE,                GL_UNSIGNED_NORMALIZED, false, RequireESOrExt<3, &Extensions::textureRG>, RequireESOrExt<3, &Extensions::textureRG>, AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_R8_SNORM,          RGBAFormat( 8,  0,  0,  0, 0, GL_RED,          GL_BYTE,                         GL_SIGNED_NORMALIZED,   false, RequireES<3>,                              NeverSupported,                            AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_RG8,               RGBAFormat( 8,  8,  0,  0, 0, GL_RG,           GL_UNSIGNED_BYTE,                GL_UNSIGNED_NORMALIZED, false, RequireESOrExt<3, &Extensions::textureRG>, RequireESOrExt<3, &Extensions::textureRG>, AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_RG8_SNORM,         RGBAFormat( 8,  8,  0,  0, 0, GL_RG,           GL_BYTE,                         GL_SIGNED_NORMALIZED,   false, RequireES<3>,                              NeverSupported,                            AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_RGB8,              RGBAFormat( 8,  8,  8,  0, 0, GL_RGB,          GL_UNSIGNED_BYTE,                GL_UNSIGNED_NORMALIZED, false, RequireESOrExt<3, &Extensions::rgb8rgba8>, RequireESOrExt<3, &Extensions::rgb8rgba8>, AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_RGB8_SNORM,        RGBAFormat( 8,  8,  8,  0, 0, GL_RGB,          GL_BYTE,                         GL_SIGNED_NORMALIZED,   false, RequireES<3>,                              NeverSupported,                            AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_RGB565,            RGBAFormat( 5,  6,  5,  0, 0, GL_RGB,          GL_UNSIGNED_SHORT_5_6_5,         GL_UNSIGNED_NORMALIZED, false, RequireES<2>,                              RequireES<2>,                              AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_RGBA4,             RGBAFormat( 4,  4,  4,  4, 0, GL_RGBA,         GL_UNSIGNED_SHORT_4_4_4_4,       GL_UNSIGNED_NORMALIZED, false, RequireES<2>,                              RequireES<2>,                              AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_RGB5_A1,           RGBAFormat( 5,  5,  5,  1, 0, GL_RGBA,         GL_UNSIGNED_SHORT_5_5_5_1,       GL_UNSIGNED_NORMALIZED, false, RequireES<2>,                              RequireES<2>,                              AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_RGBA8,             RGBAFormat( 8,  8,  8,  8, 0, GL_RGBA,         GL_UNSIGNED_BYTE,                GL_UNSIGNED_NORMALIZED, false, RequireESOrExt<3, &Extensions::rgb8rgba8>, RequireESOrExt<3, &Extensions::rgb8rgba8>, AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_RGBA8_SNORM,       RGBAFormat( 8,  8,  8,  8, 0, GL_RGBA,         GL_BYTE,                         GL_SIGNED_NORMALIZED,   false, RequireES<3>,                              NeverSupported,                            AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_RGB10_A2,          RGBAFormat(10, 10, 10,  2, 0, GL_RGBA,         GL_UNSIGNED_INT_2_10_10_10_REV,  GL_UNSIGNED_NORMALIZED, false, RequireES<3>,                              RequireES<3>,                              AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_RGB10_A2UI,        RGBAFormat(10, 10, 10,  2, 0, GL_RGBA_INTEGER, GL_UNSIGNED_INT_2_10_10_10_REV,  GL_UNSIGNED_INT,        false, RequireES<3>,                              NeverSupported,                            NeverSupported)));
-    map.insert(InternalFormatInfoPair(GL_SRGB8,             RGBAFormat( 8,  8,  8,  0, 0, GL_RGB,          GL_UNSIGNED_BYTE,                GL_UNSIGNED_NORMALIZED, true,  RequireESOrExt<3, &Extensions::sRGB>,      NeverSupported,                            AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_SRGB8_ALPHA8,      RGBAFormat( 8,  8,  8,  8, 0, GL_RGBA,         GL_UNSIGNED_BYTE,                GL_UNSIGNED_NORMALIZED, true,  RequireESOrExt<3, &Extensions::sRGB>,      RequireESOrExt<3, &Extensions::sRGB>,      AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_R11F_G11F_B10F,    RGBAFormat(11, 11, 10,  0, 0, GL_RGB,          GL_UNSIGNED_INT_10F_11F_11F_REV, GL_FLOAT,               false, RequireES<3>,                              RequireExt<&Extensions::colorBufferFloat>, AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_RGB9_E5,           RGBAFormat( 9,  9,  9,  0, 5, GL_RGB,          GL_UNSIGNED_INT_5_9_9_9_REV,     GL_FLOAT,               false, RequireES<3>,                              NeverSupported,                            AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_R8I,               RGBAFormat( 8,  0,  0,  0, 0, GL_RED_INTEGER,  GL_BYTE,                         GL_INT,                 false, RequireES<3>,                              RequireES<3>,                              NeverSupported)));
-    map.insert(InternalFormatInfoPair(GL_R8UI,              RGBAFormat( 8,  0,  0,  0, 0, GL_RED_INTEGER,  GL_UNSIGNED_BYTE,                GL_UNSIGNED_INT,        false, RequireES<3>,                              RequireES<3>,                              NeverSupported)));
-    map.insert(InternalFormatInfoPair(GL_R16I,              RGBAFormat(16,  0,  0,  0, 0, GL_RED_INTEGER,  GL_SHORT,                        GL_INT,                 false, RequireES<3>,                              RequireES<3>,                              NeverSupported)));
-    map.insert(InternalFormatInfoPair(GL_R16UI,             RGBAFormat(16,  0,  0,  0, 0, GL_RED_INTEGER,  GL_UNSIGNED_SHORT,               GL_UNSIGNED_INT,        false, RequireES<3>,                              RequireES<3>,                              NeverSupported)));
-    map.insert(InternalFormatInfoPair(GL_R32I,              RGBAFormat(32,  0,  0,  0, 0, GL_RED_INTEGER,  GL_INT,                          GL_INT,                 false, RequireES<3>,                              RequireES<3>,                              NeverSupported)));
-    map.insert(InternalFormatInfoPair(GL_R32UI,             RGBAFormat(32,  0,  0,  0, 0, GL_RED_INTEGER,  GL_UNSIGNED_INT,                 GL_UNSIGNED_INT,        false, RequireES<3>,                              RequireES<3>,                              NeverSupported)));
-    map.insert(InternalFormatInfoPair(GL_RG8I,              RGBAFormat( 8,  8,  0,  0, 0, GL_RG_INTEGER,   GL_BYTE,                         GL_INT,                 false, RequireES<3>,                              RequireES<3>,                              NeverSupported)));
-    map.insert(InternalFormatInfoPair(GL_RG8UI,             RGBAFormat( 8,  8,  0,  0, 0, GL_RG_INTEGER,   GL_UNSIGNED_BYTE,                GL_UNSIGNED_INT,        false, RequireES<3>,                              RequireES<3>,                              NeverSupported)));
-    map.insert(InternalFormatInfoPair(GL_RG16I,             RGBAFormat(16, 16,  0,  0, 0, GL_RG_INTEGER,   GL_SHORT,                        GL_INT,                 false, RequireES<3>,                              RequireES<3>,                              NeverSupported)));
-    map.insert(InternalFormatInfoPair(GL_RG16UI,            RGBAFormat(16, 16,  0,  0, 0, GL_RG_INTEGER,   GL_UNSIGNED_SHORT,               GL_UNSIGNED_INT,        false, RequireES<3>,                              RequireES<3>,                              NeverSupported)));
-    map.insert(InternalFormatInfoPair(GL_RG32I,             RGBAFormat(32, 32,  0,  0, 0, GL_RG_INTEGER,   GL_INT,                          GL_INT,                 false, RequireES<3>,                              RequireES<3>,                              NeverSupported)));
-    map.insert(InternalFormatInfoPair(GL_RG32UI,            RGBAFormat(32, 32,  0,  0, 0, GL_RG_INTEGER,   GL_UNSIGNED_INT,                 GL_UNSIGNED_INT,        false, RequireES<3>,                              RequireES<3>,                              NeverSupported)));
-    map.insert(InternalFormatInfoPair(GL_RGB8I,             RGBAFormat( 8,  8,  8,  0, 0, GL_RGB_INTEGER,  GL_BYTE,                         GL_INT,                 false, RequireES<3>,                              NeverSupported,                            NeverSupported)));
-    map.insert(InternalFormatInfoPair(GL_RGB8UI,            RGBAFormat( 8,  8,  8,  0, 0, GL_RGB_INTEGER,  GL_UNSIGNED_BYTE,                GL_UNSIGNED_INT,        false, RequireES<3>,                              NeverSupported,                            NeverSupported)));
-    map.insert(InternalFormatInfoPair(GL_RGB16I,            RGBAFormat(16, 16, 16,  0, 0, GL_RGB_INTEGER,  GL_SHORT,                        GL_INT,                 false, RequireES<3>,                              NeverSupported,                            NeverSupported)));
-    map.insert(InternalFormatInfoPair(GL_RGB16UI,           RGBAFormat(16, 16, 16,  0, 0, GL_RGB_INTEGER,  GL_UNSIGNED_SHORT,               GL_UNSIGNED_INT,        false, RequireES<3>,                              NeverSupported,                            NeverSupported)));
-    map.insert(InternalFormatInfoPair(GL_RGB32I,            RGBAFormat(32, 32, 32,  0, 0, GL_RGB_INTEGER,  GL_INT,                          GL_INT,                 false, RequireES<3>,                              NeverSupported,                            NeverSupported)));
-    map.insert(InternalFormatInfoPair(GL_RGB32UI,           RGBAFormat(32, 32, 32,  0, 0, GL_RGB_INTEGER,  GL_UNSIGNED_INT,                 GL_UNSIGNED_INT,        false, RequireES<3>,                              NeverSupported,                            NeverSupported)));
-    map.insert(InternalFormatInfoPair(GL_RGBA8I,            RGBAFormat( 8,  8,  8,  8, 0, GL_RGBA_INTEGER, GL_BYTE,                         GL_INT,                 false, RequireES<3>,                              RequireES<3>,                              NeverSupported)));
-    map.insert(InternalFormatInfoPair(GL_RGBA8UI,           RGBAFormat( 8,  8,  8,  8, 0, GL_RGBA_INTEGER, GL_UNSIGNED_BYTE,                GL_UNSIGNED_INT,        false, RequireES<3>,                              RequireES<3>,                              NeverSupported)));
-    map.insert(InternalFormatInfoPair(GL_RGBA16I,           RGBAFormat(16, 16, 16, 16, 0, GL_RGBA_INTEGER, GL_SHORT,                        GL_INT,                 false, RequireES<3>,                              RequireES<3>,                              NeverSupported)));
-    map.insert(InternalFormatInfoPair(GL_RGBA16UI,          RGBAFormat(16, 16, 16, 16, 0, GL_RGBA_INTEGER, GL_UNSIGNED_SHORT,               GL_UNSIGNED_INT,        false, RequireES<3>,                              RequireES<3>,                              NeverSupported)));
-    map.insert(InternalFormatInfoPair(GL_RGBA32I,           RGBAFormat(32, 32, 32, 32, 0, GL_RGBA_INTEGER, GL_INT,                          GL_INT,                 false, RequireES<3>,                              RequireES<3>,                              NeverSupported)));
-    map.insert(InternalFormatInfoPair(GL_RGBA32UI,          RGBAFormat(32, 32, 32, 32, 0, GL_RGBA_INTEGER, GL_UNSIGNED_INT,                 GL_UNSIGNED_INT,        false, RequireES<3>,                              RequireES<3>,                              NeverSupported)));
-
-    map.insert(InternalFormatInfoPair(GL_BGRA8_EXT,         RGBAFormat( 8,  8,  8,  8, 0, GL_BGRA_EXT,     GL_UNSIGNED_BYTE,                  GL_UNSIGNED_NORMALIZED, false, RequireExt<&Extensions::textureFormatBGRA8888>, RequireExt<&Extensions::textureFormatBGRA8888>, AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_BGRA4_ANGLEX,      RGBAFormat( 4,  4,  4,  4, 0, GL_BGRA_EXT,     GL_UNSIGNED_SHORT_4_4_4_4_REV_EXT, GL_UNSIGNED_NORMALIZED, false, RequireExt<&Extensions::textureFormatBGRA8888>, RequireExt<&Extensions::textureFormatBGRA8888>, AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_BGR5_A1_ANGLEX,    RGBAFormat( 5,  5,  5,  1, 0, GL_BGRA_EXT,     GL_UNSIGNED_SHORT_1_5_5_5_REV_EXT, GL_UNSIGNED_NORMALIZED, false, RequireExt<&Extensions::textureFormatBGRA8888>, RequireExt<&Extensions::textureFormatBGRA8888>, AlwaysSupported)));
-
-    // Floating point renderability and filtering is provided by OES_texture_float and OES_texture_half_float
-    //                               | Internal format     |          | D |S | Format             | Type                                   | Comp   | SRGB |  Texture supported                                                             | Renderable                                                                    | Filterable                                    |
-    //                               |                     |          |   |  |                    |                                        | type   |      |                                                                                |                                                                               |                                               |
-    map.insert(InternalFormatInfoPair(GL_R16F,              RGBAFormat(16,  0,  0,  0, 0, GL_RED,          GL_HALF_FLOAT,                   GL_FLOAT, false, RequireESOrExtAndExt<3, &Extensions::textureHalfFloat, &Extensions::textureRG>, RequireESOrExtAndExt<3, &Extensions::textureHalfFloat, &Extensions::textureRG>, RequireExt<&Extensions::textureHalfFloatLinear>)));
-    map.insert(InternalFormatInfoPair(GL_RG16F,             RGBAFormat(16, 16,  0,  0, 0, GL_RG,           GL_HALF_FLOAT,                   GL_FLOAT, false, RequireESOrExtAndExt<3, &Extensions::textureHalfFloat, &Extensions::textureRG>, RequireESOrExtAndExt<3, &Extensions::textureHalfFloat, &Extensions::textureRG>, RequireExt<&Extensions::textureHalfFloatLinear>)));
-    map.insert(InternalFormatInfoPair(GL_RGB16F,            RGBAFormat(16, 16, 16,  0, 0, GL_RGB,          GL_HALF_FLOAT,                   GL_FLOAT, false, RequireESOrExt<3, &Extensions::textureHalfFloat>,                               RequireESOrExt<3, &Extensions::textureHalfFloat>,                               RequireExt<&Extensions::textureHalfFloatLinear>)));
-    map.insert(InternalFormatInfoPair(GL_RGBA16F,           RGBAFormat(16, 16, 16, 16, 0, GL_RGBA,         GL_HALF_FLOAT,                   GL_FLOAT, false, RequireESOrExt<3, &Extensions::textureHalfFloat>,                               RequireESOrExt<3, &Extensions::textureHalfFloat>,                               RequireExt<&Extensions::textureHalfFloatLinear>)));
-    map.insert(InternalFormatInfoPair(GL_R32F,              RGBAFormat(32,  0,  0,  0, 0, GL_RED,          GL_FLOAT,                        GL_FLOAT, false, RequireESOrExtAndExt<3, &Extensions::textureFloat, &Extensions::textureRG>,     RequireESOrExtAndExt<3, &Extensions::textureFloat, &Extensions::textureRG>,     RequireExt<&Extensions::textureFloatLinear>    )));
-    map.insert(InternalFormatInfoPair(GL_RG32F,             RGBAFormat(32, 32,  0,  0, 0, GL_RG,           GL_FLOAT,                        GL_FLOAT, false, RequireESOrExtAndExt<3, &Extensions::textureFloat, &Extensions::textureRG>,     RequireESOrExtAndExt<3, &Extensions::textureFloat, &Extensions::textureRG>,     RequireExt<&Extensions::textureFloatLinear>    )));
-    map.insert(InternalFormatInfoPair(GL_RGB32F,            RGBAFormat(32, 32, 32,  0, 0, GL_RGB,          GL_FLOAT,                        GL_FLOAT, false, RequireESOrExt<3, &Extensions::textureFloat>,                                   RequireESOrExt<3, &Extensions::textureFloat>,                                   RequireExt<&Extensions::textureFloatLinear>    )));
-    map.insert(InternalFormatInfoPair(GL_RGBA32F,           RGBAFormat(32, 32, 32, 32, 0, GL_RGBA,         GL_FLOAT,                        GL_FLOAT, false, RequireESOrExt<3, &Extensions::textureFloat>,                                   RequireESOrExt<3, &Extensions::textureFloat>,                                   RequireExt<&Extensions::textureFloatLinear>    )));
-
-    // Depth stencil formats
-    //                               | Internal format         |                  | D |S | X | Format            | Type                             | Component type        | Supported                                    | Renderable                                                                         | Filterable                                  |
-    map.insert(InternalFormatInfoPair(GL_DEPTH_COMPONENT16,     DepthStencilFormat(16, 0,  0, GL_DEPTH_COMPONENT, GL_UNSIGNED_SHORT,                 GL_UNSIGNED_NORMALIZED, RequireES<2>,                                  RequireES<2>,                                                                        RequireESOrExt<3, &Extensions::depthTextures>)));
-    map.insert(InternalFormatInfoPair(GL_DEPTH_COMPONENT24,     DepthStencilFormat(24, 0,  0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT,                   GL_UNSIGNED_NORMALIZED, RequireES<3>,                                  RequireES<3>,                                                                        RequireESOrExt<3, &Extensions::depthTextures>)));
-    map.insert(InternalFormatInfoPair(GL_DEPTH_COMPONENT32F,    DepthStencilFormat(32, 0,  0, GL_DEPTH_COMPONENT, GL_FLOAT,                          GL_FLOAT,               RequireES<3>,                                  RequireES<3>,                                                                        RequireESOrExt<3, &Extensions::depthTextures>)));
-    map.insert(InternalFormatInfoPair(GL_DEPTH_COMPONENT32_OES, DepthStencilFormat(32, 0,  0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT,                   GL_UNSIGNED_NORMALIZED, RequireExt<&Extensions::depthTextures>,        RequireExt<&Extensions::depthTextures>,                                              AlwaysSupported                              )));
-    map.insert(InternalFormatInfoPair(GL_DEPTH24_STENCIL8,      DepthStencilFormat(24, 8,  0, GL_DEPTH_STENCIL,   GL_UNSIGNED_INT_24_8,              GL_UNSIGNED_NORMALIZED, RequireESOrExt<3, &Extensions::depthTextures>, RequireESOrExtOrExt<3, &Extensions::depthTextures, &Extensions::packedDepthStencil>, AlwaysSupported                              )));
-    map.insert(InternalFormatInfoPair(GL_DEPTH32F_STENCIL8,     DepthStencilFormat(32, 8, 24, GL_DEPTH_STENCIL,   GL_FLOAT_32_UNSIGNED_INT_24_8_REV, GL_FLOAT,               RequireES<3>,                                  RequireES<3>,                                                                        AlwaysSupported                              )));
-    map.insert(InternalFormatInfoPair(GL_STENCIL_INDEX8,        DepthStencilFormat( 0, 8,  0, GL_DEPTH_STENCIL,   GL_UNSIGNED_BYTE,                  GL_UNSIGNED_INT,        RequireES<2>,                                  RequireES<2>,                                                                        NeverSupported                               )));
-
-    // Luminance alpha formats
-    //                               | Internal format          |          | L | A | Format            | Type            | Component type        | Supported                                                                    | Renderable    | Filterable    |
-    map.insert(InternalFormatInfoPair(GL_ALPHA8_EXT,             LUMAFormat( 0,  8, GL_ALPHA,           GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, RequireExt<&Extensions::textureStorage>,                                      NeverSupported, AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_LUMINANCE8_EXT,         LUMAFormat( 8,  0, GL_LUMINANCE,       GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, RequireExt<&Extensions::textureStorage>,                                      NeverSupported, AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_ALPHA32F_EXT,           LUMAFormat( 0, 32, GL_ALPHA,           GL_FLOAT,         GL_FLOAT,               RequireExtAndExt<&Extensions::textureStorage, &Extensions::textureFloat>,     NeverSupported, AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_LUMINANCE32F_EXT,       LUMAFormat(32,  0, GL_LUMINANCE,       GL_FLOAT,         GL_FLOAT,               RequireExtAndExt<&Extensions::textureStorage, &Extensions::textureFloat>,     NeverSupported, AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_ALPHA16F_EXT,           LUMAFormat( 0, 16, GL_ALPHA,           GL_HALF_FLOAT,    GL_FLOAT,               RequireExtAndExt<&Extensions::textureStorage, &Extensions::textureHalfFloat>, NeverSupported, AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_LUMINANCE16F_EXT,       LUMAFormat(16,  0, GL_LUMINANCE,       GL_HALF_FLOAT,    GL_FLOAT,               RequireExtAndExt<&Extensions::textureStorage, &Extensions::textureHalfFloat>, NeverSupported, AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_LUMINANCE8_ALPHA8_EXT,  LUMAFormat( 8,  8, GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, RequireExt<&Extensions::textureStorage>,                                      NeverSupported, AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_LUMINANCE_ALPHA32F_EXT, LUMAFormat(32, 32, GL_LUMINANCE_ALPHA, GL_FLOAT,         GL_FLOAT,               RequireExtAndExt<&Extensions::textureStorage, &Extensions::textureFloat>,     NeverSupported, AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_LUMINANCE_ALPHA16F_EXT, LUMAFormat(16, 16, GL_LUMINANCE_ALPHA, GL_HALF_FLOAT,    GL_FLOAT,               RequireExtAndExt<&Extensions::textureStorage, &Extensions::textureHalfFloat>, NeverSupported, AlwaysSupported)));
-
-    // Unsized formats
-    //                               | Internal format   |             | Format            | Supported                                         | Renderable                                        | Filterable    |
-    map.insert(InternalFormatInfoPair(GL_ALPHA,           UnsizedFormat(GL_ALPHA,           RequireES<2>,                                       NeverSupported,                                     AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_LUMINANCE,       UnsizedFormat(GL_LUMINANCE,       RequireES<2>,                                       NeverSupported,                                     AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_LUMINANCE_ALPHA, UnsizedFormat(GL_LUMINANCE_ALPHA, RequireES<2>,                                       NeverSupported,                                     AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_RED,             UnsizedFormat(GL_RED,             RequireESOrExt<3, &Extensions::textureRG>,          NeverSupported,                                     AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_RG,              UnsizedFormat(GL_RG,              RequireESOrExt<3, &Extensions::textureRG>,          NeverSupported,                                     AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_RGB,             UnsizedFormat(GL_RGB,             RequireES<2>,                                       RequireES<2>,                                       AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_RGBA,            UnsizedFormat(GL_RGBA,            RequireES<2>,                                       RequireES<2>,                                       AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_RED_INTEGER,     UnsizedFormat(GL_RED_INTEGER,     RequireES<3>,                                       NeverSupported,                                     NeverSupported )));
-    map.insert(InternalFormatInfoPair(GL_RG_INTEGER,      UnsizedFormat(GL_RG_INTEGER,      RequireES<3>,                                       NeverSupported,                                     NeverSupported )));
-    map.insert(InternalFormatInfoPair(GL_RGB_INTEGER,     UnsizedFormat(GL_RGB_INTEGER,     RequireES<3>,                                       NeverSupported,                                     NeverSupported )));
-    map.insert(InternalFormatInfoPair(GL_RGBA_INTEGER,    UnsizedFormat(GL_RGBA_INTEGER,    RequireES<3>,                                       NeverSupported,                                     NeverSupported )));
-    map.insert(InternalFormatInfoPair(GL_BGRA_EXT,        UnsizedFormat(GL_BGRA_EXT,        RequireExt<&Extensions::textureFormatBGRA8888>,     RequireExt<&Extensions::textureFormatBGRA8888>,     AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_DEPTH_COMPONENT, UnsizedFormat(GL_DEPTH_COMPONENT, RequireES<2>,                                       RequireES<2>,                                       AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_DEPTH_STENCIL,   UnsizedFormat(GL_DEPTH_STENCIL,   RequireESOrExt<3, &Extensions::packedDepthStencil>, RequireESOrExt<3, &Extensions::packedDepthStencil>, AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_SRGB_EXT,        UnsizedFormat(GL_RGB,             RequireESOrExt<3, &Extensions::sRGB>,               NeverSupported,                                     AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_SRGB_ALPHA_EXT,  UnsizedFormat(GL_RGBA,            RequireESOrExt<3, &Extensions::sRGB>,               RequireESOrExt<3, &Extensions::sRGB>,               AlwaysSupported)));
-
-    // Compressed formats, From ES 3.0.1 spec, table 3.16
-    //                               | Internal format                             |                |W |H | BS |CC| Format                                      | Type            | SRGB | Supported          | Renderable           | Filterable         |
-    map.insert(InternalFormatInfoPair(GL_COMPRESSED_R11_EAC,                        CompressedFormat(4, 4,  64, 1, GL_COMPRESSED_R11_EAC,                        GL_UNSIGNED_BYTE, false, UnimplementedSupport, UnimplementedSupport, UnimplementedSupport)));
-    map.insert(InternalFormatInfoPair(GL_COMPRESSED_SIGNED_R11_EAC,                 CompressedFormat(4, 4,  64, 1, GL_COMPRESSED_SIGNED_R11_EAC,                 GL_UNSIGNED_BYTE, false, UnimplementedSupport, UnimplementedSupport, UnimplementedSupport)));
-    map.insert(InternalFormatInfoPair(GL_COMPRESSED_RG11_EAC,                       CompressedFormat(4, 4, 128, 2, GL_COMPRESSED_RG11_EAC,                       GL_UNSIGNED_BYTE, false, UnimplementedSupport, UnimplementedSupport, UnimplementedSupport)));
-    map.insert(InternalFormatInfoPair(GL_COMPRESSED_SIGNED_RG11_EAC,                CompressedFormat(4, 4, 128, 2, GL_COMPRESSED_SIGNED_RG11_EAC,                GL_UNSIGNED_BYTE, false, UnimplementedSupport, UnimplementedSupport, UnimplementedSupport)));
-    map.insert(InternalFormatInfoPair(GL_COMPRESSED_RGB8_ETC2,                      CompressedFormat(4, 4,  64, 3, GL_COMPRESSED_RGB8_ETC2,                      GL_UNSIGNED_BYTE, false, UnimplementedSupport, UnimplementedSupport, UnimplementedSupport)));
-    map.insert(InternalFormatInfoPair(GL_COMPRESSED_SRGB8_ETC2,                     CompressedFormat(4, 4,  64, 3, GL_COMPRESSED_SRGB8_ETC2,                     GL_UNSIGNED_BYTE, true,  UnimplementedSupport, UnimplementedSupport, UnimplementedSupport)));
-    map.insert(InternalFormatInfoPair(GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2,  CompressedFormat(4, 4,  64, 3, GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2,  GL_UNSIGNED_BYTE, false, UnimplementedSupport, UnimplementedSupport, UnimplementedSupport)));
-    map.insert(InternalFormatInfoPair(GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2, CompressedFormat(4, 4,  64, 3, GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2, GL_UNSIGNED_BYTE, true,  UnimplementedSupport, UnimplementedSupport, UnimplementedSupport)));
-    map.insert(InternalFormatInfoPair(GL_COMPRESSED_RGBA8_ETC2_EAC,                 CompressedFormat(4, 4, 128, 4, GL_COMPRESSED_RGBA8_ETC2_EAC,                 GL_UNSIGNED_BYTE, false, UnimplementedSupport, UnimplementedSupport, UnimplementedSupport)));
-    map.insert(InternalFormatInfoPair(GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC,          CompressedFormat(4, 4, 128, 4, GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC,          GL_UNSIGNED_BYTE, true,  UnimplementedSupport, UnimplementedSupport, UnimplementedSupport)));
-
-    // From GL_EXT_texture_compression_dxt1
-    //                               | Internal format                   |                |W |H | BS |CC| Format                            | Type            | SRGB | Supported                                      | Renderable    | Filterable    |
-    map.insert(InternalFormatInfoPair(GL_COMPRESSED_RGB_S3TC_DXT1_EXT,    CompressedFormat(4, 4,  64, 3, GL_COMPRESSED_RGB_S3TC_DXT1_EXT,    GL_UNSIGNED_BYTE, false, RequireExt<&Extensions::textureCompressionDXT1>, NeverSupported, AlwaysSupported)));
-    map.insert(InternalFormatInfoPair(GL_COMPRESSED_RGBA_S3TC_DXT1_EXT,   CompressedFormat(4, 4,  64, 4, GL_COMPRESSED_RGBA_S3TC_DXT1_EXT,   GL_UNSIGNED_BYTE, false, RequireExt<&Extensions::textureCompressionDXT1>, NeverSupported, AlwaysSupported)));
-
-    // From GL_ANGLE_texture_compression_dxt3
-    map.insert(InternalFormatInfoPair(GL_COMPRESSED_RGBA_S3TC_DXT3_ANGLE, CompressedFormat(4, 4, 128, 4, GL_COMPRESSED_RGBA_S3TC_DXT3_ANGLE, GL_UNSIGNED_BYTE, false, RequireExt<&Extensions::textureCompressionDXT5>, NeverSupported, AlwaysSupported)));
-
-    // From GL_ANGLE_texture_compression_dxt5
-    map.insert(InternalFormatInfoPair(GL_COMPRESSED_RGBA_S3TC_DXT5_ANGLE, CompressedFormat(4, 4, 128, 4, GL_COMPRESSED_RGBA_S3TC_DXT5_ANGLE, GL_UNSIGNED_BYTE, false, RequireExt<&Extensions::textureCompressionDXT5>, NeverSupported, AlwaysSupported)));
-
-    return map;
-}
-
-static const InternalFormatInfoMap &GetInternalFormatMap()
-{
-    static const InternalFormatInfoMap formatMap = BuildInternalFormatInfoMap();
-    return formatMap;
+    return (first != table + N && EntryKey(*first) == key) ? first : NULL;
 }
 
 static FormatSet BuildAllSizedInternalFormatSet()
 {
     FormatSet result;
 
-    const InternalFormatInfoMap &formats = GetInternalFormatMap();
-    for (InternalFormatInfoMap::const_iterator i = formats.begin(); i != formats.end(); i++)
+    for (size_t entryIndex = 0; entryIndex < ArraySize(InternalFormatInfoTable); entryIndex++)
     {
-        if (i->second.pixelBytes > 0)
+        const InternalFormatInfoEntry &entry = InternalFormatInfoTable[entryIndex];
+        if (entry.info.pixelBytes > 0)
         {
-            result.insert(i->first);
+            result.insert(entry.internalFormat);
         }
     }
 
@@ -538,46 +372,44 @@ static FormatSet BuildAllSizedInternalFormatSet()
 
 const FormatType &GetFormatTypeInfo(GLenum format, GLenum type)
 {
-    static const FormatMap formatMap = BuildFormatMap();
-    FormatMap::const_iterator iter = formatMap.find(FormatTypePair(format, type));
-    if (iter != formatMap.end())
+    const FormatTypeInfoEntry *entry = FindEntry(FormatTypeInfoTable, FormatTypeKey(format, type));
+    if (entry)
     {
-        return iter->second;
+        return entry->info;
     }
     else
     {
-        static const FormatType defaultInfo;
+        static const FormatType defaultInfo = { GL_NONE, NULL };
         return defaultInfo;
     }
 }
 
 const Type &GetTypeInfo(GLenum type)
 {
-    static const TypeInfoMap infoMap = BuildTypeInfoMap();
-    TypeInfoMap::const_iterator iter = infoMap.find(type);
-    if (iter != infoMap.end())
+    const TypeInfoEntry *entry = FindEntry(TypeInfoTable, type);
+    if (entry)
     {
-        return iter->second;
+        return entry->info;
     }
     else
     {
-        static const Type defaultInfo;
+        static const Type defaultInfo = { 0, false };
         return defaultInfo;
     }
 }
 
 const InternalFormat &GetInternalFormatInfo(GLenum internalFormat)
 {
-    const InternalFormatInfoMap &formatMap = GetInternalFormatMap();
-    InternalFormatInfoMap::const_iterator iter = formatMap.find(internalFormat);
-    if (iter != formatMap.end())
+    const InternalFormatInfoEntry *entry = FindEntry(InternalFormatInfoTable, internalFormat);
+    if (entry)
     {
-        return iter->second;
+        return entry->info;
     }
     else
     {
-        static const InternalFormat defaultInternalFormat;
-        return defaultInternalFormat;
+        // Unknown formats answer as GL_NONE does, which sorts first
+        ASSERT(InternalFormatInfoTable[0].internalFormat == GL_NONE);
+        return InternalFormatInfoTable[0].info;
     }
 }
 
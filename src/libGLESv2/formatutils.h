@@ -21,6 +21,14 @@ typedef void (*MipGenerationFunction)(size_t sourceWidth, size_t sourceHeight, s
                                       const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
                                       uint8_t *destData, size_t destRowPitch, size_t destDepthPitch);
 
+namespace rx
+{
+struct MipChainLevel;
+}
+
+typedef void (*MipChainGenerationFunction)(size_t width, size_t height, size_t depth,
+                                           const rx::MipChainLevel *levels, size_t levelCount);
+
 typedef void (*LoadImageFunction)(size_t width, size_t height, size_t depth,
                                   const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
                                   uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch);
@@ -31,16 +39,17 @@ typedef void (*InitializeTextureDataFunction)(size_t width, size_t height, size_
 typedef void (*ColorReadFunction)(const uint8_t *source, uint8_t *dest);
 typedef void (*ColorWriteFunction)(const uint8_t *source, uint8_t *dest);
 typedef void (*ColorCopyFunction)(const uint8_t *source, uint8_t *dest);
+typedef void (*ColorRowCopyFunction)(size_t count, const uint8_t *source, uint8_t *dest);
 
 typedef void (*VertexCopyFunction)(const uint8_t *input, size_t stride, size_t count, uint8_t *output);
 
 namespace gl
 {
 
+// The structs below have no constructors so that the tables of them in formatutils.cpp are
+// initialized at compile time.
 struct FormatType
 {
-    FormatType();
-
     GLenum internalFormat;
     ColorWriteFunction colorWriteFunction;
 };
@@ -48,8 +57,6 @@ const FormatType &GetFormatTypeInfo(GLenum format, GLenum type);
 
 struct Type
 {
-    Type();
-
     GLuint bytes;
     bool specialInterpretation;
 };
@@ -57,8 +64,6 @@ const Type &GetTypeInfo(GLenum type);
 
 struct InternalFormat
 {
-    InternalFormat();
-
     GLuint redBits;
     GLuint greenBits;
     GLuint blueBits;
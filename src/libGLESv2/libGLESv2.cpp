@@ -165,7 +165,7 @@ void GL_APIENTRY glBindBuffer(GLenum target, GLuint buffer)
     gl::Context *context = gl::getNonLostContext();
     if (context)
     {
-        if (!gl::ValidBufferTarget(context, target))
+        if (!context->skipValidation() && !gl::ValidBufferTarget(context, target))
         {
             context->recordError(gl::Error(GL_INVALID_ENUM));
             return;
@@ -199,7 +199,10 @@ void GL_APIENTRY glBindBuffer(GLenum target, GLuint buffer)
             return;
 
           default:
-            context->recordError(gl::Error(GL_INVALID_ENUM));
+            if (!context->skipValidation())
+            {
+                context->recordError(gl::Error(GL_INVALID_ENUM));
+            }
             return;
         }
     }
@@ -212,7 +215,7 @@ void GL_APIENTRY glBindFramebuffer(GLenum target, GLuint framebuffer)
     gl::Context *context = gl::getNonLostContext();
     if (context)
     {
-        if (!gl::ValidFramebufferTarget(target))
+        if (!context->skipValidation() && !gl::ValidFramebufferTarget(target))
         {
             context->recordError(gl::Error(GL_INVALID_ENUM));
             return;
@@ -1346,7 +1349,11 @@ void GL_APIENTRY glDisable(GLenum cap)
     {
         if (!ValidCap(context, cap))
         {
-            context->recordError(gl::Error(GL_INVALID_ENUM));
+            // Without errors, unknown caps are ignored rather than passed on to the state
+            if (!context->skipValidation())
+            {
+                context->recordError(gl::Error(GL_INVALID_ENUM));
+            }
             return;
         }
 
@@ -1378,7 +1385,8 @@ void GL_APIENTRY glDrawArrays(GLenum mode, GLint first, GLsizei count)
     gl::Context *context = gl::getNonLostContext();
     if (context)
     {
-        if (!ValidateDrawArrays(context, mode, first, count, 0))
+        if (context->skipValidation() ? !ValidateDrawArraysNoError(context, mode, first, count, 0)
+                                       : !ValidateDrawArrays(context, mode, first, count, 0))
         {
             return;
         }
@@ -1399,7 +1407,8 @@ void GL_APIENTRY glDrawArraysInstancedANGLE(GLenum mode, GLint first, GLsizei co
     gl::Context *context = gl::getNonLostContext();
     if (context)
     {
-        if (!ValidateDrawArraysInstancedANGLE(context, mode, first, count, primcount))
+        if (context->skipValidation() ? !ValidateDrawArraysInstancedNoError(context, mode, first, count, primcount)
+                                       : !ValidateDrawArraysInstancedANGLE(context, mode, first, count, primcount))
         {
             return;
         }
@@ -1422,7 +1431,8 @@ void GL_APIENTRY glDrawElements(GLenum mode, GLsizei count, GLenum type, const G
     if (context)
     {
         rx::RangeUI indexRange;
-        if (!ValidateDrawElements(context, mode, count, type, indices, 0, &indexRange))
+        if (context->skipValidation() ? !ValidateDrawElementsNoError(context, mode, count, type, indices, 0, &indexRange)
+                                       : !ValidateDrawElements(context, mode, count, type, indices, 0, &indexRange))
         {
             return;
         }
@@ -1445,7 +1455,8 @@ void GL_APIENTRY glDrawElementsInstancedANGLE(GLenum mode, GLsizei count, GLenum
     if (context)
     {
         rx::RangeUI indexRange;
-        if (!ValidateDrawElementsInstancedANGLE(context, mode, count, type, indices, primcount, &indexRange))
+        if (context->skipValidation() ? !ValidateDrawElementsInstancedNoError(context, mode, count, type, indices, primcount, &indexRange)
+                                       : !ValidateDrawElementsInstancedANGLE(context, mode, count, type, indices, primcount, &indexRange))
         {
             return;
         }
@@ -1468,7 +1479,11 @@ void GL_APIENTRY glEnable(GLenum cap)
     {
         if (!ValidCap(context, cap))
         {
-            context->recordError(gl::Error(GL_INVALID_ENUM));
+            // Without errors, unknown caps are ignored rather than passed on to the state
+            if (!context->skipValidation())
+            {
+                context->recordError(gl::Error(GL_INVALID_ENUM));
+            }
             return;
         }
 
@@ -3538,7 +3553,10 @@ GLboolean GL_APIENTRY glIsEnabled(GLenum cap)
     {
         if (!ValidCap(context, cap))
         {
-            context->recordError(gl::Error(GL_INVALID_ENUM));
+            if (!context->skipValidation())
+            {
+                context->recordError(gl::Error(GL_INVALID_ENUM));
+            }
             return GL_FALSE;
         }
 
@@ -4322,6 +4340,8 @@ void GL_APIENTRY glTexParameterf(GLenum target, GLenum pname, GLfloat param)
           case GL_TEXTURE_MAX_LOD:              texture->getSamplerState().maxLod = param;                            break;
           default: UNREACHABLE(); break;
         }
+
+        texture->issueChangeSerial();
     }
 }
 
@@ -4371,6 +4391,8 @@ void GL_APIENTRY glTexParameteri(GLenum target, GLenum pname, GLint param)
           case GL_TEXTURE_MAX_LOD:              texture->getSamplerState().maxLod = (GLfloat)param;      break;
           default: UNREACHABLE(); break;
         }
+
+        texture->issueChangeSerial();
     }
 }
 
@@ -4518,7 +4540,8 @@ void GL_APIENTRY glUniform1fv(GLint location, GLsizei count, const GLfloat* v)
     gl::Context *context = gl::getNonLostContext();
     if (context)
     {
-        if (!ValidateUniform(context, GL_FLOAT, location, count))
+        if (context->skipValidation() ? !ValidateUniformNoError(context, GL_FLOAT, location, count)
+                                       : !ValidateUniform(context, GL_FLOAT, location, count))
         {
             return;
         }
@@ -4540,7 +4563,8 @@ void GL_APIENTRY glUniform1iv(GLint location, GLsizei count, const GLint* v)
     gl::Context *context = gl::getNonLostContext();
     if (context)
     {
-        if (!ValidateUniform(context, GL_INT, location, count))
+        if (context->skipValidation() ? !ValidateUniformNoError(context, GL_INT, location, count)
+                                       : !ValidateUniform(context, GL_INT, location, count))
         {
             return;
         }
@@ -4564,7 +4588,8 @@ void GL_APIENTRY glUniform2fv(GLint location, GLsizei count, const GLfloat* v)
     gl::Context *context = gl::getNonLostContext();
     if (context)
     {
-        if (!ValidateUniform(context, GL_FLOAT_VEC2, location, count))
+        if (context->skipValidation() ? !ValidateUniformNoError(context, GL_FLOAT_VEC2, location, count)
+                                       : !ValidateUniform(context, GL_FLOAT_VEC2, location, count))
         {
             return;
         }
@@ -4588,7 +4613,8 @@ void GL_APIENTRY glUniform2iv(GLint location, GLsizei count, const GLint* v)
     gl::Context *context = gl::getNonLostContext();
     if (context)
     {
-        if (!ValidateUniform(context, GL_INT_VEC2, location, count))
+        if (context->skipValidation() ? !ValidateUniformNoError(context, GL_INT_VEC2, location, count)
+                                       : !ValidateUniform(context, GL_INT_VEC2, location, count))
         {
             return;
         }
@@ -4612,7 +4638,8 @@ void GL_APIENTRY glUniform3fv(GLint location, GLsizei count, const GLfloat* v)
     gl::Context *context = gl::getNonLostContext();
     if (context)
     {
-        if (!ValidateUniform(context, GL_FLOAT_VEC3, location, count))
+        if (context->skipValidation() ? !ValidateUniformNoError(context, GL_FLOAT_VEC3, location, count)
+                                       : !ValidateUniform(context, GL_FLOAT_VEC3, location, count))
         {
             return;
         }
@@ -4636,7 +4663,8 @@ void GL_APIENTRY glUniform3iv(GLint location, GLsizei count, const GLint* v)
     gl::Context *context = gl::getNonLostContext();
     if (context)
     {
-        if (!ValidateUniform(context, GL_INT_VEC3, location, count))
+        if (context->skipValidation() ? !ValidateUniformNoError(context, GL_INT_VEC3, location, count)
+                                       : !ValidateUniform(context, GL_INT_VEC3, location, count))
         {
             return;
         }
@@ -4660,7 +4688,8 @@ void GL_APIENTRY glUniform4fv(GLint location, GLsizei count, const GLfloat* v)
     gl::Context *context = gl::getNonLostContext();
     if (context)
     {
-        if (!ValidateUniform(context, GL_FLOAT_VEC4, location, count))
+        if (context->skipValidation() ? !ValidateUniformNoError(context, GL_FLOAT_VEC4, location, count)
+                                       : !ValidateUniform(context, GL_FLOAT_VEC4, location, count))
         {
             return;
         }
@@ -4684,7 +4713,8 @@ void GL_APIENTRY glUniform4iv(GLint location, GLsizei count, const GLint* v)
     gl::Context *context = gl::getNonLostContext();
     if (context)
     {
-        if (!ValidateUniform(context, GL_INT_VEC4, location, count))
+        if (context->skipValidation() ? !ValidateUniformNoError(context, GL_INT_VEC4, location, count)
+                                       : !ValidateUniform(context, GL_INT_VEC4, location, count))
         {
             return;
         }
@@ -4702,7 +4732,8 @@ void GL_APIENTRY glUniformMatrix2fv(GLint location, GLsizei count, GLboolean tra
     gl::Context *context = gl::getNonLostContext();
     if (context)
     {
-        if (!ValidateUniformMatrix(context, GL_FLOAT_MAT2, location, count, transpose))
+        if (context->skipValidation() ? !ValidateUniformMatrixNoError(context, GL_FLOAT_MAT2, location, count)
+                                       : !ValidateUniformMatrix(context, GL_FLOAT_MAT2, location, count, transpose))
         {
             return;
         }
@@ -4720,7 +4751,8 @@ void GL_APIENTRY glUniformMatrix3fv(GLint location, GLsizei count, GLboolean tra
     gl::Context *context = gl::getNonLostContext();
     if (context)
     {
-        if (!ValidateUniformMatrix(context, GL_FLOAT_MAT3, location, count, transpose))
+        if (context->skipValidation() ? !ValidateUniformMatrixNoError(context, GL_FLOAT_MAT3, location, count)
+                                       : !ValidateUniformMatrix(context, GL_FLOAT_MAT3, location, count, transpose))
         {
             return;
         }
@@ -4738,7 +4770,8 @@ void GL_APIENTRY glUniformMatrix4fv(GLint location, GLsizei count, GLboolean tra
     gl::Context *context = gl::getNonLostContext();
     if (context)
     {
-        if (!ValidateUniformMatrix(context, GL_FLOAT_MAT4, location, count, transpose))
+        if (context->skipValidation() ? !ValidateUniformMatrixNoError(context, GL_FLOAT_MAT4, location, count)
+                                       : !ValidateUniformMatrix(context, GL_FLOAT_MAT4, location, count, transpose))
         {
             return;
         }
@@ -5679,7 +5712,8 @@ void GL_APIENTRY glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean t
     gl::Context *context = gl::getNonLostContext();
     if (context)
     {
-        if (!ValidateUniformMatrix(context, GL_FLOAT_MAT2x3, location, count, transpose))
+        if (context->skipValidation() ? !ValidateUniformMatrixNoError(context, GL_FLOAT_MAT2x3, location, count)
+                                       : !ValidateUniformMatrix(context, GL_FLOAT_MAT2x3, location, count, transpose))
         {
             return;
         }
@@ -5697,7 +5731,8 @@ void GL_APIENTRY glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean t
     gl::Context *context = gl::getNonLostContext();
     if (context)
     {
-        if (!ValidateUniformMatrix(context, GL_FLOAT_MAT3x2, location, count, transpose))
+        if (context->skipValidation() ? !ValidateUniformMatrixNoError(context, GL_FLOAT_MAT3x2, location, count)
+                                       : !ValidateUniformMatrix(context, GL_FLOAT_MAT3x2, location, count, transpose))
         {
             return;
         }
@@ -5715,7 +5750,8 @@ void GL_APIENTRY glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean t
     gl::Context *context = gl::getNonLostContext();
     if (context)
     {
-        if (!ValidateUniformMatrix(context, GL_FLOAT_MAT2x4, location, count, transpose))
+        if (context->skipValidation() ? !ValidateUniformMatrixNoError(context, GL_FLOAT_MAT2x4, location, count)
+                                       : !ValidateUniformMatrix(context, GL_FLOAT_MAT2x4, location, count, transpose))
         {
             return;
         }
@@ -5733,7 +5769,8 @@ void GL_APIENTRY glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean t
     gl::Context *context = gl::getNonLostContext();
     if (context)
     {
-        if (!ValidateUniformMatrix(context, GL_FLOAT_MAT4x2, location, count, transpose))
+        if (context->skipValidation() ? !ValidateUniformMatrixNoError(context, GL_FLOAT_MAT4x2, location, count)
+                                       : !ValidateUniformMatrix(context, GL_FLOAT_MAT4x2, location, count, transpose))
         {
             return;
         }
@@ -5751,7 +5788,8 @@ void GL_APIENTRY glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean t
     gl::Context *context = gl::getNonLostContext();
     if (context)
     {
-        if (!ValidateUniformMatrix(context, GL_FLOAT_MAT3x4, location, count, transpose))
+        if (context->skipValidation() ? !ValidateUniformMatrixNoError(context, GL_FLOAT_MAT3x4, location, count)
+                                       : !ValidateUniformMatrix(context, GL_FLOAT_MAT3x4, location, count, transpose))
         {
             return;
         }
@@ -5769,7 +5807,8 @@ void GL_APIENTRY glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean t
     gl::Context *context = gl::getNonLostContext();
     if (context)
     {
-        if (!ValidateUniformMatrix(context, GL_FLOAT_MAT4x3, location, count, transpose))
+        if (context->skipValidation() ? !ValidateUniformMatrixNoError(context, GL_FLOAT_MAT4x3, location, count)
+                                       : !ValidateUniformMatrix(context, GL_FLOAT_MAT4x3, location, count, transpose))
         {
             return;
         }
@@ -6735,7 +6774,8 @@ void GL_APIENTRY glUniform1uiv(GLint location, GLsizei count, const GLuint* valu
     gl::Context *context = gl::getNonLostContext();
     if (context)
     {
-        if (!ValidateUniform(context, GL_UNSIGNED_INT, location, count))
+        if (context->skipValidation() ? !ValidateUniformNoError(context, GL_UNSIGNED_INT, location, count)
+                                       : !ValidateUniform(context, GL_UNSIGNED_INT, location, count))
         {
             return;
         }
@@ -6753,7 +6793,8 @@ void GL_APIENTRY glUniform2uiv(GLint location, GLsizei count, const GLuint* valu
     gl::Context *context = gl::getNonLostContext();
     if (context)
     {
-        if (!ValidateUniform(context, GL_UNSIGNED_INT_VEC2, location, count))
+        if (context->skipValidation() ? !ValidateUniformNoError(context, GL_UNSIGNED_INT_VEC2, location, count)
+                                       : !ValidateUniform(context, GL_UNSIGNED_INT_VEC2, location, count))
         {
             return;
         }
@@ -6771,7 +6812,8 @@ void GL_APIENTRY glUniform3uiv(GLint location, GLsizei count, const GLuint* valu
     gl::Context *context = gl::getNonLostContext();
     if (context)
     {
-        if (!ValidateUniform(context, GL_UNSIGNED_INT_VEC3, location, count))
+        if (context->skipValidation() ? !ValidateUniformNoError(context, GL_UNSIGNED_INT_VEC3, location, count)
+                                       : !ValidateUniform(context, GL_UNSIGNED_INT_VEC3, location, count))
         {
             return;
         }
@@ -6789,7 +6831,8 @@ void GL_APIENTRY glUniform4uiv(GLint location, GLsizei count, const GLuint* valu
     gl::Context *context = gl::getNonLostContext();
     if (context)
     {
-        if (!ValidateUniform(context, GL_UNSIGNED_INT_VEC4, location, count))
+        if (context->skipValidation() ? !ValidateUniformNoError(context, GL_UNSIGNED_INT_VEC4, location, count)
+                                       : !ValidateUniform(context, GL_UNSIGNED_INT_VEC4, location, count))
         {
             return;
         }
@@ -117,6 +117,19 @@ extern "C" BOOL WINAPI DllMain(HINSTANCE instance, DWORD reason, LPVOID reserved
 
     return TRUE;
 }
+#elif defined(ANGLE_PLATFORM_POSIX)
+// Without DllMain, the index is created when the library is loaded and the thread data
+// is allocated lazily by GetCurrentData.
+__attribute__((constructor)) static void InitializeLibrary()
+{
+    gl::CreateThreadLocalIndex();
+}
+
+__attribute__((destructor)) static void UninitializeLibrary()
+{
+    gl::DeallocateCurrent();
+    gl::DestroyThreadLocalIndex();
+}
 #endif
 
 namespace gl
@@ -124,6 +137,12 @@ namespace gl
 
 Current *GetCurrentData()
 {
+    // Executables linking libGLESv2_static have no DllMain to create the index.
+    if (currentTLS == TLS_INVALID_INDEX)
+    {
+        CreateThreadLocalIndex();
+    }
+
     Current *current = reinterpret_cast<Current*>(GetTLSValue(currentTLS));
 
     // ANGLE issue 488: when the dll is loaded after thread initialization,
@@ -0,0 +1,236 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// ImageLoadExecutor.cpp: Implements the rx::ImageLoadExecutor class, which
+// splits large image loads into bands of rows, and large vertex conversions
+// into runs of vertices, and runs them on a pool of worker threads.
+
+#include "libGLESv2/renderer/ImageLoadExecutor.h"
+#include "libGLESv2/renderer/copyvertexSIMD.h"
+#include "libGLESv2/renderer/loadimageETC.h"
+#include "libGLESv2/renderer/loadimageSIMD.h"
+
+#include "common/debug.h"
+
+#include <algorithm>
+#include <string.h>
+
+namespace rx
+{
+
+// Bands are sized to stay in the L2 cache of the core that loads them.
+static const size_t BandBytes = 256 * 1024;
+
+// Past this many threads the loads are bound by memory bandwidth.
+static const size_t MaxDefaultThreads = 4;
+
+ImageLoadExecutor::ImageLoadExecutor(size_t maxThreads, size_t minParallelBytes)
+    : mMaxThreads(std::max<size_t>(maxThreads, 1)),
+      mMinParallelBytes(minParallelBytes),
+      mStopping(false),
+      mNextBand(0),
+      mBandsDone(0)
+{
+    memset(&mJob, 0, sizeof(mJob));
+
+    // The worker threads must not be the ones to build the kernel tables
+    InitializeLoadImageKernels();
+    InitializeETCExpandFunctions();
+    InitializeVertexCopyFunctions();
+}
+
+ImageLoadExecutor::~ImageLoadExecutor()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+    }
+    mWorkAvailable.notify_all();
+
+    for (size_t i = 0; i < mWorkers.size(); i++)
+    {
+        mWorkers[i].join();
+    }
+}
+
+size_t ImageLoadExecutor::GetDefaultMaxThreads()
+{
+    // hardware_concurrency may not know, and return 0
+    size_t hardwareThreads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    return std::min(hardwareThreads, MaxDefaultThreads);
+}
+
+void ImageLoadExecutor::load(LoadImageFunction loadFunction, size_t width, size_t height, size_t depth,
+                             const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                             uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    loadBlocks(loadFunction, 1, width, height, depth,
+               input, inputRowPitch, inputDepthPitch,
+               output, outputRowPitch, outputDepthPitch);
+}
+
+void ImageLoadExecutor::loadBlocks(LoadImageFunction loadFunction, size_t blockHeight, size_t width, size_t height, size_t depth,
+                                   const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                                   uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    ASSERT(blockHeight > 0);
+
+    // Counted in rows of blocks, which are rows of pixels for most formats
+    const size_t blockRowsPerSlice = (height + blockHeight - 1) / blockHeight;
+    const size_t rowCount = blockRowsPerSlice * depth;
+    const size_t outputBytes = outputRowPitch * height * depth;
+    if (mMaxThreads == 1 || outputBytes < mMinParallelBytes || rowCount < 2)
+    {
+        loadFunction(width, height, depth,
+                     input, inputRowPitch, inputDepthPitch,
+                     output, outputRowPitch, outputDepthPitch);
+        return;
+    }
+
+    LoadJob job;
+    job.loadFunction = loadFunction;
+    job.copyFunction = NULL;
+    job.width = width;
+    job.height = height;
+    job.input = input;
+    job.inputRowPitch = inputRowPitch;
+    job.inputDepthPitch = inputDepthPitch;
+    job.output = output;
+    job.outputRowPitch = outputRowPitch;
+    job.outputDepthPitch = outputDepthPitch;
+    job.blockHeight = blockHeight;
+    run(job, rowCount, depth);
+}
+
+void ImageLoadExecutor::copyVertices(VertexCopyFunction copyFunction, const uint8_t *input, size_t inputStride, size_t count,
+                                     uint8_t *output, size_t outputVertexBytes)
+{
+    if (mMaxThreads == 1 || outputVertexBytes * count < mMinParallelBytes || count < 2)
+    {
+        copyFunction(input, inputStride, count, output);
+        return;
+    }
+
+    LoadJob job;
+    job.loadFunction = NULL;
+    job.copyFunction = copyFunction;
+    job.width = 1;
+    job.height = count;
+    job.input = input;
+    job.inputRowPitch = inputStride;
+    job.inputDepthPitch = 0;
+    job.output = output;
+    job.outputRowPitch = outputVertexBytes;
+    job.outputDepthPitch = 0;
+    job.blockHeight = 1;
+    run(job, count, 1);
+}
+
+void ImageLoadExecutor::run(const LoadJob &job, size_t rowCount, size_t depth)
+{
+    const size_t blockRowsPerSlice = rowCount / depth;
+
+    // Cache sized bands, but enough of them for every thread to take a
+    // couple, which evens out the threads that start late.
+    size_t bandBlockRows = std::max<size_t>(BandBytes / (job.outputRowPitch * job.blockHeight), 1);
+    bandBlockRows = std::min(bandBlockRows, std::max<size_t>(rowCount / (mMaxThreads * 2), 1));
+    bandBlockRows = std::min(bandBlockRows, blockRowsPerSlice);
+
+    std::lock_guard<std::mutex> loadLock(mLoadMutex);
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    if (mWorkers.empty())
+    {
+        startWorkers();
+    }
+
+    mJob = job;
+    mJob.bandHeight = bandBlockRows * job.blockHeight;
+    mJob.bandsPerSlice = (blockRowsPerSlice + bandBlockRows - 1) / bandBlockRows;
+    mJob.bandCount = mJob.bandsPerSlice * depth;
+    mNextBand = 0;
+    mBandsDone = 0;
+    mWorkAvailable.notify_all();
+
+    // The calling thread loads too, then waits for the bands still running
+    loadBands(lock);
+    while (mBandsDone < mJob.bandCount)
+    {
+        mWorkDone.wait(lock);
+    }
+
+    mJob.bandCount = 0;
+}
+
+void ImageLoadExecutor::loadBand(const LoadJob &job, size_t band)
+{
+    size_t z = band / job.bandsPerSlice;
+    size_t y = (band % job.bandsPerSlice) * job.bandHeight;
+    size_t bandHeight = std::min(job.bandHeight, job.height - y);
+
+    if (job.copyFunction)
+    {
+        job.copyFunction(job.input + y * job.inputRowPitch, job.inputRowPitch, bandHeight,
+                         job.output + y * job.outputRowPitch);
+        return;
+    }
+
+    job.loadFunction(job.width, bandHeight, 1,
+                     job.input + z * job.inputDepthPitch + (y / job.blockHeight) * job.inputRowPitch,
+                     job.inputRowPitch, job.inputDepthPitch,
+                     job.output + z * job.outputDepthPitch + y * job.outputRowPitch,
+                     job.outputRowPitch, job.outputDepthPitch);
+}
+
+void ImageLoadExecutor::startWorkers()
+{
+    // No affinity is set; the OS spreads the threads, and each band is read
+    // and written by one thread.
+    for (size_t i = 1; i < mMaxThreads; i++)
+    {
+        mWorkers.push_back(std::thread(&ImageLoadExecutor::workerLoop, this));
+    }
+}
+
+void ImageLoadExecutor::workerLoop()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (!mStopping)
+    {
+        if (mNextBand < mJob.bandCount)
+        {
+            loadBands(lock);
+        }
+        else
+        {
+            mWorkAvailable.wait(lock);
+        }
+    }
+}
+
+void ImageLoadExecutor::loadBands(std::unique_lock<std::mutex> &lock)
+{
+    ASSERT(lock.owns_lock());
+
+    // mJob doesn't change until every band is done, so it is read unlocked
+    const LoadJob &job = mJob;
+    while (mNextBand < job.bandCount)
+    {
+        size_t band = mNextBand++;
+
+        lock.unlock();
+        loadBand(job, band);
+        lock.lock();
+
+        mBandsDone++;
+        if (mBandsDone == job.bandCount)
+        {
+            mWorkDone.notify_all();
+        }
+    }
+}
+
+}
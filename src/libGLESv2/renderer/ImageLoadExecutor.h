@@ -0,0 +1,119 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// ImageLoadExecutor.h: Defines the rx::ImageLoadExecutor class, which splits
+// large image loads into bands of rows, and large vertex conversions into runs
+// of vertices, and runs them on a pool of worker threads.
+
+#ifndef LIBGLESV2_RENDERER_IMAGELOADEXECUTOR_H_
+#define LIBGLESV2_RENDERER_IMAGELOADEXECUTOR_H_
+
+#include "common/angleutils.h"
+#include "libGLESv2/formatutils.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace rx
+{
+
+class ImageLoadExecutor
+{
+  public:
+    // At most |maxThreads| threads load an image, counting the calling
+    // thread. Images with less than |minParallelBytes| of output are loaded
+    // on the calling thread alone. The worker threads are started by the
+    // first load that needs them.
+    ImageLoadExecutor(size_t maxThreads, size_t minParallelBytes);
+    ~ImageLoadExecutor();
+
+    // Loads like calling |loadFunction| directly, which must convert every
+    // row independently of the others, as the load functions do.
+    void load(LoadImageFunction loadFunction, size_t width, size_t height, size_t depth,
+              const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+              uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch);
+
+    // The same for the functions that decompress blocks |blockHeight| pixels
+    // high into pixel rows: |inputRowPitch| is a row of blocks, and bands
+    // are whole rows of blocks.
+    void loadBlocks(LoadImageFunction loadFunction, size_t blockHeight, size_t width, size_t height, size_t depth,
+                    const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                    uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch);
+
+    // Converts like calling |copyFunction| directly, for vertices written
+    // |outputVertexBytes| apart. Runs of vertices are treated as bands of
+    // one pixel wide rows.
+    void copyVertices(VertexCopyFunction copyFunction, const uint8_t *input, size_t inputStride, size_t count,
+                      uint8_t *output, size_t outputVertexBytes);
+
+    size_t getMaxThreads() const { return mMaxThreads; }
+
+    // The number of threads the renderers use: the hardware threads, up to a
+    // few, past which the loads are bound by memory bandwidth.
+    static size_t GetDefaultMaxThreads();
+    static const size_t DefaultMinParallelBytes = 1024 * 1024;
+
+  private:
+    DISALLOW_COPY_AND_ASSIGN(ImageLoadExecutor);
+
+    struct LoadJob
+    {
+        // One of the two is set.
+        LoadImageFunction loadFunction;
+        VertexCopyFunction copyFunction;
+        size_t width;
+        size_t height;
+        const uint8_t *input;
+        size_t inputRowPitch;
+        size_t inputDepthPitch;
+        uint8_t *output;
+        size_t outputRowPitch;
+        size_t outputDepthPitch;
+
+        // Bands don't cross slices, and are a multiple of the block height.
+        size_t blockHeight;
+        size_t bandHeight;
+        size_t bandsPerSlice;
+        size_t bandCount;
+    };
+
+    static void loadBand(const LoadJob &job, size_t band);
+
+    // Runs |job| over |rowCount| rows of blocks, on the calling thread alone
+    // if it is small.
+    void run(const LoadJob &job, size_t rowCount, size_t depth);
+
+    void startWorkers();
+    void workerLoop();
+
+    // Loads bands of the current job until none is left. |lock| holds mMutex.
+    void loadBands(std::unique_lock<std::mutex> &lock);
+
+    const size_t mMaxThreads;
+    const size_t mMinParallelBytes;
+
+    // Held for the whole of a parallel load, so that loads from different
+    // contexts take turns.
+    std::mutex mLoadMutex;
+
+    // Protects everything below.
+    std::mutex mMutex;
+    std::condition_variable mWorkAvailable;
+    std::condition_variable mWorkDone;
+
+    std::vector<std::thread> mWorkers;
+    bool mStopping;
+
+    LoadJob mJob;
+    size_t mNextBand;
+    size_t mBandsDone;
+};
+
+}
+
+#endif // LIBGLESV2_RENDERER_IMAGELOADEXECUTOR_H_
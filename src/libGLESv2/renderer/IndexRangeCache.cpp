@@ -8,6 +8,7 @@
 // ranges of indices.
 
 #include "libGLESv2/renderer/IndexRangeCache.h"
+#include "libGLESv2/renderer/indexconversion.h"
 #include "libGLESv2/formatutils.h"
 
 #include "common/debug.h"
@@ -17,41 +18,62 @@
 namespace rx
 {
 
-template <class IndexType>
-static RangeUI ComputeTypedRange(const IndexType *indices, GLsizei count)
+namespace
 {
-    unsigned int minIndex = indices[0];
-    unsigned int maxIndex = indices[0];
 
-    for (GLsizei i = 1; i < count; i++)
+// The power of two at or below |size|, as an exponent. Zero sizes share the
+// class of one byte.
+unsigned int GetSizeClass(unsigned int size)
+{
+    unsigned int sizeClass = 0;
+    while (size > 1)
     {
-        if (minIndex > indices[i]) minIndex = indices[i];
-        if (maxIndex < indices[i]) maxIndex = indices[i];
+        size >>= 1;
+        sizeClass++;
     }
+    return sizeClass;
+}
+
+}
 
-    return RangeUI(minIndex, maxIndex);
+IndexRangeCache::IndexRangeCache(size_t maxRanges)
+    : mMaxRanges(maxRanges)
+{
+    ASSERT(maxRanges > 0);
 }
 
 RangeUI IndexRangeCache::ComputeRange(GLenum type, const GLvoid *indices, GLsizei count)
 {
-    switch (type)
-    {
-      case GL_UNSIGNED_BYTE:
-        return ComputeTypedRange(static_cast<const GLubyte*>(indices), count);
-      case GL_UNSIGNED_INT:
-        return ComputeTypedRange(static_cast<const GLuint*>(indices), count);
-      case GL_UNSIGNED_SHORT:
-        return ComputeTypedRange(static_cast<const GLushort*>(indices), count);
-      default:
-        UNREACHABLE();
-        return RangeUI();
-    }
+    return ComputeIndexRange(type, indices, count);
 }
 
 void IndexRangeCache::addRange(GLenum type, unsigned int offset, GLsizei count, const RangeUI &range,
                                unsigned int streamOffset)
 {
-    mIndexRangeCache[IndexRange(type, offset, count)] = IndexBounds(range, streamOffset);
+    IndexRange key(type, offset, count);
+
+    IndexRangeMap::iterator existing = mIndexRangeCache.find(key);
+    if (existing != mIndexRangeCache.end())
+    {
+        eraseRange(existing);
+    }
+    else if (mIndexRangeCache.size() >= mMaxRanges)
+    {
+        eraseRange(mIndexRangeCache.find(mRecentUses.back()));
+        mCounters.evictedRanges++;
+    }
+
+    Extent extent;
+    extent.start = streamOffset;
+    extent.size = gl::GetTypeInfo(type).bytes * count;
+    extent.sizeClass = GetSizeClass(extent.size);
+    extent.key = key;
+
+    CachedRange &cached = mIndexRangeCache[key];
+    cached.bounds = IndexBounds(range, streamOffset);
+    cached.extent = mExtents.insert(extent).first;
+    mRecentUses.push_front(key);
+    cached.recentUse = mRecentUses.begin();
 }
 
 void IndexRangeCache::invalidateRange(unsigned int offset, unsigned int size)
@@ -59,20 +81,39 @@ void IndexRangeCache::invalidateRange(unsigned int offset, unsigned int size)
     unsigned int invalidateStart = offset;
     unsigned int invalidateEnd = offset + size;
 
-    IndexRangeMap::iterator i = mIndexRangeCache.begin();
-    while (i != mIndexRangeCache.end())
+    for (ExtentSet::iterator classBegin = mExtents.begin(); classBegin != mExtents.end();)
     {
-        unsigned int rangeStart = i->second.streamOffset;
-        unsigned int rangeEnd = i->second.streamOffset + (gl::GetTypeInfo(i->first.type).bytes * i->first.count);
-
-        if (invalidateEnd < rangeStart || invalidateStart > rangeEnd)
-        {
-            ++i;
-        }
-        else
+        unsigned int sizeClass = classBegin->sizeClass;
+
+        // Extents of this class are smaller than 2^(sizeClass + 1) bytes, so
+        // one that starts further than that before the interval ends before it.
+        uint64_t maxSize = uint64_t(1) << (sizeClass + 1);
+        Extent first;
+        first.sizeClass = sizeClass;
+        first.start = (invalidateStart > maxSize) ? static_cast<unsigned int>(invalidateStart - maxSize) : 0;
+        first.size = 0;
+
+        ExtentSet::iterator extent = mExtents.lower_bound(first);
+        while (extent != mExtents.end() && extent->sizeClass == sizeClass && extent->start <= invalidateEnd)
         {
-            i = mIndexRangeCache.erase(i);
+            ExtentSet::iterator current = extent++;
+
+            unsigned int rangeStart = current->start;
+            unsigned int rangeEnd = current->start + current->size;
+
+            if (!(invalidateEnd < rangeStart || invalidateStart > rangeEnd))
+            {
+                eraseRange(mIndexRangeCache.find(current->key));
+                mCounters.invalidatedRanges++;
+            }
         }
+
+        // Skip to the next size class
+        Extent nextClass;
+        nextClass.sizeClass = sizeClass + 1;
+        nextClass.start = 0;
+        nextClass.size = 0;
+        classBegin = mExtents.lower_bound(nextClass);
     }
 }
 
@@ -82,12 +123,17 @@ bool IndexRangeCache::findRange(GLenum type, unsigned int offset, GLsizei count,
     IndexRangeMap::const_iterator i = mIndexRangeCache.find(IndexRange(type, offset, count));
     if (i != mIndexRangeCache.end())
     {
-        if (outRange)        *outRange = i->second.range;
-        if (outStreamOffset) *outStreamOffset = i->second.streamOffset;
+        mRecentUses.splice(mRecentUses.begin(), mRecentUses, i->second.recentUse);
+        mCounters.hits++;
+
+        if (outRange)        *outRange = i->second.bounds.range;
+        if (outStreamOffset) *outStreamOffset = i->second.bounds.streamOffset;
         return true;
     }
     else
     {
+        mCounters.misses++;
+
         if (outRange)        *outRange = RangeUI(0, 0);
         if (outStreamOffset) *outStreamOffset = 0;
         return false;
@@ -97,6 +143,16 @@ bool IndexRangeCache::findRange(GLenum type, unsigned int offset, GLsizei count,
 void IndexRangeCache::clear()
 {
     mIndexRangeCache.clear();
+    mExtents.clear();
+    mRecentUses.clear();
+}
+
+void IndexRangeCache::eraseRange(IndexRangeMap::iterator range)
+{
+    ASSERT(range != mIndexRangeCache.end());
+    mExtents.erase(range->second.extent);
+    mRecentUses.erase(range->second.recentUse);
+    mIndexRangeCache.erase(range);
 }
 
 IndexRangeCache::IndexRange::IndexRange()
@@ -125,4 +181,17 @@ IndexRangeCache::IndexBounds::IndexBounds(const RangeUI &rangeIn, unsigned int o
 {
 }
 
+bool IndexRangeCache::Extent::operator<(const Extent &rhs) const
+{
+    return std::make_tuple(sizeClass, start, size, key) < std::make_tuple(rhs.sizeClass, rhs.start, rhs.size, rhs.key);
+}
+
+IndexRangeCache::Counters::Counters()
+    : hits(0),
+      misses(0),
+      invalidatedRanges(0),
+      evictedRanges(0)
+{
+}
+
 }
@@ -15,7 +15,9 @@
 
 #include "angle_gl.h"
 
+#include <list>
 #include <map>
+#include <set>
 
 namespace rx
 {
@@ -23,16 +25,37 @@ namespace rx
 class IndexRangeCache
 {
   public:
+    // Past |maxRanges| cached ranges, the least recently used one is dropped.
+    explicit IndexRangeCache(size_t maxRanges = DefaultMaxRanges);
+
     void addRange(GLenum type, unsigned int offset, GLsizei count, const RangeUI &range,
                   unsigned int streamOffset);
     bool findRange(GLenum type, unsigned int offset, GLsizei count, RangeUI *rangeOut,
                    unsigned int *outStreamOffset) const;
 
+    // Drops the ranges whose indices, at their stream offset, overlap or touch
+    // [offset, offset + size]. Only the overlapping ranges are visited.
     void invalidateRange(unsigned int offset, unsigned int size);
     void clear();
 
+    size_t size() const { return mIndexRangeCache.size(); }
+
+    // Totals since the cache was created, kept across clear().
+    struct Counters
+    {
+        Counters();
+
+        size_t hits;
+        size_t misses;
+        size_t invalidatedRanges;
+        size_t evictedRanges;
+    };
+    const Counters &getCounters() const { return mCounters; }
+
     static RangeUI ComputeRange(GLenum type, const GLvoid *indices, GLsizei count);
 
+    static const size_t DefaultMaxRanges = 4096;
+
   private:
     struct IndexRange
     {
@@ -55,8 +78,42 @@ class IndexRangeCache
         IndexBounds(const RangeUI &range, unsigned int offset);
     };
 
-    typedef std::map<IndexRange, IndexBounds> IndexRangeMap;
+    // The bytes read by a cached range. Extents are sorted by the power of
+    // two below their size, then by start: an extent overlapping a given
+    // interval starts at most twice its size class before it, which bounds
+    // the starts to look at in each class.
+    struct Extent
+    {
+        unsigned int sizeClass;
+        unsigned int start;
+        unsigned int size;
+        IndexRange key;
+
+        bool operator<(const Extent &rhs) const;
+    };
+    typedef std::set<Extent> ExtentSet;
+
+    // Most recently used first.
+    typedef std::list<IndexRange> RecentUseList;
+
+    struct CachedRange
+    {
+        IndexBounds bounds;
+        ExtentSet::iterator extent;
+        RecentUseList::iterator recentUse;
+    };
+
+    typedef std::map<IndexRange, CachedRange> IndexRangeMap;
+
+    void eraseRange(IndexRangeMap::iterator range);
+
+    DISALLOW_COPY_AND_ASSIGN(IndexRangeCache);
+
+    size_t mMaxRanges;
     IndexRangeMap mIndexRangeCache;
+    ExtentSet mExtents;
+    mutable RecentUseList mRecentUses;
+    mutable Counters mCounters;
 };
 
 }
@@ -14,27 +14,6 @@
 namespace rx
 {
 
-namespace
-{
-
-unsigned int ParseAndStripArrayIndex(std::string* name)
-{
-    unsigned int subscript = GL_INVALID_INDEX;
-
-    // Strip any trailing array operator and retrieve the subscript
-    size_t open = name->find_last_of('[');
-    size_t close = name->find_last_of(']');
-    if (open != std::string::npos && close == name->length() - 1)
-    {
-        subscript = atoi(name->substr(open + 1).c_str());
-        name->erase(open);
-    }
-
-    return subscript;
-}
-
-}
-
 ProgramImpl::~ProgramImpl()
 {
     // Ensure that reset was called by the inherited class during destruction
@@ -66,73 +45,83 @@ gl::UniformBlock *ProgramImpl::getUniformBlockByIndex(GLuint blockIndex) const
     return mUniformBlocks[blockIndex];
 }
 
-GLint ProgramImpl::getUniformLocation(std::string name)
+GLint ProgramImpl::getUniformLocation(const char *name) const
+{
+    GLuint location = mUniformLocations.find(name);
+    return (location != GL_INVALID_INDEX) ? static_cast<GLint>(location) : -1;
+}
+
+GLuint ProgramImpl::getUniformIndex(const char *name) const
 {
-    unsigned int subscript = ParseAndStripArrayIndex(&name);
+    return mUniformIndexes.find(name);
+}
+
+GLuint ProgramImpl::getUniformBlockIndex(const char *name) const
+{
+    return mUniformBlockIndexes.find(name);
+}
 
-    unsigned int numUniforms = mUniformIndex.size();
-    for (unsigned int location = 0; location < numUniforms; location++)
+GLuint ProgramImpl::findUniformBlockIndex(const std::string &name) const
+{
+    for (size_t blockIndex = 0; blockIndex < mUniformBlocks.size(); blockIndex++)
     {
-        if (mUniformIndex[location].name == name)
+        if (mUniformBlocks[blockIndex]->name == name)
         {
-            const int index = mUniformIndex[location].index;
-            const bool isArray = mUniforms[index]->isArray();
-
-            if ((isArray && mUniformIndex[location].element == subscript) ||
-                (subscript == GL_INVALID_INDEX))
-            {
-                return location;
-            }
+            return static_cast<GLuint>(blockIndex);
         }
     }
 
-    return -1;
+    return GL_INVALID_INDEX;
 }
 
-GLuint ProgramImpl::getUniformIndex(std::string name)
+void ProgramImpl::indexUniformNames()
 {
-    unsigned int subscript = ParseAndStripArrayIndex(&name);
+    mUniformLocations.clear();
+    mUniformIndexes.clear();
+    mUniformBlockIndexes.clear();
 
-    // The app is not allowed to specify array indices other than 0 for arrays of basic types
-    if (subscript != 0 && subscript != GL_INVALID_INDEX)
+    // An array is found by its name alone, which means its first element, or with the
+    // subscript of any of its elements. Other uniforms take no subscript.
+    for (size_t location = 0; location < mUniformIndex.size(); location++)
     {
-        return GL_INVALID_INDEX;
-    }
+        const gl::VariableLocation &variable = mUniformIndex[location];
+        GLuint value = static_cast<GLuint>(location);
 
-    unsigned int numUniforms = mUniforms.size();
-    for (unsigned int index = 0; index < numUniforms; index++)
-    {
-        if (mUniforms[index]->name == name)
+        mUniformLocations.insert(variable.name, value);
+        if (mUniforms[variable.index]->isArray())
         {
-            if (mUniforms[index]->isArray() || subscript == GL_INVALID_INDEX)
-            {
-                return index;
-            }
+            mUniformLocations.insert(variable.name + ArrayString(variable.element), value);
         }
     }
 
-    return GL_INVALID_INDEX;
-}
+    // Only the first element of an array has an index of its own
+    for (size_t uniformIndex = 0; uniformIndex < mUniforms.size(); uniformIndex++)
+    {
+        const gl::LinkedUniform &uniform = *mUniforms[uniformIndex];
+        GLuint value = static_cast<GLuint>(uniformIndex);
 
-GLuint ProgramImpl::getUniformBlockIndex(std::string name) const
-{
-    unsigned int subscript = ParseAndStripArrayIndex(&name);
+        mUniformIndexes.insert(uniform.name, value);
+        if (uniform.isArray())
+        {
+            mUniformIndexes.insert(uniform.name + ArrayString(0), value);
+        }
+    }
 
-    unsigned int numUniformBlocks = mUniformBlocks.size();
-    for (unsigned int blockIndex = 0; blockIndex < numUniformBlocks; blockIndex++)
+    // Each element of a block array is a block of its own, the name alone means the first
+    for (size_t blockIndex = 0; blockIndex < mUniformBlocks.size(); blockIndex++)
     {
         const gl::UniformBlock &uniformBlock = *mUniformBlocks[blockIndex];
-        if (uniformBlock.name == name)
+        GLuint value = static_cast<GLuint>(blockIndex);
+
+        if (uniformBlock.elementIndex == GL_INVALID_INDEX || uniformBlock.elementIndex == 0)
         {
-            const bool arrayElementZero = (subscript == GL_INVALID_INDEX && uniformBlock.elementIndex == 0);
-            if (subscript == uniformBlock.elementIndex || arrayElementZero)
-            {
-                return blockIndex;
-            }
+            mUniformBlockIndexes.insert(uniformBlock.name, value);
+        }
+        if (uniformBlock.elementIndex != GL_INVALID_INDEX)
+        {
+            mUniformBlockIndexes.insert(uniformBlock.name + ArrayString(uniformBlock.elementIndex), value);
         }
     }
-
-    return GL_INVALID_INDEX;
 }
 
 void ProgramImpl::reset()
@@ -141,6 +130,10 @@ void ProgramImpl::reset()
     mUniformIndex.clear();
     SafeDeleteContainer(mUniformBlocks);
     mTransformFeedbackLinkedVaryings.clear();
+
+    mUniformLocations.clear();
+    mUniformIndexes.clear();
+    mUniformBlockIndexes.clear();
 }
 
 }
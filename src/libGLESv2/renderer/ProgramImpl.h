@@ -12,6 +12,7 @@
 #include "common/angleutils.h"
 #include "libGLESv2/BinaryStream.h"
 #include "libGLESv2/Constants.h"
+#include "libGLESv2/NameTable.h"
 #include "libGLESv2/ProgramBinary.h"
 #include "libGLESv2/Shader.h"
 #include "libGLESv2/renderer/Renderer.h"
@@ -45,9 +46,12 @@ class ProgramImpl
     gl::LinkedUniform *getUniformByName(const std::string &name) const;
     gl::UniformBlock *getUniformBlockByIndex(GLuint blockIndex) const;
 
-    GLint getUniformLocation(std::string name);
-    GLuint getUniformIndex(std::string name);
-    GLuint getUniformBlockIndex(std::string name) const;
+    GLint getUniformLocation(const char *name) const;
+    GLuint getUniformIndex(const char *name) const;
+    GLuint getUniformBlockIndex(const char *name) const;
+
+    // Builds the tables the three lookups above use, once the uniforms and uniform blocks are final
+    void indexUniformNames();
 
     virtual bool usesPointSize() const = 0;
     virtual int getShaderVersion() const = 0;
@@ -96,6 +100,7 @@ class ProgramImpl
     virtual GLenum getSamplerTextureType(gl::SamplerType type, unsigned int samplerIndex) const = 0;
     virtual GLint getUsedSamplerRange(gl::SamplerType type) const = 0;
     virtual void updateSamplerMapping() = 0;
+    virtual unsigned int getSamplerMappingSerial() const = 0;
     virtual bool validateSamplers(gl::InfoLog *infoLog, const gl::Caps &caps) = 0;
 
     virtual gl::LinkResult compileProgramExecutables(gl::InfoLog &infoLog, gl::Shader *fragmentShader, gl::Shader *vertexShader,
@@ -114,12 +119,20 @@ class ProgramImpl
   protected:
     DISALLOW_COPY_AND_ASSIGN(ProgramImpl);
 
+    // Searches the blocks defined so far, for use while linking before the name tables exist
+    GLuint findUniformBlockIndex(const std::string &name) const;
+
     std::vector<gl::LinkedUniform*> mUniforms;
     std::vector<gl::VariableLocation> mUniformIndex;
     std::vector<gl::UniformBlock*> mUniformBlocks;
     std::vector<gl::LinkedVarying> mTransformFeedbackLinkedVaryings;
 
     sh::Attribute mShaderAttributes[gl::MAX_VERTEX_ATTRIBS];
+
+  private:
+    gl::NameTable mUniformLocations;
+    gl::NameTable mUniformIndexes;
+    gl::NameTable mUniformBlockIndexes;
 };
 
 }
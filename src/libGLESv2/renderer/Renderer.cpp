@@ -9,6 +9,7 @@
 #include "libGLESv2/main.h"
 #include "libGLESv2/Program.h"
 #include "libGLESv2/renderer/Renderer.h"
+#include "libGLESv2/renderer/ImageLoadExecutor.h"
 #include "common/utilities.h"
 #include "third_party/trace_event/trace_event.h"
 #include "libGLESv2/Shader.h"
@@ -23,6 +24,10 @@
 #include "libGLESv2/renderer/d3d/d3d11/Renderer11.h"
 #endif // ANGLE_ENABLE_D3D11
 
+#if defined (ANGLE_ENABLE_NULL)
+#include "libGLESv2/renderer/null/NullRenderer.h"
+#endif // ANGLE_ENABLE_NULL
+
 #if defined (ANGLE_ENABLE_WINDOWS_STORE) || defined (ANGLE_TEST_CONFIG)
 #define ANGLE_DEFAULT_D3D11 1
 #endif
@@ -41,12 +46,30 @@ Renderer::Renderer(egl::Display *display)
     : mDisplay(display),
       mCapsInitialized(false),
       mWorkaroundsInitialized(false),
-      mCurrentClientVersion(2)
+      mImageLoadExecutor(new ImageLoadExecutor(ImageLoadExecutor::GetDefaultMaxThreads(),
+                                               ImageLoadExecutor::DefaultMinParallelBytes)),
+      mCurrentClientVersion(2),
+      mAppliedStateSerial(0)
 {
 }
 
 Renderer::~Renderer()
 {
+    SafeDelete(mImageLoadExecutor);
+}
+
+gl::Error Renderer::generateMipmapChain(Image **images, size_t imageCount)
+{
+    for (size_t i = 1; i < imageCount; i++)
+    {
+        gl::Error error = generateMipmap(images[i], images[i - 1]);
+        if (error.isError())
+        {
+            return error;
+        }
+    }
+
+    return gl::Error(GL_NO_ERROR);
 }
 
 const gl::Caps &Renderer::getRendererCaps() const
@@ -129,6 +152,14 @@ rx::Renderer *glCreateRenderer(egl::Display *display, EGLNativeDisplayType nativ
         }
 #   endif
 
+#   if defined(ANGLE_ENABLE_NULL)
+        // Never picked for the default display, only when asked for
+        if (requestedDisplayType == EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE)
+        {
+            rendererCreationFunctions.push_back(rx::CreateRenderer<rx::NullRenderer>);
+        }
+#   endif
+
     if (nativeDisplay != EGL_D3D11_ELSE_D3D9_DISPLAY_ANGLE &&
         nativeDisplay != EGL_D3D11_ONLY_DISPLAY_ANGLE &&
         requestedDisplayType == EGL_PLATFORM_ANGLE_TYPE_DEFAULT_ANGLE)
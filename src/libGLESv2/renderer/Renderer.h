@@ -22,12 +22,17 @@
 #include <EGL/egl.h>
 
 #if !defined(ANGLE_COMPILE_OPTIMIZATION_LEVEL)
+#if defined(ANGLE_ENABLE_D3D9) || defined(ANGLE_ENABLE_D3D11)
 // WARNING: D3DCOMPILE_OPTIMIZATION_LEVEL3 may lead to a DX9 shader compiler hang.
 // It should only be used selectively to work around specific bugs.
 #define ANGLE_COMPILE_OPTIMIZATION_LEVEL D3DCOMPILE_OPTIMIZATION_LEVEL1
+#else
+// Without a D3D back-end nothing is compiled, the level only tags program binaries.
+#define ANGLE_COMPILE_OPTIMIZATION_LEVEL 0
+#endif
 #endif
 
-#if !defined (ANGLE_ENABLE_WINDOWS_STORE)
+#if defined(ANGLE_PLATFORM_WINDOWS) && !defined(ANGLE_ENABLE_WINDOWS_STORE)
 inline bool IsWindowsVersionOrGreater(unsigned short wMajorVersion, unsigned short wMinorVersion, unsigned  wServicePackMajor)
 {
     OSVERSIONINFOEXW osvi = { sizeof(osvi), 0, 0, 0, 0, { 0 }, 0, 0 };
@@ -49,7 +54,7 @@ inline bool IsWindowsVistaOrGreater()
 {
     return IsWindowsVersionOrGreater(HIBYTE(_WIN32_WINNT_VISTA), LOBYTE(_WIN32_WINNT_VISTA), 0);
 }
-#endif // !defined (ANGLE_ENABLE_WINDOWS_STORE)
+#endif // ANGLE_PLATFORM_WINDOWS && !ANGLE_ENABLE_WINDOWS_STORE
 
 namespace egl
 {
@@ -90,6 +95,7 @@ class TextureStorage;
 class UniformStorage;
 class TextureImpl;
 class TransformFeedbackImpl;
+class ImageLoadExecutor;
 
 struct ConfigDesc
 {
@@ -172,6 +178,10 @@ class Renderer
 
     virtual void markAllStateDirty() = 0;
 
+    // Bumped whenever the renderer forgets the state it has applied or forces some of it to be
+    // set again, so that callers skipping unchanged state know to apply all of it.
+    unsigned int getAppliedStateSerial() const { return mAppliedStateSerial; }
+
     // lost device
     virtual void notifyDeviceLost() = 0;
     virtual bool isDeviceLost() = 0;
@@ -244,6 +254,9 @@ class Renderer
     // Image operations
     virtual Image *createImage() = 0;
     virtual gl::Error generateMipmap(Image *dest, Image *source) = 0;
+    // Generates images 1 to imageCount - 1 from image 0, each the next mip
+    // level of the one before.
+    virtual gl::Error generateMipmapChain(Image **images, size_t imageCount);
     virtual TextureStorage *createTextureStorage2D(SwapChain *swapChain) = 0;
     virtual TextureStorage *createTextureStorage2D(GLenum internalformat, bool renderTarget, GLsizei width, GLsizei height, int levels, bool hintLevelZeroOnly = false) = 0;
     virtual TextureStorage *createTextureStorageCube(GLenum internalformat, bool renderTarget, int size, int levels) = 0;
@@ -284,7 +297,12 @@ class Renderer
 
     const Workarounds &getWorkarounds() const;
 
+    // Runs the load functions of large texture uploads on worker threads.
+    ImageLoadExecutor *getImageLoadExecutor() { return mImageLoadExecutor; }
+
   protected:
+    void invalidateAppliedState() { mAppliedStateSerial++; }
+
     egl::Display *mDisplay;
 
   private:
@@ -301,7 +319,11 @@ class Renderer
     mutable bool mWorkaroundsInitialized;
     mutable Workarounds mWorkarounds;
 
+    ImageLoadExecutor *mImageLoadExecutor;
+
     int mCurrentClientVersion;
+
+    unsigned int mAppliedStateSerial;
 };
 
 }
@@ -8,9 +8,129 @@
 
 #include "libGLESv2/renderer/copyimage.h"
 
+#include <cstring>
+#include <map>
+
 namespace rx
 {
 
+namespace
+{
+
+// The formats of imageformats.h that read and write each type of color
+#define ANGLE_FLOAT_COLOR_FORMATS(OP) \
+    OP(L8) OP(R8) OP(A8) OP(L8A8) OP(A8L8) OP(R8G8) OP(R8G8B8) OP(B8G8R8) OP(R5G6B5) OP(A8R8G8B8) \
+    OP(R8G8B8A8) OP(B8G8R8A8) OP(B8G8R8X8) OP(B5G5R5A1) OP(R5G5B5A1) OP(R4G4B4A4) OP(A4R4G4B4) \
+    OP(B4G4R4A4) OP(R16) OP(R16G16) OP(R16G16B16) OP(R16G16B16A16) OP(R32) OP(R32G32) OP(R32G32B32) \
+    OP(R32G32B32A32) OP(R8S) OP(R8G8S) OP(R8G8B8S) OP(R8G8B8A8S) OP(R16S) OP(R16G16S) OP(R16G16B16S) \
+    OP(R16G16B16A16S) OP(R32S) OP(R32G32S) OP(R32G32B32S) OP(R32G32B32A32S) OP(A16B16G16R16F) \
+    OP(R16G16B16A16F) OP(R16F) OP(A16F) OP(L16F) OP(L16A16F) OP(R16G16F) OP(R16G16B16F) \
+    OP(A32B32G32R32F) OP(R32G32B32A32F) OP(R32F) OP(A32F) OP(L32F) OP(L32A32F) OP(R32G32F) \
+    OP(R32G32B32F) OP(R10G10B10A2) OP(R9G9B9E5) OP(R11G11B10F)
+
+#define ANGLE_UINT_COLOR_FORMATS(OP) \
+    OP(R8) OP(R8G8) OP(R8G8B8) OP(B8G8R8) OP(A8R8G8B8) OP(R8G8B8A8) OP(B8G8R8A8) OP(B8G8R8X8) \
+    OP(R16) OP(R16G16) OP(R16G16B16) OP(R16G16B16A16) OP(R32) OP(R32G32) OP(R32G32B32) \
+    OP(R32G32B32A32) OP(R10G10B10A2)
+
+#define ANGLE_INT_COLOR_FORMATS(OP) \
+    OP(R8S) OP(R8G8S) OP(R8G8B8S) OP(R8G8B8A8S) OP(R16S) OP(R16G16S) OP(R16G16B16S) \
+    OP(R16G16B16A16S) OP(R32S) OP(R32G32S) OP(R32G32B32S) OP(R32G32B32A32S)
+
+template <typename sourceType, typename destType, typename colorDataType>
+void AddColorRowCopy(std::vector<ColorRowCopy> *copies)
+{
+    ColorRowCopy copy;
+    copy.readFunction = ReadColor<sourceType, colorDataType>;
+    copy.sourcePixelBytes = sizeof(sourceType);
+    copy.writeFunction = WriteColor<destType, colorDataType>;
+    copy.destPixelBytes = sizeof(destType);
+    copy.copyRowFunction = CopyColorRow<sourceType, destType, colorDataType>;
+    copies->push_back(copy);
+}
+
+template <typename sourceType>
+void AddFloatColorRowCopies(std::vector<ColorRowCopy> *copies)
+{
+#define ADD_COLOR_ROW_COPY(destType) AddColorRowCopy<sourceType, destType, GLfloat>(copies);
+    ANGLE_FLOAT_COLOR_FORMATS(ADD_COLOR_ROW_COPY)
+#undef ADD_COLOR_ROW_COPY
+}
+
+template <typename sourceType>
+void AddUIntColorRowCopies(std::vector<ColorRowCopy> *copies)
+{
+#define ADD_COLOR_ROW_COPY(destType) AddColorRowCopy<sourceType, destType, GLuint>(copies);
+    ANGLE_UINT_COLOR_FORMATS(ADD_COLOR_ROW_COPY)
+#undef ADD_COLOR_ROW_COPY
+}
+
+template <typename sourceType>
+void AddIntColorRowCopies(std::vector<ColorRowCopy> *copies)
+{
+#define ADD_COLOR_ROW_COPY(destType) AddColorRowCopy<sourceType, destType, GLint>(copies);
+    ANGLE_INT_COLOR_FORMATS(ADD_COLOR_ROW_COPY)
+#undef ADD_COLOR_ROW_COPY
+}
+
+std::vector<ColorRowCopy> BuildColorRowCopies()
+{
+    std::vector<ColorRowCopy> copies;
+
+#define ADD_COLOR_ROW_COPIES(sourceType) AddFloatColorRowCopies<sourceType>(&copies);
+    ANGLE_FLOAT_COLOR_FORMATS(ADD_COLOR_ROW_COPIES)
+#undef ADD_COLOR_ROW_COPIES
+
+#define ADD_COLOR_ROW_COPIES(sourceType) AddUIntColorRowCopies<sourceType>(&copies);
+    ANGLE_UINT_COLOR_FORMATS(ADD_COLOR_ROW_COPIES)
+#undef ADD_COLOR_ROW_COPIES
+
+#define ADD_COLOR_ROW_COPIES(sourceType) AddIntColorRowCopies<sourceType>(&copies);
+    ANGLE_INT_COLOR_FORMATS(ADD_COLOR_ROW_COPIES)
+#undef ADD_COLOR_ROW_COPIES
+
+    return copies;
+}
+
+struct ColorRowCopyKey
+{
+    ColorReadFunction readFunction;
+    size_t sourcePixelBytes;
+    ColorWriteFunction writeFunction;
+    size_t destPixelBytes;
+
+    ColorRowCopyKey(ColorReadFunction readFunction, size_t sourcePixelBytes, ColorWriteFunction writeFunction, size_t destPixelBytes)
+        : readFunction(readFunction), sourcePixelBytes(sourcePixelBytes), writeFunction(writeFunction), destPixelBytes(destPixelBytes)
+    {
+    }
+
+    bool operator<(const ColorRowCopyKey &other) const
+    {
+        return memcmp(this, &other, sizeof(ColorRowCopyKey)) < 0;
+    }
+};
+
+typedef std::map<ColorRowCopyKey, ColorRowCopyFunction> ColorRowCopyMap;
+
+ColorRowCopyMap BuildColorRowCopyMap()
+{
+    ColorRowCopyMap map;
+
+    // Copies that are merged by the linker do the same thing, so keeping the
+    // first one is enough.
+    const std::vector<ColorRowCopy> &copies = GetColorRowCopies();
+    for (size_t i = 0; i < copies.size(); i++)
+    {
+        const ColorRowCopy &copy = copies[i];
+        ColorRowCopyKey key(copy.readFunction, copy.sourcePixelBytes, copy.writeFunction, copy.destPixelBytes);
+        map.insert(std::make_pair(key, copy.copyRowFunction));
+    }
+
+    return map;
+}
+
+}
+
 void CopyBGRA8ToRGBA8(const uint8_t *source, uint8_t *dest)
 {
     uint32_t argb = *reinterpret_cast<const uint32_t*>(source);
@@ -19,4 +139,18 @@ void CopyBGRA8ToRGBA8(const uint8_t *source, uint8_t *dest)
                                          (argb & 0x000000FF) << 16;  // Move blue to red
 }
 
+const std::vector<ColorRowCopy> &GetColorRowCopies()
+{
+    static const std::vector<ColorRowCopy> copies = BuildColorRowCopies();
+    return copies;
+}
+
+ColorRowCopyFunction GetColorRowCopyFunction(ColorReadFunction readFunction, size_t sourcePixelBytes,
+                                             ColorWriteFunction writeFunction, size_t destPixelBytes)
+{
+    static const ColorRowCopyMap map = BuildColorRowCopyMap();
+    ColorRowCopyMap::const_iterator iter = map.find(ColorRowCopyKey(readFunction, sourcePixelBytes, writeFunction, destPixelBytes));
+    return (iter != map.end()) ? iter->second : NULL;
+}
+
 }
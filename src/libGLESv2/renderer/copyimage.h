@@ -11,8 +11,11 @@
 
 #include "common/mathutil.h"
 #include "libGLESv2/angletypes.h"
+#include "libGLESv2/formatutils.h"
+#include "libGLESv2/renderer/imageformats.h"
 
 #include <cstdint>
+#include <vector>
 
 namespace rx
 {
@@ -26,8 +29,33 @@ void WriteColor(const uint8_t *source, uint8_t *dest);
 template <typename sourceType, typename destType, typename colorDataType>
 void CopyPixel(const uint8_t *source, uint8_t *dest);
 
+// Same as CopyPixel for |count| consecutive pixels, in a loop that the
+// compiler can inline both conversions into.
+template <typename sourceType, typename destType, typename colorDataType>
+void CopyColorRow(size_t count, const uint8_t *source, uint8_t *dest);
+
 void CopyBGRA8ToRGBA8(const uint8_t *source, uint8_t *dest);
 
+struct ColorRowCopy
+{
+    ColorReadFunction readFunction;
+    size_t sourcePixelBytes;
+    ColorWriteFunction writeFunction;
+    size_t destPixelBytes;
+    ColorRowCopyFunction copyRowFunction;
+};
+
+// The CopyColorRow of every pair of formats in imageformats.h that read and
+// write the same type of color.
+const std::vector<ColorRowCopy> &GetColorRowCopies();
+
+// Returns the CopyColorRow that does the same as |readFunction| followed by
+// |writeFunction|, or NULL if there is none. The linker may merge identical
+// ReadColor or WriteColor functions of different formats, so the pixel sizes
+// are needed to tell them apart.
+ColorRowCopyFunction GetColorRowCopyFunction(ColorReadFunction readFunction, size_t sourcePixelBytes,
+                                             ColorWriteFunction writeFunction, size_t destPixelBytes);
+
 }
 
 #include "copyimage.inl"
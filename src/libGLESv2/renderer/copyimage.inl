@@ -29,4 +29,246 @@ inline void CopyPixel(const uint8_t *source, uint8_t *dest)
     WriteColor<destType, colorDataType>(&temp, dest);
 }
 
+namespace priv
+{
+
+// Formats made only of 8 bit normalized channels. Going through floats from one
+// of them to another gives back the same bytes, since
+// floatToNormalized(normalizedToFloat(x)) == x, so CopyColorRow copies the
+// bytes directly. Missing channels read as 0, and alpha as 255, like 1.0f.
+template <typename T>
+struct UNorm8Channels
+{
+    static const bool supported = false;
+};
+
+template <>
+struct UNorm8Channels<R8>
+{
+    static const bool supported = true;
+
+    static void read(gl::Color<uint8_t> *dst, const R8 *src)
+    {
+        dst->red   = src->R;
+        dst->green = 0;
+        dst->blue  = 0;
+        dst->alpha = 255;
+    }
+
+    static void write(R8 *dst, const gl::Color<uint8_t> *src)
+    {
+        dst->R = src->red;
+    }
+};
+
+template <>
+struct UNorm8Channels<A8>
+{
+    static const bool supported = true;
+
+    static void read(gl::Color<uint8_t> *dst, const A8 *src)
+    {
+        dst->red   = 0;
+        dst->green = 0;
+        dst->blue  = 0;
+        dst->alpha = src->A;
+    }
+
+    static void write(A8 *dst, const gl::Color<uint8_t> *src)
+    {
+        dst->A = src->alpha;
+    }
+};
+
+template <>
+struct UNorm8Channels<R8G8>
+{
+    static const bool supported = true;
+
+    static void read(gl::Color<uint8_t> *dst, const R8G8 *src)
+    {
+        dst->red   = src->R;
+        dst->green = src->G;
+        dst->blue  = 0;
+        dst->alpha = 255;
+    }
+
+    static void write(R8G8 *dst, const gl::Color<uint8_t> *src)
+    {
+        dst->R = src->red;
+        dst->G = src->green;
+    }
+};
+
+template <>
+struct UNorm8Channels<R8G8B8>
+{
+    static const bool supported = true;
+
+    static void read(gl::Color<uint8_t> *dst, const R8G8B8 *src)
+    {
+        dst->red   = src->R;
+        dst->green = src->G;
+        dst->blue  = src->B;
+        dst->alpha = 255;
+    }
+
+    static void write(R8G8B8 *dst, const gl::Color<uint8_t> *src)
+    {
+        dst->R = src->red;
+        dst->G = src->green;
+        dst->B = src->blue;
+    }
+};
+
+template <>
+struct UNorm8Channels<B8G8R8>
+{
+    static const bool supported = true;
+
+    static void read(gl::Color<uint8_t> *dst, const B8G8R8 *src)
+    {
+        dst->red   = src->R;
+        dst->green = src->G;
+        dst->blue  = src->B;
+        dst->alpha = 255;
+    }
+
+    static void write(B8G8R8 *dst, const gl::Color<uint8_t> *src)
+    {
+        dst->R = src->red;
+        dst->G = src->green;
+        dst->B = src->blue;
+    }
+};
+
+template <>
+struct UNorm8Channels<A8R8G8B8>
+{
+    static const bool supported = true;
+
+    static void read(gl::Color<uint8_t> *dst, const A8R8G8B8 *src)
+    {
+        dst->red   = src->R;
+        dst->green = src->G;
+        dst->blue  = src->B;
+        dst->alpha = src->A;
+    }
+
+    static void write(A8R8G8B8 *dst, const gl::Color<uint8_t> *src)
+    {
+        dst->R = src->red;
+        dst->G = src->green;
+        dst->B = src->blue;
+        dst->A = src->alpha;
+    }
+};
+
+template <>
+struct UNorm8Channels<R8G8B8A8>
+{
+    static const bool supported = true;
+
+    static void read(gl::Color<uint8_t> *dst, const R8G8B8A8 *src)
+    {
+        dst->red   = src->R;
+        dst->green = src->G;
+        dst->blue  = src->B;
+        dst->alpha = src->A;
+    }
+
+    static void write(R8G8B8A8 *dst, const gl::Color<uint8_t> *src)
+    {
+        dst->R = src->red;
+        dst->G = src->green;
+        dst->B = src->blue;
+        dst->A = src->alpha;
+    }
+};
+
+template <>
+struct UNorm8Channels<B8G8R8A8>
+{
+    static const bool supported = true;
+
+    static void read(gl::Color<uint8_t> *dst, const B8G8R8A8 *src)
+    {
+        dst->red   = src->R;
+        dst->green = src->G;
+        dst->blue  = src->B;
+        dst->alpha = src->A;
+    }
+
+    static void write(B8G8R8A8 *dst, const gl::Color<uint8_t> *src)
+    {
+        dst->R = src->red;
+        dst->G = src->green;
+        dst->B = src->blue;
+        dst->A = src->alpha;
+    }
+};
+
+template <>
+struct UNorm8Channels<B8G8R8X8>
+{
+    static const bool supported = true;
+
+    static void read(gl::Color<uint8_t> *dst, const B8G8R8X8 *src)
+    {
+        dst->red   = src->R;
+        dst->green = src->G;
+        dst->blue  = src->B;
+        dst->alpha = 255;
+    }
+
+    static void write(B8G8R8X8 *dst, const gl::Color<uint8_t> *src)
+    {
+        dst->R = src->red;
+        dst->G = src->green;
+        dst->B = src->blue;
+        dst->X = 255;
+    }
+};
+
+template <typename sourceType, typename destType, typename colorDataType, bool unorm8>
+struct ColorRowCopier
+{
+    static void copy(size_t count, const uint8_t *source, uint8_t *dest)
+    {
+        const sourceType *sourcePixels = reinterpret_cast<const sourceType*>(source);
+        destType *destPixels = reinterpret_cast<destType*>(dest);
+        for (size_t i = 0; i < count; i++)
+        {
+            gl::Color<colorDataType> color;
+            sourceType::readColor(&color, &sourcePixels[i]);
+            destType::writeColor(&destPixels[i], &color);
+        }
+    }
+};
+
+template <typename sourceType, typename destType>
+struct ColorRowCopier<sourceType, destType, GLfloat, true>
+{
+    static void copy(size_t count, const uint8_t *source, uint8_t *dest)
+    {
+        const sourceType *sourcePixels = reinterpret_cast<const sourceType*>(source);
+        destType *destPixels = reinterpret_cast<destType*>(dest);
+        for (size_t i = 0; i < count; i++)
+        {
+            gl::Color<uint8_t> color;
+            UNorm8Channels<sourceType>::read(&color, &sourcePixels[i]);
+            UNorm8Channels<destType>::write(&destPixels[i], &color);
+        }
+    }
+};
+
+}
+
+template <typename sourceType, typename destType, typename colorDataType>
+inline void CopyColorRow(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    const bool unorm8 = priv::UNorm8Channels<sourceType>::supported && priv::UNorm8Channels<destType>::supported;
+    priv::ColorRowCopier<sourceType, destType, colorDataType, unorm8>::copy(count, source, dest);
+}
+
 }
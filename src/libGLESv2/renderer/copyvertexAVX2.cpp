@@ -0,0 +1,294 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// copyvertexAVX2.cpp: Vertex conversions to floats using 256-bit
+// instructions, two to eight vertices at a time. Conversions to three floats
+// and to 16-bit integers don't fill a 256-bit vector and use the SSE2
+// versions.
+
+#include "libGLESv2/renderer/copyvertexSIMD.h"
+#include "libGLESv2/renderer/copyvertex.h"
+
+#if defined(ANGLE_CPU_X86)
+#   include <immintrin.h>
+#endif
+
+#include <string.h>
+
+namespace rx
+{
+
+#if defined(ANGLE_CPU_X86)
+
+namespace
+{
+
+inline uint32_t Read32(const uint8_t *source)
+{
+    uint32_t value;
+    memcpy(&value, source, sizeof(value));
+    return value;
+}
+
+// Loading 16 bytes |n| bytes before the middle keeps the first |n| bytes of
+// a vector.
+const uint8_t kByteMasks[32] =
+{
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+template <size_t Bytes>
+struct AttributeReadBytes
+{
+    static const size_t value = (Bytes <= 4) ? 4 : ((Bytes <= 8) ? 8 : 16);
+};
+
+template <size_t Bytes>
+inline ANGLE_TARGET_AVX2 __m128i LoadAttribute(const uint8_t *source)
+{
+    __m128i value;
+    switch (AttributeReadBytes<Bytes>::value)
+    {
+      case 4:  value = _mm_cvtsi32_si128(static_cast<int>(Read32(source)));          break;
+      case 8:  value = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(source));     break;
+      default: value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));     break;
+    }
+
+    if (Bytes == AttributeReadBytes<Bytes>::value)
+    {
+        return value;
+    }
+    return _mm_and_si128(value, _mm_loadu_si128(reinterpret_cast<const __m128i*>(kByteMasks + 16 - Bytes)));
+}
+
+inline ANGLE_TARGET_AVX2 __m256i Gather32(const uint8_t *source, size_t stride)
+{
+    return _mm256_setr_epi32(static_cast<int>(Read32(source)),              static_cast<int>(Read32(source + stride)),
+                             static_cast<int>(Read32(source + 2 * stride)), static_cast<int>(Read32(source + 3 * stride)),
+                             static_cast<int>(Read32(source + 4 * stride)), static_cast<int>(Read32(source + 5 * stride)),
+                             static_cast<int>(Read32(source + 6 * stride)), static_cast<int>(Read32(source + 7 * stride)));
+}
+
+inline ANGLE_TARGET_AVX2 __m256i Combine(__m128i low, __m128i high)
+{
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+}
+
+// The components of one vertex in 32-bit lanes, zero past the last one, and
+// their conversion to floats.
+template <size_t InputComponents, bool Normalized>
+struct UShortComponents
+{
+    static const size_t Bytes = InputComponents * sizeof(GLushort);
+
+    static ANGLE_TARGET_AVX2 __m128i Load(const uint8_t *source)
+    {
+        return _mm_unpacklo_epi16(LoadAttribute<Bytes>(source), _mm_setzero_si128());
+    }
+
+    static ANGLE_TARGET_AVX2 __m256 Convert(__m256i components)
+    {
+        __m256 value = _mm256_cvtepi32_ps(components);
+        return Normalized ? _mm256_div_ps(value, _mm256_set1_ps(static_cast<float>(std::numeric_limits<GLushort>::max()))) : value;
+    }
+};
+
+template <size_t InputComponents>
+struct FixedComponents
+{
+    static const size_t Bytes = InputComponents * sizeof(GLfixed);
+
+    static ANGLE_TARGET_AVX2 __m128i Load(const uint8_t *source)
+    {
+        return LoadAttribute<Bytes>(source);
+    }
+
+    static ANGLE_TARGET_AVX2 __m256 Convert(__m256i components)
+    {
+        return _mm256_mul_ps(_mm256_cvtepi32_ps(components), _mm256_set1_ps(1.0f / (1 << 16)));
+    }
+};
+
+// Converts two vertices per iteration for four output components, four for
+// two and eight for one, and returns how many it did.
+template <typename Components, size_t OutputComponents>
+ANGLE_TARGET_AVX2 size_t CopyVectorVerticesTo32F(const uint8_t *input, size_t stride, size_t count, uint8_t *output)
+{
+    const size_t groupSize = 8 / OutputComponents;
+    size_t vectorCount = priv::CountVectorVertices(count, stride, Components::Bytes,
+                                                   AttributeReadBytes<Components::Bytes>::value);
+    vectorCount -= vectorCount % groupSize;
+
+    float *dest = reinterpret_cast<float*>(output);
+    for (size_t i = 0; i < vectorCount; i += groupSize)
+    {
+        const uint8_t *source = input + i * stride;
+        __m256i components;
+        switch (groupSize)
+        {
+          case 2:
+            components = Combine(Components::Load(source), Components::Load(source + stride));
+            break;
+          case 4:
+            components = Combine(_mm_unpacklo_epi64(Components::Load(source), Components::Load(source + stride)),
+                                 _mm_unpacklo_epi64(Components::Load(source + 2 * stride), Components::Load(source + 3 * stride)));
+            break;
+          default:
+            components = Gather32(source, stride);
+            break;
+        }
+
+        _mm256_storeu_ps(dest + i * OutputComponents, Components::Convert(components));
+    }
+
+    return vectorCount;
+}
+
+template <size_t InputComponents, size_t OutputComponents, bool Normalized>
+ANGLE_TARGET_AVX2 void CopyUShortTo32F(const uint8_t *input, size_t stride, size_t count, uint8_t *output)
+{
+    size_t vectorCount = CopyVectorVerticesTo32F<UShortComponents<InputComponents, Normalized>, OutputComponents>(input, stride, count, output);
+    CopyTo32FVertexData<GLushort, InputComponents, OutputComponents, Normalized>(input + vectorCount * stride, stride, count - vectorCount,
+                                                                                 output + vectorCount * OutputComponents * sizeof(float));
+}
+
+template <size_t InputComponents, size_t OutputComponents>
+ANGLE_TARGET_AVX2 void CopyFixedTo32F(const uint8_t *input, size_t stride, size_t count, uint8_t *output)
+{
+    size_t vectorCount = CopyVectorVerticesTo32F<FixedComponents<InputComponents>, OutputComponents>(input, stride, count, output);
+    Copy32FixedTo32FVertexData<InputComponents, OutputComponents>(input + vectorCount * stride, stride, count - vectorCount,
+                                                                  output + vectorCount * OutputComponents * sizeof(float));
+}
+
+// Eight vertices per iteration, unpacked into a vector per component and
+// transposed into vertices.
+template <bool IsSigned, bool Normalized>
+ANGLE_TARGET_AVX2 void CopyXYZ10W2ToXYZW32F(const uint8_t *input, size_t stride, size_t count, uint8_t *output)
+{
+    size_t vectorCount = priv::CountVectorVertices(count, stride, sizeof(GLuint), sizeof(GLuint));
+    vectorCount -= vectorCount % 8;
+
+    float *dest = reinterpret_cast<float*>(output);
+    for (size_t i = 0; i < vectorCount; i += 8)
+    {
+        __m256i packed = Gather32(input + i * stride, stride);
+
+        __m256i red, green, blue, alpha;
+        if (IsSigned)
+        {
+            red = _mm256_srai_epi32(_mm256_slli_epi32(packed, 22), 22);
+            green = _mm256_srai_epi32(_mm256_slli_epi32(packed, 12), 22);
+            blue = _mm256_srai_epi32(_mm256_slli_epi32(packed, 2), 22);
+            alpha = _mm256_srai_epi32(packed, 30);
+        }
+        else
+        {
+            const __m256i rgbMask = _mm256_set1_epi32(0x3FF);
+            red = _mm256_and_si256(packed, rgbMask);
+            green = _mm256_and_si256(_mm256_srli_epi32(packed, 10), rgbMask);
+            blue = _mm256_and_si256(_mm256_srli_epi32(packed, 20), rgbMask);
+            alpha = _mm256_srli_epi32(packed, 30);
+        }
+
+        __m256 components[4] =
+        {
+            _mm256_cvtepi32_ps(red),
+            _mm256_cvtepi32_ps(green),
+            _mm256_cvtepi32_ps(blue),
+            _mm256_cvtepi32_ps(alpha),
+        };
+
+        if (Normalized && IsSigned)
+        {
+            const __m256 minValue = _mm256_set1_ps(-511.0f);
+            const __m256 halfRange = _mm256_set1_ps(511.0f);
+            const __m256 one = _mm256_set1_ps(1.0f);
+            for (size_t component = 0; component < 3; component++)
+            {
+                __m256 clamped = _mm256_max_ps(components[component], minValue);
+                components[component] = _mm256_sub_ps(_mm256_div_ps(_mm256_sub_ps(clamped, minValue), halfRange), one);
+            }
+            components[3] = _mm256_max_ps(components[3], _mm256_set1_ps(-1.0f));
+        }
+        else if (Normalized)
+        {
+            const __m256 rgbMax = _mm256_set1_ps(1023.0f);
+            for (size_t component = 0; component < 3; component++)
+            {
+                components[component] = _mm256_div_ps(components[component], rgbMax);
+            }
+            components[3] = _mm256_div_ps(components[3], _mm256_set1_ps(3.0f));
+        }
+
+        // Transposed in each 128-bit half, giving vertices 0 and 4, 1 and 5,
+        // and so on, then regrouped in order.
+        __m256 redGreenLow = _mm256_unpacklo_ps(components[0], components[1]);
+        __m256 blueAlphaLow = _mm256_unpacklo_ps(components[2], components[3]);
+        __m256 redGreenHigh = _mm256_unpackhi_ps(components[0], components[1]);
+        __m256 blueAlphaHigh = _mm256_unpackhi_ps(components[2], components[3]);
+        __m256 vertices04 = _mm256_shuffle_ps(redGreenLow, blueAlphaLow, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 vertices15 = _mm256_shuffle_ps(redGreenLow, blueAlphaLow, _MM_SHUFFLE(3, 2, 3, 2));
+        __m256 vertices26 = _mm256_shuffle_ps(redGreenHigh, blueAlphaHigh, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 vertices37 = _mm256_shuffle_ps(redGreenHigh, blueAlphaHigh, _MM_SHUFFLE(3, 2, 3, 2));
+
+        float *vertexDest = dest + i * 4;
+        _mm256_storeu_ps(vertexDest,      _mm256_permute2f128_ps(vertices04, vertices15, 0x20));
+        _mm256_storeu_ps(vertexDest + 8,  _mm256_permute2f128_ps(vertices26, vertices37, 0x20));
+        _mm256_storeu_ps(vertexDest + 16, _mm256_permute2f128_ps(vertices04, vertices15, 0x31));
+        _mm256_storeu_ps(vertexDest + 24, _mm256_permute2f128_ps(vertices26, vertices37, 0x31));
+    }
+
+    CopyXYZ10W2ToXYZW32FVertexData<IsSigned, Normalized, true>(input + vectorCount * stride, stride, count - vectorCount,
+                                                               output + vectorCount * 4 * sizeof(float));
+}
+
+const VertexCopyFunction kVertexCopyFunctionsAVX2[VERTEX_COPY_KERNEL_COUNT] =
+{
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    CopyUShortTo32F<1, 2, false>,
+    CopyUShortTo32F<2, 2, false>,
+    NULL,
+    CopyUShortTo32F<4, 4, false>,
+    CopyUShortTo32F<1, 2, true>,
+    CopyUShortTo32F<2, 2, true>,
+    NULL,
+    CopyUShortTo32F<4, 4, true>,
+    CopyFixedTo32F<1, 1>,
+    CopyFixedTo32F<1, 2>,
+    CopyFixedTo32F<2, 2>,
+    NULL,
+    CopyFixedTo32F<4, 4>,
+    CopyXYZ10W2ToXYZW32F<false, false>,
+    CopyXYZ10W2ToXYZW32F<false, true>,
+    CopyXYZ10W2ToXYZW32F<true, false>,
+    CopyXYZ10W2ToXYZW32F<true, true>,
+};
+
+}
+
+const VertexCopyFunction *GetVertexCopyFunctionsAVX2()
+{
+    return kVertexCopyFunctionsAVX2;
+}
+
+#else
+
+const VertexCopyFunction *GetVertexCopyFunctionsAVX2()
+{
+    return NULL;
+}
+
+#endif
+
+}
@@ -0,0 +1,125 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// copyvertexSIMD.cpp: Runtime selection of the vectorized vertex conversions.
+
+#include "libGLESv2/renderer/copyvertexSIMD.h"
+#include "libGLESv2/renderer/copyvertex.h"
+
+#include "common/debug.h"
+
+namespace rx
+{
+
+namespace
+{
+
+const VertexCopyKernelInfo kVertexCopyKernelInfo[VERTEX_COPY_KERNEL_COUNT] =
+{
+    { "8SintTo16Sint_1_2",   1,  4 },
+    { "8SintTo16Sint_2_2",   2,  4 },
+    { "8SintTo16Sint_3_4",   3,  8 },
+    { "8SintTo16Sint_4_4",   4,  8 },
+    { "8SnormTo16Snorm_1_2", 1,  4 },
+    { "8SnormTo16Snorm_2_2", 2,  4 },
+    { "8SnormTo16Snorm_3_4", 3,  8 },
+    { "8SnormTo16Snorm_4_4", 4,  8 },
+    { "16UintTo32F_1_2",     2,  8 },
+    { "16UintTo32F_2_2",     4,  8 },
+    { "16UintTo32F_3_3",     6,  12 },
+    { "16UintTo32F_4_4",     8,  16 },
+    { "16UnormTo32F_1_2",    2,  8 },
+    { "16UnormTo32F_2_2",    4,  8 },
+    { "16UnormTo32F_3_3",    6,  12 },
+    { "16UnormTo32F_4_4",    8,  16 },
+    { "32FixedTo32F_1_1",    4,  4 },
+    { "32FixedTo32F_1_2",    4,  8 },
+    { "32FixedTo32F_2_2",    8,  8 },
+    { "32FixedTo32F_3_3",    12, 12 },
+    { "32FixedTo32F_4_4",    16, 16 },
+    { "XYZ10W2UintTo32F",    4,  16 },
+    { "XYZ10W2UnormTo32F",   4,  16 },
+    { "XYZ10W2SintTo32F",    4,  16 },
+    { "XYZ10W2SnormTo32F",   4,  16 },
+};
+
+const VertexCopyFunction kVertexCopyFunctionsScalar[VERTEX_COPY_KERNEL_COUNT] =
+{
+    Copy8SintTo16SintVertexData<1, 2>,
+    Copy8SintTo16SintVertexData<2, 2>,
+    Copy8SintTo16SintVertexData<3, 4>,
+    Copy8SintTo16SintVertexData<4, 4>,
+    Copy8SnormTo16SnormVertexData<1, 2>,
+    Copy8SnormTo16SnormVertexData<2, 2>,
+    Copy8SnormTo16SnormVertexData<3, 4>,
+    Copy8SnormTo16SnormVertexData<4, 4>,
+    CopyTo32FVertexData<GLushort, 1, 2, false>,
+    CopyTo32FVertexData<GLushort, 2, 2, false>,
+    CopyTo32FVertexData<GLushort, 3, 3, false>,
+    CopyTo32FVertexData<GLushort, 4, 4, false>,
+    CopyTo32FVertexData<GLushort, 1, 2, true>,
+    CopyTo32FVertexData<GLushort, 2, 2, true>,
+    CopyTo32FVertexData<GLushort, 3, 3, true>,
+    CopyTo32FVertexData<GLushort, 4, 4, true>,
+    Copy32FixedTo32FVertexData<1, 1>,
+    Copy32FixedTo32FVertexData<1, 2>,
+    Copy32FixedTo32FVertexData<2, 2>,
+    Copy32FixedTo32FVertexData<3, 3>,
+    Copy32FixedTo32FVertexData<4, 4>,
+    CopyXYZ10W2ToXYZW32FVertexData<false, false, true>,
+    CopyXYZ10W2ToXYZW32FVertexData<false, true, true>,
+    CopyXYZ10W2ToXYZW32FVertexData<true, false, true>,
+    CopyXYZ10W2ToXYZW32FVertexData<true, true, true>,
+};
+
+const VertexCopyFunction *GetVertexCopyFunctionTable(gl::SIMDLevel level)
+{
+    switch (level)
+    {
+      case gl::SIMD_SCALAR: return kVertexCopyFunctionsScalar;
+      case gl::SIMD_SSE2:   return GetVertexCopyFunctionsSSE2();
+      // Widening and converting needs no shuffles or SSE4.1 instructions.
+      case gl::SIMD_SSSE3:  return NULL;
+      case gl::SIMD_SSE41:  return NULL;
+      case gl::SIMD_AVX2:   return GetVertexCopyFunctionsAVX2();
+      default: UNREACHABLE(); return NULL;
+    }
+}
+
+}
+
+const VertexCopyKernelInfo &GetVertexCopyKernelInfo(VertexCopyKernel kernel)
+{
+    ASSERT(kernel < VERTEX_COPY_KERNEL_COUNT);
+    return kVertexCopyKernelInfo[kernel];
+}
+
+VertexCopyFunction GetVertexCopyFunction(VertexCopyKernel kernel, gl::SIMDLevel level)
+{
+    ASSERT(kernel < VERTEX_COPY_KERNEL_COUNT);
+    const VertexCopyFunction *function = gl::GetSIMDVersion(GetVertexCopyFunctionTable, kernel, level);
+    return function ? *function : NULL;
+}
+
+VertexCopyFunction ResolveVertexCopyFunction(VertexCopyKernel kernel, gl::SIMDLevel maxLevel)
+{
+    ASSERT(kernel < VERTEX_COPY_KERNEL_COUNT);
+    return gl::ResolveSIMDVersion(GetVertexCopyFunctionTable, kernel, maxLevel);
+}
+
+VertexCopyFunction GetBestVertexCopyFunction(VertexCopyKernel kernel)
+{
+    static const gl::BestSIMDVersions<VertexCopyFunction, VERTEX_COPY_KERNEL_COUNT> best(GetVertexCopyFunctionTable);
+    return best[kernel];
+}
+
+void InitializeVertexCopyFunctions()
+{
+    // Looking up any function builds the whole table
+    GetBestVertexCopyFunction(VERTEX_COPY_8SINT_1_TO_16SINT_2);
+}
+
+}
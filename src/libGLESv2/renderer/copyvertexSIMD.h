@@ -0,0 +1,118 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// copyvertexSIMD.h: Runtime selection of vectorized versions of the vertex
+// conversions in copyvertex.h that can't be done by the GPU. Every version
+// writes exactly what the template it replaces writes.
+
+#ifndef LIBGLESV2_RENDERER_COPYVERTEXSIMD_H_
+#define LIBGLESV2_RENDERER_COPYVERTEXSIMD_H_
+
+#include "libGLESv2/formatutils.h"
+#include "common/simddispatch.h"
+
+#include <algorithm>
+
+namespace rx
+{
+
+// Named after the copyvertex.h templates they replace, with their input and
+// output component counts.
+enum VertexCopyKernel
+{
+    // Copy8SintTo16SintVertexData
+    VERTEX_COPY_8SINT_1_TO_16SINT_2,
+    VERTEX_COPY_8SINT_2_TO_16SINT_2,
+    VERTEX_COPY_8SINT_3_TO_16SINT_4,
+    VERTEX_COPY_8SINT_4_TO_16SINT_4,
+
+    // Copy8SnormTo16SnormVertexData
+    VERTEX_COPY_8SNORM_1_TO_16SNORM_2,
+    VERTEX_COPY_8SNORM_2_TO_16SNORM_2,
+    VERTEX_COPY_8SNORM_3_TO_16SNORM_4,
+    VERTEX_COPY_8SNORM_4_TO_16SNORM_4,
+
+    // CopyTo32FVertexData<GLushort>
+    VERTEX_COPY_16UINT_1_TO_32F_2,
+    VERTEX_COPY_16UINT_2_TO_32F_2,
+    VERTEX_COPY_16UINT_3_TO_32F_3,
+    VERTEX_COPY_16UINT_4_TO_32F_4,
+    VERTEX_COPY_16UNORM_1_TO_32F_2,
+    VERTEX_COPY_16UNORM_2_TO_32F_2,
+    VERTEX_COPY_16UNORM_3_TO_32F_3,
+    VERTEX_COPY_16UNORM_4_TO_32F_4,
+
+    // Copy32FixedTo32FVertexData
+    VERTEX_COPY_32FIXED_1_TO_32F_1,
+    VERTEX_COPY_32FIXED_1_TO_32F_2,
+    VERTEX_COPY_32FIXED_2_TO_32F_2,
+    VERTEX_COPY_32FIXED_3_TO_32F_3,
+    VERTEX_COPY_32FIXED_4_TO_32F_4,
+
+    // CopyXYZ10W2ToXYZW32FVertexData<isSigned, normalized, true>
+    VERTEX_COPY_XYZ10W2_UINT_TO_32F,
+    VERTEX_COPY_XYZ10W2_UNORM_TO_32F,
+    VERTEX_COPY_XYZ10W2_SINT_TO_32F,
+    VERTEX_COPY_XYZ10W2_SNORM_TO_32F,
+
+    VERTEX_COPY_KERNEL_COUNT
+};
+
+struct VertexCopyKernelInfo
+{
+    const char *name;
+    size_t inputBytes;
+    size_t outputBytes;
+};
+
+const VertexCopyKernelInfo &GetVertexCopyKernelInfo(VertexCopyKernel kernel);
+
+// Dispatch of the conversions through common/simddispatch.h. Every kernel has
+// a scalar version.
+VertexCopyFunction GetVertexCopyFunction(VertexCopyKernel kernel, gl::SIMDLevel level);
+VertexCopyFunction ResolveVertexCopyFunction(VertexCopyKernel kernel, gl::SIMDLevel maxLevel);
+VertexCopyFunction GetBestVertexCopyFunction(VertexCopyKernel kernel);
+
+// Builds the table of GetBestVertexCopyFunction ahead of its first use, which
+// must not race with another thread.
+void InitializeVertexCopyFunctions();
+
+// Per-level tables, indexed by VertexCopyKernel, with NULL for the kernels
+// that have no version at that level. NULL on other architectures.
+const VertexCopyFunction *GetVertexCopyFunctionsSSE2();
+const VertexCopyFunction *GetVertexCopyFunctionsAVX2();
+
+namespace priv
+{
+
+// The number of vertices, short of the last one, that can be read
+// |readBytes| at a time without reading past the |attributeBytes| of the last
+// vertex. The vectorized loops leave the last vertex to the templates, which
+// also lets them write a little past a vertex into the next one.
+inline size_t CountVectorVertices(size_t count, size_t stride, size_t attributeBytes, size_t readBytes)
+{
+    if (count < 2)
+    {
+        return 0;
+    }
+    if (stride == 0)
+    {
+        return (readBytes <= attributeBytes) ? count - 1 : 0;
+    }
+
+    size_t end = (count - 1) * stride + attributeBytes;
+    if (end < readBytes)
+    {
+        return 0;
+    }
+    return std::min(count - 1, (end - readBytes) / stride + 1);
+}
+
+}
+
+}
+
+#endif // LIBGLESV2_RENDERER_COPYVERTEXSIMD_H_
@@ -0,0 +1,354 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// copyvertexSSE2.cpp: Vertex conversions using 128-bit instructions. The
+// components of strided vertices are gathered into vectors of one or more
+// vertices, converted like the copyvertex.h templates do, and written
+// contiguously.
+
+#include "libGLESv2/renderer/copyvertexSIMD.h"
+#include "libGLESv2/renderer/copyvertex.h"
+
+#if defined(ANGLE_CPU_X86)
+#   include <emmintrin.h>
+#endif
+
+#include <string.h>
+
+namespace rx
+{
+
+#if defined(ANGLE_CPU_X86)
+
+namespace
+{
+
+inline uint16_t Read16(const uint8_t *source)
+{
+    uint16_t value;
+    memcpy(&value, source, sizeof(value));
+    return value;
+}
+
+inline uint32_t Read32(const uint8_t *source)
+{
+    uint32_t value;
+    memcpy(&value, source, sizeof(value));
+    return value;
+}
+
+// Loading 16 bytes |n| bytes before the middle keeps the first |n| bytes of
+// a vector.
+const uint8_t kByteMasks[32] =
+{
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// Attributes are read 4, 8 or 16 bytes at a time.
+template <size_t Bytes>
+struct AttributeReadBytes
+{
+    static const size_t value = (Bytes <= 4) ? 4 : ((Bytes <= 8) ? 8 : 16);
+};
+
+// The |Bytes| of an attribute in the low bytes of a vector, zero above.
+template <size_t Bytes>
+inline ANGLE_TARGET_SSE2 __m128i LoadAttribute(const uint8_t *source)
+{
+    __m128i value;
+    switch (AttributeReadBytes<Bytes>::value)
+    {
+      case 4:  value = _mm_cvtsi32_si128(static_cast<int>(Read32(source)));          break;
+      case 8:  value = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(source));     break;
+      default: value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));     break;
+    }
+
+    if (Bytes == AttributeReadBytes<Bytes>::value)
+    {
+        return value;
+    }
+    return _mm_and_si128(value, _mm_loadu_si128(reinterpret_cast<const __m128i*>(kByteMasks + 16 - Bytes)));
+}
+
+inline ANGLE_TARGET_SSE2 __m128i Gather16(const uint8_t *source, size_t stride)
+{
+    return _mm_setr_epi16(static_cast<short>(Read16(source)),              static_cast<short>(Read16(source + stride)),
+                          static_cast<short>(Read16(source + 2 * stride)), static_cast<short>(Read16(source + 3 * stride)),
+                          static_cast<short>(Read16(source + 4 * stride)), static_cast<short>(Read16(source + 5 * stride)),
+                          static_cast<short>(Read16(source + 6 * stride)), static_cast<short>(Read16(source + 7 * stride)));
+}
+
+inline ANGLE_TARGET_SSE2 __m128i Gather32(const uint8_t *source, size_t stride)
+{
+    return _mm_setr_epi32(static_cast<int>(Read32(source)),              static_cast<int>(Read32(source + stride)),
+                          static_cast<int>(Read32(source + 2 * stride)), static_cast<int>(Read32(source + 3 * stride)));
+}
+
+// Copy8SnormTo16SnormVertexData: x << 8, with the low bits of positive
+// values filled from their top bits so that 127 becomes INT16_MAX.
+inline ANGLE_TARGET_SSE2 __m128i Snorm8To16(__m128i value)
+{
+    __m128i positive = _mm_cmpgt_epi16(value, _mm_setzero_si128());
+    __m128i lowBits = _mm_or_si128(_mm_slli_epi16(value, 1),
+                                   _mm_srli_epi16(_mm_and_si128(value, _mm_set1_epi16(0x40)), 6));
+    return _mm_or_si128(_mm_slli_epi16(value, 8), _mm_and_si128(positive, lowBits));
+}
+
+// Eight vertices of two output components, or four of four, per iteration.
+template <size_t InputComponents, size_t OutputComponents, bool Normalized>
+ANGLE_TARGET_SSE2 void Copy8To16(const uint8_t *input, size_t stride, size_t count, uint8_t *output)
+{
+    const bool twoComponents = (OutputComponents == 2);
+    const size_t groupSize = twoComponents ? 8 : 4;
+    size_t vectorCount = priv::CountVectorVertices(count, stride, InputComponents, twoComponents ? 2 : 4);
+    vectorCount -= vectorCount % groupSize;
+
+    const __m128i inputMask = twoComponents ? _mm_set1_epi16(InputComponents == 1 ? 0x00FF : 0xFFFF)
+                                            : _mm_set1_epi32(InputComponents == 3 ? 0x00FFFFFF : -1);
+    const short alphaValue = (InputComponents < OutputComponents && !twoComponents) ? (Normalized ? INT16_MAX : 1) : 0;
+    const __m128i alpha = _mm_set_epi16(alphaValue, 0, 0, 0, alphaValue, 0, 0, 0);
+
+    GLshort *dest = reinterpret_cast<GLshort*>(output);
+    for (size_t i = 0; i < vectorCount; i += groupSize)
+    {
+        const uint8_t *source = input + i * stride;
+        __m128i bytes = _mm_and_si128(twoComponents ? Gather16(source, stride) : Gather32(source, stride), inputMask);
+
+        // Sign extended by shifting down from the top byte of each lane
+        __m128i low = _mm_srai_epi16(_mm_unpacklo_epi8(bytes, bytes), 8);
+        __m128i high = _mm_srai_epi16(_mm_unpackhi_epi8(bytes, bytes), 8);
+        if (Normalized)
+        {
+            low = Snorm8To16(low);
+            high = Snorm8To16(high);
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i * OutputComponents), _mm_or_si128(low, alpha));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i * OutputComponents + 8), _mm_or_si128(high, alpha));
+    }
+
+    const size_t outputBytes = OutputComponents * sizeof(GLshort);
+    if (Normalized)
+    {
+        Copy8SnormTo16SnormVertexData<InputComponents, OutputComponents>(input + vectorCount * stride, stride, count - vectorCount,
+                                                                          output + vectorCount * outputBytes);
+    }
+    else
+    {
+        Copy8SintTo16SintVertexData<InputComponents, OutputComponents>(input + vectorCount * stride, stride, count - vectorCount,
+                                                                        output + vectorCount * outputBytes);
+    }
+}
+
+// The components of one vertex in 32-bit lanes, zero past the last one, and
+// their conversion to floats.
+template <size_t InputComponents, bool Normalized>
+struct UShortComponents
+{
+    static const size_t Bytes = InputComponents * sizeof(GLushort);
+
+    static ANGLE_TARGET_SSE2 __m128i Load(const uint8_t *source)
+    {
+        return _mm_unpacklo_epi16(LoadAttribute<Bytes>(source), _mm_setzero_si128());
+    }
+
+    static ANGLE_TARGET_SSE2 __m128 Convert(__m128i components)
+    {
+        __m128 value = _mm_cvtepi32_ps(components);
+        return Normalized ? _mm_div_ps(value, _mm_set1_ps(static_cast<float>(std::numeric_limits<GLushort>::max()))) : value;
+    }
+};
+
+template <size_t InputComponents>
+struct FixedComponents
+{
+    static const size_t Bytes = InputComponents * sizeof(GLfixed);
+
+    static ANGLE_TARGET_SSE2 __m128i Load(const uint8_t *source)
+    {
+        return LoadAttribute<Bytes>(source);
+    }
+
+    static ANGLE_TARGET_SSE2 __m128 Convert(__m128i components)
+    {
+        return _mm_mul_ps(_mm_cvtepi32_ps(components), _mm_set1_ps(1.0f / (1 << 16)));
+    }
+};
+
+// Converts one vertex per iteration for three and four output components,
+// two for two and four for one, and returns how many it did.
+template <typename Components, size_t OutputComponents>
+ANGLE_TARGET_SSE2 size_t CopyVectorVerticesTo32F(const uint8_t *input, size_t stride, size_t count, uint8_t *output)
+{
+    const size_t groupSize = (OutputComponents >= 3) ? 1 : 4 / OutputComponents;
+    size_t vectorCount = priv::CountVectorVertices(count, stride, Components::Bytes,
+                                                   AttributeReadBytes<Components::Bytes>::value);
+    vectorCount -= vectorCount % groupSize;
+
+    float *dest = reinterpret_cast<float*>(output);
+    for (size_t i = 0; i < vectorCount; i += groupSize)
+    {
+        const uint8_t *source = input + i * stride;
+        __m128i components;
+        switch (groupSize)
+        {
+          case 1:
+            components = Components::Load(source);
+            break;
+          case 2:
+            components = _mm_unpacklo_epi64(Components::Load(source), Components::Load(source + stride));
+            break;
+          default:
+            components = _mm_unpacklo_epi64(_mm_unpacklo_epi32(Components::Load(source), Components::Load(source + stride)),
+                                            _mm_unpacklo_epi32(Components::Load(source + 2 * stride),
+                                                               Components::Load(source + 3 * stride)));
+            break;
+        }
+
+        // Three components also write the first one of the next vertex,
+        // which is written after.
+        _mm_storeu_ps(dest + i * OutputComponents, Components::Convert(components));
+    }
+
+    return vectorCount;
+}
+
+template <size_t InputComponents, size_t OutputComponents, bool Normalized>
+ANGLE_TARGET_SSE2 void CopyUShortTo32F(const uint8_t *input, size_t stride, size_t count, uint8_t *output)
+{
+    size_t vectorCount = CopyVectorVerticesTo32F<UShortComponents<InputComponents, Normalized>, OutputComponents>(input, stride, count, output);
+    CopyTo32FVertexData<GLushort, InputComponents, OutputComponents, Normalized>(input + vectorCount * stride, stride, count - vectorCount,
+                                                                                 output + vectorCount * OutputComponents * sizeof(float));
+}
+
+template <size_t InputComponents, size_t OutputComponents>
+ANGLE_TARGET_SSE2 void CopyFixedTo32F(const uint8_t *input, size_t stride, size_t count, uint8_t *output)
+{
+    size_t vectorCount = CopyVectorVerticesTo32F<FixedComponents<InputComponents>, OutputComponents>(input, stride, count, output);
+    Copy32FixedTo32FVertexData<InputComponents, OutputComponents>(input + vectorCount * stride, stride, count - vectorCount,
+                                                                  output + vectorCount * OutputComponents * sizeof(float));
+}
+
+// Four vertices per iteration, unpacked into a vector per component and
+// transposed into vertices.
+template <bool IsSigned, bool Normalized>
+ANGLE_TARGET_SSE2 void CopyXYZ10W2ToXYZW32F(const uint8_t *input, size_t stride, size_t count, uint8_t *output)
+{
+    size_t vectorCount = priv::CountVectorVertices(count, stride, sizeof(GLuint), sizeof(GLuint));
+    vectorCount -= vectorCount % 4;
+
+    float *dest = reinterpret_cast<float*>(output);
+    for (size_t i = 0; i < vectorCount; i += 4)
+    {
+        __m128i packed = Gather32(input + i * stride, stride);
+
+        __m128i red, green, blue, alpha;
+        if (IsSigned)
+        {
+            red = _mm_srai_epi32(_mm_slli_epi32(packed, 22), 22);
+            green = _mm_srai_epi32(_mm_slli_epi32(packed, 12), 22);
+            blue = _mm_srai_epi32(_mm_slli_epi32(packed, 2), 22);
+            alpha = _mm_srai_epi32(packed, 30);
+        }
+        else
+        {
+            const __m128i rgbMask = _mm_set1_epi32(0x3FF);
+            red = _mm_and_si128(packed, rgbMask);
+            green = _mm_and_si128(_mm_srli_epi32(packed, 10), rgbMask);
+            blue = _mm_and_si128(_mm_srli_epi32(packed, 20), rgbMask);
+            alpha = _mm_srli_epi32(packed, 30);
+        }
+
+        __m128 vertices[4] =
+        {
+            _mm_cvtepi32_ps(red),
+            _mm_cvtepi32_ps(green),
+            _mm_cvtepi32_ps(blue),
+            _mm_cvtepi32_ps(alpha),
+        };
+
+        if (Normalized && IsSigned)
+        {
+            // Clamped to -511, then ((value + 511) / 511) - 1 like CopyPackedRGB,
+            // which leaves the alpha values clamped to -1.
+            const __m128 minValue = _mm_set1_ps(-511.0f);
+            const __m128 halfRange = _mm_set1_ps(511.0f);
+            const __m128 one = _mm_set1_ps(1.0f);
+            for (size_t component = 0; component < 3; component++)
+            {
+                __m128 clamped = _mm_max_ps(vertices[component], minValue);
+                vertices[component] = _mm_sub_ps(_mm_div_ps(_mm_sub_ps(clamped, minValue), halfRange), one);
+            }
+            vertices[3] = _mm_max_ps(vertices[3], _mm_set1_ps(-1.0f));
+        }
+        else if (Normalized)
+        {
+            const __m128 rgbMax = _mm_set1_ps(1023.0f);
+            for (size_t component = 0; component < 3; component++)
+            {
+                vertices[component] = _mm_div_ps(vertices[component], rgbMax);
+            }
+            vertices[3] = _mm_div_ps(vertices[3], _mm_set1_ps(3.0f));
+        }
+
+        _MM_TRANSPOSE4_PS(vertices[0], vertices[1], vertices[2], vertices[3]);
+        for (size_t vertex = 0; vertex < 4; vertex++)
+        {
+            _mm_storeu_ps(dest + (i + vertex) * 4, vertices[vertex]);
+        }
+    }
+
+    CopyXYZ10W2ToXYZW32FVertexData<IsSigned, Normalized, true>(input + vectorCount * stride, stride, count - vectorCount,
+                                                               output + vectorCount * 4 * sizeof(float));
+}
+
+const VertexCopyFunction kVertexCopyFunctionsSSE2[VERTEX_COPY_KERNEL_COUNT] =
+{
+    Copy8To16<1, 2, false>,
+    Copy8To16<2, 2, false>,
+    Copy8To16<3, 4, false>,
+    Copy8To16<4, 4, false>,
+    Copy8To16<1, 2, true>,
+    Copy8To16<2, 2, true>,
+    Copy8To16<3, 4, true>,
+    Copy8To16<4, 4, true>,
+    CopyUShortTo32F<1, 2, false>,
+    CopyUShortTo32F<2, 2, false>,
+    CopyUShortTo32F<3, 3, false>,
+    CopyUShortTo32F<4, 4, false>,
+    CopyUShortTo32F<1, 2, true>,
+    CopyUShortTo32F<2, 2, true>,
+    CopyUShortTo32F<3, 3, true>,
+    CopyUShortTo32F<4, 4, true>,
+    CopyFixedTo32F<1, 1>,
+    CopyFixedTo32F<1, 2>,
+    CopyFixedTo32F<2, 2>,
+    CopyFixedTo32F<3, 3>,
+    CopyFixedTo32F<4, 4>,
+    CopyXYZ10W2ToXYZW32F<false, false>,
+    CopyXYZ10W2ToXYZW32F<false, true>,
+    CopyXYZ10W2ToXYZW32F<true, false>,
+    CopyXYZ10W2ToXYZW32F<true, true>,
+};
+
+}
+
+const VertexCopyFunction *GetVertexCopyFunctionsSSE2()
+{
+    return kVertexCopyFunctionsSSE2;
+}
+
+#else
+
+const VertexCopyFunction *GetVertexCopyFunctionsSSE2()
+{
+    return NULL;
+}
+
+#endif
+
+}
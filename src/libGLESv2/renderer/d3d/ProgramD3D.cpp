@@ -26,6 +26,46 @@ namespace rx
 namespace
 {
 
+// Uniforms and their locations are saved as one block of these records, followed by one block
+// with all of their names, so that loading checks the bounds of each block once.
+struct UniformRecord
+{
+    GLenum type;
+    GLenum precision;
+    uint32_t nameLength;
+    unsigned int arraySize;
+    int blockIndex;
+
+    int offset;
+    int arrayStride;
+    int matrixStride;
+    int isRowMajorMatrix;
+
+    unsigned int psRegisterIndex;
+    unsigned int vsRegisterIndex;
+    unsigned int registerCount;
+    unsigned int registerElement;
+};
+
+struct UniformLocationRecord
+{
+    uint32_t nameLength;
+    unsigned int element;
+    unsigned int index;
+};
+
+template <typename RecordT>
+bool NameLengthsMatch(const std::vector<RecordT> &records, const gl::BinaryStringView &names)
+{
+    uint64_t totalLength = 0;
+    for (size_t recordIndex = 0; recordIndex < records.size(); recordIndex++)
+    {
+        totalLength += records[recordIndex].nameLength;
+    }
+
+    return (totalLength == names.length);
+}
+
 GLenum GetTextureType(GLenum samplerType)
 {
     switch (samplerType)
@@ -162,6 +202,7 @@ ProgramD3D::ProgramD3D(Renderer *renderer)
       mUsedVertexSamplerRange(0),
       mUsedPixelSamplerRange(0),
       mDirtySamplerMapping(true),
+      mSamplerMappingSerial(0),
       mShaderVersion(100)
 {
     mDynamicHLSL = new DynamicHLSL(renderer);
@@ -268,6 +309,7 @@ void ProgramD3D::updateSamplerMapping()
     }
 
     mDirtySamplerMapping = false;
+    mSamplerMappingSerial++;
 
     // Retrieve sampler uniform values
     for (size_t uniformIndex = 0; uniformIndex < mUniforms.size(); uniformIndex++)
@@ -425,52 +467,56 @@ gl::LinkResult ProgramD3D::load(gl::InfoLog &infoLog, gl::BinaryInputStream *str
     stream->readInt(&mUsedVertexSamplerRange);
     stream->readInt(&mUsedPixelSamplerRange);
 
-    const unsigned int uniformCount = stream->readInt<unsigned int>();
-    if (stream->error())
+    std::vector<UniformRecord> uniformRecords;
+    gl::BinaryStringView uniformNames;
+    stream->readArray(&uniformRecords);
+    stream->readStringView(&uniformNames);
+    if (stream->error() || !NameLengthsMatch(uniformRecords, uniformNames))
     {
         infoLog.append("Invalid program binary.");
         return gl::LinkResult(false, gl::Error(GL_NO_ERROR));
     }
 
-    mUniforms.resize(uniformCount);
-    for (unsigned int uniformIndex = 0; uniformIndex < uniformCount; uniformIndex++)
+    mUniforms.resize(uniformRecords.size());
+    const char *uniformName = uniformNames.data;
+    for (size_t uniformIndex = 0; uniformIndex < uniformRecords.size(); uniformIndex++)
     {
-        GLenum type = stream->readInt<GLenum>();
-        GLenum precision = stream->readInt<GLenum>();
-        std::string name = stream->readString();
-        unsigned int arraySize = stream->readInt<unsigned int>();
-        int blockIndex = stream->readInt<int>();
-
-        int offset = stream->readInt<int>();
-        int arrayStride = stream->readInt<int>();
-        int matrixStride = stream->readInt<int>();
-        bool isRowMajorMatrix = stream->readBool();
+        const UniformRecord &record = uniformRecords[uniformIndex];
 
-        const sh::BlockMemberInfo blockInfo(offset, arrayStride, matrixStride, isRowMajorMatrix);
+        const sh::BlockMemberInfo blockInfo(record.offset, record.arrayStride, record.matrixStride, record.isRowMajorMatrix != 0);
+        const std::string name(uniformName, record.nameLength);
+        uniformName += record.nameLength;
 
-        gl::LinkedUniform *uniform = new gl::LinkedUniform(type, precision, name, arraySize, blockIndex, blockInfo);
+        gl::LinkedUniform *uniform = new gl::LinkedUniform(record.type, record.precision, name, record.arraySize, record.blockIndex, blockInfo);
 
-        stream->readInt(&uniform->psRegisterIndex);
-        stream->readInt(&uniform->vsRegisterIndex);
-        stream->readInt(&uniform->registerCount);
-        stream->readInt(&uniform->registerElement);
+        uniform->psRegisterIndex = record.psRegisterIndex;
+        uniform->vsRegisterIndex = record.vsRegisterIndex;
+        uniform->registerCount = record.registerCount;
+        uniform->registerElement = record.registerElement;
 
         mUniforms[uniformIndex] = uniform;
     }
 
-    const unsigned int uniformIndexCount = stream->readInt<unsigned int>();
-    if (stream->error())
+    std::vector<UniformLocationRecord> uniformLocationRecords;
+    gl::BinaryStringView uniformLocationNames;
+    stream->readArray(&uniformLocationRecords);
+    stream->readStringView(&uniformLocationNames);
+    if (stream->error() || !NameLengthsMatch(uniformLocationRecords, uniformLocationNames))
     {
         infoLog.append("Invalid program binary.");
         return gl::LinkResult(false, gl::Error(GL_NO_ERROR));
     }
 
-    mUniformIndex.resize(uniformIndexCount);
-    for (unsigned int uniformIndexIndex = 0; uniformIndexIndex < uniformIndexCount; uniformIndexIndex++)
+    mUniformIndex.resize(uniformLocationRecords.size());
+    const char *uniformLocationName = uniformLocationNames.data;
+    for (size_t uniformIndexIndex = 0; uniformIndexIndex < uniformLocationRecords.size(); uniformIndexIndex++)
     {
-        stream->readString(&mUniformIndex[uniformIndexIndex].name);
-        stream->readInt(&mUniformIndex[uniformIndexIndex].element);
-        stream->readInt(&mUniformIndex[uniformIndexIndex].index);
+        const UniformLocationRecord &record = uniformLocationRecords[uniformIndexIndex];
+
+        mUniformIndex[uniformIndexIndex].name.assign(uniformLocationName, record.nameLength);
+        mUniformIndex[uniformIndexIndex].element = record.element;
+        mUniformIndex[uniformIndexIndex].index = record.index;
+        uniformLocationName += record.nameLength;
     }
 
     unsigned int uniformBlockCount = stream->readInt<unsigned int>();
@@ -674,35 +720,47 @@ gl::Error ProgramD3D::save(gl::BinaryOutputStream *stream)
     stream->writeInt(mUsedVertexSamplerRange);
     stream->writeInt(mUsedPixelSamplerRange);
 
-    stream->writeInt(mUniforms.size());
+    std::vector<UniformRecord> uniformRecords(mUniforms.size());
+    std::string uniformNames;
     for (size_t uniformIndex = 0; uniformIndex < mUniforms.size(); ++uniformIndex)
     {
         const gl::LinkedUniform &uniform = *mUniforms[uniformIndex];
+        UniformRecord &record = uniformRecords[uniformIndex];
 
-        stream->writeInt(uniform.type);
-        stream->writeInt(uniform.precision);
-        stream->writeString(uniform.name);
-        stream->writeInt(uniform.arraySize);
-        stream->writeInt(uniform.blockIndex);
+        record.type = uniform.type;
+        record.precision = uniform.precision;
+        record.nameLength = static_cast<uint32_t>(uniform.name.length());
+        record.arraySize = uniform.arraySize;
+        record.blockIndex = uniform.blockIndex;
 
-        stream->writeInt(uniform.blockInfo.offset);
-        stream->writeInt(uniform.blockInfo.arrayStride);
-        stream->writeInt(uniform.blockInfo.matrixStride);
-        stream->writeInt(uniform.blockInfo.isRowMajorMatrix);
+        record.offset = uniform.blockInfo.offset;
+        record.arrayStride = uniform.blockInfo.arrayStride;
+        record.matrixStride = uniform.blockInfo.matrixStride;
+        record.isRowMajorMatrix = uniform.blockInfo.isRowMajorMatrix ? 1 : 0;
 
-        stream->writeInt(uniform.psRegisterIndex);
-        stream->writeInt(uniform.vsRegisterIndex);
-        stream->writeInt(uniform.registerCount);
-        stream->writeInt(uniform.registerElement);
+        record.psRegisterIndex = uniform.psRegisterIndex;
+        record.vsRegisterIndex = uniform.vsRegisterIndex;
+        record.registerCount = uniform.registerCount;
+        record.registerElement = uniform.registerElement;
+
+        uniformNames += uniform.name;
     }
+    stream->writeArray(uniformRecords);
+    stream->writeString(uniformNames);
 
-    stream->writeInt(mUniformIndex.size());
+    std::vector<UniformLocationRecord> uniformLocationRecords(mUniformIndex.size());
+    std::string uniformLocationNames;
     for (size_t i = 0; i < mUniformIndex.size(); ++i)
     {
-        stream->writeString(mUniformIndex[i].name);
-        stream->writeInt(mUniformIndex[i].element);
-        stream->writeInt(mUniformIndex[i].index);
+        UniformLocationRecord &record = uniformLocationRecords[i];
+        record.nameLength = static_cast<uint32_t>(mUniformIndex[i].name.length());
+        record.element = mUniformIndex[i].element;
+        record.index = mUniformIndex[i].index;
+
+        uniformLocationNames += mUniformIndex[i].name;
     }
+    stream->writeArray(uniformLocationRecords);
+    stream->writeString(uniformLocationNames);
 
     stream->writeInt(mUniformBlocks.size());
     for (size_t uniformBlockIndex = 0; uniformBlockIndex < mUniformBlocks.size(); ++uniformBlockIndex)
@@ -1734,7 +1792,7 @@ bool ProgramD3D::defineUniformBlock(gl::InfoLog &infoLog, const gl::Shader &shad
     const rx::ShaderD3D* shaderD3D = rx::ShaderD3D::makeShaderD3D(shader.getImplementation());
 
     // create uniform block entries if they do not exist
-    if (getUniformBlockIndex(interfaceBlock.name) == GL_INVALID_INDEX)
+    if (findUniformBlockIndex(interfaceBlock.name) == GL_INVALID_INDEX)
     {
         std::vector<unsigned int> blockUniformIndexes;
         const unsigned int blockIndex = mUniformBlocks.size();
@@ -1777,7 +1835,7 @@ bool ProgramD3D::defineUniformBlock(gl::InfoLog &infoLog, const gl::Shader &shad
     if (interfaceBlock.staticUse)
     {
         // Assign registers to the uniform blocks
-        const GLuint blockIndex = getUniformBlockIndex(interfaceBlock.name);
+        const GLuint blockIndex = findUniformBlockIndex(interfaceBlock.name);
         const unsigned int elementCount = std::max(1u, interfaceBlock.arraySize);
         ASSERT(blockIndex != GL_INVALID_INDEX);
         ASSERT(blockIndex + elementCount <= mUniformBlocks.size());
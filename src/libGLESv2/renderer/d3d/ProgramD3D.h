@@ -44,6 +44,7 @@ class ProgramD3D : public ProgramImpl
     GLenum getSamplerTextureType(gl::SamplerType type, unsigned int samplerIndex) const;
     GLint getUsedSamplerRange(gl::SamplerType type) const;
     void updateSamplerMapping();
+    unsigned int getSamplerMappingSerial() const { return mSamplerMappingSerial; }
     bool validateSamplers(gl::InfoLog *infoLog, const gl::Caps &caps);
 
     bool usesPointSize() const { return mUsesPointSize; }
@@ -208,6 +209,7 @@ class ProgramD3D : public ProgramImpl
     GLuint mUsedVertexSamplerRange;
     GLuint mUsedPixelSamplerRange;
     bool mDirtySamplerMapping;
+    unsigned int mSamplerMappingSerial;
 
     int mShaderVersion;
 };
@@ -398,6 +398,24 @@ gl::Error TextureD3D::generateMipmaps()
 
     for (GLint layer = 0; layer < layerCount; ++layer)
     {
+        if (!renderableStorage)
+        {
+            // CPU-side mipmapping, all levels of the layer at once
+            std::vector<Image*> images(mipCount);
+            for (GLint mip = 0; mip < mipCount; ++mip)
+            {
+                ASSERT(getLayerCount(mip) == layerCount);
+                images[mip] = getImage(getImageIndex(mip, layer));
+            }
+
+            gl::Error error = mRenderer->generateMipmapChain(&images[0], images.size());
+            if (error.isError())
+            {
+                return error;
+            }
+            continue;
+        }
+
         for (GLint mip = 1; mip < mipCount; ++mip)
         {
             ASSERT(getLayerCount(mip) == layerCount);
@@ -405,23 +423,11 @@ gl::Error TextureD3D::generateMipmaps()
             gl::ImageIndex sourceIndex = getImageIndex(mip - 1, layer);
             gl::ImageIndex destIndex = getImageIndex(mip, layer);
 
-            if (renderableStorage)
-            {
-                // GPU-side mipmapping
-                gl::Error error = mTexStorage->generateMipmap(sourceIndex, destIndex);
-                if (error.isError())
-                {
-                    return error;
-                }
-            }
-            else
+            // GPU-side mipmapping
+            gl::Error error = mTexStorage->generateMipmap(sourceIndex, destIndex);
+            if (error.isError())
             {
-                // CPU-side mipmapping
-                gl::Error error = mRenderer->generateMipmap(getImage(destIndex), getImage(sourceIndex));
-                if (error.isError())
-                {
-                    return error;
-                }
+                return error;
             }
         }
     }
@@ -13,6 +13,8 @@
 #include "libGLESv2/renderer/d3d/d3d11/TextureStorage11.h"
 #include "libGLESv2/renderer/d3d/d3d11/formatutils11.h"
 #include "libGLESv2/renderer/d3d/d3d11/renderer11_utils.h"
+#include "libGLESv2/renderer/ImageLoadExecutor.h"
+#include "libGLESv2/renderer/generatemip.h"
 #include "libGLESv2/Framebuffer.h"
 #include "libGLESv2/FramebufferAttachment.h"
 #include "libGLESv2/main.h"
@@ -86,6 +88,71 @@ gl::Error Image11::generateMipmap(Image11 *dest, Image11 *src)
     return gl::Error(GL_NO_ERROR);
 }
 
+gl::Error Image11::generateMipmapChain(Image11 *const *images, size_t imageCount)
+{
+    ASSERT(imageCount >= 2);
+
+    Image11 *baseImage = images[0];
+    const d3d11::DXGIFormat &dxgiFormatInfo = d3d11::GetDXGIFormatInfo(baseImage->getDXGIFormat());
+    ASSERT(dxgiFormatInfo.mipChainGenerationFunction != NULL);
+
+    // Every level but the last is read to generate the next one
+    std::vector<MipChainLevel> levels(imageCount);
+    gl::Error error(GL_NO_ERROR);
+    size_t mappedCount = 0;
+    for (; mappedCount < imageCount; mappedCount++)
+    {
+        Image11 *image = images[mappedCount];
+        ASSERT(image->getDXGIFormat() == baseImage->getDXGIFormat());
+        ASSERT(image->getWidth() == std::max(1, baseImage->getWidth() >> mappedCount));
+        ASSERT(image->getHeight() == std::max(1, baseImage->getHeight() >> mappedCount));
+
+        D3D11_MAP mapType = D3D11_MAP_READ_WRITE;
+        if (mappedCount == 0)
+        {
+            mapType = D3D11_MAP_READ;
+        }
+        else if (mappedCount == imageCount - 1)
+        {
+            mapType = D3D11_MAP_WRITE;
+        }
+
+        D3D11_MAPPED_SUBRESOURCE mapped;
+        error = image->map(mapType, &mapped);
+        if (error.isError())
+        {
+            break;
+        }
+
+        levels[mappedCount].data = reinterpret_cast<uint8_t*>(mapped.pData);
+        levels[mappedCount].rowPitch = mapped.RowPitch;
+        levels[mappedCount].depthPitch = mapped.DepthPitch;
+    }
+
+    if (!error.isError())
+    {
+        dxgiFormatInfo.mipChainGenerationFunction(baseImage->getWidth(), baseImage->getHeight(), baseImage->getDepth(),
+                                                  &levels[0], imageCount);
+    }
+
+    for (size_t i = 0; i < mappedCount; i++)
+    {
+        images[i]->unmap();
+    }
+
+    if (error.isError())
+    {
+        return error;
+    }
+
+    for (size_t i = 1; i < imageCount; i++)
+    {
+        images[i]->markDirty();
+    }
+
+    return gl::Error(GL_NO_ERROR);
+}
+
 bool Image11::isDirty() const
 {
     // If mDirty is true
@@ -274,9 +341,9 @@ gl::Error Image11::loadData(GLint xoffset, GLint yoffset, GLint zoffset, GLsizei
     }
 
     uint8_t* offsetMappedData = (reinterpret_cast<uint8_t*>(mappedImage.pData) + (yoffset * mappedImage.RowPitch + xoffset * outputPixelSize + zoffset * mappedImage.DepthPitch));
-    loadFunction(width, height, depth,
-                 reinterpret_cast<const uint8_t*>(input), inputRowPitch, inputDepthPitch,
-                 offsetMappedData, mappedImage.RowPitch, mappedImage.DepthPitch);
+    mRenderer->getImageLoadExecutor()->load(loadFunction, width, height, depth,
+                                            reinterpret_cast<const uint8_t*>(input), inputRowPitch, inputDepthPitch,
+                                            offsetMappedData, mappedImage.RowPitch, mappedImage.DepthPitch);
 
     unmap();
 
@@ -312,9 +379,20 @@ gl::Error Image11::loadCompressedData(GLint xoffset, GLint yoffset, GLint zoffse
                                                                            (xoffset / outputBlockWidth) * outputPixelSize +
                                                                            zoffset * mappedImage.DepthPitch);
 
-    loadFunction(width, height, depth,
-                 reinterpret_cast<const uint8_t*>(input), inputRowPitch, inputDepthPitch,
-                 offsetMappedData, mappedImage.RowPitch, mappedImage.DepthPitch);
+    if (outputBlockHeight == 1)
+    {
+        // Decompressed to pixels, which is slow enough to be worth spreading
+        // over the loader threads
+        mRenderer->getImageLoadExecutor()->loadBlocks(loadFunction, formatInfo.compressedBlockHeight, width, height, depth,
+                                                      reinterpret_cast<const uint8_t*>(input), inputRowPitch, inputDepthPitch,
+                                                      offsetMappedData, mappedImage.RowPitch, mappedImage.DepthPitch);
+    }
+    else
+    {
+        loadFunction(width, height, depth,
+                     reinterpret_cast<const uint8_t*>(input), inputRowPitch, inputDepthPitch,
+                     offsetMappedData, mappedImage.RowPitch, mappedImage.DepthPitch);
+    }
 
     unmap();
 
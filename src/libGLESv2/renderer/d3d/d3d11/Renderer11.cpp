@@ -27,6 +27,7 @@
 #include "libGLESv2/renderer/d3d/d3d11/IndexBuffer11.h"
 #include "libGLESv2/renderer/d3d/d3d11/Buffer11.h"
 #include "libGLESv2/renderer/d3d/VertexDataManager.h"
+#include "libGLESv2/renderer/copyimage.h"
 #include "libGLESv2/renderer/d3d/IndexDataManager.h"
 #include "libGLESv2/renderer/d3d/d3d11/TextureStorage11.h"
 #include "libGLESv2/renderer/d3d/d3d11/Query11.h"
@@ -820,6 +821,7 @@ void Renderer11::setScissorRectangle(const gl::Rectangle &scissor, bool enabled)
         if (enabled != mScissorEnabled)
         {
             mForceSetRasterState = true;
+            invalidateAppliedState();
         }
 
         mCurScissor = scissor;
@@ -958,6 +960,7 @@ void Renderer11::unsetSRVsWithResource(gl::SamplerType samplerType, const ID3D11
         if (srv && GetSRVResource(srv) == resource)
         {
             setShaderResource(samplerType, static_cast<UINT>(resourceIndex), NULL);
+            invalidateAppliedState();
         }
     }
 }
@@ -1092,6 +1095,7 @@ gl::Error Renderer11::applyRenderTarget(gl::Framebuffer *framebuffer)
         mForceSetViewport = true;
         mForceSetScissor = true;
         mForceSetBlendState = true;
+        invalidateAppliedState();
 
         if (!mDepthStencilInitialized)
         {
@@ -1810,6 +1814,7 @@ void Renderer11::markAllStateDirty()
     mForceSetDepthStencilState = true;
     mForceSetScissor = true;
     mForceSetViewport = true;
+    invalidateAppliedState();
 
     mRenderToBackBufferActive = false;
 
@@ -2150,6 +2155,7 @@ void Renderer11::setRenderToBackBufferVariables(bool renderingToBackBuffer)
 
     // The rasterizer state must be updated, so that it will update its culling mode.
     mForceSetRasterState = true;
+    invalidateAppliedState();
 
     mVertexConstants.viewScale[0] = 1.0f;
     mVertexConstants.viewScale[1] = 1.0f;
@@ -2872,6 +2878,16 @@ gl::Error Renderer11::generateMipmap(Image *dest, Image *src)
     return Image11::generateMipmap(dest11, src11);
 }
 
+gl::Error Renderer11::generateMipmapChain(Image **images, size_t imageCount)
+{
+    std::vector<Image11*> images11(imageCount);
+    for (size_t i = 0; i < imageCount; i++)
+    {
+        images11[i] = Image11::makeImage11(images[i]);
+    }
+    return Image11::generateMipmapChain(&images11[0], imageCount);
+}
+
 TextureStorage *Renderer11::createTextureStorage2D(SwapChain *swapChain)
 {
     SwapChain11 *swapChain11 = SwapChain11::makeSwapChain11(swapChain);
@@ -3058,6 +3074,9 @@ gl::Error Renderer11::packPixels(ID3D11Texture2D *readTexture, const PackPixelsP
         const gl::FormatType &destFormatTypeInfo = gl::GetFormatTypeInfo(params.format, params.type);
         const gl::InternalFormat &destFormatInfo = gl::GetInternalFormatInfo(destFormatTypeInfo.internalFormat);
 
+        ColorRowCopyFunction copyRowFunc = GetColorRowCopyFunction(sourceDXGIFormatInfo.colorReadFunction, sourceFormatInfo.pixelBytes,
+                                                                   destFormatTypeInfo.colorWriteFunction, destFormatInfo.pixelBytes);
+
         if (fastCopyFunc)
         {
             // Fast copy is possible through some special function
@@ -3072,6 +3091,14 @@ gl::Error Renderer11::packPixels(ID3D11Texture2D *readTexture, const PackPixelsP
                 }
             }
         }
+        else if (copyRowFunc)
+        {
+            // The read and write functions composed into one loop per row
+            for (int y = 0; y < params.area.height; y++)
+            {
+                copyRowFunc(params.area.width, source + y * inputPitch, pixelsOut + params.offset + y * params.outputPitch);
+            }
+        }
         else
         {
             uint8_t temp[16]; // Maximum size of any Color<T> type used.
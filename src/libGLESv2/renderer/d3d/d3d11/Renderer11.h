@@ -162,6 +162,7 @@ class Renderer11 : public Renderer
     // Image operations
     virtual Image *createImage();
     virtual gl::Error generateMipmap(Image *dest, Image *source);
+    virtual gl::Error generateMipmapChain(Image **images, size_t imageCount);
     virtual TextureStorage *createTextureStorage2D(SwapChain *swapChain);
     virtual TextureStorage *createTextureStorage2D(GLenum internalformat, bool renderTarget, GLsizei width, GLsizei height, int levels,  bool hintLevelZeroOnly = false);
     virtual TextureStorage *createTextureStorageCube(GLenum internalformat, bool renderTarget, int size, int levels);
@@ -17,6 +17,7 @@
 #include "libGLESv2/renderer/d3d/d3d11/Image11.h"
 #include "libGLESv2/renderer/d3d/MemoryBuffer.h"
 #include "libGLESv2/renderer/d3d/TextureD3D.h"
+#include "libGLESv2/renderer/ImageLoadExecutor.h"
 #include "libGLESv2/main.h"
 #include "libGLESv2/ImageIndex.h"
 
@@ -516,9 +517,9 @@ gl::Error TextureStorage11::setData(const gl::ImageIndex &index, Image *image, c
 
     // TODO: fast path
     LoadImageFunction loadFunction = d3d11Format.loadFunctions.at(type);
-    loadFunction(width, height, depth,
-                 pixelData, srcRowPitch, srcDepthPitch,
-                 conversionBuffer.data(), bufferRowPitch, bufferDepthPitch);
+    mRenderer->getImageLoadExecutor()->load(loadFunction, width, height, depth,
+                                            pixelData, srcRowPitch, srcDepthPitch,
+                                            conversionBuffer.data(), bufferRowPitch, bufferDepthPitch);
 
     ID3D11DeviceContext *immediateContext = mRenderer->getDeviceContext();
 
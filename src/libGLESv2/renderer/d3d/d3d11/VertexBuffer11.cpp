@@ -10,6 +10,7 @@
 #include "libGLESv2/renderer/d3d/d3d11/Buffer11.h"
 #include "libGLESv2/renderer/d3d/d3d11/Renderer11.h"
 #include "libGLESv2/renderer/d3d/d3d11/formatutils11.h"
+#include "libGLESv2/renderer/ImageLoadExecutor.h"
 #include "libGLESv2/Buffer.h"
 #include "libGLESv2/VertexAttribute.h"
 
@@ -117,7 +118,9 @@ gl::Error VertexBuffer11::storeVertexAttributes(const gl::VertexAttribute &attri
     gl::VertexFormat vertexFormat(attrib, currentValue.Type);
     const d3d11::VertexFormat &vertexFormatInfo = d3d11::GetVertexFormatInfo(vertexFormat, mRenderer->getFeatureLevel());
     ASSERT(vertexFormatInfo.copyFunction != NULL);
-    vertexFormatInfo.copyFunction(input, inputStride, count, output);
+    const d3d11::DXGIFormat &dxgiFormatInfo = d3d11::GetDXGIFormatInfo(vertexFormatInfo.nativeFormat);
+    mRenderer->getImageLoadExecutor()->copyVertices(vertexFormatInfo.copyFunction, input, inputStride, count,
+                                                    output, dxgiFormatInfo.pixelBytes);
 
     dxContext->Unmap(mBuffer, 0);
 
@@ -39,6 +39,7 @@ struct DXGIFormat
     GLenum componentType;
 
     MipGenerationFunction mipGenerationFunction;
+    MipChainGenerationFunction mipChainGenerationFunction;
     ColorReadFunction colorReadFunction;
 
     FastCopyFunctionMap fastCopyFunctions;
@@ -26,6 +26,7 @@
 #include "libGLESv2/renderer/d3d/ShaderD3D.h"
 #include "libGLESv2/renderer/d3d/TextureD3D.h"
 #include "libGLESv2/renderer/d3d/TransformFeedbackD3D.h"
+#include "libGLESv2/renderer/copyimage.h"
 #include "libGLESv2/main.h"
 #include "libGLESv2/Buffer.h"
 #include "libGLESv2/Texture.h"
@@ -1271,12 +1272,14 @@ gl::Error Renderer9::applyRenderTarget(gl::Framebuffer *framebuffer)
         {
             mCurDepthSize = depthSize;
             mForceSetRasterState = true;
+            invalidateAppliedState();
         }
 
         if (!mDepthStencilInitialized || stencilSize != mCurStencilSize)
         {
             mCurStencilSize = stencilSize;
             mForceSetDepthStencilState = true;
+            invalidateAppliedState();
         }
 
         mAppliedDepthbufferSerial = depthbufferSerial;
@@ -1289,6 +1292,7 @@ gl::Error Renderer9::applyRenderTarget(gl::Framebuffer *framebuffer)
         mForceSetScissor = true;
         mForceSetViewport = true;
         mForceSetBlendState = true;
+        invalidateAppliedState();
 
         mRenderTargetDesc.width = attachment->getWidth();
         mRenderTargetDesc.height = attachment->getHeight();
@@ -2089,6 +2093,7 @@ void Renderer9::markAllStateDirty()
     mForceSetScissor = true;
     mForceSetViewport = true;
     mForceSetBlendState = true;
+    invalidateAppliedState();
 
     ASSERT(mForceSetVertexSamplerStates.size() == mCurVertexTextureSerials.size());
     for (unsigned int i = 0; i < mForceSetVertexSamplerStates.size(); i++)
@@ -2775,6 +2780,9 @@ gl::Error Renderer9::readPixels(gl::Framebuffer *framebuffer, GLint x, GLint y,
         const gl::FormatType &destFormatTypeInfo = gl::GetFormatTypeInfo(format, type);
         const gl::InternalFormat &destFormatInfo = gl::GetInternalFormatInfo(destFormatTypeInfo.internalFormat);
 
+        ColorRowCopyFunction copyRowFunc = GetColorRowCopyFunction(sourceD3DFormatInfo.colorReadFunction, sourceFormatInfo.pixelBytes,
+                                                                   destFormatTypeInfo.colorWriteFunction, destFormatInfo.pixelBytes);
+
         if (fastCopyFunc)
         {
             // Fast copy is possible through some special function
@@ -2789,6 +2797,14 @@ gl::Error Renderer9::readPixels(gl::Framebuffer *framebuffer, GLint x, GLint y,
                 }
             }
         }
+        else if (copyRowFunc)
+        {
+            // The read and write functions composed into one loop per row
+            for (int y = 0; y < rect.bottom - rect.top; y++)
+            {
+                copyRowFunc(rect.right - rect.left, source + y * inputPitch, pixels + y * outputPitch);
+            }
+        }
         else
         {
             uint8_t temp[sizeof(gl::ColorF)];
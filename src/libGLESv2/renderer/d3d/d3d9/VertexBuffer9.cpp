@@ -10,6 +10,7 @@
 #include "libGLESv2/renderer/d3d/d3d9/Renderer9.h"
 #include "libGLESv2/renderer/d3d/d3d9/formatutils9.h"
 #include "libGLESv2/renderer/vertexconversion.h"
+#include "libGLESv2/renderer/ImageLoadExecutor.h"
 #include "libGLESv2/renderer/d3d/BufferD3D.h"
 #include "libGLESv2/VertexAttribute.h"
 #include "libGLESv2/Buffer.h"
@@ -132,7 +133,8 @@ gl::Error VertexBuffer9::storeVertexAttributes(const gl::VertexAttribute &attrib
     }
     else
     {
-        d3dVertexInfo.copyFunction(input, inputStride, count, mapPtr);
+        mRenderer->getImageLoadExecutor()->copyVertices(d3dVertexInfo.copyFunction, input, inputStride, count,
+                                                        mapPtr, d3dVertexInfo.outputElementSize);
     }
 
     mVertexBuffer->Unlock();
@@ -4,8 +4,9 @@
 // found in the LICENSE file.
 //
 
-// generatemip.h: Defines the GenerateMip function, templated on the format
-// type of the image for which mip levels are being generated.
+// generatemip.h: Defines the GenerateMip and GenerateMipChain functions,
+// templated on the format type of the image for which mip levels are being
+// generated.
 
 #ifndef LIBGLESV2_RENDERER_GENERATEMIP_H_
 #define LIBGLESV2_RENDERER_GENERATEMIP_H_
@@ -21,6 +22,21 @@ inline void GenerateMip(size_t sourceWidth, size_t sourceHeight, size_t sourceDe
                         const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
                         uint8_t *destData, size_t destRowPitch, size_t destDepthPitch);
 
+struct MipChainLevel
+{
+    uint8_t *data;
+    size_t rowPitch;
+    size_t depthPitch;
+};
+
+// Generates levels 1 to levelCount - 1 from level 0, each the size of the
+// previous one halved. The result is the same as calling GenerateMip for each
+// level in turn, but the image is reduced in tiles that stay in the cache for
+// several levels. Formats without vectorized filters are generated a level at
+// a time.
+template <typename T>
+inline void GenerateMipChain(size_t width, size_t height, size_t depth, const MipChainLevel *levels, size_t levelCount);
+
 }
 
 #include "generatemip.inl"
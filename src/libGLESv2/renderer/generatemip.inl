@@ -8,6 +8,9 @@
 // type of the image for which mip levels are being generated.
 
 #include "common/mathutil.h"
+#include "libGLESv2/renderer/generatemipSIMD.h"
+
+#include <vector>
 
 namespace rx
 {
@@ -245,8 +248,139 @@ static MipGenerationFunction GetMipGenerationFunction(size_t sourceWidth, size_t
     return NULL;
 }
 
+template <typename T>
+static void AverageRows(size_t count, const uint8_t *first, const uint8_t *second, uint8_t *dest)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        T::average(reinterpret_cast<T*>(dest) + i, reinterpret_cast<const T*>(first) + i, reinterpret_cast<const T*>(second) + i);
+    }
+}
+
+template <typename T>
+static void AveragePairs(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        const T *pair = reinterpret_cast<const T*>(source) + i * 2;
+        T::average(reinterpret_cast<T*>(dest) + i, pair, pair + 1);
+    }
+}
+
+// Formats without vectorized filters have no row functions: reducing them a
+// row at a time costs more per pixel than GenerateMip saves in cache misses.
+template <typename T>
+inline MipRowFunctions GetMipRowFunctions()
+{
+    MipRowFunctions functions = { NULL, NULL };
+    return functions;
+}
+
+template <>
+inline MipRowFunctions GetMipRowFunctions<R8G8B8A8>()
+{
+    return GetBestMipRowKernel(MIP_ROW_RGBA8);
+}
+
+template <>
+inline MipRowFunctions GetMipRowFunctions<B8G8R8A8>()
+{
+    return GetBestMipRowKernel(MIP_ROW_RGBA8);
+}
+
+template <>
+inline MipRowFunctions GetMipRowFunctions<R16G16B16A16F>()
+{
+    return GetBestMipRowKernel(MIP_ROW_RGBA16F);
+}
+
+template <>
+inline MipRowFunctions GetMipRowFunctions<R32G32B32A32F>()
+{
+    return GetBestMipRowKernel(MIP_ROW_RGBA32F);
 }
 
+struct MipRegion
+{
+    size_t x0, x1;
+    size_t y0, y1;
+    size_t z0, z1;
+};
+
+// Writes |destRegion| of the level after |source|. The pixels are averaged in
+// the same order as the GenerateMip_ functions: depth first, then rows, then
+// columns, so that the rounding matches.
+template <typename T>
+static void GenerateMipRegion(const MipRowFunctions &rowFunctions, size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                              const MipChainLevel &source, const MipChainLevel &dest, const MipRegion &destRegion,
+                              uint8_t *scratch)
+{
+    const bool averageX = sourceWidth > 1;
+    const bool averageY = sourceHeight > 1;
+    const bool averageZ = sourceDepth > 1;
+    ASSERT(averageX || averageY || averageZ);
+
+    const size_t count = destRegion.x1 - destRegion.x0;
+    const size_t sourceX = averageX ? destRegion.x0 * 2 : destRegion.x0;
+    const size_t sourceCount = averageX ? count * 2 : count;
+    uint8_t *scratch0 = scratch;
+    uint8_t *scratch1 = scratch + sourceCount * sizeof(T);
+
+    for (size_t z = destRegion.z0; z < destRegion.z1; z++)
+    {
+        const size_t sourceZ0 = averageZ ? z * 2 : z;
+        const size_t sourceZ1 = averageZ ? z * 2 + 1 : z;
+
+        for (size_t y = destRegion.y0; y < destRegion.y1; y++)
+        {
+            const size_t sourceY0 = averageY ? y * 2 : y;
+            const size_t sourceY1 = averageY ? y * 2 + 1 : y;
+
+            const uint8_t *row00 = reinterpret_cast<const uint8_t*>(GetPixel<T>(source.data, sourceX, sourceY0, sourceZ0, source.rowPitch, source.depthPitch));
+            const uint8_t *row01 = reinterpret_cast<const uint8_t*>(GetPixel<T>(source.data, sourceX, sourceY0, sourceZ1, source.rowPitch, source.depthPitch));
+            const uint8_t *row10 = reinterpret_cast<const uint8_t*>(GetPixel<T>(source.data, sourceX, sourceY1, sourceZ0, source.rowPitch, source.depthPitch));
+            const uint8_t *row11 = reinterpret_cast<const uint8_t*>(GetPixel<T>(source.data, sourceX, sourceY1, sourceZ1, source.rowPitch, source.depthPitch));
+            uint8_t *destRow = reinterpret_cast<uint8_t*>(GetPixel<T>(dest.data, destRegion.x0, y, z, dest.rowPitch, dest.depthPitch));
+
+            // Reduce to a single row of the source width
+            const uint8_t *reduced = row00;
+            uint8_t *verticalDest = averageX ? scratch0 : destRow;
+            if (averageY && averageZ)
+            {
+                rowFunctions.averageRows(sourceCount, row00, row01, scratch0);
+                rowFunctions.averageRows(sourceCount, row10, row11, scratch1);
+                rowFunctions.averageRows(sourceCount, scratch0, scratch1, verticalDest);
+                reduced = verticalDest;
+            }
+            else if (averageY)
+            {
+                rowFunctions.averageRows(sourceCount, row00, row10, verticalDest);
+                reduced = verticalDest;
+            }
+            else if (averageZ)
+            {
+                rowFunctions.averageRows(sourceCount, row00, row01, verticalDest);
+                reduced = verticalDest;
+            }
+
+            if (averageX)
+            {
+                rowFunctions.averagePairs(count, reduced, destRow);
+            }
+        }
+    }
+}
+
+// Tiles are 2^MipChainTileLevels rows and slices high and deep, and as wide as
+// fits in MipChainTileBytes. Short, wide tiles keep the reads of each row long
+// enough for the hardware prefetcher, while the levels generated from a tile
+// still stay in the L2 cache.
+const size_t MipChainTileLevels = 4;
+const size_t MipChainTileBytes = 128 * 1024;
+
+}
+
+
 template <typename T>
 inline void GenerateMip(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
                         const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
@@ -263,4 +397,89 @@ inline void GenerateMip(size_t sourceWidth, size_t sourceHeight, size_t sourceDe
                        mipWidth, mipHeight, mipDepth, destData, destRowPitch, destDepthPitch);
 }
 
+template <typename T>
+inline void GenerateMipChain(size_t width, size_t height, size_t depth, const MipChainLevel *levels, size_t levelCount)
+{
+    if (levelCount < 2)
+    {
+        return;
+    }
+
+    const MipRowFunctions rowFunctions = priv::GetMipRowFunctions<T>();
+    if (!rowFunctions.averageRows)
+    {
+        for (size_t level = 1; level < levelCount; level++)
+        {
+            const MipChainLevel &source = levels[level - 1];
+            const MipChainLevel &dest = levels[level];
+            GenerateMip<T>(std::max<size_t>(1, width >> (level - 1)), std::max<size_t>(1, height >> (level - 1)),
+                           std::max<size_t>(1, depth >> (level - 1)), source.data, source.rowPitch, source.depthPitch,
+                           dest.data, dest.rowPitch, dest.depthPitch);
+        }
+        return;
+    }
+
+    std::vector<uint8_t> scratch(2 * width * sizeof(T));
+
+    const size_t tileHeight = (height > 1) ? (1 << priv::MipChainTileLevels) : 1;
+    const size_t tileDepth = (depth > 1) ? (1 << priv::MipChainTileLevels) : 1;
+    size_t tileWidth = (width > 1) ? (1 << priv::MipChainTileLevels) : 1;
+    while (width > 1 && tileWidth < width && tileWidth * 2 * tileHeight * tileDepth * sizeof(T) <= priv::MipChainTileBytes)
+    {
+        tileWidth *= 2;
+    }
+    const size_t tileLevels = std::min(priv::MipChainTileLevels, levelCount - 1);
+
+    // The first levels are generated one tile at a time. A tile of level 0
+    // covers the same part of the image as a tile of each later level with
+    // every reduced dimension halved, so each level of a tile only reads
+    // pixels of the same tile.
+    for (size_t tileZ = 0; tileZ * tileDepth < depth; tileZ++)
+    {
+        for (size_t tileY = 0; tileY * tileHeight < height; tileY++)
+        {
+            for (size_t tileX = 0; tileX * tileWidth < width; tileX++)
+            {
+                for (size_t level = 0; level < tileLevels; level++)
+                {
+                    const size_t spanX = std::max<size_t>(1, tileWidth >> (level + 1));
+                    const size_t spanY = std::max<size_t>(1, tileHeight >> (level + 1));
+                    const size_t spanZ = std::max<size_t>(1, tileDepth >> (level + 1));
+                    priv::MipRegion region;
+                    region.x0 = tileX * spanX;
+                    region.x1 = std::min(region.x0 + spanX, std::max<size_t>(1, width >> (level + 1)));
+                    region.y0 = tileY * spanY;
+                    region.y1 = std::min(region.y0 + spanY, std::max<size_t>(1, height >> (level + 1)));
+                    region.z0 = tileZ * spanZ;
+                    region.z1 = std::min(region.z0 + spanZ, std::max<size_t>(1, depth >> (level + 1)));
+                    if (region.x0 >= region.x1 || region.y0 >= region.y1 || region.z0 >= region.z1)
+                    {
+                        break;
+                    }
+
+                    priv::GenerateMipRegion<T>(rowFunctions, std::max<size_t>(1, width >> level),
+                                               std::max<size_t>(1, height >> level), std::max<size_t>(1, depth >> level),
+                                               levels[level], levels[level + 1], region, &scratch[0]);
+                }
+            }
+        }
+    }
+
+    // The remaining levels are small enough to stay in the cache whole
+    for (size_t level = tileLevels; level + 1 < levelCount; level++)
+    {
+        priv::MipRegion region;
+        region.x0 = 0;
+        region.x1 = std::max<size_t>(1, width >> (level + 1));
+        region.y0 = 0;
+        region.y1 = std::max<size_t>(1, height >> (level + 1));
+        region.z0 = 0;
+        region.z1 = std::max<size_t>(1, depth >> (level + 1));
+
+        priv::GenerateMipRegion<T>(rowFunctions, std::max<size_t>(1, width >> level),
+                                   std::max<size_t>(1, height >> level), std::max<size_t>(1, depth >> level),
+                                   levels[level], levels[level + 1], region, &scratch[0]);
+    }
+}
+
 }
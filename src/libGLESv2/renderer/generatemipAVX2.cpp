@@ -0,0 +1,198 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// generatemipAVX2.cpp: Box filters for GenerateMipChain using 256-bit
+// instructions.
+
+#include "libGLESv2/renderer/generatemipSIMD.h"
+#include "libGLESv2/renderer/generatemip.h"
+
+#if defined(ANGLE_CPU_X86)
+#   include <immintrin.h>
+#endif
+
+namespace rx
+{
+
+#if defined(ANGLE_CPU_X86)
+
+namespace
+{
+
+inline ANGLE_TARGET_AVX2 __m256i LoadUnaligned(const uint8_t *source)
+{
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source));
+}
+
+inline ANGLE_TARGET_AVX2 void StoreUnaligned(uint8_t *dest, __m256i value)
+{
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest), value);
+}
+
+// Same as R8G8B8A8::average: rounds each byte down.
+inline ANGLE_TARGET_AVX2 __m256i AverageRGBA8(__m256i first, __m256i second)
+{
+    __m256i half = _mm256_srli_epi32(_mm256_and_si256(_mm256_xor_si256(first, second), _mm256_set1_epi32(static_cast<int>(0xFEFEFEFE))), 1);
+    return _mm256_add_epi32(half, _mm256_and_si256(first, second));
+}
+
+ANGLE_TARGET_AVX2 void AverageRowsRGBA8(size_t count, const uint8_t *first, const uint8_t *second, uint8_t *dest)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        StoreUnaligned(dest + i * 4, AverageRGBA8(LoadUnaligned(first + i * 4), LoadUnaligned(second + i * 4)));
+    }
+    priv::AverageRows<R8G8B8A8>(count - i, first + i * 4, second + i * 4, dest + i * 4);
+}
+
+ANGLE_TARGET_AVX2 void AveragePairsRGBA8(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 pixels0 = _mm256_castsi256_ps(LoadUnaligned(source + i * 8));
+        __m256 pixels1 = _mm256_castsi256_ps(LoadUnaligned(source + i * 8 + 32));
+
+        // The shuffles work within each 128-bit lane, leaving the 64-bit
+        // groups of pixels out of order.
+        __m256i even = _mm256_castps_si256(_mm256_shuffle_ps(pixels0, pixels1, _MM_SHUFFLE(2, 0, 2, 0)));
+        __m256i odd = _mm256_castps_si256(_mm256_shuffle_ps(pixels0, pixels1, _MM_SHUFFLE(3, 1, 3, 1)));
+        __m256i average = AverageRGBA8(even, odd);
+        StoreUnaligned(dest + i * 4, _mm256_permute4x64_epi64(average, _MM_SHUFFLE(3, 1, 2, 0)));
+    }
+    priv::AveragePairs<R8G8B8A8>(count - i, source + i * 8, dest + i * 4);
+}
+
+// Same as gl::float16ToFloat32, for the half floats in each lane.
+inline ANGLE_TARGET_AVX2 __m256 HalfToFloat(__m256i halves)
+{
+    __m256i sign = _mm256_slli_epi32(_mm256_and_si256(halves, _mm256_set1_epi32(0x8000)), 16);
+    __m256i magnitude = _mm256_and_si256(halves, _mm256_set1_epi32(0x7FFF));
+
+    // Rebias the exponent, twice for infinities and NaNs so that they keep
+    // the maximum exponent.
+    __m256i normal = _mm256_add_epi32(_mm256_slli_epi32(magnitude, 13), _mm256_set1_epi32(0x38000000));
+    __m256i isInfinity = _mm256_cmpgt_epi32(magnitude, _mm256_set1_epi32(0x7BFF));
+    normal = _mm256_add_epi32(normal, _mm256_and_si256(isInfinity, _mm256_set1_epi32(0x38000000)));
+    __m256i denormal = _mm256_castps_si256(_mm256_mul_ps(_mm256_cvtepi32_ps(magnitude), _mm256_set1_ps(1.0f / (1 << 24))));
+    __m256i isDenormal = _mm256_cmpgt_epi32(_mm256_set1_epi32(0x400), magnitude);
+
+    __m256i bits = _mm256_blendv_epi8(normal, denormal, isDenormal);
+    return _mm256_castsi256_ps(_mm256_or_si256(bits, sign));
+}
+
+// Same as gl::float32ToFloat16.
+inline ANGLE_TARGET_AVX2 __m256i FloatToHalf(__m256 floats)
+{
+    __m256i bits = _mm256_castps_si256(floats);
+    __m256i sign = _mm256_and_si256(_mm256_srli_epi32(bits, 16), _mm256_set1_epi32(0x8000));
+    __m256i magnitude = _mm256_and_si256(bits, _mm256_set1_epi32(0x7FFFFFFF));
+
+    __m256i normal = _mm256_add_epi32(magnitude, _mm256_set1_epi32(static_cast<int>(0xC8000000 + 0xFFF)));
+    normal = _mm256_add_epi32(normal, _mm256_and_si256(_mm256_srli_epi32(magnitude, 13), _mm256_set1_epi32(1)));
+    normal = _mm256_srli_epi32(normal, 13);
+
+    __m256i denormal = _mm256_srlv_epi32(_mm256_or_si256(_mm256_and_si256(magnitude, _mm256_set1_epi32(0x7FFFFF)), _mm256_set1_epi32(0x800000)),
+                                         _mm256_sub_epi32(_mm256_set1_epi32(113), _mm256_srli_epi32(magnitude, 23)));
+    denormal = _mm256_add_epi32(denormal, _mm256_add_epi32(_mm256_set1_epi32(0xFFF), _mm256_and_si256(_mm256_srli_epi32(denormal, 13), _mm256_set1_epi32(1))));
+    denormal = _mm256_srli_epi32(denormal, 13);
+
+    __m256i isDenormal = _mm256_cmpgt_epi32(_mm256_set1_epi32(0x38800000), magnitude);
+    __m256i isOverflow = _mm256_cmpgt_epi32(magnitude, _mm256_set1_epi32(0x47FFEFFF));
+
+    __m256i result = _mm256_blendv_epi8(normal, denormal, isDenormal);
+    result = _mm256_blendv_epi8(result, _mm256_set1_epi32(0x7FFF), isOverflow);
+    return _mm256_or_si256(result, sign);
+}
+
+// Same as R16G16B16A16F::average for 2 pixels per 128-bit half.
+inline ANGLE_TARGET_AVX2 __m128i AverageRGBA16F(__m128i first, __m128i second)
+{
+    __m256 sum = _mm256_add_ps(HalfToFloat(_mm256_cvtepu16_epi32(first)), HalfToFloat(_mm256_cvtepu16_epi32(second)));
+    __m256i halves = FloatToHalf(_mm256_mul_ps(sum, _mm256_set1_ps(0.5f)));
+    return _mm_packus_epi32(_mm256_castsi256_si128(halves), _mm256_extracti128_si256(halves, 1));
+}
+
+ANGLE_TARGET_AVX2 void AverageRowsRGBA16F(size_t count, const uint8_t *first, const uint8_t *second, uint8_t *dest)
+{
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2)
+    {
+        __m128i average = AverageRGBA16F(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i * 8)),
+                                         _mm_loadu_si128(reinterpret_cast<const __m128i*>(second + i * 8)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i * 8), average);
+    }
+    priv::AverageRows<R16G16B16A16F>(count - i, first + i * 8, second + i * 8, dest + i * 8);
+}
+
+ANGLE_TARGET_AVX2 void AveragePairsRGBA16F(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2)
+    {
+        // Even pixels to the low half, odd pixels to the high half
+        __m256i pixels = _mm256_permute4x64_epi64(LoadUnaligned(source + i * 16), _MM_SHUFFLE(3, 1, 2, 0));
+        __m128i average = AverageRGBA16F(_mm256_castsi256_si128(pixels), _mm256_extracti128_si256(pixels, 1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i * 8), average);
+    }
+    priv::AveragePairs<R16G16B16A16F>(count - i, source + i * 16, dest + i * 8);
+}
+
+ANGLE_TARGET_AVX2 void AverageRowsRGBA32F(size_t count, const uint8_t *first, const uint8_t *second, uint8_t *dest)
+{
+    const __m256 half = _mm256_set1_ps(0.5f);
+
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2)
+    {
+        __m256 average = _mm256_mul_ps(_mm256_add_ps(_mm256_loadu_ps(reinterpret_cast<const float*>(first + i * 16)),
+                                                     _mm256_loadu_ps(reinterpret_cast<const float*>(second + i * 16))), half);
+        _mm256_storeu_ps(reinterpret_cast<float*>(dest + i * 16), average);
+    }
+    priv::AverageRows<R32G32B32A32F>(count - i, first + i * 16, second + i * 16, dest + i * 16);
+}
+
+ANGLE_TARGET_AVX2 void AveragePairsRGBA32F(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    const __m256 half = _mm256_set1_ps(0.5f);
+
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2)
+    {
+        __m256 pixels0 = _mm256_loadu_ps(reinterpret_cast<const float*>(source + i * 32));
+        __m256 pixels1 = _mm256_loadu_ps(reinterpret_cast<const float*>(source + i * 32 + 32));
+        __m256 even = _mm256_permute2f128_ps(pixels0, pixels1, 0x20);
+        __m256 odd = _mm256_permute2f128_ps(pixels0, pixels1, 0x31);
+        _mm256_storeu_ps(reinterpret_cast<float*>(dest + i * 16), _mm256_mul_ps(_mm256_add_ps(even, odd), half));
+    }
+    priv::AveragePairs<R32G32B32A32F>(count - i, source + i * 32, dest + i * 16);
+}
+
+const MipRowFunctions kMipRowKernelsAVX2[MIP_ROW_KERNEL_COUNT] =
+{
+    { AverageRowsRGBA8,   AveragePairsRGBA8 },
+    { AverageRowsRGBA16F, AveragePairsRGBA16F },
+    { AverageRowsRGBA32F, AveragePairsRGBA32F },
+};
+
+}
+
+const MipRowFunctions *GetMipRowKernelsAVX2()
+{
+    return kMipRowKernelsAVX2;
+}
+
+#else
+
+const MipRowFunctions *GetMipRowKernelsAVX2()
+{
+    return NULL;
+}
+
+#endif
+
+}
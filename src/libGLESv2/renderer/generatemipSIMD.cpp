@@ -0,0 +1,92 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// generatemipSIMD.cpp: Runtime selection of the vectorized box filters used by
+// GenerateMipChain.
+
+#include "libGLESv2/renderer/generatemipSIMD.h"
+#include "libGLESv2/renderer/generatemip.h"
+
+#include "common/debug.h"
+
+namespace rx
+{
+
+namespace
+{
+
+struct MipRowKernelInfo
+{
+    const char *name;
+    size_t pixelBytes;
+};
+
+const MipRowKernelInfo kMipRowKernelInfo[MIP_ROW_KERNEL_COUNT] =
+{
+    { "RGBA8",   4 },
+    { "RGBA16F", 8 },
+    { "RGBA32F", 16 },
+};
+
+const MipRowFunctions kMipRowKernelsScalar[MIP_ROW_KERNEL_COUNT] =
+{
+    { priv::AverageRows<R8G8B8A8>,      priv::AveragePairs<R8G8B8A8> },
+    { priv::AverageRows<R16G16B16A16F>, priv::AveragePairs<R16G16B16A16F> },
+    { priv::AverageRows<R32G32B32A32F>, priv::AveragePairs<R32G32B32A32F> },
+};
+
+const MipRowFunctions *GetMipRowKernels(gl::SIMDLevel level)
+{
+    switch (level)
+    {
+      case gl::SIMD_SCALAR: return GetMipRowKernelsScalar();
+      case gl::SIMD_SSE2:   return GetMipRowKernelsSSE2();
+      // Averaging needs no shuffles or SSE4.1 instructions.
+      case gl::SIMD_SSSE3:  return NULL;
+      case gl::SIMD_SSE41:  return NULL;
+      case gl::SIMD_AVX2:   return GetMipRowKernelsAVX2();
+      default: UNREACHABLE(); return NULL;
+    }
+}
+
+}
+
+const char *GetMipRowKernelName(MipRowKernel kernel)
+{
+    ASSERT(kernel < MIP_ROW_KERNEL_COUNT);
+    return kMipRowKernelInfo[kernel].name;
+}
+
+size_t GetMipRowKernelPixelBytes(MipRowKernel kernel)
+{
+    ASSERT(kernel < MIP_ROW_KERNEL_COUNT);
+    return kMipRowKernelInfo[kernel].pixelBytes;
+}
+
+const MipRowFunctions *GetMipRowKernel(MipRowKernel kernel, gl::SIMDLevel level)
+{
+    ASSERT(kernel < MIP_ROW_KERNEL_COUNT);
+    return gl::GetSIMDVersion(GetMipRowKernels, kernel, level);
+}
+
+const MipRowFunctions &ResolveMipRowKernel(MipRowKernel kernel, gl::SIMDLevel maxLevel)
+{
+    ASSERT(kernel < MIP_ROW_KERNEL_COUNT);
+    return gl::ResolveSIMDVersion(GetMipRowKernels, kernel, maxLevel);
+}
+
+const MipRowFunctions &GetBestMipRowKernel(MipRowKernel kernel)
+{
+    static const gl::BestSIMDVersions<MipRowFunctions, MIP_ROW_KERNEL_COUNT> bestKernels(GetMipRowKernels);
+    return bestKernels[kernel];
+}
+
+const MipRowFunctions *GetMipRowKernelsScalar()
+{
+    return kMipRowKernelsScalar;
+}
+
+}
@@ -0,0 +1,61 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// generatemipSIMD.h: Runtime selection of the vectorized box filters used by
+// GenerateMipChain. Every mip level is built from two row operations, so a
+// format only needs vectorized versions of those two.
+
+#ifndef LIBGLESV2_RENDERER_GENERATEMIPSIMD_H_
+#define LIBGLESV2_RENDERER_GENERATEMIPSIMD_H_
+
+#include "common/simddispatch.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace rx
+{
+
+// dest[i] = average(first[i], second[i]) for |count| pixels. |dest| may be
+// |first| or |second|.
+typedef void (*MipAverageRowsFunction)(size_t count, const uint8_t *first, const uint8_t *second, uint8_t *dest);
+
+// dest[i] = average(source[2 * i], source[2 * i + 1]) for |count| pixels.
+typedef void (*MipAveragePairsFunction)(size_t count, const uint8_t *source, uint8_t *dest);
+
+struct MipRowFunctions
+{
+    MipAverageRowsFunction averageRows;
+    MipAveragePairsFunction averagePairs;
+};
+
+// The formats that have vectorized box filters. B8G8R8A8 averages the same way
+// as R8G8B8A8 and shares its filter.
+enum MipRowKernel
+{
+    MIP_ROW_RGBA8,
+    MIP_ROW_RGBA16F,
+    MIP_ROW_RGBA32F,
+
+    MIP_ROW_KERNEL_COUNT
+};
+
+const char *GetMipRowKernelName(MipRowKernel kernel);
+size_t GetMipRowKernelPixelBytes(MipRowKernel kernel);
+
+// Dispatch of the box filters through common/simddispatch.h.
+const MipRowFunctions *GetMipRowKernel(MipRowKernel kernel, gl::SIMDLevel level);
+const MipRowFunctions &ResolveMipRowKernel(MipRowKernel kernel, gl::SIMDLevel maxLevel);
+const MipRowFunctions &GetBestMipRowKernel(MipRowKernel kernel);
+
+// Per-level tables, indexed by MipRowKernel. NULL on other architectures.
+const MipRowFunctions *GetMipRowKernelsScalar();
+const MipRowFunctions *GetMipRowKernelsSSE2();
+const MipRowFunctions *GetMipRowKernelsAVX2();
+
+}
+
+#endif // LIBGLESV2_RENDERER_GENERATEMIPSIMD_H_
@@ -0,0 +1,199 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// generatemipSSE2.cpp: Box filters for GenerateMipChain using 128-bit
+// instructions.
+
+#include "libGLESv2/renderer/generatemipSIMD.h"
+#include "libGLESv2/renderer/generatemip.h"
+
+#if defined(ANGLE_CPU_X86)
+#   include <emmintrin.h>
+#endif
+
+namespace rx
+{
+
+#if defined(ANGLE_CPU_X86)
+
+namespace
+{
+
+inline ANGLE_TARGET_SSE2 __m128i LoadUnaligned(const uint8_t *source)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+}
+
+inline ANGLE_TARGET_SSE2 void StoreUnaligned(uint8_t *dest, __m128i value)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest), value);
+}
+
+// Same as R8G8B8A8::average: rounds each byte down.
+inline ANGLE_TARGET_SSE2 __m128i AverageRGBA8(__m128i first, __m128i second)
+{
+    __m128i half = _mm_srli_epi32(_mm_and_si128(_mm_xor_si128(first, second), _mm_set1_epi32(static_cast<int>(0xFEFEFEFE))), 1);
+    return _mm_add_epi32(half, _mm_and_si128(first, second));
+}
+
+ANGLE_TARGET_SSE2 void AverageRowsRGBA8(size_t count, const uint8_t *first, const uint8_t *second, uint8_t *dest)
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        StoreUnaligned(dest + i * 4, AverageRGBA8(LoadUnaligned(first + i * 4), LoadUnaligned(second + i * 4)));
+    }
+    priv::AverageRows<R8G8B8A8>(count - i, first + i * 4, second + i * 4, dest + i * 4);
+}
+
+ANGLE_TARGET_SSE2 void AveragePairsRGBA8(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 pixels0 = _mm_castsi128_ps(LoadUnaligned(source + i * 8));
+        __m128 pixels1 = _mm_castsi128_ps(LoadUnaligned(source + i * 8 + 16));
+        __m128i even = _mm_castps_si128(_mm_shuffle_ps(pixels0, pixels1, _MM_SHUFFLE(2, 0, 2, 0)));
+        __m128i odd = _mm_castps_si128(_mm_shuffle_ps(pixels0, pixels1, _MM_SHUFFLE(3, 1, 3, 1)));
+        StoreUnaligned(dest + i * 4, AverageRGBA8(even, odd));
+    }
+    priv::AveragePairs<R8G8B8A8>(count - i, source + i * 8, dest + i * 4);
+}
+
+// Same as gl::float16ToFloat32, for the half floats in the low 16 bits of each
+// lane.
+inline ANGLE_TARGET_SSE2 __m128 HalfToFloat(__m128i halves)
+{
+    __m128i sign = _mm_slli_epi32(_mm_and_si128(halves, _mm_set1_epi32(0x8000)), 16);
+    __m128i magnitude = _mm_and_si128(halves, _mm_set1_epi32(0x7FFF));
+
+    // Rebias the exponent, twice for infinities and NaNs so that they keep
+    // the maximum exponent.
+    __m128i normal = _mm_add_epi32(_mm_slli_epi32(magnitude, 13), _mm_set1_epi32(0x38000000));
+    __m128i isInfinity = _mm_cmpgt_epi32(magnitude, _mm_set1_epi32(0x7BFF));
+    normal = _mm_add_epi32(normal, _mm_and_si128(isInfinity, _mm_set1_epi32(0x38000000)));
+    __m128i denormal = _mm_castps_si128(_mm_mul_ps(_mm_cvtepi32_ps(magnitude), _mm_set1_ps(1.0f / (1 << 24))));
+    __m128i isDenormal = _mm_cmplt_epi32(magnitude, _mm_set1_epi32(0x400));
+
+    __m128i bits = _mm_or_si128(_mm_and_si128(isDenormal, denormal), _mm_andnot_si128(isDenormal, normal));
+    return _mm_castsi128_ps(_mm_or_si128(bits, sign));
+}
+
+// Same as gl::float32ToFloat16, in the low 16 bits of each lane.
+inline ANGLE_TARGET_SSE2 __m128i FloatToHalf(__m128 floats)
+{
+    __m128i bits = _mm_castps_si128(floats);
+    __m128i sign = _mm_and_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(0x8000));
+    __m128i magnitude = _mm_and_si128(bits, _mm_set1_epi32(0x7FFFFFFF));
+
+    __m128i normal = _mm_add_epi32(magnitude, _mm_set1_epi32(static_cast<int>(0xC8000000 + 0xFFF)));
+    normal = _mm_add_epi32(normal, _mm_and_si128(_mm_srli_epi32(magnitude, 13), _mm_set1_epi32(1)));
+    normal = _mm_srli_epi32(normal, 13);
+
+    // float32ToFloat16 shifts the mantissa right by 113 minus the exponent,
+    // which is the same as truncating the value scaled by 2^37.
+    __m128i denormal = _mm_cvttps_epi32(_mm_mul_ps(_mm_castsi128_ps(magnitude), _mm_set1_ps(137438953472.0f)));
+    denormal = _mm_add_epi32(denormal, _mm_add_epi32(_mm_set1_epi32(0xFFF), _mm_and_si128(_mm_srli_epi32(denormal, 13), _mm_set1_epi32(1))));
+    denormal = _mm_srli_epi32(denormal, 13);
+
+    __m128i isDenormal = _mm_cmplt_epi32(magnitude, _mm_set1_epi32(0x38800000));
+    __m128i isOverflow = _mm_cmpgt_epi32(magnitude, _mm_set1_epi32(0x47FFEFFF));
+
+    __m128i result = _mm_or_si128(_mm_and_si128(isDenormal, denormal), _mm_andnot_si128(isDenormal, normal));
+    result = _mm_or_si128(_mm_and_si128(isOverflow, _mm_set1_epi32(0x7FFF)), _mm_andnot_si128(isOverflow, result));
+    return _mm_or_si128(result, sign);
+}
+
+// Packs the low 16 bits of each lane of |low| and |high|.
+inline ANGLE_TARGET_SSE2 __m128i PackHalves(__m128i low, __m128i high)
+{
+    // PACKSSDW saturates, so sign extend the halves first.
+    low = _mm_srai_epi32(_mm_slli_epi32(low, 16), 16);
+    high = _mm_srai_epi32(_mm_slli_epi32(high, 16), 16);
+    return _mm_packs_epi32(low, high);
+}
+
+// Same as R16G16B16A16F::average for 2 pixels.
+inline ANGLE_TARGET_SSE2 __m128i AverageRGBA16F(__m128i first, __m128i second)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128 half = _mm_set1_ps(0.5f);
+
+    __m128 low = _mm_mul_ps(_mm_add_ps(HalfToFloat(_mm_unpacklo_epi16(first, zero)),
+                                       HalfToFloat(_mm_unpacklo_epi16(second, zero))), half);
+    __m128 high = _mm_mul_ps(_mm_add_ps(HalfToFloat(_mm_unpackhi_epi16(first, zero)),
+                                        HalfToFloat(_mm_unpackhi_epi16(second, zero))), half);
+    return PackHalves(FloatToHalf(low), FloatToHalf(high));
+}
+
+ANGLE_TARGET_SSE2 void AverageRowsRGBA16F(size_t count, const uint8_t *first, const uint8_t *second, uint8_t *dest)
+{
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2)
+    {
+        StoreUnaligned(dest + i * 8, AverageRGBA16F(LoadUnaligned(first + i * 8), LoadUnaligned(second + i * 8)));
+    }
+    priv::AverageRows<R16G16B16A16F>(count - i, first + i * 8, second + i * 8, dest + i * 8);
+}
+
+ANGLE_TARGET_SSE2 void AveragePairsRGBA16F(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2)
+    {
+        __m128i pixels0 = LoadUnaligned(source + i * 16);
+        __m128i pixels1 = LoadUnaligned(source + i * 16 + 16);
+        StoreUnaligned(dest + i * 8, AverageRGBA16F(_mm_unpacklo_epi64(pixels0, pixels1), _mm_unpackhi_epi64(pixels0, pixels1)));
+    }
+    priv::AveragePairs<R16G16B16A16F>(count - i, source + i * 16, dest + i * 8);
+}
+
+ANGLE_TARGET_SSE2 void AverageRowsRGBA32F(size_t count, const uint8_t *first, const uint8_t *second, uint8_t *dest)
+{
+    const __m128 half = _mm_set1_ps(0.5f);
+    for (size_t i = 0; i < count; i++)
+    {
+        __m128 average = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(reinterpret_cast<const float*>(first + i * 16)),
+                                               _mm_loadu_ps(reinterpret_cast<const float*>(second + i * 16))), half);
+        _mm_storeu_ps(reinterpret_cast<float*>(dest + i * 16), average);
+    }
+}
+
+ANGLE_TARGET_SSE2 void AveragePairsRGBA32F(size_t count, const uint8_t *source, uint8_t *dest)
+{
+    const __m128 half = _mm_set1_ps(0.5f);
+    for (size_t i = 0; i < count; i++)
+    {
+        const float *pair = reinterpret_cast<const float*>(source + i * 32);
+        __m128 average = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(pair), _mm_loadu_ps(pair + 4)), half);
+        _mm_storeu_ps(reinterpret_cast<float*>(dest + i * 16), average);
+    }
+}
+
+const MipRowFunctions kMipRowKernelsSSE2[MIP_ROW_KERNEL_COUNT] =
+{
+    { AverageRowsRGBA8,   AveragePairsRGBA8 },
+    { AverageRowsRGBA16F, AveragePairsRGBA16F },
+    { AverageRowsRGBA32F, AveragePairsRGBA32F },
+};
+
+}
+
+const MipRowFunctions *GetMipRowKernelsSSE2()
+{
+    return kMipRowKernelsSSE2;
+}
+
+#else
+
+const MipRowFunctions *GetMipRowKernelsSSE2()
+{
+    return NULL;
+}
+
+#endif
+
+}
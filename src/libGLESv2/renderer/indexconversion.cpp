@@ -0,0 +1,106 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// indexconversion.cpp: Runtime selection of the index conversion kernels.
+
+#include "libGLESv2/renderer/indexconversion.h"
+
+#include "common/debug.h"
+
+namespace rx
+{
+
+namespace
+{
+
+const IndexConversionKernelInfo kIndexConversionKernelInfo[INDEX_CONVERSION_KERNEL_COUNT] =
+{
+    { "UByteToUShort",  GL_UNSIGNED_BYTE,  GL_UNSIGNED_SHORT },
+    { "UShortToUShort", GL_UNSIGNED_SHORT, GL_UNSIGNED_SHORT },
+    { "UShortToUInt",   GL_UNSIGNED_SHORT, GL_UNSIGNED_INT },
+    { "UIntToUInt",     GL_UNSIGNED_INT,   GL_UNSIGNED_INT },
+};
+
+const IndexConversionFunctions kIndexConversionFunctionsScalar[INDEX_CONVERSION_KERNEL_COUNT] =
+{
+    { priv::ComputeIndexRange<GLubyte>,  priv::ConvertIndices<GLubyte, GLushort> },
+    { priv::ComputeIndexRange<GLushort>, priv::ConvertIndices<GLushort, GLushort> },
+    { priv::ComputeIndexRange<GLushort>, priv::ConvertIndices<GLushort, GLuint> },
+    { priv::ComputeIndexRange<GLuint>,   priv::ConvertIndices<GLuint, GLuint> },
+};
+
+const IndexConversionFunctions *GetIndexConversionFunctionTable(gl::SIMDLevel level)
+{
+    switch (level)
+    {
+      case gl::SIMD_SCALAR: return kIndexConversionFunctionsScalar;
+      case gl::SIMD_SSE2:   return GetIndexConversionFunctionsSSE2();
+      // Unsigned min and max of 16 and 32-bit lanes would only save a bias
+      case gl::SIMD_SSSE3:  return NULL;
+      case gl::SIMD_SSE41:  return NULL;
+      case gl::SIMD_AVX2:   return GetIndexConversionFunctionsAVX2();
+      default: UNREACHABLE(); return NULL;
+    }
+}
+
+}
+
+const IndexConversionKernelInfo &GetIndexConversionKernelInfo(IndexConversionKernel kernel)
+{
+    ASSERT(kernel < INDEX_CONVERSION_KERNEL_COUNT);
+    return kIndexConversionKernelInfo[kernel];
+}
+
+IndexConversionKernel GetIndexConversionKernel(GLenum sourceType, GLenum destinationType)
+{
+    switch (sourceType)
+    {
+      case GL_UNSIGNED_BYTE:
+        ASSERT(destinationType == GL_UNSIGNED_SHORT);
+        return INDEX_CONVERSION_UBYTE_TO_USHORT;
+      case GL_UNSIGNED_SHORT:
+        ASSERT(destinationType == GL_UNSIGNED_SHORT || destinationType == GL_UNSIGNED_INT);
+        return (destinationType == GL_UNSIGNED_INT) ? INDEX_CONVERSION_USHORT_TO_UINT : INDEX_CONVERSION_USHORT_TO_USHORT;
+      case GL_UNSIGNED_INT:
+        ASSERT(destinationType == GL_UNSIGNED_INT);
+        return INDEX_CONVERSION_UINT_TO_UINT;
+      default:
+        UNREACHABLE();
+        return INDEX_CONVERSION_UINT_TO_UINT;
+    }
+}
+
+const IndexConversionFunctions *GetIndexConversionFunctions(IndexConversionKernel kernel, gl::SIMDLevel level)
+{
+    ASSERT(kernel < INDEX_CONVERSION_KERNEL_COUNT);
+    return gl::GetSIMDVersion(GetIndexConversionFunctionTable, kernel, level);
+}
+
+const IndexConversionFunctions &ResolveIndexConversionFunctions(IndexConversionKernel kernel, gl::SIMDLevel maxLevel)
+{
+    ASSERT(kernel < INDEX_CONVERSION_KERNEL_COUNT);
+    return gl::ResolveSIMDVersion(GetIndexConversionFunctionTable, kernel, maxLevel);
+}
+
+const IndexConversionFunctions &GetBestIndexConversionFunctions(IndexConversionKernel kernel)
+{
+    static const gl::BestSIMDVersions<IndexConversionFunctions, INDEX_CONVERSION_KERNEL_COUNT> best(GetIndexConversionFunctionTable);
+    return best[kernel];
+}
+
+RangeUI ComputeIndexRange(GLenum type, const void *indices, size_t count)
+{
+    // Any kernel with this source type
+    GLenum destinationType = (type == GL_UNSIGNED_INT) ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT;
+    return GetBestIndexConversionFunctions(GetIndexConversionKernel(type, destinationType)).computeRange(count, indices);
+}
+
+RangeUI ConvertIndices(GLenum sourceType, GLenum destinationType, const void *input, size_t count, void *output)
+{
+    return GetBestIndexConversionFunctions(GetIndexConversionKernel(sourceType, destinationType)).convert(count, input, output);
+}
+
+}
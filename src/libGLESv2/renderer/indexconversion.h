@@ -0,0 +1,139 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// indexconversion.h: Copies or widens index data into the index buffers of
+// the renderer and computes the range of the indices in the same pass, with
+// runtime selection of vectorized versions.
+
+#ifndef LIBGLESV2_RENDERER_INDEXCONVERSION_H_
+#define LIBGLESV2_RENDERER_INDEXCONVERSION_H_
+
+#include "common/mathutil.h"
+#include "common/simddispatch.h"
+
+#include "angle_gl.h"
+
+namespace rx
+{
+
+// Returns the smallest and largest of |count| indices, or (0, 0) if there
+// are none. The primitive restart index of a type is its largest value, so it
+// is present exactly when it is the end of the range.
+typedef RangeUI (*ComputeIndexRangeFunction)(size_t count, const void *input);
+
+// Writes |count| indices to |output| as the wider or equal destination type
+// and returns their range like ComputeIndexRangeFunction.
+typedef RangeUI (*ConvertIndicesFunction)(size_t count, const void *input, void *output);
+
+struct IndexConversionFunctions
+{
+    ComputeIndexRangeFunction computeRange;
+    ConvertIndicesFunction convert;
+};
+
+// The conversions done by IndexDataManager. computeRange only depends on the
+// source type, so it is the same for every kernel with that source type.
+enum IndexConversionKernel
+{
+    INDEX_CONVERSION_UBYTE_TO_USHORT,
+    INDEX_CONVERSION_USHORT_TO_USHORT,
+    INDEX_CONVERSION_USHORT_TO_UINT,
+    INDEX_CONVERSION_UINT_TO_UINT,
+
+    INDEX_CONVERSION_KERNEL_COUNT
+};
+
+struct IndexConversionKernelInfo
+{
+    const char *name;
+    GLenum sourceType;
+    GLenum destinationType;
+};
+
+const IndexConversionKernelInfo &GetIndexConversionKernelInfo(IndexConversionKernel kernel);
+
+// The kernel converting |sourceType| to |destinationType|, which must be one of
+// the pairs above.
+IndexConversionKernel GetIndexConversionKernel(GLenum sourceType, GLenum destinationType);
+
+// Dispatch of the conversions through common/simddispatch.h.
+const IndexConversionFunctions *GetIndexConversionFunctions(IndexConversionKernel kernel, gl::SIMDLevel level);
+const IndexConversionFunctions &ResolveIndexConversionFunctions(IndexConversionKernel kernel, gl::SIMDLevel maxLevel);
+const IndexConversionFunctions &GetBestIndexConversionFunctions(IndexConversionKernel kernel);
+
+// Per-level tables, indexed by IndexConversionKernel. NULL on other
+// architectures.
+const IndexConversionFunctions *GetIndexConversionFunctionsSSE2();
+const IndexConversionFunctions *GetIndexConversionFunctionsAVX2();
+
+// Shorthands for the best versions.
+RangeUI ComputeIndexRange(GLenum type, const void *indices, size_t count);
+RangeUI ConvertIndices(GLenum sourceType, GLenum destinationType, const void *input, size_t count, void *output);
+
+namespace priv
+{
+
+// Scalar versions, also used for the ends of the vectorized loops.
+template <typename SourceType>
+RangeUI ComputeIndexRange(size_t count, const void *input)
+{
+    if (count == 0)
+    {
+        return RangeUI(0, 0);
+    }
+
+    const SourceType *source = static_cast<const SourceType*>(input);
+    unsigned int minIndex = source[0];
+    unsigned int maxIndex = source[0];
+
+    for (size_t i = 1; i < count; i++)
+    {
+        if (minIndex > source[i]) minIndex = source[i];
+        if (maxIndex < source[i]) maxIndex = source[i];
+    }
+
+    return RangeUI(minIndex, maxIndex);
+}
+
+template <typename SourceType, typename DestinationType>
+RangeUI ConvertIndices(size_t count, const void *input, void *output)
+{
+    if (count == 0)
+    {
+        return RangeUI(0, 0);
+    }
+
+    const SourceType *source = static_cast<const SourceType*>(input);
+    DestinationType *dest = static_cast<DestinationType*>(output);
+    unsigned int minIndex = source[0];
+    unsigned int maxIndex = source[0];
+
+    for (size_t i = 0; i < count; i++)
+    {
+        SourceType index = source[i];
+        if (minIndex > index) minIndex = index;
+        if (maxIndex < index) maxIndex = index;
+        dest[i] = index;
+    }
+
+    return RangeUI(minIndex, maxIndex);
+}
+
+// Combines the range of the vectorized part with the one of the scalar end.
+inline RangeUI MergeIndexRanges(unsigned int minIndex, unsigned int maxIndex, size_t tailCount, const RangeUI &tail)
+{
+    if (tailCount == 0)
+    {
+        return RangeUI(minIndex, maxIndex);
+    }
+    return RangeUI(std::min(minIndex, tail.start), std::max(maxIndex, tail.end));
+}
+
+}
+
+}
+
+#endif // LIBGLESV2_RENDERER_INDEXCONVERSION_H_
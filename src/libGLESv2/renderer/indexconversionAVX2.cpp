@@ -0,0 +1,204 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// indexconversionAVX2.cpp: Index conversion and range computation using
+// 256-bit instructions, with unsigned min and max for every index size.
+
+#include "libGLESv2/renderer/indexconversion.h"
+
+#if defined(ANGLE_CPU_X86)
+#   include <immintrin.h>
+#endif
+
+namespace rx
+{
+
+#if defined(ANGLE_CPU_X86)
+
+namespace
+{
+
+inline ANGLE_TARGET_AVX2 __m256i LoadUnaligned(const void *source)
+{
+    return _mm256_loadu_si256(static_cast<const __m256i*>(source));
+}
+
+inline ANGLE_TARGET_AVX2 void StoreUnaligned(void *dest, __m256i value)
+{
+    _mm256_storeu_si256(static_cast<__m256i*>(dest), value);
+}
+
+// The rest of the indices go through the SSE2 version.
+inline RangeUI ProcessTail(IndexConversionKernel kernel, bool convert, size_t count, const void *input, void *output)
+{
+    const IndexConversionFunctions &functions = GetIndexConversionFunctionsSSE2()[kernel];
+    return convert ? functions.convert(count, input, output) : functions.computeRange(count, input);
+}
+
+// 32 indices at a time. Without |Convert|, only the range is computed.
+template <bool Convert>
+ANGLE_TARGET_AVX2 RangeUI ProcessUByteToUShort(size_t count, const void *input, void *output)
+{
+    const GLubyte *source = static_cast<const GLubyte*>(input);
+    GLushort *dest = static_cast<GLushort*>(output);
+    size_t vectorCount = count - count % 32;
+    if (vectorCount == 0)
+    {
+        return ProcessTail(INDEX_CONVERSION_UBYTE_TO_USHORT, Convert, count, source, dest);
+    }
+
+    __m256i minIndices = _mm256_set1_epi8(-1);
+    __m256i maxIndices = _mm256_setzero_si256();
+    for (size_t i = 0; i < vectorCount; i += 32)
+    {
+        __m256i indices = LoadUnaligned(source + i);
+        minIndices = _mm256_min_epu8(minIndices, indices);
+        maxIndices = _mm256_max_epu8(maxIndices, indices);
+        if (Convert)
+        {
+            StoreUnaligned(dest + i, _mm256_cvtepu8_epi16(_mm256_castsi256_si128(indices)));
+            StoreUnaligned(dest + i + 16, _mm256_cvtepu8_epi16(_mm256_extracti128_si256(indices, 1)));
+        }
+    }
+
+    GLubyte minLanes[32];
+    GLubyte maxLanes[32];
+    StoreUnaligned(minLanes, minIndices);
+    StoreUnaligned(maxLanes, maxIndices);
+    RangeUI lanes = priv::ComputeIndexRange<GLubyte>(32, minLanes);
+    unsigned int maxIndex = priv::ComputeIndexRange<GLubyte>(32, maxLanes).end;
+
+    size_t tailCount = count - vectorCount;
+    RangeUI tail = ProcessTail(INDEX_CONVERSION_UBYTE_TO_USHORT, Convert, tailCount, source + vectorCount,
+                               Convert ? dest + vectorCount : NULL);
+    return priv::MergeIndexRanges(lanes.start, maxIndex, tailCount, tail);
+}
+
+// 16 indices at a time.
+template <bool Convert, typename DestinationType>
+ANGLE_TARGET_AVX2 RangeUI ProcessUShort(size_t count, const void *input, void *output)
+{
+    const IndexConversionKernel kernel = (sizeof(DestinationType) == 2) ? INDEX_CONVERSION_USHORT_TO_USHORT
+                                                                        : INDEX_CONVERSION_USHORT_TO_UINT;
+    const GLushort *source = static_cast<const GLushort*>(input);
+    DestinationType *dest = static_cast<DestinationType*>(output);
+    size_t vectorCount = count - count % 16;
+    if (vectorCount == 0)
+    {
+        return ProcessTail(kernel, Convert, count, source, dest);
+    }
+
+    __m256i minIndices = _mm256_set1_epi16(-1);
+    __m256i maxIndices = _mm256_setzero_si256();
+    for (size_t i = 0; i < vectorCount; i += 16)
+    {
+        __m256i indices = LoadUnaligned(source + i);
+        minIndices = _mm256_min_epu16(minIndices, indices);
+        maxIndices = _mm256_max_epu16(maxIndices, indices);
+        if (Convert)
+        {
+            if (sizeof(DestinationType) == 2)
+            {
+                StoreUnaligned(dest + i, indices);
+            }
+            else
+            {
+                StoreUnaligned(dest + i, _mm256_cvtepu16_epi32(_mm256_castsi256_si128(indices)));
+                StoreUnaligned(dest + i + 8, _mm256_cvtepu16_epi32(_mm256_extracti128_si256(indices, 1)));
+            }
+        }
+    }
+
+    GLushort minLanes[16];
+    GLushort maxLanes[16];
+    StoreUnaligned(minLanes, minIndices);
+    StoreUnaligned(maxLanes, maxIndices);
+    RangeUI lanes = priv::ComputeIndexRange<GLushort>(16, minLanes);
+    unsigned int maxIndex = priv::ComputeIndexRange<GLushort>(16, maxLanes).end;
+
+    size_t tailCount = count - vectorCount;
+    RangeUI tail = ProcessTail(kernel, Convert, tailCount, source + vectorCount, Convert ? dest + vectorCount : NULL);
+    return priv::MergeIndexRanges(lanes.start, maxIndex, tailCount, tail);
+}
+
+// 8 indices at a time.
+template <bool Convert>
+ANGLE_TARGET_AVX2 RangeUI ProcessUIntToUInt(size_t count, const void *input, void *output)
+{
+    const GLuint *source = static_cast<const GLuint*>(input);
+    GLuint *dest = static_cast<GLuint*>(output);
+    size_t vectorCount = count - count % 8;
+    if (vectorCount == 0)
+    {
+        return ProcessTail(INDEX_CONVERSION_UINT_TO_UINT, Convert, count, source, dest);
+    }
+
+    __m256i minIndices = _mm256_set1_epi32(-1);
+    __m256i maxIndices = _mm256_setzero_si256();
+    for (size_t i = 0; i < vectorCount; i += 8)
+    {
+        __m256i indices = LoadUnaligned(source + i);
+        minIndices = _mm256_min_epu32(minIndices, indices);
+        maxIndices = _mm256_max_epu32(maxIndices, indices);
+        if (Convert)
+        {
+            StoreUnaligned(dest + i, indices);
+        }
+    }
+
+    GLuint minLanes[8];
+    GLuint maxLanes[8];
+    StoreUnaligned(minLanes, minIndices);
+    StoreUnaligned(maxLanes, maxIndices);
+    RangeUI lanes = priv::ComputeIndexRange<GLuint>(8, minLanes);
+    unsigned int maxIndex = priv::ComputeIndexRange<GLuint>(8, maxLanes).end;
+
+    size_t tailCount = count - vectorCount;
+    RangeUI tail = ProcessTail(INDEX_CONVERSION_UINT_TO_UINT, Convert, tailCount, source + vectorCount,
+                               Convert ? dest + vectorCount : NULL);
+    return priv::MergeIndexRanges(lanes.start, maxIndex, tailCount, tail);
+}
+
+ANGLE_TARGET_AVX2 RangeUI ComputeRangeUByte(size_t count, const void *input)
+{
+    return ProcessUByteToUShort<false>(count, input, NULL);
+}
+
+ANGLE_TARGET_AVX2 RangeUI ComputeRangeUShort(size_t count, const void *input)
+{
+    return ProcessUShort<false, GLushort>(count, input, NULL);
+}
+
+ANGLE_TARGET_AVX2 RangeUI ComputeRangeUInt(size_t count, const void *input)
+{
+    return ProcessUIntToUInt<false>(count, input, NULL);
+}
+
+const IndexConversionFunctions kIndexConversionFunctionsAVX2[INDEX_CONVERSION_KERNEL_COUNT] =
+{
+    { ComputeRangeUByte,  ProcessUByteToUShort<true> },
+    { ComputeRangeUShort, ProcessUShort<true, GLushort> },
+    { ComputeRangeUShort, ProcessUShort<true, GLuint> },
+    { ComputeRangeUInt,   ProcessUIntToUInt<true> },
+};
+
+}
+
+const IndexConversionFunctions *GetIndexConversionFunctionsAVX2()
+{
+    return kIndexConversionFunctionsAVX2;
+}
+
+#else
+
+const IndexConversionFunctions *GetIndexConversionFunctionsAVX2()
+{
+    return NULL;
+}
+
+#endif
+
+}
@@ -0,0 +1,219 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// indexconversionSSE2.cpp: Index conversion and range computation using
+// 128-bit instructions. SSE2 only has unsigned min and max for bytes, so wider
+// indices are biased to signed values first.
+
+#include "libGLESv2/renderer/indexconversion.h"
+
+#if defined(ANGLE_CPU_X86)
+#   include <emmintrin.h>
+#endif
+
+namespace rx
+{
+
+#if defined(ANGLE_CPU_X86)
+
+namespace
+{
+
+inline ANGLE_TARGET_SSE2 __m128i LoadUnaligned(const void *source)
+{
+    return _mm_loadu_si128(static_cast<const __m128i*>(source));
+}
+
+inline ANGLE_TARGET_SSE2 void StoreUnaligned(void *dest, __m128i value)
+{
+    _mm_storeu_si128(static_cast<__m128i*>(dest), value);
+}
+
+// Signed 32-bit min and max, which SSE2 doesn't have either.
+inline ANGLE_TARGET_SSE2 __m128i Min32(__m128i a, __m128i b)
+{
+    __m128i greater = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(greater, b), _mm_andnot_si128(greater, a));
+}
+
+inline ANGLE_TARGET_SSE2 __m128i Max32(__m128i a, __m128i b)
+{
+    __m128i greater = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(greater, a), _mm_andnot_si128(greater, b));
+}
+
+// 16 indices at a time. Without |Convert|, only the range is computed.
+template <bool Convert>
+ANGLE_TARGET_SSE2 RangeUI ProcessUByteToUShort(size_t count, const void *input, void *output)
+{
+    const GLubyte *source = static_cast<const GLubyte*>(input);
+    GLushort *dest = static_cast<GLushort*>(output);
+    size_t vectorCount = count - count % 16;
+    if (vectorCount == 0)
+    {
+        return Convert ? priv::ConvertIndices<GLubyte, GLushort>(count, source, dest)
+                       : priv::ComputeIndexRange<GLubyte>(count, source);
+    }
+
+    const __m128i zero = _mm_setzero_si128();
+    __m128i minIndices = _mm_set1_epi8(-1);
+    __m128i maxIndices = zero;
+    for (size_t i = 0; i < vectorCount; i += 16)
+    {
+        __m128i indices = LoadUnaligned(source + i);
+        minIndices = _mm_min_epu8(minIndices, indices);
+        maxIndices = _mm_max_epu8(maxIndices, indices);
+        if (Convert)
+        {
+            StoreUnaligned(dest + i, _mm_unpacklo_epi8(indices, zero));
+            StoreUnaligned(dest + i + 8, _mm_unpackhi_epi8(indices, zero));
+        }
+    }
+
+    GLubyte minLanes[16];
+    GLubyte maxLanes[16];
+    StoreUnaligned(minLanes, minIndices);
+    StoreUnaligned(maxLanes, maxIndices);
+    RangeUI lanes = priv::ComputeIndexRange<GLubyte>(16, minLanes);
+    unsigned int maxIndex = priv::ComputeIndexRange<GLubyte>(16, maxLanes).end;
+
+    size_t tailCount = count - vectorCount;
+    RangeUI tail = Convert ? priv::ConvertIndices<GLubyte, GLushort>(tailCount, source + vectorCount, dest + vectorCount)
+                           : priv::ComputeIndexRange<GLubyte>(tailCount, source + vectorCount);
+    return priv::MergeIndexRanges(lanes.start, maxIndex, tailCount, tail);
+}
+
+// 8 indices at a time, compared after flipping the sign bit.
+template <bool Convert, typename DestinationType>
+ANGLE_TARGET_SSE2 RangeUI ProcessUShort(size_t count, const void *input, void *output)
+{
+    const GLushort *source = static_cast<const GLushort*>(input);
+    DestinationType *dest = static_cast<DestinationType*>(output);
+    size_t vectorCount = count - count % 8;
+    if (vectorCount == 0)
+    {
+        return Convert ? priv::ConvertIndices<GLushort, DestinationType>(count, source, dest)
+                       : priv::ComputeIndexRange<GLushort>(count, source);
+    }
+
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i bias = _mm_set1_epi16(-0x8000);
+    __m128i minIndices = _mm_set1_epi16(0x7FFF);
+    __m128i maxIndices = bias;
+    for (size_t i = 0; i < vectorCount; i += 8)
+    {
+        __m128i indices = LoadUnaligned(source + i);
+        __m128i biased = _mm_xor_si128(indices, bias);
+        minIndices = _mm_min_epi16(minIndices, biased);
+        maxIndices = _mm_max_epi16(maxIndices, biased);
+        if (Convert)
+        {
+            if (sizeof(DestinationType) == 2)
+            {
+                StoreUnaligned(dest + i, indices);
+            }
+            else
+            {
+                StoreUnaligned(dest + i, _mm_unpacklo_epi16(indices, zero));
+                StoreUnaligned(dest + i + 4, _mm_unpackhi_epi16(indices, zero));
+            }
+        }
+    }
+
+    GLushort minLanes[8];
+    GLushort maxLanes[8];
+    StoreUnaligned(minLanes, _mm_xor_si128(minIndices, bias));
+    StoreUnaligned(maxLanes, _mm_xor_si128(maxIndices, bias));
+    RangeUI lanes = priv::ComputeIndexRange<GLushort>(8, minLanes);
+    unsigned int maxIndex = priv::ComputeIndexRange<GLushort>(8, maxLanes).end;
+
+    size_t tailCount = count - vectorCount;
+    RangeUI tail = Convert ? priv::ConvertIndices<GLushort, DestinationType>(tailCount, source + vectorCount, dest + vectorCount)
+                           : priv::ComputeIndexRange<GLushort>(tailCount, source + vectorCount);
+    return priv::MergeIndexRanges(lanes.start, maxIndex, tailCount, tail);
+}
+
+// 4 indices at a time, compared after flipping the sign bit.
+template <bool Convert>
+ANGLE_TARGET_SSE2 RangeUI ProcessUIntToUInt(size_t count, const void *input, void *output)
+{
+    const GLuint *source = static_cast<const GLuint*>(input);
+    GLuint *dest = static_cast<GLuint*>(output);
+    size_t vectorCount = count - count % 4;
+    if (vectorCount == 0)
+    {
+        return Convert ? priv::ConvertIndices<GLuint, GLuint>(count, source, dest)
+                       : priv::ComputeIndexRange<GLuint>(count, source);
+    }
+
+    const __m128i bias = _mm_set1_epi32(static_cast<int>(0x80000000));
+    __m128i minIndices = _mm_set1_epi32(0x7FFFFFFF);
+    __m128i maxIndices = bias;
+    for (size_t i = 0; i < vectorCount; i += 4)
+    {
+        __m128i indices = LoadUnaligned(source + i);
+        __m128i biased = _mm_xor_si128(indices, bias);
+        minIndices = Min32(minIndices, biased);
+        maxIndices = Max32(maxIndices, biased);
+        if (Convert)
+        {
+            StoreUnaligned(dest + i, indices);
+        }
+    }
+
+    GLuint minLanes[4];
+    GLuint maxLanes[4];
+    StoreUnaligned(minLanes, _mm_xor_si128(minIndices, bias));
+    StoreUnaligned(maxLanes, _mm_xor_si128(maxIndices, bias));
+    RangeUI lanes = priv::ComputeIndexRange<GLuint>(4, minLanes);
+    unsigned int maxIndex = priv::ComputeIndexRange<GLuint>(4, maxLanes).end;
+
+    size_t tailCount = count - vectorCount;
+    RangeUI tail = Convert ? priv::ConvertIndices<GLuint, GLuint>(tailCount, source + vectorCount, dest + vectorCount)
+                           : priv::ComputeIndexRange<GLuint>(tailCount, source + vectorCount);
+    return priv::MergeIndexRanges(lanes.start, maxIndex, tailCount, tail);
+}
+
+ANGLE_TARGET_SSE2 RangeUI ComputeRangeUByte(size_t count, const void *input)
+{
+    return ProcessUByteToUShort<false>(count, input, NULL);
+}
+
+ANGLE_TARGET_SSE2 RangeUI ComputeRangeUShort(size_t count, const void *input)
+{
+    return ProcessUShort<false, GLushort>(count, input, NULL);
+}
+
+ANGLE_TARGET_SSE2 RangeUI ComputeRangeUInt(size_t count, const void *input)
+{
+    return ProcessUIntToUInt<false>(count, input, NULL);
+}
+
+const IndexConversionFunctions kIndexConversionFunctionsSSE2[INDEX_CONVERSION_KERNEL_COUNT] =
+{
+    { ComputeRangeUByte,  ProcessUByteToUShort<true> },
+    { ComputeRangeUShort, ProcessUShort<true, GLushort> },
+    { ComputeRangeUShort, ProcessUShort<true, GLuint> },
+    { ComputeRangeUInt,   ProcessUIntToUInt<true> },
+};
+
+}
+
+const IndexConversionFunctions *GetIndexConversionFunctionsSSE2()
+{
+    return kIndexConversionFunctionsSSE2;
+}
+
+#else
+
+const IndexConversionFunctions *GetIndexConversionFunctionsSSE2()
+{
+    return NULL;
+}
+
+#endif
+
+}
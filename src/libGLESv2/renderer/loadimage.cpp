@@ -7,13 +7,14 @@
 // loadimage.cpp: Defines image loading functions.
 
 #include "libGLESv2/renderer/loadimage.h"
+#include "libGLESv2/renderer/loadimageSIMD.h"
 
 namespace rx
 {
 
-void LoadA8ToRGBA8(size_t width, size_t height, size_t depth,
-                   const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
-                   uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+static void LoadA8ToRGBA8_Scalar(size_t width, size_t height, size_t depth,
+                                 const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                                 uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
 {
     for (size_t z = 0; z < depth; z++)
     {
@@ -29,14 +30,6 @@ void LoadA8ToRGBA8(size_t width, size_t height, size_t depth,
     }
 }
 
-void LoadA8ToBGRA8(size_t width, size_t height, size_t depth,
-                   const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
-                   uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
-{
-    // Same as loading to RGBA
-    LoadA8ToRGBA8(width, height, depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch);
-}
-
 void LoadA32FToRGBA32F(size_t width, size_t height, size_t depth,
                        const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
                        uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
@@ -79,9 +72,9 @@ void LoadA16FToRGBA16F(size_t width, size_t height, size_t depth,
     }
 }
 
-void LoadL8ToRGBA8(size_t width, size_t height, size_t depth,
-                   const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
-                   uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+static void LoadL8ToRGBA8_Scalar(size_t width, size_t height, size_t depth,
+                                 const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                                 uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
 {
     for (size_t z = 0; z < depth; z++)
     {
@@ -100,14 +93,6 @@ void LoadL8ToRGBA8(size_t width, size_t height, size_t depth,
     }
 }
 
-void LoadL8ToBGRA8(size_t width, size_t height, size_t depth,
-                   const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
-                   uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
-{
-    // Same as loading to RGBA
-    LoadL8ToRGBA8(width, height, depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch);
-}
-
 void LoadL32FToRGBA32F(size_t width, size_t height, size_t depth,
                        const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
                        uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
@@ -150,9 +135,9 @@ void LoadL16FToRGBA16F(size_t width, size_t height, size_t depth,
     }
 }
 
-void LoadLA8ToRGBA8(size_t width, size_t height, size_t depth,
-                    const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
-                    uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+static void LoadLA8ToRGBA8_Scalar(size_t width, size_t height, size_t depth,
+                                  const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                                  uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
 {
     for (size_t z = 0; z < depth; z++)
     {
@@ -171,14 +156,6 @@ void LoadLA8ToRGBA8(size_t width, size_t height, size_t depth,
     }
 }
 
-void LoadLA8ToBGRA8(size_t width, size_t height, size_t depth,
-                    const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
-                    uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
-{
-    // Same as loading to RGBA
-    LoadLA8ToRGBA8(width, height, depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch);
-}
-
 void LoadLA32FToRGBA32F(size_t width, size_t height, size_t depth,
                         const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
                         uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
@@ -221,9 +198,9 @@ void LoadLA16FToRGBA16F(size_t width, size_t height, size_t depth,
     }
 }
 
-void LoadRGB8ToBGRX8(size_t width, size_t height, size_t depth,
-                     const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
-                     uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+static void LoadRGB8ToBGRX8_Scalar(size_t width, size_t height, size_t depth,
+                                   const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                                   uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
 {
     for (size_t z = 0; z < depth; z++)
     {
@@ -242,9 +219,9 @@ void LoadRGB8ToBGRX8(size_t width, size_t height, size_t depth,
     }
 }
 
-void LoadRG8ToBGRX8(size_t width, size_t height, size_t depth,
-                    const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
-                    uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+static void LoadRG8ToBGRX8_Scalar(size_t width, size_t height, size_t depth,
+                                  const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                                  uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
 {
     for (size_t z = 0; z < depth; z++)
     {
@@ -263,9 +240,9 @@ void LoadRG8ToBGRX8(size_t width, size_t height, size_t depth,
     }
 }
 
-void LoadR8ToBGRX8(size_t width, size_t height, size_t depth,
-                   const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
-                   uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+static void LoadR8ToBGRX8_Scalar(size_t width, size_t height, size_t depth,
+                                 const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                                 uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
 {
     for (size_t z = 0; z < depth; z++)
     {
@@ -284,9 +261,9 @@ void LoadR8ToBGRX8(size_t width, size_t height, size_t depth,
     }
 }
 
-void LoadR5G6B5ToBGRA8(size_t width, size_t height, size_t depth,
-                       const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
-                       uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+static void LoadR5G6B5ToBGRA8_Scalar(size_t width, size_t height, size_t depth,
+                                     const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                                     uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
 {
     for (size_t z = 0; z < depth; z++)
     {
@@ -306,9 +283,9 @@ void LoadR5G6B5ToBGRA8(size_t width, size_t height, size_t depth,
     }
 }
 
-void LoadR5G6B5ToRGBA8(size_t width, size_t height, size_t depth,
-                       const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
-                       uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+static void LoadR5G6B5ToRGBA8_Scalar(size_t width, size_t height, size_t depth,
+                                     const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                                     uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
 {
     for (size_t z = 0; z < depth; z++)
     {
@@ -328,9 +305,9 @@ void LoadR5G6B5ToRGBA8(size_t width, size_t height, size_t depth,
     }
 }
 
-void LoadRGBA8ToBGRA8(size_t width, size_t height, size_t depth,
-                      const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
-                      uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+static void LoadRGBA8ToBGRA8_Scalar(size_t width, size_t height, size_t depth,
+                                    const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                                    uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
 {
     for (size_t z = 0; z < depth; z++)
     {
@@ -341,15 +318,15 @@ void LoadRGBA8ToBGRA8(size_t width, size_t height, size_t depth,
             for (size_t x = 0; x < width; x++)
             {
                 uint32_t rgba = source[x];
-                dest[x] = (_rotl(rgba, 16) & 0x00ff00ff) | (rgba & 0xff00ff00);
+                dest[x] = (((rgba << 16) | (rgba >> 16)) & 0x00ff00ff) | (rgba & 0xff00ff00);
             }
         }
     }
 }
 
-void LoadRGBA4ToBGRA8(size_t width, size_t height, size_t depth,
-                      const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
-                      uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+static void LoadRGBA4ToBGRA8_Scalar(size_t width, size_t height, size_t depth,
+                                    const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                                    uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
 {
     for (size_t z = 0; z < depth; z++)
     {
@@ -369,9 +346,9 @@ void LoadRGBA4ToBGRA8(size_t width, size_t height, size_t depth,
     }
 }
 
-void LoadRGBA4ToRGBA8(size_t width, size_t height, size_t depth,
-                      const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
-                      uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+static void LoadRGBA4ToRGBA8_Scalar(size_t width, size_t height, size_t depth,
+                                    const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                                    uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
 {
     for (size_t z = 0; z < depth; z++)
     {
@@ -391,31 +368,9 @@ void LoadRGBA4ToRGBA8(size_t width, size_t height, size_t depth,
     }
 }
 
-void LoadBGRA4ToBGRA8(size_t width, size_t height, size_t depth,
-                      const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
-                      uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
-{
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y++)
-        {
-            const uint16_t *source = OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
-            uint8_t *dest = OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
-            {
-                uint16_t bgra = source[x];
-                dest[4 * x + 0] = ((bgra & 0xF000) >> 8) | ((bgra & 0xF000) >> 12);
-                dest[4 * x + 1] = ((bgra & 0x0F00) >> 4) | ((bgra & 0x0F00) >> 8);
-                dest[4 * x + 2] = ((bgra & 0x00F0) << 0) | ((bgra & 0x00F0) >> 4);
-                dest[4 * x + 3] = ((bgra & 0x000F) << 4) | ((bgra & 0x000F) >> 0);
-            }
-        }
-    }
-}
-
-void LoadRGB5A1ToBGRA8(size_t width, size_t height, size_t depth,
-                       const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
-                       uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+static void LoadRGB5A1ToBGRA8_Scalar(size_t width, size_t height, size_t depth,
+                                     const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                                     uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
 {
     for (size_t z = 0; z < depth; z++)
     {
@@ -435,9 +390,9 @@ void LoadRGB5A1ToBGRA8(size_t width, size_t height, size_t depth,
     }
 }
 
-void LoadRGB5A1ToRGBA8(size_t width, size_t height, size_t depth,
-                       const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
-                       uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+static void LoadRGB5A1ToRGBA8_Scalar(size_t width, size_t height, size_t depth,
+                                     const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                                     uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
 {
     for (size_t z = 0; z < depth; z++)
     {
@@ -457,32 +412,9 @@ void LoadRGB5A1ToRGBA8(size_t width, size_t height, size_t depth,
     }
 }
 
-
-void LoadBGR5A1ToBGRA8(size_t width, size_t height, size_t depth,
-                       const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
-                       uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
-{
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y++)
-        {
-            const uint16_t *source = OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
-            uint8_t *dest = OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
-            {
-                uint16_t bgra = source[x];
-                dest[4 * x + 0] = ((bgra & 0xF800) >> 8) | ((bgra & 0xF800) >> 13);
-                dest[4 * x + 1] = ((bgra & 0x07C0) >> 3) | ((bgra & 0x07C0) >> 8);
-                dest[4 * x + 2] = ((bgra & 0x003E) << 2) | ((bgra & 0x003E) >> 3);
-                dest[4 * x + 3] = (bgra & 0x0001) ? 0xFF : 0;
-            }
-        }
-    }
-}
-
-void LoadRGB10A2ToRGBA8(size_t width, size_t height, size_t depth,
-                        const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
-                        uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+static void LoadRGB10A2ToRGBA8_Scalar(size_t width, size_t height, size_t depth,
+                                      const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                                      uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
 {
     for (size_t z = 0; z < depth; z++)
     {
@@ -506,17 +438,21 @@ void LoadRGB16FToRGB9E5(size_t width, size_t height, size_t depth,
                         const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
                         uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
 {
+    // Rows are converted to floats a chunk at a time
+    const size_t chunkWidth = 256;
+    float floats[chunkWidth * 3];
+
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
         {
             const uint16_t *source = OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest = OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = 0; x < width; x += chunkWidth)
             {
-                dest[x] = gl::convertRGBFloatsTo999E5(gl::float16ToFloat32(source[x * 3 + 0]),
-                                                      gl::float16ToFloat32(source[x * 3 + 1]),
-                                                      gl::float16ToFloat32(source[x * 3 + 2]));
+                size_t count = std::min(chunkWidth, width - x);
+                gl::ConvertFloat16ToFloat32(&source[x * 3], floats, count * 3);
+                gl::ConvertFloat32ToRGB9E5(floats, &dest[x], count);
             }
         }
     }
@@ -532,10 +468,7 @@ void LoadRGB32FToRGB9E5(size_t width, size_t height, size_t depth,
         {
             const float *source = OffsetDataPointer<float>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest = OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
-            {
-                dest[x] = gl::convertRGBFloatsTo999E5(source[x * 3 + 0], source[x * 3 + 1], source[x * 3 + 2]);
-            }
+            gl::ConvertFloat32ToRGB9E5(source, dest, width);
         }
     }
 }
@@ -544,17 +477,21 @@ void LoadRGB16FToRG11B10F(size_t width, size_t height, size_t depth,
                           const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
                           uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
 {
+    // Rows are converted to floats a chunk at a time
+    const size_t chunkWidth = 256;
+    float floats[chunkWidth * 3];
+
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
         {
             const uint16_t *source = OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest = OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = 0; x < width; x += chunkWidth)
             {
-                dest[x] = (gl::float32ToFloat11(gl::float16ToFloat32(source[x * 3 + 0])) <<  0) |
-                          (gl::float32ToFloat11(gl::float16ToFloat32(source[x * 3 + 1])) << 11) |
-                          (gl::float32ToFloat10(gl::float16ToFloat32(source[x * 3 + 2])) << 22);
+                size_t count = std::min(chunkWidth, width - x);
+                gl::ConvertFloat16ToFloat32(&source[x * 3], floats, count * 3);
+                gl::ConvertFloat32ToR11G11B10F(floats, &dest[x], count);
             }
         }
     }
@@ -570,12 +507,7 @@ void LoadRGB32FToRG11B10F(size_t width, size_t height, size_t depth,
         {
             const float *source = OffsetDataPointer<float>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest = OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
-            {
-                dest[x] = (gl::float32ToFloat11(source[x * 3 + 0]) <<  0) |
-                          (gl::float32ToFloat11(source[x * 3 + 1]) << 11) |
-                          (gl::float32ToFloat10(source[x * 3 + 2]) << 22);
-            }
+            gl::ConvertFloat32ToR11G11B10F(source, dest, width);
         }
     }
 }
@@ -604,18 +536,27 @@ void LoadRGB32FToRGBA16F(size_t width, size_t height, size_t depth,
                          const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
                          uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
 {
+    // Rows are converted to half floats a chunk at a time, then padded
+    const size_t chunkWidth = 256;
+    uint16_t halfs[chunkWidth * 3];
+
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
         {
             const float *source = OffsetDataPointer<float>(input, y, z, inputRowPitch, inputDepthPitch);
             uint16_t *dest = OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = 0; x < width; x += chunkWidth)
             {
-                dest[x * 4 + 0] = gl::float32ToFloat16(source[x * 3 + 0]);
-                dest[x * 4 + 1] = gl::float32ToFloat16(source[x * 3 + 1]);
-                dest[x * 4 + 2] = gl::float32ToFloat16(source[x * 3 + 2]);
-                dest[x * 4 + 3] = gl::Float16One;
+                size_t count = std::min(chunkWidth, width - x);
+                gl::ConvertFloat32ToFloat16(&source[x * 3], halfs, count * 3);
+                for (size_t i = 0; i < count; i++)
+                {
+                    dest[(x + i) * 4 + 0] = halfs[i * 3 + 0];
+                    dest[(x + i) * 4 + 1] = halfs[i * 3 + 1];
+                    dest[(x + i) * 4 + 2] = halfs[i * 3 + 2];
+                    dest[(x + i) * 4 + 3] = gl::Float16One;
+                }
             }
         }
     }
@@ -658,4 +599,176 @@ void LoadR32ToR24G8(size_t width, size_t height, size_t depth,
     }
 }
 
+
+static const LoadImageFunction kLoadImageKernelsScalar[LOAD_IMAGE_KERNEL_COUNT] =
+{
+    LoadA8ToRGBA8_Scalar,
+    LoadL8ToRGBA8_Scalar,
+    LoadLA8ToRGBA8_Scalar,
+    LoadR8ToBGRX8_Scalar,
+    LoadRG8ToBGRX8_Scalar,
+    LoadRGB8ToBGRX8_Scalar,
+    LoadToNative3To4<uint8_t, 0xFF>,
+    LoadRGBA8ToBGRA8_Scalar,
+    LoadR5G6B5ToBGRA8_Scalar,
+    LoadR5G6B5ToRGBA8_Scalar,
+    LoadRGBA4ToBGRA8_Scalar,
+    LoadRGBA4ToRGBA8_Scalar,
+    LoadRGB5A1ToBGRA8_Scalar,
+    LoadRGB5A1ToRGBA8_Scalar,
+    LoadRGB10A2ToRGBA8_Scalar,
+};
+
+const LoadImageFunction *GetLoadImageKernelsScalar()
+{
+    return kLoadImageKernelsScalar;
+}
+
+// The functions below run the best version of their kernel for the CPU.
+
+void LoadA8ToRGBA8(size_t width, size_t height, size_t depth,
+                   const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                   uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    GetBestLoadImageKernel(LOAD_IMAGE_A8_TO_RGBA8)(width, height, depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadA8ToBGRA8(size_t width, size_t height, size_t depth,
+                   const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                   uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    // Same as loading to RGBA
+    GetBestLoadImageKernel(LOAD_IMAGE_A8_TO_RGBA8)(width, height, depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadL8ToRGBA8(size_t width, size_t height, size_t depth,
+                   const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                   uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    GetBestLoadImageKernel(LOAD_IMAGE_L8_TO_RGBA8)(width, height, depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadL8ToBGRA8(size_t width, size_t height, size_t depth,
+                   const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                   uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    // Same as loading to RGBA
+    GetBestLoadImageKernel(LOAD_IMAGE_L8_TO_RGBA8)(width, height, depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadLA8ToRGBA8(size_t width, size_t height, size_t depth,
+                    const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                    uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    GetBestLoadImageKernel(LOAD_IMAGE_LA8_TO_RGBA8)(width, height, depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadLA8ToBGRA8(size_t width, size_t height, size_t depth,
+                    const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                    uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    // Same as loading to RGBA
+    GetBestLoadImageKernel(LOAD_IMAGE_LA8_TO_RGBA8)(width, height, depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadR8ToBGRX8(size_t width, size_t height, size_t depth,
+                   const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                   uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    GetBestLoadImageKernel(LOAD_IMAGE_R8_TO_BGRX8)(width, height, depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadRG8ToBGRX8(size_t width, size_t height, size_t depth,
+                    const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                    uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    GetBestLoadImageKernel(LOAD_IMAGE_RG8_TO_BGRX8)(width, height, depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadRGB8ToBGRX8(size_t width, size_t height, size_t depth,
+                     const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                     uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    GetBestLoadImageKernel(LOAD_IMAGE_RGB8_TO_BGRX8)(width, height, depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadRGB8ToRGBX8(size_t width, size_t height, size_t depth,
+                     const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                     uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    GetBestLoadImageKernel(LOAD_IMAGE_RGB8_TO_RGBX8)(width, height, depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadRGBA8ToBGRA8(size_t width, size_t height, size_t depth,
+                      const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                      uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    GetBestLoadImageKernel(LOAD_IMAGE_RGBA8_TO_BGRA8)(width, height, depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadR5G6B5ToBGRA8(size_t width, size_t height, size_t depth,
+                       const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                       uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    GetBestLoadImageKernel(LOAD_IMAGE_R5G6B5_TO_BGRA8)(width, height, depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadR5G6B5ToRGBA8(size_t width, size_t height, size_t depth,
+                       const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                       uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    GetBestLoadImageKernel(LOAD_IMAGE_R5G6B5_TO_RGBA8)(width, height, depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadRGBA4ToBGRA8(size_t width, size_t height, size_t depth,
+                      const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                      uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    GetBestLoadImageKernel(LOAD_IMAGE_RGBA4_TO_BGRA8)(width, height, depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadRGBA4ToRGBA8(size_t width, size_t height, size_t depth,
+                      const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                      uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    GetBestLoadImageKernel(LOAD_IMAGE_RGBA4_TO_RGBA8)(width, height, depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadBGRA4ToBGRA8(size_t width, size_t height, size_t depth,
+                      const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                      uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    // Same as loading RGBA4 to RGBA8
+    GetBestLoadImageKernel(LOAD_IMAGE_RGBA4_TO_RGBA8)(width, height, depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadRGB5A1ToBGRA8(size_t width, size_t height, size_t depth,
+                       const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                       uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    GetBestLoadImageKernel(LOAD_IMAGE_RGB5A1_TO_BGRA8)(width, height, depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadRGB5A1ToRGBA8(size_t width, size_t height, size_t depth,
+                       const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                       uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    GetBestLoadImageKernel(LOAD_IMAGE_RGB5A1_TO_RGBA8)(width, height, depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadBGR5A1ToBGRA8(size_t width, size_t height, size_t depth,
+                       const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                       uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    // Same as loading RGB5A1 to RGBA8
+    GetBestLoadImageKernel(LOAD_IMAGE_RGB5A1_TO_RGBA8)(width, height, depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadRGB10A2ToRGBA8(size_t width, size_t height, size_t depth,
+                        const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                        uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    GetBestLoadImageKernel(LOAD_IMAGE_RGB10A2_TO_RGBA8)(width, height, depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch);
+}
+
 }
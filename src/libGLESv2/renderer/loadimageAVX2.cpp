@@ -0,0 +1,286 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// loadimageAVX2.cpp: Image loading functions using 256-bit integer
+// instructions.
+
+#include "libGLESv2/renderer/loadimageSIMD.h"
+
+#if defined(ANGLE_CPU_X86)
+#   include <immintrin.h>
+#endif
+
+namespace rx
+{
+
+#if defined(ANGLE_CPU_X86)
+
+namespace
+{
+
+inline ANGLE_TARGET_AVX2 void StoreUnaligned(uint8_t *dest, __m256i value)
+{
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest), value);
+}
+
+// PSHUFB works within each 128-bit lane, so the masks address 4 pixels of 4
+// bytes per lane. |pixelBytes| gives the input byte of each output byte, or -1
+// for a zero byte.
+inline ANGLE_TARGET_AVX2 __m256i MakeShuffleMask(const int pixelBytes[4], size_t inputPixelBytes)
+{
+    char mask[32];
+    for (size_t i = 0; i < 32; i++)
+    {
+        int byte = pixelBytes[i % 4];
+        mask[i] = (byte < 0) ? static_cast<char>(0x80)
+                             : static_cast<char>(byte + ((i % 16) / 4) * inputPixelBytes);
+    }
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mask));
+}
+
+// Loads 8 pixels, each widened to 32 bits.
+template <size_t inputPixelBytes>
+inline ANGLE_TARGET_AVX2 __m256i LoadWidened(const uint8_t *source);
+
+template <>
+inline ANGLE_TARGET_AVX2 __m256i LoadWidened<1>(const uint8_t *source)
+{
+    return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(source)));
+}
+
+template <>
+inline ANGLE_TARGET_AVX2 __m256i LoadWidened<2>(const uint8_t *source)
+{
+    return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source)));
+}
+
+template <>
+inline ANGLE_TARGET_AVX2 __m256i LoadWidened<4>(const uint8_t *source)
+{
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source));
+}
+
+// Rearranges each input pixel into a 4-byte output pixel, and ORs |fill| into
+// it.
+template <size_t inputPixelBytes>
+ANGLE_TARGET_AVX2 size_t ShuffleRow(size_t width, const uint8_t *source, uint8_t *dest,
+                                    const int pixelBytes[4], uint32_t fill)
+{
+    // The pixels are widened to 4 bytes before the shuffle.
+    __m256i mask = MakeShuffleMask(pixelBytes, 4);
+    __m256i fillWide = _mm256_set1_epi32(static_cast<int>(fill));
+
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        __m256i pixels = LoadWidened<inputPixelBytes>(&source[x * inputPixelBytes]);
+        StoreUnaligned(&dest[4 * x], _mm256_or_si256(_mm256_shuffle_epi8(pixels, mask), fillWide));
+    }
+    return x;
+}
+
+ANGLE_TARGET_AVX2 size_t ShuffleRGBRow(size_t width, const uint8_t *source, uint8_t *dest,
+                                       const int pixelBytes[4])
+{
+    __m256i mask = MakeShuffleMask(pixelBytes, 3);
+    __m256i alpha = _mm256_set1_epi32(static_cast<int>(0xFF000000));
+
+    size_t x = 0;
+    // Each lane loads 16 bytes for 4 pixels, so the second lane reads 4 bytes
+    // past the 8 pixels.
+    for (; x + 10 <= width; x += 8)
+    {
+        const uint8_t *input = &source[3 * x];
+        __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+        __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + 12));
+        __m256i pixels = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+
+        StoreUnaligned(&dest[4 * x], _mm256_or_si256(_mm256_shuffle_epi8(pixels, mask), alpha));
+    }
+    return x;
+}
+
+ANGLE_TARGET_AVX2 size_t LoadA8ToRGBA8Row(size_t width, const uint8_t *source, uint8_t *dest)
+{
+    const int pixelBytes[4] = { -1, -1, -1, 0 };
+    return ShuffleRow<1>(width, source, dest, pixelBytes, 0);
+}
+
+ANGLE_TARGET_AVX2 size_t LoadL8ToRGBA8Row(size_t width, const uint8_t *source, uint8_t *dest)
+{
+    const int pixelBytes[4] = { 0, 0, 0, -1 };
+    return ShuffleRow<1>(width, source, dest, pixelBytes, 0xFF000000);
+}
+
+ANGLE_TARGET_AVX2 size_t LoadLA8ToRGBA8Row(size_t width, const uint8_t *source, uint8_t *dest)
+{
+    const int pixelBytes[4] = { 0, 0, 0, 1 };
+    return ShuffleRow<2>(width, source, dest, pixelBytes, 0);
+}
+
+ANGLE_TARGET_AVX2 size_t LoadR8ToBGRX8Row(size_t width, const uint8_t *source, uint8_t *dest)
+{
+    const int pixelBytes[4] = { -1, -1, 0, -1 };
+    return ShuffleRow<1>(width, source, dest, pixelBytes, 0xFF000000);
+}
+
+ANGLE_TARGET_AVX2 size_t LoadRG8ToBGRX8Row(size_t width, const uint8_t *source, uint8_t *dest)
+{
+    const int pixelBytes[4] = { -1, 1, 0, -1 };
+    return ShuffleRow<2>(width, source, dest, pixelBytes, 0xFF000000);
+}
+
+ANGLE_TARGET_AVX2 size_t LoadRGB8ToBGRX8Row(size_t width, const uint8_t *source, uint8_t *dest)
+{
+    const int pixelBytes[4] = { 2, 1, 0, -1 };
+    return ShuffleRGBRow(width, source, dest, pixelBytes);
+}
+
+ANGLE_TARGET_AVX2 size_t LoadRGB8ToRGBX8Row(size_t width, const uint8_t *source, uint8_t *dest)
+{
+    const int pixelBytes[4] = { 0, 1, 2, -1 };
+    return ShuffleRGBRow(width, source, dest, pixelBytes);
+}
+
+ANGLE_TARGET_AVX2 size_t LoadRGBA8ToBGRA8Row(size_t width, const uint8_t *source, uint8_t *dest)
+{
+    const int pixelBytes[4] = { 2, 1, 0, 3 };
+    return ShuffleRow<4>(width, source, dest, pixelBytes, 0);
+}
+
+// See ExpandChannel16 in loadimageSSE2.cpp.
+template <unsigned int shift, unsigned int bits>
+inline ANGLE_TARGET_AVX2 __m256i ExpandChannel16(__m256i pixels)
+{
+    if (bits == 0)
+    {
+        return _mm256_set1_epi16(0xFF);
+    }
+
+    __m256i channel = _mm256_and_si256(_mm256_srli_epi16(pixels, shift), _mm256_set1_epi16((1 << bits) - 1));
+
+    channel = _mm256_slli_epi16(channel, 8 - bits);
+    channel = _mm256_or_si256(channel, _mm256_srli_epi16(channel, bits));
+    if (bits * 2 < 8)
+    {
+        channel = _mm256_or_si256(channel, _mm256_srli_epi16(channel, bits * 2));
+    }
+    if (bits * 4 < 8)
+    {
+        channel = _mm256_or_si256(channel, _mm256_srli_epi16(channel, bits * 4));
+    }
+    return channel;
+}
+
+template <unsigned int shift, unsigned int bits>
+inline ANGLE_TARGET_AVX2 __m256i ExpandChannel32(__m256i pixels)
+{
+    if (bits == 0)
+    {
+        return _mm256_set1_epi32(0xFF);
+    }
+
+    __m256i channel = _mm256_and_si256(_mm256_srli_epi32(pixels, shift), _mm256_set1_epi32((1 << bits) - 1));
+
+    if (bits >= 8)
+    {
+        return _mm256_srli_epi32(channel, bits >= 8 ? bits - 8 : 0);
+    }
+
+    channel = _mm256_slli_epi32(channel, bits < 8 ? 8 - bits : 0);
+    channel = _mm256_or_si256(channel, _mm256_srli_epi32(channel, bits));
+    if (bits * 2 < 8)
+    {
+        channel = _mm256_or_si256(channel, _mm256_srli_epi32(channel, bits * 2));
+    }
+    if (bits * 4 < 8)
+    {
+        channel = _mm256_or_si256(channel, _mm256_srli_epi32(channel, bits * 4));
+    }
+    return channel;
+}
+
+template <typename Layout>
+ANGLE_TARGET_AVX2 size_t LoadPacked16ToRGBA8Row(size_t width, const uint8_t *source, uint8_t *dest)
+{
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        __m256i pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&source[2 * x]));
+        __m256i c0 = ExpandChannel16<Layout::Shift0, Layout::Bits0>(pixels);
+        __m256i c1 = ExpandChannel16<Layout::Shift1, Layout::Bits1>(pixels);
+        __m256i c2 = ExpandChannel16<Layout::Shift2, Layout::Bits2>(pixels);
+        __m256i c3 = ExpandChannel16<Layout::Shift3, Layout::Bits3>(pixels);
+
+        __m256i c01 = _mm256_or_si256(c0, _mm256_slli_epi16(c1, 8));
+        __m256i c23 = _mm256_or_si256(c2, _mm256_slli_epi16(c3, 8));
+
+        // The unpacks work within lanes: lo holds pixels 0-3 and 8-11, hi
+        // holds pixels 4-7 and 12-15.
+        __m256i lo = _mm256_unpacklo_epi16(c01, c23);
+        __m256i hi = _mm256_unpackhi_epi16(c01, c23);
+
+        StoreUnaligned(&dest[4 * x], _mm256_permute2x128_si256(lo, hi, 0x20));
+        StoreUnaligned(&dest[4 * x + 32], _mm256_permute2x128_si256(lo, hi, 0x31));
+    }
+    return x;
+}
+
+template <typename Layout>
+ANGLE_TARGET_AVX2 size_t LoadPacked32ToRGBA8Row(size_t width, const uint8_t *source, uint8_t *dest)
+{
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        __m256i pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&source[4 * x]));
+        __m256i c0 = ExpandChannel32<Layout::Shift0, Layout::Bits0>(pixels);
+        __m256i c1 = ExpandChannel32<Layout::Shift1, Layout::Bits1>(pixels);
+        __m256i c2 = ExpandChannel32<Layout::Shift2, Layout::Bits2>(pixels);
+        __m256i c3 = ExpandChannel32<Layout::Shift3, Layout::Bits3>(pixels);
+
+        __m256i c01 = _mm256_or_si256(c0, _mm256_slli_epi32(c1, 8));
+        __m256i c23 = _mm256_or_si256(_mm256_slli_epi32(c2, 16), _mm256_slli_epi32(c3, 24));
+        StoreUnaligned(&dest[4 * x], _mm256_or_si256(c01, c23));
+    }
+    return x;
+}
+
+const LoadImageFunction kLoadImageKernelsAVX2[LOAD_IMAGE_KERNEL_COUNT] =
+{
+    LoadImageRows<LOAD_IMAGE_A8_TO_RGBA8, LoadA8ToRGBA8Row>,
+    LoadImageRows<LOAD_IMAGE_L8_TO_RGBA8, LoadL8ToRGBA8Row>,
+    LoadImageRows<LOAD_IMAGE_LA8_TO_RGBA8, LoadLA8ToRGBA8Row>,
+    LoadImageRows<LOAD_IMAGE_R8_TO_BGRX8, LoadR8ToBGRX8Row>,
+    LoadImageRows<LOAD_IMAGE_RG8_TO_BGRX8, LoadRG8ToBGRX8Row>,
+    LoadImageRows<LOAD_IMAGE_RGB8_TO_BGRX8, LoadRGB8ToBGRX8Row>,
+    LoadImageRows<LOAD_IMAGE_RGB8_TO_RGBX8, LoadRGB8ToRGBX8Row>,
+    LoadImageRows<LOAD_IMAGE_RGBA8_TO_BGRA8, LoadRGBA8ToBGRA8Row>,
+    LoadImageRows<LOAD_IMAGE_R5G6B5_TO_BGRA8, LoadPacked16ToRGBA8Row<R5G6B5ToBGRA8Layout> >,
+    LoadImageRows<LOAD_IMAGE_R5G6B5_TO_RGBA8, LoadPacked16ToRGBA8Row<R5G6B5ToRGBA8Layout> >,
+    LoadImageRows<LOAD_IMAGE_RGBA4_TO_BGRA8, LoadPacked16ToRGBA8Row<RGBA4ToBGRA8Layout> >,
+    LoadImageRows<LOAD_IMAGE_RGBA4_TO_RGBA8, LoadPacked16ToRGBA8Row<RGBA4ToRGBA8Layout> >,
+    LoadImageRows<LOAD_IMAGE_RGB5A1_TO_BGRA8, LoadPacked16ToRGBA8Row<RGB5A1ToBGRA8Layout> >,
+    LoadImageRows<LOAD_IMAGE_RGB5A1_TO_RGBA8, LoadPacked16ToRGBA8Row<RGB5A1ToRGBA8Layout> >,
+    LoadImageRows<LOAD_IMAGE_RGB10A2_TO_RGBA8, LoadPacked32ToRGBA8Row<RGB10A2ToRGBA8Layout> >,
+};
+
+}
+
+const LoadImageFunction *GetLoadImageKernelsAVX2()
+{
+    return kLoadImageKernelsAVX2;
+}
+
+#else
+
+const LoadImageFunction *GetLoadImageKernelsAVX2()
+{
+    return NULL;
+}
+
+#endif
+
+}
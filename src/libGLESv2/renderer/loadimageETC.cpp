@@ -0,0 +1,637 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// loadimageETC.cpp: Decoding of the ETC2 and EAC formats of ES 3.0, from the
+// ES 3.0.2 spec, section C.1, for the renderers that can't sample them.
+
+#include "libGLESv2/renderer/loadimageETC.h"
+#include "libGLESv2/renderer/loadimage.h"
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <string.h>
+
+namespace rx
+{
+
+namespace
+{
+
+// Blocks decoded before their pixels are expanded, which keeps the decoded
+// palettes in the L1 cache.
+const size_t BlockBatchSize = 16;
+
+// Table C.7: the modifiers of the individual and differential modes.
+const int kETCModifiers[8][2] =
+{
+    {  2,   8 },
+    {  5,  17 },
+    {  9,  29 },
+    { 13,  42 },
+    { 18,  60 },
+    { 24,  80 },
+    { 33, 106 },
+    { 47, 183 },
+};
+
+// Table C.8: the distances of the T and H modes.
+const int kETCDistances[8] = { 3, 6, 11, 16, 23, 32, 41, 64 };
+
+// Table C.10: the EAC modifiers.
+const int kEACModifiers[16][8] =
+{
+    { -3, -6,  -9, -15, 2, 5, 8, 14 },
+    { -3, -7, -10, -13, 2, 6, 9, 12 },
+    { -2, -5,  -8, -13, 1, 4, 7, 12 },
+    { -2, -4,  -6, -13, 1, 3, 5, 12 },
+    { -3, -6,  -8, -12, 2, 5, 7, 11 },
+    { -3, -7,  -9, -11, 2, 6, 8, 10 },
+    { -4, -7,  -8, -11, 3, 6, 7, 10 },
+    { -3, -5,  -8, -11, 2, 4, 7, 10 },
+    { -2, -6,  -8, -10, 1, 5, 7,  9 },
+    { -2, -5,  -8, -10, 1, 4, 7,  9 },
+    { -2, -4,  -8, -10, 1, 3, 7,  9 },
+    { -2, -5,  -7, -10, 1, 4, 6,  9 },
+    { -3, -4,  -7, -10, 2, 3, 6,  9 },
+    { -1, -2,  -3, -10, 0, 1, 2,  9 },
+    { -4, -6,  -8,  -9, 3, 5, 7,  8 },
+    { -3, -5,  -7,  -9, 2, 4, 6,  8 },
+};
+
+// Blocks are stored most significant byte first.
+inline uint64_t ReadBlockBits(const uint8_t *source)
+{
+    uint64_t bits = 0;
+    for (size_t i = 0; i < 8; i++)
+    {
+        bits = (bits << 8) | source[i];
+    }
+    return bits;
+}
+
+// Bits |high| down to |low| of |bits|.
+inline int GetBits(uint64_t bits, unsigned int high, unsigned int low)
+{
+    return static_cast<int>((bits >> low) & ((1u << (high - low + 1)) - 1));
+}
+
+inline uint8_t ClampToByte(int value)
+{
+    return static_cast<uint8_t>(gl::clamp(value, 0, 255));
+}
+
+inline int Extend4To8(int value) { return (value << 4) | value; }
+inline int Extend5To8(int value) { return (value << 3) | (value >> 2); }
+inline int Extend6To8(int value) { return (value << 2) | (value >> 4); }
+inline int Extend7To8(int value) { return (value << 1) | (value >> 6); }
+
+inline int SignExtend3(int value) { return (value ^ 4) - 4; }
+
+// The 2-bit index of each pixel in row major order. The block stores them
+// column major, the most significant bits in the upper half.
+inline void ReadETCPixelIndices(uint64_t bits, uint8_t indices[16])
+{
+    for (unsigned int x = 0; x < 4; x++)
+    {
+        for (unsigned int y = 0; y < 4; y++)
+        {
+            unsigned int k = x * 4 + y;
+            indices[y * 4 + x] = static_cast<uint8_t>((((bits >> (16 + k)) & 1) << 1) | ((bits >> k) & 1));
+        }
+    }
+}
+
+// The RGB palettes share their indices, and the alpha palette is opaque
+// unless transparent entries are added.
+inline void SetOpaqueAlpha(ETCDecodedBlock *block)
+{
+    memset(block->palettes[3], 0xFF, sizeof(block->palettes[3]));
+    memcpy(block->indices[1], block->indices[0], sizeof(block->indices[0]));
+    memcpy(block->indices[2], block->indices[0], sizeof(block->indices[0]));
+    memcpy(block->indices[3], block->indices[0], sizeof(block->indices[0]));
+}
+
+inline void SetPaletteColor(ETCDecodedBlock *block, size_t entry, int r, int g, int b)
+{
+    block->palettes[0][entry] = ClampToByte(r);
+    block->palettes[1][entry] = ClampToByte(g);
+    block->palettes[2][entry] = ClampToByte(b);
+}
+
+// Punchthrough blocks without the opaque bit make the pixels of |entry|
+// transparent black.
+inline void SetTransparent(ETCDecodedBlock *block, size_t entry)
+{
+    block->palettes[0][entry] = 0;
+    block->palettes[1][entry] = 0;
+    block->palettes[2][entry] = 0;
+    block->palettes[3][entry] = 0;
+}
+
+// The individual and differential modes: entries 0-3 of the palettes are the
+// colors of the first subblock, 4-7 those of the second.
+void DecodeETCSubblocks(uint64_t bits, const int baseColors[2][3], bool transparent, ETCDecodedBlock *block)
+{
+    const int tables[2] = { GetBits(bits, 39, 37), GetBits(bits, 36, 34) };
+    const bool flip = GetBits(bits, 32, 32) != 0;
+
+    for (size_t subblock = 0; subblock < 2; subblock++)
+    {
+        const int *modifiers = kETCModifiers[tables[subblock]];
+
+        // Index 0 is +a, 1 is +b, 2 is -a and 3 is -b. Punchthrough blocks
+        // without the opaque bit have no +a or -a.
+        const int small = transparent ? 0 : modifiers[0];
+        const int pixelModifiers[4] = { small, modifiers[1], -small, -modifiers[1] };
+
+        const int *baseColor = baseColors[subblock];
+        for (size_t i = 0; i < 4; i++)
+        {
+            int modifier = pixelModifiers[i];
+            SetPaletteColor(block, subblock * 4 + i, baseColor[0] + modifier, baseColor[1] + modifier, baseColor[2] + modifier);
+        }
+    }
+
+    ReadETCPixelIndices(bits, block->indices[0]);
+    for (size_t y = 0; y < 4; y++)
+    {
+        for (size_t x = 0; x < 4; x++)
+        {
+            size_t subblock = flip ? (y >= 2) : (x >= 2);
+            block->indices[0][y * 4 + x] += static_cast<uint8_t>(subblock * 4);
+        }
+    }
+
+    SetOpaqueAlpha(block);
+    if (transparent)
+    {
+        SetTransparent(block, 2);
+        SetTransparent(block, 6);
+    }
+}
+
+void DecodeETCPaintColors(uint64_t bits, const int paintColors[4][3], bool transparent, ETCDecodedBlock *block)
+{
+    for (size_t i = 0; i < 4; i++)
+    {
+        SetPaletteColor(block, i, paintColors[i][0], paintColors[i][1], paintColors[i][2]);
+    }
+
+    ReadETCPixelIndices(bits, block->indices[0]);
+    SetOpaqueAlpha(block);
+    if (transparent)
+    {
+        SetTransparent(block, 2);
+    }
+}
+
+void DecodeETCTMode(uint64_t bits, bool transparent, ETCDecodedBlock *block)
+{
+    const int color1[3] =
+    {
+        Extend4To8((GetBits(bits, 60, 59) << 2) | GetBits(bits, 57, 56)),
+        Extend4To8(GetBits(bits, 55, 52)),
+        Extend4To8(GetBits(bits, 51, 48)),
+    };
+    const int color2[3] =
+    {
+        Extend4To8(GetBits(bits, 47, 44)),
+        Extend4To8(GetBits(bits, 43, 40)),
+        Extend4To8(GetBits(bits, 39, 36)),
+    };
+    const int distance = kETCDistances[(GetBits(bits, 35, 34) << 1) | GetBits(bits, 32, 32)];
+
+    const int paintColors[4][3] =
+    {
+        { color1[0],            color1[1],            color1[2]            },
+        { color2[0] + distance, color2[1] + distance, color2[2] + distance },
+        { color2[0],            color2[1],            color2[2]            },
+        { color2[0] - distance, color2[1] - distance, color2[2] - distance },
+    };
+    DecodeETCPaintColors(bits, paintColors, transparent, block);
+}
+
+void DecodeETCHMode(uint64_t bits, bool transparent, ETCDecodedBlock *block)
+{
+    const int r1 = GetBits(bits, 62, 59);
+    const int g1 = (GetBits(bits, 58, 56) << 1) | GetBits(bits, 52, 52);
+    const int b1 = (GetBits(bits, 51, 51) << 3) | GetBits(bits, 49, 47);
+    const int r2 = GetBits(bits, 46, 43);
+    const int g2 = GetBits(bits, 42, 39);
+    const int b2 = GetBits(bits, 38, 35);
+
+    // The order of the base colors gives the lowest bit of the distance
+    const int orderBit = (((r1 << 8) | (g1 << 4) | b1) >= ((r2 << 8) | (g2 << 4) | b2)) ? 1 : 0;
+    const int distance = kETCDistances[(GetBits(bits, 34, 34) << 2) | (GetBits(bits, 32, 32) << 1) | orderBit];
+
+    const int color1[3] = { Extend4To8(r1), Extend4To8(g1), Extend4To8(b1) };
+    const int color2[3] = { Extend4To8(r2), Extend4To8(g2), Extend4To8(b2) };
+
+    const int paintColors[4][3] =
+    {
+        { color1[0] + distance, color1[1] + distance, color1[2] + distance },
+        { color1[0] - distance, color1[1] - distance, color1[2] - distance },
+        { color2[0] + distance, color2[1] + distance, color2[2] + distance },
+        { color2[0] - distance, color2[1] - distance, color2[2] - distance },
+    };
+    DecodeETCPaintColors(bits, paintColors, transparent, block);
+}
+
+// Every pixel of a planar block has its own color, so entry k of the
+// palettes is pixel k. Planar blocks are always opaque.
+void DecodeETCPlanarMode(uint64_t bits, ETCDecodedBlock *block)
+{
+    const int origin[3] =
+    {
+        Extend6To8(GetBits(bits, 62, 57)),
+        Extend7To8((GetBits(bits, 56, 56) << 6) | GetBits(bits, 54, 49)),
+        Extend6To8((GetBits(bits, 48, 48) << 5) | (GetBits(bits, 44, 43) << 3) | GetBits(bits, 41, 39)),
+    };
+    const int horizontal[3] =
+    {
+        Extend6To8((GetBits(bits, 38, 34) << 1) | GetBits(bits, 32, 32)),
+        Extend7To8(GetBits(bits, 31, 25)),
+        Extend6To8(GetBits(bits, 24, 19)),
+    };
+    const int vertical[3] =
+    {
+        Extend6To8(GetBits(bits, 18, 13)),
+        Extend7To8(GetBits(bits, 12, 6)),
+        Extend6To8(GetBits(bits, 5, 0)),
+    };
+
+    for (int y = 0; y < 4; y++)
+    {
+        for (int x = 0; x < 4; x++)
+        {
+            size_t entry = y * 4 + x;
+            for (size_t c = 0; c < 3; c++)
+            {
+                int value = x * (horizontal[c] - origin[c]) + y * (vertical[c] - origin[c]) + 4 * origin[c] + 2;
+                block->palettes[c][entry] = ClampToByte(value >> 2);
+            }
+            block->indices[0][entry] = static_cast<uint8_t>(entry);
+        }
+    }
+
+    SetOpaqueAlpha(block);
+}
+
+// Decodes an ETC2 RGB block into the first three palettes and the alpha of
+// the fourth. |punchthrough| blocks use bit 33 as the opaque bit, and have no
+// individual mode.
+void DecodeETC2ColorBlock(const uint8_t *source, bool punchthrough, ETCDecodedBlock *block)
+{
+    const uint64_t bits = ReadBlockBits(source);
+    const bool differentialOrOpaque = GetBits(bits, 33, 33) != 0;
+
+    if (!punchthrough && !differentialOrOpaque)
+    {
+        const int baseColors[2][3] =
+        {
+            { Extend4To8(GetBits(bits, 63, 60)), Extend4To8(GetBits(bits, 55, 52)), Extend4To8(GetBits(bits, 47, 44)) },
+            { Extend4To8(GetBits(bits, 59, 56)), Extend4To8(GetBits(bits, 51, 48)), Extend4To8(GetBits(bits, 43, 40)) },
+        };
+        DecodeETCSubblocks(bits, baseColors, false, block);
+        return;
+    }
+
+    const bool transparent = punchthrough && !differentialOrOpaque;
+
+    // A differential color that overflows selects one of the ETC2 modes
+    const int r = GetBits(bits, 63, 59);
+    const int g = GetBits(bits, 55, 51);
+    const int b = GetBits(bits, 47, 43);
+    const int r2 = r + SignExtend3(GetBits(bits, 58, 56));
+    const int g2 = g + SignExtend3(GetBits(bits, 50, 48));
+    const int b2 = b + SignExtend3(GetBits(bits, 42, 40));
+
+    if (r2 < 0 || r2 > 31)
+    {
+        DecodeETCTMode(bits, transparent, block);
+    }
+    else if (g2 < 0 || g2 > 31)
+    {
+        DecodeETCHMode(bits, transparent, block);
+    }
+    else if (b2 < 0 || b2 > 31)
+    {
+        DecodeETCPlanarMode(bits, block);
+    }
+    else
+    {
+        const int baseColors[2][3] =
+        {
+            { Extend5To8(r),  Extend5To8(g),  Extend5To8(b)  },
+            { Extend5To8(r2), Extend5To8(g2), Extend5To8(b2) },
+        };
+        DecodeETCSubblocks(bits, baseColors, transparent, block);
+    }
+}
+
+// The fields of an EAC block, with the 3-bit pixel indices in row major order.
+struct EACBlock
+{
+    int base;
+    int multiplier;
+    const int *modifiers;
+    uint8_t indices[16];
+};
+
+void ReadEACBlock(const uint8_t *source, EACBlock *block)
+{
+    const uint64_t bits = ReadBlockBits(source);
+    block->base = GetBits(bits, 63, 56);
+    block->multiplier = GetBits(bits, 55, 52);
+    block->modifiers = kEACModifiers[GetBits(bits, 51, 48)];
+
+    for (unsigned int x = 0; x < 4; x++)
+    {
+        for (unsigned int y = 0; y < 4; y++)
+        {
+            unsigned int k = x * 4 + y;
+            block->indices[y * 4 + x] = static_cast<uint8_t>(GetBits(bits, 47 - 3 * k, 45 - 3 * k));
+        }
+    }
+}
+
+void DecodeEACAlpha8(const uint8_t *source, size_t plane, ETCDecodedBlock *block)
+{
+    EACBlock eac;
+    ReadEACBlock(source, &eac);
+
+    for (size_t i = 0; i < 8; i++)
+    {
+        block->palettes[plane][i] = ClampToByte(eac.base + eac.modifiers[i] * eac.multiplier);
+    }
+    memcpy(block->indices[plane], eac.indices, sizeof(eac.indices));
+}
+
+// Decodes an R11 EAC channel to 16-bit values, low bytes in palette |plane|
+// and high bytes in the next one.
+void DecodeEACR11(const uint8_t *source, size_t plane, ETCDecodedBlock *block)
+{
+    EACBlock eac;
+    ReadEACBlock(source, &eac);
+
+    const int base = eac.base * 8 + 4;
+    const int multiplier = (eac.multiplier == 0) ? 1 : eac.multiplier * 8;
+    for (size_t i = 0; i < 8; i++)
+    {
+        int value = gl::clamp(base + eac.modifiers[i] * multiplier, 0, 2047);
+        int value16 = (value << 5) | (value >> 6);
+        block->palettes[plane][i] = static_cast<uint8_t>(value16);
+        block->palettes[plane + 1][i] = static_cast<uint8_t>(value16 >> 8);
+    }
+    memcpy(block->indices[plane], eac.indices, sizeof(eac.indices));
+    memcpy(block->indices[plane + 1], eac.indices, sizeof(eac.indices));
+}
+
+void DecodeEACSignedR11(const uint8_t *source, size_t plane, ETCDecodedBlock *block)
+{
+    EACBlock eac;
+    ReadEACBlock(source, &eac);
+
+    // The base is a signed byte, and -128 is treated as -127
+    const int base = std::max(static_cast<int>(static_cast<int8_t>(eac.base)), -127) * 8;
+    const int multiplier = (eac.multiplier == 0) ? 1 : eac.multiplier * 8;
+    for (size_t i = 0; i < 8; i++)
+    {
+        int value = gl::clamp(base + eac.modifiers[i] * multiplier, -1023, 1023);
+        int magnitude = std::abs(value);
+        magnitude = (magnitude << 5) | (magnitude >> 5);
+        uint16_t value16 = static_cast<uint16_t>((value < 0) ? -magnitude : magnitude);
+        block->palettes[plane][i] = static_cast<uint8_t>(value16);
+        block->palettes[plane + 1][i] = static_cast<uint8_t>(value16 >> 8);
+    }
+    memcpy(block->indices[plane], eac.indices, sizeof(eac.indices));
+    memcpy(block->indices[plane + 1], eac.indices, sizeof(eac.indices));
+}
+
+void DecodeETC2RGB8Block(const uint8_t *source, ETCDecodedBlock *block)
+{
+    DecodeETC2ColorBlock(source, false, block);
+}
+
+void DecodeETC2RGB8A1Block(const uint8_t *source, ETCDecodedBlock *block)
+{
+    DecodeETC2ColorBlock(source, true, block);
+}
+
+// The alpha block comes first.
+void DecodeETC2RGBA8Block(const uint8_t *source, ETCDecodedBlock *block)
+{
+    DecodeETC2ColorBlock(source + 8, false, block);
+    DecodeEACAlpha8(source, 3, block);
+}
+
+void DecodeEACR11Block(const uint8_t *source, ETCDecodedBlock *block)
+{
+    DecodeEACR11(source, 0, block);
+}
+
+void DecodeEACSignedR11Block(const uint8_t *source, ETCDecodedBlock *block)
+{
+    DecodeEACSignedR11(source, 0, block);
+}
+
+void DecodeEACRG11Block(const uint8_t *source, ETCDecodedBlock *block)
+{
+    DecodeEACR11(source, 0, block);
+    DecodeEACR11(source + 8, 2, block);
+}
+
+void DecodeEACSignedRG11Block(const uint8_t *source, ETCDecodedBlock *block)
+{
+    DecodeEACSignedR11(source, 0, block);
+    DecodeEACSignedR11(source + 8, 2, block);
+}
+
+typedef void (*ETCDecodeBlockFunction)(const uint8_t *source, ETCDecodedBlock *block);
+
+// Writes the part of a block that is inside the image.
+void ExpandPartialBlock(ETCExpandBlocksFunction expand, const ETCDecodedBlock &block, size_t pixelBytes,
+                        size_t width, size_t height, uint8_t *dest, size_t destRowPitch)
+{
+    uint8_t pixels[4 * 4 * 4];
+    const size_t blockRowPitch = 4 * pixelBytes;
+    expand(1, &block, pixels, blockRowPitch);
+
+    for (size_t y = 0; y < height; y++)
+    {
+        memcpy(dest + y * destRowPitch, pixels + y * blockRowPitch, width * pixelBytes);
+    }
+}
+
+// |width| and |height| are in pixels and |inputRowPitch| is a row of blocks.
+// Blocks that cross the right or bottom edge are clipped.
+template <ETCDecodeBlockFunction decodeBlock, size_t blockBytes, size_t pixelBytes>
+void LoadETCBlocks(size_t width, size_t height, size_t depth,
+                   const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                   uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    const ETCExpandFunctions &expandFunctions = GetBestETCExpandFunctions();
+    const ETCExpandBlocksFunction expand = (pixelBytes == 2) ? expandFunctions.expand2 : expandFunctions.expand4;
+
+    const size_t columns = (width + 3) / 4;
+    const size_t fullColumns = width / 4;
+    const size_t rows = (height + 3) / 4;
+
+    ETCDecodedBlock blocks[BlockBatchSize];
+
+    for (size_t z = 0; z < depth; z++)
+    {
+        for (size_t row = 0; row < rows; row++)
+        {
+            const uint8_t *source = input + z * inputDepthPitch + row * inputRowPitch;
+            uint8_t *dest = output + z * outputDepthPitch + row * 4 * outputRowPitch;
+            const size_t blockHeight = std::min<size_t>(height - row * 4, 4);
+
+            for (size_t column = 0; column < columns; column += BlockBatchSize)
+            {
+                const size_t count = std::min(columns - column, BlockBatchSize);
+                for (size_t i = 0; i < count; i++)
+                {
+                    decodeBlock(source + (column + i) * blockBytes, &blocks[i]);
+                }
+
+                size_t fullCount = 0;
+                if (blockHeight == 4 && column < fullColumns)
+                {
+                    fullCount = std::min(count, fullColumns - column);
+                    expand(fullCount, blocks, dest + column * 4 * pixelBytes, outputRowPitch);
+                }
+
+                for (size_t i = fullCount; i < count; i++)
+                {
+                    size_t x = (column + i) * 4;
+                    ExpandPartialBlock(expand, blocks[i], pixelBytes, std::min<size_t>(width - x, 4), blockHeight,
+                                       dest + x * pixelBytes, outputRowPitch);
+                }
+            }
+        }
+    }
+}
+
+template <size_t pixelBytes>
+void ExpandBlocksScalar(size_t count, const ETCDecodedBlock *blocks, uint8_t *dest, size_t destRowPitch)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        const ETCDecodedBlock &block = blocks[i];
+        for (size_t y = 0; y < 4; y++)
+        {
+            uint8_t *pixel = dest + y * destRowPitch + i * 4 * pixelBytes;
+            for (size_t x = 0; x < 4; x++)
+            {
+                for (size_t byte = 0; byte < pixelBytes; byte++)
+                {
+                    pixel[byte] = block.palettes[byte][block.indices[byte][y * 4 + x]];
+                }
+                pixel += pixelBytes;
+            }
+        }
+    }
+}
+
+const ETCExpandFunctions kETCExpandFunctionsScalar =
+{
+    ExpandBlocksScalar<2>,
+    ExpandBlocksScalar<4>,
+};
+
+}
+
+const ETCExpandFunctions *GetETCExpandFunctions(gl::SIMDLevel level)
+{
+    switch (level)
+    {
+      case gl::SIMD_SCALAR: return &kETCExpandFunctionsScalar;
+      // The lookups need PSHUFB
+      case gl::SIMD_SSE2:   return NULL;
+      case gl::SIMD_SSSE3:  return GetETCExpandFunctionsSSSE3();
+      case gl::SIMD_SSE41:  return NULL;
+      case gl::SIMD_AVX2:   return GetETCExpandFunctionsAVX2();
+      default: UNREACHABLE(); return NULL;
+    }
+}
+
+const ETCExpandFunctions &ResolveETCExpandFunctions(gl::SIMDLevel maxLevel)
+{
+    return gl::ResolveSIMDVersion(GetETCExpandFunctions, 0, maxLevel);
+}
+
+const ETCExpandFunctions &GetBestETCExpandFunctions()
+{
+    static const gl::BestSIMDVersions<ETCExpandFunctions, 1> best(GetETCExpandFunctions);
+    return best[0];
+}
+
+void InitializeETCExpandFunctions()
+{
+    GetBestETCExpandFunctions();
+}
+
+void LoadETC2RGB8ToRGBA8(size_t width, size_t height, size_t depth,
+                         const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                         uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    LoadETCBlocks<DecodeETC2RGB8Block, 8, 4>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                             output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadETC2RGB8A1ToRGBA8(size_t width, size_t height, size_t depth,
+                           const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                           uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    LoadETCBlocks<DecodeETC2RGB8A1Block, 8, 4>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                               output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadETC2RGBA8ToRGBA8(size_t width, size_t height, size_t depth,
+                          const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                          uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    LoadETCBlocks<DecodeETC2RGBA8Block, 16, 4>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                               output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadEACR11ToR16(size_t width, size_t height, size_t depth,
+                     const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                     uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    LoadETCBlocks<DecodeEACR11Block, 8, 2>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                           output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadEACSignedR11ToR16(size_t width, size_t height, size_t depth,
+                           const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                           uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    LoadETCBlocks<DecodeEACSignedR11Block, 8, 2>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                                 output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadEACRG11ToRG16(size_t width, size_t height, size_t depth,
+                       const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                       uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    LoadETCBlocks<DecodeEACRG11Block, 16, 4>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                             output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadEACSignedRG11ToRG16(size_t width, size_t height, size_t depth,
+                             const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                             uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    LoadETCBlocks<DecodeEACSignedRG11Block, 16, 4>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                                   output, outputRowPitch, outputDepthPitch);
+}
+
+}
@@ -0,0 +1,58 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// loadimageETC.h: Runtime selection of the vectorized pixel expansion used by
+// the ETC2 and EAC load functions. Blocks are decoded one at a time to small
+// palettes, and the pixels of a run of blocks are then looked up with byte
+// shuffles.
+
+#ifndef LIBGLESV2_RENDERER_LOADIMAGEETC_H_
+#define LIBGLESV2_RENDERER_LOADIMAGEETC_H_
+
+#include "libGLESv2/renderer/loadimageSIMD.h"
+
+namespace rx
+{
+
+// A 4x4 block decoded to palettes: byte i of the pixel at column x, row y of
+// the block is palettes[i][indices[i][y * 4 + x]]. No ETC2 or EAC block has
+// more than 16 values per byte, the 16 pixels of a planar block included.
+struct ETCDecodedBlock
+{
+    uint8_t palettes[4][16];
+    uint8_t indices[4][16];
+};
+
+// Writes the pixels of |count| blocks that sit side by side, with |N| bytes
+// per pixel taken from the first |N| palettes: 4 rows of count * 4 pixels.
+typedef void (*ETCExpandBlocksFunction)(size_t count, const ETCDecodedBlock *blocks, uint8_t *dest, size_t destRowPitch);
+
+struct ETCExpandFunctions
+{
+    // Two bytes per pixel, for R16.
+    ETCExpandBlocksFunction expand2;
+
+    // Four bytes per pixel, for RGBA8 and RG16.
+    ETCExpandBlocksFunction expand4;
+};
+
+// Dispatch of the expansion through common/simddispatch.h, as a family with
+// a single kernel. GetETCExpandFunctions is its table of versions per level.
+const ETCExpandFunctions *GetETCExpandFunctions(gl::SIMDLevel level);
+const ETCExpandFunctions &ResolveETCExpandFunctions(gl::SIMDLevel maxLevel);
+const ETCExpandFunctions &GetBestETCExpandFunctions();
+
+// Resolves GetBestETCExpandFunctions ahead of its first use, which must not
+// race with another thread.
+void InitializeETCExpandFunctions();
+
+// Per-level versions, NULL on other architectures.
+const ETCExpandFunctions *GetETCExpandFunctionsSSSE3();
+const ETCExpandFunctions *GetETCExpandFunctionsAVX2();
+
+}
+
+#endif // LIBGLESV2_RENDERER_LOADIMAGEETC_H_
@@ -0,0 +1,128 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// loadimageETCAVX2.cpp: Expansion of decoded ETC2 and EAC blocks two blocks
+// at a time, one in each 128-bit lane.
+
+#include "libGLESv2/renderer/loadimageETC.h"
+
+#if defined(ANGLE_CPU_X86)
+#   include <immintrin.h>
+#endif
+
+namespace rx
+{
+
+#if defined(ANGLE_CPU_X86)
+
+namespace
+{
+
+inline ANGLE_TARGET_AVX2 __m256i LoadBlockPair(const uint8_t *first, const uint8_t *second)
+{
+    __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+    __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(second));
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+}
+
+// Plane |plane| of two blocks: the pixels of the first in the low lane and of
+// the second in the high lane.
+inline ANGLE_TARGET_AVX2 __m256i LookUpPlanes(const ETCDecodedBlock *blocks, size_t plane)
+{
+    __m256i palettes = LoadBlockPair(blocks[0].palettes[plane], blocks[1].palettes[plane]);
+    __m256i indices = LoadBlockPair(blocks[0].indices[plane], blocks[1].indices[plane]);
+    return _mm256_shuffle_epi8(palettes, indices);
+}
+
+inline ANGLE_TARGET_AVX2 void StoreUnaligned(uint8_t *dest, __m256i value)
+{
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest), value);
+}
+
+inline ANGLE_TARGET_AVX2 void StoreUnaligned(uint8_t *dest, __m128i value)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest), value);
+}
+
+ANGLE_TARGET_AVX2 void ExpandBlocks2(size_t count, const ETCDecodedBlock *blocks, uint8_t *dest, size_t destRowPitch)
+{
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2)
+    {
+        __m256i low = LookUpPlanes(blocks + i, 0);
+        __m256i high = LookUpPlanes(blocks + i, 1);
+
+        // Rows 0 and 1 of each block, then rows 2 and 3, ordered so that
+        // each 128 bits is a row of both blocks
+        __m256i rows01 = _mm256_permute4x64_epi64(_mm256_unpacklo_epi8(low, high), _MM_SHUFFLE(3, 1, 2, 0));
+        __m256i rows23 = _mm256_permute4x64_epi64(_mm256_unpackhi_epi8(low, high), _MM_SHUFFLE(3, 1, 2, 0));
+
+        uint8_t *blockDest = dest + i * 8;
+        StoreUnaligned(blockDest, _mm256_castsi256_si128(rows01));
+        StoreUnaligned(blockDest + destRowPitch, _mm256_extracti128_si256(rows01, 1));
+        StoreUnaligned(blockDest + 2 * destRowPitch, _mm256_castsi256_si128(rows23));
+        StoreUnaligned(blockDest + 3 * destRowPitch, _mm256_extracti128_si256(rows23, 1));
+    }
+
+    if (i < count)
+    {
+        GetETCExpandFunctionsSSSE3()->expand2(count - i, blocks + i, dest + i * 8, destRowPitch);
+    }
+}
+
+ANGLE_TARGET_AVX2 void ExpandBlocks4(size_t count, const ETCDecodedBlock *blocks, uint8_t *dest, size_t destRowPitch)
+{
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2)
+    {
+        __m256i byte0 = LookUpPlanes(blocks + i, 0);
+        __m256i byte1 = LookUpPlanes(blocks + i, 1);
+        __m256i byte2 = LookUpPlanes(blocks + i, 2);
+        __m256i byte3 = LookUpPlanes(blocks + i, 3);
+
+        __m256i low01 = _mm256_unpacklo_epi8(byte0, byte1);
+        __m256i high01 = _mm256_unpackhi_epi8(byte0, byte1);
+        __m256i low23 = _mm256_unpacklo_epi8(byte2, byte3);
+        __m256i high23 = _mm256_unpackhi_epi8(byte2, byte3);
+
+        // The unpacks stay in their lanes, so each result is a row of the
+        // first block followed by the same row of the second
+        uint8_t *blockDest = dest + i * 16;
+        StoreUnaligned(blockDest, _mm256_unpacklo_epi16(low01, low23));
+        StoreUnaligned(blockDest + destRowPitch, _mm256_unpackhi_epi16(low01, low23));
+        StoreUnaligned(blockDest + 2 * destRowPitch, _mm256_unpacklo_epi16(high01, high23));
+        StoreUnaligned(blockDest + 3 * destRowPitch, _mm256_unpackhi_epi16(high01, high23));
+    }
+
+    if (i < count)
+    {
+        GetETCExpandFunctionsSSSE3()->expand4(count - i, blocks + i, dest + i * 16, destRowPitch);
+    }
+}
+
+const ETCExpandFunctions kETCExpandFunctionsAVX2 =
+{
+    ExpandBlocks2,
+    ExpandBlocks4,
+};
+
+}
+
+const ETCExpandFunctions *GetETCExpandFunctionsAVX2()
+{
+    return &kETCExpandFunctionsAVX2;
+}
+
+#else
+
+const ETCExpandFunctions *GetETCExpandFunctionsAVX2()
+{
+    return NULL;
+}
+
+#endif
+
+}
@@ -0,0 +1,101 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// loadimageETCSSSE3.cpp: Expansion of decoded ETC2 and EAC blocks with
+// PSHUFB, one block at a time.
+
+#include "libGLESv2/renderer/loadimageETC.h"
+
+#if defined(ANGLE_CPU_X86)
+#   include <tmmintrin.h>
+#endif
+
+namespace rx
+{
+
+#if defined(ANGLE_CPU_X86)
+
+namespace
+{
+
+// The 16 bytes of plane |plane|, one per pixel in row major order.
+inline ANGLE_TARGET_SSSE3 __m128i LookUpPlane(const ETCDecodedBlock &block, size_t plane)
+{
+    __m128i palette = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block.palettes[plane]));
+    __m128i indices = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block.indices[plane]));
+    return _mm_shuffle_epi8(palette, indices);
+}
+
+inline ANGLE_TARGET_SSSE3 void StoreUnaligned(uint8_t *dest, __m128i value)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest), value);
+}
+
+ANGLE_TARGET_SSSE3 void ExpandBlocks2(size_t count, const ETCDecodedBlock *blocks, uint8_t *dest, size_t destRowPitch)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        __m128i low = LookUpPlane(blocks[i], 0);
+        __m128i high = LookUpPlane(blocks[i], 1);
+
+        // Rows 0 and 1, then rows 2 and 3
+        __m128i rows01 = _mm_unpacklo_epi8(low, high);
+        __m128i rows23 = _mm_unpackhi_epi8(low, high);
+
+        uint8_t *blockDest = dest + i * 8;
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(blockDest), rows01);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(blockDest + destRowPitch), _mm_srli_si128(rows01, 8));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(blockDest + 2 * destRowPitch), rows23);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(blockDest + 3 * destRowPitch), _mm_srli_si128(rows23, 8));
+    }
+}
+
+ANGLE_TARGET_SSSE3 void ExpandBlocks4(size_t count, const ETCDecodedBlock *blocks, uint8_t *dest, size_t destRowPitch)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        __m128i byte0 = LookUpPlane(blocks[i], 0);
+        __m128i byte1 = LookUpPlane(blocks[i], 1);
+        __m128i byte2 = LookUpPlane(blocks[i], 2);
+        __m128i byte3 = LookUpPlane(blocks[i], 3);
+
+        // Bytes 0 and 1 of pixels 0-7 and 8-15, then bytes 2 and 3
+        __m128i low01 = _mm_unpacklo_epi8(byte0, byte1);
+        __m128i high01 = _mm_unpackhi_epi8(byte0, byte1);
+        __m128i low23 = _mm_unpacklo_epi8(byte2, byte3);
+        __m128i high23 = _mm_unpackhi_epi8(byte2, byte3);
+
+        uint8_t *blockDest = dest + i * 16;
+        StoreUnaligned(blockDest, _mm_unpacklo_epi16(low01, low23));
+        StoreUnaligned(blockDest + destRowPitch, _mm_unpackhi_epi16(low01, low23));
+        StoreUnaligned(blockDest + 2 * destRowPitch, _mm_unpacklo_epi16(high01, high23));
+        StoreUnaligned(blockDest + 3 * destRowPitch, _mm_unpackhi_epi16(high01, high23));
+    }
+}
+
+const ETCExpandFunctions kETCExpandFunctionsSSSE3 =
+{
+    ExpandBlocks2,
+    ExpandBlocks4,
+};
+
+}
+
+const ETCExpandFunctions *GetETCExpandFunctionsSSSE3()
+{
+    return &kETCExpandFunctionsSSSE3;
+}
+
+#else
+
+const ETCExpandFunctions *GetETCExpandFunctionsSSSE3()
+{
+    return NULL;
+}
+
+#endif
+
+}
@@ -0,0 +1,86 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// loadimageSIMD.cpp: Runtime selection of the vectorized image loading
+// functions.
+
+#include "libGLESv2/renderer/loadimageSIMD.h"
+
+#include "common/debug.h"
+
+namespace rx
+{
+
+namespace
+{
+
+const LoadImageKernelInfo kLoadImageKernelInfo[LOAD_IMAGE_KERNEL_COUNT] =
+{
+    { "A8ToRGBA8",      1, 4 },
+    { "L8ToRGBA8",      1, 4 },
+    { "LA8ToRGBA8",     2, 4 },
+    { "R8ToBGRX8",      1, 4 },
+    { "RG8ToBGRX8",     2, 4 },
+    { "RGB8ToBGRX8",    3, 4 },
+    { "RGB8ToRGBX8",    3, 4 },
+    { "RGBA8ToBGRA8",   4, 4 },
+    { "R5G6B5ToBGRA8",  2, 4 },
+    { "R5G6B5ToRGBA8",  2, 4 },
+    { "RGBA4ToBGRA8",   2, 4 },
+    { "RGBA4ToRGBA8",   2, 4 },
+    { "RGB5A1ToBGRA8",  2, 4 },
+    { "RGB5A1ToRGBA8",  2, 4 },
+    { "RGB10A2ToRGBA8", 4, 4 },
+};
+
+const LoadImageFunction *GetLoadImageKernels(gl::SIMDLevel level)
+{
+    switch (level)
+    {
+      case gl::SIMD_SCALAR: return GetLoadImageKernelsScalar();
+      case gl::SIMD_SSE2:   return GetLoadImageKernelsSSE2();
+      case gl::SIMD_SSSE3:  return GetLoadImageKernelsSSSE3();
+      // No kernel gains from SSE4.1 over SSSE3.
+      case gl::SIMD_SSE41:  return NULL;
+      case gl::SIMD_AVX2:   return GetLoadImageKernelsAVX2();
+      default: UNREACHABLE(); return NULL;
+    }
+}
+
+}
+
+const LoadImageKernelInfo &GetLoadImageKernelInfo(LoadImageKernel kernel)
+{
+    ASSERT(kernel < LOAD_IMAGE_KERNEL_COUNT);
+    return kLoadImageKernelInfo[kernel];
+}
+
+LoadImageFunction GetLoadImageKernel(LoadImageKernel kernel, gl::SIMDLevel level)
+{
+    ASSERT(kernel < LOAD_IMAGE_KERNEL_COUNT);
+    const LoadImageFunction *function = gl::GetSIMDVersion(GetLoadImageKernels, kernel, level);
+    return function ? *function : NULL;
+}
+
+LoadImageFunction ResolveLoadImageKernel(LoadImageKernel kernel, gl::SIMDLevel maxLevel)
+{
+    ASSERT(kernel < LOAD_IMAGE_KERNEL_COUNT);
+    return gl::ResolveSIMDVersion(GetLoadImageKernels, kernel, maxLevel);
+}
+
+LoadImageFunction GetBestLoadImageKernel(LoadImageKernel kernel)
+{
+    static const gl::BestSIMDVersions<LoadImageFunction, LOAD_IMAGE_KERNEL_COUNT> bestKernels(GetLoadImageKernels);
+    return bestKernels[kernel];
+}
+
+void InitializeLoadImageKernels()
+{
+    // Looking up any kernel builds the table, and detects the level it is for
+    GetBestLoadImageKernel(LOAD_IMAGE_A8_TO_RGBA8);
+}
+
+}
@@ -0,0 +1,129 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// loadimageSIMD.h: Runtime selection of the vectorized image loading
+// functions. The public Load functions in loadimage.h dispatch through here.
+
+#ifndef LIBGLESV2_RENDERER_LOADIMAGESIMD_H_
+#define LIBGLESV2_RENDERER_LOADIMAGESIMD_H_
+
+#include "libGLESv2/formatutils.h"
+#include "libGLESv2/renderer/loadimage.h"
+#include "common/simddispatch.h"
+
+namespace rx
+{
+
+// The load functions that have vectorized versions. Load functions that
+// produce the same bytes share a kernel, e.g. LoadA8ToRGBA8 and
+// LoadA8ToBGRA8.
+enum LoadImageKernel
+{
+    LOAD_IMAGE_A8_TO_RGBA8,
+    LOAD_IMAGE_L8_TO_RGBA8,
+    LOAD_IMAGE_LA8_TO_RGBA8,
+    LOAD_IMAGE_R8_TO_BGRX8,
+    LOAD_IMAGE_RG8_TO_BGRX8,
+    LOAD_IMAGE_RGB8_TO_BGRX8,
+    LOAD_IMAGE_RGB8_TO_RGBX8,
+    LOAD_IMAGE_RGBA8_TO_BGRA8,
+    LOAD_IMAGE_R5G6B5_TO_BGRA8,
+    LOAD_IMAGE_R5G6B5_TO_RGBA8,
+    LOAD_IMAGE_RGBA4_TO_BGRA8,
+    LOAD_IMAGE_RGBA4_TO_RGBA8,
+    LOAD_IMAGE_RGB5A1_TO_BGRA8,
+    LOAD_IMAGE_RGB5A1_TO_RGBA8,
+    LOAD_IMAGE_RGB10A2_TO_RGBA8,
+
+    LOAD_IMAGE_KERNEL_COUNT
+};
+
+struct LoadImageKernelInfo
+{
+    const char *name;
+    size_t inputPixelBytes;
+    size_t outputPixelBytes;
+};
+
+const LoadImageKernelInfo &GetLoadImageKernelInfo(LoadImageKernel kernel);
+
+// Dispatch of the load kernels through common/simddispatch.h. Every kernel has
+// a scalar version, and GetBestLoadImageKernel builds its table on first use.
+LoadImageFunction GetLoadImageKernel(LoadImageKernel kernel, gl::SIMDLevel level);
+LoadImageFunction ResolveLoadImageKernel(LoadImageKernel kernel, gl::SIMDLevel maxLevel);
+LoadImageFunction GetBestLoadImageKernel(LoadImageKernel kernel);
+
+// Builds the table of GetBestLoadImageKernel. It is otherwise built on first
+// use, which is not thread safe with every compiler, so this must be called
+// before loading on more than one thread.
+void InitializeLoadImageKernels();
+
+// Per-level tables, indexed by LoadImageKernel. The vectorized ones live in
+// their own files so that they can be compiled for their instruction set, and
+// are NULL on other architectures.
+const LoadImageFunction *GetLoadImageKernelsScalar();
+const LoadImageFunction *GetLoadImageKernelsSSE2();
+const LoadImageFunction *GetLoadImageKernelsSSSE3();
+const LoadImageFunction *GetLoadImageKernelsAVX2();
+
+// Converts the leading pixels of a row and returns how many it converted.
+typedef size_t (*LoadImageRowFunction)(size_t width, const uint8_t *source, uint8_t *dest);
+
+// Runs |loadRow| on every row and finishes each row with the scalar kernel.
+template <LoadImageKernel kernel, LoadImageRowFunction loadRow>
+inline void LoadImageRows(size_t width, size_t height, size_t depth,
+                          const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                          uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    const LoadImageFunction loadRemainder = GetLoadImageKernel(kernel, gl::SIMD_SCALAR);
+    const LoadImageKernelInfo &info = GetLoadImageKernelInfo(kernel);
+
+    for (size_t z = 0; z < depth; z++)
+    {
+        for (size_t y = 0; y < height; y++)
+        {
+            const uint8_t *source = OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
+            uint8_t *dest = OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
+
+            size_t x = loadRow(width, source, dest);
+            if (x < width)
+            {
+                loadRemainder(width - x, 1, 1, source + x * info.inputPixelBytes, inputRowPitch, inputDepthPitch,
+                              dest + x * info.outputPixelBytes, outputRowPitch, outputDepthPitch);
+            }
+        }
+    }
+}
+
+// Where each output byte of a packed pixel comes from: the channel at |shift|
+// with |bits| bits is widened to 8 bits the way the scalar functions do it,
+// replicating its high bits, or truncating channels wider than 8 bits. A
+// channel with no bits is 0xFF.
+template <unsigned int shift0, unsigned int bits0, unsigned int shift1, unsigned int bits1,
+          unsigned int shift2, unsigned int bits2, unsigned int shift3, unsigned int bits3>
+struct PackedPixelLayout
+{
+    static const unsigned int Shift0 = shift0;
+    static const unsigned int Bits0 = bits0;
+    static const unsigned int Shift1 = shift1;
+    static const unsigned int Bits1 = bits1;
+    static const unsigned int Shift2 = shift2;
+    static const unsigned int Bits2 = bits2;
+    static const unsigned int Shift3 = shift3;
+    static const unsigned int Bits3 = bits3;
+};
+
+typedef PackedPixelLayout< 0, 5,  5, 6, 11, 5,  0, 0> R5G6B5ToBGRA8Layout;
+typedef PackedPixelLayout<11, 5,  5, 6,  0, 5,  0, 0> R5G6B5ToRGBA8Layout;
+typedef PackedPixelLayout< 4, 4,  8, 4, 12, 4,  0, 4> RGBA4ToBGRA8Layout;
+typedef PackedPixelLayout<12, 4,  8, 4,  4, 4,  0, 4> RGBA4ToRGBA8Layout;
+typedef PackedPixelLayout< 1, 5,  6, 5, 11, 5,  0, 1> RGB5A1ToBGRA8Layout;
+typedef PackedPixelLayout<11, 5,  6, 5,  1, 5,  0, 1> RGB5A1ToRGBA8Layout;
+typedef PackedPixelLayout< 0, 10, 10, 10, 20, 10, 30, 2> RGB10A2ToRGBA8Layout;
+
+}
+
+#endif // LIBGLESV2_RENDERER_LOADIMAGESIMD_H_
@@ -8,111 +8,326 @@
 // in a separated file for GCC, which can enable SSE usage only per-file,
 // not for code blocks that use SSE2 explicitly.
 
-#include "libGLESv2/renderer/loadimage.h"
+#include "libGLESv2/renderer/loadimageSIMD.h"
+
+#include <string.h>
+
+#if defined(ANGLE_CPU_X86)
+#   include <emmintrin.h>
+#endif
 
 namespace rx
 {
 
-void LoadA8ToBGRA8_SSE2(size_t width, size_t height, size_t depth,
-                        const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
-                        uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+#if defined(ANGLE_CPU_X86)
+
+namespace
+{
+
+inline ANGLE_TARGET_SSE2 __m128i LoadUnaligned(const uint8_t *source)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+}
+
+inline ANGLE_TARGET_SSE2 void StoreUnaligned(uint8_t *dest, __m128i value)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest), value);
+}
+
+inline uint32_t ReadUnaligned32(const uint8_t *source)
+{
+    uint32_t value;
+    memcpy(&value, source, sizeof(value));
+    return value;
+}
+
+// Widens the channel at |shift| of each 16-bit pixel to 8 bits, in the low
+// byte of the lane.
+template <unsigned int shift, unsigned int bits>
+inline ANGLE_TARGET_SSE2 __m128i ExpandChannel16(__m128i pixels)
+{
+    if (bits == 0)
+    {
+        return _mm_set1_epi16(0xFF);
+    }
+
+    __m128i channel = _mm_and_si128(_mm_srli_epi16(pixels, shift), _mm_set1_epi16((1 << bits) - 1));
+
+    // Move the channel to the top of the byte and copy its high bits down.
+    channel = _mm_slli_epi16(channel, 8 - bits);
+    channel = _mm_or_si128(channel, _mm_srli_epi16(channel, bits));
+    if (bits * 2 < 8)
+    {
+        channel = _mm_or_si128(channel, _mm_srli_epi16(channel, bits * 2));
+    }
+    if (bits * 4 < 8)
+    {
+        channel = _mm_or_si128(channel, _mm_srli_epi16(channel, bits * 4));
+    }
+    return channel;
+}
+
+// Same for 32-bit pixels.
+template <unsigned int shift, unsigned int bits>
+inline ANGLE_TARGET_SSE2 __m128i ExpandChannel32(__m128i pixels)
+{
+    if (bits == 0)
+    {
+        return _mm_set1_epi32(0xFF);
+    }
+
+    __m128i channel = _mm_and_si128(_mm_srli_epi32(pixels, shift), _mm_set1_epi32((1 << bits) - 1));
+
+    if (bits >= 8)
+    {
+        return _mm_srli_epi32(channel, bits >= 8 ? bits - 8 : 0);
+    }
+
+    channel = _mm_slli_epi32(channel, bits < 8 ? 8 - bits : 0);
+    channel = _mm_or_si128(channel, _mm_srli_epi32(channel, bits));
+    if (bits * 2 < 8)
+    {
+        channel = _mm_or_si128(channel, _mm_srli_epi32(channel, bits * 2));
+    }
+    if (bits * 4 < 8)
+    {
+        channel = _mm_or_si128(channel, _mm_srli_epi32(channel, bits * 4));
+    }
+    return channel;
+}
+
+ANGLE_TARGET_SSE2 size_t LoadA8ToRGBA8Row(size_t width, const uint8_t *source, uint8_t *dest)
 {
-#if defined(_M_ARM)
-    // Ensure that this function is reported as not implemented for ARM builds because
-    // the instructions below are not present for that architecture.
-    UNIMPLEMENTED();
-    return;
-#else
     __m128i zeroWide = _mm_setzero_si128();
 
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y++)
-        {
-            const uint8_t *source = OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
-            uint32_t *dest = OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-
-            size_t x = 0;
-
-            // Make output writes aligned
-            for (; ((reinterpret_cast<intptr_t>(&dest[x]) & 0xF) != 0 && x < width); x++)
-            {
-                dest[x] = static_cast<uint32_t>(source[x]) << 24;
-            }
-
-            for (; x + 7 < width; x += 8)
-            {
-                __m128i sourceData = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&source[x]));
-                // Interleave each byte to 16bit, make the lower byte to zero
-                sourceData = _mm_unpacklo_epi8(zeroWide, sourceData);
-                // Interleave each 16bit to 32bit, make the lower 16bit to zero
-                __m128i lo = _mm_unpacklo_epi16(zeroWide, sourceData);
-                __m128i hi = _mm_unpackhi_epi16(zeroWide, sourceData);
-
-                _mm_store_si128(reinterpret_cast<__m128i*>(&dest[x]), lo);
-                _mm_store_si128(reinterpret_cast<__m128i*>(&dest[x + 4]), hi);
-            }
-
-            // Handle the remainder
-            for (; x < width; x++)
-            {
-                dest[x] = static_cast<uint32_t>(source[x]) << 24;
-            }
-        }
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        __m128i sourceData = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&source[x]));
+        // Interleave each byte to 16bit, make the lower byte to zero
+        sourceData = _mm_unpacklo_epi8(zeroWide, sourceData);
+        // Interleave each 16bit to 32bit, make the lower 16bit to zero
+        __m128i lo = _mm_unpacklo_epi16(zeroWide, sourceData);
+        __m128i hi = _mm_unpackhi_epi16(zeroWide, sourceData);
+
+        StoreUnaligned(&dest[4 * x], lo);
+        StoreUnaligned(&dest[4 * x + 16], hi);
     }
-#endif
+    return x;
 }
 
-void LoadRGBA8ToBGRA8_SSE2(size_t width, size_t height, size_t depth,
-                           const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
-                           uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+ANGLE_TARGET_SSE2 size_t LoadL8ToRGBA8Row(size_t width, const uint8_t *source, uint8_t *dest)
+{
+    __m128i alpha = _mm_set1_epi8(-1);
+
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        __m128i luminance = LoadUnaligned(&source[x]);
+        // LL and LA pairs, combined into LLLA below
+        __m128i llLo = _mm_unpacklo_epi8(luminance, luminance);
+        __m128i llHi = _mm_unpackhi_epi8(luminance, luminance);
+        __m128i laLo = _mm_unpacklo_epi8(luminance, alpha);
+        __m128i laHi = _mm_unpackhi_epi8(luminance, alpha);
+
+        StoreUnaligned(&dest[4 * x], _mm_unpacklo_epi16(llLo, laLo));
+        StoreUnaligned(&dest[4 * x + 16], _mm_unpackhi_epi16(llLo, laLo));
+        StoreUnaligned(&dest[4 * x + 32], _mm_unpacklo_epi16(llHi, laHi));
+        StoreUnaligned(&dest[4 * x + 48], _mm_unpackhi_epi16(llHi, laHi));
+    }
+    return x;
+}
+
+ANGLE_TARGET_SSE2 size_t LoadLA8ToRGBA8Row(size_t width, const uint8_t *source, uint8_t *dest)
+{
+    __m128i lMask = _mm_set1_epi16(0x00FF);
+
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        __m128i la = LoadUnaligned(&source[2 * x]);
+        __m128i l = _mm_and_si128(la, lMask);
+        __m128i ll = _mm_or_si128(l, _mm_slli_epi16(l, 8));
+
+        StoreUnaligned(&dest[4 * x], _mm_unpacklo_epi16(ll, la));
+        StoreUnaligned(&dest[4 * x + 16], _mm_unpackhi_epi16(ll, la));
+    }
+    return x;
+}
+
+ANGLE_TARGET_SSE2 size_t LoadR8ToBGRX8Row(size_t width, const uint8_t *source, uint8_t *dest)
+{
+    __m128i zeroWide = _mm_setzero_si128();
+    __m128i alpha = _mm_set1_epi8(-1);
+
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        __m128i red = LoadUnaligned(&source[x]);
+        // R and X pairs in the upper half of each pixel, B and G are zero
+        __m128i rxLo = _mm_unpacklo_epi8(red, alpha);
+        __m128i rxHi = _mm_unpackhi_epi8(red, alpha);
+
+        StoreUnaligned(&dest[4 * x], _mm_unpacklo_epi16(zeroWide, rxLo));
+        StoreUnaligned(&dest[4 * x + 16], _mm_unpackhi_epi16(zeroWide, rxLo));
+        StoreUnaligned(&dest[4 * x + 32], _mm_unpacklo_epi16(zeroWide, rxHi));
+        StoreUnaligned(&dest[4 * x + 48], _mm_unpackhi_epi16(zeroWide, rxHi));
+    }
+    return x;
+}
+
+ANGLE_TARGET_SSE2 size_t LoadRG8ToBGRX8Row(size_t width, const uint8_t *source, uint8_t *dest)
+{
+    __m128i gMask = _mm_set1_epi16(static_cast<short>(0xFF00));
+    __m128i alpha = _mm_set1_epi16(static_cast<short>(0xFF00));
+
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        __m128i rg = LoadUnaligned(&source[2 * x]);
+        // B is zero
+        __m128i bg = _mm_and_si128(rg, gMask);
+        __m128i rx = _mm_or_si128(_mm_andnot_si128(gMask, rg), alpha);
+
+        StoreUnaligned(&dest[4 * x], _mm_unpacklo_epi16(bg, rx));
+        StoreUnaligned(&dest[4 * x + 16], _mm_unpackhi_epi16(bg, rx));
+    }
+    return x;
+}
+
+// Gathers 4 RGB pixels into the low 3 bytes of each lane. Reads one byte past
+// the last pixel.
+inline ANGLE_TARGET_SSE2 __m128i LoadRGB8Pixels(const uint8_t *source)
+{
+    return _mm_setr_epi32(ReadUnaligned32(source), ReadUnaligned32(source + 3),
+                          ReadUnaligned32(source + 6), ReadUnaligned32(source + 9));
+}
+
+ANGLE_TARGET_SSE2 size_t LoadRGB8ToBGRX8Row(size_t width, const uint8_t *source, uint8_t *dest)
+{
+    __m128i byteMask = _mm_set1_epi32(0xFF);
+    __m128i gMask = _mm_set1_epi32(0xFF00);
+    __m128i alpha = _mm_set1_epi32(static_cast<int>(0xFF000000));
+
+    size_t x = 0;
+    // Leave a pixel after each group for the over-read
+    for (; x + 5 <= width; x += 4)
+    {
+        __m128i rgb = LoadRGB8Pixels(&source[3 * x]);
+        __m128i b = _mm_and_si128(_mm_srli_epi32(rgb, 16), byteMask);
+        __m128i g = _mm_and_si128(rgb, gMask);
+        __m128i r = _mm_slli_epi32(_mm_and_si128(rgb, byteMask), 16);
+
+        StoreUnaligned(&dest[4 * x], _mm_or_si128(_mm_or_si128(b, g), _mm_or_si128(r, alpha)));
+    }
+    return x;
+}
+
+ANGLE_TARGET_SSE2 size_t LoadRGB8ToRGBX8Row(size_t width, const uint8_t *source, uint8_t *dest)
+{
+    __m128i alpha = _mm_set1_epi32(static_cast<int>(0xFF000000));
+
+    size_t x = 0;
+    for (; x + 5 <= width; x += 4)
+    {
+        // The byte read past each pixel is overwritten by the alpha
+        StoreUnaligned(&dest[4 * x], _mm_or_si128(LoadRGB8Pixels(&source[3 * x]), alpha));
+    }
+    return x;
+}
+
+ANGLE_TARGET_SSE2 size_t LoadRGBA8ToBGRA8Row(size_t width, const uint8_t *source, uint8_t *dest)
 {
-#if defined(_M_ARM)
-    // Ensure that this function is reported as not implemented for ARM builds because
-    // the instructions below are not present for that architecture.
-    UNIMPLEMENTED();
-    return;
-#else
     __m128i brMask = _mm_set1_epi32(0x00ff00ff);
 
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y++)
-        {
-            const uint32_t *source = OffsetDataPointer<uint32_t>(input, y, z, inputRowPitch, inputDepthPitch);
-            uint32_t *dest = OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-
-            size_t x = 0;
-
-            // Make output writes aligned
-            for (; ((reinterpret_cast<intptr_t>(&dest[x]) & 15) != 0) && x < width; x++)
-            {
-                uint32_t rgba = source[x];
-                dest[x] = (_rotl(rgba, 16) & 0x00ff00ff) | (rgba & 0xff00ff00);
-            }
-
-            for (; x + 3 < width; x += 4)
-            {
-                __m128i sourceData = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&source[x]));
-                // Mask out g and a, which don't change
-                __m128i gaComponents = _mm_andnot_si128(brMask, sourceData);
-                // Mask out b and r
-                __m128i brComponents = _mm_and_si128(sourceData, brMask);
-                // Swap b and r
-                __m128i brSwapped = _mm_shufflehi_epi16(_mm_shufflelo_epi16(brComponents, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
-                __m128i result = _mm_or_si128(gaComponents, brSwapped);
-                _mm_store_si128(reinterpret_cast<__m128i*>(&dest[x]), result);
-            }
-
-            // Perform leftover writes
-            for (; x < width; x++)
-            {
-                uint32_t rgba = source[x];
-                dest[x] = (_rotl(rgba, 16) & 0x00ff00ff) | (rgba & 0xff00ff00);
-            }
-        }
+    size_t x = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+        __m128i sourceData = LoadUnaligned(&source[4 * x]);
+        // Mask out g and a, which don't change
+        __m128i gaComponents = _mm_andnot_si128(brMask, sourceData);
+        // Mask out b and r
+        __m128i brComponents = _mm_and_si128(sourceData, brMask);
+        // Swap b and r
+        __m128i brSwapped = _mm_shufflehi_epi16(_mm_shufflelo_epi16(brComponents, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+        StoreUnaligned(&dest[4 * x], _mm_or_si128(gaComponents, brSwapped));
     }
-#endif
+    return x;
+}
+
+template <typename Layout>
+ANGLE_TARGET_SSE2 size_t LoadPacked16ToRGBA8Row(size_t width, const uint8_t *source, uint8_t *dest)
+{
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        __m128i pixels = LoadUnaligned(&source[2 * x]);
+        __m128i c0 = ExpandChannel16<Layout::Shift0, Layout::Bits0>(pixels);
+        __m128i c1 = ExpandChannel16<Layout::Shift1, Layout::Bits1>(pixels);
+        __m128i c2 = ExpandChannel16<Layout::Shift2, Layout::Bits2>(pixels);
+        __m128i c3 = ExpandChannel16<Layout::Shift3, Layout::Bits3>(pixels);
+
+        __m128i c01 = _mm_or_si128(c0, _mm_slli_epi16(c1, 8));
+        __m128i c23 = _mm_or_si128(c2, _mm_slli_epi16(c3, 8));
+
+        StoreUnaligned(&dest[4 * x], _mm_unpacklo_epi16(c01, c23));
+        StoreUnaligned(&dest[4 * x + 16], _mm_unpackhi_epi16(c01, c23));
+    }
+    return x;
+}
+
+template <typename Layout>
+ANGLE_TARGET_SSE2 size_t LoadPacked32ToRGBA8Row(size_t width, const uint8_t *source, uint8_t *dest)
+{
+    size_t x = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+        __m128i pixels = LoadUnaligned(&source[4 * x]);
+        __m128i c0 = ExpandChannel32<Layout::Shift0, Layout::Bits0>(pixels);
+        __m128i c1 = ExpandChannel32<Layout::Shift1, Layout::Bits1>(pixels);
+        __m128i c2 = ExpandChannel32<Layout::Shift2, Layout::Bits2>(pixels);
+        __m128i c3 = ExpandChannel32<Layout::Shift3, Layout::Bits3>(pixels);
+
+        __m128i c01 = _mm_or_si128(c0, _mm_slli_epi32(c1, 8));
+        __m128i c23 = _mm_or_si128(_mm_slli_epi32(c2, 16), _mm_slli_epi32(c3, 24));
+        StoreUnaligned(&dest[4 * x], _mm_or_si128(c01, c23));
+    }
+    return x;
 }
 
+const LoadImageFunction kLoadImageKernelsSSE2[LOAD_IMAGE_KERNEL_COUNT] =
+{
+    LoadImageRows<LOAD_IMAGE_A8_TO_RGBA8, LoadA8ToRGBA8Row>,
+    LoadImageRows<LOAD_IMAGE_L8_TO_RGBA8, LoadL8ToRGBA8Row>,
+    LoadImageRows<LOAD_IMAGE_LA8_TO_RGBA8, LoadLA8ToRGBA8Row>,
+    LoadImageRows<LOAD_IMAGE_R8_TO_BGRX8, LoadR8ToBGRX8Row>,
+    LoadImageRows<LOAD_IMAGE_RG8_TO_BGRX8, LoadRG8ToBGRX8Row>,
+    LoadImageRows<LOAD_IMAGE_RGB8_TO_BGRX8, LoadRGB8ToBGRX8Row>,
+    LoadImageRows<LOAD_IMAGE_RGB8_TO_RGBX8, LoadRGB8ToRGBX8Row>,
+    LoadImageRows<LOAD_IMAGE_RGBA8_TO_BGRA8, LoadRGBA8ToBGRA8Row>,
+    LoadImageRows<LOAD_IMAGE_R5G6B5_TO_BGRA8, LoadPacked16ToRGBA8Row<R5G6B5ToBGRA8Layout> >,
+    LoadImageRows<LOAD_IMAGE_R5G6B5_TO_RGBA8, LoadPacked16ToRGBA8Row<R5G6B5ToRGBA8Layout> >,
+    LoadImageRows<LOAD_IMAGE_RGBA4_TO_BGRA8, LoadPacked16ToRGBA8Row<RGBA4ToBGRA8Layout> >,
+    LoadImageRows<LOAD_IMAGE_RGBA4_TO_RGBA8, LoadPacked16ToRGBA8Row<RGBA4ToRGBA8Layout> >,
+    LoadImageRows<LOAD_IMAGE_RGB5A1_TO_BGRA8, LoadPacked16ToRGBA8Row<RGB5A1ToBGRA8Layout> >,
+    LoadImageRows<LOAD_IMAGE_RGB5A1_TO_RGBA8, LoadPacked16ToRGBA8Row<RGB5A1ToRGBA8Layout> >,
+    LoadImageRows<LOAD_IMAGE_RGB10A2_TO_RGBA8, LoadPacked32ToRGBA8Row<RGB10A2ToRGBA8Layout> >,
+};
+
+}
+
+const LoadImageFunction *GetLoadImageKernelsSSE2()
+{
+    return kLoadImageKernelsSSE2;
+}
+
+#else
+
+const LoadImageFunction *GetLoadImageKernelsSSE2()
+{
+    return NULL;
+}
+
+#endif
+
 }
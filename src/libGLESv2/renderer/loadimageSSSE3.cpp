@@ -0,0 +1,185 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// loadimageSSSE3.cpp: Image loading functions that rearrange bytes with
+// PSHUFB.
+
+#include "libGLESv2/renderer/loadimageSIMD.h"
+
+#if defined(ANGLE_CPU_X86)
+#   include <tmmintrin.h>
+#endif
+
+namespace rx
+{
+
+#if defined(ANGLE_CPU_X86)
+
+namespace
+{
+
+// Builds the shuffle mask that makes 4 output pixels, the first from input
+// pixel |firstPixel|. |pixelBytes| gives the input byte of each output byte,
+// or -1 for a zero byte.
+inline ANGLE_TARGET_SSSE3 __m128i MakeShuffleMask(const int pixelBytes[4], size_t inputPixelBytes, size_t firstPixel)
+{
+    char mask[16];
+    for (size_t i = 0; i < 16; i++)
+    {
+        int byte = pixelBytes[i % 4];
+        mask[i] = (byte < 0) ? static_cast<char>(0x80)
+                             : static_cast<char>(byte + (firstPixel + i / 4) * inputPixelBytes);
+    }
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask));
+}
+
+// Rearranges each input pixel into a 4-byte output pixel, and ORs |fill| into
+// it.
+template <size_t inputPixelBytes>
+ANGLE_TARGET_SSSE3 size_t ShuffleRow(size_t width, const uint8_t *source, uint8_t *dest,
+                                     const int pixelBytes[4], uint32_t fill)
+{
+    const size_t pixelsPerLoad = 16 / inputPixelBytes;
+    const size_t storesPerLoad = pixelsPerLoad / 4;
+
+    __m128i masks[4];
+    for (size_t i = 0; i < storesPerLoad; i++)
+    {
+        masks[i] = MakeShuffleMask(pixelBytes, inputPixelBytes, 4 * i);
+    }
+    __m128i fillWide = _mm_set1_epi32(static_cast<int>(fill));
+
+    size_t x = 0;
+    for (; x + pixelsPerLoad <= width; x += pixelsPerLoad)
+    {
+        __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&source[x * inputPixelBytes]));
+        for (size_t i = 0; i < storesPerLoad; i++)
+        {
+            __m128i result = _mm_or_si128(_mm_shuffle_epi8(pixels, masks[i]), fillWide);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&dest[4 * (x + 4 * i)]), result);
+        }
+    }
+    return x;
+}
+
+// RGB pixels don't fit a register evenly; 3 registers hold 16 pixels.
+ANGLE_TARGET_SSSE3 size_t ShuffleRGBRow(size_t width, const uint8_t *source, uint8_t *dest,
+                                        const int pixelBytes[4])
+{
+    __m128i mask = MakeShuffleMask(pixelBytes, 3, 0);
+    __m128i alpha = _mm_set1_epi32(static_cast<int>(0xFF000000));
+
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        const __m128i *input = reinterpret_cast<const __m128i*>(&source[3 * x]);
+        __m128i in0 = _mm_loadu_si128(input);
+        __m128i in1 = _mm_loadu_si128(input + 1);
+        __m128i in2 = _mm_loadu_si128(input + 2);
+
+        // Move each group of 4 pixels to the bottom of a register
+        __m128i groups[4] =
+        {
+            in0,
+            _mm_alignr_epi8(in1, in0, 12),
+            _mm_alignr_epi8(in2, in1, 8),
+            _mm_srli_si128(in2, 4),
+        };
+
+        __m128i *output = reinterpret_cast<__m128i*>(&dest[4 * x]);
+        for (size_t i = 0; i < 4; i++)
+        {
+            _mm_storeu_si128(output + i, _mm_or_si128(_mm_shuffle_epi8(groups[i], mask), alpha));
+        }
+    }
+    return x;
+}
+
+ANGLE_TARGET_SSSE3 size_t LoadA8ToRGBA8Row(size_t width, const uint8_t *source, uint8_t *dest)
+{
+    const int pixelBytes[4] = { -1, -1, -1, 0 };
+    return ShuffleRow<1>(width, source, dest, pixelBytes, 0);
+}
+
+ANGLE_TARGET_SSSE3 size_t LoadL8ToRGBA8Row(size_t width, const uint8_t *source, uint8_t *dest)
+{
+    const int pixelBytes[4] = { 0, 0, 0, -1 };
+    return ShuffleRow<1>(width, source, dest, pixelBytes, 0xFF000000);
+}
+
+ANGLE_TARGET_SSSE3 size_t LoadLA8ToRGBA8Row(size_t width, const uint8_t *source, uint8_t *dest)
+{
+    const int pixelBytes[4] = { 0, 0, 0, 1 };
+    return ShuffleRow<2>(width, source, dest, pixelBytes, 0);
+}
+
+ANGLE_TARGET_SSSE3 size_t LoadR8ToBGRX8Row(size_t width, const uint8_t *source, uint8_t *dest)
+{
+    const int pixelBytes[4] = { -1, -1, 0, -1 };
+    return ShuffleRow<1>(width, source, dest, pixelBytes, 0xFF000000);
+}
+
+ANGLE_TARGET_SSSE3 size_t LoadRG8ToBGRX8Row(size_t width, const uint8_t *source, uint8_t *dest)
+{
+    const int pixelBytes[4] = { -1, 1, 0, -1 };
+    return ShuffleRow<2>(width, source, dest, pixelBytes, 0xFF000000);
+}
+
+ANGLE_TARGET_SSSE3 size_t LoadRGB8ToBGRX8Row(size_t width, const uint8_t *source, uint8_t *dest)
+{
+    const int pixelBytes[4] = { 2, 1, 0, -1 };
+    return ShuffleRGBRow(width, source, dest, pixelBytes);
+}
+
+ANGLE_TARGET_SSSE3 size_t LoadRGB8ToRGBX8Row(size_t width, const uint8_t *source, uint8_t *dest)
+{
+    const int pixelBytes[4] = { 0, 1, 2, -1 };
+    return ShuffleRGBRow(width, source, dest, pixelBytes);
+}
+
+ANGLE_TARGET_SSSE3 size_t LoadRGBA8ToBGRA8Row(size_t width, const uint8_t *source, uint8_t *dest)
+{
+    const int pixelBytes[4] = { 2, 1, 0, 3 };
+    return ShuffleRow<4>(width, source, dest, pixelBytes, 0);
+}
+
+// The packed formats need shifts, not shuffles; the SSE2 versions are used.
+const LoadImageFunction kLoadImageKernelsSSSE3[LOAD_IMAGE_KERNEL_COUNT] =
+{
+    LoadImageRows<LOAD_IMAGE_A8_TO_RGBA8, LoadA8ToRGBA8Row>,
+    LoadImageRows<LOAD_IMAGE_L8_TO_RGBA8, LoadL8ToRGBA8Row>,
+    LoadImageRows<LOAD_IMAGE_LA8_TO_RGBA8, LoadLA8ToRGBA8Row>,
+    LoadImageRows<LOAD_IMAGE_R8_TO_BGRX8, LoadR8ToBGRX8Row>,
+    LoadImageRows<LOAD_IMAGE_RG8_TO_BGRX8, LoadRG8ToBGRX8Row>,
+    LoadImageRows<LOAD_IMAGE_RGB8_TO_BGRX8, LoadRGB8ToBGRX8Row>,
+    LoadImageRows<LOAD_IMAGE_RGB8_TO_RGBX8, LoadRGB8ToRGBX8Row>,
+    LoadImageRows<LOAD_IMAGE_RGBA8_TO_BGRA8, LoadRGBA8ToBGRA8Row>,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+};
+
+}
+
+const LoadImageFunction *GetLoadImageKernelsSSSE3()
+{
+    return kLoadImageKernelsSSSE3;
+}
+
+#else
+
+const LoadImageFunction *GetLoadImageKernelsSSSE3()
+{
+    return NULL;
+}
+
+#endif
+
+}
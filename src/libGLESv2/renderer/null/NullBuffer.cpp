@@ -0,0 +1,326 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// NullBuffer.cpp: Implements the buffers of the null back-end.
+
+#include "libGLESv2/renderer/null/NullBuffer.h"
+#include "libGLESv2/renderer/null/NullRenderer.h"
+#include "libGLESv2/Buffer.h"
+#include "libGLESv2/VertexAttribute.h"
+#include "libGLESv2/main.h"
+#include "common/mathutil.h"
+
+#include <limits>
+
+namespace rx
+{
+
+NullBuffer::NullBuffer(NullRenderer *renderer)
+    : BufferD3D(),
+      mRenderer(renderer),
+      mSize(0)
+{
+}
+
+NullBuffer::~NullBuffer()
+{
+}
+
+NullBuffer *NullBuffer::makeNullBuffer(BufferImpl *buffer)
+{
+    ASSERT(HAS_DYNAMIC_TYPE(NullBuffer*, buffer));
+    return static_cast<NullBuffer*>(buffer);
+}
+
+gl::Error NullBuffer::setData(const void *data, size_t size, GLenum usage)
+{
+    if (size > mMemory.size())
+    {
+        if (!mMemory.resize(size))
+        {
+            return gl::Error(GL_OUT_OF_MEMORY, "Failed to resize internal buffer.");
+        }
+    }
+
+    mSize = size;
+    if (data && size > 0)
+    {
+        memcpy(mMemory.data(), data, size);
+    }
+
+    invalidateStaticData();
+
+    if (usage == GL_STATIC_DRAW)
+    {
+        initializeStaticData();
+    }
+
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullBuffer::getData(const uint8_t **outData)
+{
+    *outData = mMemory.data();
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullBuffer::setSubData(const void *data, size_t size, size_t offset)
+{
+    if (offset + size > mMemory.size())
+    {
+        if (!mMemory.resize(offset + size))
+        {
+            return gl::Error(GL_OUT_OF_MEMORY, "Failed to resize internal buffer.");
+        }
+    }
+
+    mSize = std::max(mSize, offset + size);
+    if (data && size > 0)
+    {
+        memcpy(mMemory.data() + offset, data, size);
+    }
+
+    invalidateStaticData();
+
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullBuffer::copySubData(BufferImpl *source, GLintptr sourceOffset, GLintptr destOffset, GLsizeiptr size)
+{
+    NullBuffer *sourceBuffer = makeNullBuffer(source);
+    ASSERT(sourceBuffer);
+
+    // The source and destination may be the same buffer
+    memmove(mMemory.data() + destOffset, sourceBuffer->mMemory.data() + sourceOffset, size);
+
+    invalidateStaticData();
+
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullBuffer::map(size_t offset, size_t length, GLbitfield access, GLvoid **mapPtr)
+{
+    ASSERT(offset + length <= mSize);
+
+    if ((access & GL_MAP_WRITE_BIT) != 0)
+    {
+        invalidateStaticData();
+    }
+
+    *mapPtr = mMemory.data() + offset;
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullBuffer::unmap()
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+void NullBuffer::markTransformFeedbackUsage()
+{
+    // Nothing is ever written by transform feedback
+}
+
+Renderer *NullBuffer::getRenderer()
+{
+    return mRenderer;
+}
+
+NullVertexBuffer::NullVertexBuffer()
+    : VertexBuffer()
+{
+}
+
+NullVertexBuffer::~NullVertexBuffer()
+{
+}
+
+gl::Error NullVertexBuffer::initialize(unsigned int size, bool dynamicUsage)
+{
+    if (size > 0 && !mMemory.resize(size))
+    {
+        return gl::Error(GL_OUT_OF_MEMORY, "Failed to allocate internal vertex buffer of %u bytes.", size);
+    }
+
+    updateSerial();
+
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullVertexBuffer::storeVertexAttributes(const gl::VertexAttribute &attrib, const gl::VertexAttribCurrentValueData &currentValue,
+                                                  GLint start, GLsizei count, GLsizei instances, unsigned int offset)
+{
+    if (mMemory.empty())
+    {
+        return gl::Error(GL_OUT_OF_MEMORY, "Internal vertex buffer is not initialized.");
+    }
+
+    uint8_t *output = mMemory.data() + offset;
+
+    if (!attrib.enabled)
+    {
+        memcpy(output, currentValue.FloatValues, sizeof(currentValue.FloatValues));
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    const uint8_t *input = NULL;
+    gl::Buffer *buffer = attrib.buffer.get();
+    if (buffer)
+    {
+        gl::Error error = BufferD3D::makeFromBuffer(buffer)->getData(&input);
+        if (error.isError())
+        {
+            return error;
+        }
+        input += static_cast<int>(attrib.offset);
+    }
+    else
+    {
+        input = static_cast<const uint8_t*>(attrib.pointer);
+    }
+
+    size_t inputStride = gl::ComputeVertexAttributeStride(attrib);
+    if (instances == 0 || attrib.divisor == 0)
+    {
+        input += inputStride * start;
+    }
+
+    size_t elementSize = gl::ComputeVertexAttributeTypeSize(attrib);
+    for (GLsizei i = 0; i < count; i++)
+    {
+        memcpy(output + i * elementSize, input + i * inputStride, elementSize);
+    }
+
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullVertexBuffer::getSpaceRequired(const gl::VertexAttribute &attrib, GLsizei count, GLsizei instances,
+                                             unsigned int *outSpaceRequired) const
+{
+    unsigned int elementCount = 0;
+    unsigned int elementSize = 0;
+    if (attrib.enabled)
+    {
+        if (instances == 0 || attrib.divisor == 0)
+        {
+            elementCount = count;
+        }
+        else
+        {
+            // Round up to divisor, if possible
+            elementCount = rx::UnsignedCeilDivide(static_cast<unsigned int>(instances), attrib.divisor);
+        }
+        elementSize = static_cast<unsigned int>(gl::ComputeVertexAttributeTypeSize(attrib));
+    }
+    else
+    {
+        elementCount = 1;
+        elementSize = sizeof(GLfloat) * 4;
+    }
+
+    if (elementCount > 0 && elementSize > std::numeric_limits<unsigned int>::max() / elementCount)
+    {
+        return gl::Error(GL_OUT_OF_MEMORY, "New vertex buffer size would result in an overflow.");
+    }
+
+    if (outSpaceRequired)
+    {
+        *outSpaceRequired = elementSize * elementCount;
+    }
+    return gl::Error(GL_NO_ERROR);
+}
+
+unsigned int NullVertexBuffer::getBufferSize() const
+{
+    return static_cast<unsigned int>(mMemory.size());
+}
+
+gl::Error NullVertexBuffer::setBufferSize(unsigned int size)
+{
+    if (size > mMemory.size())
+    {
+        return initialize(size, true);
+    }
+
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullVertexBuffer::discard()
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+NullIndexBuffer::NullIndexBuffer()
+    : IndexBuffer(),
+      mIndexType(GL_NONE)
+{
+}
+
+NullIndexBuffer::~NullIndexBuffer()
+{
+}
+
+gl::Error NullIndexBuffer::initialize(unsigned int bufferSize, GLenum indexType, bool dynamic)
+{
+    if (bufferSize > 0 && !mMemory.resize(bufferSize))
+    {
+        return gl::Error(GL_OUT_OF_MEMORY, "Failed to allocate internal index buffer of %u bytes.", bufferSize);
+    }
+
+    mIndexType = indexType;
+    updateSerial();
+
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullIndexBuffer::mapBuffer(unsigned int offset, unsigned int size, void** outMappedMemory)
+{
+    if (mMemory.empty())
+    {
+        return gl::Error(GL_OUT_OF_MEMORY, "Internal index buffer is not initialized.");
+    }
+
+    // Check for integer overflows and out-out-bounds map requests
+    if (offset + size < offset || offset + size > mMemory.size())
+    {
+        return gl::Error(GL_OUT_OF_MEMORY, "Index buffer map range is not inside the buffer.");
+    }
+
+    *outMappedMemory = mMemory.data() + offset;
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullIndexBuffer::unmapBuffer()
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+GLenum NullIndexBuffer::getIndexType() const
+{
+    return mIndexType;
+}
+
+unsigned int NullIndexBuffer::getBufferSize() const
+{
+    return static_cast<unsigned int>(mMemory.size());
+}
+
+gl::Error NullIndexBuffer::setSize(unsigned int bufferSize, GLenum indexType)
+{
+    if (bufferSize > mMemory.size() || indexType != mIndexType)
+    {
+        return initialize(std::max<unsigned int>(bufferSize, getBufferSize()), indexType, true);
+    }
+
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullIndexBuffer::discard()
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+}
@@ -0,0 +1,105 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// NullBuffer.h: Defines the buffers of the null back-end, which keep their
+// data in system memory.
+
+#ifndef LIBGLESV2_RENDERER_NULLBUFFER_H_
+#define LIBGLESV2_RENDERER_NULLBUFFER_H_
+
+#include "libGLESv2/renderer/d3d/BufferD3D.h"
+#include "libGLESv2/renderer/d3d/IndexBuffer.h"
+#include "libGLESv2/renderer/d3d/MemoryBuffer.h"
+#include "libGLESv2/renderer/d3d/VertexBuffer.h"
+
+namespace rx
+{
+class NullRenderer;
+
+class NullBuffer : public BufferD3D
+{
+  public:
+    explicit NullBuffer(NullRenderer *renderer);
+    virtual ~NullBuffer();
+
+    static NullBuffer *makeNullBuffer(BufferImpl *buffer);
+
+    // BufferD3D implementation
+    virtual size_t getSize() const { return mSize; }
+    // The data is drawn from where it is, like a buffer the GPU can read
+    virtual bool supportsDirectBinding() const { return true; }
+    virtual Renderer *getRenderer();
+
+    // BufferImpl implementation
+    virtual gl::Error setData(const void *data, size_t size, GLenum usage);
+    virtual gl::Error getData(const uint8_t **outData);
+    virtual gl::Error setSubData(const void *data, size_t size, size_t offset);
+    virtual gl::Error copySubData(BufferImpl *source, GLintptr sourceOffset, GLintptr destOffset, GLsizeiptr size);
+    virtual gl::Error map(size_t offset, size_t length, GLbitfield access, GLvoid **mapPtr);
+    virtual gl::Error unmap();
+    virtual void markTransformFeedbackUsage();
+
+  private:
+    DISALLOW_COPY_AND_ASSIGN(NullBuffer);
+
+    NullRenderer *mRenderer;
+    MemoryBuffer mMemory;
+    size_t mSize;
+};
+
+class NullVertexBuffer : public VertexBuffer
+{
+  public:
+    NullVertexBuffer();
+    virtual ~NullVertexBuffer();
+
+    virtual gl::Error initialize(unsigned int size, bool dynamicUsage);
+
+    // Stores the attributes unconverted, since this back-end reads every
+    // vertex format as it is
+    virtual gl::Error storeVertexAttributes(const gl::VertexAttribute &attrib, const gl::VertexAttribCurrentValueData &currentValue,
+                                            GLint start, GLsizei count, GLsizei instances, unsigned int offset);
+
+    virtual gl::Error getSpaceRequired(const gl::VertexAttribute &attrib, GLsizei count, GLsizei instances,
+                                       unsigned int *outSpaceRequired) const;
+
+    virtual unsigned int getBufferSize() const;
+    virtual gl::Error setBufferSize(unsigned int size);
+    virtual gl::Error discard();
+
+  private:
+    DISALLOW_COPY_AND_ASSIGN(NullVertexBuffer);
+
+    MemoryBuffer mMemory;
+};
+
+class NullIndexBuffer : public IndexBuffer
+{
+  public:
+    NullIndexBuffer();
+    virtual ~NullIndexBuffer();
+
+    virtual gl::Error initialize(unsigned int bufferSize, GLenum indexType, bool dynamic);
+
+    virtual gl::Error mapBuffer(unsigned int offset, unsigned int size, void** outMappedMemory);
+    virtual gl::Error unmapBuffer();
+
+    virtual GLenum getIndexType() const;
+    virtual unsigned int getBufferSize() const;
+    virtual gl::Error setSize(unsigned int bufferSize, GLenum indexType);
+
+    virtual gl::Error discard();
+
+  private:
+    DISALLOW_COPY_AND_ASSIGN(NullIndexBuffer);
+
+    MemoryBuffer mMemory;
+    GLenum mIndexType;
+};
+
+}
+
+#endif // LIBGLESV2_RENDERER_NULLBUFFER_H_
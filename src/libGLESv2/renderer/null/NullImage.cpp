@@ -0,0 +1,138 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// NullImage.cpp: Implements the rx::NullImage class.
+
+#include "libGLESv2/renderer/null/NullImage.h"
+#include "libGLESv2/formatutils.h"
+#include "libGLESv2/main.h"
+#include "common/mathutil.h"
+
+namespace rx
+{
+
+NullImage::NullImage()
+    : ImageD3D(),
+      mRowPitch(0),
+      mDepthPitch(0)
+{
+}
+
+NullImage::~NullImage()
+{
+}
+
+NullImage *NullImage::makeNullImage(Image *img)
+{
+    ASSERT(HAS_DYNAMIC_TYPE(NullImage*, img));
+    return static_cast<NullImage*>(img);
+}
+
+bool NullImage::isDirty() const
+{
+    return mDirty;
+}
+
+bool NullImage::redefine(Renderer *renderer, GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, bool forceRelease)
+{
+    if (mWidth != width ||
+        mHeight != height ||
+        mDepth != depth ||
+        mInternalFormat != internalformat ||
+        forceRelease)
+    {
+        mWidth = width;
+        mHeight = height;
+        mDepth = depth;
+        mInternalFormat = internalformat;
+        mTarget = target;
+
+        // Every format is stored and rendered to as it is
+        mActualFormat = internalformat;
+        mRenderable = true;
+
+        const gl::InternalFormat &formatInfo = gl::GetInternalFormatInfo(internalformat);
+        GLuint blockWidth = formatInfo.compressed ? formatInfo.compressedBlockWidth : 1;
+        GLuint blockHeight = formatInfo.compressed ? formatInfo.compressedBlockHeight : 1;
+        mRowPitch = formatInfo.pixelBytes * UnsignedCeilDivide(static_cast<GLuint>(width), blockWidth);
+        mDepthPitch = mRowPitch * UnsignedCeilDivide(static_cast<GLuint>(height), blockHeight);
+
+        mData.clear();
+        mData.resize(mDepthPitch * std::max(depth, 1));
+        mDirty = false;
+
+        return true;
+    }
+
+    return false;
+}
+
+void NullImage::loadRows(size_t byteOffset, GLint row, GLint layer, GLsizei rowCount, GLsizei depth, size_t rowBytes,
+                         const uint8_t *input, GLuint inputRowPitch, GLuint inputDepthPitch)
+{
+    for (GLsizei z = 0; z < depth; z++)
+    {
+        for (GLsizei y = 0; y < rowCount; y++)
+        {
+            size_t outputOffset = (layer + z) * mDepthPitch + (row + y) * mRowPitch + byteOffset;
+            ASSERT(outputOffset + rowBytes <= mData.size());
+            memcpy(&mData[outputOffset], input + z * inputDepthPitch + y * inputRowPitch, rowBytes);
+        }
+    }
+}
+
+gl::Error NullImage::loadData(GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth,
+                              GLint unpackAlignment, GLint unpackRowLength, GLenum type, const void *input)
+{
+    const gl::InternalFormat &formatInfo = gl::GetInternalFormatInfo(mInternalFormat);
+    GLuint inputRowPitch = formatInfo.computeRowPitch(type, width, unpackAlignment, unpackRowLength);
+    GLuint inputDepthPitch = formatInfo.computeDepthPitch(type, width, height, unpackAlignment, unpackRowLength);
+
+    // The client's type may be wider or narrower than the stored format, so
+    // only as much of each row as both hold is kept
+    size_t rowBytes = std::min<size_t>(formatInfo.computeBlockSize(type, width, 1), formatInfo.pixelBytes * width);
+
+    loadRows(xoffset * formatInfo.pixelBytes, yoffset, zoffset, height, depth, rowBytes,
+             static_cast<const uint8_t*>(input), inputRowPitch, inputDepthPitch);
+
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullImage::loadCompressedData(GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth,
+                                        const void *input)
+{
+    const gl::InternalFormat &formatInfo = gl::GetInternalFormatInfo(mInternalFormat);
+    GLuint inputRowPitch = formatInfo.computeRowPitch(GL_UNSIGNED_BYTE, width, 1, 0);
+    GLuint inputDepthPitch = formatInfo.computeDepthPitch(GL_UNSIGNED_BYTE, width, height, 1, 0);
+
+    ASSERT(xoffset % formatInfo.compressedBlockWidth == 0);
+    ASSERT(yoffset % formatInfo.compressedBlockHeight == 0);
+
+    GLsizei blockRows = UnsignedCeilDivide(static_cast<GLuint>(height), formatInfo.compressedBlockHeight);
+    loadRows((xoffset / formatInfo.compressedBlockWidth) * formatInfo.pixelBytes, yoffset / formatInfo.compressedBlockHeight,
+             zoffset, blockRows, depth, inputRowPitch, static_cast<const uint8_t*>(input), inputRowPitch, inputDepthPitch);
+
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullImage::copy(GLint xoffset, GLint yoffset, GLint zoffset, const gl::Rectangle &sourceArea, RenderTarget *source)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullImage::copy(GLint xoffset, GLint yoffset, GLint zoffset, const gl::Rectangle &sourceArea,
+                          const gl::ImageIndex &sourceIndex, TextureStorage *source)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullImage::copyToStorage(TextureStorage *storage, const gl::ImageIndex &index, const gl::Box &region)
+{
+    // The storage keeps nothing, so there is nothing to copy to
+    return gl::Error(GL_NO_ERROR);
+}
+
+}
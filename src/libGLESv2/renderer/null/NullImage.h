@@ -0,0 +1,62 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// NullImage.h: Defines the rx::NullImage class, an image of the null
+// back-end that keeps the pixels it is given in system memory.
+
+#ifndef LIBGLESV2_RENDERER_NULLIMAGE_H_
+#define LIBGLESV2_RENDERER_NULLIMAGE_H_
+
+#include "libGLESv2/renderer/d3d/ImageD3D.h"
+
+#include <vector>
+
+namespace rx
+{
+
+class NullImage : public ImageD3D
+{
+  public:
+    NullImage();
+    virtual ~NullImage();
+
+    static NullImage *makeNullImage(Image *img);
+
+    virtual bool isDirty() const;
+
+    virtual bool redefine(Renderer *renderer, GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, bool forceRelease);
+
+    // The pixels are stored as they are given, in the layout of the internal
+    // format, without converting them.
+    virtual gl::Error loadData(GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth,
+                               GLint unpackAlignment, GLint unpackRowLength, GLenum type, const void *input);
+    virtual gl::Error loadCompressedData(GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth,
+                                         const void *input);
+
+    // Nothing is ever rendered, so copies from framebuffers and textures
+    // leave the image as it was.
+    virtual gl::Error copy(GLint xoffset, GLint yoffset, GLint zoffset, const gl::Rectangle &sourceArea, RenderTarget *source);
+    virtual gl::Error copy(GLint xoffset, GLint yoffset, GLint zoffset, const gl::Rectangle &sourceArea,
+                           const gl::ImageIndex &sourceIndex, TextureStorage *source);
+
+    virtual gl::Error copyToStorage(TextureStorage *storage, const gl::ImageIndex &index, const gl::Box &region);
+
+  private:
+    DISALLOW_COPY_AND_ASSIGN(NullImage);
+
+    // Copies |rowCount| rows of |rowBytes| bytes into each of |depth|
+    // layers, starting |byteOffset| bytes into row |row| of layer |layer|.
+    void loadRows(size_t byteOffset, GLint row, GLint layer, GLsizei rowCount, GLsizei depth, size_t rowBytes,
+                  const uint8_t *input, GLuint inputRowPitch, GLuint inputDepthPitch);
+
+    size_t mRowPitch;
+    size_t mDepthPitch;
+    std::vector<uint8_t> mData;
+};
+
+}
+
+#endif // LIBGLESV2_RENDERER_NULLIMAGE_H_
@@ -0,0 +1,101 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// NullQuery.h: Defines the queries and fences of the null back-end. No work
+// is ever queued, so every query has finished with a result of zero and
+// every fence is already signaled.
+
+#ifndef LIBGLESV2_RENDERER_NULLQUERY_H_
+#define LIBGLESV2_RENDERER_NULLQUERY_H_
+
+#include "libGLESv2/renderer/FenceImpl.h"
+#include "libGLESv2/renderer/QueryImpl.h"
+
+namespace rx
+{
+
+class NullQuery : public QueryImpl
+{
+  public:
+    explicit NullQuery(GLenum type)
+        : QueryImpl(type)
+    {
+    }
+
+    virtual ~NullQuery() { }
+
+    virtual gl::Error begin() { return gl::Error(GL_NO_ERROR); }
+    virtual gl::Error end() { return gl::Error(GL_NO_ERROR); }
+
+    virtual gl::Error getResult(GLuint *params)
+    {
+        *params = 0;
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    virtual gl::Error isResultAvailable(GLuint *available)
+    {
+        *available = GL_TRUE;
+        return gl::Error(GL_NO_ERROR);
+    }
+
+  private:
+    DISALLOW_COPY_AND_ASSIGN(NullQuery);
+};
+
+class NullFenceNV : public FenceNVImpl
+{
+  public:
+    NullFenceNV() { }
+    virtual ~NullFenceNV() { }
+
+    virtual gl::Error set() { return gl::Error(GL_NO_ERROR); }
+
+    virtual gl::Error test(bool flushCommandBuffer, GLboolean *outFinished)
+    {
+        *outFinished = GL_TRUE;
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    virtual gl::Error finishFence(GLboolean *outFinished)
+    {
+        *outFinished = GL_TRUE;
+        return gl::Error(GL_NO_ERROR);
+    }
+
+  private:
+    DISALLOW_COPY_AND_ASSIGN(NullFenceNV);
+};
+
+class NullFenceSync : public FenceSyncImpl
+{
+  public:
+    NullFenceSync() { }
+    virtual ~NullFenceSync() { }
+
+    virtual gl::Error set() { return gl::Error(GL_NO_ERROR); }
+
+    virtual gl::Error clientWait(GLbitfield flags, GLuint64 timeout, GLenum *outResult)
+    {
+        *outResult = GL_ALREADY_SIGNALED;
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    virtual gl::Error serverWait(GLbitfield flags, GLuint64 timeout) { return gl::Error(GL_NO_ERROR); }
+
+    virtual gl::Error getStatus(GLint *outResult)
+    {
+        *outResult = GL_SIGNALED;
+        return gl::Error(GL_NO_ERROR);
+    }
+
+  private:
+    DISALLOW_COPY_AND_ASSIGN(NullFenceSync);
+};
+
+}
+
+#endif // LIBGLESV2_RENDERER_NULLQUERY_H_
@@ -0,0 +1,81 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// NullRenderTarget.h: Defines the render targets and swap chain of the null
+// back-end, which only track their size and format.
+
+#ifndef LIBGLESV2_RENDERER_NULLRENDERTARGET_H_
+#define LIBGLESV2_RENDERER_NULLRENDERTARGET_H_
+
+#include "libGLESv2/renderer/RenderTarget.h"
+#include "libGLESv2/renderer/SwapChain.h"
+
+namespace rx
+{
+
+class NullRenderTarget : public RenderTarget
+{
+  public:
+    NullRenderTarget(GLsizei width, GLsizei height, GLsizei depth, GLenum internalFormat, GLsizei samples)
+    {
+        mWidth = width;
+        mHeight = height;
+        mDepth = depth;
+        mInternalFormat = internalFormat;
+        mActualFormat = internalFormat;
+        mSamples = samples;
+    }
+
+    virtual ~NullRenderTarget() { }
+
+    virtual void invalidate(GLint x, GLint y, GLsizei width, GLsizei height) { }
+
+  private:
+    DISALLOW_COPY_AND_ASSIGN(NullRenderTarget);
+};
+
+class NullSwapChain : public SwapChain
+{
+  public:
+    NullSwapChain(rx::NativeWindow nativeWindow, HANDLE shareHandle, GLenum backBufferFormat, GLenum depthBufferFormat)
+        : SwapChain(nativeWindow, shareHandle, backBufferFormat, depthBufferFormat),
+          mWidth(0),
+          mHeight(0)
+    {
+    }
+
+    virtual ~NullSwapChain() { }
+
+    virtual EGLint resize(EGLint backbufferWidth, EGLint backbufferHeight)
+    {
+        mWidth = backbufferWidth;
+        mHeight = backbufferHeight;
+        return EGL_SUCCESS;
+    }
+
+    virtual EGLint reset(EGLint backbufferWidth, EGLint backbufferHeight, EGLint swapInterval)
+    {
+        return resize(backbufferWidth, backbufferHeight);
+    }
+
+    virtual EGLint swapRect(EGLint x, EGLint y, EGLint width, EGLint height) { return EGL_SUCCESS; }
+    virtual void recreate() { }
+
+    EGLint getWidth() const { return mWidth; }
+    EGLint getHeight() const { return mHeight; }
+    GLenum getBackBufferFormat() const { return mBackBufferFormat; }
+    GLenum getDepthBufferFormat() const { return mDepthBufferFormat; }
+
+  private:
+    DISALLOW_COPY_AND_ASSIGN(NullSwapChain);
+
+    EGLint mWidth;
+    EGLint mHeight;
+};
+
+}
+
+#endif // LIBGLESV2_RENDERER_NULLRENDERTARGET_H_
@@ -0,0 +1,740 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// NullRenderer.cpp: Implements the null back-end, which runs the front-end
+// and the vertex, index and texture uploads but never draws anything.
+
+#include "libGLESv2/renderer/null/NullRenderer.h"
+#include "libGLESv2/renderer/null/NullBuffer.h"
+#include "libGLESv2/renderer/null/NullImage.h"
+#include "libGLESv2/renderer/null/NullQuery.h"
+#include "libGLESv2/renderer/null/NullRenderTarget.h"
+#include "libGLESv2/renderer/null/NullTextureStorage.h"
+#include "libGLESv2/renderer/null/NullVertexArray.h"
+#include "libGLESv2/renderer/d3d/IndexDataManager.h"
+#include "libGLESv2/renderer/d3d/ProgramD3D.h"
+#include "libGLESv2/renderer/d3d/ShaderD3D.h"
+#include "libGLESv2/renderer/d3d/TextureD3D.h"
+#include "libGLESv2/renderer/d3d/TransformFeedbackD3D.h"
+#include "libGLESv2/renderer/d3d/VertexDataManager.h"
+#include "libGLESv2/renderer/ShaderExecutable.h"
+#include "libGLESv2/main.h"
+#include "libGLESv2/formatutils.h"
+#include "libGLESv2/ProgramBinary.h"
+#include "libGLESv2/State.h"
+
+#include "libEGL/Display.h"
+
+#include <limits>
+
+namespace rx
+{
+
+namespace
+{
+
+const GLenum RenderTargetFormats[] =
+{
+    GL_BGRA8_EXT,
+    GL_RGBA8_OES,
+};
+
+const GLenum DepthStencilFormats[] =
+{
+    GL_NONE,
+    GL_DEPTH24_STENCIL8_OES,
+};
+
+}
+
+NullRenderer::NullRenderer(egl::Display *display, EGLNativeDisplayType nativeDisplay, const egl::AttributeMap &attributes)
+    : Renderer(display),
+      mVertexDataManager(NULL),
+      mIndexDataManager(NULL),
+      mDeviceLost(false)
+{
+}
+
+NullRenderer::~NullRenderer()
+{
+    release();
+}
+
+NullRenderer *NullRenderer::makeNullRenderer(Renderer *renderer)
+{
+    ASSERT(HAS_DYNAMIC_TYPE(NullRenderer*, renderer));
+    return static_cast<NullRenderer*>(renderer);
+}
+
+void NullRenderer::release()
+{
+    releaseShaderCompiler();
+
+    SafeDelete(mVertexDataManager);
+    SafeDelete(mIndexDataManager);
+}
+
+EGLint NullRenderer::initialize()
+{
+    mVertexDataManager = new VertexDataManager(this);
+    mIndexDataManager = new IndexDataManager(this);
+
+    return EGL_SUCCESS;
+}
+
+bool NullRenderer::resetDevice()
+{
+    mDeviceLost = false;
+    return true;
+}
+
+int NullRenderer::generateConfigs(ConfigDesc **configDescList)
+{
+    unsigned int numRenderFormats = ArraySize(RenderTargetFormats);
+    unsigned int numDepthFormats = ArraySize(DepthStencilFormats);
+    (*configDescList) = new ConfigDesc[numRenderFormats * numDepthFormats];
+    int numConfigs = 0;
+
+    for (unsigned int formatIndex = 0; formatIndex < numRenderFormats; formatIndex++)
+    {
+        for (unsigned int depthStencilIndex = 0; depthStencilIndex < numDepthFormats; depthStencilIndex++)
+        {
+            ConfigDesc newConfig;
+            newConfig.renderTargetFormat = RenderTargetFormats[formatIndex];
+            newConfig.depthStencilFormat = DepthStencilFormats[depthStencilIndex];
+            newConfig.multiSample = 0;
+            newConfig.fastConfig = true;
+            newConfig.es2Conformant = true;
+            newConfig.es3Capable = true;
+
+            (*configDescList)[numConfigs++] = newConfig;
+        }
+    }
+
+    return numConfigs;
+}
+
+void NullRenderer::deleteConfigs(ConfigDesc *configDescList)
+{
+    delete [] (configDescList);
+}
+
+gl::Error NullRenderer::sync(bool block)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+SwapChain *NullRenderer::createSwapChain(rx::NativeWindow nativeWindow, HANDLE shareHandle, GLenum backBufferFormat, GLenum depthBufferFormat, bool renderToBackBuffer)
+{
+    return new NullSwapChain(nativeWindow, shareHandle, backBufferFormat, depthBufferFormat);
+}
+
+gl::Error NullRenderer::generateSwizzle(gl::Texture *texture)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullRenderer::setSamplerState(gl::SamplerType type, int index, gl::Texture *texture, const gl::SamplerState &sampler)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullRenderer::setTexture(gl::SamplerType type, int index, gl::Texture *texture)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullRenderer::setUniformBuffers(const gl::Buffer *vertexUniformBuffers[], const gl::Buffer *fragmentUniformBuffers[])
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullRenderer::setRasterizerState(const gl::RasterizerState &rasterState)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullRenderer::setBlendState(gl::Framebuffer *framebuffer, const gl::BlendState &blendState, const gl::ColorF &blendColor,
+                                      unsigned int sampleMask)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullRenderer::setDepthStencilState(const gl::DepthStencilState &depthStencilState, int stencilRef,
+                                             int stencilBackRef, bool frontFaceCCW)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+void NullRenderer::setScissorRectangle(const gl::Rectangle &scissor, bool enabled)
+{
+}
+
+void NullRenderer::setViewport(const gl::Rectangle &viewport, float zNear, float zFar, GLenum drawMode, GLenum frontFace,
+                               bool ignoreViewport)
+{
+}
+
+bool NullRenderer::applyPrimitiveType(GLenum mode, GLsizei count)
+{
+    return count > 0;
+}
+
+gl::Error NullRenderer::applyRenderTarget(gl::Framebuffer *frameBuffer)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullRenderer::applyShaders(gl::ProgramBinary *programBinary, const gl::VertexFormat inputLayout[], const gl::Framebuffer *framebuffer,
+                                     bool rasterizerDiscard, bool transformFeedbackActive)
+{
+    // The executables are still looked up, since picking them for the input
+    // layout and framebuffer is part of what every draw costs
+    ProgramD3D *programD3D = ProgramD3D::makeProgramD3D(programBinary->getImplementation());
+
+    ShaderExecutable *vertexExe = NULL;
+    gl::Error error = programD3D->getVertexExecutableForInputLayout(inputLayout, &vertexExe);
+    if (error.isError())
+    {
+        return error;
+    }
+
+    ShaderExecutable *pixelExe = NULL;
+    return programD3D->getPixelExecutableForFramebuffer(framebuffer, &pixelExe);
+}
+
+gl::Error NullRenderer::applyUniforms(const ProgramImpl &program, const std::vector<gl::LinkedUniform*> &uniformArray)
+{
+    for (size_t uniformIndex = 0; uniformIndex < uniformArray.size(); uniformIndex++)
+    {
+        uniformArray[uniformIndex]->dirty = false;
+    }
+
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullRenderer::applyVertexBuffer(const gl::State &state, GLint first, GLsizei count, GLsizei instances)
+{
+    TranslatedAttribute attributes[gl::MAX_VERTEX_ATTRIBS];
+    return mVertexDataManager->prepareVertexData(state, first, count, attributes, instances);
+}
+
+gl::Error NullRenderer::applyIndexBuffer(const GLvoid *indices, gl::Buffer *elementArrayBuffer, GLsizei count, GLenum mode, GLenum type, TranslatedIndexData *indexInfo)
+{
+    return mIndexDataManager->prepareIndexData(type, count, elementArrayBuffer, indices, indexInfo);
+}
+
+void NullRenderer::applyTransformFeedbackBuffers(const gl::State &state)
+{
+}
+
+gl::Error NullRenderer::drawArrays(GLenum mode, GLsizei count, GLsizei instances, bool transformFeedbackActive)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullRenderer::drawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid *indices,
+                                     gl::Buffer *elementArrayBuffer, const TranslatedIndexData &indexInfo, GLsizei instances)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullRenderer::clear(const gl::ClearParameters &clearParams, gl::Framebuffer *frameBuffer)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+void NullRenderer::markAllStateDirty()
+{
+    invalidateAppliedState();
+}
+
+void NullRenderer::notifyDeviceLost()
+{
+    mDeviceLost = true;
+    mDisplay->notifyDeviceLost();
+}
+
+bool NullRenderer::isDeviceLost()
+{
+    return mDeviceLost;
+}
+
+bool NullRenderer::testDeviceLost(bool notify)
+{
+    if (mDeviceLost && notify)
+    {
+        notifyDeviceLost();
+    }
+
+    return mDeviceLost;
+}
+
+bool NullRenderer::testDeviceResettable()
+{
+    return true;
+}
+
+bool NullRenderer::getClientVersion3Support() const
+{
+    return true;
+}
+
+DWORD NullRenderer::getAdapterVendor() const
+{
+    return 0;
+}
+
+std::string NullRenderer::getRendererDescription() const
+{
+    return "Null";
+}
+
+GUID NullRenderer::getAdapterIdentifier() const
+{
+    GUID adapterId = { 0 };
+    return adapterId;
+}
+
+unsigned int NullRenderer::getReservedVertexUniformVectors() const
+{
+    return 0;
+}
+
+unsigned int NullRenderer::getReservedFragmentUniformVectors() const
+{
+    return 0;
+}
+
+unsigned int NullRenderer::getReservedVertexUniformBuffers() const
+{
+    // Same as the D3D11 back-end, whose shaders the programs are translated for
+    return 2;
+}
+
+unsigned int NullRenderer::getReservedFragmentUniformBuffers() const
+{
+    return 2;
+}
+
+bool NullRenderer::getShareHandleSupport() const
+{
+    return false;
+}
+
+bool NullRenderer::getPostSubBufferSupport() const
+{
+    return true;
+}
+
+int NullRenderer::getMajorShaderModel() const
+{
+    return 4;
+}
+
+int NullRenderer::getMinorShaderModel() const
+{
+    return 0;
+}
+
+std::string NullRenderer::getShaderModelSuffix() const
+{
+    return "";
+}
+
+int NullRenderer::getMinSwapInterval() const
+{
+    return 0;
+}
+
+int NullRenderer::getMaxSwapInterval() const
+{
+    return 4;
+}
+
+bool NullRenderer::isRenderingToBackBufferEnabled() const
+{
+    return false;
+}
+
+bool NullRenderer::isCurrentlyRenderingToBackBuffer() const
+{
+    return false;
+}
+
+gl::Error NullRenderer::copyImage2D(gl::Framebuffer *framebuffer, const gl::Rectangle &sourceRect, GLenum destFormat,
+                                    GLint xoffset, GLint yoffset, TextureStorage *storage, GLint level)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullRenderer::copyImageCube(gl::Framebuffer *framebuffer, const gl::Rectangle &sourceRect, GLenum destFormat,
+                                      GLint xoffset, GLint yoffset, TextureStorage *storage, GLenum target, GLint level)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullRenderer::copyImage3D(gl::Framebuffer *framebuffer, const gl::Rectangle &sourceRect, GLenum destFormat,
+                                    GLint xoffset, GLint yoffset, GLint zOffset, TextureStorage *storage, GLint level)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullRenderer::copyImage2DArray(gl::Framebuffer *framebuffer, const gl::Rectangle &sourceRect, GLenum destFormat,
+                                         GLint xoffset, GLint yoffset, GLint zOffset, TextureStorage *storage, GLint level)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullRenderer::blitRect(gl::Framebuffer *readTarget, const gl::Rectangle &readRect, gl::Framebuffer *drawTarget, const gl::Rectangle &drawRect,
+                                 const gl::Rectangle *scissor, bool blitRenderTarget, bool blitDepth, bool blitStencil, GLenum filter)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullRenderer::readPixels(gl::Framebuffer *framebuffer, GLint x, GLint y, GLsizei width, GLsizei height, GLenum format,
+                                   GLenum type, GLuint outputPitch, const gl::PixelPackState &pack, uint8_t *pixels)
+{
+    // With a pack buffer bound, |pixels| is an offset into it; the buffer is
+    // left as it is
+    if (pack.pixelBuffer.get() != NULL)
+    {
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    // Nothing was drawn, so every pixel reads back as zero
+    const gl::InternalFormat &formatInfo = gl::GetInternalFormatInfo(gl::GetSizedInternalFormat(format, type));
+    size_t rowBytes = formatInfo.pixelBytes * width;
+    for (GLsizei row = 0; row < height; row++)
+    {
+        memset(pixels + row * outputPitch, 0, rowBytes);
+    }
+
+    return gl::Error(GL_NO_ERROR);
+}
+
+RenderTarget *NullRenderer::createRenderTarget(SwapChain *swapChain, bool depth)
+{
+    NullSwapChain *nullSwapChain = static_cast<NullSwapChain*>(swapChain);
+    GLenum format = depth ? nullSwapChain->getDepthBufferFormat() : nullSwapChain->getBackBufferFormat();
+    return new NullRenderTarget(nullSwapChain->getWidth(), nullSwapChain->getHeight(), 1, format, 0);
+}
+
+RenderTarget *NullRenderer::createRenderTarget(int width, int height, GLenum format, GLsizei samples)
+{
+    return new NullRenderTarget(width, height, 1, format, samples);
+}
+
+ShaderImpl *NullRenderer::createShader(GLenum type)
+{
+    return new ShaderD3D(type, this);
+}
+
+ProgramImpl *NullRenderer::createProgram()
+{
+    return new ProgramD3D(this);
+}
+
+void NullRenderer::releaseShaderCompiler()
+{
+    ShaderD3D::releaseCompiler();
+}
+
+gl::Error NullRenderer::loadExecutable(const void *function, size_t length, rx::ShaderType type,
+                                       const std::vector<gl::LinkedVarying> &transformFeedbackVaryings,
+                                       bool separatedOutputBuffers, ShaderExecutable **outExecutable)
+{
+    *outExecutable = new ShaderExecutable(function, length);
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullRenderer::compileToExecutable(gl::InfoLog &infoLog, const std::string &shaderHLSL, rx::ShaderType type,
+                                            const std::vector<gl::LinkedVarying> &transformFeedbackVaryings,
+                                            bool separatedOutputBuffers, D3DWorkaroundType workaround,
+                                            ShaderExecutable **outExectuable)
+{
+    // There is no HLSL compiler to run, so the source stands in for the
+    // binary and program binaries round-trip it unchanged
+    *outExectuable = new ShaderExecutable(shaderHLSL.c_str(), shaderHLSL.length() + 1);
+    return gl::Error(GL_NO_ERROR);
+}
+
+UniformStorage *NullRenderer::createUniformStorage(size_t storageSize)
+{
+    return new UniformStorage(storageSize);
+}
+
+Image *NullRenderer::createImage()
+{
+    return new NullImage();
+}
+
+gl::Error NullRenderer::generateMipmap(Image *dest, Image *source)
+{
+    // The levels are not read back, so they are left as they were defined
+    return gl::Error(GL_NO_ERROR);
+}
+
+TextureStorage *NullRenderer::createTextureStorage2D(SwapChain *swapChain)
+{
+    NullSwapChain *nullSwapChain = static_cast<NullSwapChain*>(swapChain);
+    return new NullTextureStorage(nullSwapChain->getBackBufferFormat(), true, nullSwapChain->getWidth(),
+                                  nullSwapChain->getHeight(), 1, 1);
+}
+
+TextureStorage *NullRenderer::createTextureStorage2D(GLenum internalformat, bool renderTarget, GLsizei width, GLsizei height, int levels, bool hintLevelZeroOnly)
+{
+    return new NullTextureStorage(internalformat, renderTarget, width, height, 1, levels);
+}
+
+TextureStorage *NullRenderer::createTextureStorageCube(GLenum internalformat, bool renderTarget, int size, int levels)
+{
+    return new NullTextureStorage(internalformat, renderTarget, size, size, 6, levels);
+}
+
+TextureStorage *NullRenderer::createTextureStorage3D(GLenum internalformat, bool renderTarget, GLsizei width, GLsizei height, GLsizei depth, int levels)
+{
+    return new NullTextureStorage(internalformat, renderTarget, width, height, depth, levels);
+}
+
+TextureStorage *NullRenderer::createTextureStorage2DArray(GLenum internalformat, bool renderTarget, GLsizei width, GLsizei height, GLsizei depth, int levels)
+{
+    return new NullTextureStorage(internalformat, renderTarget, width, height, depth, levels);
+}
+
+TextureImpl *NullRenderer::createTexture(GLenum target)
+{
+    switch(target)
+    {
+      case GL_TEXTURE_2D: return new TextureD3D_2D(this);
+      case GL_TEXTURE_CUBE_MAP: return new TextureD3D_Cube(this);
+      case GL_TEXTURE_3D: return new TextureD3D_3D(this);
+      case GL_TEXTURE_2D_ARRAY: return new TextureD3D_2DArray(this);
+      default:
+        UNREACHABLE();
+    }
+
+    return NULL;
+}
+
+BufferImpl *NullRenderer::createBuffer()
+{
+    return new NullBuffer(this);
+}
+
+VertexBuffer *NullRenderer::createVertexBuffer()
+{
+    return new NullVertexBuffer();
+}
+
+IndexBuffer *NullRenderer::createIndexBuffer()
+{
+    return new NullIndexBuffer();
+}
+
+VertexArrayImpl *NullRenderer::createVertexArray()
+{
+    return new NullVertexArray();
+}
+
+QueryImpl *NullRenderer::createQuery(GLenum type)
+{
+    return new NullQuery(type);
+}
+
+FenceNVImpl *NullRenderer::createFenceNV()
+{
+    return new NullFenceNV();
+}
+
+FenceSyncImpl *NullRenderer::createFenceSync()
+{
+    return new NullFenceSync();
+}
+
+TransformFeedbackImpl* NullRenderer::createTransformFeedback()
+{
+    return new TransformFeedbackD3D();
+}
+
+bool NullRenderer::supportsFastCopyBufferToTexture(GLenum internalFormat) const
+{
+    return false;
+}
+
+gl::Error NullRenderer::fastCopyBufferToTexture(const gl::PixelUnpackState &unpack, unsigned int offset, RenderTarget *destRenderTarget,
+                                                GLenum destinationFormat, GLenum sourcePixelsType, const gl::Box &destArea)
+{
+    // Never called, supportsFastCopyBufferToTexture always returns false
+    UNREACHABLE();
+    return gl::Error(GL_INVALID_OPERATION);
+}
+
+bool NullRenderer::getLUID(LUID *adapterLuid) const
+{
+    return false;
+}
+
+rx::VertexConversionType NullRenderer::getVertexConversionType(const gl::VertexFormat &vertexFormat) const
+{
+    return VERTEX_CONVERT_NONE;
+}
+
+GLenum NullRenderer::getVertexComponentType(const gl::VertexFormat &vertexFormat) const
+{
+    if (!vertexFormat.mPureInteger)
+    {
+        return GL_FLOAT;
+    }
+
+    switch (vertexFormat.mType)
+    {
+      case GL_BYTE:
+      case GL_SHORT:
+      case GL_INT:
+        return GL_INT;
+      default:
+        return GL_UNSIGNED_INT;
+    }
+}
+
+void NullRenderer::generateCaps(gl::Caps *outCaps, gl::TextureCapsMap *outTextureCaps, gl::Extensions *outExtensions) const
+{
+    // Every format is supported, and can be rendered to wherever ES 3.0 or
+    // one of its extensions allows
+    gl::Extensions formatExtensions;
+    formatExtensions.colorBufferFloat = true;
+    formatExtensions.depthTextures = true;
+    formatExtensions.packedDepthStencil = true;
+    formatExtensions.rgb8rgba8 = true;
+    formatExtensions.sRGB = true;
+    formatExtensions.textureFloat = true;
+    formatExtensions.textureFormatBGRA8888 = true;
+    formatExtensions.textureHalfFloat = true;
+    formatExtensions.textureRG = true;
+
+    const gl::FormatSet &allFormats = gl::GetAllSizedInternalFormats();
+    for (gl::FormatSet::const_iterator internalFormat = allFormats.begin(); internalFormat != allFormats.end(); ++internalFormat)
+    {
+        const gl::InternalFormat &formatInfo = gl::GetInternalFormatInfo(*internalFormat);
+
+        gl::TextureCaps textureCaps;
+        textureCaps.texturable = true;
+        textureCaps.filterable = true;
+        textureCaps.renderable = formatInfo.renderSupport(3, formatExtensions);
+        if (textureCaps.renderable)
+        {
+            textureCaps.sampleCounts.insert(4);
+        }
+        outTextureCaps->insert(*internalFormat, textureCaps);
+
+        if (formatInfo.compressed)
+        {
+            outCaps->compressedTextureFormats.push_back(*internalFormat);
+        }
+    }
+
+    // The limits of D3D feature level 11_0, which the programs are
+    // translated for
+    outCaps->maxElementIndex = static_cast<GLint64>(std::numeric_limits<unsigned int>::max());
+    outCaps->max3DTextureSize = 2048;
+    outCaps->max2DTextureSize = 16384;
+    outCaps->maxCubeMapTextureSize = 16384;
+    outCaps->maxArrayTextureLayers = 2048;
+    outCaps->maxLODBias = 2.0f;
+    outCaps->depthClipRequired = false;
+    outCaps->supportsRenderingToDepthTextures = true;
+    outCaps->supportsRenderingTo3DTextures = true;
+    outCaps->supportsGeometryShaders = true;
+    outCaps->maxRenderbufferSize = outCaps->max2DTextureSize;
+    outCaps->maxDrawBuffers = 8;
+    outCaps->maxColorAttachments = 8;
+    outCaps->minViewportBoundsX = -32768;
+    outCaps->minViewportBoundsY = -32768;
+    outCaps->maxViewportBoundsX = 32767;
+    outCaps->maxViewportBoundsY = 32767;
+    outCaps->minAliasedPointSize = 1.0f;
+    outCaps->maxAliasedPointSize = 1024.0f;
+    outCaps->minAliasedLineWidth = 1.0f;
+    outCaps->maxAliasedLineWidth = 1.0f;
+    outCaps->maxElementsIndices = std::numeric_limits<GLint>::max();
+    outCaps->maxElementsVertices = std::numeric_limits<GLint>::max();
+    outCaps->programBinaryFormats.push_back(GL_PROGRAM_BINARY_ANGLE);
+    outCaps->maxServerWaitTimeout = 0;
+
+    // Vertex shader limits
+    outCaps->maxVertexAttributes = 16;
+    outCaps->maxVertexUniformVectors = 1024;
+    outCaps->maxVertexUniformComponents = outCaps->maxVertexUniformVectors * 4;
+    outCaps->maxVertexUniformBlocks = 12;
+    outCaps->maxVertexOutputComponents = 28 * 4;
+    outCaps->maxVertexTextureImageUnits = 16;
+
+    // Fragment shader limits
+    outCaps->maxFragmentUniformVectors = 1024;
+    outCaps->maxFragmentUniformComponents = outCaps->maxFragmentUniformVectors * 4;
+    outCaps->maxFragmentUniformBlocks = 12;
+    outCaps->maxFragmentInputComponents = 28 * 4;
+    outCaps->maxTextureImageUnits = 16;
+    outCaps->minProgramTexelOffset = -8;
+    outCaps->maxProgramTexelOffset = 7;
+
+    // Aggregate shader limits
+    outCaps->maxUniformBufferBindings = outCaps->maxVertexUniformBlocks + outCaps->maxFragmentUniformBlocks;
+    outCaps->maxUniformBlockSize = 65536;
+    outCaps->uniformBufferOffsetAlignment = static_cast<GLuint>(std::numeric_limits<GLint>::max());
+    outCaps->maxCombinedUniformBlocks = outCaps->maxVertexUniformBlocks + outCaps->maxFragmentUniformBlocks;
+    outCaps->maxCombinedVertexUniformComponents = (static_cast<GLint64>(outCaps->maxVertexUniformBlocks) * static_cast<GLint64>(outCaps->maxUniformBlockSize / 4)) +
+                                                  static_cast<GLint64>(outCaps->maxVertexUniformComponents);
+    outCaps->maxCombinedFragmentUniformComponents = (static_cast<GLint64>(outCaps->maxFragmentUniformBlocks) * static_cast<GLint64>(outCaps->maxUniformBlockSize / 4)) +
+                                                    static_cast<GLint64>(outCaps->maxFragmentUniformComponents);
+    outCaps->maxVaryingVectors = 28;
+    outCaps->maxVaryingComponents = outCaps->maxVaryingVectors * 4;
+    outCaps->maxCombinedTextureImageUnits = outCaps->maxVertexTextureImageUnits + outCaps->maxTextureImageUnits;
+
+    // Transform feedback limits
+    outCaps->maxTransformFeedbackInterleavedComponents = 28 * 4;
+    outCaps->maxTransformFeedbackSeparateAttributes = 4;
+    outCaps->maxTransformFeedbackSeparateComponents = 4;
+
+    // GL extension support
+    outExtensions->setTextureExtensionSupport(*outTextureCaps);
+    outExtensions->elementIndexUint = true;
+    outExtensions->packedDepthStencil = true;
+    outExtensions->getProgramBinary = true;
+    outExtensions->rgb8rgba8 = true;
+    outExtensions->readFormatBGRA = true;
+    outExtensions->pixelBufferObject = true;
+    outExtensions->mapBuffer = true;
+    outExtensions->mapBufferRange = true;
+    outExtensions->textureNPOT = true;
+    outExtensions->drawBuffers = true;
+    outExtensions->textureStorage = true;
+    outExtensions->textureFilterAnisotropic = true;
+    outExtensions->maxTextureAnisotropy = 16.0f;
+    outExtensions->occlusionQueryBoolean = true;
+    outExtensions->fence = true;
+    outExtensions->timerQuery = false;
+    outExtensions->robustness = true;
+    outExtensions->blendMinMax = true;
+    outExtensions->framebufferBlit = true;
+    outExtensions->framebufferMultisample = true;
+    outExtensions->maxSamples = 4;
+    outExtensions->instancedArrays = true;
+    outExtensions->packReverseRowOrder = true;
+    outExtensions->standardDerivatives = true;
+    outExtensions->shaderTextureLOD = true;
+    outExtensions->fragDepth = true;
+    outExtensions->textureUsage = true;
+    outExtensions->translatedShaderSource = true;
+}
+
+Workarounds NullRenderer::generateWorkarounds() const
+{
+    return Workarounds();
+}
+
+}
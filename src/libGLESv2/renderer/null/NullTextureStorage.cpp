@@ -0,0 +1,99 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// NullTextureStorage.cpp: Implements the rx::NullTextureStorage class.
+
+#include "libGLESv2/renderer/null/NullTextureStorage.h"
+#include "libGLESv2/renderer/null/NullRenderTarget.h"
+#include "libGLESv2/ImageIndex.h"
+#include "libGLESv2/main.h"
+
+namespace rx
+{
+
+NullTextureStorage::NullTextureStorage(GLenum internalformat, bool renderTarget, GLsizei width, GLsizei height, GLsizei layers, int levels)
+    : TextureStorage(),
+      mInternalFormat(internalformat),
+      mRenderTarget(renderTarget),
+      mWidth(width),
+      mHeight(height),
+      mLayers(std::max(layers, 1)),
+      mLevels(levels),
+      mRenderTargets(levels * std::max(layers, 1), NULL)
+{
+    initializeSerials(mLevels * mLayers, mLayers);
+}
+
+NullTextureStorage::~NullTextureStorage()
+{
+    for (size_t i = 0; i < mRenderTargets.size(); i++)
+    {
+        SafeDelete(mRenderTargets[i]);
+    }
+}
+
+NullTextureStorage *NullTextureStorage::makeNullTextureStorage(TextureStorage *storage)
+{
+    ASSERT(HAS_DYNAMIC_TYPE(NullTextureStorage*, storage));
+    return static_cast<NullTextureStorage*>(storage);
+}
+
+int NullTextureStorage::getTopLevel() const
+{
+    return 0;
+}
+
+bool NullTextureStorage::isRenderTarget() const
+{
+    return mRenderTarget;
+}
+
+bool NullTextureStorage::isManaged() const
+{
+    return false;
+}
+
+int NullTextureStorage::getLevelCount() const
+{
+    return mLevels;
+}
+
+gl::Error NullTextureStorage::getRenderTarget(const gl::ImageIndex &index, RenderTarget **outRT)
+{
+    ASSERT(index.mipIndex >= 0 && index.mipIndex < mLevels);
+    GLint layer = index.hasLayer() ? index.layerIndex : 0;
+    ASSERT(layer < mLayers);
+
+    NullRenderTarget *&renderTarget = mRenderTargets[index.mipIndex * mLayers + layer];
+    if (!renderTarget)
+    {
+        GLsizei width = std::max(mWidth >> index.mipIndex, 1);
+        GLsizei height = std::max(mHeight >> index.mipIndex, 1);
+        renderTarget = new NullRenderTarget(width, height, 1, mInternalFormat, 0);
+    }
+
+    *outRT = renderTarget;
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullTextureStorage::generateMipmap(const gl::ImageIndex &sourceIndex, const gl::ImageIndex &destIndex)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullTextureStorage::copyToStorage(TextureStorage *destStorage)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error NullTextureStorage::setData(const gl::ImageIndex &index, Image *image, const gl::Box *destBox, GLenum type,
+                                      const gl::PixelUnpackState &unpack, const uint8_t *pixelData)
+{
+    // Nothing samples from the storage, so the data is dropped
+    return gl::Error(GL_NO_ERROR);
+}
+
+}
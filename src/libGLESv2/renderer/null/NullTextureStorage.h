@@ -0,0 +1,60 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// NullTextureStorage.h: Defines the rx::NullTextureStorage class, the
+// texture storage of the null back-end for every texture type. It keeps no
+// texel data, only the render targets handed out for its levels and layers.
+
+#ifndef LIBGLESV2_RENDERER_NULLTEXTURESTORAGE_H_
+#define LIBGLESV2_RENDERER_NULLTEXTURESTORAGE_H_
+
+#include "libGLESv2/renderer/d3d/TextureStorage.h"
+
+#include <vector>
+
+namespace rx
+{
+class NullRenderTarget;
+
+class NullTextureStorage : public TextureStorage
+{
+  public:
+    // |layers| is 1 for 2D textures, 6 for cube maps and the depth or layer
+    // count for 3D and 2D array textures.
+    NullTextureStorage(GLenum internalformat, bool renderTarget, GLsizei width, GLsizei height, GLsizei layers, int levels);
+    virtual ~NullTextureStorage();
+
+    static NullTextureStorage *makeNullTextureStorage(TextureStorage *storage);
+
+    virtual int getTopLevel() const;
+    virtual bool isRenderTarget() const;
+    virtual bool isManaged() const;
+    virtual int getLevelCount() const;
+
+    virtual gl::Error getRenderTarget(const gl::ImageIndex &index, RenderTarget **outRT);
+    virtual gl::Error generateMipmap(const gl::ImageIndex &sourceIndex, const gl::ImageIndex &destIndex);
+
+    virtual gl::Error copyToStorage(TextureStorage *destStorage);
+    virtual gl::Error setData(const gl::ImageIndex &index, Image *image, const gl::Box *destBox, GLenum type,
+                              const gl::PixelUnpackState &unpack, const uint8_t *pixelData);
+
+  private:
+    DISALLOW_COPY_AND_ASSIGN(NullTextureStorage);
+
+    GLenum mInternalFormat;
+    bool mRenderTarget;
+    GLsizei mWidth;
+    GLsizei mHeight;
+    GLsizei mLayers;
+    int mLevels;
+
+    // Created on first use, indexed by level * mLayers + layer
+    std::vector<NullRenderTarget*> mRenderTargets;
+};
+
+}
+
+#endif // LIBGLESV2_RENDERER_NULLTEXTURESTORAGE_H_
@@ -0,0 +1,38 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// NullVertexArray.h: Defines the rx::NullVertexArray class which implements rx::VertexArrayImpl.
+
+#ifndef LIBGLESV2_RENDERER_NULLVERTEXARRAY_H_
+#define LIBGLESV2_RENDERER_NULLVERTEXARRAY_H_
+
+#include "libGLESv2/renderer/VertexArrayImpl.h"
+
+namespace rx
+{
+
+class NullVertexArray : public VertexArrayImpl
+{
+  public:
+    NullVertexArray()
+        : VertexArrayImpl()
+    {
+    }
+
+    virtual ~NullVertexArray() { }
+
+    virtual void setElementArrayBuffer(const gl::Buffer *buffer) { }
+    virtual void setAttribute(size_t idx, const gl::VertexAttribute &attr) { }
+    virtual void setAttributeDivisor(size_t idx, GLuint divisor) { }
+    virtual void enableAttribute(size_t idx, bool enabledState) { }
+
+  private:
+    DISALLOW_COPY_AND_ASSIGN(NullVertexArray);
+};
+
+}
+
+#endif // LIBGLESV2_RENDERER_NULLVERTEXARRAY_H_
@@ -1139,6 +1139,37 @@ bool ValidateUniformMatrix(gl::Context *context, GLenum matrixType, GLint locati
     return true;
 }
 
+// The no-error variants only keep the checks that guard memory: the location must name a
+// uniform of the current program and the data must be of the uniform's type.
+static LinkedUniform *GetUniformNoError(gl::Context *context, GLint location, GLsizei count)
+{
+    gl::ProgramBinary *programBinary = context->getState().getCurrentProgramBinary();
+    if (count < 0 || !programBinary || location == -1 || !programBinary->isValidUniformLocation(location))
+    {
+        return NULL;
+    }
+
+    return programBinary->getUniformByLocation(location);
+}
+
+bool ValidateUniformNoError(gl::Context *context, GLenum uniformType, GLint location, GLsizei count)
+{
+    LinkedUniform *uniform = GetUniformNoError(context, location, count);
+    if (!uniform)
+    {
+        return false;
+    }
+
+    bool samplerUniformCheck = (IsSampler(uniform->type) && uniformType == GL_INT);
+    return (samplerUniformCheck || uniformType == uniform->type || VariableBoolVectorType(uniformType) == uniform->type);
+}
+
+bool ValidateUniformMatrixNoError(gl::Context *context, GLenum matrixType, GLint location, GLsizei count)
+{
+    LinkedUniform *uniform = GetUniformNoError(context, location, count);
+    return (uniform && uniform->type == matrixType);
+}
+
 bool ValidateStateQuery(gl::Context *context, GLenum pname, GLenum *nativeType, unsigned int *numParams)
 {
     if (!context->getQueryParameterInfo(pname, nativeType, numParams))
@@ -1399,6 +1430,58 @@ bool ValidateCopyTexImageParametersBase(gl::Context* context, GLenum target, GLi
     return true;
 }
 
+static bool ValidateDrawAttribs(Context *context, GLsizei maxVertex, GLsizei primcount)
+{
+    const State &state = context->getState();
+    gl::ProgramBinary *programBinary = state.getCurrentProgramBinary();
+
+    const VertexArray *vao = state.getVertexArray();
+    for (int attributeIndex = 0; attributeIndex < MAX_VERTEX_ATTRIBS; attributeIndex++)
+    {
+        const VertexAttribute &attrib = vao->getVertexAttribute(attributeIndex);
+        bool attribActive = (programBinary->getSemanticIndex(attributeIndex) != -1);
+        if (attribActive && attrib.enabled)
+        {
+            gl::Buffer *buffer = attrib.buffer.get();
+
+            if (buffer)
+            {
+                GLint64 attribStride = static_cast<GLint64>(ComputeVertexAttributeStride(attrib));
+                GLint64 maxVertexElement = 0;
+
+                if (attrib.divisor > 0)
+                {
+                    maxVertexElement = static_cast<GLint64>(primcount) / static_cast<GLint64>(attrib.divisor);
+                }
+                else
+                {
+                    maxVertexElement = static_cast<GLint64>(maxVertex);
+                }
+
+                GLint64 attribDataSize = maxVertexElement * attribStride;
+
+                // [OpenGL ES 3.0.2] section 2.9.4 page 40:
+                // We can return INVALID_OPERATION if our vertex attribute does not have
+                // enough backing data.
+                if (attribDataSize > buffer->getSize())
+                {
+                    context->recordError(Error(GL_INVALID_OPERATION));
+                    return false;
+                }
+            }
+            else if (attrib.pointer == NULL)
+            {
+                // This is an application error that would normally result in a crash,
+                // but we catch it and return an error
+                context->recordError(Error(GL_INVALID_OPERATION, "An enabled vertex array has no buffer and no pointer."));
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
 static bool ValidateDrawBase(Context *context, GLenum mode, GLsizei count, GLsizei maxVertex, GLsizei primcount)
 {
     switch (mode)
@@ -1457,56 +1540,22 @@ static bool ValidateDrawBase(Context *context, GLenum mode, GLsizei count, GLsiz
         return false;
     }
 
-    gl::ProgramBinary *programBinary = state.getCurrentProgramBinary();
-    if (!programBinary->validateSamplers(NULL, context->getCaps()))
+    if (!context->validateCurrentProgramSamplers())
     {
         context->recordError(Error(GL_INVALID_OPERATION));
         return false;
     }
 
-    // Buffer validations
-    const VertexArray *vao = state.getVertexArray();
-    for (int attributeIndex = 0; attributeIndex < MAX_VERTEX_ATTRIBS; attributeIndex++)
+    // Buffer validations. The limits cached on the vertex array tell whether every attribute
+    // can be read, only a draw that fails needs to look for the attribute to report.
+    gl::ProgramBinary *programBinary = state.getCurrentProgramBinary();
+    VertexArray *vao = state.getVertexArray();
+    const VertexArrayDrawLimits &drawLimits = vao->getDrawLimits(programBinary->getSerial(), programBinary->getSemanticIndexes());
+    bool withinDrawLimits = (!drawLimits.missingData && maxVertex <= drawLimits.maxVertexCount &&
+                             primcount <= drawLimits.maxInstanceCount);
+    if (!withinDrawLimits && !ValidateDrawAttribs(context, maxVertex, primcount))
     {
-        const VertexAttribute &attrib = vao->getVertexAttribute(attributeIndex);
-        bool attribActive = (programBinary->getSemanticIndex(attributeIndex) != -1);
-        if (attribActive && attrib.enabled)
-        {
-            gl::Buffer *buffer = attrib.buffer.get();
-
-            if (buffer)
-            {
-                GLint64 attribStride = static_cast<GLint64>(ComputeVertexAttributeStride(attrib));
-                GLint64 maxVertexElement = 0;
-
-                if (attrib.divisor > 0)
-                {
-                    maxVertexElement = static_cast<GLint64>(primcount) / static_cast<GLint64>(attrib.divisor);
-                }
-                else
-                {
-                    maxVertexElement = static_cast<GLint64>(maxVertex);
-                }
-
-                GLint64 attribDataSize = maxVertexElement * attribStride;
-
-                // [OpenGL ES 3.0.2] section 2.9.4 page 40:
-                // We can return INVALID_OPERATION if our vertex attribute does not have
-                // enough backing data.
-                if (attribDataSize > buffer->getSize())
-                {
-                    context->recordError(Error(GL_INVALID_OPERATION));
-                    return false;
-                }
-            }
-            else if (attrib.pointer == NULL)
-            {
-                // This is an application error that would normally result in a crash,
-                // but we catch it and return an error
-                context->recordError(Error(GL_INVALID_OPERATION, "An enabled vertex array has no buffer and no pointer."));
-                return false;
-            }
-        }
+        return false;
     }
 
     // No-op if zero count
@@ -1591,50 +1640,83 @@ bool ValidateDrawArraysInstancedANGLE(Context *context, GLenum mode, GLint first
     return ValidateDrawArraysInstanced(context, mode, first, count, primcount);
 }
 
-bool ValidateDrawElements(Context *context, GLenum mode, GLsizei count, GLenum type,
-                          const GLvoid* indices, GLsizei primcount, rx::RangeUI *indexRangeOut)
+// Draws in a no-error context still refuse what the back-end can not survive: an incomplete
+// framebuffer, no program, a mapped buffer, or vertex data that runs off the end of a buffer.
+static bool ValidateDrawBaseNoError(Context *context, GLenum mode, GLsizei count, GLsizei maxVertex, GLsizei primcount)
 {
-    switch (type)
+    switch (mode)
     {
-      case GL_UNSIGNED_BYTE:
-      case GL_UNSIGNED_SHORT:
-        break;
-      case GL_UNSIGNED_INT:
-        if (!context->getExtensions().elementIndexUint)
-        {
-            context->recordError(Error(GL_INVALID_ENUM));
-            return false;
-        }
+      case GL_POINTS:
+      case GL_LINES:
+      case GL_LINE_LOOP:
+      case GL_LINE_STRIP:
+      case GL_TRIANGLES:
+      case GL_TRIANGLE_STRIP:
+      case GL_TRIANGLE_FAN:
         break;
       default:
-        context->recordError(Error(GL_INVALID_ENUM));
         return false;
     }
 
     const State &state = context->getState();
 
-    gl::TransformFeedback *curTransformFeedback = state.getCurrentTransformFeedback();
-    if (curTransformFeedback && curTransformFeedback->isStarted() && !curTransformFeedback->isPaused())
+    if (state.hasMappedBuffer(GL_ARRAY_BUFFER))
     {
-        // It is an invalid operation to call DrawElements, DrawRangeElements or DrawElementsInstanced
-        // while transform feedback is active, (3.0.2, section 2.14, pg 86)
-        context->recordError(Error(GL_INVALID_OPERATION));
         return false;
     }
 
-    // Check for mapped buffers
-    if (state.hasMappedBuffer(GL_ELEMENT_ARRAY_BUFFER))
+    const gl::Framebuffer *fbo = state.getDrawFramebuffer();
+    if (!fbo || fbo->completeness() != GL_FRAMEBUFFER_COMPLETE)
     {
-        context->recordError(Error(GL_INVALID_OPERATION));
         return false;
     }
 
+    gl::ProgramBinary *programBinary = state.getCurrentProgramBinary();
+    if (!programBinary)
+    {
+        return false;
+    }
+
+    VertexArray *vao = state.getVertexArray();
+    const VertexArrayDrawLimits &drawLimits = vao->getDrawLimits(programBinary->getSerial(), programBinary->getSemanticIndexes());
+    if (drawLimits.missingData || maxVertex > drawLimits.maxVertexCount || primcount > drawLimits.maxInstanceCount)
+    {
+        return false;
+    }
+
+    return (count > 0);
+}
+
+bool ValidateDrawArraysNoError(Context *context, GLenum mode, GLint first, GLsizei count, GLsizei primcount)
+{
+    if (first < 0)
+    {
+        return false;
+    }
+
+    GLint64 maxVertex = static_cast<GLint64>(first) + static_cast<GLint64>(count);
+    if (maxVertex > std::numeric_limits<GLsizei>::max())
+    {
+        return false;
+    }
+
+    return ValidateDrawBaseNoError(context, mode, count, static_cast<GLsizei>(maxVertex), primcount);
+}
+
+bool ValidateDrawArraysInstancedNoError(Context *context, GLenum mode, GLint first, GLsizei count, GLsizei primcount)
+{
+    return (primcount > 0 && ValidateDrawArraysNoError(context, mode, first, count, primcount));
+}
+
+// Checks that the indices of a draw can be read, and finds their range
+static Error ValidateDrawElementsIndices(const State &state, GLsizei count, GLenum type, const GLvoid *indices,
+                                         rx::RangeUI *indexRangeOut)
+{
     const gl::VertexArray *vao = state.getVertexArray();
     const gl::Buffer *elementArrayBuffer = vao->getElementArrayBuffer();
     if (!indices && !elementArrayBuffer)
     {
-        context->recordError(Error(GL_INVALID_OPERATION));
-        return false;
+        return Error(GL_INVALID_OPERATION);
     }
 
     if (elementArrayBuffer)
@@ -1648,22 +1730,19 @@ bool ValidateDrawElements(Context *context, GLenum mode, GLsizei count, GLenum t
         if (static_cast<GLuint>(count) > (std::numeric_limits<GLuint>::max() / typeInfo.bytes) ||
             byteCount > static_cast<GLint64>(std::numeric_limits<GLuint>::max()))
         {
-            context->recordError(Error(GL_OUT_OF_MEMORY));
-            return false;
+            return Error(GL_OUT_OF_MEMORY);
         }
 
         // Check for reading past the end of the bound buffer object
         if (byteCount > elementArrayBuffer->getSize())
         {
-            context->recordError(Error(GL_INVALID_OPERATION));
-            return false;
+            return Error(GL_INVALID_OPERATION);
         }
     }
     else if (!indices)
     {
         // Catch this programming error here
-        context->recordError(Error(GL_INVALID_OPERATION));
-        return false;
+        return Error(GL_INVALID_OPERATION);
     }
 
     // Use max index to validate if our vertex buffers are large enough for the pull.
@@ -1680,8 +1759,7 @@ bool ValidateDrawElements(Context *context, GLenum mode, GLsizei count, GLenum t
             Error error = bufferD3D->getData(&dataPointer);
             if (error.isError())
             {
-                context->recordError(error);
-                return false;
+                return error;
             }
 
             const uint8_t *offsetPointer = dataPointer + offset;
@@ -1693,6 +1771,54 @@ bool ValidateDrawElements(Context *context, GLenum mode, GLsizei count, GLenum t
         *indexRangeOut = rx::IndexRangeCache::ComputeRange(type, indices, count);
     }
 
+    return Error(GL_NO_ERROR);
+}
+
+bool ValidateDrawElements(Context *context, GLenum mode, GLsizei count, GLenum type,
+                          const GLvoid* indices, GLsizei primcount, rx::RangeUI *indexRangeOut)
+{
+    switch (type)
+    {
+      case GL_UNSIGNED_BYTE:
+      case GL_UNSIGNED_SHORT:
+        break;
+      case GL_UNSIGNED_INT:
+        if (!context->getExtensions().elementIndexUint)
+        {
+            context->recordError(Error(GL_INVALID_ENUM));
+            return false;
+        }
+        break;
+      default:
+        context->recordError(Error(GL_INVALID_ENUM));
+        return false;
+    }
+
+    const State &state = context->getState();
+
+    gl::TransformFeedback *curTransformFeedback = state.getCurrentTransformFeedback();
+    if (curTransformFeedback && curTransformFeedback->isStarted() && !curTransformFeedback->isPaused())
+    {
+        // It is an invalid operation to call DrawElements, DrawRangeElements or DrawElementsInstanced
+        // while transform feedback is active, (3.0.2, section 2.14, pg 86)
+        context->recordError(Error(GL_INVALID_OPERATION));
+        return false;
+    }
+
+    // Check for mapped buffers
+    if (state.hasMappedBuffer(GL_ELEMENT_ARRAY_BUFFER))
+    {
+        context->recordError(Error(GL_INVALID_OPERATION));
+        return false;
+    }
+
+    Error error = ValidateDrawElementsIndices(state, count, type, indices, indexRangeOut);
+    if (error.isError())
+    {
+        context->recordError(error);
+        return false;
+    }
+
     if (!ValidateDrawBase(context, mode, count, static_cast<GLsizei>(indexRangeOut->end), primcount))
     {
         return false;
@@ -1701,6 +1827,49 @@ bool ValidateDrawElements(Context *context, GLenum mode, GLsizei count, GLenum t
     return true;
 }
 
+bool ValidateDrawElementsNoError(Context *context, GLenum mode, GLsizei count, GLenum type,
+                                 const GLvoid* indices, GLsizei primcount, rx::RangeUI *indexRangeOut)
+{
+    switch (type)
+    {
+      case GL_UNSIGNED_BYTE:
+      case GL_UNSIGNED_SHORT:
+        break;
+      case GL_UNSIGNED_INT:
+        if (!context->getExtensions().elementIndexUint)
+        {
+            return false;
+        }
+        break;
+      default:
+        return false;
+    }
+
+    if (count <= 0 || context->getState().hasMappedBuffer(GL_ELEMENT_ARRAY_BUFFER))
+    {
+        return false;
+    }
+
+    // Running out of memory is still reported, the other errors are the application's to avoid
+    Error error = ValidateDrawElementsIndices(context->getState(), count, type, indices, indexRangeOut);
+    if (error.isError())
+    {
+        if (error.getCode() == GL_OUT_OF_MEMORY)
+        {
+            context->recordError(error);
+        }
+        return false;
+    }
+
+    return ValidateDrawBaseNoError(context, mode, count, static_cast<GLsizei>(indexRangeOut->end), primcount);
+}
+
+bool ValidateDrawElementsInstancedNoError(Context *context, GLenum mode, GLsizei count, GLenum type,
+                                          const GLvoid *indices, GLsizei primcount, rx::RangeUI *indexRangeOut)
+{
+    return (primcount > 0 && ValidateDrawElementsNoError(context, mode, count, type, indices, primcount, indexRangeOut));
+}
+
 bool ValidateDrawElementsInstanced(Context *context,
                                    GLenum mode, GLsizei count, GLenum type,
                                    const GLvoid *indices, GLsizei primcount,
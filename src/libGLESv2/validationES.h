@@ -57,6 +57,8 @@ bool ValidateEndQuery(Context *context, GLenum target);
 bool ValidateUniform(Context *context, GLenum uniformType, GLint location, GLsizei count);
 bool ValidateUniformMatrix(Context *context, GLenum matrixType, GLint location, GLsizei count,
                            GLboolean transpose);
+bool ValidateUniformNoError(Context *context, GLenum uniformType, GLint location, GLsizei count);
+bool ValidateUniformMatrixNoError(Context *context, GLenum matrixType, GLint location, GLsizei count);
 
 bool ValidateStateQuery(Context *context, GLenum pname, GLenum *nativeType, unsigned int *numParams);
 
@@ -67,6 +69,8 @@ bool ValidateCopyTexImageParametersBase(Context* context, GLenum target, GLint l
 bool ValidateDrawArrays(Context *context, GLenum mode, GLint first, GLsizei count, GLsizei primcount);
 bool ValidateDrawArraysInstanced(Context *context, GLenum mode, GLint first, GLsizei count, GLsizei primcount);
 bool ValidateDrawArraysInstancedANGLE(Context *context, GLenum mode, GLint first, GLsizei count, GLsizei primcount);
+bool ValidateDrawArraysNoError(Context *context, GLenum mode, GLint first, GLsizei count, GLsizei primcount);
+bool ValidateDrawArraysInstancedNoError(Context *context, GLenum mode, GLint first, GLsizei count, GLsizei primcount);
 
 bool ValidateDrawElements(Context *context, GLenum mode, GLsizei count, GLenum type,
                           const GLvoid* indices, GLsizei primcount, rx::RangeUI *indexRangeOut);
@@ -75,6 +79,10 @@ bool ValidateDrawElementsInstanced(Context *context, GLenum mode, GLsizei count,
                                    const GLvoid *indices, GLsizei primcount, rx::RangeUI *indexRangeOut);
 bool ValidateDrawElementsInstancedANGLE(Context *context, GLenum mode, GLsizei count, GLenum type,
                                         const GLvoid *indices, GLsizei primcount, rx::RangeUI *indexRangeOut);
+bool ValidateDrawElementsNoError(Context *context, GLenum mode, GLsizei count, GLenum type,
+                                 const GLvoid* indices, GLsizei primcount, rx::RangeUI *indexRangeOut);
+bool ValidateDrawElementsInstancedNoError(Context *context, GLenum mode, GLsizei count, GLenum type,
+                                          const GLvoid *indices, GLsizei primcount, rx::RangeUI *indexRangeOut);
 
 bool ValidateFramebufferTextureBase(Context *context, GLenum target, GLenum attachment,
                                     GLuint texture, GLint level);
@@ -0,0 +1,307 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "gtest/gtest.h"
+#include "libGLESv2/BinaryStream.h"
+
+#include "angle_gl.h"
+
+namespace
+{
+
+struct Record
+{
+    uint32_t nameLength;
+    int value;
+    float weight;
+};
+
+const uint32_t RecordsSection = 1;
+const uint32_t NamesSection = 2;
+const uint32_t EmptySection = 3;
+
+// A binary shaped like a saved program: a table of records, and their names in another section
+void WriteSectionedBinary(gl::BinaryOutputStream *stream)
+{
+    gl::BinarySectionWriter writer(7);
+    gl::BinaryOutputStream *records = writer.addSection(RecordsSection);
+    gl::BinaryOutputStream *names = writer.addSection(NamesSection);
+    writer.addSection(EmptySection);
+
+    std::vector<Record> recordArray;
+    const char *recordNames[] = { "position", "normal", "texcoord0", "" };
+    for (size_t i = 0; i < ArraySize(recordNames); i++)
+    {
+        Record record = { static_cast<uint32_t>(strlen(recordNames[i])), static_cast<int>(i) - 2, 0.5f * i };
+        recordArray.push_back(record);
+        names->writeCharacters(recordNames[i]);
+    }
+    records->writeArray(recordArray);
+
+    writer.write(stream);
+}
+
+// Reads what WriteSectionedBinary wrote, checking every bound it relies on. Returns false
+// without reading outside of |data| when anything is missing.
+bool ReadSectionedBinary(const void *data, size_t length, std::vector<std::string> *namesOut)
+{
+    gl::BinarySectionReader reader(data, length);
+
+    const uint8_t *recordData = NULL;
+    const uint8_t *nameData = NULL;
+    size_t recordLength = 0;
+    size_t nameLength = 0;
+    if (!reader.valid() || reader.layoutVersion() != 7 ||
+        !reader.getSection(RecordsSection, &recordData, &recordLength) ||
+        !reader.getSection(NamesSection, &nameData, &nameLength))
+    {
+        return false;
+    }
+
+    gl::BinaryInputStream recordStream(recordData, recordLength);
+    std::vector<Record> records;
+    recordStream.readArray(&records);
+    if (recordStream.error())
+    {
+        return false;
+    }
+
+    gl::BinaryInputStream nameStream(nameData, nameLength);
+    for (size_t i = 0; i < records.size(); i++)
+    {
+        gl::BinaryStringView name;
+        nameStream.readCharacters(records[i].nameLength, &name);
+        if (nameStream.error())
+        {
+            return false;
+        }
+        namesOut->push_back(name.str());
+    }
+
+    return true;
+}
+
+TEST(BinaryStreamTest, ArraysRoundTrip)
+{
+    Record records[3] = { { 1, -5, 0.25f }, { 2, 7, 1.0f }, { 3, 1 << 30, -2.0f } };
+    std::vector<Record> recordVector(records, records + 3);
+
+    gl::BinaryOutputStream outputStream;
+    outputStream.writeArray(records, 3);
+    outputStream.writeArray(recordVector);
+    outputStream.writeArray(std::vector<Record>());
+    EXPECT_EQ(sizeof(records) * 2 + sizeof(int) * 2, outputStream.length());
+
+    gl::BinaryInputStream inputStream(outputStream.data(), outputStream.length());
+    Record readRecords[3];
+    inputStream.readArray(readRecords, 3);
+    std::vector<Record> readVector;
+    inputStream.readArray(&readVector);
+    std::vector<Record> emptyVector;
+    inputStream.readArray(&emptyVector);
+
+    EXPECT_FALSE(inputStream.error());
+    EXPECT_TRUE(inputStream.endOfStream());
+    EXPECT_EQ(0, memcmp(records, readRecords, sizeof(records)));
+    ASSERT_EQ(3u, readVector.size());
+    EXPECT_EQ(0, memcmp(records, &readVector[0], sizeof(records)));
+    EXPECT_TRUE(emptyVector.empty());
+}
+
+TEST(BinaryStreamTest, ArraysPastTheEndAreErrors)
+{
+    Record records[2] = { { 1, 2, 3.0f }, { 4, 5, 6.0f } };
+    gl::BinaryOutputStream outputStream;
+    outputStream.writeArray(records, 2);
+
+    gl::BinaryInputStream inputStream(outputStream.data(), outputStream.length() - 1);
+    Record readRecords[2];
+    inputStream.readArray(readRecords, 2);
+    EXPECT_TRUE(inputStream.error());
+    EXPECT_EQ(0u, inputStream.offset());
+
+    // A count so large that its size in bytes overflows
+    gl::BinaryOutputStream countStream;
+    countStream.writeInt(-1);
+    gl::BinaryInputStream countInputStream(countStream.data(), countStream.length());
+    std::vector<Record> readVector;
+    countInputStream.readArray(&readVector);
+    EXPECT_TRUE(countInputStream.error());
+    EXPECT_TRUE(readVector.empty());
+}
+
+TEST(BinaryStreamTest, StringViewsPointIntoTheBuffer)
+{
+    gl::BinaryOutputStream outputStream;
+    outputStream.writeString("lightColor");
+    outputStream.writeCharacters("bones");
+    outputStream.writeString("");
+
+    gl::BinaryInputStream inputStream(outputStream.data(), outputStream.length());
+    gl::BinaryStringView first;
+    gl::BinaryStringView second;
+    gl::BinaryStringView empty;
+    inputStream.readStringView(&first);
+    inputStream.readCharacters(5, &second);
+    inputStream.readStringView(&empty);
+
+    EXPECT_FALSE(inputStream.error());
+    EXPECT_TRUE(inputStream.endOfStream());
+    EXPECT_EQ("lightColor", first.str());
+    EXPECT_EQ("bones", second.str());
+    EXPECT_EQ(0u, empty.length);
+
+    const char *buffer = static_cast<const char*>(outputStream.data());
+    EXPECT_EQ(buffer + sizeof(int), first.data);
+    EXPECT_EQ(first.data + first.length, second.data);
+}
+
+TEST(BinaryStreamTest, StringsPastTheEndAreErrors)
+{
+    gl::BinaryOutputStream outputStream;
+    outputStream.writeString("uniform");
+
+    gl::BinaryInputStream truncatedStream(outputStream.data(), outputStream.length() - 1);
+    gl::BinaryStringView view;
+    truncatedStream.readStringView(&view);
+    EXPECT_TRUE(truncatedStream.error());
+    EXPECT_EQ(NULL, view.data);
+
+    // Lengths that wrap around when added to the offset
+    gl::BinaryOutputStream hugeStream;
+    hugeStream.writeInt(-2);
+    hugeStream.writeBytes(reinterpret_cast<const unsigned char*>("abcd"), 4);
+
+    gl::BinaryInputStream hugeViewStream(hugeStream.data(), hugeStream.length());
+    hugeViewStream.readStringView(&view);
+    EXPECT_TRUE(hugeViewStream.error());
+
+    gl::BinaryInputStream hugeStringStream(hugeStream.data(), hugeStream.length());
+    std::string string;
+    hugeStringStream.readString(&string);
+    EXPECT_TRUE(hugeStringStream.error());
+    EXPECT_TRUE(string.empty());
+}
+
+TEST(BinaryStreamTest, Alignment)
+{
+    gl::BinaryOutputStream outputStream;
+    outputStream.writeBytes(reinterpret_cast<const unsigned char*>("abc"), 3);
+    outputStream.align(16);
+    EXPECT_EQ(16u, outputStream.length());
+    outputStream.writeInt(42);
+    outputStream.align(16);
+    EXPECT_EQ(32u, outputStream.length());
+    outputStream.align(16);
+    EXPECT_EQ(32u, outputStream.length());
+
+    gl::BinaryInputStream inputStream(outputStream.data(), outputStream.length());
+    inputStream.skip(3);
+    inputStream.align(16);
+    EXPECT_EQ(42, inputStream.readInt<int>());
+    inputStream.align(16);
+    EXPECT_FALSE(inputStream.error());
+    EXPECT_TRUE(inputStream.endOfStream());
+
+    // Padding that runs past the end
+    gl::BinaryInputStream shortStream(outputStream.data(), 20);
+    shortStream.skip(17);
+    shortStream.align(16);
+    EXPECT_TRUE(shortStream.error());
+}
+
+TEST(BinaryStreamTest, SectionsRoundTrip)
+{
+    gl::BinaryOutputStream stream;
+    WriteSectionedBinary(&stream);
+
+    EXPECT_TRUE(gl::BinarySectionReader::IsSectioned(stream.data(), stream.length()));
+
+    gl::BinarySectionReader reader(stream.data(), stream.length());
+    ASSERT_TRUE(reader.valid());
+    EXPECT_EQ(7u, reader.layoutVersion());
+
+    const uint8_t *sectionData = NULL;
+    size_t sectionLength = 0;
+    ASSERT_TRUE(reader.getSection(RecordsSection, &sectionData, &sectionLength));
+    EXPECT_EQ(0u, (sectionData - static_cast<const uint8_t*>(stream.data())) % gl::BinarySectionAlignment);
+
+    ASSERT_TRUE(reader.getSection(EmptySection, &sectionData, &sectionLength));
+    EXPECT_EQ(0u, sectionLength);
+    EXPECT_FALSE(reader.getSection(4, &sectionData, &sectionLength));
+
+    std::vector<std::string> names;
+    ASSERT_TRUE(ReadSectionedBinary(stream.data(), stream.length(), &names));
+    ASSERT_EQ(4u, names.size());
+    EXPECT_EQ("position", names[0]);
+    EXPECT_EQ("normal", names[1]);
+    EXPECT_EQ("texcoord0", names[2]);
+    EXPECT_EQ("", names[3]);
+}
+
+TEST(BinaryStreamTest, OtherLayoutsAreNotSectioned)
+{
+    // Binaries from before the sectioned layout start with their binary format
+    gl::BinaryOutputStream stream;
+    stream.writeInt(GL_PROGRAM_BINARY_ANGLE);
+    stream.writeInt(2);
+    stream.writeInt(1);
+
+    EXPECT_FALSE(gl::BinarySectionReader::IsSectioned(stream.data(), stream.length()));
+    EXPECT_FALSE(gl::BinarySectionReader(stream.data(), stream.length()).valid());
+    EXPECT_FALSE(gl::BinarySectionReader::IsSectioned(NULL, 0));
+}
+
+TEST(BinaryStreamTest, TruncatedSectionsAreRejected)
+{
+    gl::BinaryOutputStream stream;
+    WriteSectionedBinary(&stream);
+    const uint8_t *data = static_cast<const uint8_t*>(stream.data());
+
+    // Copies, so that reading past the end of a truncated one is caught by memory checkers
+    for (size_t length = 0; length < stream.length(); length++)
+    {
+        std::vector<uint8_t> truncated(data, data + length);
+        std::vector<std::string> names;
+        EXPECT_FALSE(ReadSectionedBinary(truncated.empty() ? NULL : &truncated[0], length, &names)) << "length " << length;
+    }
+}
+
+TEST(BinaryStreamTest, CorruptedSectionsStayInBounds)
+{
+    gl::BinaryOutputStream stream;
+    WriteSectionedBinary(&stream);
+    const uint8_t *data = static_cast<const uint8_t*>(stream.data());
+
+    // Changes each byte of the table and the records to a few values, including ones that make
+    // lengths and offsets huge
+    const uint8_t values[] = { 0x00, 0x01, 0x0F, 0x10, 0x7F, 0x80, 0xFF };
+    for (size_t byteIndex = 0; byteIndex < stream.length(); byteIndex++)
+    {
+        for (size_t valueIndex = 0; valueIndex < ArraySize(values); valueIndex++)
+        {
+            std::vector<uint8_t> corrupted(data, data + stream.length());
+            corrupted[byteIndex] = values[valueIndex];
+
+            gl::BinarySectionReader reader(&corrupted[0], corrupted.size());
+            const uint8_t *sectionData = NULL;
+            size_t sectionLength = 0;
+            for (uint32_t section = RecordsSection; reader.valid() && section <= EmptySection; section++)
+            {
+                if (reader.getSection(section, &sectionData, &sectionLength))
+                {
+                    EXPECT_GE(sectionData, &corrupted[0]);
+                    EXPECT_LE(sectionData + sectionLength, &corrupted[0] + corrupted.size());
+                }
+            }
+
+            std::vector<std::string> names;
+            ReadSectionedBinary(&corrupted[0], corrupted.size(), &names);
+        }
+    }
+}
+
+}
@@ -0,0 +1,96 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "libGLESv2/renderer/copyimage.h"
+
+#include <vector>
+
+using namespace rx;
+
+namespace
+{
+
+// Every pair of formats that read and write floats, unsigned integers or
+// signed integers.
+TEST(ColorRowCopyTest, CoversAllPairs)
+{
+    const size_t floatFormats = 57;
+    const size_t uintFormats = 17;
+    const size_t intFormats = 12;
+    EXPECT_EQ(floatFormats * floatFormats + uintFormats * uintFormats + intFormats * intFormats,
+              GetColorRowCopies().size());
+}
+
+// Each row copy writes the same bytes as calling the read and write functions
+// for each pixel.
+TEST(ColorRowCopyTest, MatchesPerPixelCopy)
+{
+    const size_t pixelCount = 37;
+
+    uint32_t random = 1;
+    const std::vector<ColorRowCopy> &copies = GetColorRowCopies();
+    for (size_t copyIndex = 0; copyIndex < copies.size(); copyIndex++)
+    {
+        const ColorRowCopy &copy = copies[copyIndex];
+
+        // Bytes below 0x3C make floats and half floats smaller than 1, which
+        // every normalized format can store.
+        std::vector<uint8_t> source(pixelCount * copy.sourcePixelBytes);
+        for (size_t i = 0; i < source.size(); i++)
+        {
+            random = random * 1664525u + 1013904223u;
+            source[i] = static_cast<uint8_t>((random >> 16) % 0x3C);
+        }
+
+        std::vector<uint8_t> expected(pixelCount * copy.destPixelBytes, 0xCD);
+        for (size_t i = 0; i < pixelCount; i++)
+        {
+            uint8_t color[16] = { 0 };
+            copy.readFunction(&source[i * copy.sourcePixelBytes], color);
+            copy.writeFunction(color, &expected[i * copy.destPixelBytes]);
+        }
+
+        std::vector<uint8_t> actual(pixelCount * copy.destPixelBytes, 0xCD);
+        copy.copyRowFunction(pixelCount, &source[0], &actual[0]);
+
+        ASSERT_EQ(expected, actual) << "copy " << copyIndex;
+        EXPECT_EQ(copy.copyRowFunction, GetColorRowCopyFunction(copy.readFunction, copy.sourcePixelBytes,
+                                                                copy.writeFunction, copy.destPixelBytes));
+    }
+}
+
+// 8 bit normalized formats are copied without going through floats, which
+// must not change any value.
+TEST(ColorRowCopyTest, UNorm8AllValues)
+{
+    std::vector<uint8_t> source(256 * 4);
+    for (size_t i = 0; i < source.size(); i++)
+    {
+        source[i] = static_cast<uint8_t>(i / 4 + i % 4);
+    }
+
+    std::vector<uint8_t> dest(source.size());
+    CopyColorRow<R8G8B8A8, B8G8R8A8, GLfloat>(256, &source[0], &dest[0]);
+
+    for (size_t i = 0; i < 256; i++)
+    {
+        R8G8B8A8 pixel;
+        memcpy(&pixel, &source[i * 4], sizeof(pixel));
+
+        gl::ColorF color;
+        R8G8B8A8::readColor(&color, &pixel);
+
+        B8G8R8A8 expected;
+        B8G8R8A8::writeColor(&expected, &color);
+        ASSERT_EQ(0, memcmp(&expected, &dest[i * 4], sizeof(expected))) << "pixel " << i;
+    }
+
+    EXPECT_EQ(NULL, GetColorRowCopyFunction(ReadColor<R8G8B8A8, GLfloat>, 3, WriteColor<B8G8R8A8, GLfloat>, 4));
+}
+
+}
@@ -0,0 +1,156 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "libGLESv2/renderer/copyvertexSIMD.h"
+#include "SIMDLevelTest.h"
+
+#include <string.h>
+#include <vector>
+
+using namespace rx;
+
+namespace
+{
+
+class CopyVertexSIMDTest : public SIMDLevelTest
+{
+  protected:
+    // Converts |count| vertices |stride| apart, starting |offset| bytes into
+    // the input, with both versions and compares every output byte,
+    // including guard bytes past the end.
+    void check(VertexCopyKernel kernel, VertexCopyFunction function, size_t count, size_t stride, size_t offset,
+               unsigned int *seed)
+    {
+        const VertexCopyKernelInfo &info = GetVertexCopyKernelInfo(kernel);
+
+        // Exactly as many bytes as the vertices take, so that reading past
+        // the last one is caught by tools checking memory accesses
+        size_t inputBytes = offset + ((count > 0) ? (count - 1) * stride + info.inputBytes : 0);
+        std::vector<uint8_t> input(std::max<size_t>(inputBytes, 1));
+        for (size_t i = 0; i < input.size(); i++)
+        {
+            *seed = *seed * 1664525 + 1013904223;
+            input[i] = static_cast<uint8_t>(*seed >> 24);
+        }
+
+        const size_t guardBytes = 32;
+        std::vector<uint8_t> expected(count * info.outputBytes + guardBytes, 0xCD);
+        std::vector<uint8_t> actual(expected.size(), 0xCD);
+
+        GetVertexCopyFunction(kernel, gl::SIMD_SCALAR)(&input[0] + offset, stride, count, &expected[0]);
+        function(&input[0] + offset, stride, count, &actual[0]);
+
+        for (size_t i = 0; i < expected.size(); i++)
+        {
+            ASSERT_EQ(expected[i], actual[i]) << "byte " << i << " of vertex " << i / info.outputBytes;
+        }
+    }
+};
+
+// Every version of every kernel writes the same bytes as the template it
+// replaces, whatever the stride, count and alignment.
+TEST_P(CopyVertexSIMDTest, MatchesTemplates)
+{
+    if (!isSupported())
+    {
+        return;
+    }
+
+    unsigned int seed = 7;
+    for (size_t kernelIndex = 0; kernelIndex < VERTEX_COPY_KERNEL_COUNT; kernelIndex++)
+    {
+        VertexCopyKernel kernel = static_cast<VertexCopyKernel>(kernelIndex);
+        VertexCopyFunction function = GetVertexCopyFunction(kernel, level());
+        if (!function)
+        {
+            continue;
+        }
+        SCOPED_TRACE(GetVertexCopyKernelInfo(kernel).name);
+
+        const size_t inputBytes = GetVertexCopyKernelInfo(kernel).inputBytes;
+        const size_t strides[] = { 0, inputBytes, inputBytes + 1, inputBytes + 2, 16, 20, 32, 33 };
+        for (size_t strideIndex = 0; strideIndex < ArraySize(strides); strideIndex++)
+        {
+            size_t stride = strides[strideIndex];
+            for (size_t count = 0; count <= 40; count++)
+            {
+                for (size_t offset = 0; offset < 4; offset++)
+                {
+                    SCOPED_TRACE(testing::Message() << count << " vertices " << stride << " bytes apart at offset " << offset);
+                    check(kernel, function, count, stride, offset, &seed);
+                }
+            }
+        }
+
+        // Random strides and counts
+        for (size_t iteration = 0; iteration < 50; iteration++)
+        {
+            seed = seed * 1664525 + 1013904223;
+            size_t stride = inputBytes + (seed >> 8) % 48;
+            size_t count = (seed >> 16) % 1000;
+            SCOPED_TRACE(testing::Message() << count << " vertices " << stride << " bytes apart");
+            check(kernel, function, count, stride, seed % 4, &seed);
+        }
+    }
+}
+
+ANGLE_INSTANTIATE_SIMD_LEVEL_TEST(CopyVertexSIMDTest, gl::SIMD_SCALAR);
+
+// Every 10-10-10-2 value converts the same way.
+TEST(CopyVertexSIMDTest, XYZ10W2AllValues)
+{
+    const VertexCopyKernel kernels[] =
+    {
+        VERTEX_COPY_XYZ10W2_UINT_TO_32F,
+        VERTEX_COPY_XYZ10W2_UNORM_TO_32F,
+        VERTEX_COPY_XYZ10W2_SINT_TO_32F,
+        VERTEX_COPY_XYZ10W2_SNORM_TO_32F,
+    };
+
+    // Each component takes every value across the vertices
+    std::vector<GLuint> input(4096);
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        GLuint value = static_cast<GLuint>(i % 1024);
+        input[i] = value | (((value * 7) % 1024) << 10) | (((value * 13) % 1024) << 20) | static_cast<GLuint>((i / 1024) << 30);
+    }
+
+    for (size_t kernelIndex = 0; kernelIndex < ArraySize(kernels); kernelIndex++)
+    {
+        VertexCopyKernel kernel = kernels[kernelIndex];
+        SCOPED_TRACE(GetVertexCopyKernelInfo(kernel).name);
+
+        std::vector<GLfloat> expected(input.size() * 4);
+        std::vector<GLfloat> actual(expected.size());
+        const uint8_t *source = reinterpret_cast<const uint8_t*>(&input[0]);
+        GetVertexCopyFunction(kernel, gl::SIMD_SCALAR)(source, sizeof(GLuint), input.size(), reinterpret_cast<uint8_t*>(&expected[0]));
+        GetBestVertexCopyFunction(kernel)(source, sizeof(GLuint), input.size(), reinterpret_cast<uint8_t*>(&actual[0]));
+        ASSERT_EQ(0, memcmp(&expected[0], &actual[0], expected.size() * sizeof(GLfloat)));
+    }
+}
+
+TEST(CopyVertexSIMDTest, CountVectorVertices)
+{
+    // The last vertex is always left out
+    EXPECT_EQ(0u, priv::CountVectorVertices(0, 16, 16, 16));
+    EXPECT_EQ(0u, priv::CountVectorVertices(1, 16, 16, 16));
+    EXPECT_EQ(9u, priv::CountVectorVertices(10, 16, 16, 16));
+
+    // Reading 16 bytes of 12 byte vertices packed together
+    EXPECT_EQ(9u, priv::CountVectorVertices(10, 12, 12, 16));
+
+    // Reading 4 bytes of 1 byte vertices packed together stops 3 bytes early
+    EXPECT_EQ(7u, priv::CountVectorVertices(10, 1, 1, 4));
+    EXPECT_EQ(0u, priv::CountVectorVertices(3, 1, 1, 4));
+
+    // Vertices all read from the same place
+    EXPECT_EQ(9u, priv::CountVectorVertices(10, 0, 4, 4));
+    EXPECT_EQ(0u, priv::CountVectorVertices(10, 0, 2, 4));
+}
+
+}
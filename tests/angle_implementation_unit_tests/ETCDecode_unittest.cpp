@@ -0,0 +1,796 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "libGLESv2/renderer/loadimage.h"
+#include "libGLESv2/renderer/loadimageETC.h"
+#include "SIMDLevelTest.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+using namespace rx;
+
+namespace
+{
+
+// Builds a block from the fields of the ES 3.0.2 spec, section C.1, which
+// number the bits of the 64-bit words from the most significant bit of the
+// first byte.
+class BlockBuilder
+{
+  public:
+    BlockBuilder()
+        : mBits(0)
+    {
+    }
+
+    BlockBuilder &set(unsigned int high, unsigned int low, uint64_t value)
+    {
+        uint64_t mask = ((uint64_t(1) << (high - low + 1)) - 1) << low;
+        mBits = (mBits & ~mask) | ((value << low) & mask);
+        return *this;
+    }
+
+    uint64_t get(unsigned int high, unsigned int low) const
+    {
+        return (mBits >> low) & ((uint64_t(1) << (high - low + 1)) - 1);
+    }
+
+    // ETC pixel indices are stored column major, the high bits in the
+    // upper half.
+    BlockBuilder &setETCIndex(size_t x, size_t y, unsigned int index)
+    {
+        unsigned int k = static_cast<unsigned int>(x * 4 + y);
+        set(16 + k, 16 + k, index >> 1);
+        return set(k, k, index & 1);
+    }
+
+    BlockBuilder &setEACIndex(size_t x, size_t y, unsigned int index)
+    {
+        unsigned int k = static_cast<unsigned int>(x * 4 + y);
+        return set(47 - 3 * k, 45 - 3 * k, index);
+    }
+
+    // Sets the bits of the 5-bit base color and 3-bit difference at |high|
+    // that no mode uses for anything else, so that the sum overflows.
+    BlockBuilder &forceOverflow(unsigned int high)
+    {
+        uint64_t lowBits = get(high - 3, high - 4) + get(high - 6, high - 7);
+        if (lowBits > 3)
+        {
+            // 0b111xx + 0b0yy > 31
+            set(high, high - 2, 7);
+            return set(high - 5, high - 5, 0);
+        }
+        else
+        {
+            // 0b000xx + 0b1yy < 0
+            set(high, high - 2, 0);
+            return set(high - 5, high - 5, 1);
+        }
+    }
+
+    // Sets the top bit of the base color at |high| so that adding the
+    // difference doesn't overflow.
+    BlockBuilder &avoidOverflow(unsigned int high)
+    {
+        return set(high, high, get(high - 5, high - 5));
+    }
+
+    void write(uint8_t *dest) const
+    {
+        for (size_t i = 0; i < 8; i++)
+        {
+            dest[i] = static_cast<uint8_t>(mBits >> (56 - 8 * i));
+        }
+    }
+
+  private:
+    uint64_t mBits;
+};
+
+std::vector<uint8_t> MakeBlocks(const BlockBuilder &first)
+{
+    std::vector<uint8_t> blocks(8);
+    first.write(&blocks[0]);
+    return blocks;
+}
+
+std::vector<uint8_t> MakeBlocks(const BlockBuilder &first, const BlockBuilder &second)
+{
+    std::vector<uint8_t> blocks(16);
+    first.write(&blocks[0]);
+    second.write(&blocks[8]);
+    return blocks;
+}
+
+// Decodes one 4x4 block.
+std::vector<uint8_t> DecodeBlock(LoadImageFunction loadFunction, const std::vector<uint8_t> &block, size_t pixelBytes)
+{
+    std::vector<uint8_t> pixels(16 * pixelBytes);
+    loadFunction(4, 4, 1, &block[0], block.size(), block.size(), &pixels[0], 4 * pixelBytes, 16 * pixelBytes);
+    return pixels;
+}
+
+uint8_t Clamp(int value)
+{
+    return static_cast<uint8_t>(std::min(std::max(value, 0), 255));
+}
+
+struct Color
+{
+    int r;
+    int g;
+    int b;
+};
+
+void ExpectRGBA(const std::vector<uint8_t> &pixels, size_t x, size_t y, int r, int g, int b, int a)
+{
+    const uint8_t *pixel = &pixels[(y * 4 + x) * 4];
+    EXPECT_EQ(Clamp(r), pixel[0]) << "red at " << x << "," << y;
+    EXPECT_EQ(Clamp(g), pixel[1]) << "green at " << x << "," << y;
+    EXPECT_EQ(Clamp(b), pixel[2]) << "blue at " << x << "," << y;
+    EXPECT_EQ(a, pixel[3]) << "alpha at " << x << "," << y;
+}
+
+uint16_t GetR16(const std::vector<uint8_t> &pixels, size_t x, size_t y, size_t channelCount, size_t channel)
+{
+    size_t offset = ((y * 4 + x) * channelCount + channel) * 2;
+    return static_cast<uint16_t>(pixels[offset] | (pixels[offset + 1] << 8));
+}
+
+const int kModifiers[8][2] = { { 2, 8 }, { 5, 17 }, { 9, 29 }, { 13, 42 }, { 18, 60 }, { 24, 80 }, { 33, 106 }, { 47, 183 } };
+
+int Modifier(int table, unsigned int index)
+{
+    const int magnitude = kModifiers[table][index & 1];
+    return (index & 2) ? -magnitude : magnitude;
+}
+
+TEST(ETCDecodeTest, IndividualMode)
+{
+    // 4-bit base colors 0x1 0x8 0xF and 0xA 0x2 0x0, tables 0 and 7, side by
+    // side subblocks
+    BlockBuilder block;
+    block.set(63, 60, 0x1).set(59, 56, 0xA)
+         .set(55, 52, 0x8).set(51, 48, 0x2)
+         .set(47, 44, 0xF).set(43, 40, 0x0)
+         .set(39, 37, 0).set(36, 34, 7)
+         .set(33, 33, 0).set(32, 32, 0);
+    for (size_t y = 0; y < 4; y++)
+    {
+        for (size_t x = 0; x < 4; x++)
+        {
+            block.setETCIndex(x, y, (x + 2 * y) % 4);
+        }
+    }
+
+    const Color baseColors[2] = { { 0x11, 0x88, 0xFF }, { 0xAA, 0x22, 0x00 } };
+    const int tables[2] = { 0, 7 };
+
+    std::vector<uint8_t> pixels = DecodeBlock(LoadETC2RGB8ToRGBA8, MakeBlocks(block), 4);
+    for (size_t y = 0; y < 4; y++)
+    {
+        for (size_t x = 0; x < 4; x++)
+        {
+            size_t subblock = (x >= 2) ? 1 : 0;
+            int modifier = Modifier(tables[subblock], (x + 2 * y) % 4);
+            const Color &base = baseColors[subblock];
+            ExpectRGBA(pixels, x, y, base.r + modifier, base.g + modifier, base.b + modifier, 255);
+        }
+    }
+
+    // The corners, worked out by hand
+    ExpectRGBA(pixels, 0, 0, 19, 138, 255, 255);
+    ExpectRGBA(pixels, 3, 3, 255, 217, 183, 255);
+}
+
+TEST(ETCDecodeTest, DifferentialModeFlipped)
+{
+    // 5-bit base color 20 5 31 and differences -3 +3 0, tables 3 and 5,
+    // subblocks one above the other
+    BlockBuilder block;
+    block.set(63, 59, 20).set(58, 56, 5)
+         .set(55, 51, 5).set(50, 48, 3)
+         .set(47, 43, 31).set(42, 40, 0)
+         .set(39, 37, 3).set(36, 34, 5)
+         .set(33, 33, 1).set(32, 32, 1);
+    for (size_t y = 0; y < 4; y++)
+    {
+        for (size_t x = 0; x < 4; x++)
+        {
+            block.setETCIndex(x, y, (3 * x + y) % 4);
+        }
+    }
+
+    const Color baseColors[2] = { { 165, 41, 255 }, { 140, 66, 255 } };
+    const int tables[2] = { 3, 5 };
+
+    std::vector<uint8_t> pixels = DecodeBlock(LoadETC2RGB8ToRGBA8, MakeBlocks(block), 4);
+    for (size_t y = 0; y < 4; y++)
+    {
+        for (size_t x = 0; x < 4; x++)
+        {
+            size_t subblock = (y >= 2) ? 1 : 0;
+            int modifier = Modifier(tables[subblock], (3 * x + y) % 4);
+            const Color &base = baseColors[subblock];
+            ExpectRGBA(pixels, x, y, base.r + modifier, base.g + modifier, base.b + modifier, 255);
+        }
+    }
+}
+
+BlockBuilder MakeTModeBlock()
+{
+    // Colors 0x5 0xC 0x3 and 0x8 0x0 0xF, distance 5
+    BlockBuilder block;
+    block.set(60, 59, 0x5 >> 2).set(57, 56, 0x5 & 3)
+         .set(55, 52, 0xC).set(51, 48, 0x3)
+         .set(47, 44, 0x8).set(43, 40, 0x0).set(39, 36, 0xF)
+         .set(35, 34, 5 >> 1).set(32, 32, 5 & 1)
+         .set(33, 33, 1)
+         .forceOverflow(63);
+    for (size_t y = 0; y < 4; y++)
+    {
+        for (size_t x = 0; x < 4; x++)
+        {
+            block.setETCIndex(x, y, (3 * x + y) % 4);
+        }
+    }
+    return block;
+}
+
+TEST(ETCDecodeTest, TMode)
+{
+    const Color paintColors[4] =
+    {
+        {  85, 204,  51 },
+        { 168,  32, 287 },
+        { 136,   0, 255 },
+        { 104, -32, 223 },
+    };
+
+    std::vector<uint8_t> pixels = DecodeBlock(LoadETC2RGB8ToRGBA8, MakeBlocks(MakeTModeBlock()), 4);
+    for (size_t y = 0; y < 4; y++)
+    {
+        for (size_t x = 0; x < 4; x++)
+        {
+            const Color &color = paintColors[(3 * x + y) % 4];
+            ExpectRGBA(pixels, x, y, color.r, color.g, color.b, 255);
+        }
+    }
+}
+
+BlockBuilder MakeHModeBlock(int r1, int g1, int b1, int r2, int g2, int b2, int distanceHighBits)
+{
+    BlockBuilder block;
+    block.set(62, 59, r1)
+         .set(58, 56, g1 >> 1).set(52, 52, g1 & 1)
+         .set(51, 51, b1 >> 3).set(49, 47, b1 & 7)
+         .set(46, 43, r2).set(42, 39, g2).set(38, 35, b2)
+         .set(34, 34, distanceHighBits >> 1).set(32, 32, distanceHighBits & 1)
+         .set(33, 33, 1)
+         .forceOverflow(55)
+         .avoidOverflow(63);
+    for (size_t y = 0; y < 4; y++)
+    {
+        for (size_t x = 0; x < 4; x++)
+        {
+            block.setETCIndex(x, y, (x + y) % 4);
+        }
+    }
+    return block;
+}
+
+TEST(ETCDecodeTest, HMode)
+{
+    // The first color is less than the second, so the distance index is
+    // 0b100 and the distance 23
+    {
+        const Color paintColors[4] =
+        {
+            {  51 + 23, 170 + 23, 102 + 23 },
+            {  51 - 23, 170 - 23, 102 - 23 },
+            { 204 + 23,  85 + 23, 153 + 23 },
+            { 204 - 23,  85 - 23, 153 - 23 },
+        };
+
+        std::vector<uint8_t> pixels = DecodeBlock(LoadETC2RGB8ToRGBA8, MakeBlocks(MakeHModeBlock(0x3, 0xA, 0x6, 0xC, 0x5, 0x9, 2)), 4);
+        for (size_t y = 0; y < 4; y++)
+        {
+            for (size_t x = 0; x < 4; x++)
+            {
+                const Color &color = paintColors[(x + y) % 4];
+                ExpectRGBA(pixels, x, y, color.r, color.g, color.b, 255);
+            }
+        }
+    }
+
+    // Swapped, the distance index is 0b101 and the distance 32
+    {
+        const Color paintColors[4] =
+        {
+            { 204 + 32,  85 + 32, 153 + 32 },
+            { 204 - 32,  85 - 32, 153 - 32 },
+            {  51 + 32, 170 + 32, 102 + 32 },
+            {  51 - 32, 170 - 32, 102 - 32 },
+        };
+
+        std::vector<uint8_t> pixels = DecodeBlock(LoadETC2RGB8ToRGBA8, MakeBlocks(MakeHModeBlock(0xC, 0x5, 0x9, 0x3, 0xA, 0x6, 2)), 4);
+        for (size_t y = 0; y < 4; y++)
+        {
+            for (size_t x = 0; x < 4; x++)
+            {
+                const Color &color = paintColors[(x + y) % 4];
+                ExpectRGBA(pixels, x, y, color.r, color.g, color.b, 255);
+            }
+        }
+    }
+}
+
+TEST(ETCDecodeTest, PlanarMode)
+{
+    // 6-, 7- and 6-bit origin, horizontal and vertical colors
+    const int origin[3] = { 10, 100, 40 };
+    const int horizontal[3] = { 50, 20, 63 };
+    const int vertical[3] = { 0, 127, 33 };
+
+    BlockBuilder block;
+    block.set(62, 57, origin[0])
+         .set(56, 56, origin[1] >> 6).set(54, 49, origin[1] & 0x3F)
+         .set(48, 48, origin[2] >> 5).set(44, 43, (origin[2] >> 3) & 3).set(41, 39, origin[2] & 7)
+         .set(38, 34, horizontal[0] >> 1).set(32, 32, horizontal[0] & 1)
+         .set(31, 25, horizontal[1]).set(24, 19, horizontal[2])
+         .set(18, 13, vertical[0]).set(12, 6, vertical[1]).set(5, 0, vertical[2])
+         .set(33, 33, 1)
+         .forceOverflow(47)
+         .avoidOverflow(63)
+         .avoidOverflow(55);
+
+    // Extended to 8 bits by repeating the high bits
+    const int extendedOrigin[3] = { 40, 201, 162 };
+    const int extendedHorizontal[3] = { 203, 40, 255 };
+    const int extendedVertical[3] = { 0, 255, 134 };
+
+    std::vector<uint8_t> pixels = DecodeBlock(LoadETC2RGB8ToRGBA8, MakeBlocks(block), 4);
+    for (int y = 0; y < 4; y++)
+    {
+        for (int x = 0; x < 4; x++)
+        {
+            int color[3];
+            for (size_t c = 0; c < 3; c++)
+            {
+                color[c] = (x * (extendedHorizontal[c] - extendedOrigin[c]) + y * (extendedVertical[c] - extendedOrigin[c]) +
+                            4 * extendedOrigin[c] + 2) >> 2;
+            }
+            ExpectRGBA(pixels, x, y, color[0], color[1], color[2], 255);
+        }
+    }
+
+    ExpectRGBA(pixels, 0, 0, 40, 201, 162, 255);
+    ExpectRGBA(pixels, 3, 0, 162, 80, 232, 255);
+}
+
+TEST(ETCDecodeTest, PunchthroughTransparent)
+{
+    // Differential mode without the opaque bit: index 0 is the base color,
+    // index 2 transparent black
+    BlockBuilder block;
+    block.set(63, 59, 16).set(58, 56, 0)
+         .set(55, 51, 8).set(50, 48, 0)
+         .set(47, 43, 24).set(42, 40, 0)
+         .set(39, 37, 1).set(36, 34, 1)
+         .set(33, 33, 0).set(32, 32, 0);
+    for (size_t y = 0; y < 4; y++)
+    {
+        for (size_t x = 0; x < 4; x++)
+        {
+            block.setETCIndex(x, y, (x + y) % 4);
+        }
+    }
+
+    std::vector<uint8_t> pixels = DecodeBlock(LoadETC2RGB8A1ToRGBA8, MakeBlocks(block), 4);
+    const Color base = { 132, 66, 198 };
+    for (size_t y = 0; y < 4; y++)
+    {
+        for (size_t x = 0; x < 4; x++)
+        {
+            switch ((x + y) % 4)
+            {
+              case 0: ExpectRGBA(pixels, x, y, base.r, base.g, base.b, 255); break;
+              case 1: ExpectRGBA(pixels, x, y, base.r + 17, base.g + 17, base.b + 17, 255); break;
+              case 2: ExpectRGBA(pixels, x, y, 0, 0, 0, 0); break;
+              case 3: ExpectRGBA(pixels, x, y, base.r - 17, base.g - 17, base.b - 17, 255); break;
+            }
+        }
+    }
+
+    // With the opaque bit, the same as the RGB format
+    block.set(33, 33, 1);
+    EXPECT_EQ(DecodeBlock(LoadETC2RGB8ToRGBA8, MakeBlocks(block), 4),
+              DecodeBlock(LoadETC2RGB8A1ToRGBA8, MakeBlocks(block), 4));
+}
+
+TEST(ETCDecodeTest, PunchthroughTAndPlanarModes)
+{
+    // T mode makes index 2 transparent
+    BlockBuilder tBlock = MakeTModeBlock();
+    tBlock.set(33, 33, 0);
+
+    std::vector<uint8_t> opaque = DecodeBlock(LoadETC2RGB8ToRGBA8, MakeBlocks(MakeTModeBlock()), 4);
+    std::vector<uint8_t> pixels = DecodeBlock(LoadETC2RGB8A1ToRGBA8, MakeBlocks(tBlock), 4);
+    for (size_t y = 0; y < 4; y++)
+    {
+        for (size_t x = 0; x < 4; x++)
+        {
+            size_t offset = (y * 4 + x) * 4;
+            if ((3 * x + y) % 4 == 2)
+            {
+                ExpectRGBA(pixels, x, y, 0, 0, 0, 0);
+            }
+            else
+            {
+                EXPECT_TRUE(std::equal(&opaque[offset], &opaque[offset + 4], &pixels[offset])) << x << "," << y;
+            }
+        }
+    }
+
+    // Planar blocks are opaque either way
+    BlockBuilder opaquePlanarBlock;
+    opaquePlanarBlock.set(62, 57, 0x2A).set(31, 25, 0x55).set(5, 0, 0x15)
+                     .set(33, 33, 1)
+                     .forceOverflow(47)
+                     .avoidOverflow(63)
+                     .avoidOverflow(55);
+    BlockBuilder planarBlock = opaquePlanarBlock;
+    planarBlock.set(33, 33, 0);
+
+    std::vector<uint8_t> planarPixels = DecodeBlock(LoadETC2RGB8A1ToRGBA8, MakeBlocks(planarBlock), 4);
+    EXPECT_EQ(DecodeBlock(LoadETC2RGB8ToRGBA8, MakeBlocks(opaquePlanarBlock), 4), planarPixels);
+    for (size_t i = 0; i < 16; i++)
+    {
+        EXPECT_EQ(255, planarPixels[i * 4 + 3]);
+    }
+}
+
+const int kEACModifiers[16][8] =
+{
+    { -3, -6,  -9, -15, 2, 5, 8, 14 },
+    { -3, -7, -10, -13, 2, 6, 9, 12 },
+    { -2, -5,  -8, -13, 1, 4, 7, 12 },
+    { -2, -4,  -6, -13, 1, 3, 5, 12 },
+    { -3, -6,  -8, -12, 2, 5, 7, 11 },
+    { -3, -7,  -9, -11, 2, 6, 8, 10 },
+    { -4, -7,  -8, -11, 3, 6, 7, 10 },
+    { -3, -5,  -8, -11, 2, 4, 7, 10 },
+    { -2, -6,  -8, -10, 1, 5, 7,  9 },
+    { -2, -5,  -8, -10, 1, 4, 7,  9 },
+    { -2, -4,  -8, -10, 1, 3, 7,  9 },
+    { -2, -5,  -7, -10, 1, 4, 6,  9 },
+    { -3, -4,  -7, -10, 2, 3, 6,  9 },
+    { -1, -2,  -3, -10, 0, 1, 2,  9 },
+    { -4, -6,  -8,  -9, 3, 5, 7,  8 },
+    { -3, -5,  -7,  -9, 2, 4, 6,  8 },
+};
+
+BlockBuilder MakeEACBlock(int base, int multiplier, int table)
+{
+    BlockBuilder block;
+    block.set(63, 56, base).set(55, 52, multiplier).set(51, 48, table);
+    for (size_t y = 0; y < 4; y++)
+    {
+        for (size_t x = 0; x < 4; x++)
+        {
+            block.setEACIndex(x, y, (x + 4 * y) % 8);
+        }
+    }
+    return block;
+}
+
+TEST(ETCDecodeTest, EACAlpha)
+{
+    BlockBuilder colorBlock;
+    colorBlock.set(63, 60, 0x7).set(55, 52, 0x3).set(47, 44, 0xC).set(39, 37, 2);
+    const std::vector<uint8_t> colors = DecodeBlock(LoadETC2RGB8ToRGBA8, MakeBlocks(colorBlock), 4);
+
+    const int cases[][3] =
+    {
+        // base, multiplier, table
+        { 100,  3, 13 },
+        { 250, 15,  0 },
+        {   5, 11,  6 },
+        { 128,  0,  9 },
+    };
+
+    for (size_t caseIndex = 0; caseIndex < ArraySize(cases); caseIndex++)
+    {
+        const int base = cases[caseIndex][0];
+        const int multiplier = cases[caseIndex][1];
+        const int table = cases[caseIndex][2];
+
+        // The alpha block comes first
+        std::vector<uint8_t> pixels = DecodeBlock(LoadETC2RGBA8ToRGBA8, MakeBlocks(MakeEACBlock(base, multiplier, table), colorBlock), 4);
+        for (size_t y = 0; y < 4; y++)
+        {
+            for (size_t x = 0; x < 4; x++)
+            {
+                size_t offset = (y * 4 + x) * 4;
+                int alpha = Clamp(base + kEACModifiers[table][(x + 4 * y) % 8] * multiplier);
+                EXPECT_EQ(alpha, pixels[offset + 3]) << caseIndex << " at " << x << "," << y;
+                EXPECT_TRUE(std::equal(&colors[offset], &colors[offset + 3], &pixels[offset])) << x << "," << y;
+            }
+        }
+    }
+}
+
+int ExpectedR11(int base, int multiplier, int modifier)
+{
+    int value = base * 8 + 4 + modifier * (multiplier == 0 ? 1 : multiplier * 8);
+    value = std::min(std::max(value, 0), 2047);
+    return (value << 5) | (value >> 6);
+}
+
+int ExpectedSignedR11(int base, int multiplier, int modifier)
+{
+    base = std::max(base, -127);
+    int value = base * 8 + modifier * (multiplier == 0 ? 1 : multiplier * 8);
+    value = std::min(std::max(value, -1023), 1023);
+    int magnitude = (std::abs(value) << 5) | (std::abs(value) >> 5);
+    return value < 0 ? -magnitude : magnitude;
+}
+
+TEST(ETCDecodeTest, EACR11)
+{
+    const int cases[][3] =
+    {
+        { 128,  2,  0 },
+        { 255, 15,  0 },
+        {   0, 15,  3 },
+        {   0,  0,  0 },
+        {  77,  0, 14 },
+    };
+
+    for (size_t caseIndex = 0; caseIndex < ArraySize(cases); caseIndex++)
+    {
+        const int base = cases[caseIndex][0];
+        const int multiplier = cases[caseIndex][1];
+        const int table = cases[caseIndex][2];
+
+        std::vector<uint8_t> pixels = DecodeBlock(LoadEACR11ToR16, MakeBlocks(MakeEACBlock(base, multiplier, table)), 2);
+        for (size_t y = 0; y < 4; y++)
+        {
+            for (size_t x = 0; x < 4; x++)
+            {
+                int expected = ExpectedR11(base, multiplier, kEACModifiers[table][(x + 4 * y) % 8]);
+                EXPECT_EQ(expected, GetR16(pixels, x, y, 1, 0)) << caseIndex << " at " << x << "," << y;
+            }
+        }
+    }
+
+    // The ends of the range
+    EXPECT_EQ(0xFFFF, GetR16(DecodeBlock(LoadEACR11ToR16, MakeBlocks(MakeEACBlock(255, 15, 0)), 2), 3, 1, 1, 0));
+    EXPECT_EQ(0x0000, GetR16(DecodeBlock(LoadEACR11ToR16, MakeBlocks(MakeEACBlock(0, 15, 0)), 2), 0, 0, 1, 0));
+}
+
+TEST(ETCDecodeTest, EACSignedR11)
+{
+    const int cases[][3] =
+    {
+        // The base is a signed byte, and -128 is treated as -127
+        { -128,  1,  0 },
+        {  127, 15,  0 },
+        {  -10,  3,  7 },
+        {    0,  0, 13 },
+        {   64,  9,  2 },
+    };
+
+    for (size_t caseIndex = 0; caseIndex < ArraySize(cases); caseIndex++)
+    {
+        const int base = cases[caseIndex][0];
+        const int multiplier = cases[caseIndex][1];
+        const int table = cases[caseIndex][2];
+
+        std::vector<uint8_t> pixels = DecodeBlock(LoadEACSignedR11ToR16, MakeBlocks(MakeEACBlock(base & 0xFF, multiplier, table)), 2);
+        for (size_t y = 0; y < 4; y++)
+        {
+            for (size_t x = 0; x < 4; x++)
+            {
+                int expected = ExpectedSignedR11(base, multiplier, kEACModifiers[table][(x + 4 * y) % 8]);
+                EXPECT_EQ(expected, static_cast<int16_t>(GetR16(pixels, x, y, 1, 0))) << caseIndex << " at " << x << "," << y;
+            }
+        }
+    }
+
+    // Never below -1.0
+    std::vector<uint8_t> pixels = DecodeBlock(LoadEACSignedR11ToR16, MakeBlocks(MakeEACBlock(0x80, 15, 0)), 2);
+    EXPECT_EQ(-32767, static_cast<int16_t>(GetR16(pixels, 3, 0, 1, 0)));
+    EXPECT_EQ(32767, static_cast<int16_t>(GetR16(DecodeBlock(LoadEACSignedR11ToR16, MakeBlocks(MakeEACBlock(0x7F, 15, 0)), 2), 3, 1, 1, 0)));
+}
+
+TEST(ETCDecodeTest, EACRG11)
+{
+    // Red comes first
+    BlockBuilder red = MakeEACBlock(30, 4, 5);
+    BlockBuilder green = MakeEACBlock(200, 7, 11);
+
+    std::vector<uint8_t> unsignedPixels = DecodeBlock(LoadEACRG11ToRG16, MakeBlocks(red, green), 4);
+    std::vector<uint8_t> signedPixels = DecodeBlock(LoadEACSignedRG11ToRG16, MakeBlocks(red, green), 4);
+    for (size_t y = 0; y < 4; y++)
+    {
+        for (size_t x = 0; x < 4; x++)
+        {
+            size_t index = (x + 4 * y) % 8;
+            EXPECT_EQ(ExpectedR11(30, 4, kEACModifiers[5][index]), GetR16(unsignedPixels, x, y, 2, 0));
+            EXPECT_EQ(ExpectedR11(200, 7, kEACModifiers[11][index]), GetR16(unsignedPixels, x, y, 2, 1));
+            EXPECT_EQ(ExpectedSignedR11(30, 4, kEACModifiers[5][index]), static_cast<int16_t>(GetR16(signedPixels, x, y, 2, 0)));
+            EXPECT_EQ(ExpectedSignedR11(200 - 256, 7, kEACModifiers[11][index]), static_cast<int16_t>(GetR16(signedPixels, x, y, 2, 1)));
+        }
+    }
+}
+
+struct ETCFormat
+{
+    const char *name;
+    LoadImageFunction loadFunction;
+    size_t blockBytes;
+    size_t pixelBytes;
+};
+
+const ETCFormat kETCFormats[] =
+{
+    { "RGB8",          LoadETC2RGB8ToRGBA8,     8,  4 },
+    { "RGB8A1",        LoadETC2RGB8A1ToRGBA8,   8,  4 },
+    { "RGBA8",         LoadETC2RGBA8ToRGBA8,    16, 4 },
+    { "R11",           LoadEACR11ToR16,         8,  2 },
+    { "SignedR11",     LoadEACSignedR11ToR16,   8,  2 },
+    { "RG11",          LoadEACRG11ToRG16,       16, 4 },
+    { "SignedRG11",    LoadEACSignedRG11ToRG16, 16, 4 },
+};
+
+std::vector<uint8_t> MakeRandomBlocks(size_t size, uint32_t seed)
+{
+    std::vector<uint8_t> blocks(size);
+    for (size_t i = 0; i < blocks.size(); i++)
+    {
+        seed = seed * 1664525 + 1013904223;
+        blocks[i] = static_cast<uint8_t>(seed >> 24);
+    }
+    return blocks;
+}
+
+// Images that aren't a multiple of the block size keep the pixels inside
+// the image, and write nothing outside.
+TEST(ETCDecodeTest, PartialBlocks)
+{
+    const size_t sizes[][2] = { { 1, 1 }, { 2, 3 }, { 6, 5 }, { 13, 4 }, { 4, 7 }, { 70, 9 } };
+
+    for (size_t formatIndex = 0; formatIndex < ArraySize(kETCFormats); formatIndex++)
+    {
+        const ETCFormat &format = kETCFormats[formatIndex];
+        for (size_t sizeIndex = 0; sizeIndex < ArraySize(sizes); sizeIndex++)
+        {
+            const size_t width = sizes[sizeIndex][0];
+            const size_t height = sizes[sizeIndex][1];
+            const size_t columns = (width + 3) / 4;
+            const size_t rows = (height + 3) / 4;
+            const size_t inputRowPitch = columns * format.blockBytes;
+            const std::vector<uint8_t> input = MakeRandomBlocks(inputRowPitch * rows, static_cast<uint32_t>(sizeIndex));
+
+            // Whole blocks
+            const size_t fullRowPitch = columns * 4 * format.pixelBytes;
+            std::vector<uint8_t> full(fullRowPitch * rows * 4);
+            format.loadFunction(columns * 4, rows * 4, 1, &input[0], inputRowPitch, input.size(),
+                                &full[0], fullRowPitch, full.size());
+
+            // Clipped, with padding after each row
+            const size_t rowBytes = width * format.pixelBytes;
+            const size_t outputRowPitch = rowBytes + 5;
+            std::vector<uint8_t> output(outputRowPitch * height + 7, 0xCD);
+            format.loadFunction(width, height, 1, &input[0], inputRowPitch, input.size(),
+                                &output[0], outputRowPitch, outputRowPitch * height);
+
+            for (size_t y = 0; y < height; y++)
+            {
+                const uint8_t *row = &output[y * outputRowPitch];
+                EXPECT_TRUE(std::equal(row, row + rowBytes, &full[y * fullRowPitch]))
+                    << format.name << " " << width << "x" << height << " row " << y;
+                for (size_t i = rowBytes; i < outputRowPitch; i++)
+                {
+                    EXPECT_EQ(0xCD, row[i]) << format.name << " " << width << "x" << height << " row " << y;
+                }
+            }
+            EXPECT_EQ(0xCD, output.back());
+        }
+    }
+}
+
+TEST(ETCDecodeTest, SlicesUseDepthPitch)
+{
+    const size_t size = 8;
+    for (size_t formatIndex = 0; formatIndex < ArraySize(kETCFormats); formatIndex++)
+    {
+        const ETCFormat &format = kETCFormats[formatIndex];
+        const size_t inputRowPitch = 2 * format.blockBytes;
+        const size_t inputDepthPitch = 2 * inputRowPitch + 3;
+        const size_t outputRowPitch = size * format.pixelBytes;
+        const size_t outputDepthPitch = size * outputRowPitch;
+        const std::vector<uint8_t> input = MakeRandomBlocks(inputDepthPitch * 2, 99);
+
+        std::vector<uint8_t> slices(outputDepthPitch * 2);
+        format.loadFunction(size, size, 2, &input[0], inputRowPitch, inputDepthPitch,
+                            &slices[0], outputRowPitch, outputDepthPitch);
+
+        std::vector<uint8_t> secondSlice(outputDepthPitch);
+        format.loadFunction(size, size, 1, &input[inputDepthPitch], inputRowPitch, inputDepthPitch,
+                            &secondSlice[0], outputRowPitch, outputDepthPitch);
+
+        EXPECT_TRUE(std::equal(secondSlice.begin(), secondSlice.end(), slices.begin() + outputDepthPitch)) << format.name;
+    }
+}
+
+class ETCExpandTest : public SIMDLevelTest
+{
+};
+
+// Every vectorized expansion produces the same bytes as the scalar one.
+TEST_P(ETCExpandTest, MatchesScalar)
+{
+    if (!isSupported())
+    {
+        return;
+    }
+
+    const ETCExpandFunctions *functions = GetETCExpandFunctions(level());
+    if (!functions)
+    {
+        return;
+    }
+    const ETCExpandFunctions *scalar = GetETCExpandFunctions(gl::SIMD_SCALAR);
+
+    std::vector<ETCDecodedBlock> blocks(9);
+    uint32_t seed = 7;
+    for (size_t i = 0; i < blocks.size(); i++)
+    {
+        for (size_t plane = 0; plane < 4; plane++)
+        {
+            for (size_t entry = 0; entry < 16; entry++)
+            {
+                seed = seed * 1664525 + 1013904223;
+                blocks[i].palettes[plane][entry] = static_cast<uint8_t>(seed >> 24);
+                blocks[i].indices[plane][entry] = static_cast<uint8_t>((seed >> 8) & 0xF);
+            }
+        }
+    }
+
+    for (size_t count = 1; count <= blocks.size(); count++)
+    {
+        for (size_t pixelBytes = 2; pixelBytes <= 4; pixelBytes += 2)
+        {
+            const size_t rowPitch = count * 4 * pixelBytes + 3;
+            std::vector<uint8_t> expected(rowPitch * 4, 0xCD);
+            std::vector<uint8_t> actual(rowPitch * 4, 0xCD);
+
+            if (pixelBytes == 2)
+            {
+                scalar->expand2(count, &blocks[0], &expected[0], rowPitch);
+                functions->expand2(count, &blocks[0], &actual[0], rowPitch);
+            }
+            else
+            {
+                scalar->expand4(count, &blocks[0], &expected[0], rowPitch);
+                functions->expand4(count, &blocks[0], &actual[0], rowPitch);
+            }
+
+            EXPECT_EQ(expected, actual) << count << " blocks of " << pixelBytes << "-byte pixels";
+        }
+    }
+}
+
+ANGLE_INSTANTIATE_SIMD_LEVEL_TEST(ETCExpandTest, gl::SIMD_SSE2);
+
+}
@@ -0,0 +1,268 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "common/cpufeatures.h"
+#include "common/float16.h"
+#include "common/mathutil.h"
+
+#include <vector>
+
+namespace
+{
+
+uint32_t FloatBits(float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+float BitsFloat(uint32_t bits)
+{
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+bool IsFloat16NaN(uint16_t value)
+{
+    return (value & 0x7C00) == 0x7C00 && (value & 0x3FF) != 0;
+}
+
+std::vector<uint16_t> AllFloat16Values()
+{
+    std::vector<uint16_t> values(65536);
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        values[i] = static_cast<uint16_t>(i);
+    }
+    return values;
+}
+
+typedef void (*ConvertFloat32ToFloat16Function)(const float *, uint16_t *, size_t);
+typedef void (*ConvertFloat16ToFloat32Function)(const uint16_t *, float *, size_t);
+
+struct Float16Converters
+{
+    const char *name;
+    ConvertFloat32ToFloat16Function toFloat16;
+    ConvertFloat16ToFloat32Function toFloat32;
+};
+
+std::ostream &operator<<(std::ostream &stream, const Float16Converters &converters)
+{
+    return stream << converters.name;
+}
+
+class Float16ConversionTest : public testing::TestWithParam<Float16Converters>
+{
+  protected:
+    virtual void SetUp()
+    {
+        mSupported = (GetParam().toFloat16 != gl::ConvertFloat32ToFloat16F16C || gl::GetCPUFeatures().f16c);
+    }
+
+    bool mSupported;
+};
+
+// Every half float converts to a float and back to itself. NaNs come back
+// quieted.
+TEST_P(Float16ConversionTest, RoundTripsAllValues)
+{
+    if (!mSupported)
+    {
+        return;
+    }
+
+    std::vector<uint16_t> halfs = AllFloat16Values();
+    std::vector<float> floats(halfs.size());
+    std::vector<uint16_t> result(halfs.size());
+
+    GetParam().toFloat32(&halfs[0], &floats[0], halfs.size());
+    GetParam().toFloat16(&floats[0], &result[0], floats.size());
+
+    for (size_t i = 0; i < halfs.size(); i++)
+    {
+        if (IsFloat16NaN(halfs[i]))
+        {
+            ASSERT_EQ(halfs[i] | 0x200, result[i]) << std::hex << halfs[i];
+        }
+        else
+        {
+            ASSERT_EQ(halfs[i], result[i]) << std::hex << halfs[i];
+        }
+    }
+}
+
+// Matches the table lookups of gl::float16ToFloat32, apart from the NaN
+// quieting.
+TEST_P(Float16ConversionTest, MatchesTableToFloat32)
+{
+    if (!mSupported)
+    {
+        return;
+    }
+
+    std::vector<uint16_t> halfs = AllFloat16Values();
+    std::vector<float> floats(halfs.size());
+    GetParam().toFloat32(&halfs[0], &floats[0], halfs.size());
+
+    for (size_t i = 0; i < halfs.size(); i++)
+    {
+        uint32_t expected = FloatBits(gl::float16ToFloat32(halfs[i]));
+        if (IsFloat16NaN(halfs[i]))
+        {
+            expected |= 0x00400000;
+        }
+        ASSERT_EQ(expected, FloatBits(floats[i])) << std::hex << halfs[i];
+    }
+}
+
+// Floats between two half floats round to the nearest, and to the even one
+// on ties.
+TEST_P(Float16ConversionTest, RoundsToNearestEven)
+{
+    if (!mSupported)
+    {
+        return;
+    }
+
+    std::vector<uint16_t> halfs = AllFloat16Values();
+    std::vector<float> floats(halfs.size());
+    gl::ConvertFloat16ToFloat32Portable(&halfs[0], &floats[0], halfs.size());
+
+    // Between each finite positive half float and the next one
+    std::vector<float> between;
+    std::vector<uint16_t> expected;
+    for (uint16_t value = 0; value < 0x7C00; value++)
+    {
+        float next = (value == 0x7BFF) ? 65536.0f : floats[value + 1];
+        uint32_t low = FloatBits(floats[value]);
+        uint32_t high = FloatBits(next);
+        // Exact, the floats have more mantissa bits
+        uint32_t middle = FloatBits((floats[value] + next) * 0.5f);
+        uint16_t even = (value & 1) ? value + 1 : value;
+
+        between.push_back(BitsFloat(low + 1));    expected.push_back(value);
+        between.push_back(BitsFloat(middle - 1)); expected.push_back(value);
+        between.push_back(BitsFloat(middle));     expected.push_back(even);
+        between.push_back(BitsFloat(middle + 1)); expected.push_back(value + 1);
+        between.push_back(BitsFloat(high - 1));   expected.push_back(value + 1);
+    }
+
+    std::vector<uint16_t> result(between.size());
+    GetParam().toFloat16(&between[0], &result[0], between.size());
+    for (size_t i = 0; i < between.size(); i++)
+    {
+        ASSERT_EQ(expected[i], result[i]) << between[i];
+    }
+}
+
+TEST_P(Float16ConversionTest, SpecialValues)
+{
+    if (!mSupported)
+    {
+        return;
+    }
+
+    const float infinity = std::numeric_limits<float>::infinity();
+    const float floats[] =
+    {
+        0.0f, -0.0f, 1.0f, -2.0f, 65504.0f, 65520.0f, 1.0e10f, -1.0e10f, infinity, -infinity,
+        BitsFloat(0x7FC00000), BitsFloat(0x7F800001), BitsFloat(0xFFFFFFFF), 1.0e-10f, -1.0e-10f,
+    };
+    const uint16_t expected[] =
+    {
+        0x0000, 0x8000, 0x3C00, 0xC000, 0x7BFF, 0x7C00, 0x7C00, 0xFC00, 0x7C00, 0xFC00,
+        0x7E00, 0x7E00, 0xFFFF, 0x0000, 0x8000,
+    };
+    const size_t count = sizeof(floats) / sizeof(floats[0]);
+
+    uint16_t result[count];
+    GetParam().toFloat16(floats, result, count);
+    for (size_t i = 0; i < count; i++)
+    {
+        EXPECT_EQ(expected[i], result[i]) << floats[i];
+    }
+}
+
+// The vectorized versions handle any count and alignment.
+TEST_P(Float16ConversionTest, OddCountsAndOffsets)
+{
+    if (!mSupported)
+    {
+        return;
+    }
+
+    std::vector<float> floats(64);
+    for (size_t i = 0; i < floats.size(); i++)
+    {
+        floats[i] = static_cast<float>(i) * 0.37f - 5.0f;
+    }
+
+    for (size_t offset = 0; offset < 4; offset++)
+    {
+        for (size_t count = 0; count + offset < floats.size(); count++)
+        {
+            std::vector<uint16_t> expected(count + 2, 0xCDCD);
+            std::vector<uint16_t> actual(count + 2, 0xCDCD);
+            gl::ConvertFloat32ToFloat16Portable(&floats[offset], &expected[1], count);
+            GetParam().toFloat16(&floats[offset], &actual[1], count);
+            ASSERT_EQ(expected, actual) << count << " " << offset;
+
+            std::vector<float> expectedFloats(count + 2, -1.0f);
+            std::vector<float> actualFloats(count + 2, -1.0f);
+            gl::ConvertFloat16ToFloat32Portable(&expected[1], &expectedFloats[1], count);
+            GetParam().toFloat32(&expected[1], &actualFloats[1], count);
+            ASSERT_EQ(expectedFloats, actualFloats) << count << " " << offset;
+        }
+    }
+}
+
+const Float16Converters kConverters[] =
+{
+    { "Default", gl::ConvertFloat32ToFloat16, gl::ConvertFloat16ToFloat32 },
+    { "Portable", gl::ConvertFloat32ToFloat16Portable, gl::ConvertFloat16ToFloat32Portable },
+    { "F16C", gl::ConvertFloat32ToFloat16F16C, gl::ConvertFloat16ToFloat32F16C },
+};
+
+INSTANTIATE_TEST_CASE_P(AllVersions, Float16ConversionTest, testing::ValuesIn(kConverters));
+
+// The portable version gives the same bits as the F16C instructions for
+// every float with one of these exponents.
+TEST(Float16ConversionF16CTest, PortableMatchesF16C)
+{
+    if (!gl::GetCPUFeatures().f16c)
+    {
+        return;
+    }
+
+    std::vector<float> floats;
+    for (uint32_t exponent = 100; exponent <= 144; exponent++)
+    {
+        for (uint32_t mantissa = 0; mantissa < (1 << 23); mantissa += 97)
+        {
+            floats.push_back(BitsFloat((exponent << 23) | mantissa));
+            floats.push_back(BitsFloat(0x80000000 | (exponent << 23) | mantissa));
+        }
+    }
+    floats.push_back(BitsFloat(0x7F800000));
+    floats.push_back(BitsFloat(0x7FA12345));
+    floats.push_back(BitsFloat(0xFFC00001));
+
+    std::vector<uint16_t> expected(floats.size());
+    std::vector<uint16_t> actual(floats.size());
+    gl::ConvertFloat32ToFloat16F16C(&floats[0], &expected[0], floats.size());
+    gl::ConvertFloat32ToFloat16Portable(&floats[0], &actual[0], floats.size());
+    for (size_t i = 0; i < floats.size(); i++)
+    {
+        ASSERT_EQ(expected[i], actual[i]) << std::hex << FloatBits(floats[i]);
+    }
+}
+
+}
@@ -0,0 +1,360 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "gtest/gtest.h"
+#include "libGLESv2/formatutils.h"
+
+#include <set>
+
+namespace
+{
+
+// The answers the format queries gave when they were backed by std::maps, for every enum
+// those maps held. Every other enum must get the default answer.
+
+// Enums below this cover every format and type, so checking them all is exhaustive
+const GLenum MaxCheckedEnum = 0x10000;
+
+struct ExpectedType
+{
+    GLenum type;
+    GLuint bytes;
+    bool specialInterpretation;
+};
+
+const ExpectedType ExpectedTypes[] =
+{
+    { GL_BYTE,                           1, false },
+    { GL_UNSIGNED_BYTE,                  1, false },
+    { GL_SHORT,                          2, false },
+    { GL_UNSIGNED_SHORT,                 2, false },
+    { GL_INT,                            4, false },
+    { GL_UNSIGNED_INT,                   4, false },
+    { GL_FLOAT,                          4, false },
+    { GL_HALF_FLOAT,                     2, false },
+    { GL_UNSIGNED_SHORT_4_4_4_4,         2, true },
+    { GL_UNSIGNED_SHORT_5_5_5_1,         2, true },
+    { GL_UNSIGNED_SHORT_5_6_5,           2, true },
+    { GL_UNSIGNED_SHORT_4_4_4_4_REV_EXT, 2, true },
+    { GL_UNSIGNED_SHORT_1_5_5_5_REV_EXT, 2, true },
+    { GL_UNSIGNED_INT_2_10_10_10_REV,    4, true },
+    { GL_UNSIGNED_INT_24_8,              4, true },
+    { GL_UNSIGNED_INT_10F_11F_11F_REV,   4, true },
+    { GL_UNSIGNED_INT_5_9_9_9_REV,       4, true },
+    { GL_HALF_FLOAT_OES,                 2, false },
+    { GL_FLOAT_32_UNSIGNED_INT_24_8_REV, 8, true },
+};
+
+struct ExpectedInternalFormat
+{
+    GLenum internalFormat;
+    GLenum format;
+    GLenum type;
+    GLuint pixelBytes;
+    GLuint componentCount;
+    bool compressed;
+};
+
+const ExpectedInternalFormat ExpectedInternalFormats[] =
+{
+    { GL_NONE,                                      GL_NONE,                                      GL_NONE,                           0,  0, false },
+    { GL_DEPTH_COMPONENT,                           GL_DEPTH_COMPONENT,                           GL_NONE,                           0,  0, false },
+    { GL_RED,                                       GL_RED,                                       GL_NONE,                           0,  0, false },
+    { GL_ALPHA,                                     GL_ALPHA,                                     GL_NONE,                           0,  0, false },
+    { GL_RGB,                                       GL_RGB,                                       GL_NONE,                           0,  0, false },
+    { GL_RGBA,                                      GL_RGBA,                                      GL_NONE,                           0,  0, false },
+    { GL_LUMINANCE,                                 GL_LUMINANCE,                                 GL_NONE,                           0,  0, false },
+    { GL_LUMINANCE_ALPHA,                           GL_LUMINANCE_ALPHA,                           GL_NONE,                           0,  0, false },
+    { GL_BGRA4_ANGLEX,                              GL_BGRA_EXT,                                  GL_UNSIGNED_SHORT_4_4_4_4_REV_EXT, 2,  4, false },
+    { GL_BGR5_A1_ANGLEX,                            GL_BGRA_EXT,                                  GL_UNSIGNED_SHORT_1_5_5_5_REV_EXT, 2,  4, false },
+    { GL_ALPHA8_EXT,                                GL_ALPHA,                                     GL_UNSIGNED_BYTE,                  1,  1, false },
+    { GL_LUMINANCE8_EXT,                            GL_LUMINANCE,                                 GL_UNSIGNED_BYTE,                  1,  1, false },
+    { GL_LUMINANCE8_ALPHA8_EXT,                     GL_LUMINANCE_ALPHA,                           GL_UNSIGNED_BYTE,                  2,  2, false },
+    { GL_RGB8,                                      GL_RGB,                                       GL_UNSIGNED_BYTE,                  3,  3, false },
+    { GL_RGBA4,                                     GL_RGBA,                                      GL_UNSIGNED_SHORT_4_4_4_4,         2,  4, false },
+    { GL_RGB5_A1,                                   GL_RGBA,                                      GL_UNSIGNED_SHORT_5_5_5_1,         2,  4, false },
+    { GL_RGBA8,                                     GL_RGBA,                                      GL_UNSIGNED_BYTE,                  4,  4, false },
+    { GL_RGB10_A2,                                  GL_RGBA,                                      GL_UNSIGNED_INT_2_10_10_10_REV,    4,  4, false },
+    { GL_BGRA_EXT,                                  GL_BGRA_EXT,                                  GL_NONE,                           0,  0, false },
+    { GL_DEPTH_COMPONENT16,                         GL_DEPTH_COMPONENT,                           GL_UNSIGNED_SHORT,                 2,  1, false },
+    { GL_DEPTH_COMPONENT24,                         GL_DEPTH_COMPONENT,                           GL_UNSIGNED_INT,                   3,  1, false },
+    { GL_DEPTH_COMPONENT32_OES,                     GL_DEPTH_COMPONENT,                           GL_UNSIGNED_INT,                   4,  1, false },
+    { GL_RG,                                        GL_RG,                                        GL_NONE,                           0,  0, false },
+    { GL_RG_INTEGER,                                GL_RG_INTEGER,                                GL_NONE,                           0,  0, false },
+    { GL_R8,                                        GL_RED,                                       GL_UNSIGNED_BYTE,                  1,  1, false },
+    { GL_RG8,                                       GL_RG,                                        GL_UNSIGNED_BYTE,                  2,  2, false },
+    { GL_R16F,                                      GL_RED,                                       GL_HALF_FLOAT,                     2,  1, false },
+    { GL_R32F,                                      GL_RED,                                       GL_FLOAT,                          4,  1, false },
+    { GL_RG16F,                                     GL_RG,                                        GL_HALF_FLOAT,                     4,  2, false },
+    { GL_RG32F,                                     GL_RG,                                        GL_FLOAT,                          8,  2, false },
+    { GL_R8I,                                       GL_RED_INTEGER,                               GL_BYTE,                           1,  1, false },
+    { GL_R8UI,                                      GL_RED_INTEGER,                               GL_UNSIGNED_BYTE,                  1,  1, false },
+    { GL_R16I,                                      GL_RED_INTEGER,                               GL_SHORT,                          2,  1, false },
+    { GL_R16UI,                                     GL_RED_INTEGER,                               GL_UNSIGNED_SHORT,                 2,  1, false },
+    { GL_R32I,                                      GL_RED_INTEGER,                               GL_INT,                            4,  1, false },
+    { GL_R32UI,                                     GL_RED_INTEGER,                               GL_UNSIGNED_INT,                   4,  1, false },
+    { GL_RG8I,                                      GL_RG_INTEGER,                                GL_BYTE,                           2,  2, false },
+    { GL_RG8UI,                                     GL_RG_INTEGER,                                GL_UNSIGNED_BYTE,                  2,  2, false },
+    { GL_RG16I,                                     GL_RG_INTEGER,                                GL_SHORT,                          4,  2, false },
+    { GL_RG16UI,                                    GL_RG_INTEGER,                                GL_UNSIGNED_SHORT,                 4,  2, false },
+    { GL_RG32I,                                     GL_RG_INTEGER,                                GL_INT,                            8,  2, false },
+    { GL_RG32UI,                                    GL_RG_INTEGER,                                GL_UNSIGNED_INT,                   8,  2, false },
+    { GL_COMPRESSED_RGB_S3TC_DXT1_EXT,              GL_COMPRESSED_RGB_S3TC_DXT1_EXT,              GL_UNSIGNED_BYTE,                  8,  3, true },
+    { GL_COMPRESSED_RGBA_S3TC_DXT1_EXT,             GL_COMPRESSED_RGBA_S3TC_DXT1_EXT,             GL_UNSIGNED_BYTE,                  8,  4, true },
+    { GL_COMPRESSED_RGBA_S3TC_DXT3_ANGLE,           GL_COMPRESSED_RGBA_S3TC_DXT3_ANGLE,           GL_UNSIGNED_BYTE,                  16, 4, true },
+    { GL_COMPRESSED_RGBA_S3TC_DXT5_ANGLE,           GL_COMPRESSED_RGBA_S3TC_DXT5_ANGLE,           GL_UNSIGNED_BYTE,                  16, 4, true },
+    { GL_DEPTH_STENCIL,                             GL_DEPTH_STENCIL,                             GL_NONE,                           0,  0, false },
+    { GL_RGBA32F,                                   GL_RGBA,                                      GL_FLOAT,                          16, 4, false },
+    { GL_RGB32F,                                    GL_RGB,                                       GL_FLOAT,                          12, 3, false },
+    { GL_ALPHA32F_EXT,                              GL_ALPHA,                                     GL_FLOAT,                          4,  1, false },
+    { GL_LUMINANCE32F_EXT,                          GL_LUMINANCE,                                 GL_FLOAT,                          4,  1, false },
+    { GL_LUMINANCE_ALPHA32F_EXT,                    GL_LUMINANCE_ALPHA,                           GL_FLOAT,                          8,  2, false },
+    { GL_RGBA16F,                                   GL_RGBA,                                      GL_HALF_FLOAT,                     8,  4, false },
+    { GL_RGB16F,                                    GL_RGB,                                       GL_HALF_FLOAT,                     6,  3, false },
+    { GL_ALPHA16F_EXT,                              GL_ALPHA,                                     GL_HALF_FLOAT,                     2,  1, false },
+    { GL_LUMINANCE16F_EXT,                          GL_LUMINANCE,                                 GL_HALF_FLOAT,                     2,  1, false },
+    { GL_LUMINANCE_ALPHA16F_EXT,                    GL_LUMINANCE_ALPHA,                           GL_HALF_FLOAT,                     4,  2, false },
+    { GL_DEPTH24_STENCIL8,                          GL_DEPTH_STENCIL,                             GL_UNSIGNED_INT_24_8,              4,  2, false },
+    { GL_R11F_G11F_B10F,                            GL_RGB,                                       GL_UNSIGNED_INT_10F_11F_11F_REV,   4,  3, false },
+    { GL_RGB9_E5,                                   GL_RGB,                                       GL_UNSIGNED_INT_5_9_9_9_REV,       4,  3, false },
+    { GL_SRGB,                                      GL_RGB,                                       GL_NONE,                           0,  0, false },
+    { GL_SRGB8,                                     GL_RGB,                                       GL_UNSIGNED_BYTE,                  3,  3, false },
+    { GL_SRGB_ALPHA_EXT,                            GL_RGBA,                                      GL_NONE,                           0,  0, false },
+    { GL_SRGB8_ALPHA8,                              GL_RGBA,                                      GL_UNSIGNED_BYTE,                  4,  4, false },
+    { GL_DEPTH_COMPONENT32F,                        GL_DEPTH_COMPONENT,                           GL_FLOAT,                          4,  1, false },
+    { GL_DEPTH32F_STENCIL8,                         GL_DEPTH_STENCIL,                             GL_FLOAT_32_UNSIGNED_INT_24_8_REV, 8,  2, false },
+    { GL_STENCIL_INDEX8,                            GL_DEPTH_STENCIL,                             GL_UNSIGNED_BYTE,                  1,  1, false },
+    { GL_RGB565,                                    GL_RGB,                                       GL_UNSIGNED_SHORT_5_6_5,           2,  3, false },
+    { GL_RGBA32UI,                                  GL_RGBA_INTEGER,                              GL_UNSIGNED_INT,                   16, 4, false },
+    { GL_RGB32UI,                                   GL_RGB_INTEGER,                               GL_UNSIGNED_INT,                   12, 3, false },
+    { GL_RGBA16UI,                                  GL_RGBA_INTEGER,                              GL_UNSIGNED_SHORT,                 8,  4, false },
+    { GL_RGB16UI,                                   GL_RGB_INTEGER,                               GL_UNSIGNED_SHORT,                 6,  3, false },
+    { GL_RGBA8UI,                                   GL_RGBA_INTEGER,                              GL_UNSIGNED_BYTE,                  4,  4, false },
+    { GL_RGB8UI,                                    GL_RGB_INTEGER,                               GL_UNSIGNED_BYTE,                  3,  3, false },
+    { GL_RGBA32I,                                   GL_RGBA_INTEGER,                              GL_INT,                            16, 4, false },
+    { GL_RGB32I,                                    GL_RGB_INTEGER,                               GL_INT,                            12, 3, false },
+    { GL_RGBA16I,                                   GL_RGBA_INTEGER,                              GL_SHORT,                          8,  4, false },
+    { GL_RGB16I,                                    GL_RGB_INTEGER,                               GL_SHORT,                          6,  3, false },
+    { GL_RGBA8I,                                    GL_RGBA_INTEGER,                              GL_BYTE,                           4,  4, false },
+    { GL_RGB8I,                                     GL_RGB_INTEGER,                               GL_BYTE,                           3,  3, false },
+    { GL_RED_INTEGER,                               GL_RED_INTEGER,                               GL_NONE,                           0,  0, false },
+    { GL_RGB_INTEGER,                               GL_RGB_INTEGER,                               GL_NONE,                           0,  0, false },
+    { GL_RGBA_INTEGER,                              GL_RGBA_INTEGER,                              GL_NONE,                           0,  0, false },
+    { GL_R8_SNORM,                                  GL_RED,                                       GL_BYTE,                           1,  1, false },
+    { GL_RG8_SNORM,                                 GL_RG,                                        GL_BYTE,                           2,  2, false },
+    { GL_RGB8_SNORM,                                GL_RGB,                                       GL_BYTE,                           3,  3, false },
+    { GL_RGBA8_SNORM,                               GL_RGBA,                                      GL_BYTE,                           4,  4, false },
+    { GL_RGB10_A2UI,                                GL_RGBA_INTEGER,                              GL_UNSIGNED_INT_2_10_10_10_REV,    4,  4, false },
+    { GL_COMPRESSED_R11_EAC,                        GL_COMPRESSED_R11_EAC,                        GL_UNSIGNED_BYTE,                  8,  1, true },
+    { GL_COMPRESSED_SIGNED_R11_EAC,                 GL_COMPRESSED_SIGNED_R11_EAC,                 GL_UNSIGNED_BYTE,                  8,  1, true },
+    { GL_COMPRESSED_RG11_EAC,                       GL_COMPRESSED_RG11_EAC,                       GL_UNSIGNED_BYTE,                  16, 2, true },
+    { GL_COMPRESSED_SIGNED_RG11_EAC,                GL_COMPRESSED_SIGNED_RG11_EAC,                GL_UNSIGNED_BYTE,                  16, 2, true },
+    { GL_COMPRESSED_RGB8_ETC2,                      GL_COMPRESSED_RGB8_ETC2,                      GL_UNSIGNED_BYTE,                  8,  3, true },
+    { GL_COMPRESSED_SRGB8_ETC2,                     GL_COMPRESSED_SRGB8_ETC2,                     GL_UNSIGNED_BYTE,                  8,  3, true },
+    { GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2,  GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2,  GL_UNSIGNED_BYTE,                  8,  3, true },
+    { GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2, GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2, GL_UNSIGNED_BYTE,                  8,  3, true },
+    { GL_COMPRESSED_RGBA8_ETC2_EAC,                 GL_COMPRESSED_RGBA8_ETC2_EAC,                 GL_UNSIGNED_BYTE,                  16, 4, true },
+    { GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC,          GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC,          GL_UNSIGNED_BYTE,                  16, 4, true },
+    { GL_BGRA8_EXT,                                 GL_BGRA_EXT,                                  GL_UNSIGNED_BYTE,                  4,  4, false },
+};
+
+struct ExpectedFormatType
+{
+    GLenum format;
+    GLenum type;
+    GLenum internalFormat;
+};
+
+const ExpectedFormatType ExpectedFormatTypes[] =
+{
+    { GL_DEPTH_COMPONENT,                 GL_UNSIGNED_SHORT,                 GL_DEPTH_COMPONENT16 },
+    { GL_DEPTH_COMPONENT,                 GL_UNSIGNED_INT,                   GL_DEPTH_COMPONENT32_OES },
+    { GL_DEPTH_COMPONENT,                 GL_FLOAT,                          GL_DEPTH_COMPONENT32F },
+    { GL_RED,                             GL_BYTE,                           GL_R8_SNORM },
+    { GL_RED,                             GL_UNSIGNED_BYTE,                  GL_R8 },
+    { GL_RED,                             GL_FLOAT,                          GL_R32F },
+    { GL_RED,                             GL_HALF_FLOAT,                     GL_R16F },
+    { GL_RED,                             GL_HALF_FLOAT_OES,                 GL_R16F },
+    { GL_ALPHA,                           GL_UNSIGNED_BYTE,                  GL_ALPHA8_EXT },
+    { GL_ALPHA,                           GL_FLOAT,                          GL_ALPHA32F_EXT },
+    { GL_ALPHA,                           GL_HALF_FLOAT,                     GL_ALPHA16F_EXT },
+    { GL_ALPHA,                           GL_HALF_FLOAT_OES,                 GL_ALPHA16F_EXT },
+    { GL_RGB,                             GL_BYTE,                           GL_RGB8_SNORM },
+    { GL_RGB,                             GL_UNSIGNED_BYTE,                  GL_RGB8 },
+    { GL_RGB,                             GL_FLOAT,                          GL_RGB32F },
+    { GL_RGB,                             GL_HALF_FLOAT,                     GL_RGB16F },
+    { GL_RGB,                             GL_UNSIGNED_SHORT_5_6_5,           GL_RGB565 },
+    { GL_RGB,                             GL_UNSIGNED_INT_10F_11F_11F_REV,   GL_R11F_G11F_B10F },
+    { GL_RGB,                             GL_UNSIGNED_INT_5_9_9_9_REV,       GL_RGB9_E5 },
+    { GL_RGB,                             GL_HALF_FLOAT_OES,                 GL_RGB16F },
+    { GL_RGBA,                            GL_BYTE,                           GL_RGBA8_SNORM },
+    { GL_RGBA,                            GL_UNSIGNED_BYTE,                  GL_RGBA8 },
+    { GL_RGBA,                            GL_FLOAT,                          GL_RGBA32F },
+    { GL_RGBA,                            GL_HALF_FLOAT,                     GL_RGBA16F },
+    { GL_RGBA,                            GL_UNSIGNED_SHORT_4_4_4_4,         GL_RGBA4 },
+    { GL_RGBA,                            GL_UNSIGNED_SHORT_5_5_5_1,         GL_RGB5_A1 },
+    { GL_RGBA,                            GL_UNSIGNED_INT_2_10_10_10_REV,    GL_RGB10_A2 },
+    { GL_RGBA,                            GL_HALF_FLOAT_OES,                 GL_RGBA16F },
+    { GL_LUMINANCE,                       GL_UNSIGNED_BYTE,                  GL_LUMINANCE8_EXT },
+    { GL_LUMINANCE,                       GL_FLOAT,                          GL_LUMINANCE32F_EXT },
+    { GL_LUMINANCE,                       GL_HALF_FLOAT,                     GL_LUMINANCE16F_EXT },
+    { GL_LUMINANCE,                       GL_HALF_FLOAT_OES,                 GL_LUMINANCE16F_EXT },
+    { GL_LUMINANCE_ALPHA,                 GL_UNSIGNED_BYTE,                  GL_LUMINANCE8_ALPHA8_EXT },
+    { GL_LUMINANCE_ALPHA,                 GL_FLOAT,                          GL_LUMINANCE_ALPHA32F_EXT },
+    { GL_LUMINANCE_ALPHA,                 GL_HALF_FLOAT,                     GL_LUMINANCE_ALPHA16F_EXT },
+    { GL_LUMINANCE_ALPHA,                 GL_HALF_FLOAT_OES,                 GL_LUMINANCE_ALPHA16F_EXT },
+    { GL_BGRA_EXT,                        GL_UNSIGNED_BYTE,                  GL_BGRA8_EXT },
+    { GL_BGRA_EXT,                        GL_UNSIGNED_SHORT_4_4_4_4_REV_EXT, GL_BGRA4_ANGLEX },
+    { GL_BGRA_EXT,                        GL_UNSIGNED_SHORT_1_5_5_5_REV_EXT, GL_BGR5_A1_ANGLEX },
+    { GL_RG,                              GL_BYTE,                           GL_RG8_SNORM },
+    { GL_RG,                              GL_UNSIGNED_BYTE,                  GL_RG8 },
+    { GL_RG,                              GL_FLOAT,                          GL_RG32F },
+    { GL_RG,                              GL_HALF_FLOAT,                     GL_RG16F },
+    { GL_RG,                              GL_HALF_FLOAT_OES,                 GL_RG16F },
+    { GL_RG_INTEGER,                      GL_BYTE,                           GL_RG8I },
+    { GL_RG_INTEGER,                      GL_UNSIGNED_BYTE,                  GL_RG8UI },
+    { GL_RG_INTEGER,                      GL_SHORT,                          GL_RG16I },
+    { GL_RG_INTEGER,                      GL_UNSIGNED_SHORT,                 GL_RG16UI },
+    { GL_RG_INTEGER,                      GL_INT,                            GL_RG32I },
+    { GL_RG_INTEGER,                      GL_UNSIGNED_INT,                   GL_RG32UI },
+    { GL_COMPRESSED_RGB_S3TC_DXT1_EXT,    GL_UNSIGNED_BYTE,                  GL_COMPRESSED_RGB_S3TC_DXT1_EXT },
+    { GL_COMPRESSED_RGBA_S3TC_DXT1_EXT,   GL_UNSIGNED_BYTE,                  GL_COMPRESSED_RGBA_S3TC_DXT1_EXT },
+    { GL_COMPRESSED_RGBA_S3TC_DXT3_ANGLE, GL_UNSIGNED_BYTE,                  GL_COMPRESSED_RGBA_S3TC_DXT3_ANGLE },
+    { GL_COMPRESSED_RGBA_S3TC_DXT5_ANGLE, GL_UNSIGNED_BYTE,                  GL_COMPRESSED_RGBA_S3TC_DXT5_ANGLE },
+    { GL_DEPTH_STENCIL,                   GL_UNSIGNED_INT_24_8,              GL_DEPTH24_STENCIL8 },
+    { GL_DEPTH_STENCIL,                   GL_FLOAT_32_UNSIGNED_INT_24_8_REV, GL_DEPTH32F_STENCIL8 },
+    { GL_SRGB,                            GL_UNSIGNED_BYTE,                  GL_SRGB8 },
+    { GL_SRGB_ALPHA_EXT,                  GL_UNSIGNED_BYTE,                  GL_SRGB8_ALPHA8 },
+    { GL_RED_INTEGER,                     GL_BYTE,                           GL_R8I },
+    { GL_RED_INTEGER,                     GL_UNSIGNED_BYTE,                  GL_R8UI },
+    { GL_RED_INTEGER,                     GL_SHORT,                          GL_R16I },
+    { GL_RED_INTEGER,                     GL_UNSIGNED_SHORT,                 GL_R16UI },
+    { GL_RED_INTEGER,                     GL_INT,                            GL_R32I },
+    { GL_RED_INTEGER,                     GL_UNSIGNED_INT,                   GL_R32UI },
+    { GL_RGB_INTEGER,                     GL_BYTE,                           GL_RGB8I },
+    { GL_RGB_INTEGER,                     GL_UNSIGNED_BYTE,                  GL_RGB8UI },
+    { GL_RGB_INTEGER,                     GL_SHORT,                          GL_RGB16I },
+    { GL_RGB_INTEGER,                     GL_UNSIGNED_SHORT,                 GL_RGB16UI },
+    { GL_RGB_INTEGER,                     GL_INT,                            GL_RGB32I },
+    { GL_RGB_INTEGER,                     GL_UNSIGNED_INT,                   GL_RGB32UI },
+    { GL_RGBA_INTEGER,                    GL_BYTE,                           GL_RGBA8I },
+    { GL_RGBA_INTEGER,                    GL_UNSIGNED_BYTE,                  GL_RGBA8UI },
+    { GL_RGBA_INTEGER,                    GL_SHORT,                          GL_RGBA16I },
+    { GL_RGBA_INTEGER,                    GL_UNSIGNED_SHORT,                 GL_RGBA16UI },
+    { GL_RGBA_INTEGER,                    GL_INT,                            GL_RGBA32I },
+    { GL_RGBA_INTEGER,                    GL_UNSIGNED_INT,                   GL_RGBA32UI },
+    { GL_RGBA_INTEGER,                    GL_UNSIGNED_INT_2_10_10_10_REV,    GL_RGB10_A2UI },
+};
+
+TEST(FormatUtilsTest, TypeInfo)
+{
+    std::set<GLenum> knownTypes;
+    for (size_t i = 0; i < ArraySize(ExpectedTypes); i++)
+    {
+        const ExpectedType &expected = ExpectedTypes[i];
+        const gl::Type &typeInfo = gl::GetTypeInfo(expected.type);
+        EXPECT_EQ(expected.bytes, typeInfo.bytes) << std::hex << expected.type;
+        EXPECT_EQ(expected.specialInterpretation, typeInfo.specialInterpretation) << std::hex << expected.type;
+        knownTypes.insert(expected.type);
+    }
+
+    for (GLenum type = 0; type < MaxCheckedEnum; type++)
+    {
+        if (knownTypes.count(type) == 0)
+        {
+            const gl::Type &typeInfo = gl::GetTypeInfo(type);
+            EXPECT_EQ(0u, typeInfo.bytes) << std::hex << type;
+            EXPECT_FALSE(typeInfo.specialInterpretation) << std::hex << type;
+        }
+    }
+}
+
+TEST(FormatUtilsTest, InternalFormatInfo)
+{
+    // Extensions only holds flags and limits, so this turns every extension on
+    gl::Extensions allExtensions;
+    memset(&allExtensions, 1, sizeof(allExtensions));
+
+    std::set<GLenum> knownFormats;
+    for (size_t i = 0; i < ArraySize(ExpectedInternalFormats); i++)
+    {
+        const ExpectedInternalFormat &expected = ExpectedInternalFormats[i];
+        const gl::InternalFormat &formatInfo = gl::GetInternalFormatInfo(expected.internalFormat);
+        EXPECT_EQ(expected.format, formatInfo.format) << std::hex << expected.internalFormat;
+        EXPECT_EQ(expected.type, formatInfo.type) << std::hex << expected.internalFormat;
+        EXPECT_EQ(expected.pixelBytes, formatInfo.pixelBytes) << std::hex << expected.internalFormat;
+        EXPECT_EQ(expected.componentCount, formatInfo.componentCount) << std::hex << expected.internalFormat;
+        EXPECT_EQ(expected.compressed, formatInfo.compressed) << std::hex << expected.internalFormat;
+
+        // Every format but GL_NONE can be a texture in some context
+        EXPECT_EQ(expected.internalFormat != GL_NONE, formatInfo.textureSupport(3, allExtensions)) << std::hex << expected.internalFormat;
+
+        knownFormats.insert(expected.internalFormat);
+    }
+
+    for (GLenum internalFormat = 0; internalFormat < MaxCheckedEnum; internalFormat++)
+    {
+        if (knownFormats.count(internalFormat) == 0)
+        {
+            const gl::InternalFormat &formatInfo = gl::GetInternalFormatInfo(internalFormat);
+            EXPECT_EQ(GLenum(GL_NONE), formatInfo.format) << std::hex << internalFormat;
+            EXPECT_EQ(0u, formatInfo.pixelBytes) << std::hex << internalFormat;
+            EXPECT_FALSE(formatInfo.textureSupport(3, allExtensions)) << std::hex << internalFormat;
+            EXPECT_FALSE(formatInfo.renderSupport(3, allExtensions)) << std::hex << internalFormat;
+            EXPECT_FALSE(formatInfo.filterSupport(3, allExtensions)) << std::hex << internalFormat;
+        }
+    }
+}
+
+TEST(FormatUtilsTest, AllSizedInternalFormats)
+{
+    std::set<GLenum> expectedFormats;
+    for (size_t i = 0; i < ArraySize(ExpectedInternalFormats); i++)
+    {
+        if (ExpectedInternalFormats[i].pixelBytes > 0)
+        {
+            expectedFormats.insert(ExpectedInternalFormats[i].internalFormat);
+        }
+    }
+
+    const gl::FormatSet &sizedFormats = gl::GetAllSizedInternalFormats();
+    EXPECT_EQ(expectedFormats.size(), sizedFormats.size());
+    EXPECT_TRUE(std::equal(expectedFormats.begin(), expectedFormats.end(), sizedFormats.begin()));
+}
+
+TEST(FormatUtilsTest, FormatTypeInfo)
+{
+    std::set<std::pair<GLenum, GLenum> > knownPairs;
+    std::set<GLenum> formats;
+    std::set<GLenum> types;
+    for (size_t i = 0; i < ArraySize(ExpectedFormatTypes); i++)
+    {
+        const ExpectedFormatType &expected = ExpectedFormatTypes[i];
+        const gl::FormatType &formatTypeInfo = gl::GetFormatTypeInfo(expected.format, expected.type);
+        EXPECT_EQ(expected.internalFormat, formatTypeInfo.internalFormat) << std::hex << expected.format << " " << expected.type;
+        EXPECT_EQ(expected.internalFormat, gl::GetSizedInternalFormat(expected.format, expected.type)) << std::hex << expected.format << " " << expected.type;
+
+        knownPairs.insert(std::make_pair(expected.format, expected.type));
+        formats.insert(expected.format);
+        types.insert(expected.type);
+    }
+
+    // Mixing the formats and types of different entries must not find anything
+    for (std::set<GLenum>::const_iterator format = formats.begin(); format != formats.end(); format++)
+    {
+        for (std::set<GLenum>::const_iterator type = types.begin(); type != types.end(); type++)
+        {
+            if (knownPairs.count(std::make_pair(*format, *type)) == 0)
+            {
+                const gl::FormatType &formatTypeInfo = gl::GetFormatTypeInfo(*format, *type);
+                EXPECT_EQ(GLenum(GL_NONE), formatTypeInfo.internalFormat) << std::hex << *format << " " << *type;
+                EXPECT_EQ(NULL, formatTypeInfo.colorWriteFunction) << std::hex << *format << " " << *type;
+            }
+        }
+    }
+}
+
+}
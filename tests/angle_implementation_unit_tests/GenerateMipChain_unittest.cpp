@@ -0,0 +1,284 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "libGLESv2/renderer/generatemip.h"
+#include "SIMDLevelTest.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+using namespace rx;
+
+namespace
+{
+
+// Small deterministic generator so that failures reproduce.
+class Random
+{
+  public:
+    explicit Random(uint32_t seed) : mState(seed) {}
+
+    uint32_t next()
+    {
+        mState = mState * 1664525u + 1013904223u;
+        return mState >> 8;
+    }
+
+    size_t range(size_t min, size_t max)
+    {
+        return min + next() % (max - min + 1);
+    }
+
+  private:
+    uint32_t mState;
+};
+
+// Random bytes, except that the float formats only get finite values: the
+// sign of the average of two NaNs depends on the order the compiler adds them
+// in. The floats start at |offset|.
+void FillRandom(Random *random, size_t floatBytes, size_t offset, std::vector<uint8_t> *data)
+{
+    if (floatBytes == 4)
+    {
+        for (size_t i = offset; i + 4 <= data->size(); i += 4)
+        {
+            float value = static_cast<float>(static_cast<int>(random->next() & 0xFFFF) - 0x8000) / 16384.0f;
+            memcpy(&(*data)[i], &value, sizeof(value));
+        }
+    }
+    else if (floatBytes == 2)
+    {
+        for (size_t i = offset; i + 2 <= data->size(); i += 2)
+        {
+            uint16_t value = static_cast<uint16_t>(random->next());
+            if ((value & 0x7C00) == 0x7C00)
+            {
+                value &= 0xBFFF;
+            }
+            memcpy(&(*data)[i], &value, sizeof(value));
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < data->size(); i++)
+        {
+            (*data)[i] = static_cast<uint8_t>(random->next());
+        }
+    }
+}
+
+struct MipChainImage
+{
+    std::vector<std::vector<uint8_t> > data;
+    std::vector<MipChainLevel> levels;
+};
+
+size_t LevelSize(size_t size, size_t level)
+{
+    return std::max<size_t>(1, size >> level);
+}
+
+// Each level gets some padding at the end of its rows and slices.
+MipChainImage CreateImage(size_t width, size_t height, size_t depth, size_t levelCount, size_t pixelBytes)
+{
+    MipChainImage image;
+    image.data.resize(levelCount);
+    image.levels.resize(levelCount);
+    for (size_t level = 0; level < levelCount; level++)
+    {
+        MipChainLevel &chainLevel = image.levels[level];
+        chainLevel.rowPitch = LevelSize(width, level) * pixelBytes + 4 * (level % 3);
+        chainLevel.depthPitch = chainLevel.rowPitch * LevelSize(height, level) + 8 * (level % 2);
+        image.data[level].resize(chainLevel.depthPitch * LevelSize(depth, level), 0xCD);
+        chainLevel.data = &image.data[level][0];
+    }
+    return image;
+}
+
+template <typename T>
+void CheckMipChain(Random *random, size_t width, size_t height, size_t depth, size_t floatBytes)
+{
+    size_t maxLevels = 1;
+    while ((std::max(width, std::max(height, depth)) >> maxLevels) > 0)
+    {
+        maxLevels++;
+    }
+    if (maxLevels < 2)
+    {
+        return;
+    }
+    size_t levelCount = random->range(2, maxLevels);
+
+    MipChainImage expected = CreateImage(width, height, depth, levelCount, sizeof(T));
+    FillRandom(random, floatBytes, 0, &expected.data[0]);
+    MipChainImage actual = CreateImage(width, height, depth, levelCount, sizeof(T));
+    actual.data[0] = expected.data[0];
+
+    for (size_t level = 1; level < levelCount; level++)
+    {
+        const MipChainLevel &source = expected.levels[level - 1];
+        const MipChainLevel &dest = expected.levels[level];
+        GenerateMip<T>(LevelSize(width, level - 1), LevelSize(height, level - 1), LevelSize(depth, level - 1),
+                       source.data, source.rowPitch, source.depthPitch, dest.data, dest.rowPitch, dest.depthPitch);
+    }
+    GenerateMipChain<T>(width, height, depth, &actual.levels[0], levelCount);
+
+    for (size_t level = 1; level < levelCount; level++)
+    {
+        ASSERT_EQ(expected.data[level], actual.data[level]) << "size " << width << "x" << height << "x" << depth
+                                                            << " level " << level;
+    }
+}
+
+template <typename T>
+void CheckMipChains(uint32_t seed, size_t floatBytes)
+{
+    Random random(seed);
+
+    // 1D, 2D and 3D images of power of two and odd sizes, including some
+    // larger than a tile
+    for (int iteration = 0; iteration < 40; iteration++)
+    {
+        CheckMipChain<T>(&random, random.range(1, 600), 1, 1, floatBytes);
+        CheckMipChain<T>(&random, 1, random.range(2, 600), 1, floatBytes);
+        CheckMipChain<T>(&random, random.range(1, 300), random.range(1, 300), 1, floatBytes);
+        CheckMipChain<T>(&random, random.range(1, 40), random.range(1, 40), random.range(2, 40), floatBytes);
+    }
+
+    const size_t sizes[][3] =
+    {
+        { 256, 256, 1 },
+        { 512, 64, 1 },
+        { 3, 1024, 1 },
+        { 1, 1, 64 },
+        { 64, 1, 64 },
+        { 1, 64, 64 },
+        { 32, 32, 32 },
+        { 100, 37, 9 },
+    };
+    for (size_t i = 0; i < ArraySize(sizes); i++)
+    {
+        CheckMipChain<T>(&random, sizes[i][0], sizes[i][1], sizes[i][2], floatBytes);
+    }
+}
+
+TEST(GenerateMipChainTest, MatchesGenerateMip)
+{
+    CheckMipChains<R8G8B8A8>(1, 0);
+    CheckMipChains<B8G8R8A8>(2, 0);
+    CheckMipChains<R16G16B16A16F>(3, 2);
+    CheckMipChains<R32G32B32A32F>(4, 4);
+
+    // Formats without vectorized filters
+    CheckMipChains<R8G8>(5, 0);
+    CheckMipChains<R10G10B10A2>(6, 0);
+}
+
+class MipRowKernelTest : public SIMDLevelTest
+{
+};
+
+// Every vectorized filter produces the same bytes as the scalar one.
+TEST_P(MipRowKernelTest, MatchesScalar)
+{
+    if (!isSupported())
+    {
+        return;
+    }
+
+    for (int kernelIndex = 0; kernelIndex < MIP_ROW_KERNEL_COUNT; kernelIndex++)
+    {
+        MipRowKernel kernel = static_cast<MipRowKernel>(kernelIndex);
+        const MipRowFunctions *functions = GetMipRowKernel(kernel, level());
+        if (!functions)
+        {
+            continue;
+        }
+
+        const MipRowFunctions *scalar = GetMipRowKernel(kernel, gl::SIMD_SCALAR);
+        const size_t pixelBytes = GetMipRowKernelPixelBytes(kernel);
+        const size_t floatBytes = (kernel == MIP_ROW_RGBA8) ? 0 : GetMipRowKernelPixelBytes(kernel) / 4;
+
+        Random random(kernelIndex + 1);
+        for (int iteration = 0; iteration < 200; iteration++)
+        {
+            size_t count = random.range(1, 70);
+            size_t offset = random.range(0, 7);
+
+            std::vector<uint8_t> first(offset + count * 2 * pixelBytes);
+            std::vector<uint8_t> second(offset + count * pixelBytes);
+            FillRandom(&random, floatBytes, offset, &first);
+            FillRandom(&random, floatBytes, offset, &second);
+
+            std::vector<uint8_t> expected(offset + count * pixelBytes + 16, 0xCD);
+            std::vector<uint8_t> actual(expected);
+            scalar->averageRows(count, &first[offset], &second[offset], &expected[offset]);
+            functions->averageRows(count, &first[offset], &second[offset], &actual[offset]);
+            ASSERT_EQ(expected, actual) << GetMipRowKernelName(kernel) << " rows " << gl::GetSIMDLevelName(level())
+                                        << " count " << count;
+
+            scalar->averagePairs(count, &first[offset], &expected[offset]);
+            functions->averagePairs(count, &first[offset], &actual[offset]);
+            ASSERT_EQ(expected, actual) << GetMipRowKernelName(kernel) << " pairs " << gl::GetSIMDLevelName(level())
+                                        << " count " << count;
+        }
+    }
+}
+
+// Checks every pair of half float signs and exponents, except for two NaNs of
+// different signs.
+TEST_P(MipRowKernelTest, AllHalfFloatClasses)
+{
+    if (!isSupported())
+    {
+        return;
+    }
+
+    const MipRowFunctions *functions = GetMipRowKernel(MIP_ROW_RGBA16F, level());
+    if (!functions)
+    {
+        return;
+    }
+
+    // Every combination of 64 sign and exponent values with a few mantissas
+    const uint16_t mantissas[] = { 0x000, 0x001, 0x155, 0x200, 0x3FF };
+    std::vector<uint16_t> first;
+    std::vector<uint16_t> second;
+    for (uint16_t a = 0; a < 64; a++)
+    {
+        for (uint16_t b = 0; b < 64; b++)
+        {
+            for (size_t m = 0; m < ArraySize(mantissas); m++)
+            {
+                uint16_t firstMantissa = mantissas[m];
+                uint16_t secondMantissa = mantissas[ArraySize(mantissas) - 1 - m];
+                if ((a & 0x1F) == 0x1F && (b & 0x1F) == 0x1F && a != b && firstMantissa != 0 && secondMantissa != 0)
+                {
+                    continue;
+                }
+                first.push_back(static_cast<uint16_t>((a << 10) | firstMantissa));
+                second.push_back(static_cast<uint16_t>((b << 10) | secondMantissa));
+            }
+        }
+    }
+    const size_t count = first.size() / 4;
+
+    std::vector<uint16_t> expected(count * 4);
+    std::vector<uint16_t> actual(count * 4);
+    GetMipRowKernel(MIP_ROW_RGBA16F, gl::SIMD_SCALAR)->averageRows(count, reinterpret_cast<const uint8_t*>(&first[0]),
+                                                                    reinterpret_cast<const uint8_t*>(&second[0]),
+                                                                    reinterpret_cast<uint8_t*>(&expected[0]));
+    functions->averageRows(count, reinterpret_cast<const uint8_t*>(&first[0]), reinterpret_cast<const uint8_t*>(&second[0]),
+                           reinterpret_cast<uint8_t*>(&actual[0]));
+    EXPECT_EQ(expected, actual) << gl::GetSIMDLevelName(level());
+}
+
+ANGLE_INSTANTIATE_SIMD_LEVEL_TEST(MipRowKernelTest, gl::SIMD_SSE2);
+
+}
@@ -0,0 +1,281 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "libGLESv2/renderer/ImageLoadExecutor.h"
+#include "libGLESv2/renderer/loadimage.h"
+#include "libGLESv2/renderer/copyvertexSIMD.h"
+
+#include <set>
+#include <vector>
+
+using namespace rx;
+
+namespace
+{
+
+struct LoadFunctionInfo
+{
+    const char *name;
+    LoadImageFunction function;
+    size_t inputPixelBytes;
+    size_t outputPixelBytes;
+};
+
+const LoadFunctionInfo kLoadFunctions[] =
+{
+    { "RGBA8ToBGRA8",  LoadRGBA8ToBGRA8,          4,  4 },
+    { "RGB8ToBGRX8",   LoadRGB8ToBGRX8,           3,  4 },
+    { "R5G6B5ToRGBA8", LoadR5G6B5ToRGBA8,         2,  4 },
+    { "RGB32FToRGB9E5", LoadRGB32FToRGB9E5,       12, 4 },
+    { "RGBA32FTo16F",  Load32FTo16F<4>,           16, 8 },
+    { "RGB32FToRGBA16F", LoadRGB32FToRGBA16F,     12, 8 },
+};
+
+struct ImageSize
+{
+    size_t width;
+    size_t height;
+    size_t depth;
+};
+
+std::vector<uint8_t> RunLoad(ImageLoadExecutor *executor, const LoadFunctionInfo &info, const ImageSize &size)
+{
+    // Padded rows and slices, which must not be written
+    size_t inputRowPitch = size.width * info.inputPixelBytes + 3;
+    size_t inputDepthPitch = inputRowPitch * size.height + 5;
+    size_t outputRowPitch = size.width * info.outputPixelBytes + 8;
+    size_t outputDepthPitch = outputRowPitch * size.height + 16;
+
+    std::vector<uint8_t> input(inputDepthPitch * size.depth);
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        input[i] = static_cast<uint8_t>((i * 2654435761u) >> 13);
+    }
+
+    std::vector<uint8_t> output(outputDepthPitch * size.depth, 0xCD);
+    if (executor)
+    {
+        executor->load(info.function, size.width, size.height, size.depth,
+                       &input[0], inputRowPitch, inputDepthPitch,
+                       &output[0], outputRowPitch, outputDepthPitch);
+    }
+    else
+    {
+        info.function(size.width, size.height, size.depth,
+                      &input[0], inputRowPitch, inputDepthPitch,
+                      &output[0], outputRowPitch, outputDepthPitch);
+    }
+    return output;
+}
+
+// Splitting the work doesn't change a byte, whatever the number of threads.
+TEST(ImageLoadExecutorTest, MatchesDirectLoad)
+{
+    const ImageSize sizes[] =
+    {
+        { 1, 1, 1 },
+        { 7, 3, 1 },
+        { 300, 257, 1 },
+        { 1, 1000, 1 },
+        { 33, 9, 11 },
+        { 64, 1, 40 },
+    };
+
+    for (size_t threads = 1; threads <= 4; threads++)
+    {
+        ImageLoadExecutor executor(threads, 0);
+        for (size_t functionIndex = 0; functionIndex < ArraySize(kLoadFunctions); functionIndex++)
+        {
+            const LoadFunctionInfo &info = kLoadFunctions[functionIndex];
+            for (size_t sizeIndex = 0; sizeIndex < ArraySize(sizes); sizeIndex++)
+            {
+                const ImageSize &size = sizes[sizeIndex];
+                ASSERT_EQ(RunLoad(NULL, info, size), RunLoad(&executor, info, size))
+                    << info.name << " " << size.width << "x" << size.height << "x" << size.depth
+                    << " with " << threads << " threads";
+            }
+        }
+    }
+}
+
+std::vector<uint8_t> RunBlockLoad(ImageLoadExecutor *executor, LoadImageFunction loadFunction, size_t blockBytes,
+                                  size_t outputPixelBytes, const ImageSize &size)
+{
+    const size_t inputRowPitch = ((size.width + 3) / 4) * blockBytes + 3;
+    const size_t inputDepthPitch = inputRowPitch * ((size.height + 3) / 4) + 5;
+    const size_t outputRowPitch = size.width * outputPixelBytes + 8;
+    const size_t outputDepthPitch = outputRowPitch * size.height + 16;
+
+    std::vector<uint8_t> input(inputDepthPitch * size.depth);
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        input[i] = static_cast<uint8_t>((i * 2654435761u) >> 13);
+    }
+
+    std::vector<uint8_t> output(outputDepthPitch * size.depth, 0xCD);
+    if (executor)
+    {
+        executor->loadBlocks(loadFunction, 4, size.width, size.height, size.depth,
+                             &input[0], inputRowPitch, inputDepthPitch,
+                             &output[0], outputRowPitch, outputDepthPitch);
+    }
+    else
+    {
+        loadFunction(size.width, size.height, size.depth,
+                     &input[0], inputRowPitch, inputDepthPitch,
+                     &output[0], outputRowPitch, outputDepthPitch);
+    }
+    return output;
+}
+
+// Decompressing in bands of block rows matches decompressing at once.
+TEST(ImageLoadExecutorTest, BlocksMatchDirectLoad)
+{
+    const ImageSize sizes[] =
+    {
+        { 1, 1, 1 },
+        { 5, 7, 1 },
+        { 300, 257, 1 },
+        { 4, 1001, 1 },
+        { 33, 9, 3 },
+    };
+
+    for (size_t threads = 1; threads <= 4; threads++)
+    {
+        ImageLoadExecutor executor(threads, 0);
+        for (size_t sizeIndex = 0; sizeIndex < ArraySize(sizes); sizeIndex++)
+        {
+            const ImageSize &size = sizes[sizeIndex];
+            ASSERT_EQ(RunBlockLoad(NULL, LoadETC2RGBA8ToRGBA8, 16, 4, size),
+                      RunBlockLoad(&executor, LoadETC2RGBA8ToRGBA8, 16, 4, size))
+                << size.width << "x" << size.height << "x" << size.depth << " with " << threads << " threads";
+            ASSERT_EQ(RunBlockLoad(NULL, LoadEACR11ToR16, 8, 2, size),
+                      RunBlockLoad(&executor, LoadEACR11ToR16, 8, 2, size))
+                << size.width << "x" << size.height << "x" << size.depth << " with " << threads << " threads";
+        }
+    }
+}
+
+// Converting vertices in runs matches converting them at once.
+TEST(ImageLoadExecutorTest, VerticesMatchDirectCopy)
+{
+    const VertexCopyKernel kernels[] =
+    {
+        VERTEX_COPY_8SNORM_3_TO_16SNORM_4,
+        VERTEX_COPY_16UNORM_3_TO_32F_3,
+        VERTEX_COPY_XYZ10W2_SNORM_TO_32F,
+    };
+    const size_t counts[] = { 1, 2, 17, 4099, 100000 };
+    const size_t stride = 20;
+
+    std::vector<uint8_t> input(counts[ArraySize(counts) - 1] * stride);
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        input[i] = static_cast<uint8_t>((i * 2654435761u) >> 13);
+    }
+
+    for (size_t threads = 1; threads <= 4; threads++)
+    {
+        ImageLoadExecutor executor(threads, 0);
+        for (size_t kernelIndex = 0; kernelIndex < ArraySize(kernels); kernelIndex++)
+        {
+            const VertexCopyKernelInfo &info = GetVertexCopyKernelInfo(kernels[kernelIndex]);
+            VertexCopyFunction function = GetBestVertexCopyFunction(kernels[kernelIndex]);
+            for (size_t countIndex = 0; countIndex < ArraySize(counts); countIndex++)
+            {
+                size_t count = counts[countIndex];
+                std::vector<uint8_t> expected(count * info.outputBytes + 16, 0xCD);
+                std::vector<uint8_t> actual(expected.size(), 0xCD);
+                function(&input[0], stride, count, &expected[0]);
+                executor.copyVertices(function, &input[0], stride, count, &actual[0], info.outputBytes);
+                ASSERT_EQ(expected, actual) << info.name << ", " << count << " vertices with " << threads << " threads";
+            }
+        }
+    }
+}
+
+std::set<std::thread::id> gLoadingThreads;
+std::mutex gLoadingThreadsMutex;
+
+// Counts how many times each row is loaded, in the first byte of the row.
+void CountRows(size_t width, size_t height, size_t depth,
+               const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+               uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    {
+        std::lock_guard<std::mutex> lock(gLoadingThreadsMutex);
+        gLoadingThreads.insert(std::this_thread::get_id());
+    }
+
+    for (size_t z = 0; z < depth; z++)
+    {
+        for (size_t y = 0; y < height; y++)
+        {
+            output[z * outputDepthPitch + y * outputRowPitch]++;
+        }
+    }
+}
+
+TEST(ImageLoadExecutorTest, LoadsEveryRowOnce)
+{
+    const size_t width = 16;
+    const size_t height = 2049;
+    const size_t depth = 3;
+    std::vector<uint8_t> output(width * height * depth, 0);
+
+    ImageLoadExecutor executor(4, 0);
+    executor.load(CountRows, width, height, depth, NULL, 0, 0, &output[0], width, width * height);
+
+    for (size_t row = 0; row < height * depth; row++)
+    {
+        ASSERT_EQ(1, output[row * width]) << row;
+    }
+}
+
+TEST(ImageLoadExecutorTest, SmallImagesLoadOnCallingThread)
+{
+    const size_t width = 64;
+    const size_t height = 64;
+    std::vector<uint8_t> output(width * height, 0);
+
+    gLoadingThreads.clear();
+    ImageLoadExecutor executor(4, width * height + 1);
+    executor.load(CountRows, width, height, 1, NULL, 0, 0, &output[0], width, width * height);
+
+    ASSERT_EQ(1u, gLoadingThreads.size());
+    EXPECT_EQ(std::this_thread::get_id(), *gLoadingThreads.begin());
+}
+
+// Loads from several threads at once take turns.
+TEST(ImageLoadExecutorTest, ConcurrentLoads)
+{
+    ImageLoadExecutor executor(3, 0);
+    const ImageSize size = { 128, 128, 2 };
+    const LoadFunctionInfo &info = kLoadFunctions[1];
+    const std::vector<uint8_t> expected = RunLoad(NULL, info, size);
+
+    std::vector<std::vector<uint8_t> > results(4);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        threads.push_back(std::thread([&, i]()
+        {
+            for (size_t iteration = 0; iteration < 10; iteration++)
+            {
+                results[i] = RunLoad(&executor, info, size);
+            }
+        }));
+    }
+    for (size_t i = 0; i < threads.size(); i++)
+    {
+        threads[i].join();
+        EXPECT_EQ(expected, results[i]);
+    }
+}
+
+}
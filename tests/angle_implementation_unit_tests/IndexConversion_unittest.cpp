@@ -0,0 +1,174 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "libGLESv2/renderer/indexconversion.h"
+#include "SIMDLevelTest.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace rx;
+
+namespace
+{
+
+size_t GetIndexBytes(GLenum type)
+{
+    switch (type)
+    {
+      case GL_UNSIGNED_BYTE:  return 1;
+      case GL_UNSIGNED_SHORT: return 2;
+      default:                return 4;
+    }
+}
+
+unsigned int ReadIndex(GLenum type, const uint8_t *data, size_t i)
+{
+    switch (type)
+    {
+      case GL_UNSIGNED_BYTE:  return data[i];
+      case GL_UNSIGNED_SHORT: return reinterpret_cast<const GLushort*>(data)[i];
+      default:                return reinterpret_cast<const GLuint*>(data)[i];
+    }
+}
+
+void WriteIndex(GLenum type, uint8_t *data, size_t i, unsigned int value)
+{
+    switch (type)
+    {
+      case GL_UNSIGNED_BYTE:  data[i] = static_cast<GLubyte>(value); break;
+      case GL_UNSIGNED_SHORT: reinterpret_cast<GLushort*>(data)[i] = static_cast<GLushort>(value); break;
+      default:                reinterpret_cast<GLuint*>(data)[i] = value; break;
+    }
+}
+
+class IndexConversionTest : public SIMDLevelTest
+{
+  protected:
+    // Checks |count| indices starting |offset| indices past an aligned
+    // address, with extreme values written at |minPosition| and
+    // |maxPosition|.
+    void check(IndexConversionKernel kernel, const IndexConversionFunctions &functions, size_t count, size_t offset,
+               size_t minPosition, size_t maxPosition, unsigned int *seed)
+    {
+        const IndexConversionKernelInfo &info = GetIndexConversionKernelInfo(kernel);
+        const size_t sourceBytes = GetIndexBytes(info.sourceType);
+        const size_t destBytes = GetIndexBytes(info.destinationType);
+        const unsigned int typeMax = static_cast<unsigned int>((1ull << (sourceBytes * 8)) - 1);
+
+        // Values between 2 and typeMax - 2, then a smaller and a larger one,
+        // with the extremes of the type in some of the cases
+        const unsigned int minIndex = (*seed & 1) ? 0 : 1;
+        const unsigned int maxIndex = (*seed & 2) ? typeMax : typeMax - 1;
+
+        std::vector<uint8_t> source((count + offset) * sourceBytes + 32);
+        uint8_t *indices = &source[0] + (32 - reinterpret_cast<uintptr_t>(&source[0]) % 32) % 32 + offset * sourceBytes;
+        for (size_t i = 0; i < count; i++)
+        {
+            *seed = *seed * 1664525 + 1013904223;
+            WriteIndex(info.sourceType, indices, i, 2 + (*seed >> 8) % (typeMax - 3));
+        }
+        if (count > 0)
+        {
+            WriteIndex(info.sourceType, indices, minPosition, minIndex);
+            WriteIndex(info.sourceType, indices, maxPosition, maxIndex);
+        }
+        RangeUI expected(0, 0);
+        if (count > 0)
+        {
+            expected = RangeUI(ReadIndex(info.sourceType, indices, 0), ReadIndex(info.sourceType, indices, 0));
+            for (size_t i = 1; i < count; i++)
+            {
+                expected.start = std::min(expected.start, ReadIndex(info.sourceType, indices, i));
+                expected.end = std::max(expected.end, ReadIndex(info.sourceType, indices, i));
+            }
+        }
+
+        // The destination is misaligned the same way, with guard bytes after it
+        std::vector<uint8_t> destination((count + offset) * destBytes + 64, 0xCD);
+        uint8_t *dest = &destination[0] + (32 - reinterpret_cast<uintptr_t>(&destination[0]) % 32) % 32 + offset * destBytes;
+        size_t guardStart = (dest - &destination[0]) + count * destBytes;
+
+        RangeUI range = functions.computeRange(count, indices);
+        EXPECT_EQ(expected.start, range.start);
+        EXPECT_EQ(expected.end, range.end);
+
+        RangeUI convertedRange = functions.convert(count, indices, dest);
+        EXPECT_EQ(expected.start, convertedRange.start);
+        EXPECT_EQ(expected.end, convertedRange.end);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            ASSERT_EQ(ReadIndex(info.sourceType, indices, i), ReadIndex(info.destinationType, dest, i)) << i;
+        }
+        for (size_t i = guardStart; i < destination.size(); i++)
+        {
+            ASSERT_EQ(0xCD, destination[i]) << "wrote past the end";
+        }
+    }
+};
+
+// Every version of every kernel copies the indices and finds their range,
+// whatever the count and alignment and wherever the extremes are.
+TEST_P(IndexConversionTest, MatchesReference)
+{
+    if (!isSupported())
+    {
+        return;
+    }
+
+    unsigned int seed = 11;
+    for (size_t kernelIndex = 0; kernelIndex < INDEX_CONVERSION_KERNEL_COUNT; kernelIndex++)
+    {
+        IndexConversionKernel kernel = static_cast<IndexConversionKernel>(kernelIndex);
+        const IndexConversionFunctions *functions = GetIndexConversionFunctions(kernel, level());
+        if (!functions)
+        {
+            continue;
+        }
+        SCOPED_TRACE(GetIndexConversionKernelInfo(kernel).name);
+
+        for (size_t count = 0; count <= 100; count++)
+        {
+            for (size_t offset = 0; offset < 4; offset++)
+            {
+                size_t last = (count > 0) ? count - 1 : 0;
+                SCOPED_TRACE(testing::Message() << count << " indices at offset " << offset);
+                check(kernel, *functions, count, offset, 0, last, &seed);
+                check(kernel, *functions, count, offset, last, 0, &seed);
+                check(kernel, *functions, count, offset, count / 2, (count * 3) / 4, &seed);
+            }
+        }
+
+        for (size_t count = 4093; count <= 4099; count++)
+        {
+            check(kernel, *functions, count, 1, count - 1, 17, &seed);
+        }
+    }
+}
+
+ANGLE_INSTANTIATE_SIMD_LEVEL_TEST(IndexConversionTest, gl::SIMD_SCALAR);
+
+// The shorthands pick the kernel from the types.
+TEST(IndexConversionTest, Shorthands)
+{
+    const GLushort indices[] = { 7, 0xFFFF, 3, 9 };
+    GLuint converted[4] = { 0 };
+
+    RangeUI range = ComputeIndexRange(GL_UNSIGNED_SHORT, indices, 4);
+    EXPECT_EQ(3u, range.start);
+    EXPECT_EQ(0xFFFFu, range.end);
+
+    range = ConvertIndices(GL_UNSIGNED_SHORT, GL_UNSIGNED_INT, indices, 4, converted);
+    EXPECT_EQ(3u, range.start);
+    EXPECT_EQ(0xFFFFu, range.end);
+    EXPECT_EQ(0xFFFFu, converted[1]);
+    EXPECT_EQ(9u, converted[3]);
+}
+
+}
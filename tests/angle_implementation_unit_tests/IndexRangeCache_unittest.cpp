@@ -0,0 +1,219 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "libGLESv2/renderer/IndexRangeCache.h"
+
+#include <vector>
+
+using namespace rx;
+
+namespace
+{
+
+bool HasRange(const IndexRangeCache &cache, GLenum type, unsigned int offset, GLsizei count)
+{
+    return cache.findRange(type, offset, count, NULL, NULL);
+}
+
+TEST(IndexRangeCacheTest, FindsAddedRanges)
+{
+    IndexRangeCache cache;
+    cache.addRange(GL_UNSIGNED_SHORT, 16, 10, RangeUI(3, 9), 32);
+
+    RangeUI range;
+    unsigned int streamOffset = 0;
+    ASSERT_TRUE(cache.findRange(GL_UNSIGNED_SHORT, 16, 10, &range, &streamOffset));
+    EXPECT_EQ(3u, range.start);
+    EXPECT_EQ(9u, range.end);
+    EXPECT_EQ(32u, streamOffset);
+
+    EXPECT_FALSE(cache.findRange(GL_UNSIGNED_INT, 16, 10, &range, &streamOffset));
+    EXPECT_FALSE(HasRange(cache, GL_UNSIGNED_SHORT, 16, 11));
+    EXPECT_FALSE(HasRange(cache, GL_UNSIGNED_SHORT, 18, 10));
+    EXPECT_EQ(0u, range.end);
+    EXPECT_EQ(0u, streamOffset);
+
+    // Adding the same range again replaces it
+    cache.addRange(GL_UNSIGNED_SHORT, 16, 10, RangeUI(1, 2), 64);
+    ASSERT_TRUE(cache.findRange(GL_UNSIGNED_SHORT, 16, 10, &range, &streamOffset));
+    EXPECT_EQ(2u, range.end);
+    EXPECT_EQ(64u, streamOffset);
+    EXPECT_EQ(1u, cache.size());
+}
+
+// Ranges overlapping or touching the written bytes are dropped, and no others.
+TEST(IndexRangeCacheTest, InvalidatesOverlappingRanges)
+{
+    IndexRangeCache cache;
+
+    // Bytes [100, 120] of the buffer
+    cache.addRange(GL_UNSIGNED_SHORT, 100, 10, RangeUI(0, 1), 100);
+
+    cache.invalidateRange(60, 39);
+    cache.invalidateRange(121, 50);
+    EXPECT_TRUE(HasRange(cache, GL_UNSIGNED_SHORT, 100, 10));
+
+    cache.invalidateRange(60, 40);
+    EXPECT_FALSE(HasRange(cache, GL_UNSIGNED_SHORT, 100, 10));
+
+    cache.addRange(GL_UNSIGNED_SHORT, 100, 10, RangeUI(0, 1), 100);
+    cache.invalidateRange(120, 1);
+    EXPECT_FALSE(HasRange(cache, GL_UNSIGNED_SHORT, 100, 10));
+
+    // Written bytes inside the range, and around it
+    cache.addRange(GL_UNSIGNED_SHORT, 100, 10, RangeUI(0, 1), 100);
+    cache.invalidateRange(110, 0);
+    EXPECT_FALSE(HasRange(cache, GL_UNSIGNED_SHORT, 100, 10));
+
+    cache.addRange(GL_UNSIGNED_SHORT, 100, 10, RangeUI(0, 1), 100);
+    cache.invalidateRange(0, 4096);
+    EXPECT_FALSE(HasRange(cache, GL_UNSIGNED_SHORT, 100, 10));
+
+    // Empty ranges are a point at their offset
+    cache.addRange(GL_UNSIGNED_INT, 200, 0, RangeUI(0, 0), 200);
+    cache.invalidateRange(201, 10);
+    EXPECT_TRUE(HasRange(cache, GL_UNSIGNED_INT, 200, 0));
+    cache.invalidateRange(190, 10);
+    EXPECT_FALSE(HasRange(cache, GL_UNSIGNED_INT, 200, 0));
+}
+
+// A large range is found from a write far past its start.
+TEST(IndexRangeCacheTest, InvalidatesLargeRanges)
+{
+    IndexRangeCache cache;
+    cache.addRange(GL_UNSIGNED_INT, 0, 1 << 20, RangeUI(0, 1), 0);
+    cache.addRange(GL_UNSIGNED_BYTE, 4, 1, RangeUI(0, 1), 4);
+
+    cache.invalidateRange((1 << 22) - 1, 1);
+    EXPECT_FALSE(HasRange(cache, GL_UNSIGNED_INT, 0, 1 << 20));
+    EXPECT_TRUE(HasRange(cache, GL_UNSIGNED_BYTE, 4, 1));
+
+    // Sizes on both sides of a power of two
+    cache.addRange(GL_UNSIGNED_BYTE, 1000, 255, RangeUI(0, 1), 1000);
+    cache.addRange(GL_UNSIGNED_BYTE, 2000, 256, RangeUI(0, 1), 2000);
+    cache.addRange(GL_UNSIGNED_BYTE, 3000, 257, RangeUI(0, 1), 3000);
+    cache.invalidateRange(1255, 0);
+    cache.invalidateRange(2256, 0);
+    cache.invalidateRange(3257, 0);
+    EXPECT_EQ(1u, cache.size());
+
+    cache.addRange(GL_UNSIGNED_BYTE, 1000, 255, RangeUI(0, 1), 1000);
+    cache.addRange(GL_UNSIGNED_BYTE, 2000, 256, RangeUI(0, 1), 2000);
+    cache.addRange(GL_UNSIGNED_BYTE, 3000, 257, RangeUI(0, 1), 3000);
+    cache.invalidateRange(1256, 10);
+    cache.invalidateRange(2257, 10);
+    cache.invalidateRange(3258, 10);
+    EXPECT_EQ(4u, cache.size());
+}
+
+// Invalidation drops the same ranges as checking every cached range.
+TEST(IndexRangeCacheTest, MatchesLinearInvalidation)
+{
+    struct Added
+    {
+        GLenum type;
+        unsigned int offset;
+        GLsizei count;
+        unsigned int bytes;
+        unsigned int streamOffset;
+    };
+    const GLenum types[] = { GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT, GL_UNSIGNED_INT };
+    const unsigned int typeBytes[] = { 1, 2, 4 };
+
+    IndexRangeCache cache(100000);
+    std::vector<Added> added;
+    unsigned int seed = 5;
+    for (size_t i = 0; i < 3000; i++)
+    {
+        seed = seed * 1664525 + 1013904223;
+        Added range;
+        range.type = types[(seed >> 4) % 3];
+        range.bytes = typeBytes[(seed >> 4) % 3];
+        range.offset = static_cast<unsigned int>(i * 22 + (seed >> 8) % 22);
+        seed = seed * 1664525 + 1013904223;
+        range.count = (seed >> 20) % ((seed & 1) ? 16 : 4096);
+        range.streamOffset = range.offset;
+        cache.addRange(range.type, range.offset, range.count, RangeUI(0, 1), range.streamOffset);
+        added.push_back(range);
+    }
+
+    std::vector<bool> kept(added.size(), true);
+    for (size_t write = 0; write < 200; write++)
+    {
+        seed = seed * 1664525 + 1013904223;
+        unsigned int offset = (seed >> 8) % 70000;
+        unsigned int size = (seed >> 4) % 64;
+        cache.invalidateRange(offset, size);
+
+        for (size_t i = 0; i < added.size(); i++)
+        {
+            const Added &range = added[i];
+            unsigned int rangeEnd = range.streamOffset + range.bytes * range.count;
+            if (!(offset + size < range.streamOffset || offset > rangeEnd))
+            {
+                kept[i] = false;
+            }
+        }
+    }
+
+    size_t keptCount = 0;
+    for (size_t i = 0; i < added.size(); i++)
+    {
+        ASSERT_EQ(kept[i], HasRange(cache, added[i].type, added[i].offset, added[i].count)) << i;
+        keptCount += kept[i] ? 1 : 0;
+    }
+    EXPECT_EQ(keptCount, cache.size());
+}
+
+// Past the cap, the least recently added or found range goes first.
+TEST(IndexRangeCacheTest, EvictsLeastRecentlyUsed)
+{
+    IndexRangeCache cache(3);
+    cache.addRange(GL_UNSIGNED_SHORT, 0, 1, RangeUI(0, 1), 0);
+    cache.addRange(GL_UNSIGNED_SHORT, 2, 1, RangeUI(0, 1), 2);
+    cache.addRange(GL_UNSIGNED_SHORT, 4, 1, RangeUI(0, 1), 4);
+
+    EXPECT_TRUE(HasRange(cache, GL_UNSIGNED_SHORT, 0, 1));
+    cache.addRange(GL_UNSIGNED_SHORT, 6, 1, RangeUI(0, 1), 6);
+
+    EXPECT_EQ(3u, cache.size());
+    EXPECT_TRUE(HasRange(cache, GL_UNSIGNED_SHORT, 0, 1));
+    EXPECT_FALSE(HasRange(cache, GL_UNSIGNED_SHORT, 2, 1));
+    EXPECT_TRUE(HasRange(cache, GL_UNSIGNED_SHORT, 4, 1));
+    EXPECT_TRUE(HasRange(cache, GL_UNSIGNED_SHORT, 6, 1));
+
+    // Replacing a range doesn't evict another
+    cache.addRange(GL_UNSIGNED_SHORT, 4, 1, RangeUI(0, 2), 4);
+    EXPECT_EQ(3u, cache.size());
+    EXPECT_EQ(1u, cache.getCounters().evictedRanges);
+}
+
+TEST(IndexRangeCacheTest, Counters)
+{
+    IndexRangeCache cache;
+    cache.addRange(GL_UNSIGNED_BYTE, 0, 8, RangeUI(0, 1), 0);
+    cache.addRange(GL_UNSIGNED_BYTE, 8, 8, RangeUI(0, 1), 8);
+    cache.addRange(GL_UNSIGNED_BYTE, 100, 8, RangeUI(0, 1), 100);
+
+    HasRange(cache, GL_UNSIGNED_BYTE, 0, 8);
+    HasRange(cache, GL_UNSIGNED_BYTE, 0, 8);
+    HasRange(cache, GL_UNSIGNED_BYTE, 1, 8);
+    cache.invalidateRange(8, 0);
+
+    const IndexRangeCache::Counters &counters = cache.getCounters();
+    EXPECT_EQ(2u, counters.hits);
+    EXPECT_EQ(1u, counters.misses);
+    EXPECT_EQ(2u, counters.invalidatedRanges);
+    EXPECT_EQ(0u, counters.evictedRanges);
+
+    cache.clear();
+    EXPECT_EQ(0u, cache.size());
+    EXPECT_EQ(2u, cache.getCounters().hits);
+}
+
+}
@@ -0,0 +1,220 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "libGLESv2/renderer/loadimageSIMD.h"
+#include "SIMDLevelTest.h"
+
+#include <vector>
+
+using namespace rx;
+
+namespace
+{
+
+// Small deterministic generator so that failures reproduce.
+class Random
+{
+  public:
+    explicit Random(uint32_t seed) : mState(seed) {}
+
+    uint32_t next()
+    {
+        mState = mState * 1664525u + 1013904223u;
+        return mState >> 8;
+    }
+
+    size_t range(size_t min, size_t max)
+    {
+        return min + next() % (max - min + 1);
+    }
+
+  private:
+    uint32_t mState;
+};
+
+struct LoadImageCase
+{
+    size_t width;
+    size_t height;
+    size_t depth;
+    size_t inputOffset;
+    size_t inputRowPitch;
+    size_t inputDepthPitch;
+    size_t outputOffset;
+    size_t outputRowPitch;
+    size_t outputDepthPitch;
+};
+
+LoadImageCase MakeRandomCase(Random *random, const LoadImageKernelInfo &info)
+{
+    LoadImageCase testCase;
+    testCase.width = random->range(1, 130);
+    testCase.height = random->range(1, 5);
+    testCase.depth = random->range(1, 2);
+    // Unaligned rows, with padding between them
+    testCase.inputOffset = random->range(0, 7);
+    testCase.inputRowPitch = testCase.width * info.inputPixelBytes + random->range(0, 19);
+    testCase.inputDepthPitch = testCase.inputRowPitch * testCase.height + random->range(0, 19);
+    testCase.outputOffset = random->range(0, 7);
+    testCase.outputRowPitch = testCase.width * info.outputPixelBytes + random->range(0, 19);
+    testCase.outputDepthPitch = testCase.outputRowPitch * testCase.height + random->range(0, 19);
+    return testCase;
+}
+
+// Runs |function| on random input and returns the whole output buffer,
+// including the padding, which must be left untouched.
+std::vector<uint8_t> RunLoad(LoadImageFunction function, const LoadImageCase &testCase, uint32_t seed)
+{
+    Random random(seed);
+    std::vector<uint8_t> input(testCase.inputOffset + testCase.inputDepthPitch * testCase.depth);
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        input[i] = static_cast<uint8_t>(random.next());
+    }
+
+    std::vector<uint8_t> output(testCase.outputOffset + testCase.outputDepthPitch * testCase.depth, 0xCD);
+    function(testCase.width, testCase.height, testCase.depth,
+             &input[testCase.inputOffset], testCase.inputRowPitch, testCase.inputDepthPitch,
+             &output[testCase.outputOffset], testCase.outputRowPitch, testCase.outputDepthPitch);
+    return output;
+}
+
+class LoadImageSIMDTest : public SIMDLevelTest
+{
+};
+
+// Every vectorized kernel produces the same bytes as the scalar one.
+TEST_P(LoadImageSIMDTest, MatchesScalar)
+{
+    if (!isSupported())
+    {
+        return;
+    }
+
+    for (int kernelIndex = 0; kernelIndex < LOAD_IMAGE_KERNEL_COUNT; kernelIndex++)
+    {
+        LoadImageKernel kernel = static_cast<LoadImageKernel>(kernelIndex);
+        LoadImageFunction function = GetLoadImageKernel(kernel, level());
+        if (!function)
+        {
+            continue;
+        }
+
+        const LoadImageKernelInfo &info = GetLoadImageKernelInfo(kernel);
+        LoadImageFunction scalar = GetLoadImageKernel(kernel, gl::SIMD_SCALAR);
+
+        Random random(kernelIndex + 1);
+        for (int iteration = 0; iteration < 200; iteration++)
+        {
+            LoadImageCase testCase = MakeRandomCase(&random, info);
+            uint32_t seed = random.next();
+            ASSERT_EQ(RunLoad(scalar, testCase, seed), RunLoad(function, testCase, seed))
+                << info.name << " " << gl::GetSIMDLevelName(level()) << " width " << testCase.width
+                << " height " << testCase.height << " depth " << testCase.depth;
+        }
+    }
+}
+
+// Checks every value of the 16-bit formats in one long row.
+TEST_P(LoadImageSIMDTest, AllPacked16Values)
+{
+    if (!isSupported())
+    {
+        return;
+    }
+
+    std::vector<uint8_t> input(65536 * 2);
+    for (size_t value = 0; value < 65536; value++)
+    {
+        input[2 * value + 0] = static_cast<uint8_t>(value & 0xFF);
+        input[2 * value + 1] = static_cast<uint8_t>(value >> 8);
+    }
+
+    for (int kernelIndex = 0; kernelIndex < LOAD_IMAGE_KERNEL_COUNT; kernelIndex++)
+    {
+        LoadImageKernel kernel = static_cast<LoadImageKernel>(kernelIndex);
+        LoadImageFunction function = GetLoadImageKernel(kernel, level());
+        const LoadImageKernelInfo &info = GetLoadImageKernelInfo(kernel);
+        if (!function || info.inputPixelBytes != 2)
+        {
+            continue;
+        }
+
+        std::vector<uint8_t> expected(65536 * 4);
+        std::vector<uint8_t> actual(65536 * 4);
+        GetLoadImageKernel(kernel, gl::SIMD_SCALAR)(65536, 1, 1, &input[0], input.size(), input.size(),
+                                                      &expected[0], expected.size(), expected.size());
+        function(65536, 1, 1, &input[0], input.size(), input.size(), &actual[0], actual.size(), actual.size());
+        EXPECT_EQ(expected, actual) << info.name << " " << gl::GetSIMDLevelName(level());
+    }
+}
+
+ANGLE_INSTANTIATE_SIMD_LEVEL_TEST(LoadImageSIMDTest, gl::SIMD_SSE2);
+
+TEST(LoadImageSIMDDispatchTest, EveryKernelHasScalarVersion)
+{
+    for (int kernelIndex = 0; kernelIndex < LOAD_IMAGE_KERNEL_COUNT; kernelIndex++)
+    {
+        LoadImageKernel kernel = static_cast<LoadImageKernel>(kernelIndex);
+        EXPECT_TRUE(GetLoadImageKernel(kernel, gl::SIMD_SCALAR) != NULL);
+        EXPECT_EQ(GetLoadImageKernel(kernel, gl::SIMD_SCALAR), ResolveLoadImageKernel(kernel, gl::SIMD_SCALAR));
+        EXPECT_TRUE(GetBestLoadImageKernel(kernel) != NULL);
+    }
+}
+
+// Levels without their own version use the next lower one.
+TEST(LoadImageSIMDDispatchTest, FallsBackToLowerLevel)
+{
+    for (int kernelIndex = 0; kernelIndex < LOAD_IMAGE_KERNEL_COUNT; kernelIndex++)
+    {
+        LoadImageKernel kernel = static_cast<LoadImageKernel>(kernelIndex);
+        for (int level = gl::SIMD_SSE2; level < gl::SIMD_LEVEL_COUNT; level++)
+        {
+            gl::SIMDLevel simdLevel = static_cast<gl::SIMDLevel>(level);
+            LoadImageFunction own = GetLoadImageKernel(kernel, simdLevel);
+            LoadImageFunction lower = ResolveLoadImageKernel(kernel, static_cast<gl::SIMDLevel>(level - 1));
+            EXPECT_EQ(own ? own : lower, ResolveLoadImageKernel(kernel, simdLevel));
+        }
+    }
+
+    EXPECT_EQ(ResolveLoadImageKernel(LOAD_IMAGE_RGBA8_TO_BGRA8, gl::GetSIMDLevel()),
+              GetBestLoadImageKernel(LOAD_IMAGE_RGBA8_TO_BGRA8));
+}
+
+// The public functions run the kernel they share.
+TEST(LoadImageSIMDDispatchTest, PublicFunctionsMatchScalar)
+{
+    struct PublicFunction
+    {
+        LoadImageFunction function;
+        LoadImageKernel kernel;
+    };
+    const PublicFunction publicFunctions[] =
+    {
+        { LoadA8ToBGRA8, LOAD_IMAGE_A8_TO_RGBA8 },
+        { LoadL8ToBGRA8, LOAD_IMAGE_L8_TO_RGBA8 },
+        { LoadLA8ToBGRA8, LOAD_IMAGE_LA8_TO_RGBA8 },
+        { LoadRGB8ToRGBX8, LOAD_IMAGE_RGB8_TO_RGBX8 },
+        { LoadBGRA4ToBGRA8, LOAD_IMAGE_RGBA4_TO_RGBA8 },
+        { LoadBGR5A1ToBGRA8, LOAD_IMAGE_RGB5A1_TO_RGBA8 },
+        { LoadRGB10A2ToRGBA8, LOAD_IMAGE_RGB10A2_TO_RGBA8 },
+    };
+
+    Random random(1234);
+    for (size_t i = 0; i < sizeof(publicFunctions) / sizeof(publicFunctions[0]); i++)
+    {
+        const PublicFunction &publicFunction = publicFunctions[i];
+        LoadImageCase testCase = MakeRandomCase(&random, GetLoadImageKernelInfo(publicFunction.kernel));
+        uint32_t seed = random.next();
+        EXPECT_EQ(RunLoad(GetLoadImageKernel(publicFunction.kernel, gl::SIMD_SCALAR), testCase, seed),
+                  RunLoad(publicFunction.function, testCase, seed))
+            << GetLoadImageKernelInfo(publicFunction.kernel).name;
+    }
+}
+
+}
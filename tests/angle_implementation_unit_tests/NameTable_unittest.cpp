@@ -0,0 +1,89 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "gtest/gtest.h"
+#include "libGLESv2/NameTable.h"
+
+#include <sstream>
+
+namespace
+{
+
+TEST(NameTableTest, EmptyTable)
+{
+    gl::NameTable nameTable;
+    EXPECT_EQ(0u, nameTable.size());
+    EXPECT_EQ(GL_INVALID_INDEX, nameTable.find("color"));
+    EXPECT_EQ(GL_INVALID_INDEX, nameTable.find(""));
+}
+
+TEST(NameTableTest, FindsInsertedNames)
+{
+    gl::NameTable nameTable;
+    nameTable.insert("color", 3);
+    nameTable.insert("lights", 4);
+    nameTable.insert("lights[1]", 5);
+
+    EXPECT_EQ(3u, nameTable.size());
+    EXPECT_EQ(3u, nameTable.find("color"));
+    EXPECT_EQ(4u, nameTable.find("lights"));
+    EXPECT_EQ(5u, nameTable.find("lights[1]"));
+
+    // Only the exact names are found, prefixes and other spellings are not
+    EXPECT_EQ(GL_INVALID_INDEX, nameTable.find("colo"));
+    EXPECT_EQ(GL_INVALID_INDEX, nameTable.find("colors"));
+    EXPECT_EQ(GL_INVALID_INDEX, nameTable.find("lights[01]"));
+    EXPECT_EQ(GL_INVALID_INDEX, nameTable.find("lights[2]"));
+}
+
+TEST(NameTableTest, FirstValueIsKept)
+{
+    gl::NameTable nameTable;
+    nameTable.insert("position", 0);
+    nameTable.insert("position", 7);
+
+    EXPECT_EQ(1u, nameTable.size());
+    EXPECT_EQ(0u, nameTable.find("position"));
+}
+
+TEST(NameTableTest, ClearRemovesEverything)
+{
+    gl::NameTable nameTable;
+    nameTable.insert("normal", 1);
+    nameTable.clear();
+
+    EXPECT_EQ(0u, nameTable.size());
+    EXPECT_EQ(GL_INVALID_INDEX, nameTable.find("normal"));
+
+    nameTable.insert("normal", 2);
+    EXPECT_EQ(2u, nameTable.find("normal"));
+}
+
+TEST(NameTableTest, ManyNames)
+{
+    // Enough elements of an array to grow the table several times
+    const GLuint elementCount = 1000;
+
+    gl::NameTable nameTable;
+    for (GLuint element = 0; element < elementCount; element++)
+    {
+        std::stringstream name;
+        name << "bones[" << element << "]";
+        nameTable.insert(name.str(), element);
+    }
+
+    EXPECT_EQ(elementCount, nameTable.size());
+    for (GLuint element = 0; element < elementCount; element++)
+    {
+        std::stringstream name;
+        name << "bones[" << element << "]";
+        EXPECT_EQ(element, nameTable.find(name.str().c_str()));
+    }
+    EXPECT_EQ(GL_INVALID_INDEX, nameTable.find("bones"));
+    EXPECT_EQ(GL_INVALID_INDEX, nameTable.find("bones[1000]"));
+}
+
+}
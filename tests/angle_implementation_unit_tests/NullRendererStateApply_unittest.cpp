@@ -0,0 +1,281 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// NullRendererStateApply_unittest.cpp: Draws through a gl::Context on the null
+// back-end and counts the renderer state calls, to check that a draw only
+// re-applies the state groups that changed since the previous one.
+
+#include "gtest/gtest.h"
+#include "libGLESv2/Context.h"
+#include "libGLESv2/Framebuffer.h"
+#include "libGLESv2/Program.h"
+#include "libGLESv2/ProgramBinary.h"
+#include "libGLESv2/Shader.h"
+#include "libGLESv2/main.h"
+#include "libGLESv2/renderer/null/NullRenderer.h"
+
+namespace
+{
+
+struct ApplyCounts
+{
+    ApplyCounts()
+        : rasterizerState(0),
+          blendState(0),
+          depthStencilState(0),
+          viewport(0),
+          scissorRectangle(0),
+          texture(0)
+    {
+    }
+
+    unsigned int rasterizerState;
+    unsigned int blendState;
+    unsigned int depthStencilState;
+    unsigned int viewport;
+    unsigned int scissorRectangle;
+    unsigned int texture;
+};
+
+class CountingNullRenderer : public rx::NullRenderer
+{
+  public:
+    CountingNullRenderer()
+        : rx::NullRenderer(NULL, EGL_DEFAULT_DISPLAY, egl::AttributeMap())
+    {
+    }
+
+    virtual gl::Error setTexture(gl::SamplerType type, int index, gl::Texture *texture)
+    {
+        mCounts.texture++;
+        return rx::NullRenderer::setTexture(type, index, texture);
+    }
+
+    virtual gl::Error setRasterizerState(const gl::RasterizerState &rasterState)
+    {
+        mCounts.rasterizerState++;
+        return rx::NullRenderer::setRasterizerState(rasterState);
+    }
+
+    virtual gl::Error setBlendState(gl::Framebuffer *framebuffer, const gl::BlendState &blendState, const gl::ColorF &blendColor,
+                                    unsigned int sampleMask)
+    {
+        mCounts.blendState++;
+        return rx::NullRenderer::setBlendState(framebuffer, blendState, blendColor, sampleMask);
+    }
+
+    virtual gl::Error setDepthStencilState(const gl::DepthStencilState &depthStencilState, int stencilRef,
+                                           int stencilBackRef, bool frontFaceCCW)
+    {
+        mCounts.depthStencilState++;
+        return rx::NullRenderer::setDepthStencilState(depthStencilState, stencilRef, stencilBackRef, frontFaceCCW);
+    }
+
+    virtual void setScissorRectangle(const gl::Rectangle &scissor, bool enabled)
+    {
+        mCounts.scissorRectangle++;
+        rx::NullRenderer::setScissorRectangle(scissor, enabled);
+    }
+
+    virtual void setViewport(const gl::Rectangle &viewport, float zNear, float zFar, GLenum drawMode, GLenum frontFace,
+                             bool ignoreViewport)
+    {
+        mCounts.viewport++;
+        rx::NullRenderer::setViewport(viewport, zNear, zFar, drawMode, frontFace, ignoreViewport);
+    }
+
+    const ApplyCounts &getCounts() const { return mCounts; }
+    void resetCounts() { mCounts = ApplyCounts(); }
+
+  private:
+    ApplyCounts mCounts;
+};
+
+const char *VertexShaderSource =
+    "attribute vec4 position;\n"
+    "void main()\n"
+    "{\n"
+    "    gl_Position = position;\n"
+    "}\n";
+
+const char *FragmentShaderSource =
+    "precision mediump float;\n"
+    "uniform vec4 color;\n"
+    "uniform sampler2D tex;\n"
+    "void main()\n"
+    "{\n"
+    "    gl_FragColor = texture2D(tex, vec2(0.5)) * color;\n"
+    "}\n";
+
+class NullRendererStateApplyTest : public testing::Test
+{
+  protected:
+    virtual void SetUp()
+    {
+        ASSERT_EQ(EGL_SUCCESS, mRenderer.initialize());
+        mContext = new gl::Context(2, NULL, &mRenderer, false, false, false);
+
+        // Attaching to framebuffers looks the renderbuffers up in the current context
+        gl::makeCurrent(mContext, NULL, NULL);
+
+        GLuint renderbuffer = mContext->createRenderbuffer();
+        mContext->bindRenderbuffer(renderbuffer);
+        mContext->setRenderbufferStorage(16, 16, GL_RGBA8_OES, 0);
+
+        GLuint framebuffer = mContext->createFramebuffer();
+        mContext->bindDrawFramebuffer(framebuffer);
+        mContext->getState().getDrawFramebuffer()->setColorbuffer(0, GL_RENDERBUFFER, renderbuffer, 0, 0);
+        ASSERT_EQ(GL_FRAMEBUFFER_COMPLETE, mContext->getState().getDrawFramebuffer()->completeness());
+
+        GLuint program = mContext->createProgram();
+        ASSERT_TRUE(attachShader(program, GL_VERTEX_SHADER, VertexShaderSource));
+        ASSERT_TRUE(attachShader(program, GL_FRAGMENT_SHADER, FragmentShaderSource));
+        ASSERT_FALSE(mContext->linkProgram(program).isError());
+        ASSERT_TRUE(mContext->getProgram(program)->isLinked());
+        mContext->useProgram(program);
+
+        mColorLocation = mContext->getState().getCurrentProgramBinary()->getUniformLocation("color");
+        ASSERT_NE(-1, mColorLocation);
+
+        // The first draw applies everything
+        draw();
+        mRenderer.resetCounts();
+    }
+
+    virtual void TearDown()
+    {
+        gl::makeCurrent(NULL, NULL, NULL);
+        SafeDelete(mContext);
+    }
+
+    bool attachShader(GLuint program, GLenum type, const char *source)
+    {
+        gl::Shader *shader = mContext->getShader(mContext->createShader(type));
+        shader->setSource(1, &source, NULL);
+        shader->compile();
+        return shader->isCompiled() && mContext->getProgram(program)->attachShader(shader);
+    }
+
+    void draw()
+    {
+        ASSERT_FALSE(mContext->drawArrays(GL_TRIANGLES, 0, 3, 0).isError());
+    }
+
+    void setColor(float value)
+    {
+        const GLfloat color[] = { value, value, value, 1.0f };
+        mContext->getState().getCurrentProgramBinary()->setUniform4fv(mColorLocation, 1, color);
+    }
+
+    // Draws once, and returns what the draw applied
+    ApplyCounts drawAndCount()
+    {
+        mRenderer.resetCounts();
+        draw();
+        return mRenderer.getCounts();
+    }
+
+    CountingNullRenderer mRenderer;
+    gl::Context *mContext;
+    GLint mColorLocation;
+};
+
+TEST_F(NullRendererStateApplyTest, UniformOnlyDrawsApplyNoState)
+{
+    for (int i = 0; i < 16; i++)
+    {
+        setColor(i / 16.0f);
+        draw();
+    }
+
+    const ApplyCounts &counts = mRenderer.getCounts();
+    EXPECT_EQ(0u, counts.rasterizerState);
+    EXPECT_EQ(0u, counts.blendState);
+    EXPECT_EQ(0u, counts.depthStencilState);
+    EXPECT_EQ(0u, counts.viewport);
+    EXPECT_EQ(0u, counts.scissorRectangle);
+    EXPECT_EQ(0u, counts.texture);
+}
+
+TEST_F(NullRendererStateApplyTest, RasterizerSetterAppliesOnlyRasterizerState)
+{
+    mContext->getState().setCullFace(true);
+
+    ApplyCounts counts = drawAndCount();
+    EXPECT_EQ(1u, counts.rasterizerState);
+    EXPECT_EQ(0u, counts.blendState);
+    EXPECT_EQ(0u, counts.depthStencilState);
+    EXPECT_EQ(0u, counts.viewport);
+    EXPECT_EQ(0u, counts.scissorRectangle);
+    EXPECT_EQ(0u, counts.texture);
+}
+
+TEST_F(NullRendererStateApplyTest, BlendSetterAppliesOnlyBlendState)
+{
+    mContext->getState().setBlendColor(1.0f, 0.5f, 0.25f, 1.0f);
+
+    ApplyCounts counts = drawAndCount();
+    EXPECT_EQ(0u, counts.rasterizerState);
+    EXPECT_EQ(1u, counts.blendState);
+    EXPECT_EQ(0u, counts.depthStencilState);
+    EXPECT_EQ(0u, counts.viewport);
+    EXPECT_EQ(0u, counts.scissorRectangle);
+    EXPECT_EQ(0u, counts.texture);
+}
+
+TEST_F(NullRendererStateApplyTest, DepthStencilSetterAppliesOnlyDepthStencilState)
+{
+    mContext->getState().setDepthFunc(GL_LEQUAL);
+
+    ApplyCounts counts = drawAndCount();
+    EXPECT_EQ(0u, counts.rasterizerState);
+    EXPECT_EQ(0u, counts.blendState);
+    EXPECT_EQ(1u, counts.depthStencilState);
+    EXPECT_EQ(0u, counts.viewport);
+    EXPECT_EQ(0u, counts.scissorRectangle);
+    EXPECT_EQ(0u, counts.texture);
+}
+
+TEST_F(NullRendererStateApplyTest, ViewportSetterAppliesOnlyViewport)
+{
+    mContext->getState().setViewportParams(0, 0, 8, 8);
+
+    ApplyCounts counts = drawAndCount();
+    EXPECT_EQ(0u, counts.rasterizerState);
+    EXPECT_EQ(0u, counts.blendState);
+    EXPECT_EQ(0u, counts.depthStencilState);
+    EXPECT_EQ(1u, counts.viewport);
+    EXPECT_EQ(0u, counts.scissorRectangle);
+    EXPECT_EQ(0u, counts.texture);
+}
+
+TEST_F(NullRendererStateApplyTest, ScissorSetterAppliesOnlyScissorRectangle)
+{
+    mContext->getState().setScissorParams(0, 0, 8, 8);
+
+    ApplyCounts counts = drawAndCount();
+    EXPECT_EQ(0u, counts.rasterizerState);
+    EXPECT_EQ(0u, counts.blendState);
+    EXPECT_EQ(0u, counts.depthStencilState);
+    EXPECT_EQ(0u, counts.viewport);
+    EXPECT_EQ(1u, counts.scissorRectangle);
+    EXPECT_EQ(0u, counts.texture);
+}
+
+TEST_F(NullRendererStateApplyTest, TextureBindingAppliesOnlyItsSampler)
+{
+    mContext->bindTexture(GL_TEXTURE_2D, mContext->createTexture());
+
+    ApplyCounts counts = drawAndCount();
+    EXPECT_EQ(0u, counts.rasterizerState);
+    EXPECT_EQ(0u, counts.blendState);
+    EXPECT_EQ(0u, counts.depthStencilState);
+    EXPECT_EQ(0u, counts.viewport);
+    EXPECT_EQ(0u, counts.scissorRectangle);
+    EXPECT_EQ(1u, counts.texture);
+}
+
+}
@@ -0,0 +1,311 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "common/cpufeatures.h"
+#include "common/mathutil.h"
+#include "common/packedfloat.h"
+
+#include <vector>
+
+namespace
+{
+
+uint32_t FloatBits(float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+float BitsFloat(uint32_t bits)
+{
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+typedef void (*ConvertFloat32ToPackedFunction)(const float *, uint32_t *, size_t);
+typedef void (*ConvertPackedToFloat32Function)(const uint32_t *, float *, size_t);
+
+struct PackedFloatConverters
+{
+    const char *name;
+    ConvertFloat32ToPackedFunction toRGB9E5;
+    ConvertPackedToFloat32Function fromRGB9E5;
+    ConvertFloat32ToPackedFunction toR11G11B10F;
+    ConvertPackedToFloat32Function fromR11G11B10F;
+};
+
+std::ostream &operator<<(std::ostream &stream, const PackedFloatConverters &converters)
+{
+    return stream << converters.name;
+}
+
+class PackedFloatConversionTest : public testing::TestWithParam<PackedFloatConverters>
+{
+  protected:
+    virtual void SetUp()
+    {
+        const gl::CPUFeatures &features = gl::GetCPUFeatures();
+        mSupported = (GetParam().toRGB9E5 != gl::ConvertFloat32ToRGB9E5SSE2 || features.sse2) &&
+                     (GetParam().toRGB9E5 != gl::ConvertFloat32ToRGB9E5AVX2 || features.avx2);
+    }
+
+    bool mSupported;
+};
+
+// Floats of every exponent with a spread of mantissas and both signs, and
+// the special values, in all three channels of the pixels.
+std::vector<float> TestFloats()
+{
+    std::vector<float> values;
+    for (uint32_t exponent = 0; exponent < 256; exponent++)
+    {
+        for (uint32_t mantissa = 0; mantissa < (1 << 23); mantissa += 4093)
+        {
+            values.push_back(BitsFloat((exponent << 23) | mantissa));
+            values.push_back(BitsFloat(0x80000000 | (exponent << 23) | mantissa));
+        }
+
+        // Around the rounding points of the 5 and 6 bit mantissas
+        for (uint32_t mantissa = 0; mantissa < (1 << 23); mantissa += (1 << 17))
+        {
+            values.push_back(BitsFloat((exponent << 23) | (mantissa + 0xFFFF)));
+            values.push_back(BitsFloat((exponent << 23) | (mantissa + 0x10000)));
+            values.push_back(BitsFloat((exponent << 23) | (mantissa + 0x10001)));
+            values.push_back(BitsFloat((exponent << 23) | (mantissa + 0x20000)));
+        }
+    }
+
+    const float specials[] =
+    {
+        0.0f, -0.0f, 1.0f, 65408.0f, 65409.0f, 65024.0f, 65535.0f, 1.0e10f,
+        BitsFloat(0x477E0000), BitsFloat(0x477E0001), BitsFloat(0x477C0000), BitsFloat(0x477C0001),
+        BitsFloat(0x38800000), BitsFloat(0x387FFFFF), BitsFloat(0x37800000), BitsFloat(0x00000001),
+        BitsFloat(0x7F800000), BitsFloat(0xFF800000), BitsFloat(0x7FC00000), BitsFloat(0xFFC00000),
+        BitsFloat(0x7F800001), BitsFloat(0x7FA12345), BitsFloat(0xFFFFFFFF),
+    };
+    values.insert(values.end(), specials, specials + ArraySize(specials));
+
+    // Each value in each channel, next to the values around it
+    std::vector<float> pixels;
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        pixels.push_back(values[i]);
+        pixels.push_back(values[(i * 7 + 1) % values.size()]);
+        pixels.push_back(values[(i * 13 + 2) % values.size()]);
+    }
+    return pixels;
+}
+
+// Each converter gives the same bits as the scalar functions in mathutil.h.
+TEST_P(PackedFloatConversionTest, EncodeMatchesScalar)
+{
+    if (!mSupported)
+    {
+        return;
+    }
+
+    std::vector<float> floats = TestFloats();
+    const size_t count = floats.size() / 3;
+    std::vector<uint32_t> rgb9e5(count);
+    std::vector<uint32_t> r11g11b10f(count);
+    GetParam().toRGB9E5(&floats[0], &rgb9e5[0], count);
+    GetParam().toR11G11B10F(&floats[0], &r11g11b10f[0], count);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const float *pixel = &floats[i * 3];
+        ASSERT_EQ(gl::convertRGBFloatsTo999E5(pixel[0], pixel[1], pixel[2]), rgb9e5[i])
+            << std::hex << FloatBits(pixel[0]) << " " << FloatBits(pixel[1]) << " " << FloatBits(pixel[2]);
+
+        uint32_t expected = (gl::float32ToFloat11(pixel[0]) << 0) | (gl::float32ToFloat11(pixel[1]) << 11) |
+                            (gl::float32ToFloat10(pixel[2]) << 22);
+        ASSERT_EQ(expected, r11g11b10f[i])
+            << std::hex << FloatBits(pixel[0]) << " " << FloatBits(pixel[1]) << " " << FloatBits(pixel[2]);
+    }
+}
+
+// Every R11G11B10F value of each channel, and every RGB9E5 exponent with
+// every value of each channel.
+TEST_P(PackedFloatConversionTest, DecodeAllValues)
+{
+    if (!mSupported)
+    {
+        return;
+    }
+
+    std::vector<uint32_t> packed;
+    for (uint32_t value = 0; value < (1 << 11); value++)
+    {
+        packed.push_back(value | (((value * 5) & 0x7FF) << 11) | ((value & 0x3FF) << 22));
+    }
+    std::vector<float> floats(packed.size() * 3);
+    GetParam().fromR11G11B10F(&packed[0], &floats[0], packed.size());
+    for (size_t i = 0; i < packed.size(); i++)
+    {
+        ASSERT_EQ(FloatBits(gl::float11ToFloat32((packed[i] >> 0) & 0x7FF)), FloatBits(floats[i * 3 + 0])) << std::hex << packed[i];
+        ASSERT_EQ(FloatBits(gl::float11ToFloat32((packed[i] >> 11) & 0x7FF)), FloatBits(floats[i * 3 + 1])) << std::hex << packed[i];
+        ASSERT_EQ(FloatBits(gl::float10ToFloat32((packed[i] >> 22) & 0x3FF)), FloatBits(floats[i * 3 + 2])) << std::hex << packed[i];
+    }
+
+    packed.clear();
+    for (uint32_t exponent = 0; exponent < 32; exponent++)
+    {
+        for (uint32_t value = 0; value < (1 << 9); value++)
+        {
+            packed.push_back(value | (((value * 3) & 0x1FF) << 9) | (((value * 7 + 1) & 0x1FF) << 18) | (exponent << 27));
+        }
+    }
+    floats.resize(packed.size() * 3);
+    GetParam().fromRGB9E5(&packed[0], &floats[0], packed.size());
+    for (size_t i = 0; i < packed.size(); i++)
+    {
+        float expected[3];
+        gl::convert999E5toRGBFloats(packed[i], &expected[0], &expected[1], &expected[2]);
+        ASSERT_EQ(FloatBits(expected[0]), FloatBits(floats[i * 3 + 0])) << std::hex << packed[i];
+        ASSERT_EQ(FloatBits(expected[1]), FloatBits(floats[i * 3 + 1])) << std::hex << packed[i];
+        ASSERT_EQ(FloatBits(expected[2]), FloatBits(floats[i * 3 + 2])) << std::hex << packed[i];
+    }
+}
+
+// Decoding and encoding again gives back every finite R11G11B10F value, and
+// RGB9E5 values that use the smallest exponent that fits their channels.
+TEST_P(PackedFloatConversionTest, RoundTrips)
+{
+    if (!mSupported)
+    {
+        return;
+    }
+
+    std::vector<uint32_t> packed;
+    for (uint32_t value = 0; value < (1 << 11); value++)
+    {
+        if ((value >> 6) != 0x1F)
+        {
+            packed.push_back(value | (((value * 5) & 0x7BF) << 11) | ((value & 0x3DF) << 22));
+        }
+    }
+    std::vector<float> floats(packed.size() * 3);
+    std::vector<uint32_t> result(packed.size());
+    GetParam().fromR11G11B10F(&packed[0], &floats[0], packed.size());
+    GetParam().toR11G11B10F(&floats[0], &result[0], packed.size());
+    EXPECT_EQ(packed, result);
+
+    // Channels that need no rounding at the exponent of the largest one
+    const float exact[] =
+    {
+        4.0f, 100.0f, 1000.0f,
+        65408.0f, 0.0f, 0.0f,
+        1.0f / 65536.0f, 511.0f / (1 << 24), 0.0f,
+    };
+    std::vector<float> expected(exact, exact + ArraySize(exact));
+    std::vector<uint32_t> rgb9e5(expected.size() / 3);
+    std::vector<float> decoded(expected.size());
+    GetParam().toRGB9E5(&expected[0], &rgb9e5[0], rgb9e5.size());
+    GetParam().fromRGB9E5(&rgb9e5[0], &decoded[0], rgb9e5.size());
+    EXPECT_EQ(expected, decoded);
+}
+
+TEST_P(PackedFloatConversionTest, SpecialValues)
+{
+    if (!mSupported)
+    {
+        return;
+    }
+
+    const float infinity = std::numeric_limits<float>::infinity();
+    const float floats[] =
+    {
+        1.0f, 0.5f, 2.0f,
+        -1.0f, infinity, -infinity,
+        1.0e10f, 65024.0f, BitsFloat(0x7FC00000),
+        1.0f / 65536.0f, 1.0f / (1 << 20), 0.0f,
+    };
+    const uint32_t expectedRGB9E5[] =
+    {
+        // 2.0 needs exponent 17, where 1.0 is 128
+        (17u << 27) | (256 << 18) | (64 << 9) | 128,
+        // Infinity clamps to the largest value, the rest to zero
+        (31u << 27) | (511 << 9),
+        // So do values that are too large, and NaNs
+        (31u << 27) | (511 << 18) | (508 << 9) | 511,
+        // The smallest exponent, 2^-24 per step
+        (16 << 9) | 256,
+    };
+    const uint32_t expectedR11G11B10F[] =
+    {
+        (0x200u << 22) | (0x380 << 11) | 0x3C0,
+        (0x000u << 22) | (0x7C0 << 11) | 0x000,
+        (0x3F0u << 22) | (0x7BF << 11) | 0x7BF,
+        (0x000u << 22) | (0x001 << 11) | 0x010,
+    };
+    const size_t count = ArraySize(expectedRGB9E5);
+
+    uint32_t result[count];
+    GetParam().toRGB9E5(floats, result, count);
+    for (size_t i = 0; i < count; i++)
+    {
+        EXPECT_EQ(expectedRGB9E5[i], result[i]) << i;
+    }
+    GetParam().toR11G11B10F(floats, result, count);
+    for (size_t i = 0; i < count; i++)
+    {
+        EXPECT_EQ(expectedR11G11B10F[i], result[i]) << i;
+    }
+}
+
+// The vectorized versions handle any count.
+TEST_P(PackedFloatConversionTest, OddCounts)
+{
+    if (!mSupported)
+    {
+        return;
+    }
+
+    std::vector<float> floats(64 * 3);
+    for (size_t i = 0; i < floats.size(); i++)
+    {
+        floats[i] = static_cast<float>(i) * 3.7f - 50.0f;
+    }
+
+    for (size_t count = 0; count < 64; count++)
+    {
+        std::vector<uint32_t> expected(count + 2, 0xCDCDCDCD);
+        std::vector<uint32_t> actual(count + 2, 0xCDCDCDCD);
+        gl::ConvertFloat32ToRGB9E5Portable(&floats[0], &expected[1], count);
+        GetParam().toRGB9E5(&floats[0], &actual[1], count);
+        ASSERT_EQ(expected, actual) << count;
+
+        std::vector<float> expectedFloats(count * 3 + 2, -1.0f);
+        std::vector<float> actualFloats(count * 3 + 2, -1.0f);
+        gl::ConvertRGB9E5ToFloat32Portable(&expected[1], &expectedFloats[1], count);
+        GetParam().fromRGB9E5(&expected[1], &actualFloats[1], count);
+        ASSERT_EQ(expectedFloats, actualFloats) << count;
+
+        gl::ConvertFloat32ToR11G11B10FPortable(&floats[0], &expected[1], count);
+        GetParam().toR11G11B10F(&floats[0], &actual[1], count);
+        ASSERT_EQ(expected, actual) << count;
+
+        gl::ConvertR11G11B10FToFloat32Portable(&expected[1], &expectedFloats[1], count);
+        GetParam().fromR11G11B10F(&expected[1], &actualFloats[1], count);
+        ASSERT_EQ(expectedFloats, actualFloats) << count;
+    }
+}
+
+const PackedFloatConverters kConverters[] =
+{
+    { "Default", gl::ConvertFloat32ToRGB9E5, gl::ConvertRGB9E5ToFloat32, gl::ConvertFloat32ToR11G11B10F, gl::ConvertR11G11B10FToFloat32 },
+    { "Portable", gl::ConvertFloat32ToRGB9E5Portable, gl::ConvertRGB9E5ToFloat32Portable, gl::ConvertFloat32ToR11G11B10FPortable, gl::ConvertR11G11B10FToFloat32Portable },
+    { "SSE2", gl::ConvertFloat32ToRGB9E5SSE2, gl::ConvertRGB9E5ToFloat32SSE2, gl::ConvertFloat32ToR11G11B10FSSE2, gl::ConvertR11G11B10FToFloat32SSE2 },
+    { "AVX2", gl::ConvertFloat32ToRGB9E5AVX2, gl::ConvertRGB9E5ToFloat32AVX2, gl::ConvertFloat32ToR11G11B10FAVX2, gl::ConvertR11G11B10FToFloat32AVX2 },
+};
+
+INSTANTIATE_TEST_CASE_P(AllVersions, PackedFloatConversionTest, testing::ValuesIn(kConverters));
+
+}
@@ -0,0 +1,272 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "gtest/gtest.h"
+#include "libGLESv2/ProgramCache.h"
+#include "libGLESv2/BinaryStream.h"
+
+#if defined(ANGLE_PLATFORM_POSIX)
+#include <stdlib.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+
+std::vector<uint8_t> MakeData(size_t length, uint8_t seed)
+{
+    std::vector<uint8_t> data(length);
+    for (size_t i = 0; i < length; i++)
+    {
+        data[i] = static_cast<uint8_t>(seed + i * 7);
+    }
+    return data;
+}
+
+void Put(gl::ProgramCacheStore *store, uint64_t key, const std::vector<uint8_t> &data)
+{
+    store->put(key, &data[0], data.size());
+}
+
+bool Contains(gl::ProgramCacheStore *store, uint64_t key, const std::vector<uint8_t> &data)
+{
+    std::vector<uint8_t> found;
+    return store->get(key, &found) && found == data;
+}
+
+TEST(ProgramCacheTest, MemoryStoreGetsWhatWasPut)
+{
+    gl::MemoryProgramCacheStore store(1024);
+    std::vector<uint8_t> first = MakeData(100, 1);
+    std::vector<uint8_t> second = MakeData(200, 2);
+
+    std::vector<uint8_t> found;
+    EXPECT_FALSE(store.get(1, &found));
+
+    Put(&store, 1, first);
+    Put(&store, 2, second);
+    EXPECT_TRUE(Contains(&store, 1, first));
+    EXPECT_TRUE(Contains(&store, 2, second));
+    EXPECT_FALSE(store.get(3, &found));
+    EXPECT_EQ(300u, store.size());
+
+    // Putting a key again replaces its entry
+    Put(&store, 1, second);
+    EXPECT_TRUE(Contains(&store, 1, second));
+    EXPECT_EQ(400u, store.size());
+}
+
+TEST(ProgramCacheTest, MemoryStoreEvictsLeastRecentlyUsed)
+{
+    gl::MemoryProgramCacheStore store(300);
+    std::vector<uint8_t> data = MakeData(100, 3);
+
+    Put(&store, 1, data);
+    Put(&store, 2, data);
+    Put(&store, 3, data);
+
+    // Using the first entry makes the second the oldest
+    EXPECT_TRUE(Contains(&store, 1, data));
+    Put(&store, 4, data);
+
+    EXPECT_EQ(300u, store.size());
+    EXPECT_TRUE(Contains(&store, 1, data));
+    EXPECT_FALSE(Contains(&store, 2, data));
+    EXPECT_TRUE(Contains(&store, 3, data));
+    EXPECT_TRUE(Contains(&store, 4, data));
+
+    // Entries larger than the whole store are not kept
+    Put(&store, 5, MakeData(301, 4));
+    std::vector<uint8_t> found;
+    EXPECT_FALSE(store.get(5, &found));
+    EXPECT_EQ(300u, store.size());
+}
+
+#if !defined(ANGLE_ENABLE_WINDOWS_STORE)
+
+class DirectoryProgramCacheStoreTest : public testing::Test
+{
+  protected:
+    virtual void SetUp()
+    {
+#if defined(ANGLE_PLATFORM_WINDOWS)
+        char tempPath[MAX_PATH];
+        ASSERT_NE(0u, GetTempPathA(MAX_PATH, tempPath));
+        mDirectory = std::string(tempPath) + FormatString("angle_program_cache_%lu", GetCurrentProcessId());
+        ASSERT_NE(FALSE, CreateDirectoryA(mDirectory.c_str(), NULL));
+#else
+        char directory[] = "/tmp/angle_program_cache_XXXXXX";
+        ASSERT_NE(static_cast<char*>(NULL), mkdtemp(directory));
+        mDirectory = directory;
+#endif
+    }
+
+    virtual void TearDown()
+    {
+        // A store with no room deletes every entry it finds
+        gl::DirectoryProgramCacheStore emptyStore(mDirectory, 0);
+
+#if defined(ANGLE_PLATFORM_WINDOWS)
+        RemoveDirectoryA(mDirectory.c_str());
+#else
+        rmdir(mDirectory.c_str());
+#endif
+    }
+
+    std::string mDirectory;
+};
+
+TEST_F(DirectoryProgramCacheStoreTest, EntriesOutliveTheStore)
+{
+    std::vector<uint8_t> first = MakeData(100, 5);
+    std::vector<uint8_t> second = MakeData(50, 6);
+
+    {
+        gl::DirectoryProgramCacheStore store(mDirectory, 1024);
+        Put(&store, 1, first);
+        Put(&store, 0xFEDCBA9876543210ull, second);
+        EXPECT_TRUE(Contains(&store, 1, first));
+        EXPECT_EQ(150u, store.size());
+    }
+
+    gl::DirectoryProgramCacheStore store(mDirectory, 1024);
+    EXPECT_EQ(150u, store.size());
+    EXPECT_TRUE(Contains(&store, 1, first));
+    EXPECT_TRUE(Contains(&store, 0xFEDCBA9876543210ull, second));
+
+    std::vector<uint8_t> found;
+    EXPECT_FALSE(store.get(2, &found));
+}
+
+TEST_F(DirectoryProgramCacheStoreTest, PutReplacesEntries)
+{
+    gl::DirectoryProgramCacheStore store(mDirectory, 1024);
+    Put(&store, 7, MakeData(100, 7));
+    Put(&store, 7, MakeData(30, 8));
+
+    EXPECT_TRUE(Contains(&store, 7, MakeData(30, 8)));
+    EXPECT_EQ(30u, store.size());
+
+    // Another store on the same directory sees the new entry
+    gl::DirectoryProgramCacheStore otherStore(mDirectory, 1024);
+    EXPECT_TRUE(Contains(&otherStore, 7, MakeData(30, 8)));
+}
+
+TEST_F(DirectoryProgramCacheStoreTest, EvictsLeastRecentlyUsed)
+{
+    gl::DirectoryProgramCacheStore store(mDirectory, 300);
+    std::vector<uint8_t> data = MakeData(100, 9);
+
+    Put(&store, 1, data);
+    Put(&store, 2, data);
+    Put(&store, 3, data);
+    EXPECT_TRUE(Contains(&store, 1, data));
+    Put(&store, 4, data);
+
+    EXPECT_EQ(300u, store.size());
+    EXPECT_TRUE(Contains(&store, 1, data));
+    EXPECT_FALSE(Contains(&store, 2, data));
+    EXPECT_TRUE(Contains(&store, 3, data));
+    EXPECT_TRUE(Contains(&store, 4, data));
+
+    // The evicted file is gone from the directory too
+    gl::DirectoryProgramCacheStore otherStore(mDirectory, 300);
+    EXPECT_EQ(300u, otherStore.size());
+    EXPECT_FALSE(Contains(&otherStore, 2, data));
+}
+
+TEST_F(DirectoryProgramCacheStoreTest, SmallerLimitEvictsOnOpen)
+{
+    {
+        gl::DirectoryProgramCacheStore store(mDirectory, 1024);
+        Put(&store, 1, MakeData(100, 10));
+        Put(&store, 2, MakeData(100, 11));
+    }
+
+    gl::DirectoryProgramCacheStore store(mDirectory, 150);
+    EXPECT_EQ(100u, store.size());
+}
+
+#endif // !ANGLE_ENABLE_WINDOWS_STORE
+
+void WriteLinkInputs(gl::BinaryOutputStream *stream, const std::string &vertexSource, const std::string &fragmentSource)
+{
+    stream->writeString(vertexSource);
+    stream->writeString(fragmentSource);
+}
+
+TEST(ProgramCacheTest, FindsProgramsWithTheSameLinkInputs)
+{
+    gl::ProgramCache cache(new gl::MemoryProgramCacheStore(1024 * 1024));
+
+    gl::BinaryOutputStream linkInputs;
+    WriteLinkInputs(&linkInputs, "vertex", "fragment");
+    gl::BinaryOutputStream binary;
+    binary.writeString("binary");
+
+    std::vector<uint8_t> found;
+    EXPECT_FALSE(cache.getProgram(linkInputs, &found));
+
+    cache.putProgram(linkInputs, binary);
+
+    gl::BinaryOutputStream sameInputs;
+    WriteLinkInputs(&sameInputs, "vertex", "fragment");
+    ASSERT_TRUE(cache.getProgram(sameInputs, &found));
+    ASSERT_EQ(binary.length(), found.size());
+    EXPECT_EQ(0, memcmp(binary.data(), &found[0], found.size()));
+
+    // Any difference in the inputs is a miss
+    gl::BinaryOutputStream otherVertex;
+    WriteLinkInputs(&otherVertex, "vertex2", "fragment");
+    EXPECT_FALSE(cache.getProgram(otherVertex, &found));
+
+    gl::BinaryOutputStream otherFragment;
+    WriteLinkInputs(&otherFragment, "vertex", "fragment ");
+    EXPECT_FALSE(cache.getProgram(otherFragment, &found));
+}
+
+// Stores every entry under the same key, as if all link inputs collided
+class CollidingProgramCacheStore : public gl::ProgramCacheStore
+{
+  public:
+    virtual bool get(uint64_t key, std::vector<uint8_t> *dataOut)
+    {
+        if (mData.empty())
+        {
+            return false;
+        }
+        *dataOut = mData;
+        return true;
+    }
+
+    virtual void put(uint64_t key, const uint8_t *data, size_t length)
+    {
+        mData.assign(data, data + length);
+    }
+
+  private:
+    std::vector<uint8_t> mData;
+};
+
+TEST(ProgramCacheTest, HashCollisionsAreMisses)
+{
+    gl::ProgramCache cache(new CollidingProgramCacheStore());
+
+    gl::BinaryOutputStream linkInputs;
+    WriteLinkInputs(&linkInputs, "vertex", "fragment");
+    gl::BinaryOutputStream binary;
+    binary.writeString("binary");
+    cache.putProgram(linkInputs, binary);
+
+    std::vector<uint8_t> found;
+    EXPECT_TRUE(cache.getProgram(linkInputs, &found));
+
+    gl::BinaryOutputStream otherInputs;
+    WriteLinkInputs(&otherInputs, "other vertex", "fragment");
+    EXPECT_FALSE(cache.getProgram(otherInputs, &found));
+}
+
+}
@@ -0,0 +1,162 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "gtest/gtest.h"
+#include "libGLESv2/ResourceMap.h"
+
+#include <map>
+
+namespace
+{
+
+struct Resource
+{
+    explicit Resource(GLuint handle) : handle(handle) { }
+    GLuint handle;
+};
+
+typedef gl::ResourceMap<Resource> TestResourceMap;
+
+// Collects what the map's iterators visit, in order
+std::map<GLuint, Resource*> GetContents(const TestResourceMap &resourceMap)
+{
+    std::map<GLuint, Resource*> contents;
+    for (TestResourceMap::const_iterator iter = resourceMap.begin(); iter != resourceMap.end(); iter++)
+    {
+        EXPECT_EQ(0u, contents.count(iter->first));
+        contents[iter->first] = iter->second;
+    }
+    return contents;
+}
+
+TEST(ResourceMapTest, EmptyMap)
+{
+    TestResourceMap resourceMap;
+    EXPECT_TRUE(resourceMap.empty());
+    EXPECT_EQ(0u, resourceMap.size());
+    EXPECT_FALSE(resourceMap.contains(0));
+    EXPECT_FALSE(resourceMap.contains(1));
+    EXPECT_EQ(NULL, resourceMap.query(1));
+    EXPECT_TRUE(resourceMap.begin() == resourceMap.end());
+
+    Resource *erased = NULL;
+    EXPECT_FALSE(resourceMap.erase(1, &erased));
+}
+
+TEST(ResourceMapTest, NamesWithoutObjectsArePresent)
+{
+    TestResourceMap resourceMap;
+    resourceMap.assign(3, NULL);
+
+    EXPECT_TRUE(resourceMap.contains(3));
+    EXPECT_EQ(NULL, resourceMap.query(3));
+    EXPECT_EQ(1u, resourceMap.size());
+
+    Resource resource(3);
+    resourceMap.assign(3, &resource);
+    EXPECT_EQ(&resource, resourceMap.query(3));
+    EXPECT_EQ(1u, resourceMap.size());
+
+    Resource *erased = NULL;
+    EXPECT_TRUE(resourceMap.erase(3, &erased));
+    EXPECT_EQ(&resource, erased);
+    EXPECT_FALSE(resourceMap.contains(3));
+    EXPECT_TRUE(resourceMap.empty());
+}
+
+TEST(ResourceMapTest, DenseNames)
+{
+    TestResourceMap resourceMap;
+    std::vector<Resource> resources;
+    for (GLuint handle = 0; handle < 1000; handle++)
+    {
+        resources.push_back(Resource(handle));
+    }
+
+    for (GLuint handle = 0; handle < 1000; handle++)
+    {
+        resourceMap.assign(handle, &resources[handle]);
+    }
+    EXPECT_EQ(1000u, resourceMap.size());
+
+    // Free every third name, as an application deleting objects would
+    for (GLuint handle = 0; handle < 1000; handle += 3)
+    {
+        Resource *erased = NULL;
+        EXPECT_TRUE(resourceMap.erase(handle, &erased));
+        EXPECT_EQ(&resources[handle], erased);
+    }
+
+    std::map<GLuint, Resource*> contents = GetContents(resourceMap);
+    EXPECT_EQ(resourceMap.size(), contents.size());
+    for (GLuint handle = 0; handle < 1000; handle++)
+    {
+        bool present = (handle % 3 != 0);
+        EXPECT_EQ(present, resourceMap.contains(handle));
+        EXPECT_EQ(present ? &resources[handle] : NULL, resourceMap.query(handle));
+        EXPECT_EQ(present ? 1u : 0u, contents.count(handle));
+    }
+}
+
+TEST(ResourceMapTest, SparseNames)
+{
+    // Names an application chose itself, spread out and past the flat table
+    const GLuint handles[] = { 1, 255, 256, 70000, 0x7FFFFFFF, 0xFFFFFFFF, 40000 };
+
+    TestResourceMap resourceMap;
+    std::vector<Resource> resources;
+    for (size_t i = 0; i < ArraySize(handles); i++)
+    {
+        resources.push_back(Resource(handles[i]));
+    }
+    for (size_t i = 0; i < ArraySize(handles); i++)
+    {
+        resourceMap.assign(handles[i], &resources[i]);
+    }
+
+    EXPECT_EQ(ArraySize(handles), resourceMap.size());
+    EXPECT_FALSE(resourceMap.contains(2));
+    EXPECT_FALSE(resourceMap.contains(70001));
+
+    std::map<GLuint, Resource*> contents = GetContents(resourceMap);
+    EXPECT_EQ(ArraySize(handles), contents.size());
+    for (size_t i = 0; i < ArraySize(handles); i++)
+    {
+        EXPECT_EQ(&resources[i], resourceMap.query(handles[i]));
+        EXPECT_EQ(&resources[i], contents[handles[i]]);
+    }
+
+    // Emptying the map one name at a time, as the destructors of its owners do
+    while (!resourceMap.empty())
+    {
+        GLuint handle = resourceMap.begin()->first;
+        Resource *erased = NULL;
+        EXPECT_TRUE(resourceMap.erase(handle, &erased));
+        EXPECT_EQ(handle, erased->handle);
+    }
+    EXPECT_EQ(0u, resourceMap.size());
+    EXPECT_TRUE(resourceMap.begin() == resourceMap.end());
+}
+
+TEST(ResourceMapTest, IterationSkipsEmptyPages)
+{
+    TestResourceMap resourceMap;
+    Resource first(5);
+    Resource last(60000);
+    resourceMap.assign(5, &first);
+    resourceMap.assign(60000, &last);
+
+    Resource *erased = NULL;
+    resourceMap.assign(30000, NULL);
+    EXPECT_TRUE(resourceMap.erase(30000, &erased));
+
+    std::map<GLuint, Resource*> contents = GetContents(resourceMap);
+    ASSERT_EQ(2u, contents.size());
+    EXPECT_EQ(&first, contents[5]);
+    EXPECT_EQ(&last, contents[60000]);
+}
+
+}
@@ -0,0 +1,36 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// SIMDLevelTest.h: Base fixture of the tests run once per SIMD level, for the
+// kernel families dispatched through common/simddispatch.h.
+
+#ifndef ANGLE_IMPLEMENTATION_UNIT_TESTS_SIMDLEVELTEST_H_
+#define ANGLE_IMPLEMENTATION_UNIT_TESTS_SIMDLEVELTEST_H_
+
+#include "gtest/gtest.h"
+#include "common/simddispatch.h"
+
+class SIMDLevelTest : public testing::TestWithParam<int>
+{
+  protected:
+    gl::SIMDLevel level() const
+    {
+        return static_cast<gl::SIMDLevel>(GetParam());
+    }
+
+    // Tests of the levels this CPU does not support return without checking anything.
+    bool isSupported() const
+    {
+        return level() <= gl::GetSIMDLevel();
+    }
+};
+
+// Runs the tests of |fixture| once for each level from |firstLevel| up.
+#define ANGLE_INSTANTIATE_SIMD_LEVEL_TEST(fixture, firstLevel) \
+    INSTANTIATE_TEST_CASE_P(AllLevels, fixture, \
+                            testing::Range(static_cast<int>(firstLevel), static_cast<int>(gl::SIMD_LEVEL_COUNT)))
+
+#endif // ANGLE_IMPLEMENTATION_UNIT_TESTS_SIMDLEVELTEST_H_
@@ -0,0 +1,363 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "gtest/gtest.h"
+#include "libGLESv2/Texture.h"
+#include "libGLESv2/renderer/Image.h"
+
+#include <algorithm>
+
+namespace
+{
+
+class FakeImage : public rx::Image
+{
+  public:
+    virtual bool isDirty() const { return false; }
+
+    virtual bool redefine(rx::Renderer *renderer, GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, bool forceRelease)
+    {
+        mTarget = target;
+        mInternalFormat = internalformat;
+        mActualFormat = internalformat;
+        mWidth = width;
+        mHeight = height;
+        mDepth = depth;
+        return true;
+    }
+
+    virtual gl::Error loadData(GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth,
+                               GLint unpackAlignment, GLint unpackRowLength, GLenum type, const void *input)
+    {
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    virtual gl::Error loadCompressedData(GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth,
+                                         const void *input)
+    {
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    virtual gl::Error copy(GLint xoffset, GLint yoffset, GLint zoffset, const gl::Rectangle &sourceArea, rx::RenderTarget *source)
+    {
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    virtual gl::Error copy(GLint xoffset, GLint yoffset, GLint zoffset, const gl::Rectangle &sourceArea,
+                           const gl::ImageIndex &sourceIndex, rx::TextureStorage *source)
+    {
+        return gl::Error(GL_NO_ERROR);
+    }
+};
+
+// Keeps the images of a 2D texture in memory, and counts how often they are looked at
+class FakeTexture2DImpl : public rx::TextureImpl
+{
+  public:
+    FakeTexture2DImpl() : imageQueries(0) { }
+
+    virtual rx::Image *getImage(int level, int layer) const
+    {
+        imageQueries++;
+        return const_cast<FakeImage*>(&mImages[level]);
+    }
+
+    virtual rx::Image *getImage(const gl::ImageIndex &index) const { return getImage(index.mipIndex, 0); }
+    virtual GLsizei getLayerCount(int level) const { return 1; }
+
+    virtual void setUsage(GLenum usage) { }
+
+    virtual gl::Error setImage(GLenum target, GLint level, GLsizei width, GLsizei height, GLsizei depth, GLenum internalFormat, GLenum format, GLenum type, const gl::PixelUnpackState &unpack, const void *pixels)
+    {
+        mImages[level].redefine(NULL, target, internalFormat, width, height, depth, false);
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    virtual gl::Error setCompressedImage(GLenum target, GLint level, GLenum format, GLsizei width, GLsizei height, GLsizei depth, GLsizei imageSize, const gl::PixelUnpackState &unpack, const void *pixels)
+    {
+        mImages[level].redefine(NULL, target, format, width, height, depth, false);
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    virtual gl::Error subImage(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const gl::PixelUnpackState &unpack, const void *pixels)
+    {
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    virtual gl::Error subImageCompressed(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const gl::PixelUnpackState &unpack, const void *pixels)
+    {
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    virtual gl::Error copyImage(GLenum target, GLint level, GLenum format, GLint x, GLint y, GLsizei width, GLsizei height, gl::Framebuffer *source)
+    {
+        mImages[level].redefine(NULL, target, format, width, height, 1, false);
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    virtual gl::Error copySubImage(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height, gl::Framebuffer *source)
+    {
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    virtual gl::Error storage(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+    {
+        for (GLsizei level = 0; level < levels; level++)
+        {
+            mImages[level].redefine(NULL, target, internalformat, std::max(1, width >> level), std::max(1, height >> level), 1, false);
+        }
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    virtual gl::Error generateMipmaps()
+    {
+        const FakeImage &baseImage = mImages[0];
+        for (int level = 1; level < gl::IMPLEMENTATION_MAX_TEXTURE_LEVELS; level++)
+        {
+            mImages[level].redefine(NULL, baseImage.getTarget(), baseImage.getInternalFormat(),
+                                    std::max(1, baseImage.getWidth() >> level), std::max(1, baseImage.getHeight() >> level), 1, false);
+        }
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    virtual void bindTexImage(egl::Surface *surface) { }
+    virtual void releaseTexImage() { }
+
+    mutable size_t imageQueries;
+
+  private:
+    FakeImage mImages[gl::IMPLEMENTATION_MAX_TEXTURE_LEVELS];
+};
+
+class SamplerCompletenessTest : public testing::Test
+{
+  protected:
+    virtual void SetUp()
+    {
+        gl::TextureCaps filterableCaps;
+        filterableCaps.texturable = true;
+        filterableCaps.filterable = true;
+        mTextureCaps.insert(GL_RGBA8, filterableCaps);
+        mTextureCaps.insert(GL_COMPRESSED_RGBA_S3TC_DXT1_EXT, filterableCaps);
+        mTextureCaps.insert(GL_DEPTH_COMPONENT16, filterableCaps);
+
+        gl::TextureCaps pointSampledCaps;
+        pointSampledCaps.texturable = true;
+        mTextureCaps.insert(GL_RGBA32F, pointSampledCaps);
+
+        mImpl = new FakeTexture2DImpl;
+        mTexture = new gl::Texture2D(mImpl, 1);
+        mTexture->addRef();
+
+        mSampler.minFilter = GL_LINEAR_MIPMAP_LINEAR;
+        mSampler.magFilter = GL_LINEAR;
+    }
+
+    virtual void TearDown()
+    {
+        mTexture->release();
+    }
+
+    void setLevel(GLint level, GLsizei size, GLenum internalFormat)
+    {
+        mTexture->setImage(level, size, size, internalFormat, GL_RGBA, GL_UNSIGNED_BYTE, gl::PixelUnpackState(), NULL);
+    }
+
+    // An 8x8 texture whose levels all exist but the last one
+    void setAllLevelsButLast()
+    {
+        setLevel(0, 8, GL_RGBA8);
+        setLevel(1, 4, GL_RGBA8);
+        setLevel(2, 2, GL_RGBA8);
+    }
+
+    bool isSamplerComplete(int clientVersion = 2)
+    {
+        return mTexture->isSamplerComplete(mSampler, mTextureCaps, mExtensions, clientVersion);
+    }
+
+    // Whether the last call to isSamplerComplete recomputed the result
+    bool wasRecomputed()
+    {
+        bool recomputed = (mImpl->imageQueries > 0);
+        mImpl->imageQueries = 0;
+        return recomputed;
+    }
+
+    gl::TextureCapsMap mTextureCaps;
+    gl::Extensions mExtensions;
+    gl::SamplerState mSampler;
+
+    FakeTexture2DImpl *mImpl;
+    gl::Texture2D *mTexture;
+};
+
+TEST_F(SamplerCompletenessTest, RepeatedQueriesAreCached)
+{
+    setAllLevelsButLast();
+    setLevel(3, 1, GL_RGBA8);
+
+    EXPECT_TRUE(isSamplerComplete());
+    EXPECT_TRUE(wasRecomputed());
+
+    for (int queryIndex = 0; queryIndex < 4; queryIndex++)
+    {
+        EXPECT_TRUE(isSamplerComplete());
+        EXPECT_FALSE(wasRecomputed());
+    }
+}
+
+TEST_F(SamplerCompletenessTest, SetImageInvalidates)
+{
+    setAllLevelsButLast();
+    EXPECT_FALSE(isSamplerComplete());
+    wasRecomputed();
+
+    setLevel(3, 1, GL_RGBA8);
+    EXPECT_TRUE(isSamplerComplete());
+    EXPECT_TRUE(wasRecomputed());
+
+    // A level of the wrong size
+    setLevel(1, 3, GL_RGBA8);
+    EXPECT_FALSE(isSamplerComplete());
+    EXPECT_TRUE(wasRecomputed());
+}
+
+TEST_F(SamplerCompletenessTest, SetCompressedImageInvalidates)
+{
+    setAllLevelsButLast();
+    setLevel(3, 1, GL_RGBA8);
+    EXPECT_TRUE(isSamplerComplete());
+    wasRecomputed();
+
+    // The level no longer has the format of the others
+    mTexture->setCompressedImage(3, GL_COMPRESSED_RGBA_S3TC_DXT1_EXT, 1, 1, 8, gl::PixelUnpackState(), NULL);
+    EXPECT_FALSE(isSamplerComplete());
+    EXPECT_TRUE(wasRecomputed());
+}
+
+TEST_F(SamplerCompletenessTest, CopyImageInvalidates)
+{
+    setAllLevelsButLast();
+    EXPECT_FALSE(isSamplerComplete());
+    wasRecomputed();
+
+    mTexture->copyImage(3, GL_RGBA8, 0, 0, 1, 1, NULL);
+    EXPECT_TRUE(isSamplerComplete());
+    EXPECT_TRUE(wasRecomputed());
+}
+
+TEST_F(SamplerCompletenessTest, StorageInvalidates)
+{
+    EXPECT_FALSE(isSamplerComplete());
+    wasRecomputed();
+
+    mTexture->storage(4, GL_RGBA8, 8, 8);
+    EXPECT_TRUE(isSamplerComplete());
+    EXPECT_TRUE(wasRecomputed());
+}
+
+TEST_F(SamplerCompletenessTest, GenerateMipmapsInvalidates)
+{
+    setLevel(0, 8, GL_RGBA8);
+    EXPECT_FALSE(isSamplerComplete());
+    wasRecomputed();
+
+    mTexture->generateMipmaps();
+    EXPECT_TRUE(isSamplerComplete());
+    EXPECT_TRUE(wasRecomputed());
+}
+
+TEST_F(SamplerCompletenessTest, SubImageKeepsResult)
+{
+    setAllLevelsButLast();
+    EXPECT_FALSE(isSamplerComplete());
+    wasRecomputed();
+
+    mTexture->subImage(0, 0, 0, 8, 8, GL_RGBA, GL_UNSIGNED_BYTE, gl::PixelUnpackState(), NULL);
+    mTexture->copySubImage(GL_TEXTURE_2D, 0, 0, 0, 0, 0, 0, 8, 8, NULL);
+    EXPECT_FALSE(isSamplerComplete());
+    EXPECT_FALSE(wasRecomputed());
+}
+
+TEST_F(SamplerCompletenessTest, MinFilterInvalidates)
+{
+    setAllLevelsButLast();
+    EXPECT_FALSE(isSamplerComplete());
+    wasRecomputed();
+
+    // Only mipmapped filtering needs the levels past the base
+    mSampler.minFilter = GL_LINEAR;
+    EXPECT_TRUE(isSamplerComplete());
+    EXPECT_TRUE(wasRecomputed());
+
+    mSampler.minFilter = GL_NEAREST_MIPMAP_NEAREST;
+    EXPECT_FALSE(isSamplerComplete());
+    EXPECT_TRUE(wasRecomputed());
+}
+
+TEST_F(SamplerCompletenessTest, MagFilterInvalidates)
+{
+    setLevel(0, 8, GL_RGBA32F);
+    mSampler.minFilter = GL_NEAREST;
+    mSampler.magFilter = GL_NEAREST;
+    EXPECT_TRUE(isSamplerComplete());
+    wasRecomputed();
+
+    // The format can only be point sampled
+    mSampler.magFilter = GL_LINEAR;
+    EXPECT_FALSE(isSamplerComplete());
+    EXPECT_TRUE(wasRecomputed());
+}
+
+TEST_F(SamplerCompletenessTest, WrapModesInvalidate)
+{
+    mExtensions.textureNPOT = false;
+    mSampler.minFilter = GL_LINEAR;
+    mSampler.wrapS = GL_CLAMP_TO_EDGE;
+    mSampler.wrapT = GL_CLAMP_TO_EDGE;
+    setLevel(0, 6, GL_RGBA8);
+    EXPECT_TRUE(isSamplerComplete());
+    wasRecomputed();
+
+    // Only clamping is allowed for non power of two sizes without the extension
+    mSampler.wrapS = GL_REPEAT;
+    EXPECT_FALSE(isSamplerComplete());
+    EXPECT_TRUE(wasRecomputed());
+
+    mSampler.wrapS = GL_CLAMP_TO_EDGE;
+    mSampler.wrapT = GL_REPEAT;
+    EXPECT_FALSE(isSamplerComplete());
+    EXPECT_TRUE(wasRecomputed());
+}
+
+TEST_F(SamplerCompletenessTest, CompareModeAndClientVersionInvalidate)
+{
+    setLevel(0, 8, GL_DEPTH_COMPONENT16);
+    mSampler.minFilter = GL_NEAREST;
+    mSampler.magFilter = GL_NEAREST;
+    EXPECT_TRUE(isSamplerComplete(3));
+    wasRecomputed();
+
+    // Depth textures are point sampled only, unless they are compared
+    mSampler.magFilter = GL_LINEAR;
+    EXPECT_FALSE(isSamplerComplete(3));
+    EXPECT_TRUE(wasRecomputed());
+
+    mSampler.compareMode = GL_COMPARE_REF_TO_TEXTURE;
+    EXPECT_TRUE(isSamplerComplete(3));
+    EXPECT_TRUE(wasRecomputed());
+
+    mSampler.compareMode = GL_NONE;
+    EXPECT_FALSE(isSamplerComplete(3));
+    EXPECT_TRUE(wasRecomputed());
+
+    // The rule is only in ES3
+    EXPECT_TRUE(isSamplerComplete(2));
+    EXPECT_TRUE(wasRecomputed());
+}
+
+}
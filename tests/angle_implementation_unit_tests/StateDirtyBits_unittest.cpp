@@ -0,0 +1,189 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "libGLESv2/State.h"
+#include "libGLESv2/Caps.h"
+
+namespace
+{
+
+class StateDirtyBitsTest : public testing::Test
+{
+  protected:
+    virtual void SetUp()
+    {
+        gl::Caps caps;
+        caps.maxDrawBuffers = 4;
+        caps.maxVertexAttributes = 16;
+        caps.maxCombinedUniformBlocks = 24;
+        caps.maxTransformFeedbackSeparateAttributes = 4;
+        caps.maxCombinedTextureImageUnits = 8;
+
+        mState.initialize(caps, 3);
+        mState.clearDirtyBits(gl::State::DIRTY_BIT_ALL);
+    }
+
+    bool anyTextureUnitDirty() const
+    {
+        for (unsigned int unit = 0; unit < 8; unit++)
+        {
+            if (mState.isTextureUnitDirty(unit))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    gl::State mState;
+};
+
+TEST(StateDirtyBitsInitTest, EverythingIsDirtyAfterInitialization)
+{
+    gl::Caps caps;
+    caps.maxCombinedTextureImageUnits = 4;
+
+    gl::State state;
+    state.initialize(caps, 2);
+
+    EXPECT_EQ(static_cast<unsigned int>(gl::State::DIRTY_BIT_ALL), state.getDirtyBits());
+    for (unsigned int unit = 0; unit < 4; unit++)
+    {
+        EXPECT_TRUE(state.isTextureUnitDirty(unit));
+    }
+}
+
+TEST_F(StateDirtyBitsTest, ClearingLeavesNothingDirty)
+{
+    EXPECT_EQ(0u, mState.getDirtyBits());
+    EXPECT_FALSE(anyTextureUnitDirty());
+}
+
+TEST_F(StateDirtyBitsTest, BlendSettersDirtyOnlyBlendState)
+{
+    mState.setBlend(true);
+    EXPECT_EQ(static_cast<unsigned int>(gl::State::DIRTY_BIT_BLEND_STATE), mState.getDirtyBits());
+
+    mState.clearDirtyBits(gl::State::DIRTY_BIT_ALL);
+    mState.setBlendFactors(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ZERO);
+    mState.setBlendColor(1.0f, 0.5f, 0.25f, 1.0f);
+    mState.setColorMask(true, false, true, false);
+    mState.setSampleCoverageParams(0.5f, true);
+    EXPECT_EQ(static_cast<unsigned int>(gl::State::DIRTY_BIT_BLEND_STATE), mState.getDirtyBits());
+}
+
+TEST_F(StateDirtyBitsTest, DepthStencilSettersDirtyOnlyDepthStencilState)
+{
+    mState.setDepthFunc(GL_LEQUAL);
+    mState.setDepthMask(false);
+    mState.setStencilParams(GL_EQUAL, 1, 0xFF);
+    mState.setStencilBackOperations(GL_KEEP, GL_INCR, GL_DECR);
+    EXPECT_EQ(static_cast<unsigned int>(gl::State::DIRTY_BIT_DEPTH_STENCIL_STATE), mState.getDirtyBits());
+}
+
+TEST_F(StateDirtyBitsTest, RasterizerSettersDirtyOnlyRasterizerState)
+{
+    mState.setCullFace(true);
+    mState.setCullMode(GL_FRONT);
+    mState.setPolygonOffsetParams(1.0f, 2.0f);
+    EXPECT_EQ(static_cast<unsigned int>(gl::State::DIRTY_BIT_RASTERIZER_STATE), mState.getDirtyBits());
+}
+
+TEST_F(StateDirtyBitsTest, FrontFaceDirtiesEverythingThatDependsOnWinding)
+{
+    mState.setFrontFace(GL_CW);
+    EXPECT_EQ(static_cast<unsigned int>(gl::State::DIRTY_BIT_RASTERIZER_STATE |
+                                        gl::State::DIRTY_BIT_DEPTH_STENCIL_STATE |
+                                        gl::State::DIRTY_BIT_VIEWPORT),
+              mState.getDirtyBits());
+}
+
+TEST_F(StateDirtyBitsTest, ScissorAndViewportSetters)
+{
+    mState.setScissorParams(1, 2, 3, 4);
+    EXPECT_EQ(static_cast<unsigned int>(gl::State::DIRTY_BIT_SCISSOR), mState.getDirtyBits());
+
+    mState.clearDirtyBits(gl::State::DIRTY_BIT_ALL);
+    mState.setScissorTest(true);
+    EXPECT_EQ(static_cast<unsigned int>(gl::State::DIRTY_BIT_SCISSOR | gl::State::DIRTY_BIT_RASTERIZER_STATE),
+              mState.getDirtyBits());
+
+    mState.clearDirtyBits(gl::State::DIRTY_BIT_ALL);
+    mState.setViewportParams(0, 0, 64, 64);
+    mState.setDepthRange(0.25f, 0.75f);
+    EXPECT_EQ(static_cast<unsigned int>(gl::State::DIRTY_BIT_VIEWPORT), mState.getDirtyBits());
+}
+
+TEST_F(StateDirtyBitsTest, StateNotAppliedByDrawsDirtiesNothing)
+{
+    mState.setClearColor(1.0f, 1.0f, 1.0f, 1.0f);
+    mState.setClearDepth(0.5f);
+    mState.setClearStencil(3);
+    mState.setLineWidth(2.0f);
+    mState.setGenerateMipmapHint(GL_NICEST);
+    mState.setActiveSampler(2);
+    mState.setUnpackAlignment(1);
+    EXPECT_EQ(0u, mState.getDirtyBits());
+    EXPECT_FALSE(anyTextureUnitDirty());
+}
+
+TEST_F(StateDirtyBitsTest, TextureBindingsAreTrackedPerUnit)
+{
+    mState.setActiveSampler(3);
+    mState.setSamplerTexture(GL_TEXTURE_2D, NULL);
+    EXPECT_EQ(static_cast<unsigned int>(gl::State::DIRTY_BIT_TEXTURE_BINDINGS), mState.getDirtyBits());
+    EXPECT_TRUE(mState.isTextureUnitDirty(3));
+    EXPECT_FALSE(mState.isTextureUnitDirty(0));
+    EXPECT_FALSE(mState.isTextureUnitDirty(2));
+
+    mState.setSamplerBinding(5, NULL);
+    EXPECT_TRUE(mState.isTextureUnitDirty(5));
+    EXPECT_FALSE(mState.isTextureUnitDirty(4));
+
+    mState.clearDirtyBits(gl::State::DIRTY_BIT_TEXTURE_BINDINGS);
+    EXPECT_EQ(0u, mState.getDirtyBits());
+    EXPECT_FALSE(anyTextureUnitDirty());
+}
+
+TEST_F(StateDirtyBitsTest, SettingTextureBindingsDirtiesEveryUnit)
+{
+    mState.setDirtyBits(gl::State::DIRTY_BIT_TEXTURE_BINDINGS);
+    for (unsigned int unit = 0; unit < 8; unit++)
+    {
+        EXPECT_TRUE(mState.isTextureUnitDirty(unit));
+    }
+}
+
+TEST_F(StateDirtyBitsTest, ClearingOneGroupKeepsTheOthers)
+{
+    mState.setBlend(true);
+    mState.setDepthTest(true);
+    mState.setActiveSampler(1);
+    mState.setSamplerTexture(GL_TEXTURE_CUBE_MAP, NULL);
+
+    mState.clearDirtyBits(gl::State::DIRTY_BIT_BLEND_STATE);
+    EXPECT_EQ(static_cast<unsigned int>(gl::State::DIRTY_BIT_DEPTH_STENCIL_STATE | gl::State::DIRTY_BIT_TEXTURE_BINDINGS),
+              mState.getDirtyBits());
+    EXPECT_TRUE(mState.isTextureUnitDirty(1));
+}
+
+TEST_F(StateDirtyBitsTest, ProgramAndFramebufferBindings)
+{
+    mState.setCurrentProgramBinary(NULL);
+    EXPECT_EQ(static_cast<unsigned int>(gl::State::DIRTY_BIT_PROGRAM_BINDING), mState.getDirtyBits());
+
+    mState.clearDirtyBits(gl::State::DIRTY_BIT_ALL);
+    mState.setDrawFramebufferBinding(NULL);
+    EXPECT_EQ(static_cast<unsigned int>(gl::State::DIRTY_BIT_DRAW_FRAMEBUFFER_BINDING), mState.getDirtyBits());
+
+    mState.clearDirtyBits(gl::State::DIRTY_BIT_ALL);
+    mState.setReadFramebufferBinding(NULL);
+    EXPECT_EQ(0u, mState.getDirtyBits());
+}
+
+}
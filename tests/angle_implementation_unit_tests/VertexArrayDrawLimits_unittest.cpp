@@ -0,0 +1,172 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "libGLESv2/VertexArray.h"
+#include "libGLESv2/Buffer.h"
+#include "libGLESv2/renderer/BufferImpl.h"
+#include "libGLESv2/renderer/VertexArrayImpl.h"
+
+#include <limits>
+
+namespace
+{
+
+class MockVertexArrayImpl : public rx::VertexArrayImpl
+{
+  public:
+    MOCK_METHOD1(setElementArrayBuffer, void(const gl::Buffer *buffer));
+    MOCK_METHOD2(setAttribute, void(size_t idx, const gl::VertexAttribute &attr));
+    MOCK_METHOD2(setAttributeDivisor, void(size_t idx, GLuint divisor));
+    MOCK_METHOD2(enableAttribute, void(size_t idx, bool enabledState));
+};
+
+class MockBufferImpl : public rx::BufferImpl
+{
+  public:
+    MockBufferImpl()
+    {
+        ON_CALL(*this, setData(testing::_, testing::_, testing::_)).WillByDefault(testing::Return(gl::Error(GL_NO_ERROR)));
+    }
+
+    MOCK_METHOD3(setData, gl::Error(const void *data, size_t size, GLenum usage));
+    MOCK_METHOD3(setSubData, gl::Error(const void *data, size_t size, size_t offset));
+    MOCK_METHOD4(copySubData, gl::Error(rx::BufferImpl *source, GLintptr sourceOffset, GLintptr destOffset, GLsizeiptr size));
+    MOCK_METHOD4(map, gl::Error(size_t offset, size_t length, GLbitfield access, GLvoid **mapPtr));
+    MOCK_METHOD0(unmap, gl::Error());
+    MOCK_METHOD0(markTransformFeedbackUsage, void());
+};
+
+const GLint64 kNoLimit = std::numeric_limits<GLint64>::max();
+
+class VertexArrayDrawLimitsTest : public testing::Test
+{
+  protected:
+    virtual void SetUp()
+    {
+        mVertexArray = new gl::VertexArray(new testing::NiceMock<MockVertexArrayImpl>(), 1, gl::MAX_VERTEX_ATTRIBS);
+
+        mBuffer = new gl::Buffer(new testing::NiceMock<MockBufferImpl>(), 1);
+        mBuffer->addRef();
+        mBuffer->bufferData(NULL, 64, GL_STATIC_DRAW);
+
+        // Only the first two attributes are read by the program
+        for (int attributeIndex = 0; attributeIndex < gl::MAX_VERTEX_ATTRIBS; attributeIndex++)
+        {
+            mSemanticIndexes[attributeIndex] = (attributeIndex < 2 ? attributeIndex : -1);
+        }
+        mProgramSerial = 1;
+    }
+
+    virtual void TearDown()
+    {
+        SafeDelete(mVertexArray);
+        mBuffer->release();
+    }
+
+    void setFloatAttribute(unsigned int attributeIndex, GLint size, gl::Buffer *buffer, const void *pointer)
+    {
+        mVertexArray->setAttributeState(attributeIndex, buffer, size, GL_FLOAT, false, false, 0, pointer);
+        mVertexArray->enableAttribute(attributeIndex, true);
+    }
+
+    const gl::VertexArrayDrawLimits &getDrawLimits()
+    {
+        return mVertexArray->getDrawLimits(mProgramSerial, mSemanticIndexes);
+    }
+
+    gl::VertexArray *mVertexArray;
+    gl::Buffer *mBuffer;
+    int mSemanticIndexes[gl::MAX_VERTEX_ATTRIBS];
+    unsigned int mProgramSerial;
+};
+
+TEST_F(VertexArrayDrawLimitsTest, NoEnabledAttributesAreUnlimited)
+{
+    const gl::VertexArrayDrawLimits &limits = getDrawLimits();
+    EXPECT_FALSE(limits.missingData);
+    EXPECT_EQ(kNoLimit, limits.maxVertexCount);
+    EXPECT_EQ(kNoLimit, limits.maxInstanceCount);
+}
+
+TEST_F(VertexArrayDrawLimitsTest, VertexCountIsLimitedByTheSmallestBuffer)
+{
+    // 64 bytes hold 4 vec4s and 8 vec2s
+    setFloatAttribute(0, 4, mBuffer, NULL);
+    setFloatAttribute(1, 2, mBuffer, NULL);
+
+    EXPECT_EQ(4, getDrawLimits().maxVertexCount);
+    EXPECT_EQ(kNoLimit, getDrawLimits().maxInstanceCount);
+}
+
+TEST_F(VertexArrayDrawLimitsTest, AttributesTheProgramDoesNotReadAreIgnored)
+{
+    setFloatAttribute(0, 2, mBuffer, NULL);
+    setFloatAttribute(5, 4, mBuffer, NULL);
+    setFloatAttribute(6, 4, NULL, NULL);
+
+    EXPECT_FALSE(getDrawLimits().missingData);
+    EXPECT_EQ(8, getDrawLimits().maxVertexCount);
+}
+
+TEST_F(VertexArrayDrawLimitsTest, EnabledAttributeWithoutDataIsReported)
+{
+    GLfloat clientData[4] = { 0.0f };
+    setFloatAttribute(0, 4, NULL, clientData);
+    EXPECT_FALSE(getDrawLimits().missingData);
+    EXPECT_EQ(kNoLimit, getDrawLimits().maxVertexCount);
+
+    setFloatAttribute(1, 4, NULL, NULL);
+    EXPECT_TRUE(getDrawLimits().missingData);
+
+    mVertexArray->enableAttribute(1, false);
+    EXPECT_FALSE(getDrawLimits().missingData);
+}
+
+TEST_F(VertexArrayDrawLimitsTest, InstancedAttributesLimitTheInstanceCount)
+{
+    // 4 elements with a divisor of 3 last until instance 14, the 15th needs a fifth element
+    setFloatAttribute(0, 4, mBuffer, NULL);
+    mVertexArray->setVertexAttribDivisor(0, 3);
+
+    EXPECT_EQ(kNoLimit, getDrawLimits().maxVertexCount);
+    EXPECT_EQ(14, getDrawLimits().maxInstanceCount);
+}
+
+TEST_F(VertexArrayDrawLimitsTest, ChangingTheAttributesRecomputesTheLimits)
+{
+    setFloatAttribute(0, 4, mBuffer, NULL);
+    EXPECT_EQ(4, getDrawLimits().maxVertexCount);
+
+    setFloatAttribute(0, 1, mBuffer, NULL);
+    EXPECT_EQ(16, getDrawLimits().maxVertexCount);
+
+    mVertexArray->detachBuffer(mBuffer->id());
+    EXPECT_TRUE(getDrawLimits().missingData);
+}
+
+TEST_F(VertexArrayDrawLimitsTest, ResizingABufferRecomputesTheLimits)
+{
+    setFloatAttribute(0, 4, mBuffer, NULL);
+    EXPECT_EQ(4, getDrawLimits().maxVertexCount);
+
+    mBuffer->bufferData(NULL, 128, GL_STATIC_DRAW);
+    EXPECT_EQ(8, getDrawLimits().maxVertexCount);
+}
+
+TEST_F(VertexArrayDrawLimitsTest, ChangingTheProgramRecomputesTheLimits)
+{
+    setFloatAttribute(0, 4, mBuffer, NULL);
+    setFloatAttribute(2, 1, NULL, NULL);
+    EXPECT_FALSE(getDrawLimits().missingData);
+
+    mSemanticIndexes[2] = 2;
+    mProgramSerial++;
+    EXPECT_TRUE(getDrawLimits().missingData);
+}
+
+}
@@ -160,6 +160,11 @@ void ANGLETest::setMultisampleEnabled(bool enabled)
     mEGLWindow->setMultisample(enabled);
 }
 
+void ANGLETest::setNoErrorEnabled(bool enabled)
+{
+    mEGLWindow->setNoError(enabled);
+}
+
 int ANGLETest::getClientVersion() const
 {
     return mEGLWindow->getClientVersion();
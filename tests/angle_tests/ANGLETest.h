@@ -81,6 +81,7 @@ class ANGLETest : public testing::Test
     void setConfigDepthBits(int bits);
     void setConfigStencilBits(int bits);
     void setMultisampleEnabled(bool enabled);
+    void setNoErrorEnabled(bool enabled);
 
     int getClientVersion() const;
     int getWindowWidth() const;
@@ -201,6 +201,30 @@ TYPED_TEST(BufferDataTest, HugeSetDataShouldNotCrash)
     delete[] data;
 }
 
+// Draw validation keeps how many vertices the bound buffers hold, resizing one must be noticed
+TYPED_TEST(BufferDataTest, ResizingChangesDrawValidation)
+{
+    glUseProgram(mProgram);
+    glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * 6, NULL, GL_STATIC_DRAW);
+    glVertexAttribPointer(mAttribLocation, 1, GL_FLOAT, GL_FALSE, 0, NULL);
+    glEnableVertexAttribArray(mAttribLocation);
+
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_GL_NO_ERROR();
+
+    glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * 3, NULL, GL_STATIC_DRAW);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * 6, NULL, GL_STATIC_DRAW);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_GL_NO_ERROR();
+
+    glDisableVertexAttribArray(mAttribLocation);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
 // Use this to select which configurations (e.g. which renderer, which GLES major version) these tests should be run against.
 ANGLE_TYPED_TEST_CASE(IndexedBufferCopyTest, ES3_D3D11);
 
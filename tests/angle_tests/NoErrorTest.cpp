@@ -0,0 +1,218 @@
+#include "ANGLETest.h"
+
+// Runs every test on a validated context and on a context created with EGL_KHR_create_context_no_error
+template<typename T, bool NoError>
+struct ValidationMode
+{
+    static EGLint GetGlesMajorVersion() { return T::GetGlesMajorVersion(); }
+    static EGLPlatformParameters GetPlatform() { return T::GetPlatform(); }
+    static bool IsNoError() { return NoError; }
+};
+
+typedef ValidationMode<ES2_D3D9, false>  ES2_D3D9_VALIDATED;
+typedef ValidationMode<ES2_D3D9, true>   ES2_D3D9_NO_ERROR;
+typedef ValidationMode<ES2_D3D11, false> ES2_D3D11_VALIDATED;
+typedef ValidationMode<ES2_D3D11, true>  ES2_D3D11_NO_ERROR;
+
+// Use this to select which configurations (e.g. which renderer, which GLES major version) these tests should be run against.
+ANGLE_TYPED_TEST_CASE(NoErrorTest, ES2_D3D9_VALIDATED, ES2_D3D9_NO_ERROR, ES2_D3D11_VALIDATED, ES2_D3D11_NO_ERROR);
+
+template<typename T>
+class NoErrorTest : public ANGLETest
+{
+  protected:
+    NoErrorTest() : ANGLETest(T::GetGlesMajorVersion(), T::GetPlatform())
+    {
+        setWindowWidth(64);
+        setWindowHeight(64);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+        setNoErrorEnabled(T::IsNoError());
+    }
+
+    virtual void SetUp()
+    {
+        ANGLETest::SetUp();
+
+        const std::string vertexShader = SHADER_SOURCE
+        (
+            attribute vec2 position;
+            void main()
+            {
+                gl_Position = vec4(position, 0.0, 1.0);
+            }
+        );
+
+        const std::string fragmentShader = SHADER_SOURCE
+        (
+            precision mediump float;
+            uniform vec4 color;
+            uniform mat2 scale;
+            void main()
+            {
+                gl_FragColor = vec4(scale * color.xy, color.zw);
+            }
+        );
+
+        mProgram = CompileProgram(vertexShader, fragmentShader);
+        ASSERT_NE(0u, mProgram);
+
+        mColorLocation = glGetUniformLocation(mProgram, "color");
+        ASSERT_NE(-1, mColorLocation);
+
+        mScaleLocation = glGetUniformLocation(mProgram, "scale");
+        ASSERT_NE(-1, mScaleLocation);
+
+        // Two triangles covering the window
+        const GLfloat vertices[] =
+        {
+            -1.0f, -1.0f,
+             1.0f, -1.0f,
+             1.0f,  1.0f,
+            -1.0f, -1.0f,
+             1.0f,  1.0f,
+            -1.0f,  1.0f,
+        };
+
+        glGenBuffers(1, &mVertexBuffer);
+        glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+
+        const GLushort indices[] = { 0, 1, 2, 3, 4, 5 };
+
+        glGenBuffers(1, &mIndexBuffer);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+
+        GLint positionLocation = glGetAttribLocation(mProgram, "position");
+        ASSERT_NE(-1, positionLocation);
+
+        glUseProgram(mProgram);
+        glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, NULL);
+        glEnableVertexAttribArray(positionLocation);
+
+        const GLfloat identity[] = { 1.0f, 0.0f, 0.0f, 1.0f };
+        glUniformMatrix2fv(mScaleLocation, 1, GL_FALSE, identity);
+
+        glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        ASSERT_GL_NO_ERROR();
+    }
+
+    virtual void TearDown()
+    {
+        glDeleteProgram(mProgram);
+        glDeleteBuffers(1, &mVertexBuffer);
+        glDeleteBuffers(1, &mIndexBuffer);
+
+        ANGLETest::TearDown();
+    }
+
+    GLuint mProgram;
+    GLint mColorLocation;
+    GLint mScaleLocation;
+    GLuint mVertexBuffer;
+    GLuint mIndexBuffer;
+};
+
+TYPED_TEST(NoErrorTest, DrawsMatchTheValidatedContext)
+{
+    glUniform4f(mColorLocation, 1.0f, 0.0f, 0.0f, 1.0f);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_GL_NO_ERROR();
+    EXPECT_PIXEL_EQ(16, 16, 255, 0, 0, 255);
+
+    glUniform4f(mColorLocation, 0.0f, 1.0f, 0.0f, 1.0f);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, NULL);
+    EXPECT_GL_NO_ERROR();
+    EXPECT_PIXEL_EQ(48, 48, 0, 255, 0, 255);
+
+    // Swap the red and green channels through the matrix uniform
+    const GLfloat swap[] = { 0.0f, 1.0f, 1.0f, 0.0f };
+    glUniformMatrix2fv(mScaleLocation, 1, GL_FALSE, swap);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, NULL);
+    EXPECT_GL_NO_ERROR();
+    EXPECT_PIXEL_EQ(32, 32, 255, 0, 0, 255);
+}
+
+TYPED_TEST(NoErrorTest, InvalidCallsAreOnlyReportedWhenValidating)
+{
+    GLenum expectedError = (TypeParam::IsNoError() ? GL_NO_ERROR : GL_INVALID_ENUM);
+
+    glBindBuffer(GL_TEXTURE_2D, mVertexBuffer);
+    EXPECT_GL_ERROR(expectedError);
+
+    glDrawElements(GL_TRIANGLES, 6, GL_FLOAT, NULL);
+    EXPECT_GL_ERROR(expectedError);
+
+    // Unknown caps are ignored
+    glEnable(GL_TEXTURE_2D);
+    EXPECT_GL_ERROR(expectedError);
+    glDisable(GL_TEXTURE_2D);
+    EXPECT_GL_ERROR(expectedError);
+    EXPECT_EQ(GL_FALSE, glIsEnabled(GL_TEXTURE_2D));
+    EXPECT_GL_ERROR(expectedError);
+
+    expectedError = (TypeParam::IsNoError() ? GL_NO_ERROR : GL_INVALID_VALUE);
+
+    glDrawArrays(GL_TRIANGLES, -1, 6);
+    EXPECT_GL_ERROR(expectedError);
+
+    expectedError = (TypeParam::IsNoError() ? GL_NO_ERROR : GL_INVALID_OPERATION);
+
+    // The location holds a vec4, not an int
+    glUniform1i(mColorLocation, 1);
+    EXPECT_GL_ERROR(expectedError);
+
+    // None of the above may have drawn anything
+    EXPECT_PIXEL_EQ(32, 32, 0, 0, 0, 0);
+}
+
+TYPED_TEST(NoErrorTest, DrawsReadingPastTheBuffersAreSkipped)
+{
+    glUniform4f(mColorLocation, 1.0f, 1.0f, 1.0f, 1.0f);
+
+    // The index buffer holds six indices, the vertex buffer six vertices
+    glDrawElements(GL_TRIANGLES, 12, GL_UNSIGNED_SHORT, NULL);
+
+    const GLushort outOfRangeIndices[] = { 0, 1, 200 };
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_SHORT, outOfRangeIndices);
+
+    if (TypeParam::IsNoError())
+    {
+        EXPECT_GL_NO_ERROR();
+    }
+    else
+    {
+        EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+    }
+
+    EXPECT_PIXEL_EQ(32, 32, 0, 0, 0, 0);
+}
+
+TYPED_TEST(NoErrorTest, DrawsFromMappedBuffersAreSkipped)
+{
+    if (!extensionEnabled("GL_OES_mapbuffer"))
+    {
+        return;
+    }
+
+    glUniform4f(mColorLocation, 1.0f, 1.0f, 1.0f, 1.0f);
+    GLenum expectedError = (TypeParam::IsNoError() ? GL_NO_ERROR : GL_INVALID_OPERATION);
+
+    ASSERT_NE(static_cast<GLvoid*>(NULL), glMapBufferOES(GL_ARRAY_BUFFER, GL_WRITE_ONLY_OES));
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_GL_ERROR(expectedError);
+    glUnmapBufferOES(GL_ARRAY_BUFFER);
+
+    ASSERT_NE(static_cast<GLvoid*>(NULL), glMapBufferOES(GL_ELEMENT_ARRAY_BUFFER, GL_WRITE_ONLY_OES));
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, NULL);
+    EXPECT_GL_ERROR(expectedError);
+    glUnmapBufferOES(GL_ELEMENT_ARRAY_BUFFER);
+
+    EXPECT_PIXEL_EQ(32, 32, 0, 0, 0, 0);
+}
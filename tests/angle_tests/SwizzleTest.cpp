@@ -262,6 +262,86 @@ TYPED_TEST(SwizzleTest, D24_2D)
     runTest2D();
 }
 
+// Drawing to a texture invalidates its swizzled copy, which has to be generated again once the
+// texture is sampled from another framebuffer.
+TYPED_TEST(SwizzleTest, RenderToTextureThenSample)
+{
+    GLubyte data[] = { 0, 0, 0, 255 };
+    init2DTexture(GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, data);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_R, GL_GREEN);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_G, GL_BLUE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_B, GL_RED);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_A, GL_ONE);
+
+    const std::string vertexShaderSource = SHADER_SOURCE
+    (
+        attribute highp vec4 position;
+
+        void main()
+        {
+            gl_Position = position;
+        }
+    );
+
+    const std::string fragmentShaderSource = SHADER_SOURCE
+    (
+        uniform highp vec4 color;
+
+        void main()
+        {
+            gl_FragColor = color;
+        }
+    );
+
+    GLuint colorProgram = CompileProgram(vertexShaderSource, fragmentShaderSource);
+    ASSERT_NE(0u, colorProgram);
+    GLint colorUniformLocation = glGetUniformLocation(colorProgram, "color");
+
+    glUseProgram(mProgram);
+    glUniform1i(mTextureUniformLocation, 0);
+    drawQuad(mProgram, "position", 0.5f);
+    EXPECT_PIXEL_EQ(0, 0, 0, 0, 0, 255);
+
+    GLuint otherTexture;
+    glGenTextures(1, &otherTexture);
+    glBindTexture(GL_TEXTURE_2D, otherTexture);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, 1, 1);
+
+    GLuint framebuffer;
+    glGenFramebuffers(1, &framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, mTexture, 0);
+    ASSERT_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_FRAMEBUFFER));
+
+    glBindTexture(GL_TEXTURE_2D, mTexture);
+    glUseProgram(colorProgram);
+    glUniform4f(colorUniformLocation, 1.0f, 0.0f, 0.0f, 1.0f);
+    drawQuad(colorProgram, "position", 0.5f);
+
+    // Switching back to the default framebuffer
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    drawQuad(mProgram, "position", 0.5f);
+    EXPECT_PIXEL_EQ(0, 0, 0, 0, 255, 255);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glUseProgram(colorProgram);
+    glUniform4f(colorUniformLocation, 0.0f, 1.0f, 0.0f, 1.0f);
+    drawQuad(colorProgram, "position", 0.5f);
+
+    // Changing the attachment of the bound framebuffer
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, otherTexture, 0);
+    ASSERT_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_FRAMEBUFFER));
+    drawQuad(mProgram, "position", 0.5f);
+    EXPECT_PIXEL_EQ(0, 0, 255, 0, 0, 255);
+
+    EXPECT_GL_NO_ERROR();
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glDeleteFramebuffers(1, &framebuffer);
+    glDeleteTextures(1, &otherTexture);
+    glDeleteProgram(colorProgram);
+}
+
 #include "media/pixel.inl"
 
 TYPED_TEST(SwizzleTest, CompressedDXT_2D)
@@ -1,5 +1,7 @@
 #include "ANGLETest.h"
 
+#include <sstream>
+
 // Use this to select which configurations (e.g. which renderer, which GLES major version) these tests should be run against.
 ANGLE_TYPED_TEST_CASE(UniformTest, ES2_D3D9, ES2_D3D11, ES2_D3D11_FL9_3);
 
@@ -76,3 +78,47 @@ TYPED_TEST(UniformTest, GetUniformNoCurrentProgram)
     ASSERT_GL_NO_ERROR();
     EXPECT_EQ(1, i);
 }
+
+TYPED_TEST(UniformTest, ArrayElementLocations)
+{
+    const std::string &vertexShader = "void main() { gl_Position = vec4(1); }";
+    const std::string &fragShader =
+        "precision mediump float;\n"
+        "uniform float uniF;\n"
+        "uniform vec4 uniArray[4];\n"
+        "void main() { gl_FragColor = uniArray[0] + uniArray[3] + vec4(uniF); }";
+
+    GLuint program = CompileProgram(vertexShader, fragShader);
+    ASSERT_NE(program, 0u);
+
+    GLint arrayLocation = glGetUniformLocation(program, "uniArray");
+    ASSERT_NE(-1, arrayLocation);
+    EXPECT_EQ(arrayLocation, glGetUniformLocation(program, "uniArray[0]"));
+
+    // Every element has a location of its own, statically used or not
+    GLint elementLocations[4];
+    for (int element = 0; element < 4; element++)
+    {
+        std::stringstream name;
+        name << "uniArray[" << element << "]";
+        elementLocations[element] = glGetUniformLocation(program, name.str().c_str());
+        EXPECT_NE(-1, elementLocations[element]);
+        for (int previous = 0; previous < element; previous++)
+        {
+            EXPECT_NE(elementLocations[previous], elementLocations[element]);
+        }
+    }
+
+    EXPECT_EQ(-1, glGetUniformLocation(program, "uniArray[4]"));
+    EXPECT_EQ(-1, glGetUniformLocation(program, "uniArray[01]"));
+    EXPECT_EQ(-1, glGetUniformLocation(program, "uniArray["));
+    EXPECT_EQ(-1, glGetUniformLocation(program, "uniArra"));
+
+    // Only arrays take a subscript
+    EXPECT_NE(-1, glGetUniformLocation(program, "uniF"));
+    EXPECT_EQ(-1, glGetUniformLocation(program, "uniF[0]"));
+
+    EXPECT_GL_NO_ERROR();
+
+    glDeleteProgram(program);
+}
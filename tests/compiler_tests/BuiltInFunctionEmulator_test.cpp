@@ -0,0 +1,266 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BuiltInFunctionEmulator_test.cpp:
+//   Tests that emulated built-ins are replaced, and that emulations are
+//   emitted once and only when called.
+//
+
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+#include "GLSLANG/ShaderLang.h"
+#include "compiler/translator/BuiltInFunctionEmulatorGLSL.h"
+#include "compiler/translator/TranslatorESSL.h"
+#include "compiler/translator/TranslatorGLSL.h"
+
+namespace
+{
+
+typedef void (*InitEmulatorFunc)(BuiltInFunctionEmulator *emu, sh::GLenum shaderType);
+
+// Registers emulations regardless of the platform the test runs on.
+template <typename Translator>
+class EmulatingTranslator : public Translator
+{
+  public:
+    EmulatingTranslator(sh::GLenum type, InitEmulatorFunc initEmulator)
+        : Translator(type, SH_GLES2_SPEC),
+          mInitEmulator(initEmulator)
+    {
+    }
+
+  protected:
+    virtual void initBuiltInFunctionEmulator(BuiltInFunctionEmulator *emu)
+    {
+        mInitEmulator(emu, this->getShaderType());
+    }
+
+  private:
+    InitEmulatorFunc mInitEmulator;
+};
+
+void InitClampEmulation(BuiltInFunctionEmulator *emu, sh::GLenum shaderType)
+{
+    TType float1(EbtFloat);
+    emu->addEmulatedFunction(EOpClamp, float1, float1, float1,
+        "#define webgl_clamp_emu(x, a, b) min(max((x), (a)), (b))");
+}
+
+size_t CountOccurrences(const std::string &str, const std::string &substr)
+{
+    size_t count = 0;
+    for (size_t pos = str.find(substr); pos != std::string::npos; pos = str.find(substr, pos + 1))
+    {
+        ++count;
+    }
+    return count;
+}
+
+const char *const kEmulationBegin = "// BEGIN: Generated code for built-in function emulation";
+
+const char *const kDistanceDefinition = "#define webgl_distance_emu(x, y)";
+const char *const kDotDefinition = "#define webgl_dot_emu(x, y)";
+const char *const kLengthDefinition = "#define webgl_length_emu(x)";
+const char *const kNormalizeDefinition = "#define webgl_normalize_emu(x)";
+const char *const kReflectDefinition = "#define webgl_reflect_emu(I, N)";
+
+}  // namespace
+
+class BuiltInFunctionEmulatorTest : public testing::Test
+{
+  public:
+    BuiltInFunctionEmulatorTest() {}
+
+  protected:
+    virtual void SetUp()
+    {
+        ShInitBuiltInResources(&mResources);
+        mResources.FragmentPrecisionHigh = 1;
+    }
+
+    std::string translate(TCompiler *translator, const std::string &shaderString,
+                          int compileOptions)
+    {
+        EXPECT_TRUE(translator->Init(mResources));
+        const char *shaderStrings[] = { shaderString.c_str() };
+        EXPECT_TRUE(translator->compile(shaderStrings, 1, compileOptions))
+            << translator->getInfoSink().info.c_str();
+        return translator->getInfoSink().obj.c_str();
+    }
+
+    std::string translateESSL(sh::GLenum shaderType, const std::string &shaderString,
+                              InitEmulatorFunc initEmulator = InitBuiltInFunctionEmulatorForGLSLWorkarounds,
+                              int compileOptions = SH_OBJECT_CODE | SH_EMULATE_BUILT_IN_FUNCTIONS)
+    {
+        EmulatingTranslator<TranslatorESSL> translator(shaderType, initEmulator);
+        return translate(&translator, shaderString, compileOptions);
+    }
+
+    std::string translateGLSL(sh::GLenum shaderType, const std::string &shaderString)
+    {
+        EmulatingTranslator<TranslatorGLSL> translator(shaderType, InitBuiltInFunctionEmulatorForGLSLWorkarounds);
+        return translate(&translator, shaderString, SH_OBJECT_CODE | SH_EMULATE_BUILT_IN_FUNCTIONS);
+    }
+
+    ShBuiltInResources mResources;
+};
+
+TEST_F(BuiltInFunctionEmulatorTest, ScalarEmulations)
+{
+    const std::string &shaderString =
+        "attribute float a;\n"
+        "attribute float b;\n"
+        "void main() {\n"
+        "   float x = distance(a, b) + dot(a, b) + length(a) + normalize(a) + reflect(a, b);\n"
+        "   gl_Position = vec4(x);\n"
+        "}\n";
+
+    std::string objCode = translateESSL(GL_VERTEX_SHADER, shaderString);
+    EXPECT_EQ(1u, CountOccurrences(objCode, kEmulationBegin));
+    EXPECT_EQ(1u, CountOccurrences(objCode, kDistanceDefinition));
+    EXPECT_EQ(1u, CountOccurrences(objCode, kDotDefinition));
+    EXPECT_EQ(1u, CountOccurrences(objCode, kLengthDefinition));
+    EXPECT_EQ(1u, CountOccurrences(objCode, kNormalizeDefinition));
+    EXPECT_EQ(1u, CountOccurrences(objCode, kReflectDefinition));
+
+    EXPECT_NE(std::string::npos, objCode.find("webgl_distance_emu(a, b)"));
+    EXPECT_NE(std::string::npos, objCode.find("webgl_dot_emu(a, b)"));
+    EXPECT_NE(std::string::npos, objCode.find("webgl_length_emu(a)"));
+    EXPECT_NE(std::string::npos, objCode.find("webgl_normalize_emu(a)"));
+    EXPECT_NE(std::string::npos, objCode.find("webgl_reflect_emu(a, b)"));
+
+    // cos() is only emulated in fragment shaders.
+    EXPECT_EQ(std::string::npos, objCode.find("webgl_cos_emu"));
+}
+
+TEST_F(BuiltInFunctionEmulatorTest, CosInFragmentShader)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "varying vec4 v;\n"
+        "void main() {\n"
+        "   gl_FragColor = vec4(cos(v.x), cos(v.xy), 0.0) + vec4(cos(v.xyz), 0.0) + cos(v);\n"
+        "}\n";
+
+    std::string objCode = translateESSL(GL_FRAGMENT_SHADER, shaderString);
+    EXPECT_EQ(1u, CountOccurrences(objCode, "float webgl_cos_emu(webgl_emu_precision float a)"));
+    EXPECT_EQ(1u, CountOccurrences(objCode, "vec2 webgl_cos_emu(webgl_emu_precision vec2 a)"));
+    EXPECT_EQ(1u, CountOccurrences(objCode, "vec3 webgl_cos_emu(webgl_emu_precision vec3 a)"));
+    EXPECT_EQ(1u, CountOccurrences(objCode, "vec4 webgl_cos_emu(webgl_emu_precision vec4 a)"));
+    EXPECT_EQ(4u, CountOccurrences(objCode, "webgl_cos_emu(v"));
+
+    EXPECT_NE(std::string::npos, objCode.find("#define webgl_emu_precision highp\n"));
+}
+
+TEST_F(BuiltInFunctionEmulatorTest, CosInVertexShaderIsNotEmulated)
+{
+    const std::string &shaderString =
+        "attribute vec4 a;\n"
+        "void main() {\n"
+        "   gl_Position = cos(a) + vec4(cos(a.x));\n"
+        "}\n";
+
+    std::string objCode = translateESSL(GL_VERTEX_SHADER, shaderString);
+    EXPECT_EQ(std::string::npos, objCode.find(kEmulationBegin));
+    EXPECT_EQ(std::string::npos, objCode.find("webgl_cos_emu"));
+}
+
+// Only the float overloads are emulated.
+TEST_F(BuiltInFunctionEmulatorTest, VectorOverloadsAreNotEmulated)
+{
+    const std::string &shaderString =
+        "attribute vec3 a;\n"
+        "attribute vec3 b;\n"
+        "void main() {\n"
+        "   float x = distance(a, b) + dot(a, b) + length(a);\n"
+        "   gl_Position = vec4(normalize(a) + reflect(a, b), x);\n"
+        "}\n";
+
+    std::string objCode = translateESSL(GL_VERTEX_SHADER, shaderString);
+    EXPECT_EQ(std::string::npos, objCode.find(kEmulationBegin));
+    EXPECT_EQ(std::string::npos, objCode.find("_emu("));
+}
+
+TEST_F(BuiltInFunctionEmulatorTest, UnusedEmulationsAreNotEmitted)
+{
+    const std::string &shaderString =
+        "attribute float a;\n"
+        "void main() {\n"
+        "   gl_Position = vec4(length(a) + length(a * 2.0));\n"
+        "}\n";
+
+    std::string objCode = translateESSL(GL_VERTEX_SHADER, shaderString);
+    EXPECT_EQ(1u, CountOccurrences(objCode, kLengthDefinition));
+    // The definition and both calls.
+    EXPECT_EQ(3u, CountOccurrences(objCode, "webgl_length_emu("));
+    EXPECT_EQ(std::string::npos, objCode.find(kDistanceDefinition));
+    EXPECT_EQ(std::string::npos, objCode.find(kDotDefinition));
+    EXPECT_EQ(std::string::npos, objCode.find(kNormalizeDefinition));
+    EXPECT_EQ(std::string::npos, objCode.find(kReflectDefinition));
+}
+
+TEST_F(BuiltInFunctionEmulatorTest, NoEmulationWithoutCompileOption)
+{
+    const std::string &shaderString =
+        "attribute float a;\n"
+        "void main() {\n"
+        "   gl_Position = vec4(length(a));\n"
+        "}\n";
+
+    std::string objCode = translateESSL(GL_VERTEX_SHADER, shaderString,
+                                        InitBuiltInFunctionEmulatorForGLSLWorkarounds, SH_OBJECT_CODE);
+    EXPECT_EQ(std::string::npos, objCode.find(kEmulationBegin));
+    EXPECT_NE(std::string::npos, objCode.find("length(a)"));
+}
+
+// Emulations are reset between compiles.
+TEST_F(BuiltInFunctionEmulatorTest, SecondCompile)
+{
+    EmulatingTranslator<TranslatorESSL> translator(GL_VERTEX_SHADER, InitBuiltInFunctionEmulatorForGLSLWorkarounds);
+    std::string objCode = translate(&translator,
+        "attribute float a;\n"
+        "void main() { gl_Position = vec4(length(a)); }\n",
+        SH_OBJECT_CODE | SH_EMULATE_BUILT_IN_FUNCTIONS);
+    EXPECT_EQ(1u, CountOccurrences(objCode, kLengthDefinition));
+
+    const char *shaderStrings[] = {
+        "attribute float a;\n"
+        "void main() { gl_Position = vec4(dot(a, a)); }\n"
+    };
+    ASSERT_TRUE(translator.compile(shaderStrings, 1, SH_OBJECT_CODE | SH_EMULATE_BUILT_IN_FUNCTIONS));
+    objCode = translator.getInfoSink().obj.c_str();
+    EXPECT_EQ(std::string::npos, objCode.find(kLengthDefinition));
+    EXPECT_EQ(1u, CountOccurrences(objCode, kDotDefinition));
+}
+
+TEST_F(BuiltInFunctionEmulatorTest, GLSLOutputHasNoPrecision)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "varying float v;\n"
+        "void main() {\n"
+        "   gl_FragColor = vec4(cos(v));\n"
+        "}\n";
+
+    std::string objCode = translateGLSL(GL_FRAGMENT_SHADER, shaderString);
+    EXPECT_NE(std::string::npos, objCode.find("#define webgl_emu_precision\n"));
+    EXPECT_EQ(std::string::npos, objCode.find("highp"));
+    EXPECT_EQ(1u, CountOccurrences(objCode, "float webgl_cos_emu("));
+}
+
+TEST_F(BuiltInFunctionEmulatorTest, ThreeParameters)
+{
+    const std::string &shaderString =
+        "attribute float a;\n"
+        "attribute vec2 b;\n"
+        "void main() {\n"
+        "   gl_Position = vec4(clamp(a, 0.0, 1.0), clamp(b, 0.0, 1.0), 1.0);\n"
+        "}\n";
+
+    std::string objCode = translateESSL(GL_VERTEX_SHADER, shaderString, InitClampEmulation);
+    EXPECT_EQ(1u, CountOccurrences(objCode, "#define webgl_clamp_emu(x, a, b)"));
+    EXPECT_EQ(1u, CountOccurrences(objCode, "webgl_clamp_emu(a, 0.0, 1.0)"));
+    EXPECT_EQ(1u, CountOccurrences(objCode, "clamp(b, 0.0, 1.0)"));
+}
@@ -508,3 +508,32 @@ TEST_F(ExpressionLimitTest, Recursion)
     ShDestruct(vertexCompiler);
 }
 
+TEST_F(ExpressionLimitTest, MacroExpansion)
+{
+    resources.MaxMacroExpandedTokens = 1000;
+
+    ShShaderSpec spec = SH_WEBGL_SPEC;
+    ShShaderOutput output = SH_ESSL_OUTPUT;
+    ShHandle fragmentCompiler = ShConstructCompiler(
+        GL_FRAGMENT_SHADER, spec, output, &resources);
+    int compileOptions = 0;
+
+    std::stringstream ss;
+    ss << "#define f0(x) (x + x)\n";
+    for (int ii = 1; ii <= 30; ++ii) {
+      ss << "#define f" << ii << "(x) f" << (ii - 1) << "(f" << (ii - 1) << "(x))\n";
+    }
+    ss << "precision mediump float;\n";
+
+    // Test expansion under the limit passes.
+    std::string smallExpansion = ss.str() + "void main() { gl_FragColor = vec4(f2(1.0)); }";
+    EXPECT_TRUE(CheckShaderCompilation(
+        fragmentCompiler, smallExpansion.c_str(),
+        compileOptions, NULL));
+    // Test exponential expansion fails.
+    std::string largeExpansion = ss.str() + "void main() { gl_FragColor = vec4(f30(1.0)); }";
+    EXPECT_TRUE(CheckShaderCompilation(
+        fragmentCompiler, largeExpansion.c_str(),
+        compileOptions, "macro expansion too large"));
+    ShDestruct(fragmentCompiler);
+}
@@ -0,0 +1,232 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// NameHashingCache_test.cpp:
+//   Tests that the name hashing cache persists across compiles without
+//   changing the translated output.
+//
+
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+#include "GLSLANG/ShaderLang.h"
+
+namespace
+{
+
+int gHashCalls = 0;
+
+khronos_uint64_t CountingHash(const char *str, size_t len)
+{
+    ++gHashCalls;
+
+    // FNV-1a.
+    khronos_uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < len; ++i)
+    {
+        hash ^= static_cast<unsigned char>(str[i]);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+const char *const kShader1 =
+    "precision mediump float;\n"
+    "uniform vec4 uColor;\n"
+    "varying vec2 vTexCoord;\n"
+    "struct Light { vec3 dir; float intensity; };\n"
+    "uniform Light uLight;\n"
+    "float shade(vec2 uv) { return uv.x * uLight.intensity; }\n"
+    "void main() {\n"
+    "    gl_FragColor = uColor * shade(vTexCoord);\n"
+    "}\n";
+
+const char *const kShader2 =
+    "precision mediump float;\n"
+    "uniform vec4 uColor;\n"
+    "varying vec2 vTexCoord;\n"
+    "uniform float uScale;\n"
+    "void main() {\n"
+    "    gl_FragColor = uColor * vTexCoord.y * uScale;\n"
+    "}\n";
+
+}  // namespace
+
+class NameHashingCacheTest : public testing::Test
+{
+  public:
+    NameHashingCacheTest() {}
+
+  protected:
+    virtual void SetUp()
+    {
+        gHashCalls = 0;
+    }
+
+    ShHandle construct(int maxCacheSize)
+    {
+        ShBuiltInResources resources;
+        ShInitBuiltInResources(&resources);
+        resources.HashFunction = CountingHash;
+        resources.MaxNameHashingCacheSize = maxCacheSize;
+
+        ShHandle compiler = ShConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES2_SPEC,
+                                                SH_ESSL_OUTPUT, &resources);
+        EXPECT_TRUE(compiler != NULL);
+        return compiler;
+    }
+
+    std::string compile(ShHandle compiler, const char *shaderString)
+    {
+        const char *shaderStrings[] = { shaderString };
+        EXPECT_TRUE(ShCompile(compiler, shaderStrings, 1, SH_OBJECT_CODE | SH_VARIABLES))
+            << ShGetInfoLog(compiler);
+
+        // The mapped names of the variables are part of the output.
+        std::string output = ShGetObjectCode(compiler);
+        const std::vector<sh::Uniform> &uniforms = *ShGetUniforms(compiler);
+        for (size_t i = 0; i < uniforms.size(); ++i)
+        {
+            output += "\n" + uniforms[i].name + "=" + uniforms[i].mappedName;
+        }
+        const std::vector<sh::Varying> &varyings = *ShGetVaryings(compiler);
+        for (size_t i = 0; i < varyings.size(); ++i)
+        {
+            output += "\n" + varyings[i].name + "=" + varyings[i].mappedName;
+        }
+        return output;
+    }
+};
+
+// The uncached translation is the reference output.
+TEST_F(NameHashingCacheTest, OutputMatchesUncached)
+{
+    ShHandle uncached = construct(0);
+    std::string expected1 = compile(uncached, kShader1);
+    std::string expected2 = compile(uncached, kShader2);
+    const std::map<std::string, std::string> expectedMap2 = *ShGetNameHashingMap(uncached);
+    ShDestruct(uncached);
+
+    ShHandle compiler = construct(16384);
+    EXPECT_EQ(expected1, compile(compiler, kShader1));
+    EXPECT_EQ(expected2, compile(compiler, kShader2));
+    EXPECT_EQ(expected1, compile(compiler, kShader1));
+    EXPECT_EQ(expected2, compile(compiler, kShader2));
+
+    // The name map only holds the names of the last shader.
+    EXPECT_EQ(expectedMap2, *ShGetNameHashingMap(compiler));
+    EXPECT_EQ(0u, ShGetNameHashingMap(compiler)->count("uLight"));
+    ShDestruct(compiler);
+}
+
+TEST_F(NameHashingCacheTest, NamesAreHashedOnce)
+{
+    ShHandle compiler = construct(16384);
+    compile(compiler, kShader1);
+    int firstCompileCalls = gHashCalls;
+    EXPECT_LT(0, firstCompileCalls);
+
+    compile(compiler, kShader1);
+    EXPECT_EQ(firstCompileCalls, gHashCalls);
+
+    // Only uScale is new.
+    compile(compiler, kShader2);
+    EXPECT_EQ(firstCompileCalls + 1, gHashCalls);
+    ShDestruct(compiler);
+}
+
+TEST_F(NameHashingCacheTest, SnapshotAndRestore)
+{
+    ShHandle compiler = construct(16384);
+    std::string expected = compile(compiler, kShader1);
+
+    std::map<std::string, std::string> snapshot;
+    ShGetNameHashingCache(compiler, &snapshot);
+    EXPECT_EQ("webgl_", snapshot["uColor"].substr(0, 6));
+    EXPECT_EQ(snapshot["uColor"], ShGetNameHashingMap(compiler)->find("uColor")->second);
+    ShDestruct(compiler);
+
+    ShHandle restored = construct(16384);
+    ShSetNameHashingCache(restored, snapshot);
+    gHashCalls = 0;
+    EXPECT_EQ(expected, compile(restored, kShader1));
+    EXPECT_EQ(0, gHashCalls);
+
+    std::map<std::string, std::string> restoredSnapshot;
+    ShGetNameHashingCache(restored, &restoredSnapshot);
+    EXPECT_EQ(snapshot, restoredSnapshot);
+    ShDestruct(restored);
+}
+
+TEST_F(NameHashingCacheTest, BoundedSize)
+{
+    ShHandle uncached = construct(0);
+    std::string expected1 = compile(uncached, kShader1);
+    std::string expected2 = compile(uncached, kShader2);
+    ShDestruct(uncached);
+
+    const int kMaxSize = 3;
+    ShHandle compiler = construct(kMaxSize);
+    std::map<std::string, std::string> snapshot;
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_EQ(expected1, compile(compiler, kShader1));
+        ShGetNameHashingCache(compiler, &snapshot);
+        EXPECT_GE(static_cast<size_t>(kMaxSize), snapshot.size());
+
+        EXPECT_EQ(expected2, compile(compiler, kShader2));
+        ShGetNameHashingCache(compiler, &snapshot);
+        EXPECT_GE(static_cast<size_t>(kMaxSize), snapshot.size());
+    }
+    ShDestruct(compiler);
+
+    // Restoring a larger snapshot keeps at most kMaxSize names.
+    ShHandle large = construct(16384);
+    compile(large, kShader1);
+    ShGetNameHashingCache(large, &snapshot);
+    ShDestruct(large);
+    EXPECT_LT(static_cast<size_t>(kMaxSize), snapshot.size());
+
+    compiler = construct(kMaxSize);
+    ShSetNameHashingCache(compiler, snapshot);
+    std::map<std::string, std::string> restoredSnapshot;
+    ShGetNameHashingCache(compiler, &restoredSnapshot);
+    EXPECT_EQ(static_cast<size_t>(kMaxSize), restoredSnapshot.size());
+    EXPECT_EQ(expected1, compile(compiler, kShader1));
+    ShDestruct(compiler);
+}
+
+// Names are only evicted between compiles, so a compile hashes each of its
+// names once even when they do not all fit in the cache.
+TEST_F(NameHashingCacheTest, NamesAreHashedOnceWithinACompile)
+{
+    ShHandle large = construct(16384);
+    compile(large, kShader1);
+    int distinctNames = gHashCalls;
+    ShDestruct(large);
+
+    gHashCalls = 0;
+    ShHandle compiler = construct(1);
+    compile(compiler, kShader1);
+    EXPECT_EQ(distinctNames, gHashCalls);
+
+    std::map<std::string, std::string> snapshot;
+    ShGetNameHashingCache(compiler, &snapshot);
+    EXPECT_EQ(1u, snapshot.size());
+    ShDestruct(compiler);
+}
+
+TEST_F(NameHashingCacheTest, CacheDisabled)
+{
+    ShHandle compiler = construct(0);
+    compile(compiler, kShader1);
+    int firstCompileCalls = gHashCalls;
+    compile(compiler, kShader1);
+    EXPECT_EQ(2 * firstCompileCalls, gHashCalls);
+
+    std::map<std::string, std::string> snapshot;
+    ShGetNameHashingCache(compiler, &snapshot);
+    EXPECT_TRUE(snapshot.empty());
+    ShDestruct(compiler);
+}
@@ -0,0 +1,215 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Preprocess_test.cpp:
+//   Tests for ShPreprocess, the preprocess-only entry point.
+//
+
+#include <algorithm>
+
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+#include "GLSLANG/ShaderLang.h"
+
+class PreprocessTest : public testing::Test
+{
+  public:
+    PreprocessTest() {}
+
+  protected:
+    virtual void SetUp()
+    {
+        ShBuiltInResources resources;
+        ShInitBuiltInResources(&resources);
+        resources.OES_standard_derivatives = 1;
+
+        mCompiler = ShConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES2_SPEC, SH_ESSL_OUTPUT, &resources);
+        ASSERT_TRUE(mCompiler != NULL);
+    }
+
+    virtual void TearDown()
+    {
+        ShDestruct(mCompiler);
+    }
+
+    ShPreprocessorOutput preprocess(const std::string &shaderString)
+    {
+        const char *shaderStrings[] = { shaderString.c_str() };
+        ShPreprocessorOutput output;
+        EXPECT_TRUE(ShPreprocess(mCompiler, shaderStrings, 1, &output)) << ShGetInfoLog(mCompiler);
+        return output;
+    }
+
+    bool referencesMacro(const ShPreprocessorOutput &output, const std::string &name)
+    {
+        return std::find(output.referencedMacros.begin(), output.referencedMacros.end(), name) !=
+               output.referencedMacros.end();
+    }
+
+    ShHandle mCompiler;
+};
+
+TEST_F(PreprocessTest, NormalizedText)
+{
+    const std::string &shaderString =
+        "precision mediump float;  // comment\n"
+        "\n"
+        "void main()\n"
+        "{\n"
+        "    gl_FragColor=vec4( 1.0 );\n"
+        "}\n";
+
+    ShPreprocessorOutput output = preprocess(shaderString);
+    EXPECT_EQ("precision mediump float ;\n"
+              "void main ( )\n"
+              "{\n"
+              "gl_FragColor = vec4 ( 1.0 ) ;\n"
+              "}",
+              output.text);
+    EXPECT_EQ(100, output.version);
+    EXPECT_TRUE(output.extensions.empty());
+    EXPECT_TRUE(output.pragmas.empty());
+}
+
+TEST_F(PreprocessTest, FingerprintIgnoresFormatting)
+{
+    const std::string &shaderString1 =
+        "precision mediump float;\n"
+        "void main() {\n"
+        "    gl_FragColor = vec4(1.0);\n"
+        "}\n";
+    const std::string &shaderString2 =
+        "/* header */ precision mediump float; void main()\n"
+        "{ gl_FragColor =\n"
+        "  vec4(1.0); }\n";
+    const std::string &shaderString3 =
+        "#define COLOR vec4(1.0)\n"
+        "precision mediump float;\n"
+        "void main() {\n"
+        "#ifdef GL_ES\n"
+        "    gl_FragColor = COLOR;\n"
+        "#endif\n"
+        "}\n";
+
+    unsigned long long fingerprint = preprocess(shaderString1).fingerprint;
+    EXPECT_EQ(fingerprint, preprocess(shaderString2).fingerprint);
+    EXPECT_EQ(fingerprint, preprocess(shaderString3).fingerprint);
+}
+
+TEST_F(PreprocessTest, FingerprintDependsOnTokens)
+{
+    const std::string &shaderString1 =
+        "precision mediump float;\n"
+        "void main() { gl_FragColor = vec4(1.0); }\n";
+    const std::string &shaderString2 =
+        "precision mediump float;\n"
+        "void main() { gl_FragColor = vec4(0.0); }\n";
+    // Same characters, different token boundaries.
+    const std::string &shaderString3 =
+        "precision mediump float;\n"
+        "void main() { gl_FragColor = vec4(1.0) ; }\n";
+    const std::string &shaderString4 =
+        "precision mediump float;\n"
+        "void main() { gl_FragColor = vec4(1.0);; }\n";
+
+    unsigned long long fingerprint = preprocess(shaderString1).fingerprint;
+    EXPECT_NE(fingerprint, preprocess(shaderString2).fingerprint);
+    EXPECT_EQ(fingerprint, preprocess(shaderString3).fingerprint);
+    EXPECT_NE(fingerprint, preprocess(shaderString4).fingerprint);
+}
+
+// The fingerprint is part of cache keys and must not change between
+// releases or platforms.
+TEST_F(PreprocessTest, FingerprintIsStable)
+{
+    EXPECT_EQ(0x0d8299f0f88e9bb4ULL, preprocess("").fingerprint);
+    EXPECT_EQ(0x968927e08df37226ULL, preprocess("void main() {}").fingerprint);
+}
+
+TEST_F(PreprocessTest, Directives)
+{
+    const std::string &shaderString =
+        "#version 100\n"
+        "#extension GL_OES_standard_derivatives : enable\n"
+        "#pragma optimize(off)\n"
+        "#pragma STDGL invariant(all)\n"
+        "precision mediump float;\n"
+        "void main() { gl_FragColor = vec4(dFdx(1.0)); }\n";
+
+    ShPreprocessorOutput output = preprocess(shaderString);
+    EXPECT_EQ(100, output.version);
+
+    ASSERT_EQ(1u, output.extensions.size());
+    EXPECT_EQ("GL_OES_standard_derivatives", output.extensions[0].name);
+    EXPECT_EQ("enable", output.extensions[0].behavior);
+
+    ASSERT_EQ(2u, output.pragmas.size());
+    EXPECT_EQ("optimize", output.pragmas[0].name);
+    EXPECT_EQ("off", output.pragmas[0].value);
+    EXPECT_FALSE(output.pragmas[0].stdgl);
+    EXPECT_EQ("invariant", output.pragmas[1].name);
+    EXPECT_EQ("all", output.pragmas[1].value);
+    EXPECT_TRUE(output.pragmas[1].stdgl);
+
+    // Directives are not part of the text but change the fingerprint.
+    ShPreprocessorOutput withoutPragma = preprocess(
+        "#version 100\n"
+        "#extension GL_OES_standard_derivatives : enable\n"
+        "#pragma STDGL invariant(all)\n"
+        "precision mediump float;\n"
+        "void main() { gl_FragColor = vec4(dFdx(1.0)); }\n");
+    EXPECT_EQ(output.text, withoutPragma.text);
+    EXPECT_NE(output.fingerprint, withoutPragma.fingerprint);
+}
+
+TEST_F(PreprocessTest, ReferencedMacros)
+{
+    const std::string &shaderString =
+        "#define UNUSED 1\n"
+        "#define SCALE 2.0\n"
+        "#if defined(GL_OES_standard_derivatives) && GL_ES\n"
+        "#endif\n"
+        "#ifndef NOT_DEFINED\n"
+        "#endif\n"
+        "precision mediump float;\n"
+        "void main() { gl_FragColor = vec4(SCALE); }\n";
+
+    ShPreprocessorOutput output = preprocess(shaderString);
+    ASSERT_EQ(4u, output.referencedMacros.size());
+    EXPECT_EQ("GL_ES", output.referencedMacros[0]);
+    EXPECT_EQ("GL_OES_standard_derivatives", output.referencedMacros[1]);
+    EXPECT_EQ("NOT_DEFINED", output.referencedMacros[2]);
+    EXPECT_EQ("SCALE", output.referencedMacros[3]);
+    EXPECT_FALSE(referencesMacro(output, "UNUSED"));
+}
+
+TEST_F(PreprocessTest, Errors)
+{
+    const char *shaderStrings[] = { "#if\n#endif\n" };
+    ShPreprocessorOutput output;
+    EXPECT_FALSE(ShPreprocess(mCompiler, shaderStrings, 1, &output));
+    EXPECT_NE(std::string::npos, ShGetInfoLog(mCompiler).find("ERROR"));
+}
+
+TEST_F(PreprocessTest, DoesNotAffectCompile)
+{
+    const std::string &objectCodeShader =
+        "precision mediump float;\n"
+        "void main() { gl_FragColor = vec4(1.0); }\n";
+    const char *compileStrings[] = { objectCodeShader.c_str() };
+    ASSERT_TRUE(ShCompile(mCompiler, compileStrings, 1, SH_OBJECT_CODE));
+    std::string objectCode = ShGetObjectCode(mCompiler);
+
+    // Enabling an extension while preprocessing must not leak into the
+    // next compile.
+    preprocess("#extension GL_OES_standard_derivatives : enable\n");
+    EXPECT_EQ(objectCode, ShGetObjectCode(mCompiler));
+
+    const char *derivativeStrings[] = {
+        "precision mediump float;\n"
+        "void main() { gl_FragColor = vec4(dFdx(1.0)); }\n"
+    };
+    EXPECT_FALSE(ShCompile(mCompiler, derivativeStrings, 1, SH_OBJECT_CODE));
+}
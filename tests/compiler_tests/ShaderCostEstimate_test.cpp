@@ -0,0 +1,317 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ShaderCostEstimate_test.cpp:
+//   Checks ShGetShaderCostEstimate against hand-computed counts.
+//
+
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+#include "GLSLANG/ShaderLang.h"
+
+#include <limits>
+
+class ShaderCostEstimateTest : public testing::Test
+{
+  public:
+    ShaderCostEstimateTest() {}
+
+  protected:
+    virtual void SetUp()
+    {
+        ShBuiltInResources resources;
+        ShInitBuiltInResources(&resources);
+
+        mVertexCompiler = ShConstructCompiler(GL_VERTEX_SHADER, SH_GLES2_SPEC, SH_ESSL_OUTPUT, &resources);
+        mFragmentCompiler = ShConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES2_SPEC, SH_ESSL_OUTPUT, &resources);
+        ASSERT_TRUE(mVertexCompiler != NULL);
+        ASSERT_TRUE(mFragmentCompiler != NULL);
+    }
+
+    virtual void TearDown()
+    {
+        ShDestruct(mVertexCompiler);
+        ShDestruct(mFragmentCompiler);
+    }
+
+    const ShShaderCostEstimate *estimate(ShHandle compiler, const std::string &shaderString,
+                                         int compileOptions)
+    {
+        const char *shaderStrings[] = { shaderString.c_str() };
+        EXPECT_TRUE(ShCompile(compiler, shaderStrings, 1, compileOptions)) << ShGetInfoLog(compiler);
+        return ShGetShaderCostEstimate(compiler);
+    }
+
+    const ShShaderCostEstimate *estimate(ShHandle compiler, const std::string &shaderString)
+    {
+        return estimate(compiler, shaderString,
+                        SH_VALIDATE_LOOP_INDEXING | SH_ESTIMATE_SHADER_COST);
+    }
+
+    const ShShaderCost *findFunction(const ShShaderCostEstimate *estimate, const std::string &name)
+    {
+        for (size_t ii = 0; ii < estimate->functions.size(); ++ii)
+        {
+            if (estimate->functions[ii].name == name)
+                return &estimate->functions[ii].cost;
+        }
+        return NULL;
+    }
+
+    ShHandle mVertexCompiler;
+    ShHandle mFragmentCompiler;
+};
+
+TEST_F(ShaderCostEstimateTest, NotComputedByDefault)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "void main() {\n"
+        "   gl_FragColor = vec4(1.0);\n"
+        "}\n";
+
+    EXPECT_EQ(NULL, estimate(mFragmentCompiler, shaderString, SH_OBJECT_CODE));
+}
+
+TEST_F(ShaderCostEstimateTest, NotComputedOnFailedCompile)
+{
+    const char *shaderStrings[] = { "void main() { undeclared = 1.0; }" };
+    EXPECT_FALSE(ShCompile(mFragmentCompiler, shaderStrings, 1, SH_ESTIMATE_SHADER_COST));
+    EXPECT_EQ(NULL, ShGetShaderCostEstimate(mFragmentCompiler));
+}
+
+TEST_F(ShaderCostEstimateTest, SingleFetch)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "uniform sampler2D s;\n"
+        "varying vec2 v;\n"
+        "void main() {\n"
+        "   vec4 c = texture2D(s, v);\n"
+        "   gl_FragColor = c * 2.0 + 1.0;\n"
+        "}\n";
+
+    const ShShaderCostEstimate *cost = estimate(mFragmentCompiler, shaderString);
+    ASSERT_TRUE(cost != NULL);
+    EXPECT_EQ(2u, cost->total.aluOps);
+    EXPECT_EQ(1u, cost->total.textureFetches);
+    EXPECT_EQ(0u, cost->total.dependentTextureFetches);
+    EXPECT_EQ(0u, cost->total.branches);
+    EXPECT_EQ(0u, cost->total.loops);
+    EXPECT_EQ(1u, cost->total.temporaries);
+    EXPECT_EQ(1u, cost->total.interpolators);
+    EXPECT_EQ(3u, cost->total.weightedInstructions);
+
+    ASSERT_EQ(1u, cost->functions.size());
+    EXPECT_EQ("main(", cost->functions[0].name);
+    EXPECT_EQ(2u, cost->functions[0].cost.aluOps);
+}
+
+TEST_F(ShaderCostEstimateTest, DependentFetch)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "uniform sampler2D s;\n"
+        "uniform sampler2D t;\n"
+        "varying vec2 v;\n"
+        "void main() {\n"
+        "   vec4 a = texture2D(s, v);\n"
+        "   vec4 b = texture2D(t, v);\n"
+        "   gl_FragColor = texture2D(t, a.xy) + b;\n"
+        "}\n";
+
+    const ShShaderCostEstimate *cost = estimate(mFragmentCompiler, shaderString);
+    ASSERT_TRUE(cost != NULL);
+    EXPECT_EQ(1u, cost->total.aluOps);
+    EXPECT_EQ(3u, cost->total.textureFetches);
+    EXPECT_EQ(1u, cost->total.dependentTextureFetches);
+    EXPECT_EQ(2u, cost->total.temporaries);
+    EXPECT_EQ(4u, cost->total.weightedInstructions);
+}
+
+TEST_F(ShaderCostEstimateTest, LoopTripCount)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "uniform float u;\n"
+        "void main() {\n"
+        "   float sum = 0.0;\n"
+        "   for (int i = 0; i < 4; i++) {\n"
+        "       sum += u * 2.0;\n"
+        "   }\n"
+        "   gl_FragColor = vec4(sum);\n"
+        "}\n";
+
+    // Condition, increment, multiply and add, four times each.
+    const ShShaderCostEstimate *cost = estimate(mFragmentCompiler, shaderString);
+    ASSERT_TRUE(cost != NULL);
+    EXPECT_EQ(4u, cost->total.aluOps);
+    EXPECT_EQ(1u, cost->total.loops);
+    EXPECT_EQ(0u, cost->total.unboundedLoops);
+    EXPECT_EQ(2u, cost->total.temporaries);
+    EXPECT_EQ(16u, cost->total.weightedInstructions);
+}
+
+TEST_F(ShaderCostEstimateTest, NestedLoopsAndNegativeStep)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "uniform float u;\n"
+        "void main() {\n"
+        "   float sum = 0.0;\n"
+        "   for (int i = 0; i < 3; i++) {\n"
+        "       for (int j = 0; j < 2; ++j) {\n"
+        "           sum += u;\n"
+        "       }\n"
+        "   }\n"
+        "   for (int k = 10; k > 0; k -= 3) {\n"
+        "       sum -= u;\n"
+        "   }\n"
+        "   gl_FragColor = vec4(sum);\n"
+        "}\n";
+
+    // Outer loop: 2 ops x 3. Inner loop: 3 ops x 6. Last loop runs for
+    // k = 10, 7, 4, 1: 3 ops x 4.
+    const ShShaderCostEstimate *cost = estimate(mFragmentCompiler, shaderString);
+    ASSERT_TRUE(cost != NULL);
+    EXPECT_EQ(8u, cost->total.aluOps);
+    EXPECT_EQ(3u, cost->total.loops);
+    EXPECT_EQ(0u, cost->total.unboundedLoops);
+    EXPECT_EQ(4u, cost->total.temporaries);
+    EXPECT_EQ(36u, cost->total.weightedInstructions);
+}
+
+TEST_F(ShaderCostEstimateTest, NestedLoopWeightsSaturate)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "uniform float u;\n"
+        "void main() {\n"
+        "   float sum = 0.0;\n"
+        "   for (int i = 0; i < 1048576; i++) {\n"
+        "       for (int j = 0; j < 1048576; j++) {\n"
+        "           for (int k = 0; k < 1048576; k++) {\n"
+        "               for (int l = 0; l < 1048576; l++) {\n"
+        "                   sum += u;\n"
+        "               }\n"
+        "           }\n"
+        "       }\n"
+        "   }\n"
+        "   gl_FragColor = vec4(sum);\n"
+        "}\n";
+
+    // The innermost loop runs 2^80 times
+    const ShShaderCostEstimate *cost = estimate(mFragmentCompiler, shaderString);
+    ASSERT_TRUE(cost != NULL);
+    EXPECT_EQ(0u, cost->total.unboundedLoops);
+    EXPECT_EQ(std::numeric_limits<unsigned long long>::max(), cost->total.weightedInstructions);
+}
+
+TEST_F(ShaderCostEstimateTest, UnvalidatedLoopIsUnbounded)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "uniform float u;\n"
+        "void main() {\n"
+        "   float sum = 0.0;\n"
+        "   for (int i = 0; i < 4; i++) {\n"
+        "       sum += u;\n"
+        "   }\n"
+        "   gl_FragColor = vec4(sum);\n"
+        "}\n";
+
+    const ShShaderCostEstimate *cost = estimate(mFragmentCompiler, shaderString, SH_ESTIMATE_SHADER_COST);
+    ASSERT_TRUE(cost != NULL);
+    EXPECT_EQ(3u, cost->total.aluOps);
+    EXPECT_EQ(1u, cost->total.loops);
+    EXPECT_EQ(1u, cost->total.unboundedLoops);
+    EXPECT_EQ(3u, cost->total.weightedInstructions);
+}
+
+TEST_F(ShaderCostEstimateTest, FunctionCallsAndBranches)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "uniform sampler2D s;\n"
+        "varying vec2 v;\n"
+        "vec4 fetch(vec2 uv) {\n"
+        "   return texture2D(s, uv * 0.5);\n"
+        "}\n"
+        "void main() {\n"
+        "   vec4 c = fetch(v);\n"
+        "   if (c.x > 0.5) {\n"
+        "       c = fetch(v + 1.0);\n"
+        "   }\n"
+        "   gl_FragColor = c.y > 0.0 ? c : vec4(0.0);\n"
+        "}\n";
+
+    const ShShaderCostEstimate *cost = estimate(mFragmentCompiler, shaderString);
+    ASSERT_TRUE(cost != NULL);
+
+    ASSERT_EQ(2u, cost->functions.size());
+    EXPECT_EQ("fetch(vf2;", cost->functions[0].name);
+    EXPECT_EQ("main(", cost->functions[1].name);
+
+    const ShShaderCost *fetch = findFunction(cost, "fetch(vf2;");
+    ASSERT_TRUE(fetch != NULL);
+    EXPECT_EQ(1u, fetch->aluOps);
+    EXPECT_EQ(1u, fetch->textureFetches);
+    EXPECT_EQ(0u, fetch->branches);
+    EXPECT_EQ(0u, fetch->temporaries);
+    EXPECT_EQ(0u, fetch->interpolators);
+    EXPECT_EQ(2u, fetch->weightedInstructions);
+
+    // main() itself has three ALU ops and inlines fetch() twice.
+    EXPECT_EQ(5u, cost->total.aluOps);
+    EXPECT_EQ(2u, cost->total.textureFetches);
+    EXPECT_EQ(2u, cost->total.branches);
+    EXPECT_EQ(1u, cost->total.temporaries);
+    EXPECT_EQ(1u, cost->total.interpolators);
+    EXPECT_EQ(7u, cost->total.weightedInstructions);
+}
+
+TEST_F(ShaderCostEstimateTest, CallInsideLoop)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "uniform float u;\n"
+        "float twice(float x) {\n"
+        "   return x * 2.0;\n"
+        "}\n"
+        "void main() {\n"
+        "   float sum = 0.0;\n"
+        "   for (int i = 0; i < 8; i++) {\n"
+        "       sum += twice(u);\n"
+        "   }\n"
+        "   gl_FragColor = vec4(sum);\n"
+        "}\n";
+
+    // Condition, increment, add and the inlined multiply, eight times each.
+    const ShShaderCostEstimate *cost = estimate(mFragmentCompiler, shaderString);
+    ASSERT_TRUE(cost != NULL);
+    EXPECT_EQ(4u, cost->total.aluOps);
+    EXPECT_EQ(32u, cost->total.weightedInstructions);
+}
+
+TEST_F(ShaderCostEstimateTest, Interpolators)
+{
+    const std::string &shaderString =
+        "attribute vec4 a;\n"
+        "varying mat3 m;\n"
+        "varying vec4 arr[2];\n"
+        "varying float unused;\n"
+        "void main() {\n"
+        "   m = mat3(1.0);\n"
+        "   arr[0] = a;\n"
+        "   arr[1] = a;\n"
+        "   gl_Position = a;\n"
+        "}\n";
+
+    const ShShaderCostEstimate *cost = estimate(mVertexCompiler, shaderString);
+    ASSERT_TRUE(cost != NULL);
+    EXPECT_EQ(5u, cost->total.interpolators);
+    EXPECT_EQ(0u, cost->total.aluOps);
+    EXPECT_EQ(0u, cost->total.temporaries);
+}
@@ -0,0 +1,76 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "ColorRowCopy.h"
+
+#include "libGLESv2/renderer/copyimage.h"
+
+#include <sstream>
+
+std::string ColorRowCopyParams::suffix() const
+{
+    std::stringstream strstr;
+
+    strstr << "_" << pairName << (rows ? "_rows" : "_per_pixel");
+
+    return strstr.str();
+}
+
+ColorRowCopyBenchmark::ColorRowCopyBenchmark(const ColorRowCopyParams &params)
+    : ImplementationBenchmark("ColorRowCopy", params.suffix()),
+      mCopyRowFunction(NULL),
+      mParams(params)
+{
+}
+
+bool ColorRowCopyBenchmark::initializeBenchmark()
+{
+    mCopyRowFunction = rx::GetColorRowCopyFunction(mParams.readFunction, mParams.sourcePixelBytes,
+                                                   mParams.writeFunction, mParams.destPixelBytes);
+    if (!mCopyRowFunction)
+    {
+        return false;
+    }
+
+    mSource.resize(mParams.width * mParams.height * mParams.sourcePixelBytes);
+    mDest.resize(mParams.width * mParams.height * mParams.destPixelBytes);
+
+    // Values that are valid in every format, half floats included
+    for (size_t i = 0; i < mSource.size(); i++)
+    {
+        mSource[i] = static_cast<uint8_t>((i * 7) & 0x3F);
+    }
+
+    mBytesPerIteration = mSource.size() + mDest.size();
+
+    return true;
+}
+
+void ColorRowCopyBenchmark::stepBenchmark()
+{
+    const size_t sourceRowPitch = mParams.width * mParams.sourcePixelBytes;
+    const size_t destRowPitch = mParams.width * mParams.destPixelBytes;
+
+    for (size_t y = 0; y < mParams.height; y++)
+    {
+        const uint8_t *source = &mSource[y * sourceRowPitch];
+        uint8_t *dest = &mDest[y * destRowPitch];
+
+        if (mParams.rows)
+        {
+            mCopyRowFunction(mParams.width, source, dest);
+        }
+        else
+        {
+            uint8_t temp[16];
+            for (size_t x = 0; x < mParams.width; x++)
+            {
+                mParams.readFunction(source + x * mParams.sourcePixelBytes, temp);
+                mParams.writeFunction(temp, dest + x * mParams.destPixelBytes);
+            }
+        }
+    }
+}
@@ -0,0 +1,43 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "ImplementationBenchmark.h"
+
+#include "libGLESv2/formatutils.h"
+
+struct ColorRowCopyParams
+{
+    std::string suffix() const;
+
+    const char *pairName;
+    ColorReadFunction readFunction;
+    size_t sourcePixelBytes;
+    ColorWriteFunction writeFunction;
+    size_t destPixelBytes;
+    size_t width;
+    size_t height;
+
+    // Whether to use the row copy, or the read and write functions for each
+    // pixel like readPixels did before
+    bool rows;
+};
+
+// Measures converting an image between two formats, as done by readPixels.
+class ColorRowCopyBenchmark : public ImplementationBenchmark
+{
+  public:
+    ColorRowCopyBenchmark(const ColorRowCopyParams &params);
+
+    virtual bool initializeBenchmark();
+    virtual void stepBenchmark();
+
+  private:
+    ColorRowCopyFunction mCopyRowFunction;
+    std::vector<uint8_t> mSource;
+    std::vector<uint8_t> mDest;
+
+    const ColorRowCopyParams mParams;
+};
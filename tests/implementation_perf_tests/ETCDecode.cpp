@@ -0,0 +1,55 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "ETCDecode.h"
+
+#include <sstream>
+
+std::string ETCDecodeParams::suffix() const
+{
+    std::stringstream strstr;
+
+    strstr << "_" << formatName << "_" << width << "x" << height << "_" << threads << "threads";
+
+    return strstr.str();
+}
+
+ETCDecodeBenchmark::ETCDecodeBenchmark(const ETCDecodeParams &params)
+    : ImplementationBenchmark("ETCDecode", params.suffix()),
+      mParams(params)
+{
+}
+
+bool ETCDecodeBenchmark::initializeBenchmark()
+{
+    mExecutor.reset(new rx::ImageLoadExecutor(mParams.threads, rx::ImageLoadExecutor::DefaultMinParallelBytes));
+
+    // Random blocks, which use every mode
+    size_t blockCount = ((mParams.width + 3) / 4) * ((mParams.height + 3) / 4);
+    mInput.resize(blockCount * mParams.blockBytes);
+    mOutput.resize(mParams.width * mParams.height * mParams.outputPixelBytes);
+    uint32_t seed = 1;
+    for (size_t i = 0; i < mInput.size(); i++)
+    {
+        seed = seed * 1664525 + 1013904223;
+        mInput[i] = static_cast<uint8_t>(seed >> 24);
+    }
+
+    mBytesPerIteration = mInput.size() + mOutput.size();
+    mPixelsPerIteration = mParams.width * mParams.height;
+
+    return true;
+}
+
+void ETCDecodeBenchmark::stepBenchmark()
+{
+    size_t inputRowPitch = ((mParams.width + 3) / 4) * mParams.blockBytes;
+    size_t outputRowPitch = mParams.width * mParams.outputPixelBytes;
+
+    mExecutor->loadBlocks(mParams.loadFunction, 4, mParams.width, mParams.height, 1,
+                          &mInput[0], inputRowPitch, mInput.size(),
+                          &mOutput[0], outputRowPitch, mOutput.size());
+}
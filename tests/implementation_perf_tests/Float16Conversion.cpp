@@ -0,0 +1,99 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "Float16Conversion.h"
+
+#include "common/cpufeatures.h"
+#include "common/float16.h"
+#include "common/mathutil.h"
+
+#include <sstream>
+
+std::string Float16ConversionParams::suffix() const
+{
+    std::stringstream strstr;
+
+    strstr << (toFloat16 ? "_to_float16" : "_to_float32");
+    switch (version)
+    {
+      case FLOAT16_CONVERSION_SINGLE:   strstr << "_single";   break;
+      case FLOAT16_CONVERSION_PORTABLE: strstr << "_portable"; break;
+      case FLOAT16_CONVERSION_F16C:     strstr << "_f16c";     break;
+    }
+
+    return strstr.str();
+}
+
+Float16ConversionBenchmark::Float16ConversionBenchmark(const Float16ConversionParams &params)
+    : ImplementationBenchmark("Float16Conversion", params.suffix()),
+      mParams(params)
+{
+}
+
+bool Float16ConversionBenchmark::initializeBenchmark()
+{
+    if (mParams.version == FLOAT16_CONVERSION_F16C && !gl::GetCPUFeatures().f16c)
+    {
+        return false;
+    }
+
+    mFloats.resize(mParams.count);
+    mHalfs.resize(mParams.count);
+    for (size_t i = 0; i < mParams.count; i++)
+    {
+        mFloats[i] = static_cast<float>(i % 4096) * 0.25f - 512.0f;
+    }
+    gl::ConvertFloat32ToFloat16Portable(&mFloats[0], &mHalfs[0], mParams.count);
+
+    mBytesPerIteration = mParams.count * (sizeof(float) + sizeof(uint16_t));
+
+    return true;
+}
+
+void Float16ConversionBenchmark::stepBenchmark()
+{
+    switch (mParams.version)
+    {
+      case FLOAT16_CONVERSION_SINGLE:
+        if (mParams.toFloat16)
+        {
+            for (size_t i = 0; i < mParams.count; i++)
+            {
+                mHalfs[i] = gl::float32ToFloat16(mFloats[i]);
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < mParams.count; i++)
+            {
+                mFloats[i] = gl::float16ToFloat32(mHalfs[i]);
+            }
+        }
+        break;
+
+      case FLOAT16_CONVERSION_PORTABLE:
+        if (mParams.toFloat16)
+        {
+            gl::ConvertFloat32ToFloat16Portable(&mFloats[0], &mHalfs[0], mParams.count);
+        }
+        else
+        {
+            gl::ConvertFloat16ToFloat32Portable(&mHalfs[0], &mFloats[0], mParams.count);
+        }
+        break;
+
+      case FLOAT16_CONVERSION_F16C:
+        if (mParams.toFloat16)
+        {
+            gl::ConvertFloat32ToFloat16F16C(&mFloats[0], &mHalfs[0], mParams.count);
+        }
+        else
+        {
+            gl::ConvertFloat16ToFloat32F16C(&mHalfs[0], &mFloats[0], mParams.count);
+        }
+        break;
+    }
+}
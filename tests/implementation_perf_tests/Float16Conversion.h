@@ -0,0 +1,42 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "ImplementationBenchmark.h"
+
+#include <cstdint>
+
+enum Float16ConversionVersion
+{
+    // gl::float32ToFloat16 and the gl::float16ToFloat32 tables, one value at a time
+    FLOAT16_CONVERSION_SINGLE,
+    FLOAT16_CONVERSION_PORTABLE,
+    FLOAT16_CONVERSION_F16C,
+};
+
+struct Float16ConversionParams
+{
+    std::string suffix() const;
+
+    // Converts floats to half floats if true, the other way otherwise.
+    bool toFloat16;
+    Float16ConversionVersion version;
+    size_t count;
+};
+
+class Float16ConversionBenchmark : public ImplementationBenchmark
+{
+  public:
+    Float16ConversionBenchmark(const Float16ConversionParams &params);
+
+    virtual bool initializeBenchmark();
+    virtual void stepBenchmark();
+
+  private:
+    std::vector<float> mFloats;
+    std::vector<uint16_t> mHalfs;
+
+    const Float16ConversionParams mParams;
+};
@@ -0,0 +1,97 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "FormatInfoLookup.h"
+
+#include <sstream>
+
+std::string FormatInfoLookupParams::suffix() const
+{
+    std::stringstream strstr;
+
+    strstr << (stdMap ? "_std_map" : "_table");
+
+    return strstr.str();
+}
+
+FormatInfoLookupBenchmark::FormatInfoLookupBenchmark(const FormatInfoLookupParams &params)
+    : ImplementationBenchmark("FormatInfoLookup", params.suffix()),
+      mTotalBytes(0),
+      mParams(params)
+{
+}
+
+bool FormatInfoLookupBenchmark::initializeBenchmark()
+{
+    // Every enum the queries know, which are all below 0x10000
+    std::vector<GLenum> internalFormats;
+    for (GLenum value = 0; value < 0x10000; value++)
+    {
+        const gl::InternalFormat &formatInfo = gl::GetInternalFormatInfo(value);
+        if (formatInfo.format != GL_NONE)
+        {
+            internalFormats.push_back(value);
+            mInternalFormatMap[value] = formatInfo;
+        }
+
+        const gl::Type &typeInfo = gl::GetTypeInfo(value);
+        if (typeInfo.bytes > 0)
+        {
+            mTypeMap[value] = typeInfo;
+        }
+    }
+
+    if (internalFormats.empty())
+    {
+        return false;
+    }
+
+    // Formats in a pseudo-random order, as a mix of textures would use them
+    unsigned int seed = 1;
+    for (size_t lookupIndex = 0; lookupIndex < mParams.lookupsPerStep; lookupIndex++)
+    {
+        seed = seed * 1664525 + 1013904223;
+        GLenum internalFormat = internalFormats[(seed >> 8) % internalFormats.size()];
+        const gl::InternalFormat &formatInfo = gl::GetInternalFormatInfo(internalFormat);
+
+        Lookup lookup = { internalFormat, (formatInfo.type != GL_NONE) ? formatInfo.type : GL_UNSIGNED_BYTE };
+        mLookups.push_back(lookup);
+    }
+
+    return true;
+}
+
+void FormatInfoLookupBenchmark::destroyBenchmark()
+{
+    // Keeps the lookups from being optimized away
+    printResult("total_bytes", mTotalBytes, "bytes", false);
+}
+
+void FormatInfoLookupBenchmark::stepBenchmark()
+{
+    size_t totalBytes = 0;
+
+    if (mParams.stdMap)
+    {
+        for (size_t lookupIndex = 0; lookupIndex < mLookups.size(); lookupIndex++)
+        {
+            const Lookup &lookup = mLookups[lookupIndex];
+            totalBytes += mInternalFormatMap.find(lookup.internalFormat)->second.pixelBytes;
+            totalBytes += mTypeMap.find(lookup.type)->second.bytes;
+        }
+    }
+    else
+    {
+        for (size_t lookupIndex = 0; lookupIndex < mLookups.size(); lookupIndex++)
+        {
+            const Lookup &lookup = mLookups[lookupIndex];
+            totalBytes += gl::GetInternalFormatInfo(lookup.internalFormat).pixelBytes;
+            totalBytes += gl::GetTypeInfo(lookup.type).bytes;
+        }
+    }
+
+    mTotalBytes += totalBytes;
+}
@@ -0,0 +1,48 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "ImplementationBenchmark.h"
+
+#include "libGLESv2/formatutils.h"
+
+#include <map>
+
+struct FormatInfoLookupParams
+{
+    std::string suffix() const;
+
+    // Whether the lookups go through std::maps holding the same answers, as the
+    // format queries did before their tables were flattened
+    bool stdMap;
+
+    size_t lookupsPerStep;
+};
+
+// Looks up the internal format and type of a pixel transfer, as the validation of
+// glTexImage*, glTexSubImage* and glReadPixels and texture completeness checks do.
+class FormatInfoLookupBenchmark : public ImplementationBenchmark
+{
+  public:
+    FormatInfoLookupBenchmark(const FormatInfoLookupParams &params);
+
+    virtual bool initializeBenchmark();
+    virtual void destroyBenchmark();
+    virtual void stepBenchmark();
+
+  private:
+    struct Lookup
+    {
+        GLenum internalFormat;
+        GLenum type;
+    };
+
+    std::vector<Lookup> mLookups;
+    std::map<GLenum, gl::InternalFormat> mInternalFormatMap;
+    std::map<GLenum, gl::Type> mTypeMap;
+    size_t mTotalBytes;
+
+    const FormatInfoLookupParams mParams;
+};
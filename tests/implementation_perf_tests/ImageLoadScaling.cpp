@@ -0,0 +1,56 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "ImageLoadScaling.h"
+
+#include <sstream>
+
+std::string ImageLoadScalingParams::suffix() const
+{
+    std::stringstream strstr;
+
+    strstr << "_" << formatName << "_" << width << "x" << height;
+    if (depth > 1)
+    {
+        strstr << "x" << depth;
+    }
+    strstr << "_" << threads << "threads";
+
+    return strstr.str();
+}
+
+ImageLoadScalingBenchmark::ImageLoadScalingBenchmark(const ImageLoadScalingParams &params)
+    : ImplementationBenchmark("ImageLoadScaling", params.suffix()),
+      mParams(params)
+{
+}
+
+bool ImageLoadScalingBenchmark::initializeBenchmark()
+{
+    mExecutor.reset(new rx::ImageLoadExecutor(mParams.threads, rx::ImageLoadExecutor::DefaultMinParallelBytes));
+
+    size_t pixelCount = mParams.width * mParams.height * mParams.depth;
+    mInput.resize(pixelCount * mParams.inputPixelBytes);
+    mOutput.resize(pixelCount * mParams.outputPixelBytes);
+    for (size_t i = 0; i < mInput.size(); i++)
+    {
+        mInput[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    mBytesPerIteration = mInput.size() + mOutput.size();
+
+    return true;
+}
+
+void ImageLoadScalingBenchmark::stepBenchmark()
+{
+    size_t inputRowPitch = mParams.width * mParams.inputPixelBytes;
+    size_t outputRowPitch = mParams.width * mParams.outputPixelBytes;
+
+    mExecutor->load(mParams.loadFunction, mParams.width, mParams.height, mParams.depth,
+                    &mInput[0], inputRowPitch, inputRowPitch * mParams.height,
+                    &mOutput[0], outputRowPitch, outputRowPitch * mParams.height);
+}
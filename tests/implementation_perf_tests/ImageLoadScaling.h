@@ -0,0 +1,41 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "ImplementationBenchmark.h"
+
+#include "libGLESv2/renderer/ImageLoadExecutor.h"
+
+struct ImageLoadScalingParams
+{
+    std::string suffix() const;
+
+    const char *formatName;
+    LoadImageFunction loadFunction;
+    size_t inputPixelBytes;
+    size_t outputPixelBytes;
+
+    size_t width;
+    size_t height;
+    size_t depth;
+    size_t threads;
+};
+
+// Measures how large loads scale with the threads of rx::ImageLoadExecutor.
+class ImageLoadScalingBenchmark : public ImplementationBenchmark
+{
+  public:
+    ImageLoadScalingBenchmark(const ImageLoadScalingParams &params);
+
+    virtual bool initializeBenchmark();
+    virtual void stepBenchmark();
+
+  private:
+    std::unique_ptr<rx::ImageLoadExecutor> mExecutor;
+    std::vector<uint8_t> mInput;
+    std::vector<uint8_t> mOutput;
+
+    const ImageLoadScalingParams mParams;
+};
@@ -0,0 +1,68 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "ImplementationBenchmark.h"
+
+#include "third_party/perf/perf_test.h"
+
+ImplementationBenchmark::ImplementationBenchmark(const std::string &name, const std::string &suffix)
+    : mRunTimeSeconds(1.0),
+      mBytesPerIteration(0),
+      mPixelsPerIteration(0),
+      mName(name),
+      mSuffix(suffix)
+{
+    mTimer.reset(CreateTimer());
+}
+
+void ImplementationBenchmark::printResult(const std::string &trace, double value, const std::string &units, bool important) const
+{
+    perf_test::PrintResult(mName, mSuffix, trace, value, units, important);
+}
+
+void ImplementationBenchmark::printResult(const std::string &trace, size_t value, const std::string &units, bool important) const
+{
+    perf_test::PrintResult(mName, mSuffix, trace, value, units, important);
+}
+
+int ImplementationBenchmark::run()
+{
+    if (!initializeBenchmark())
+    {
+        destroyBenchmark();
+        return -1;
+    }
+
+    // Warm up the caches and any lazily built tables
+    stepBenchmark();
+
+    size_t iterations = 0;
+    mTimer->start();
+    while (mTimer->getElapsedTime() < mRunTimeSeconds)
+    {
+        stepBenchmark();
+        iterations++;
+    }
+    mTimer->stop();
+
+    double totalTime = mTimer->getElapsedTime();
+    double averageTime = totalTime / static_cast<double>(iterations);
+
+    printResult("total_time", totalTime, "s", true);
+    printResult("iterations", iterations, "iterations", true);
+    printResult("average_time", 1000.0 * averageTime, "ms", true);
+    if (mBytesPerIteration > 0)
+    {
+        printResult("throughput", static_cast<double>(mBytesPerIteration) / averageTime / 1.0e9, "GB/s", true);
+    }
+    if (mPixelsPerIteration > 0)
+    {
+        printResult("pixel_rate", static_cast<double>(mPixelsPerIteration) / averageTime / 1.0e6, "MP/s", true);
+    }
+
+    destroyBenchmark();
+    return 0;
+}
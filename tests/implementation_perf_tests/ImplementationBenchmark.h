@@ -0,0 +1,71 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// ImplementationBenchmark.h: Base class for benchmarks that call into the
+// libGLESv2 implementation directly, without a window or a GL context.
+
+#ifndef IMPLEMENTATION_PERF_TESTS_IMPLEMENTATION_BENCHMARK_H
+#define IMPLEMENTATION_PERF_TESTS_IMPLEMENTATION_BENCHMARK_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Timer.h"
+
+class ImplementationBenchmark
+{
+  public:
+    ImplementationBenchmark(const std::string &name, const std::string &suffix);
+
+    virtual ~ImplementationBenchmark() { }
+
+    virtual bool initializeBenchmark() { return true; }
+    virtual void destroyBenchmark() { }
+
+    // One timed iteration.
+    virtual void stepBenchmark() = 0;
+
+    int run();
+
+  protected:
+    void printResult(const std::string &trace, double value, const std::string &units, bool important) const;
+    void printResult(const std::string &trace, size_t value, const std::string &units, bool important) const;
+
+    double mRunTimeSeconds;
+
+    // Bytes read and written by one iteration. When set, the throughput is
+    // reported along with the times.
+    size_t mBytesPerIteration;
+
+    // Pixels produced by one iteration. When set, the pixel rate is reported
+    // too.
+    size_t mPixelsPerIteration;
+
+  private:
+    ImplementationBenchmark(const ImplementationBenchmark &);
+    ImplementationBenchmark &operator=(const ImplementationBenchmark &);
+
+    std::string mName;
+    std::string mSuffix;
+
+    std::unique_ptr<Timer> mTimer;
+};
+
+template <typename BenchmarkT, typename ParamsT>
+inline int RunImplementationBenchmarks(const std::vector<ParamsT> &benchmarks)
+{
+    for (size_t benchIndex = 0; benchIndex < benchmarks.size(); benchIndex++)
+    {
+        BenchmarkT benchmark(benchmarks[benchIndex]);
+        int result = benchmark.run();
+        if (result != 0) { return result; }
+    }
+
+    return 0;
+}
+
+#endif // IMPLEMENTATION_PERF_TESTS_IMPLEMENTATION_BENCHMARK_H
@@ -0,0 +1,397 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "ImplementationBenchmark.h"
+#include "ColorRowCopy.h"
+#include "ETCDecode.h"
+#include "Float16Conversion.h"
+#include "FormatInfoLookup.h"
+#include "ImageLoadScaling.h"
+#include "IndexConversion.h"
+#include "IndexRangeInvalidation.h"
+#include "LoadImage.h"
+#include "MipChain.h"
+#include "PackedFloatConversion.h"
+#include "ProgramCacheLookup.h"
+#include "ResourceMapLookup.h"
+#include "SamplerCompleteness.h"
+#include "UniformNameLookup.h"
+#include "UniformTableLoad.h"
+#include "VertexConversion.h"
+
+#include "common/cpufeatures.h"
+#include "libGLESv2/renderer/copyimage.h"
+#include "libGLESv2/renderer/loadimage.h"
+
+#include <thread>
+
+int main(int argc, char **argv)
+{
+    std::vector<LoadImageParams> loadImageParams;
+
+    for (int kernelIt = 0; kernelIt < rx::LOAD_IMAGE_KERNEL_COUNT; kernelIt++)
+    {
+        rx::LoadImageKernel kernel = static_cast<rx::LoadImageKernel>(kernelIt);
+
+        // Only the versions this CPU can run, and only levels with their own version
+        for (int levelIt = gl::SIMD_SCALAR; levelIt <= gl::GetSIMDLevel(); levelIt++)
+        {
+            gl::SIMDLevel level = static_cast<gl::SIMDLevel>(levelIt);
+            if (!rx::GetLoadImageKernel(kernel, level))
+            {
+                continue;
+            }
+
+            LoadImageParams params;
+            params.kernel = kernel;
+            params.level = level;
+            params.width = 2048;
+            params.height = 2048;
+
+            loadImageParams.push_back(params);
+        }
+    }
+
+    int result = RunImplementationBenchmarks<LoadImageBenchmark>(loadImageParams);
+    if (result != 0) { return result; }
+
+    std::vector<Float16ConversionParams> float16Params;
+
+    for (size_t directionIt = 0; directionIt < 2; directionIt++)
+    {
+        for (int versionIt = FLOAT16_CONVERSION_SINGLE; versionIt <= FLOAT16_CONVERSION_F16C; versionIt++)
+        {
+            if (versionIt == FLOAT16_CONVERSION_F16C && !gl::GetCPUFeatures().f16c)
+            {
+                continue;
+            }
+
+            Float16ConversionParams params;
+            params.toFloat16 = (directionIt == 0);
+            params.version = static_cast<Float16ConversionVersion>(versionIt);
+            params.count = 1024 * 1024;
+
+            float16Params.push_back(params);
+        }
+    }
+
+    result = RunImplementationBenchmarks<Float16ConversionBenchmark>(float16Params);
+    if (result != 0) { return result; }
+
+    std::vector<PackedFloatConversionParams> packedFloatParams;
+
+    for (int formatIt = PACKED_FLOAT_RGB9E5; formatIt <= PACKED_FLOAT_R11G11B10F; formatIt++)
+    {
+        for (size_t directionIt = 0; directionIt < 2; directionIt++)
+        {
+            for (int versionIt = PACKED_FLOAT_CONVERSION_PORTABLE; versionIt <= PACKED_FLOAT_CONVERSION_AVX2; versionIt++)
+            {
+                if ((versionIt == PACKED_FLOAT_CONVERSION_SSE2 && !gl::GetCPUFeatures().sse2) ||
+                    (versionIt == PACKED_FLOAT_CONVERSION_AVX2 && !gl::GetCPUFeatures().avx2))
+                {
+                    continue;
+                }
+
+                PackedFloatConversionParams params;
+                params.format = static_cast<PackedFloatFormat>(formatIt);
+                params.toPacked = (directionIt == 0);
+                params.version = static_cast<PackedFloatConversionVersion>(versionIt);
+                params.count = 1024 * 1024;
+
+                packedFloatParams.push_back(params);
+            }
+        }
+    }
+
+    result = RunImplementationBenchmarks<PackedFloatConversionBenchmark>(packedFloatParams);
+    if (result != 0) { return result; }
+
+    const ImageLoadScalingParams scalingFormats[] =
+    {
+        { "RGB8ToBGRX8",     rx::LoadRGB8ToBGRX8,     3,  4, 4096, 4096, 1,   0 },
+        { "RGBA8ToBGRA8",    rx::LoadRGBA8ToBGRA8,    4,  4, 4096, 4096, 1,   0 },
+        { "RGB32FToRGBA16F", rx::LoadRGB32FToRGBA16F, 12, 8, 2048, 2048, 1,   0 },
+        { "RGBA8ToBGRA8",    rx::LoadRGBA8ToBGRA8,    4,  4, 256,  256,  256, 0 },
+    };
+    const size_t maxThreads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+
+    std::vector<ImageLoadScalingParams> scalingParams;
+
+    for (size_t formatIt = 0; formatIt < ArraySize(scalingFormats); formatIt++)
+    {
+        for (size_t threads = 1; threads <= maxThreads; threads *= 2)
+        {
+            ImageLoadScalingParams params = scalingFormats[formatIt];
+            params.threads = threads;
+
+            scalingParams.push_back(params);
+        }
+    }
+
+    result = RunImplementationBenchmarks<ImageLoadScalingBenchmark>(scalingParams);
+    if (result != 0) { return result; }
+
+    const ETCDecodeParams etcFormats[] =
+    {
+        { "RGB8",   rx::LoadETC2RGB8ToRGBA8,   8,  4, 2048, 2048, 0 },
+        { "RGB8A1", rx::LoadETC2RGB8A1ToRGBA8, 8,  4, 2048, 2048, 0 },
+        { "RGBA8",  rx::LoadETC2RGBA8ToRGBA8,  16, 4, 2048, 2048, 0 },
+        { "R11",    rx::LoadEACR11ToR16,       8,  2, 2048, 2048, 0 },
+        { "RG11",   rx::LoadEACRG11ToRG16,     16, 4, 2048, 2048, 0 },
+    };
+
+    std::vector<ETCDecodeParams> etcParams;
+
+    for (size_t formatIt = 0; formatIt < ArraySize(etcFormats); formatIt++)
+    {
+        for (size_t threads = 1; threads <= maxThreads; threads *= 2)
+        {
+            ETCDecodeParams params = etcFormats[formatIt];
+            params.threads = threads;
+
+            etcParams.push_back(params);
+        }
+    }
+
+    result = RunImplementationBenchmarks<ETCDecodeBenchmark>(etcParams);
+    if (result != 0) { return result; }
+
+    std::vector<IndexConversionParams> indexConversionParams;
+
+    for (int kernelIt = 0; kernelIt < rx::INDEX_CONVERSION_KERNEL_COUNT; kernelIt++)
+    {
+        for (int levelIt = gl::SIMD_SCALAR; levelIt <= gl::GetSIMDLevel(); levelIt++)
+        {
+            IndexConversionParams params;
+            params.kernel = static_cast<rx::IndexConversionKernel>(kernelIt);
+            params.level = static_cast<gl::SIMDLevel>(levelIt);
+            if (!rx::GetIndexConversionFunctions(params.kernel, params.level))
+            {
+                continue;
+            }
+
+            // From streams that fit in the caches to ones far larger
+            for (size_t count = 1000000; count <= 100000000; count *= 10)
+            {
+                params.count = count;
+                indexConversionParams.push_back(params);
+            }
+        }
+    }
+
+    result = RunImplementationBenchmarks<IndexConversionBenchmark>(indexConversionParams);
+    if (result != 0) { return result; }
+
+    const IndexRangeInvalidationParams indexRangeInvalidations[] =
+    {
+        { 10000, 64,   16 },
+        { 10000, 4096, 16 },
+        { 1000,  64,   16 },
+    };
+
+    std::vector<IndexRangeInvalidationParams> indexRangeInvalidationParams(indexRangeInvalidations,
+                                                                           indexRangeInvalidations + ArraySize(indexRangeInvalidations));
+
+    result = RunImplementationBenchmarks<IndexRangeInvalidationBenchmark>(indexRangeInvalidationParams);
+    if (result != 0) { return result; }
+
+    std::vector<FormatInfoLookupParams> formatInfoLookupParams;
+
+    for (int mapIt = 0; mapIt < 2; mapIt++)
+    {
+        FormatInfoLookupParams params;
+        params.stdMap = (mapIt == 1);
+        params.lookupsPerStep = 100000;
+        formatInfoLookupParams.push_back(params);
+    }
+
+    result = RunImplementationBenchmarks<FormatInfoLookupBenchmark>(formatInfoLookupParams);
+    if (result != 0) { return result; }
+
+    std::vector<ResourceMapLookupParams> resourceMapLookupParams;
+
+    for (int sparseIt = 0; sparseIt < 2; sparseIt++)
+    {
+        for (int hashIt = 0; hashIt < 2; hashIt++)
+        {
+            for (size_t objectCount = 100; objectCount <= 10000; objectCount *= 10)
+            {
+                ResourceMapLookupParams params;
+                params.sparseNames = (sparseIt == 1);
+                params.hashMap = (hashIt == 1);
+                params.objectCount = objectCount;
+                params.lookupsPerStep = 100000;
+                resourceMapLookupParams.push_back(params);
+            }
+        }
+    }
+
+    result = RunImplementationBenchmarks<ResourceMapLookupBenchmark>(resourceMapLookupParams);
+    if (result != 0) { return result; }
+
+    std::vector<SamplerCompletenessParams> samplerCompletenessParams;
+
+    for (int changeIt = 0; changeIt < 2; changeIt++)
+    {
+        SamplerCompletenessParams params;
+        params.changeSampler = (changeIt == 1);
+        params.textureCount = 16;
+        params.drawsPerStep = 10000;
+        samplerCompletenessParams.push_back(params);
+    }
+
+    result = RunImplementationBenchmarks<SamplerCompletenessBenchmark>(samplerCompletenessParams);
+    if (result != 0) { return result; }
+
+    std::vector<ProgramCacheLookupParams> programCacheLookupParams;
+
+    for (int directoryIt = 0; directoryIt < 2; directoryIt++)
+    {
+        for (int warmIt = 0; warmIt < 2; warmIt++)
+        {
+            ProgramCacheLookupParams params;
+            params.directoryStore = (directoryIt == 1);
+            params.warm = (warmIt == 1);
+            params.binarySize = 64 * 1024;
+            params.linksPerStep = 10;
+            programCacheLookupParams.push_back(params);
+        }
+    }
+
+    result = RunImplementationBenchmarks<ProgramCacheLookupBenchmark>(programCacheLookupParams);
+    if (result != 0) { return result; }
+
+    std::vector<UniformTableLoadParams> uniformTableLoadParams;
+
+    for (int bulkIt = 0; bulkIt < 2; bulkIt++)
+    {
+        for (size_t uniformCount = 16; uniformCount <= 1024; uniformCount *= 8)
+        {
+            UniformTableLoadParams params;
+            params.bulk = (bulkIt == 1);
+            params.uniformCount = uniformCount;
+            params.loadsPerStep = 1000;
+            uniformTableLoadParams.push_back(params);
+        }
+    }
+
+    result = RunImplementationBenchmarks<UniformTableLoadBenchmark>(uniformTableLoadParams);
+    if (result != 0) { return result; }
+
+    std::vector<UniformNameLookupParams> uniformNameLookupParams;
+
+    for (int linearIt = 0; linearIt < 2; linearIt++)
+    {
+        for (size_t arraySize = 16; arraySize <= 1024; arraySize *= 8)
+        {
+            UniformNameLookupParams params;
+            params.linearSearch = (linearIt == 1);
+            params.arraySize = arraySize;
+            params.lookupsPerStep = 10000;
+            uniformNameLookupParams.push_back(params);
+        }
+    }
+
+    result = RunImplementationBenchmarks<UniformNameLookupBenchmark>(uniformNameLookupParams);
+    if (result != 0) { return result; }
+
+    std::vector<VertexConversionParams> vertexConversionParams;
+
+    for (int kernelIt = 0; kernelIt < rx::VERTEX_COPY_KERNEL_COUNT; kernelIt++)
+    {
+        for (int levelIt = gl::SIMD_SCALAR; levelIt <= gl::GetSIMDLevel(); levelIt++)
+        {
+            VertexConversionParams params;
+            params.kernel = static_cast<rx::VertexCopyKernel>(kernelIt);
+            params.level = static_cast<gl::SIMDLevel>(levelIt);
+            if (!rx::GetVertexCopyFunction(params.kernel, params.level))
+            {
+                continue;
+            }
+
+            // A million interleaved 32-byte vertices
+            params.count = 1000000;
+            params.stride = 32;
+            for (size_t threads = 1; threads <= maxThreads; threads *= 2)
+            {
+                params.threads = threads;
+                vertexConversionParams.push_back(params);
+            }
+        }
+    }
+
+    result = RunImplementationBenchmarks<VertexConversionBenchmark>(vertexConversionParams);
+    if (result != 0) { return result; }
+
+    const MipChainParams mipChainFormats[] =
+    {
+        { "RGBA8",   rx::GenerateMip<rx::R8G8B8A8>,      rx::GenerateMipChain<rx::R8G8B8A8>,      4,  "", 0, 0, 0, 0, false },
+        { "RGBA16F", rx::GenerateMip<rx::R16G16B16A16F>, rx::GenerateMipChain<rx::R16G16B16A16F>, 8,  "", 0, 0, 0, 0, false },
+        { "RGBA32F", rx::GenerateMip<rx::R32G32B32A32F>, rx::GenerateMipChain<rx::R32G32B32A32F>, 16, "", 0, 0, 0, 0, false },
+        { "RG8",     rx::GenerateMip<rx::R8G8>,          rx::GenerateMipChain<rx::R8G8>,          2,  "", 0, 0, 0, 0, false },
+    };
+    const MipChainParams mipChainShapes[] =
+    {
+        { "", NULL, NULL, 0, "2D",   2048, 2048, 1,   1, false },
+        { "", NULL, NULL, 0, "Cube", 512,  512,  1,   6, false },
+        { "", NULL, NULL, 0, "3D",   128,  128,  128, 1, false },
+    };
+
+    std::vector<MipChainParams> mipChainParams;
+
+    for (size_t formatIt = 0; formatIt < ArraySize(mipChainFormats); formatIt++)
+    {
+        for (size_t shapeIt = 0; shapeIt < ArraySize(mipChainShapes); shapeIt++)
+        {
+            for (size_t chain = 0; chain < 2; chain++)
+            {
+                MipChainParams params = mipChainShapes[shapeIt];
+                params.formatName = mipChainFormats[formatIt].formatName;
+                params.mipFunction = mipChainFormats[formatIt].mipFunction;
+                params.mipChainFunction = mipChainFormats[formatIt].mipChainFunction;
+                params.pixelBytes = mipChainFormats[formatIt].pixelBytes;
+                params.chain = (chain == 1);
+
+                mipChainParams.push_back(params);
+            }
+        }
+    }
+
+    result = RunImplementationBenchmarks<MipChainBenchmark>(mipChainParams);
+    if (result != 0) { return result; }
+
+    // Render target formats read back with formats and types readPixels accepts
+    const ColorRowCopyParams colorRowCopyPairs[] =
+    {
+        { "BGRA8ToRGBA8",       rx::ReadColor<rx::B8G8R8A8, GLfloat>,      4,  rx::WriteColor<rx::R8G8B8A8, GLfloat>,      4,  0, 0, false },
+        { "BGRX8ToRGBA8",       rx::ReadColor<rx::B8G8R8X8, GLfloat>,      4,  rx::WriteColor<rx::R8G8B8A8, GLfloat>,      4,  0, 0, false },
+        { "RG8ToRGBA8",         rx::ReadColor<rx::R8G8, GLfloat>,          2,  rx::WriteColor<rx::R8G8B8A8, GLfloat>,      4,  0, 0, false },
+        { "RGB565ToRGBA8",      rx::ReadColor<rx::R5G6B5, GLfloat>,        2,  rx::WriteColor<rx::R8G8B8A8, GLfloat>,      4,  0, 0, false },
+        { "RGB10A2ToRGBA8",     rx::ReadColor<rx::R10G10B10A2, GLfloat>,   4,  rx::WriteColor<rx::R8G8B8A8, GLfloat>,      4,  0, 0, false },
+        { "RGBA8ToRGBA4",       rx::ReadColor<rx::R8G8B8A8, GLfloat>,      4,  rx::WriteColor<rx::R4G4B4A4, GLfloat>,      2,  0, 0, false },
+        { "RGBA16FToRGBA32F",   rx::ReadColor<rx::R16G16B16A16F, GLfloat>, 8,  rx::WriteColor<rx::R32G32B32A32F, GLfloat>, 16, 0, 0, false },
+        { "RGBA32FToRGBA8",     rx::ReadColor<rx::R32G32B32A32F, GLfloat>, 16, rx::WriteColor<rx::R8G8B8A8, GLfloat>,      4,  0, 0, false },
+        { "RGBA16UIToRGBA32UI", rx::ReadColor<rx::R16G16B16A16, GLuint>,   8,  rx::WriteColor<rx::R32G32B32A32, GLuint>,   16, 0, 0, false },
+        { "RG8IToRGBA32I",      rx::ReadColor<rx::R8G8S, GLint>,           2,  rx::WriteColor<rx::R32G32B32A32S, GLint>,   16, 0, 0, false },
+    };
+
+    std::vector<ColorRowCopyParams> colorRowCopyParams;
+
+    for (size_t pairIt = 0; pairIt < ArraySize(colorRowCopyPairs); pairIt++)
+    {
+        for (size_t rows = 0; rows < 2; rows++)
+        {
+            ColorRowCopyParams params = colorRowCopyPairs[pairIt];
+            params.width = 1024;
+            params.height = 1024;
+            params.rows = (rows == 1);
+
+            colorRowCopyParams.push_back(params);
+        }
+    }
+
+    return RunImplementationBenchmarks<ColorRowCopyBenchmark>(colorRowCopyParams);
+}
@@ -0,0 +1,57 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "IndexConversion.h"
+
+#include <sstream>
+
+std::string IndexConversionParams::suffix() const
+{
+    std::stringstream strstr;
+
+    strstr << "_" << rx::GetIndexConversionKernelInfo(kernel).name
+           << "_" << gl::GetSIMDLevelName(level)
+           << "_" << count;
+
+    return strstr.str();
+}
+
+IndexConversionBenchmark::IndexConversionBenchmark(const IndexConversionParams &params)
+    : ImplementationBenchmark("IndexConversion", params.suffix()),
+      mFunction(NULL),
+      mParams(params)
+{
+}
+
+bool IndexConversionBenchmark::initializeBenchmark()
+{
+    const rx::IndexConversionFunctions *functions = rx::GetIndexConversionFunctions(mParams.kernel, mParams.level);
+    if (!functions)
+    {
+        return false;
+    }
+    mFunction = functions->convert;
+
+    const rx::IndexConversionKernelInfo &info = rx::GetIndexConversionKernelInfo(mParams.kernel);
+    size_t sourceBytes = gl::GetTypeInfo(info.sourceType).bytes;
+    size_t destBytes = gl::GetTypeInfo(info.destinationType).bytes;
+
+    mInput.resize(mParams.count * sourceBytes);
+    mOutput.resize(mParams.count * destBytes);
+    for (size_t i = 0; i < mInput.size(); i++)
+    {
+        mInput[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    mBytesPerIteration = mInput.size() + mOutput.size();
+
+    return true;
+}
+
+void IndexConversionBenchmark::stepBenchmark()
+{
+    mFunction(mParams.count, &mInput[0], &mOutput[0]);
+}
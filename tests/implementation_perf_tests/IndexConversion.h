@@ -0,0 +1,36 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "ImplementationBenchmark.h"
+
+#include "libGLESv2/formatutils.h"
+#include "libGLESv2/renderer/indexconversion.h"
+
+struct IndexConversionParams
+{
+    std::string suffix() const;
+
+    rx::IndexConversionKernel kernel;
+    gl::SIMDLevel level;
+    size_t count;
+};
+
+// Measures one version of an index conversion on a long index stream.
+class IndexConversionBenchmark : public ImplementationBenchmark
+{
+  public:
+    IndexConversionBenchmark(const IndexConversionParams &params);
+
+    virtual bool initializeBenchmark();
+    virtual void stepBenchmark();
+
+  private:
+    rx::ConvertIndicesFunction mFunction;
+    std::vector<uint8_t> mInput;
+    std::vector<uint8_t> mOutput;
+
+    const IndexConversionParams mParams;
+};
@@ -0,0 +1,75 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "IndexRangeInvalidation.h"
+
+#include <sstream>
+
+std::string IndexRangeInvalidationParams::suffix() const
+{
+    std::stringstream strstr;
+
+    strstr << "_" << rangeCount << "ranges_" << updateBytes << "bytes_" << drawsPerUpdate << "draws";
+
+    return strstr.str();
+}
+
+IndexRangeInvalidationBenchmark::IndexRangeInvalidationBenchmark(const IndexRangeInvalidationParams &params)
+    : ImplementationBenchmark("IndexRangeInvalidation", params.suffix()),
+      mBufferSize(0),
+      mSeed(1),
+      mParams(params)
+{
+}
+
+unsigned int IndexRangeInvalidationBenchmark::random()
+{
+    mSeed = mSeed * 1664525 + 1013904223;
+    return mSeed >> 8;
+}
+
+bool IndexRangeInvalidationBenchmark::initializeBenchmark()
+{
+    // Ranges of 16-bit indices a few hundred bytes long, spread over a buffer
+    // that holds them side by side
+    mBufferSize = static_cast<unsigned int>(mParams.rangeCount * 512);
+    mCache.reset(new rx::IndexRangeCache(mParams.rangeCount));
+
+    for (size_t i = 0; i < mParams.rangeCount; i++)
+    {
+        Draw draw;
+        draw.offset = (random() % (mBufferSize - 1024)) & ~1u;
+        draw.count = 3 * (1 + random() % 100);
+        mDraws.push_back(draw);
+
+        mCache->addRange(GL_UNSIGNED_SHORT, draw.offset, draw.count, rx::RangeUI(0, 1), draw.offset);
+    }
+
+    return true;
+}
+
+void IndexRangeInvalidationBenchmark::destroyBenchmark()
+{
+    const rx::IndexRangeCache::Counters &counters = mCache->getCounters();
+    double lookups = static_cast<double>(counters.hits + counters.misses);
+
+    printResult("hit_rate", lookups > 0 ? 100.0 * counters.hits / lookups : 0.0, "%", false);
+    printResult("invalidated_ranges", counters.invalidatedRanges, "ranges", false);
+}
+
+void IndexRangeInvalidationBenchmark::stepBenchmark()
+{
+    mCache->invalidateRange(random() % mBufferSize, static_cast<unsigned int>(mParams.updateBytes));
+
+    for (size_t i = 0; i < mParams.drawsPerUpdate; i++)
+    {
+        const Draw &draw = mDraws[random() % mDraws.size()];
+        if (!mCache->findRange(GL_UNSIGNED_SHORT, draw.offset, draw.count, NULL, NULL))
+        {
+            mCache->addRange(GL_UNSIGNED_SHORT, draw.offset, draw.count, rx::RangeUI(0, 1), draw.offset);
+        }
+    }
+}
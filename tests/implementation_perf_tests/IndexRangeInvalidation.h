@@ -0,0 +1,47 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "ImplementationBenchmark.h"
+
+#include "libGLESv2/renderer/IndexRangeCache.h"
+
+struct IndexRangeInvalidationParams
+{
+    std::string suffix() const;
+
+    size_t rangeCount;
+    size_t updateBytes;
+    size_t drawsPerUpdate;
+};
+
+// Draws sub-ranges of one large element buffer while small parts of it are
+// updated: each iteration writes |updateBytes| bytes, then looks up the ranges
+// of |drawsPerUpdate| draws and caches the ones that were dropped.
+class IndexRangeInvalidationBenchmark : public ImplementationBenchmark
+{
+  public:
+    IndexRangeInvalidationBenchmark(const IndexRangeInvalidationParams &params);
+
+    virtual bool initializeBenchmark();
+    virtual void destroyBenchmark();
+    virtual void stepBenchmark();
+
+  private:
+    struct Draw
+    {
+        unsigned int offset;
+        GLsizei count;
+    };
+
+    unsigned int random();
+
+    std::unique_ptr<rx::IndexRangeCache> mCache;
+    std::vector<Draw> mDraws;
+    unsigned int mBufferSize;
+    unsigned int mSeed;
+
+    const IndexRangeInvalidationParams mParams;
+};
@@ -0,0 +1,59 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "LoadImage.h"
+
+#include <sstream>
+
+std::string LoadImageParams::suffix() const
+{
+    std::stringstream strstr;
+
+    strstr << "_" << rx::GetLoadImageKernelInfo(kernel).name
+           << "_" << gl::GetSIMDLevelName(level);
+
+    return strstr.str();
+}
+
+LoadImageBenchmark::LoadImageBenchmark(const LoadImageParams &params)
+    : ImplementationBenchmark("LoadImage", params.suffix()),
+      mFunction(NULL),
+      mInputRowPitch(0),
+      mOutputRowPitch(0),
+      mParams(params)
+{
+}
+
+bool LoadImageBenchmark::initializeBenchmark()
+{
+    mFunction = rx::GetLoadImageKernel(mParams.kernel, mParams.level);
+    if (!mFunction)
+    {
+        return false;
+    }
+
+    const rx::LoadImageKernelInfo &info = rx::GetLoadImageKernelInfo(mParams.kernel);
+    mInputRowPitch = mParams.width * info.inputPixelBytes;
+    mOutputRowPitch = mParams.width * info.outputPixelBytes;
+
+    mInput.resize(mInputRowPitch * mParams.height);
+    mOutput.resize(mOutputRowPitch * mParams.height);
+    for (size_t i = 0; i < mInput.size(); i++)
+    {
+        mInput[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    mBytesPerIteration = mInput.size() + mOutput.size();
+
+    return true;
+}
+
+void LoadImageBenchmark::stepBenchmark()
+{
+    mFunction(mParams.width, mParams.height, 1,
+              &mInput[0], mInputRowPitch, mInput.size(),
+              &mOutput[0], mOutputRowPitch, mOutput.size());
+}
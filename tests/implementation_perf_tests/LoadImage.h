@@ -0,0 +1,38 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "ImplementationBenchmark.h"
+
+#include "libGLESv2/renderer/loadimageSIMD.h"
+
+struct LoadImageParams
+{
+    std::string suffix() const;
+
+    rx::LoadImageKernel kernel;
+    gl::SIMDLevel level;
+    size_t width;
+    size_t height;
+};
+
+// Measures one version of a load function on a large image.
+class LoadImageBenchmark : public ImplementationBenchmark
+{
+  public:
+    LoadImageBenchmark(const LoadImageParams &params);
+
+    virtual bool initializeBenchmark();
+    virtual void stepBenchmark();
+
+  private:
+    LoadImageFunction mFunction;
+    size_t mInputRowPitch;
+    size_t mOutputRowPitch;
+    std::vector<uint8_t> mInput;
+    std::vector<uint8_t> mOutput;
+
+    const LoadImageParams mParams;
+};
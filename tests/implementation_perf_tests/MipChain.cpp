@@ -0,0 +1,101 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "MipChain.h"
+
+#include <sstream>
+
+namespace
+{
+
+size_t LevelSize(size_t size, size_t level)
+{
+    return std::max<size_t>(1, size >> level);
+}
+
+}
+
+std::string MipChainParams::suffix() const
+{
+    std::stringstream strstr;
+
+    strstr << "_" << formatName << "_" << shapeName << "_" << width << "x" << height;
+    if (depth > 1)
+    {
+        strstr << "x" << depth;
+    }
+    strstr << (chain ? "_chain" : "_per_level");
+
+    return strstr.str();
+}
+
+MipChainBenchmark::MipChainBenchmark(const MipChainParams &params)
+    : ImplementationBenchmark("MipChain", params.suffix()),
+      mLevelCount(0),
+      mParams(params)
+{
+}
+
+bool MipChainBenchmark::initializeBenchmark()
+{
+    mLevelCount = 1;
+    while ((std::max(mParams.width, std::max(mParams.height, mParams.depth)) >> mLevelCount) > 0)
+    {
+        mLevelCount++;
+    }
+
+    mData.resize(mLevelCount * mParams.layers);
+    mLevels.resize(mLevelCount * mParams.layers);
+    mBytesPerIteration = 0;
+
+    for (size_t layer = 0; layer < mParams.layers; layer++)
+    {
+        for (size_t level = 0; level < mLevelCount; level++)
+        {
+            std::vector<uint8_t> &data = mData[layer * mLevelCount + level];
+            rx::MipChainLevel &chainLevel = mLevels[layer * mLevelCount + level];
+
+            chainLevel.rowPitch = LevelSize(mParams.width, level) * mParams.pixelBytes;
+            chainLevel.depthPitch = chainLevel.rowPitch * LevelSize(mParams.height, level);
+            data.resize(chainLevel.depthPitch * LevelSize(mParams.depth, level));
+            chainLevel.data = &data[0];
+
+            mBytesPerIteration += data.size();
+        }
+
+        // Values that are valid in every format, half floats included
+        std::vector<uint8_t> &baseLevel = mData[layer * mLevelCount];
+        for (size_t i = 0; i < baseLevel.size(); i++)
+        {
+            baseLevel[i] = static_cast<uint8_t>((i * 7) & 0x3F);
+        }
+    }
+
+    return true;
+}
+
+void MipChainBenchmark::stepBenchmark()
+{
+    for (size_t layer = 0; layer < mParams.layers; layer++)
+    {
+        const rx::MipChainLevel *levels = &mLevels[layer * mLevelCount];
+
+        if (mParams.chain)
+        {
+            mParams.mipChainFunction(mParams.width, mParams.height, mParams.depth, levels, mLevelCount);
+        }
+        else
+        {
+            for (size_t level = 1; level < mLevelCount; level++)
+            {
+                mParams.mipFunction(LevelSize(mParams.width, level - 1), LevelSize(mParams.height, level - 1),
+                                    LevelSize(mParams.depth, level - 1),
+                                    levels[level - 1].data, levels[level - 1].rowPitch, levels[level - 1].depthPitch,
+                                    levels[level].data, levels[level].rowPitch, levels[level].depthPitch);
+            }
+        }
+    }
+}
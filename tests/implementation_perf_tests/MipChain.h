@@ -0,0 +1,47 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "ImplementationBenchmark.h"
+
+#include "libGLESv2/formatutils.h"
+#include "libGLESv2/renderer/generatemip.h"
+
+struct MipChainParams
+{
+    std::string suffix() const;
+
+    const char *formatName;
+    MipGenerationFunction mipFunction;
+    MipChainGenerationFunction mipChainFunction;
+    size_t pixelBytes;
+
+    // "2D", "Cube" or "3D"; a cube has six layers
+    const char *shapeName;
+    size_t width;
+    size_t height;
+    size_t depth;
+    size_t layers;
+
+    // Whether to use mipChainFunction, or mipFunction for each level
+    bool chain;
+};
+
+// Measures generating all the mip levels of a texture on the CPU.
+class MipChainBenchmark : public ImplementationBenchmark
+{
+  public:
+    MipChainBenchmark(const MipChainParams &params);
+
+    virtual bool initializeBenchmark();
+    virtual void stepBenchmark();
+
+  private:
+    std::vector<std::vector<uint8_t> > mData;
+    std::vector<rx::MipChainLevel> mLevels;
+    size_t mLevelCount;
+
+    const MipChainParams mParams;
+};
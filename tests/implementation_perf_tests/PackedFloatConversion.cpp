@@ -0,0 +1,104 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "PackedFloatConversion.h"
+
+#include "common/cpufeatures.h"
+#include "common/packedfloat.h"
+
+#include <sstream>
+
+namespace
+{
+
+typedef void (*ConvertFloat32ToPackedFunction)(const float *, uint32_t *, size_t);
+typedef void (*ConvertPackedToFloat32Function)(const uint32_t *, float *, size_t);
+
+const ConvertFloat32ToPackedFunction kToRGB9E5[] =
+{
+    gl::ConvertFloat32ToRGB9E5Portable, gl::ConvertFloat32ToRGB9E5SSE2, gl::ConvertFloat32ToRGB9E5AVX2,
+};
+const ConvertPackedToFloat32Function kFromRGB9E5[] =
+{
+    gl::ConvertRGB9E5ToFloat32Portable, gl::ConvertRGB9E5ToFloat32SSE2, gl::ConvertRGB9E5ToFloat32AVX2,
+};
+const ConvertFloat32ToPackedFunction kToR11G11B10F[] =
+{
+    gl::ConvertFloat32ToR11G11B10FPortable, gl::ConvertFloat32ToR11G11B10FSSE2, gl::ConvertFloat32ToR11G11B10FAVX2,
+};
+const ConvertPackedToFloat32Function kFromR11G11B10F[] =
+{
+    gl::ConvertR11G11B10FToFloat32Portable, gl::ConvertR11G11B10FToFloat32SSE2, gl::ConvertR11G11B10FToFloat32AVX2,
+};
+
+}
+
+std::string PackedFloatConversionParams::suffix() const
+{
+    std::stringstream strstr;
+
+    strstr << (format == PACKED_FLOAT_RGB9E5 ? "_rgb9e5" : "_r11g11b10f");
+    strstr << (toPacked ? "_encode" : "_decode");
+    switch (version)
+    {
+      case PACKED_FLOAT_CONVERSION_PORTABLE: strstr << "_portable"; break;
+      case PACKED_FLOAT_CONVERSION_SSE2:     strstr << "_sse2";     break;
+      case PACKED_FLOAT_CONVERSION_AVX2:     strstr << "_avx2";     break;
+    }
+
+    return strstr.str();
+}
+
+PackedFloatConversionBenchmark::PackedFloatConversionBenchmark(const PackedFloatConversionParams &params)
+    : ImplementationBenchmark("PackedFloatConversion", params.suffix()),
+      mParams(params)
+{
+}
+
+bool PackedFloatConversionBenchmark::initializeBenchmark()
+{
+    const gl::CPUFeatures &features = gl::GetCPUFeatures();
+    if ((mParams.version == PACKED_FLOAT_CONVERSION_SSE2 && !features.sse2) ||
+        (mParams.version == PACKED_FLOAT_CONVERSION_AVX2 && !features.avx2))
+    {
+        return false;
+    }
+
+    // HDR colors over a wide range of exponents
+    mFloats.resize(mParams.count * 3);
+    mPacked.resize(mParams.count);
+    for (size_t i = 0; i < mFloats.size(); i++)
+    {
+        mFloats[i] = static_cast<float>(i % 4099) * static_cast<float>(1 << (i % 13)) / 1024.0f;
+    }
+
+    if (mParams.format == PACKED_FLOAT_RGB9E5)
+    {
+        gl::ConvertFloat32ToRGB9E5Portable(&mFloats[0], &mPacked[0], mParams.count);
+    }
+    else
+    {
+        gl::ConvertFloat32ToR11G11B10FPortable(&mFloats[0], &mPacked[0], mParams.count);
+    }
+
+    mBytesPerIteration = mParams.count * (3 * sizeof(float) + sizeof(uint32_t));
+
+    return true;
+}
+
+void PackedFloatConversionBenchmark::stepBenchmark()
+{
+    if (mParams.toPacked)
+    {
+        const ConvertFloat32ToPackedFunction *functions = (mParams.format == PACKED_FLOAT_RGB9E5) ? kToRGB9E5 : kToR11G11B10F;
+        functions[mParams.version](&mFloats[0], &mPacked[0], mParams.count);
+    }
+    else
+    {
+        const ConvertPackedToFloat32Function *functions = (mParams.format == PACKED_FLOAT_RGB9E5) ? kFromRGB9E5 : kFromR11G11B10F;
+        functions[mParams.version](&mPacked[0], &mFloats[0], mParams.count);
+    }
+}
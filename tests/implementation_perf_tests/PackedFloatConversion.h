@@ -0,0 +1,49 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "ImplementationBenchmark.h"
+
+#include <cstdint>
+
+enum PackedFloatFormat
+{
+    PACKED_FLOAT_RGB9E5,
+    PACKED_FLOAT_R11G11B10F,
+};
+
+enum PackedFloatConversionVersion
+{
+    PACKED_FLOAT_CONVERSION_PORTABLE,
+    PACKED_FLOAT_CONVERSION_SSE2,
+    PACKED_FLOAT_CONVERSION_AVX2,
+};
+
+struct PackedFloatConversionParams
+{
+    std::string suffix() const;
+
+    PackedFloatFormat format;
+    // Converts floats to the packed format if true, the other way otherwise.
+    bool toPacked;
+    PackedFloatConversionVersion version;
+    // In pixels
+    size_t count;
+};
+
+class PackedFloatConversionBenchmark : public ImplementationBenchmark
+{
+  public:
+    PackedFloatConversionBenchmark(const PackedFloatConversionParams &params);
+
+    virtual bool initializeBenchmark();
+    virtual void stepBenchmark();
+
+  private:
+    std::vector<float> mFloats;
+    std::vector<uint32_t> mPacked;
+
+    const PackedFloatConversionParams mParams;
+};
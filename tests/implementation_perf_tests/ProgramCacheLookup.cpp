@@ -0,0 +1,160 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "ProgramCacheLookup.h"
+
+#include <sstream>
+
+#if defined(ANGLE_PLATFORM_POSIX)
+#include <stdlib.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+
+bool CreateTemporaryDirectory(std::string *directoryOut)
+{
+#if defined(ANGLE_PLATFORM_WINDOWS)
+    char tempPath[MAX_PATH];
+    if (GetTempPathA(MAX_PATH, tempPath) == 0)
+    {
+        return false;
+    }
+    *directoryOut = std::string(tempPath) + FormatString("angle_program_cache_perf_%lu", GetCurrentProcessId());
+    return (CreateDirectoryA(directoryOut->c_str(), NULL) != FALSE);
+#else
+    char directory[] = "/tmp/angle_program_cache_perf_XXXXXX";
+    if (mkdtemp(directory) == NULL)
+    {
+        return false;
+    }
+    *directoryOut = directory;
+    return true;
+#endif
+}
+
+void RemoveTemporaryDirectory(const std::string &directory)
+{
+    // A store with no room deletes every entry it finds
+    {
+        gl::DirectoryProgramCacheStore emptyStore(directory, 0);
+    }
+
+#if defined(ANGLE_PLATFORM_WINDOWS)
+    RemoveDirectoryA(directory.c_str());
+#else
+    rmdir(directory.c_str());
+#endif
+}
+
+}
+
+std::string ProgramCacheLookupParams::suffix() const
+{
+    std::stringstream strstr;
+
+    strstr << (directoryStore ? "_directory" : "_memory") << (warm ? "_warm_" : "_cold_") << (binarySize / 1024) << "kb";
+
+    return strstr.str();
+}
+
+ProgramCacheLookupBenchmark::ProgramCacheLookupBenchmark(const ProgramCacheLookupParams &params)
+    : ImplementationBenchmark("ProgramCacheLookup", params.suffix()),
+      mCache(NULL),
+      mLinkCount(0),
+      mHitCount(0),
+      mParams(params)
+{
+}
+
+bool ProgramCacheLookupBenchmark::initializeBenchmark()
+{
+    // Room for every binary the benchmark adds, so that cold links never evict
+    const size_t storeSize = 1024 * 1024 * 1024;
+
+    gl::ProgramCacheStore *store = NULL;
+    if (mParams.directoryStore)
+    {
+        if (!CreateTemporaryDirectory(&mDirectory))
+        {
+            return false;
+        }
+        store = new gl::DirectoryProgramCacheStore(mDirectory, storeSize);
+    }
+    else
+    {
+        store = new gl::MemoryProgramCacheStore(storeSize);
+    }
+    mCache = new gl::ProgramCache(store);
+
+    // A few kilobytes of shader, about what a lit and skinned material has
+    for (size_t line = 0; line < 100; line++)
+    {
+        std::stringstream strstr;
+        strstr << "    vec4 light" << line << " = lightColor[" << line << "] * max(dot(normal, lightDirection[" << line << "]), 0.0);\n";
+        mShaderSource += strstr.str();
+    }
+
+    std::vector<unsigned char> binary(mParams.binarySize);
+    for (size_t byteIndex = 0; byteIndex < binary.size(); byteIndex++)
+    {
+        binary[byteIndex] = static_cast<unsigned char>(byteIndex * 31);
+    }
+    mBinary.writeBytes(&binary[0], binary.size());
+
+    if (mParams.warm)
+    {
+        gl::BinaryOutputStream linkInputs;
+        writeLinkInputs(&linkInputs, 0);
+        mCache->putProgram(linkInputs, mBinary);
+    }
+
+    return true;
+}
+
+void ProgramCacheLookupBenchmark::destroyBenchmark()
+{
+    SafeDelete(mCache);
+    if (mParams.directoryStore)
+    {
+        RemoveTemporaryDirectory(mDirectory);
+    }
+
+    // Keeps the lookups from being optimized away
+    printResult("cache_hits", mHitCount, "links", false);
+}
+
+void ProgramCacheLookupBenchmark::stepBenchmark()
+{
+    std::vector<uint8_t> binary;
+
+    for (size_t linkIndex = 0; linkIndex < mParams.linksPerStep; linkIndex++)
+    {
+        gl::BinaryOutputStream linkInputs;
+        writeLinkInputs(&linkInputs, mParams.warm ? 0 : ++mLinkCount);
+
+        if (mCache->getProgram(linkInputs, &binary))
+        {
+            mHitCount++;
+        }
+        else
+        {
+            mCache->putProgram(linkInputs, mBinary);
+        }
+    }
+}
+
+// The same shape of inputs Program::link writes, with |variant| making them unique
+void ProgramCacheLookupBenchmark::writeLinkInputs(gl::BinaryOutputStream *stream, size_t variant) const
+{
+    stream->writeString("Direct3D11 vs_5_0 ps_5_0");
+    stream->writeInt(variant);
+    stream->writeString(mShaderSource);
+    stream->writeString(mShaderSource);
+    stream->writeString(mShaderSource);
+    stream->writeString(mShaderSource);
+}
@@ -0,0 +1,50 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "ImplementationBenchmark.h"
+
+#include "libGLESv2/BinaryStream.h"
+#include "libGLESv2/ProgramCache.h"
+
+struct ProgramCacheLookupParams
+{
+    std::string suffix() const;
+
+    // Keeps the entries in files instead of in memory
+    bool directoryStore;
+
+    // Whether every link finds the binary of an earlier one. Otherwise each link has new
+    // inputs, so it misses and adds its binary, as the first run of an application does.
+    bool warm;
+
+    size_t binarySize;
+    size_t linksPerStep;
+};
+
+// The cache side of linking a program: building the key from the link inputs, then either
+// loading the binary out of the store or putting a new one in. Linking the shaders itself
+// needs a device, so a cold link here leaves out the compile time that a hit saves.
+class ProgramCacheLookupBenchmark : public ImplementationBenchmark
+{
+  public:
+    ProgramCacheLookupBenchmark(const ProgramCacheLookupParams &params);
+
+    virtual bool initializeBenchmark();
+    virtual void destroyBenchmark();
+    virtual void stepBenchmark();
+
+  private:
+    void writeLinkInputs(gl::BinaryOutputStream *stream, size_t variant) const;
+
+    gl::ProgramCache *mCache;
+    std::string mDirectory;
+    std::string mShaderSource;
+    gl::BinaryOutputStream mBinary;
+    size_t mLinkCount;
+    size_t mHitCount;
+
+    const ProgramCacheLookupParams mParams;
+};
@@ -0,0 +1,89 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "ResourceMapLookup.h"
+
+#include <sstream>
+
+std::string ResourceMapLookupParams::suffix() const
+{
+    std::stringstream strstr;
+
+    strstr << (hashMap ? "_hash_map" : "_resource_map") << (sparseNames ? "_sparse_" : "_dense_") << objectCount << "objects";
+
+    return strstr.str();
+}
+
+ResourceMapLookupBenchmark::ResourceMapLookupBenchmark(const ResourceMapLookupParams &params)
+    : ImplementationBenchmark("ResourceMapLookup", params.suffix()),
+      mFound(0),
+      mSeed(1),
+      mParams(params)
+{
+}
+
+unsigned int ResourceMapLookupBenchmark::random()
+{
+    mSeed = mSeed * 1664525 + 1013904223;
+    return mSeed;
+}
+
+bool ResourceMapLookupBenchmark::initializeBenchmark()
+{
+    mObjects.resize(mParams.objectCount);
+    for (size_t objectIndex = 0; objectIndex < mObjects.size(); objectIndex++)
+    {
+        Object &object = mObjects[objectIndex];
+        object.handle = (mParams.sparseNames ? (random() | 1) : static_cast<GLuint>(objectIndex + 1));
+
+        if (mParams.hashMap)
+        {
+            mHashMap[object.handle] = &object;
+        }
+        else
+        {
+            mResourceMap.assign(object.handle, &object);
+        }
+    }
+
+    // The names a scene binds, decided up front so that the step only looks up
+    for (size_t lookupIndex = 0; lookupIndex < mParams.lookupsPerStep; lookupIndex++)
+    {
+        mLookups.push_back(mObjects[random() % mObjects.size()].handle);
+    }
+
+    return true;
+}
+
+void ResourceMapLookupBenchmark::destroyBenchmark()
+{
+    // Keeps the lookups from being optimized away
+    printResult("objects_found", mFound, "lookups", false);
+}
+
+void ResourceMapLookupBenchmark::stepBenchmark()
+{
+    size_t found = 0;
+
+    if (mParams.hashMap)
+    {
+        for (size_t lookupIndex = 0; lookupIndex < mLookups.size(); lookupIndex++)
+        {
+            std::unordered_map<GLuint, Object*>::const_iterator iter = mHashMap.find(mLookups[lookupIndex]);
+            found += (iter != mHashMap.end() && iter->second->handle == mLookups[lookupIndex]) ? 1 : 0;
+        }
+    }
+    else
+    {
+        for (size_t lookupIndex = 0; lookupIndex < mLookups.size(); lookupIndex++)
+        {
+            const Object *object = mResourceMap.query(mLookups[lookupIndex]);
+            found += (object && object->handle == mLookups[lookupIndex]) ? 1 : 0;
+        }
+    }
+
+    mFound += found;
+}
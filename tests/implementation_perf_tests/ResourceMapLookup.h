@@ -0,0 +1,55 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "ImplementationBenchmark.h"
+
+#include "libGLESv2/ResourceMap.h"
+
+#include <unordered_map>
+
+struct ResourceMapLookupParams
+{
+    std::string suffix() const;
+
+    // Whether the names are handed out in order, or picked at random over the
+    // whole range as an application binding names it never generated would
+    bool sparseNames;
+
+    // Whether the lookups go through a std::unordered_map, for comparison
+    bool hashMap;
+
+    size_t objectCount;
+    size_t lookupsPerStep;
+};
+
+// Looks up objects by name, as the bind and draw entry points do for every
+// buffer, texture and program they use.
+class ResourceMapLookupBenchmark : public ImplementationBenchmark
+{
+  public:
+    ResourceMapLookupBenchmark(const ResourceMapLookupParams &params);
+
+    virtual bool initializeBenchmark();
+    virtual void destroyBenchmark();
+    virtual void stepBenchmark();
+
+  private:
+    struct Object
+    {
+        GLuint handle;
+    };
+
+    unsigned int random();
+
+    std::vector<Object> mObjects;
+    std::vector<GLuint> mLookups;
+    gl::ResourceMap<Object> mResourceMap;
+    std::unordered_map<GLuint, Object*> mHashMap;
+    size_t mFound;
+    unsigned int mSeed;
+
+    const ResourceMapLookupParams mParams;
+};
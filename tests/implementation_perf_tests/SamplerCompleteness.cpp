@@ -0,0 +1,144 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "SamplerCompleteness.h"
+
+#include "libGLESv2/renderer/Image.h"
+
+#include <sstream>
+
+namespace
+{
+
+class MemoryImage : public rx::Image
+{
+  public:
+    virtual bool isDirty() const { return false; }
+
+    virtual bool redefine(rx::Renderer *renderer, GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, bool forceRelease)
+    {
+        mTarget = target;
+        mInternalFormat = internalformat;
+        mActualFormat = internalformat;
+        mWidth = width;
+        mHeight = height;
+        mDepth = depth;
+        return true;
+    }
+
+    virtual gl::Error loadData(GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLint, GLint, GLenum, const void *) { return gl::Error(GL_NO_ERROR); }
+    virtual gl::Error loadCompressedData(GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, const void *) { return gl::Error(GL_NO_ERROR); }
+    virtual gl::Error copy(GLint, GLint, GLint, const gl::Rectangle &, rx::RenderTarget *) { return gl::Error(GL_NO_ERROR); }
+    virtual gl::Error copy(GLint, GLint, GLint, const gl::Rectangle &, const gl::ImageIndex &, rx::TextureStorage *) { return gl::Error(GL_NO_ERROR); }
+};
+
+// Only keeps the sizes and formats of the images, which is all completeness looks at
+class MemoryTexture2DImpl : public rx::TextureImpl
+{
+  public:
+    virtual rx::Image *getImage(int level, int layer) const { return const_cast<MemoryImage*>(&mImages[level]); }
+    virtual rx::Image *getImage(const gl::ImageIndex &index) const { return getImage(index.mipIndex, 0); }
+    virtual GLsizei getLayerCount(int level) const { return 1; }
+
+    virtual void setUsage(GLenum usage) { }
+
+    virtual gl::Error setImage(GLenum target, GLint level, GLsizei width, GLsizei height, GLsizei depth, GLenum internalFormat, GLenum, GLenum, const gl::PixelUnpackState &, const void *)
+    {
+        mImages[level].redefine(NULL, target, internalFormat, width, height, depth, false);
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    virtual gl::Error setCompressedImage(GLenum, GLint, GLenum, GLsizei, GLsizei, GLsizei, GLsizei, const gl::PixelUnpackState &, const void *) { return gl::Error(GL_INVALID_OPERATION); }
+    virtual gl::Error subImage(GLenum, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLenum, GLenum, const gl::PixelUnpackState &, const void *) { return gl::Error(GL_NO_ERROR); }
+    virtual gl::Error subImageCompressed(GLenum, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLenum, GLsizei, const gl::PixelUnpackState &, const void *) { return gl::Error(GL_INVALID_OPERATION); }
+    virtual gl::Error copyImage(GLenum, GLint, GLenum, GLint, GLint, GLsizei, GLsizei, gl::Framebuffer *) { return gl::Error(GL_INVALID_OPERATION); }
+    virtual gl::Error copySubImage(GLenum, GLint, GLint, GLint, GLint, GLint, GLint, GLsizei, GLsizei, gl::Framebuffer *) { return gl::Error(GL_INVALID_OPERATION); }
+    virtual gl::Error storage(GLenum, GLsizei, GLenum, GLsizei, GLsizei, GLsizei) { return gl::Error(GL_INVALID_OPERATION); }
+    virtual gl::Error generateMipmaps() { return gl::Error(GL_INVALID_OPERATION); }
+
+    virtual void bindTexImage(egl::Surface *surface) { }
+    virtual void releaseTexImage() { }
+
+  private:
+    MemoryImage mImages[gl::IMPLEMENTATION_MAX_TEXTURE_LEVELS];
+};
+
+}
+
+std::string SamplerCompletenessParams::suffix() const
+{
+    std::stringstream strstr;
+
+    strstr << (changeSampler ? "_changing_sampler_" : "_same_sampler_") << textureCount << "textures";
+
+    return strstr.str();
+}
+
+SamplerCompletenessBenchmark::SamplerCompletenessBenchmark(const SamplerCompletenessParams &params)
+    : ImplementationBenchmark("SamplerCompleteness", params.suffix()),
+      mCompleteCount(0),
+      mParams(params)
+{
+}
+
+bool SamplerCompletenessBenchmark::initializeBenchmark()
+{
+    gl::TextureCaps textureCaps;
+    textureCaps.texturable = true;
+    textureCaps.filterable = true;
+    mTextureCaps.insert(GL_RGBA8, textureCaps);
+
+    // Full mip chains, so that every level is walked when completeness is computed
+    for (size_t textureIndex = 0; textureIndex < mParams.textureCount; textureIndex++)
+    {
+        gl::Texture2D *texture = new gl::Texture2D(new MemoryTexture2DImpl, static_cast<GLuint>(textureIndex + 1));
+        texture->addRef();
+
+        for (GLint level = 0; (1024 >> level) > 0; level++)
+        {
+            GLsizei size = (1024 >> level);
+            texture->setImage(level, size, size, GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, gl::PixelUnpackState(), NULL);
+        }
+
+        texture->getSamplerState().minFilter = GL_LINEAR_MIPMAP_LINEAR;
+        mTextures.push_back(texture);
+    }
+
+    return true;
+}
+
+void SamplerCompletenessBenchmark::destroyBenchmark()
+{
+    for (size_t textureIndex = 0; textureIndex < mTextures.size(); textureIndex++)
+    {
+        mTextures[textureIndex]->release();
+    }
+    mTextures.clear();
+
+    // Keeps the checks from being optimized away
+    printResult("complete_textures", mCompleteCount, "textures", false);
+}
+
+void SamplerCompletenessBenchmark::stepBenchmark()
+{
+    size_t completeCount = 0;
+
+    for (size_t drawIndex = 0; drawIndex < mParams.drawsPerStep; drawIndex++)
+    {
+        for (size_t textureIndex = 0; textureIndex < mTextures.size(); textureIndex++)
+        {
+            gl::Texture2D *texture = mTextures[textureIndex];
+            if (mParams.changeSampler)
+            {
+                texture->getSamplerState().minFilter = ((drawIndex % 2 == 0) ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR_MIPMAP_NEAREST);
+            }
+
+            completeCount += texture->isSamplerComplete(texture->getSamplerState(), mTextureCaps, mExtensions, 2) ? 1 : 0;
+        }
+    }
+
+    mCompleteCount += completeCount;
+}
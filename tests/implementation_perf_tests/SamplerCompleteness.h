@@ -0,0 +1,41 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "ImplementationBenchmark.h"
+
+#include "libGLESv2/Caps.h"
+#include "libGLESv2/Texture.h"
+
+struct SamplerCompletenessParams
+{
+    std::string suffix() const;
+
+    // Whether the minification filter of every texture alternates between two mipmapped
+    // filters from one draw to the next, so that completeness is recomputed for each query
+    bool changeSampler;
+
+    size_t textureCount;
+    size_t drawsPerStep;
+};
+
+// Checks the completeness of every bound texture for each draw, as applyTextures does.
+class SamplerCompletenessBenchmark : public ImplementationBenchmark
+{
+  public:
+    SamplerCompletenessBenchmark(const SamplerCompletenessParams &params);
+
+    virtual bool initializeBenchmark();
+    virtual void destroyBenchmark();
+    virtual void stepBenchmark();
+
+  private:
+    std::vector<gl::Texture2D*> mTextures;
+    gl::TextureCapsMap mTextureCaps;
+    gl::Extensions mExtensions;
+    size_t mCompleteCount;
+
+    const SamplerCompletenessParams mParams;
+};
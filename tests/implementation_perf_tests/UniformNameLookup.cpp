@@ -0,0 +1,122 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "UniformNameLookup.h"
+
+#include <sstream>
+
+std::string UniformNameLookupParams::suffix() const
+{
+    std::stringstream strstr;
+
+    strstr << (linearSearch ? "_linear_search_" : "_name_table_") << arraySize << "elements";
+
+    return strstr.str();
+}
+
+UniformNameLookupBenchmark::UniformNameLookupBenchmark(const UniformNameLookupParams &params)
+    : ImplementationBenchmark("UniformNameLookup", params.suffix()),
+      mFound(0),
+      mParams(params)
+{
+}
+
+bool UniformNameLookupBenchmark::initializeBenchmark()
+{
+    const char *plainNames[] = { "modelView", "projection", "lightDirection", "diffuseColor" };
+    for (size_t nameIndex = 0; nameIndex < ArraySize(plainNames); nameIndex++)
+    {
+        Location location = { plainNames[nameIndex], GL_INVALID_INDEX };
+        mLocations.push_back(location);
+    }
+
+    for (size_t element = 0; element < mParams.arraySize; element++)
+    {
+        Location location = { "bones", static_cast<unsigned int>(element) };
+        mLocations.push_back(location);
+    }
+
+    for (size_t locationIndex = 0; locationIndex < mLocations.size(); locationIndex++)
+    {
+        const Location &location = mLocations[locationIndex];
+        GLuint value = static_cast<GLuint>(locationIndex);
+
+        mNameTable.insert(location.name, value);
+        if (location.element != GL_INVALID_INDEX)
+        {
+            mNameTable.insert(location.name + ArrayString(location.element), value);
+        }
+    }
+
+    // Every plain uniform and a spread of elements, mostly from the end of the array
+    for (size_t lookupIndex = 0; lookupIndex < mParams.lookupsPerStep; lookupIndex++)
+    {
+        if (lookupIndex % 4 == 0)
+        {
+            mLookups.push_back(plainNames[(lookupIndex / 4) % ArraySize(plainNames)]);
+        }
+        else
+        {
+            size_t element = mParams.arraySize - 1 - (lookupIndex % mParams.arraySize) / 2;
+            mLookups.push_back("bones" + ArrayString(static_cast<unsigned int>(element)));
+        }
+    }
+
+    return true;
+}
+
+void UniformNameLookupBenchmark::destroyBenchmark()
+{
+    // Keeps the lookups from being optimized away
+    printResult("uniforms_found", mFound, "lookups", false);
+}
+
+GLint UniformNameLookupBenchmark::linearSearch(const std::string &name) const
+{
+    std::string baseName = name;
+    unsigned int subscript = GL_INVALID_INDEX;
+
+    size_t open = baseName.find_last_of('[');
+    size_t close = baseName.find_last_of(']');
+    if (open != std::string::npos && close == baseName.length() - 1)
+    {
+        subscript = atoi(baseName.substr(open + 1).c_str());
+        baseName.erase(open);
+    }
+
+    for (size_t locationIndex = 0; locationIndex < mLocations.size(); locationIndex++)
+    {
+        const Location &location = mLocations[locationIndex];
+        if (location.name == baseName && (subscript == GL_INVALID_INDEX || location.element == subscript))
+        {
+            return static_cast<GLint>(locationIndex);
+        }
+    }
+
+    return -1;
+}
+
+void UniformNameLookupBenchmark::stepBenchmark()
+{
+    size_t found = 0;
+
+    if (mParams.linearSearch)
+    {
+        for (size_t lookupIndex = 0; lookupIndex < mLookups.size(); lookupIndex++)
+        {
+            found += (linearSearch(mLookups[lookupIndex]) != -1) ? 1 : 0;
+        }
+    }
+    else
+    {
+        for (size_t lookupIndex = 0; lookupIndex < mLookups.size(); lookupIndex++)
+        {
+            found += (mNameTable.find(mLookups[lookupIndex].c_str()) != GL_INVALID_INDEX) ? 1 : 0;
+        }
+    }
+
+    mFound += found;
+}
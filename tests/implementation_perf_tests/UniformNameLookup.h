@@ -0,0 +1,50 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "ImplementationBenchmark.h"
+
+#include "libGLESv2/NameTable.h"
+
+struct UniformNameLookupParams
+{
+    std::string suffix() const;
+
+    // Whether the lookups go through a linear search of the locations that strips the
+    // subscript off each name first, as glGetUniformLocation did before the table
+    bool linearSearch;
+
+    // The program has one array of this many elements and a few plain uniforms
+    size_t arraySize;
+    size_t lookupsPerStep;
+};
+
+// Looks up uniform locations by name, as applications that call glGetUniformLocation
+// every frame instead of caching the locations do.
+class UniformNameLookupBenchmark : public ImplementationBenchmark
+{
+  public:
+    UniformNameLookupBenchmark(const UniformNameLookupParams &params);
+
+    virtual bool initializeBenchmark();
+    virtual void destroyBenchmark();
+    virtual void stepBenchmark();
+
+  private:
+    struct Location
+    {
+        std::string name;
+        unsigned int element;
+    };
+
+    GLint linearSearch(const std::string &name) const;
+
+    std::vector<Location> mLocations;
+    std::vector<std::string> mLookups;
+    gl::NameTable mNameTable;
+    size_t mFound;
+
+    const UniformNameLookupParams mParams;
+};
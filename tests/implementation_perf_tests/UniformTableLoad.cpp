@@ -0,0 +1,211 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "UniformTableLoad.h"
+
+#include <sstream>
+
+namespace
+{
+
+// The same fields ProgramD3D saves for each uniform
+struct UniformRecord
+{
+    GLenum type;
+    GLenum precision;
+    uint32_t nameLength;
+    unsigned int arraySize;
+    int blockIndex;
+
+    int offset;
+    int arrayStride;
+    int matrixStride;
+    int isRowMajorMatrix;
+
+    unsigned int psRegisterIndex;
+    unsigned int vsRegisterIndex;
+    unsigned int registerCount;
+    unsigned int registerElement;
+};
+
+}
+
+std::string UniformTableLoadParams::suffix() const
+{
+    std::stringstream strstr;
+
+    strstr << (bulk ? "_bulk_" : "_fields_") << uniformCount << "uniforms";
+
+    return strstr.str();
+}
+
+UniformTableLoadBenchmark::UniformTableLoadBenchmark(const UniformTableLoadParams &params)
+    : ImplementationBenchmark("UniformTableLoad", params.suffix()),
+      mLoadedCount(0),
+      mParams(params)
+{
+}
+
+bool UniformTableLoadBenchmark::initializeBenchmark()
+{
+    std::vector<UniformRecord> records(mParams.uniformCount);
+    std::string names;
+
+    if (!mParams.bulk)
+    {
+        mBinary.writeInt(mParams.uniformCount);
+    }
+
+    for (size_t uniformIndex = 0; uniformIndex < mParams.uniformCount; uniformIndex++)
+    {
+        std::stringstream nameStream;
+        nameStream << "material.lights[" << uniformIndex << "].color";
+        std::string name = nameStream.str();
+
+        UniformRecord &record = records[uniformIndex];
+        record.type = GL_FLOAT_VEC4;
+        record.precision = GL_HIGH_FLOAT;
+        record.nameLength = static_cast<uint32_t>(name.length());
+        record.arraySize = 0;
+        record.blockIndex = -1;
+        record.offset = -1;
+        record.arrayStride = -1;
+        record.matrixStride = -1;
+        record.isRowMajorMatrix = 0;
+        record.psRegisterIndex = static_cast<unsigned int>(uniformIndex);
+        record.vsRegisterIndex = static_cast<unsigned int>(uniformIndex);
+        record.registerCount = 1;
+        record.registerElement = 0;
+
+        if (mParams.bulk)
+        {
+            names += name;
+        }
+        else
+        {
+            mBinary.writeInt(record.type);
+            mBinary.writeInt(record.precision);
+            mBinary.writeString(name);
+            mBinary.writeInt(record.arraySize);
+            mBinary.writeInt(record.blockIndex);
+            mBinary.writeInt(record.offset);
+            mBinary.writeInt(record.arrayStride);
+            mBinary.writeInt(record.matrixStride);
+            mBinary.writeInt(record.isRowMajorMatrix);
+            mBinary.writeInt(record.psRegisterIndex);
+            mBinary.writeInt(record.vsRegisterIndex);
+            mBinary.writeInt(record.registerCount);
+            mBinary.writeInt(record.registerElement);
+        }
+    }
+
+    if (mParams.bulk)
+    {
+        mBinary.writeArray(records);
+        mBinary.writeString(names);
+    }
+
+    return true;
+}
+
+void UniformTableLoadBenchmark::destroyBenchmark()
+{
+    // Keeps the loads from being optimized away
+    printResult("loaded_uniforms", mLoadedCount, "uniforms", false);
+}
+
+void UniformTableLoadBenchmark::stepBenchmark()
+{
+    for (size_t loadIndex = 0; loadIndex < mParams.loadsPerStep; loadIndex++)
+    {
+        gl::BinaryInputStream stream(mBinary.data(), mBinary.length());
+        std::vector<Uniform> uniforms;
+
+        bool loaded = mParams.bulk ? loadBulk(&stream, &uniforms) : loadFields(&stream, &uniforms);
+        if (loaded)
+        {
+            mLoadedCount += uniforms.size();
+        }
+    }
+}
+
+bool UniformTableLoadBenchmark::loadFields(gl::BinaryInputStream *stream, std::vector<Uniform> *uniforms) const
+{
+    const unsigned int uniformCount = stream->readInt<unsigned int>();
+    if (stream->error())
+    {
+        return false;
+    }
+
+    uniforms->resize(uniformCount);
+    for (unsigned int uniformIndex = 0; uniformIndex < uniformCount; uniformIndex++)
+    {
+        Uniform &uniform = (*uniforms)[uniformIndex];
+        stream->readInt(&uniform.type);
+        stream->readInt(&uniform.precision);
+        stream->readString(&uniform.name);
+        stream->readInt(&uniform.arraySize);
+        stream->readInt(&uniform.blockIndex);
+        stream->readInt(&uniform.offset);
+        stream->readInt(&uniform.arrayStride);
+        stream->readInt(&uniform.matrixStride);
+        stream->readBool(&uniform.isRowMajorMatrix);
+        stream->readInt(&uniform.psRegisterIndex);
+        stream->readInt(&uniform.vsRegisterIndex);
+        stream->readInt(&uniform.registerCount);
+        stream->readInt(&uniform.registerElement);
+    }
+
+    return !stream->error();
+}
+
+bool UniformTableLoadBenchmark::loadBulk(gl::BinaryInputStream *stream, std::vector<Uniform> *uniforms) const
+{
+    std::vector<UniformRecord> records;
+    gl::BinaryStringView names;
+    stream->readArray(&records);
+    stream->readStringView(&names);
+    if (stream->error())
+    {
+        return false;
+    }
+
+    uint64_t totalNameLength = 0;
+    for (size_t recordIndex = 0; recordIndex < records.size(); recordIndex++)
+    {
+        totalNameLength += records[recordIndex].nameLength;
+    }
+    if (totalNameLength != names.length)
+    {
+        return false;
+    }
+
+    uniforms->resize(records.size());
+    const char *name = names.data;
+    for (size_t uniformIndex = 0; uniformIndex < records.size(); uniformIndex++)
+    {
+        const UniformRecord &record = records[uniformIndex];
+        Uniform &uniform = (*uniforms)[uniformIndex];
+
+        uniform.type = record.type;
+        uniform.precision = record.precision;
+        uniform.name.assign(name, record.nameLength);
+        uniform.arraySize = record.arraySize;
+        uniform.blockIndex = record.blockIndex;
+        uniform.offset = record.offset;
+        uniform.arrayStride = record.arrayStride;
+        uniform.matrixStride = record.matrixStride;
+        uniform.isRowMajorMatrix = (record.isRowMajorMatrix != 0);
+        uniform.psRegisterIndex = record.psRegisterIndex;
+        uniform.vsRegisterIndex = record.vsRegisterIndex;
+        uniform.registerCount = record.registerCount;
+        uniform.registerElement = record.registerElement;
+
+        name += record.nameLength;
+    }
+
+    return true;
+}
@@ -0,0 +1,61 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "ImplementationBenchmark.h"
+
+#include "libGLESv2/BinaryStream.h"
+
+#include "angle_gl.h"
+
+struct UniformTableLoadParams
+{
+    std::string suffix() const;
+
+    // Reads the uniforms as one block of records and one block of names, the way ProgramD3D
+    // saves them, instead of one field at a time
+    bool bulk;
+
+    size_t uniformCount;
+    size_t loadsPerStep;
+};
+
+// Reads the uniform table of a program binary, the largest part of one apart from the shader
+// executables, which loading doesn't parse.
+class UniformTableLoadBenchmark : public ImplementationBenchmark
+{
+  public:
+    UniformTableLoadBenchmark(const UniformTableLoadParams &params);
+
+    virtual bool initializeBenchmark();
+    virtual void destroyBenchmark();
+    virtual void stepBenchmark();
+
+  private:
+    struct Uniform
+    {
+        GLenum type;
+        GLenum precision;
+        std::string name;
+        unsigned int arraySize;
+        int blockIndex;
+        int offset;
+        int arrayStride;
+        int matrixStride;
+        bool isRowMajorMatrix;
+        unsigned int psRegisterIndex;
+        unsigned int vsRegisterIndex;
+        unsigned int registerCount;
+        unsigned int registerElement;
+    };
+
+    bool loadFields(gl::BinaryInputStream *stream, std::vector<Uniform> *uniforms) const;
+    bool loadBulk(gl::BinaryInputStream *stream, std::vector<Uniform> *uniforms) const;
+
+    gl::BinaryOutputStream mBinary;
+    size_t mLoadedCount;
+
+    const UniformTableLoadParams mParams;
+};
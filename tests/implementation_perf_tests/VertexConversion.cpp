@@ -0,0 +1,60 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "VertexConversion.h"
+
+#include <sstream>
+
+std::string VertexConversionParams::suffix() const
+{
+    std::stringstream strstr;
+
+    strstr << "_" << rx::GetVertexCopyKernelInfo(kernel).name
+           << "_" << gl::GetSIMDLevelName(level)
+           << "_" << count << "x" << stride
+           << "_" << threads << "threads";
+
+    return strstr.str();
+}
+
+VertexConversionBenchmark::VertexConversionBenchmark(const VertexConversionParams &params)
+    : ImplementationBenchmark("VertexConversion", params.suffix()),
+      mFunction(NULL),
+      mParams(params)
+{
+}
+
+bool VertexConversionBenchmark::initializeBenchmark()
+{
+    mFunction = rx::GetVertexCopyFunction(mParams.kernel, mParams.level);
+    if (!mFunction)
+    {
+        return false;
+    }
+
+    mExecutor.reset(new rx::ImageLoadExecutor(mParams.threads, rx::ImageLoadExecutor::DefaultMinParallelBytes));
+
+    const rx::VertexCopyKernelInfo &info = rx::GetVertexCopyKernelInfo(mParams.kernel);
+    mInput.resize(mParams.count * mParams.stride);
+    mOutput.resize(mParams.count * info.outputBytes);
+    uint32_t seed = 1;
+    for (size_t i = 0; i < mInput.size(); i++)
+    {
+        seed = seed * 1664525 + 1013904223;
+        mInput[i] = static_cast<uint8_t>(seed >> 24);
+    }
+
+    // Only the attribute is read from each vertex
+    mBytesPerIteration = mParams.count * (info.inputBytes + info.outputBytes);
+
+    return true;
+}
+
+void VertexConversionBenchmark::stepBenchmark()
+{
+    const rx::VertexCopyKernelInfo &info = rx::GetVertexCopyKernelInfo(mParams.kernel);
+    mExecutor->copyVertices(mFunction, &mInput[0], mParams.stride, mParams.count, &mOutput[0], info.outputBytes);
+}
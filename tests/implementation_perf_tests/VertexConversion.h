@@ -0,0 +1,40 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "ImplementationBenchmark.h"
+
+#include "libGLESv2/renderer/ImageLoadExecutor.h"
+#include "libGLESv2/renderer/copyvertexSIMD.h"
+
+struct VertexConversionParams
+{
+    std::string suffix() const;
+
+    rx::VertexCopyKernel kernel;
+    gl::SIMDLevel level;
+    size_t count;
+    size_t stride;
+    size_t threads;
+};
+
+// Converts one attribute of interleaved vertices the way the vertex buffers
+// do, through rx::ImageLoadExecutor::copyVertices.
+class VertexConversionBenchmark : public ImplementationBenchmark
+{
+  public:
+    VertexConversionBenchmark(const VertexConversionParams &params);
+
+    virtual bool initializeBenchmark();
+    virtual void stepBenchmark();
+
+  private:
+    VertexCopyFunction mFunction;
+    std::unique_ptr<rx::ImageLoadExecutor> mExecutor;
+    std::vector<uint8_t> mInput;
+    std::vector<uint8_t> mOutput;
+
+    const VertexConversionParams mParams;
+};
@@ -7,6 +7,8 @@
 #include "BufferSubData.h"
 
 #include <cassert>
+#include <cstring>
+#include <limits>
 #include <sstream>
 
 #include "shader_utils.h"
@@ -0,0 +1,218 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "DrawCallPerf.h"
+
+#include <cassert>
+#include <sstream>
+#include <vector>
+
+#include "shader_utils.h"
+
+std::string DrawCallPerfParams::suffix() const
+{
+    std::stringstream strstr;
+
+    strstr << BenchmarkParams::suffix();
+
+    switch (stateChange)
+    {
+      case STATE_CHANGE_UNIFORM: strstr << "_uniform"; break;
+      case STATE_CHANGE_TEXTURE: strstr << "_texture"; break;
+      default:                   break;
+    }
+
+    if (textureUnits > 1)
+    {
+        strstr << "_" << textureUnits << "units";
+    }
+
+    return strstr.str();
+}
+
+DrawCallPerfBenchmark::DrawCallPerfBenchmark(const DrawCallPerfParams &params)
+    : SimpleBenchmark("DrawCallPerf", 256, 256, 2, params),
+      mProgram(0),
+      mVertexBuffer(0),
+      mIndexBuffer(0),
+      mColorLocation(-1),
+      mNumDraws(0),
+      mParams(params)
+{
+    mTextures[0] = 0;
+    mTextures[1] = 0;
+    mDrawIterations = mParams.iterations;
+    assert(mParams.iterations > 0);
+    assert(mParams.textureUnits > 0);
+}
+
+bool DrawCallPerfBenchmark::initializeBenchmark()
+{
+    const std::string vs = SHADER_SOURCE
+    (
+        attribute vec2 vPosition;
+        varying vec2 vTexCoord;
+        void main()
+        {
+            vTexCoord = vPosition * 0.5 + 0.5;
+            gl_Position = vec4(vPosition, 0.0, 1.0);
+        }
+    );
+
+    std::stringstream fsStream;
+    fsStream << "precision mediump float;\n"
+                "uniform vec4 uColor;\n"
+                "uniform sampler2D uTextures[" << mParams.textureUnits << "];\n"
+                "varying vec2 vTexCoord;\n"
+                "void main()\n"
+                "{\n"
+                "    vec4 color = uColor;\n";
+    for (unsigned int unit = 0; unit < mParams.textureUnits; unit++)
+    {
+        fsStream << "    color *= texture2D(uTextures[" << unit << "], vTexCoord);\n";
+    }
+    fsStream << "    gl_FragColor = color;\n"
+                "}\n";
+
+    mProgram = CompileProgram(vs, fsStream.str());
+    if (!mProgram)
+    {
+        return false;
+    }
+
+    glUseProgram(mProgram);
+
+    GLint texturesLocation = glGetUniformLocation(mProgram, "uTextures");
+    if (texturesLocation == -1)
+    {
+        return false;
+    }
+
+    std::vector<GLint> units(mParams.textureUnits);
+    for (unsigned int unit = 0; unit < mParams.textureUnits; unit++)
+    {
+        units[unit] = unit;
+    }
+    glUniform1iv(texturesLocation, static_cast<GLsizei>(units.size()), &units[0]);
+
+    mColorLocation = glGetUniformLocation(mProgram, "uColor");
+    if (mColorLocation == -1)
+    {
+        return false;
+    }
+
+    const GLfloat vertices[] =
+    {
+        -0.1f, -0.1f,
+         0.1f, -0.1f,
+         0.1f,  0.1f,
+        -0.1f,  0.1f,
+    };
+
+    const GLushort indices[] = { 0, 1, 2, 0, 2, 3 };
+
+    glGenBuffers(1, &mVertexBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+
+    glGenBuffers(1, &mIndexBuffer);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+
+    GLint positionLocation = glGetAttribLocation(mProgram, "vPosition");
+    if (positionLocation == -1)
+    {
+        return false;
+    }
+
+    glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, NULL);
+    glEnableVertexAttribArray(positionLocation);
+
+    // Two small textures to switch between
+    const GLubyte pixels[2][4 * 4] =
+    {
+        { 255, 0, 0, 255,  255, 0, 0, 255,  255, 0, 0, 255,  255, 0, 0, 255 },
+        { 0, 0, 255, 255,  0, 0, 255, 255,  0, 0, 255, 255,  0, 0, 255, 255 },
+    };
+
+    glGenTextures(2, mTextures);
+    for (size_t textureIndex = 0; textureIndex < ArraySize(mTextures); textureIndex++)
+    {
+        glBindTexture(GL_TEXTURE_2D, mTextures[textureIndex]);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 2, 2, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels[textureIndex]);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    }
+
+    // The units other than 0 keep the first texture
+    for (unsigned int unit = mParams.textureUnits - 1; unit > 0; unit--)
+    {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        glBindTexture(GL_TEXTURE_2D, mTextures[0]);
+    }
+    glActiveTexture(GL_TEXTURE0);
+
+    glUniform4f(mColorLocation, 1.0f, 1.0f, 1.0f, 1.0f);
+
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glEnable(GL_DEPTH_TEST);
+    glDepthFunc(GL_LEQUAL);
+
+    glViewport(0, 0, getWindow()->getWidth(), getWindow()->getHeight());
+
+    GLenum glErr = glGetError();
+    if (glErr != GL_NO_ERROR)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+void DrawCallPerfBenchmark::destroyBenchmark()
+{
+    double elapsedTime = getElapsedTime();
+    if (elapsedTime > 0.0)
+    {
+        printResult("draw_calls_per_second", static_cast<double>(mNumDraws) / elapsedTime, "calls/s", true);
+
+        if (mParams.stateChange != STATE_CHANGE_NONE)
+        {
+            printResult("state_changes_per_second", static_cast<double>(mNumDraws) / elapsedTime, "calls/s", true);
+        }
+    }
+
+    glDeleteProgram(mProgram);
+    glDeleteBuffers(1, &mVertexBuffer);
+    glDeleteBuffers(1, &mIndexBuffer);
+    glDeleteTextures(2, mTextures);
+}
+
+void DrawCallPerfBenchmark::drawBenchmark()
+{
+    // One state change before every draw, so that none of them can be
+    // skipped as redundant
+    switch (mParams.stateChange)
+    {
+      case STATE_CHANGE_UNIFORM:
+        {
+            GLfloat color[4] = { 1.0f, 1.0f, 1.0f, static_cast<GLfloat>(mNumDraws % 2) };
+            glUniform4fv(mColorLocation, 1, color);
+        }
+        break;
+
+      case STATE_CHANGE_TEXTURE:
+        glBindTexture(GL_TEXTURE_2D, mTextures[mNumDraws % 2]);
+        break;
+
+      default:
+        break;
+    }
+
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, NULL);
+    mNumDraws++;
+}
@@ -0,0 +1,56 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "SimpleBenchmark.h"
+
+enum StateChange
+{
+    STATE_CHANGE_NONE,
+    STATE_CHANGE_UNIFORM,
+    STATE_CHANGE_TEXTURE,
+};
+
+struct DrawCallPerfParams : public BenchmarkParams
+{
+    virtual std::string suffix() const;
+
+    // What changes between two draws
+    StateChange stateChange;
+
+    // How many texture units the program samples. The texture changes only
+    // rebind unit 0.
+    unsigned int textureUnits;
+
+    // static parameters
+    unsigned int iterations;
+};
+
+// Measures how many small glDrawElements calls, and the glUniform4fv or
+// glBindTexture calls between them, go through each second. Blending and the
+// depth test are enabled so that the fixed-function state is not trivial. On
+// the null renderer nothing is drawn, so this is the cost of the GL front-end
+// alone.
+class DrawCallPerfBenchmark : public SimpleBenchmark
+{
+public:
+    DrawCallPerfBenchmark(const DrawCallPerfParams &params);
+
+    virtual bool initializeBenchmark();
+    virtual void destroyBenchmark();
+    virtual void drawBenchmark();
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(DrawCallPerfBenchmark);
+
+    GLuint mProgram;
+    GLuint mVertexBuffer;
+    GLuint mIndexBuffer;
+    GLuint mTextures[2];
+    GLint mColorLocation;
+    unsigned int mNumDraws;
+
+    const DrawCallPerfParams mParams;
+};
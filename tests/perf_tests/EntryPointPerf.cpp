@@ -0,0 +1,175 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "EntryPointPerf.h"
+
+#include <cassert>
+#include <sstream>
+
+#include "shader_utils.h"
+
+std::string EntryPointPerfParams::suffix() const
+{
+    std::stringstream strstr;
+
+    strstr << BenchmarkParams::suffix();
+
+    switch (entryPoint)
+    {
+      case ENTRY_POINT_DRAW_ELEMENTS: strstr << "_draw_elements"; break;
+      case ENTRY_POINT_UNIFORM:       strstr << "_uniform";       break;
+      case ENTRY_POINT_BIND_BUFFER:   strstr << "_bind_buffer";   break;
+      case ENTRY_POINT_ENABLE:        strstr << "_enable";        break;
+      default: assert(0);             break;
+    }
+
+    if (noError)
+    {
+        strstr << "_no_error";
+    }
+
+    return strstr.str();
+}
+
+EntryPointPerfBenchmark::EntryPointPerfBenchmark(const EntryPointPerfParams &params)
+    : SimpleBenchmark("EntryPointPerf", 256, 256, 2, params),
+      mProgram(0),
+      mColorLocation(-1),
+      mNumCalls(0),
+      mParams(params)
+{
+    mBuffers[0] = 0;
+    mBuffers[1] = 0;
+    mDrawIterations = mParams.iterations;
+    getEGLWindow()->setNoError(mParams.noError);
+    assert(mParams.iterations > 0);
+    assert(mParams.callsPerIteration > 0);
+}
+
+bool EntryPointPerfBenchmark::initializeBenchmark()
+{
+    const std::string vs = SHADER_SOURCE
+    (
+        attribute vec2 vPosition;
+        void main()
+        {
+            gl_Position = vec4(vPosition, 0.0, 1.0);
+        }
+    );
+
+    const std::string fs = SHADER_SOURCE
+    (
+        precision mediump float;
+        uniform vec4 uColor;
+        void main()
+        {
+            gl_FragColor = uColor;
+        }
+    );
+
+    mProgram = CompileProgram(vs, fs);
+    if (!mProgram)
+    {
+        return false;
+    }
+
+    glUseProgram(mProgram);
+
+    mColorLocation = glGetUniformLocation(mProgram, "uColor");
+    if (mColorLocation == -1)
+    {
+        return false;
+    }
+
+    const GLfloat vertices[] =
+    {
+        -0.1f, -0.1f,
+         0.1f, -0.1f,
+         0.1f,  0.1f,
+    };
+
+    const GLushort indices[] = { 0, 1, 2 };
+
+    glGenBuffers(2, mBuffers);
+    glBindBuffer(GL_ARRAY_BUFFER, mBuffers[0]);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mBuffers[1]);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+
+    GLint positionLocation = glGetAttribLocation(mProgram, "vPosition");
+    if (positionLocation == -1)
+    {
+        return false;
+    }
+
+    glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, NULL);
+    glEnableVertexAttribArray(positionLocation);
+
+    glUniform4f(mColorLocation, 1.0f, 1.0f, 1.0f, 1.0f);
+    glViewport(0, 0, getWindow()->getWidth(), getWindow()->getHeight());
+
+    GLenum glErr = glGetError();
+    if (glErr != GL_NO_ERROR)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+void EntryPointPerfBenchmark::destroyBenchmark()
+{
+    double elapsedTime = getElapsedTime();
+    if (elapsedTime > 0.0)
+    {
+        printResult("calls_per_second", static_cast<double>(mNumCalls) / elapsedTime, "calls/s", true);
+    }
+
+    glDeleteProgram(mProgram);
+    glDeleteBuffers(2, mBuffers);
+}
+
+void EntryPointPerfBenchmark::drawBenchmark()
+{
+    // Alternate the arguments so that no call can be skipped as redundant
+    for (unsigned int callIndex = 0; callIndex < mParams.callsPerIteration; callIndex++)
+    {
+        switch (mParams.entryPoint)
+        {
+          case ENTRY_POINT_DRAW_ELEMENTS:
+            glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_SHORT, NULL);
+            break;
+
+          case ENTRY_POINT_UNIFORM:
+            {
+                GLfloat color[4] = { 1.0f, 1.0f, 1.0f, static_cast<GLfloat>(callIndex % 2) };
+                glUniform4fv(mColorLocation, 1, color);
+            }
+            break;
+
+          case ENTRY_POINT_BIND_BUFFER:
+            glBindBuffer(GL_ARRAY_BUFFER, mBuffers[callIndex % 2]);
+            break;
+
+          case ENTRY_POINT_ENABLE:
+            if (callIndex % 2 == 0)
+            {
+                glEnable(GL_BLEND);
+            }
+            else
+            {
+                glDisable(GL_BLEND);
+            }
+            break;
+
+          default:
+            assert(0);
+            break;
+        }
+    }
+
+    mNumCalls += mParams.callsPerIteration;
+}
@@ -0,0 +1,52 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "SimpleBenchmark.h"
+
+enum EntryPoint
+{
+    ENTRY_POINT_DRAW_ELEMENTS,
+    ENTRY_POINT_UNIFORM,
+    ENTRY_POINT_BIND_BUFFER,
+    ENTRY_POINT_ENABLE,
+};
+
+struct EntryPointPerfParams : public BenchmarkParams
+{
+    virtual std::string suffix() const;
+
+    // Whether the context is created with EGL_KHR_create_context_no_error
+    bool noError;
+
+    // Which entry point is called in a loop
+    EntryPoint entryPoint;
+
+    // static parameters
+    unsigned int callsPerIteration;
+    unsigned int iterations;
+};
+
+// Measures how many calls to one entry point go through each second, so that
+// a validated context can be compared with a no-error one.
+class EntryPointPerfBenchmark : public SimpleBenchmark
+{
+public:
+    EntryPointPerfBenchmark(const EntryPointPerfParams &params);
+
+    virtual bool initializeBenchmark();
+    virtual void destroyBenchmark();
+    virtual void drawBenchmark();
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(EntryPointPerfBenchmark);
+
+    GLuint mProgram;
+    GLuint mBuffers[2];
+    GLint mColorLocation;
+    unsigned int mNumCalls;
+
+    const EntryPointPerfParams mParams;
+};
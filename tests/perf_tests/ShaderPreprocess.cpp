@@ -0,0 +1,117 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "ShaderPreprocess.h"
+
+#include <cassert>
+#include <sstream>
+#include <iostream>
+
+std::string ShaderPreprocessParams::suffix() const
+{
+    std::stringstream strstr;
+
+    strstr << (preprocessOnly ? "_preprocess" : "_compile")
+           << "_" << numFunctions << "funcs";
+
+    return strstr.str();
+}
+
+ShaderPreprocessBenchmark::ShaderPreprocessBenchmark(const ShaderPreprocessParams &params)
+    : SimpleBenchmark("ShaderPreprocess", 64, 64, 2, params),
+      mCompiler(NULL),
+      mParams(params)
+{
+    mDrawIterations = mParams.iterations;
+    assert(mParams.iterations > 0);
+}
+
+bool ShaderPreprocessBenchmark::initializeBenchmark()
+{
+    if (!ShInitialize())
+    {
+        return false;
+    }
+
+    ShBuiltInResources resources;
+    ShInitBuiltInResources(&resources);
+    resources.OES_standard_derivatives = 1;
+
+    mCompiler = ShConstructCompiler(GL_FRAGMENT_SHADER, SH_WEBGL_SPEC, SH_HLSL11_OUTPUT, &resources);
+    if (!mCompiler)
+    {
+        return false;
+    }
+
+    // A macro-heavy shader, similar to what engines generate.
+    std::stringstream strstr;
+
+    strstr << "#extension GL_OES_standard_derivatives : enable\n"
+              "precision mediump float;\n"
+              "#define SATURATE(x) clamp(x, 0.0, 1.0)\n"
+              "#define LUMA(c) dot(c.rgb, vec3(0.299, 0.587, 0.114))\n"
+              "#define BLEND(a, b, t) mix(a, b, SATURATE(t))\n"
+              "uniform vec4 uColor;\n"
+              "varying vec2 vTexCoord;\n";
+
+    for (unsigned int funcIndex = 0; funcIndex < mParams.numFunctions; funcIndex++)
+    {
+        strstr << "// Shades layer " << funcIndex << ".\n"
+               << "vec4 shade" << funcIndex << "(vec4 color, vec2 uv)\n"
+                  "{\n"
+                  "    float l = LUMA(color);\n"
+                  "#ifdef GL_OES_standard_derivatives\n"
+                  "    l += fwidth(uv.x);\n"
+                  "#endif\n"
+                  "    return BLEND(color, vec4(l), uv.y * " << funcIndex << ".0);\n"
+                  "}\n";
+    }
+
+    strstr << "void main()\n"
+              "{\n"
+              "    vec4 color = uColor;\n";
+
+    for (unsigned int funcIndex = 0; funcIndex < mParams.numFunctions; funcIndex++)
+    {
+        strstr << "    color = shade" << funcIndex << "(color, vTexCoord);\n";
+    }
+
+    strstr << "    gl_FragColor = color;\n"
+              "}\n";
+
+    mSource = strstr.str();
+
+    return true;
+}
+
+void ShaderPreprocessBenchmark::destroyBenchmark()
+{
+    ShDestruct(mCompiler);
+    mCompiler = NULL;
+    ShFinalize();
+}
+
+void ShaderPreprocessBenchmark::drawBenchmark()
+{
+    const char *shaderStrings[] = { mSource.c_str() };
+
+    bool result = false;
+    if (mParams.preprocessOnly)
+    {
+        ShPreprocessorOutput output;
+        result = ShPreprocess(mCompiler, shaderStrings, 1, &output);
+    }
+    else
+    {
+        // Same options as ShaderD3D, HLSL output needs the collected uniforms
+        result = ShCompile(mCompiler, shaderStrings, 1, SH_OBJECT_CODE | SH_VARIABLES);
+    }
+
+    if (!result)
+    {
+        std::cerr << ShGetInfoLog(mCompiler) << std::endl;
+    }
+}
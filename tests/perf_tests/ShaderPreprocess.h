@@ -0,0 +1,40 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "SimpleBenchmark.h"
+
+#include "GLSLANG/ShaderLang.h"
+
+struct ShaderPreprocessParams : public BenchmarkParams
+{
+    virtual std::string suffix() const;
+
+    // Runs ShPreprocess if true, ShCompile otherwise.
+    bool preprocessOnly;
+    unsigned int numFunctions;
+
+    // static parameters
+    unsigned int iterations;
+};
+
+// Measures the translator alone. The window is only used for timing.
+class ShaderPreprocessBenchmark : public SimpleBenchmark
+{
+public:
+    ShaderPreprocessBenchmark(const ShaderPreprocessParams &params);
+
+    virtual bool initializeBenchmark();
+    virtual void destroyBenchmark();
+    virtual void drawBenchmark();
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(ShaderPreprocessBenchmark);
+
+    ShHandle mCompiler;
+    std::string mSource;
+
+    const ShaderPreprocessParams mParams;
+};
@@ -17,6 +17,7 @@ std::string BenchmarkParams::suffix() const
     {
         case EGL_PLATFORM_ANGLE_TYPE_D3D11_ANGLE: return "_d3d11";
         case EGL_PLATFORM_ANGLE_TYPE_D3D9_ANGLE: return "_d3d9";
+        case EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE: return "_null";
         default: assert(0); return "_unk";
     }
 }
@@ -50,6 +51,11 @@ void SimpleBenchmark::printResult(const std::string &trace, size_t value, const
     perf_test::PrintResult(mName, mSuffix, trace, value, units, important);
 }
 
+double SimpleBenchmark::getElapsedTime() const
+{
+    return mTimer->getElapsedTime();
+}
+
 void SimpleBenchmark::destroy()
 {
     double totalTime = mTimer->getElapsedTime();
@@ -156,4 +162,9 @@ bool SimpleBenchmark::popEvent(Event *event)
 OSWindow *SimpleBenchmark::getWindow()
 {
     return mOSWindow.get();
+}
+
+EGLWindow *SimpleBenchmark::getEGLWindow()
+{
+    return mEGLWindow.get();
 }
\ No newline at end of file
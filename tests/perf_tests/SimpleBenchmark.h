@@ -50,11 +50,15 @@ class SimpleBenchmark
     bool popEvent(Event *event);
 
     OSWindow *getWindow();
+    EGLWindow *getEGLWindow();
 
   protected:
     void printResult(const std::string &trace, double value, const std::string &units, bool important) const;
     void printResult(const std::string &trace, size_t value, const std::string &units, bool important) const;
 
+    // Seconds since the first frame started
+    double getElapsedTime() const;
+
     unsigned int mDrawIterations;
     double mRunTimeSeconds;
     int mNumFrames;
@@ -6,15 +6,31 @@
 
 #include "SimpleBenchmark.h"
 #include "BufferSubData.h"
+#include "DrawCallPerf.h"
+#include "EntryPointPerf.h"
 #include "TexSubImage.h"
 #include "PointSprites.h"
+#include "ShaderPreprocess.h"
 
+#if defined(_WIN32)
 EGLint platforms[] =
 {
     EGL_PLATFORM_ANGLE_TYPE_D3D9_ANGLE,
     EGL_PLATFORM_ANGLE_TYPE_D3D11_ANGLE
 };
 
+// Used by the benchmarks that only need one back-end
+const EGLint defaultPlatform = EGL_PLATFORM_ANGLE_TYPE_D3D11_ANGLE;
+#else
+// The null renderer is the only back-end outside of Windows
+EGLint platforms[] =
+{
+    EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE
+};
+
+const EGLint defaultPlatform = EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE;
+#endif
+
 GLenum vertexTypes[] = { GL_FLOAT };
 GLint componentCounts[] = { 4 };
 GLboolean vertexNorms[] = { GL_FALSE };
@@ -118,4 +134,87 @@ int main(int argc, char **argv)
     }
 
     RunBenchmarks<PointSpritesBenchmark>(pointSpriteParams);
+
+    std::vector<ShaderPreprocessParams> preprocessParams;
+
+    for (size_t modeIt = 0; modeIt < 2; modeIt++)
+    {
+        ShaderPreprocessParams params;
+
+        params.requestedRenderer = defaultPlatform;
+        params.preprocessOnly = (modeIt == 0);
+        params.numFunctions = 64;
+        params.iterations = 10;
+
+        preprocessParams.push_back(params);
+    }
+
+    RunBenchmarks<ShaderPreprocessBenchmark>(preprocessParams);
+
+    // The null renderer measures the front-end alone, D3D11 the same calls
+    // with a driver behind them
+    EGLint drawCallPlatforms[] =
+    {
+#if defined(ANGLE_ENABLE_NULL)
+        EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE,
+#endif
+#if defined(_WIN32)
+        EGL_PLATFORM_ANGLE_TYPE_D3D11_ANGLE,
+#endif
+    };
+
+    StateChange stateChanges[] = { STATE_CHANGE_NONE, STATE_CHANGE_UNIFORM, STATE_CHANGE_TEXTURE };
+
+    std::vector<DrawCallPerfParams> drawCallParams;
+
+    for (size_t platIt = 0; platIt < ArraySize(drawCallPlatforms); platIt++)
+    {
+        for (size_t stateIt = 0; stateIt < ArraySize(stateChanges); stateIt++)
+        {
+            DrawCallPerfParams params;
+
+            params.requestedRenderer = drawCallPlatforms[platIt];
+            params.stateChange = stateChanges[stateIt];
+            params.textureUnits = 1;
+            params.iterations = 1000;
+
+            drawCallParams.push_back(params);
+        }
+
+        // With more units bound, re-applying every texture for a uniform change costs more
+        DrawCallPerfParams params;
+        params.requestedRenderer = drawCallPlatforms[platIt];
+        params.stateChange = STATE_CHANGE_UNIFORM;
+        params.textureUnits = 8;
+        params.iterations = 1000;
+
+        drawCallParams.push_back(params);
+    }
+
+    RunBenchmarks<DrawCallPerfBenchmark>(drawCallParams);
+
+    EntryPoint entryPoints[] = { ENTRY_POINT_DRAW_ELEMENTS, ENTRY_POINT_UNIFORM, ENTRY_POINT_BIND_BUFFER, ENTRY_POINT_ENABLE };
+
+    std::vector<EntryPointPerfParams> entryPointParams;
+
+    for (size_t platIt = 0; platIt < ArraySize(drawCallPlatforms); platIt++)
+    {
+        for (size_t entryIt = 0; entryIt < ArraySize(entryPoints); entryIt++)
+        {
+            for (size_t modeIt = 0; modeIt < 2; modeIt++)
+            {
+                EntryPointPerfParams params;
+
+                params.requestedRenderer = drawCallPlatforms[platIt];
+                params.entryPoint = entryPoints[entryIt];
+                params.noError = (modeIt == 1);
+                params.callsPerIteration = 100;
+                params.iterations = 10;
+
+                entryPointParams.push_back(params);
+            }
+        }
+    }
+
+    RunBenchmarks<EntryPointPerfBenchmark>(entryPointParams);
 }
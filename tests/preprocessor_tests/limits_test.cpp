@@ -0,0 +1,240 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include <sstream>
+
+#include "PreprocessorTest.h"
+#include "Token.h"
+
+using testing::_;
+
+class LimitsTest : public PreprocessorTest
+{
+  protected:
+    // Defines f0 to f<depth> where f<n> expands to 4^n copies of its
+    // argument.
+    static std::string exponentialMacros(int depth)
+    {
+        std::ostringstream stream;
+        stream << "#define f0(x) x x\n";
+        for (int i = 1; i <= depth; ++i)
+        {
+            stream << "#define f" << i << "(x) f" << (i - 1) << "(f" << (i - 1) << "(x))\n";
+        }
+        return stream.str();
+    }
+
+    // Preprocesses the input and returns the number of tokens produced.
+    int countTokens(const std::string &input)
+    {
+        const char *str = input.c_str();
+        EXPECT_TRUE(mPreprocessor.init(1, &str, NULL));
+
+        int count = 0;
+        pp::Token token;
+        for (mPreprocessor.lex(&token); token.type != pp::Token::LAST; mPreprocessor.lex(&token))
+        {
+            ++count;
+        }
+        return count;
+    }
+};
+
+TEST_F(LimitsTest, ExpansionWithinBudget)
+{
+    const char *input = "#define A a a\n"
+                        "A A\n";
+    const char *expected = "\n"
+                           "a a a a\n";
+
+    mPreprocessor.setMaxMacroExpandedTokens(4);
+    EXPECT_CALL(mDiagnostics, print(_, _, _)).Times(0);
+
+    preprocess(input, expected);
+}
+
+TEST_F(LimitsTest, ExpansionExceedsBudget)
+{
+    const char *input = "#define A a a\n"
+                        "A A A\n";
+    const char *expected = "\n"
+                           "a a a a";
+
+    mPreprocessor.setMaxMacroExpandedTokens(4);
+    EXPECT_CALL(mDiagnostics,
+                print(pp::Diagnostics::PP_MACRO_EXPANSION_TOO_LARGE,
+                      pp::SourceLocation(0, 2),
+                      "A"));
+
+    preprocess(input, expected);
+}
+
+// Expanding f30(a) would produce 4^30 tokens. It must be rejected after
+// producing at most the budgeted number of tokens.
+TEST_F(LimitsTest, ExponentialExpansion)
+{
+    std::string input = exponentialMacros(30) + "f30(a)\n";
+
+    mPreprocessor.setMaxMacroExpandedTokens(1000);
+    EXPECT_CALL(mDiagnostics,
+                print(pp::Diagnostics::PP_MACRO_EXPANSION_TOO_LARGE,
+                      pp::SourceLocation(0, 32),
+                      _));
+
+    EXPECT_EQ(0, countTokens(input));
+}
+
+TEST_F(LimitsTest, ExponentialExpansionDefaultBudget)
+{
+    std::string input = exponentialMacros(30) + "f30(a)\n";
+
+    EXPECT_CALL(mDiagnostics,
+                print(pp::Diagnostics::PP_MACRO_EXPANSION_TOO_LARGE,
+                      pp::SourceLocation(0, 32),
+                      _));
+
+    EXPECT_EQ(0, countTokens(input));
+}
+
+// The expansion budget covers the whole shader, not single expansions.
+TEST_F(LimitsTest, ExpansionBudgetIsCumulative)
+{
+    std::string input = "#define A a a a a a a a a a a\n";
+    for (int i = 0; i < 300; ++i)
+    {
+        input += "A\n";
+    }
+
+    mPreprocessor.setMaxMacroExpandedTokens(1000);
+    EXPECT_CALL(mDiagnostics,
+                print(pp::Diagnostics::PP_MACRO_EXPANSION_TOO_LARGE,
+                      pp::SourceLocation(0, 102),
+                      "A"));
+
+    EXPECT_EQ(1000, countTokens(input));
+}
+
+TEST_F(LimitsTest, ExponentialExpansionInConditional)
+{
+    std::string input = exponentialMacros(30) +
+                        "#if f30(1)\n"
+                        "a\n"
+                        "#endif\n"
+                        "b\n";
+
+    mPreprocessor.setMaxMacroExpandedTokens(1000);
+    EXPECT_CALL(mDiagnostics,
+                print(pp::Diagnostics::PP_MACRO_EXPANSION_TOO_LARGE,
+                      pp::SourceLocation(0, 32),
+                      _));
+    // The expression ends where the expansion was abandoned.
+    EXPECT_CALL(mDiagnostics,
+                print(pp::Diagnostics::PP_INVALID_EXPRESSION, _, "syntax error"));
+
+    EXPECT_EQ(0, countTokens(input));
+}
+
+TEST_F(LimitsTest, NestingWithinLimit)
+{
+    const char *input = "#define m0 x\n"
+                        "#define m1 m0\n"
+                        "#define m2 m1\n"
+                        "#define m3 m2\n"
+                        "m3\n";
+    const char *expected = "\n"
+                           "\n"
+                           "\n"
+                           "\n"
+                           "x\n";
+
+    mPreprocessor.setMaxMacroNestingDepth(4);
+    EXPECT_CALL(mDiagnostics, print(_, _, _)).Times(0);
+
+    preprocess(input, expected);
+}
+
+TEST_F(LimitsTest, NestingTooDeep)
+{
+    const char *input = "#define m0 x\n"
+                        "#define m1 m0\n"
+                        "#define m2 m1\n"
+                        "#define m3 m2\n"
+                        "#define m4 m3\n"
+                        "m4\n";
+    const char *expected = "";
+
+    mPreprocessor.setMaxMacroNestingDepth(4);
+    EXPECT_CALL(mDiagnostics,
+                print(pp::Diagnostics::PP_MACRO_NESTING_TOO_DEEP,
+                      pp::SourceLocation(0, 6),
+                      "m0"));
+
+    preprocess(input, expected);
+}
+
+// Arguments are expanded recursively before substitution. Deeply nested
+// invocations must be rejected before they exhaust the stack.
+TEST_F(LimitsTest, NestedInvocationsTooDeep)
+{
+    std::string input = "#define f(x) x\n";
+    for (int i = 0; i < 1000; ++i)
+    {
+        input += "f(";
+    }
+    input += "1";
+    for (int i = 0; i < 1000; ++i)
+    {
+        input += ")";
+    }
+    input += "\n";
+
+    EXPECT_CALL(mDiagnostics,
+                print(pp::Diagnostics::PP_MACRO_NESTING_TOO_DEEP,
+                      pp::SourceLocation(0, 2),
+                      "f"));
+
+    EXPECT_EQ(0, countTokens(input));
+}
+
+TEST_F(LimitsTest, TokensPerLine)
+{
+    const char *input = "a b c\n"
+                        "d e f g h\n"
+                        "i\n";
+    const char *expected = "a b c\n"
+                           "d e f";
+
+    mPreprocessor.setMaxTokensPerLine(3);
+    EXPECT_CALL(mDiagnostics,
+                print(pp::Diagnostics::PP_LINE_TOO_LONG,
+                      pp::SourceLocation(0, 2),
+                      "g"));
+
+    preprocess(input, expected);
+}
+
+TEST_F(LimitsTest, SourceSizeWithinLimit)
+{
+    const char *input = "int a;";
+
+    mPreprocessor.setMaxSourceSize(6);
+    EXPECT_CALL(mDiagnostics, print(_, _, _)).Times(0);
+
+    EXPECT_TRUE(mPreprocessor.init(1, &input, NULL));
+}
+
+TEST_F(LimitsTest, SourceTooLong)
+{
+    const char *input[] = { "int a;", "int b;" };
+
+    mPreprocessor.setMaxSourceSize(11);
+    EXPECT_CALL(mDiagnostics,
+                print(pp::Diagnostics::PP_SOURCE_TOO_LONG,
+                      pp::SourceLocation(),
+                      ""));
+
+    EXPECT_FALSE(mPreprocessor.init(2, input, NULL));
+}
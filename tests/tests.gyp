@@ -132,53 +132,11 @@
 
     'conditions':
     [
-        ['OS=="win"',
+        # Outside of Windows, the perf and implementation unit tests run on the null back-end.
+        ['OS=="win" or (OS=="linux" and angle_enable_null==1)',
         {
             'targets':
             [
-                {
-                    'target_name': 'angle_tests',
-                    'type': 'executable',
-                    'includes': [ '../build/common_defines.gypi', ],
-                    'dependencies':
-                    [
-                        '../src/angle.gyp:libGLESv2',
-                        '../src/angle.gyp:libEGL',
-                        'gtest',
-                        '../util/util.gyp:angle_util',
-                    ],
-                    'include_dirs':
-                    [
-                        '../include',
-                        'angle_tests',
-                        'third_party/googletest/include',
-                    ],
-                    'sources':
-                    [
-                        '<!@(python <(angle_path)/enumerate_files.py angle_tests -types *.cpp *.h *.inl)'
-                    ],
-                },
-                {
-                    'target_name': 'standalone_tests',
-                    'type': 'executable',
-                    'includes': [ '../build/common_defines.gypi', ],
-                    'dependencies':
-                    [
-                        'gtest',
-                        'gmock',
-                    ],
-                    'include_dirs':
-                    [
-                        '../include',
-                        'angle_tests',
-                        'third_party/googletest/include',
-                        'third_party/googlemock/include',
-                    ],
-                    'sources':
-                    [
-                        '<!@(python <(angle_path)/enumerate_files.py standalone_tests -types *.cpp *.h)'
-                    ],
-                },
                 {
                     'target_name': 'angle_perf_tests',
                     'type': 'executable',
@@ -187,6 +145,7 @@
                     [
                         '../src/angle.gyp:libGLESv2',
                         '../src/angle.gyp:libEGL',
+                        '../src/angle.gyp:translator_static',
                         '../util/util.gyp:angle_util',
                     ],
                     'include_dirs':
@@ -198,8 +157,14 @@
                     [
                         'perf_tests/BufferSubData.cpp',
                         'perf_tests/BufferSubData.h',
+                        'perf_tests/DrawCallPerf.cpp',
+                        'perf_tests/DrawCallPerf.h',
+                        'perf_tests/EntryPointPerf.cpp',
+                        'perf_tests/EntryPointPerf.h',
                         'perf_tests/PointSprites.cpp',
                         'perf_tests/PointSprites.h',
+                        'perf_tests/ShaderPreprocess.cpp',
+                        'perf_tests/ShaderPreprocess.h',
                         'perf_tests/SimpleBenchmark.cpp',
                         'perf_tests/SimpleBenchmark.h',
                         'perf_tests/SimpleBenchmarks.cpp',
@@ -208,6 +173,16 @@
                         'perf_tests/third_party/perf/perf_test.cc',
                         'perf_tests/third_party/perf/perf_test.h',
                     ],
+                    'conditions':
+                    [
+                        ['angle_enable_null==1',
+                        {
+                            'defines':
+                            [
+                                'ANGLE_ENABLE_NULL',
+                            ],
+                        }],
+                    ],
                 },
 
                 {
@@ -237,6 +212,19 @@
                     ],
                     'conditions':
                     [
+                        ['angle_enable_null==1',
+                        {
+                            # The null renderer takes the EGL display attributes, which libGLESv2_static leaves out.
+                            'sources':
+                            [
+                                '../src/libEGL/AttributeMap.cpp',
+                                'angle_implementation_unit_tests/NullRendererStateApply_unittest.cpp',
+                            ],
+                            'defines':
+                            [
+                                'ANGLE_ENABLE_NULL',
+                            ],
+                        }],
                         ['angle_build_winrt==1',
                         {
                             'sources':
@@ -262,6 +250,115 @@
                     ],
                 },
             ],
+        }],
+        ['OS=="win"',
+        {
+            'targets':
+            [
+                {
+                    'target_name': 'angle_tests',
+                    'type': 'executable',
+                    'includes': [ '../build/common_defines.gypi', ],
+                    'dependencies':
+                    [
+                        '../src/angle.gyp:libGLESv2',
+                        '../src/angle.gyp:libEGL',
+                        'gtest',
+                        '../util/util.gyp:angle_util',
+                    ],
+                    'include_dirs':
+                    [
+                        '../include',
+                        'angle_tests',
+                        'third_party/googletest/include',
+                    ],
+                    'sources':
+                    [
+                        '<!@(python <(angle_path)/enumerate_files.py angle_tests -types *.cpp *.h *.inl)'
+                    ],
+                },
+                {
+                    'target_name': 'standalone_tests',
+                    'type': 'executable',
+                    'includes': [ '../build/common_defines.gypi', ],
+                    'dependencies':
+                    [
+                        'gtest',
+                        'gmock',
+                    ],
+                    'include_dirs':
+                    [
+                        '../include',
+                        'angle_tests',
+                        'third_party/googletest/include',
+                        'third_party/googlemock/include',
+                    ],
+                    'sources':
+                    [
+                        '<!@(python <(angle_path)/enumerate_files.py standalone_tests -types *.cpp *.h)'
+                    ],
+                },
+
+                {
+                    'target_name': 'angle_implementation_perf_tests',
+                    'type': 'executable',
+                    'includes': [ '../build/common_defines.gypi', ],
+                    'dependencies':
+                    [
+                        '../src/angle.gyp:libGLESv2_static',
+                    ],
+                    'include_dirs':
+                    [
+                        '../include',
+                        '../src',
+                        '../util',
+                        'perf_tests',
+                    ],
+                    'sources':
+                    [
+                        'implementation_perf_tests/ColorRowCopy.cpp',
+                        'implementation_perf_tests/ColorRowCopy.h',
+                        'implementation_perf_tests/ETCDecode.cpp',
+                        'implementation_perf_tests/ETCDecode.h',
+                        'implementation_perf_tests/Float16Conversion.cpp',
+                        'implementation_perf_tests/Float16Conversion.h',
+                        'implementation_perf_tests/FormatInfoLookup.cpp',
+                        'implementation_perf_tests/FormatInfoLookup.h',
+                        'implementation_perf_tests/ImageLoadScaling.cpp',
+                        'implementation_perf_tests/ImageLoadScaling.h',
+                        'implementation_perf_tests/IndexConversion.cpp',
+                        'implementation_perf_tests/IndexConversion.h',
+                        'implementation_perf_tests/IndexRangeInvalidation.cpp',
+                        'implementation_perf_tests/IndexRangeInvalidation.h',
+                        'implementation_perf_tests/ImplementationBenchmark.cpp',
+                        'implementation_perf_tests/ImplementationBenchmark.h',
+                        'implementation_perf_tests/ImplementationBenchmarks.cpp',
+                        'implementation_perf_tests/LoadImage.cpp',
+                        'implementation_perf_tests/LoadImage.h',
+                        'implementation_perf_tests/MipChain.cpp',
+                        'implementation_perf_tests/MipChain.h',
+                        'implementation_perf_tests/PackedFloatConversion.cpp',
+                        'implementation_perf_tests/PackedFloatConversion.h',
+                        'implementation_perf_tests/ProgramCacheLookup.cpp',
+                        'implementation_perf_tests/ProgramCacheLookup.h',
+                        'implementation_perf_tests/ResourceMapLookup.cpp',
+                        'implementation_perf_tests/ResourceMapLookup.h',
+                        'implementation_perf_tests/SamplerCompleteness.cpp',
+                        'implementation_perf_tests/SamplerCompleteness.h',
+                        'implementation_perf_tests/UniformNameLookup.cpp',
+                        'implementation_perf_tests/UniformNameLookup.h',
+                        'implementation_perf_tests/UniformTableLoad.cpp',
+                        'implementation_perf_tests/UniformTableLoad.h',
+                        'implementation_perf_tests/VertexConversion.cpp',
+                        'implementation_perf_tests/VertexConversion.h',
+                        'perf_tests/third_party/perf/perf_test.cc',
+                        'perf_tests/third_party/perf/perf_test.h',
+                        '../util/Timer.h',
+                        '../util/win32/Win32Timer.cpp',
+                        '../util/win32/Win32Timer.h',
+                    ],
+                },
+            ],
             'conditions':
             [
                 ['angle_build_conformance_tests',
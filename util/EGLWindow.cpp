@@ -5,6 +5,7 @@
 //
 
 #include <cassert>
+#include <vector>
 
 #include "EGLWindow.h"
 #include "OSWindow.h"
@@ -12,6 +13,9 @@
 #ifdef _WIN32
 #include "win32/Win32Timer.h"
 #include "win32/Win32Window.h"
+#elif defined(__linux__)
+#include "linux/LinuxTimer.h"
+#include "linux/LinuxWindow.h"
 #else
 #error unsupported OS.
 #endif
@@ -58,7 +62,8 @@ EGLWindow::EGLWindow(size_t width, size_t height, EGLint glesMajorVersion, const
       mDepthBits(-1),
       mStencilBits(-1),
       mMultisample(false),
-      mSwapInterval(-1)
+      mSwapInterval(-1),
+      mNoError(false)
 {
 }
 
@@ -171,19 +176,41 @@ bool EGLWindow::initializeGL(OSWindow *osWindow)
         mSurface = eglCreateWindowSurface(mDisplay, mConfig, NULL, NULL);
     }
 
+    if (mSurface == EGL_NO_SURFACE)
+    {
+        // Platforms without window surfaces render offscreen
+        eglGetError();
+
+        const EGLint pbufferAttributes[] =
+        {
+            EGL_WIDTH,  static_cast<EGLint>(mWidth),
+            EGL_HEIGHT, static_cast<EGLint>(mHeight),
+            EGL_NONE,
+        };
+
+        mSurface = eglCreatePbufferSurface(mDisplay, mConfig, pbufferAttributes);
+    }
+
     if (eglGetError() != EGL_SUCCESS)
     {
         destroyGL();
         return false;
     }
 
-    EGLint contextAttibutes[] =
+    std::vector<EGLint> contextAttibutes;
+    contextAttibutes.push_back(EGL_CONTEXT_CLIENT_VERSION);
+    contextAttibutes.push_back(mClientVersion);
+
+    // Only asked for when wanted, so that displays without KHR_create_context_no_error still work
+    if (mNoError)
     {
-        EGL_CONTEXT_CLIENT_VERSION, mClientVersion,
-        EGL_NONE
-    };
+        contextAttibutes.push_back(EGL_CONTEXT_OPENGL_NO_ERROR_KHR);
+        contextAttibutes.push_back(EGL_TRUE);
+    }
+
+    contextAttibutes.push_back(EGL_NONE);
 
-    mContext = eglCreateContext(mDisplay, mConfig, NULL, contextAttibutes);
+    mContext = eglCreateContext(mDisplay, mConfig, NULL, &contextAttibutes[0]);
     if (eglGetError() != EGL_SUCCESS)
     {
         destroyGL();
@@ -56,6 +56,7 @@ class EGLWindow
     void setConfigStencilBits(int bits) { mStencilBits = bits; }
     void setMultisample(bool multisample) { mMultisample = multisample; }
     void setSwapInterval(EGLint swapInterval) { mSwapInterval = swapInterval; }
+    void setNoError(bool noError) { mNoError = noError; }
 
     void swap();
 
@@ -75,6 +76,7 @@ class EGLWindow
     int getConfigStencilBits() const { return mStencilBits; }
     bool isMultisample() const { return mMultisample; }
     EGLint getSwapInterval() const { return mSwapInterval; }
+    bool isNoError() const { return mNoError; }
 
     bool initializeGL(OSWindow *osWindow);
     void destroyGL();
@@ -99,6 +101,7 @@ class EGLWindow
     int mStencilBits;
     bool mMultisample;
     EGLint mSwapInterval;
+    bool mNoError;
 };
 
 #endif // UTIL_EGLWINDOW_H_
@@ -83,4 +83,4 @@ class Event
     };
 };
 
-#endif SAMPLE_UTIL_EVENT_H
+#endif // SAMPLE_UTIL_EVENT_H
@@ -12,6 +12,7 @@
 #include <EGL/egl.h>
 #include <EGL/eglext.h>
 #include <list>
+#include <string>
 
 class OSWindow
 {
@@ -0,0 +1,46 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "linux/LinuxTimer.h"
+
+#include <time.h>
+
+static uint64_t GetCurrentTimeNs()
+{
+    struct timespec currentTime;
+    clock_gettime(CLOCK_MONOTONIC, &currentTime);
+    return static_cast<uint64_t>(currentTime.tv_sec) * 1000000000 + currentTime.tv_nsec;
+}
+
+LinuxTimer::LinuxTimer()
+    : mRunning(false),
+      mStartTimeNs(0),
+      mStopTimeNs(0)
+{
+}
+
+void LinuxTimer::start()
+{
+    mStartTimeNs = GetCurrentTimeNs();
+    mRunning = true;
+}
+
+void LinuxTimer::stop()
+{
+    mStopTimeNs = GetCurrentTimeNs();
+    mRunning = false;
+}
+
+double LinuxTimer::getElapsedTime() const
+{
+    uint64_t endTimeNs = mRunning ? GetCurrentTimeNs() : mStopTimeNs;
+    return static_cast<double>(endTimeNs - mStartTimeNs) * 1e-9;
+}
+
+Timer *CreateTimer()
+{
+    return new LinuxTimer();
+}
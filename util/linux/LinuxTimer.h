@@ -0,0 +1,28 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#ifndef SAMPLE_UTIL_LINUX_TIMER_H
+#define SAMPLE_UTIL_LINUX_TIMER_H
+
+#include "Timer.h"
+#include <stdint.h>
+
+class LinuxTimer : public Timer
+{
+  public:
+    LinuxTimer();
+
+    void start();
+    void stop();
+    double getElapsedTime() const;
+
+  private:
+    bool mRunning;
+    uint64_t mStartTimeNs;
+    uint64_t mStopTimeNs;
+};
+
+#endif // SAMPLE_UTIL_LINUX_TIMER_H
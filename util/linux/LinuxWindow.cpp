@@ -0,0 +1,60 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "linux/LinuxWindow.h"
+
+LinuxWindow::LinuxWindow()
+{
+}
+
+LinuxWindow::~LinuxWindow()
+{
+}
+
+bool LinuxWindow::initialize(const std::string &name, size_t width, size_t height)
+{
+    mWidth = width;
+    mHeight = height;
+    return true;
+}
+
+void LinuxWindow::destroy()
+{
+}
+
+EGLNativeWindowType LinuxWindow::getNativeWindow() const
+{
+    return 0;
+}
+
+EGLNativeDisplayType LinuxWindow::getNativeDisplay() const
+{
+    return EGL_DEFAULT_DISPLAY;
+}
+
+void LinuxWindow::messageLoop()
+{
+}
+
+void LinuxWindow::setMousePosition(int x, int y)
+{
+}
+
+bool LinuxWindow::resize(int width, int height)
+{
+    mWidth = width;
+    mHeight = height;
+    return true;
+}
+
+void LinuxWindow::setVisible(bool isVisible)
+{
+}
+
+OSWindow *CreateOSWindow()
+{
+    return new LinuxWindow();
+}
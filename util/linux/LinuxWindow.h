@@ -0,0 +1,36 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// LinuxWindow.h: An OSWindow without a window system behind it. ANGLE has no
+// window surfaces on Linux yet, so EGLWindow renders to a pbuffer of the
+// window's size instead.
+
+#ifndef SAMPLE_UTIL_LINUX_WINDOW_H
+#define SAMPLE_UTIL_LINUX_WINDOW_H
+
+#include "OSWindow.h"
+#include <string>
+
+class LinuxWindow : public OSWindow
+{
+  public:
+    LinuxWindow();
+    ~LinuxWindow();
+
+    bool initialize(const std::string &name, size_t width, size_t height);
+    void destroy();
+
+    EGLNativeWindowType getNativeWindow() const;
+    EGLNativeDisplayType getNativeDisplay() const;
+
+    void messageLoop();
+
+    void setMousePosition(int x, int y);
+    bool resize(int width, int height);
+    void setVisible(bool isVisible);
+};
+
+#endif // SAMPLE_UTIL_LINUX_WINDOW_H
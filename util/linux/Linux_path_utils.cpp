@@ -0,0 +1,24 @@
+//
+// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "path_utils.h"
+#include <array>
+#include <limits.h>
+#include <unistd.h>
+
+std::string GetExecutablePath()
+{
+    std::array<char, PATH_MAX> executableFileBuf;
+    ssize_t executablePathLen = readlink("/proc/self/exe", executableFileBuf.data(), executableFileBuf.size() - 1);
+    return (executablePathLen > 0 ? std::string(executableFileBuf.data(), executablePathLen) : "");
+}
+
+std::string GetExecutableDirectory()
+{
+    std::string executablePath = GetExecutablePath();
+    size_t lastPathSepLoc = executablePath.find_last_of("/");
+    return (lastPathSepLoc != std::string::npos) ? executablePath.substr(0, lastPathSepLoc) : "";
+}
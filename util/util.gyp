@@ -5,7 +5,9 @@
 {
     'conditions':
     [
-        ['OS=="win"',
+        # Outside of Windows, there is only something to render with when
+        # the null back-end is built.
+        ['OS=="win" or (OS=="linux" and angle_enable_null==1)',
         {
             'targets':
             [
@@ -39,11 +41,31 @@
                         'OSWindow.cpp',
                         'OSWindow.h',
                         'Timer.h',
-                        'win32/Win32_path_utils.cpp',
-                        'win32/Win32Timer.cpp',
-                        'win32/Win32Timer.h',
-                        'win32/Win32Window.cpp',
-                        'win32/Win32Window.h',
+                    ],
+                    'conditions':
+                    [
+                        ['OS=="win"',
+                        {
+                            'sources':
+                            [
+                                'win32/Win32_path_utils.cpp',
+                                'win32/Win32Timer.cpp',
+                                'win32/Win32Timer.h',
+                                'win32/Win32Window.cpp',
+                                'win32/Win32Window.h',
+                            ],
+                        }],
+                        ['OS=="linux"',
+                        {
+                            'sources':
+                            [
+                                'linux/Linux_path_utils.cpp',
+                                'linux/LinuxTimer.cpp',
+                                'linux/LinuxTimer.h',
+                                'linux/LinuxWindow.cpp',
+                                'linux/LinuxWindow.h',
+                            ],
+                        }],
                     ],
                     'msvs_disabled_warnings': [ 4201 ],
                     'direct_dependent_settings':